@@ -144,6 +144,7 @@
 #import <VerovioFramework/editortoolkit.h>
 #import <VerovioFramework/dynam.h>
 #import <VerovioFramework/svgdevicecontext.h>
+#import <VerovioFramework/teedevicecontext.h>
 #import <VerovioFramework/turn.h>
 #import <VerovioFramework/drawinginterface.h>
 #import <VerovioFramework/systemelement.h>
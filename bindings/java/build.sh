@@ -23,6 +23,7 @@ FILES="$SRCFILES \
  ../../src/hum/humlib.cpp \
  ../../src/json/jsonxx.cc \
  ../../libmei/attconverter.cpp \
+ ../../libmei/attnames.cpp \
  ../../libmei/atts_analytical.cpp \
  ../../libmei/atts_cmn.cpp \
  ../../libmei/atts_cmnornaments.cpp \
@@ -32,6 +32,7 @@ verovio_module = Extension('_verovio',
                                '../../src/midi/MidiFile.cpp',
                                '../../src/midi/MidiMessage.cpp',
                                '../../libmei/attconverter.cpp',
+                               '../../libmei/attnames.cpp',
                                '../../libmei/atts_analytical.cpp',
                                '../../libmei/atts_cmn.cpp',
                                '../../libmei/atts_cmnornaments.cpp',
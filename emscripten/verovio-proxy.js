@@ -18,6 +18,9 @@ verovio.vrvToolkit.editInfo = Module.cwrap('vrvToolkit_editInfo', 'string', ['nu
 // char *getAvailableOptions(Toolkit *ic)
 verovio.vrvToolkit.getAvailableOptions = Module.cwrap('vrvToolkit_getAvailableOptions', 'string', ['number']);
 
+// int getCastOffPageCount(Toolkit *ic)
+verovio.vrvToolkit.getCastOffPageCount = Module.cwrap('vrvToolkit_getCastOffPageCount', 'number', ['number']);
+
 // char *getElementAttr(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getElementAttr = Module.cwrap('vrvToolkit_getElementAttr', 'string', ['number', 'string']);
 
@@ -57,12 +60,18 @@ verovio.vrvToolkit.getMIDIValuesForElement = Module.cwrap('vrvToolkit_getMIDIVal
 // char *getVersion(Toolkit *ic)
 verovio.vrvToolkit.getVersion = Module.cwrap('vrvToolkit_getVersion', 'string', ['number']);
 
+// bool hasPendingPages(Toolkit *ic)
+verovio.vrvToolkit.hasPendingPages = Module.cwrap('vrvToolkit_hasPendingPages', 'number', ['number']);
+
 // bool loadData(Toolkit *ic, const char *data)
 verovio.vrvToolkit.loadData = Module.cwrap('vrvToolkit_loadData', 'number', ['number', 'string']);
 
 // void redoLayout(Toolkit *ic)
 verovio.vrvToolkit.redoLayout = Module.cwrap('vrvToolkit_redoLayout', null, ['number']);
 
+// void redoModifiedLayout(Toolkit *ic)
+verovio.vrvToolkit.redoModifiedLayout = Module.cwrap('vrvToolkit_redoModifiedLayout', null, ['number']);
+
 // void redoPagePitchPosLayout(Toolkit *ic)
 verovio.vrvToolkit.redoPagePitchPosLayout = Module.cwrap('vrvToolkit_redoPagePitchPosLayout', null, ['number']);
 
@@ -110,6 +119,10 @@ verovio.toolkit.prototype.getAvailableOptions = function () {
 	return JSON.parse(verovio.vrvToolkit.getAvailableOptions(this.ptr));
 };
 
+verovio.toolkit.prototype.getCastOffPageCount = function () {
+	return verovio.vrvToolkit.getCastOffPageCount(this.ptr);
+};
+
 verovio.toolkit.prototype.getElementAttr = function (xmlId) {
 	return JSON.parse(verovio.vrvToolkit.getElementAttr(this.ptr, xmlId));
 };
@@ -162,6 +175,10 @@ verovio.toolkit.prototype.getVersion = function () {
 	return verovio.vrvToolkit.getVersion(this.ptr);
 };
 
+verovio.toolkit.prototype.hasPendingPages = function () {
+	return verovio.vrvToolkit.hasPendingPages(this.ptr);
+};
+
 verovio.toolkit.prototype.loadData = function (data) {
 	return verovio.vrvToolkit.loadData(this.ptr, data);
 };
@@ -170,6 +187,10 @@ verovio.toolkit.prototype.redoLayout = function () {
 	verovio.vrvToolkit.redoLayout(this.ptr);
 }
 
+verovio.toolkit.prototype.redoModifiedLayout = function () {
+	verovio.vrvToolkit.redoModifiedLayout(this.ptr);
+}
+
 verovio.toolkit.prototype.redoPagePitchPosLayout = function () {
 	verovio.vrvToolkit.redoPagePitchPosLayout(this.ptr);
 }
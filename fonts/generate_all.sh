@@ -48,4 +48,7 @@ echo "Generating Petaluma files ..."
 saxon9ee Petaluma.svg extract-glyphs.xsl > tmp/Petaluma-bounding-boxes.svg
 phantomjs generate-bbox.js tmp/Petaluma-bounding-boxes.svg ../data/Petaluma.xml json/petaluma_metadata.json
 
+echo "Generating font bundles ..."
+python3 generate_bundle.py ../data Bravura Leipzig Gootville Petaluma
+
 echo "Done!"
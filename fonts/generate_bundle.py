@@ -0,0 +1,122 @@
+#! /usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# generate_bundle.py
+# Packs the glyph files (data/<Font>/*.xml) and the bounding box file (data/<Font>.xml)
+# of a font into a single binary bundle (data/<Font>.vrvfont) loaded by Resources::LoadFont.
+# The bundles in data are generated with the glyph files by generate_all.sh. The CMake build generates its own
+# in the build directory (fontbundles target in tools/CMakeLists.txt) and installs them.
+# Usage: python3 generate_bundle.py [-o <output path>] ../data Bravura Leipzig ...
+#
+# All values are little-endian. The layout is:
+# - header: magic "VRVF", version, glyph count, anchor count,
+#   glyph table offset, anchor table offset, string offset, string size (8 x uint32)
+# - glyph table: code, units per em, flags (1 = bounding box, 2 = horiz-adv-x), first anchor, anchor count,
+#   file name offset, file name size, symbol offset, symbol size, padding (10 x uint32),
+#   followed by x, y, w, h and horiz-adv-x (5 x double)
+# - anchor table: name offset, name size (2 x uint32), x, y (2 x double)
+# - strings: file names, symbols and anchor names (not null-terminated)
+
+import os
+import re
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+VERSION = 1
+HEADER = struct.Struct('<4s7I')
+GLYPH = struct.Struct('<10I5d')
+ANCHOR = struct.Struct('<2I2d')
+
+
+def units_per_em(symbol):
+    # Same as the Glyph constructor: the last value of the viewBox attribute
+    match = re.search(rb'viewBox="([^"]*)"', symbol)
+    if not match or match.group(1).count(b' ') < 3:
+        return 2048
+    return int(float(match.group(1).split(b' ')[-1]))
+
+
+def generate(path, font_name, output_path):
+    strings = bytearray()
+
+    def add_string(value):
+        offset = len(strings)
+        strings.extend(value)
+        return (offset, len(value))
+
+    glyphs = {}
+    font_dir = os.path.join(path, font_name)
+    for file_name in sorted(os.listdir(font_dir)):
+        if '.xml' not in file_name:
+            continue
+        code = int(re.match(r'[0-9A-Fa-f]*', file_name).group(0) or '0', 16)
+        if code == 0:
+            print('Invalid SMUFL code (0) for ' + file_name)
+            continue
+        with open(os.path.join(font_dir, file_name), 'rb') as f:
+            symbol = f.read()
+        glyphs[code] = {'file_name': file_name.encode('utf-8'), 'symbol': symbol,
+                        'units_per_em': units_per_em(symbol), 'flags': 0,
+                        'bbox': (0.0, 0.0, 0.0, 0.0), 'horiz_adv_x': 0.0, 'anchors': []}
+
+    bbox_file = os.path.join(path, font_name + '.xml')
+    if os.path.exists(bbox_file):
+        root = ET.parse(bbox_file).getroot()
+        units = root.get('units-per-em')
+        for g in root.findall('g') if units else []:
+            if g.get('c') is None:
+                continue
+            code = int(g.get('c'), 16)
+            # Skip the glyphs LoadFont would skip
+            if code not in glyphs or glyphs[code]['units_per_em'] != int(units):
+                continue
+            glyph = glyphs[code]
+            glyph['flags'] |= 1
+            glyph['bbox'] = tuple(float(g.get(att, '0.0')) for att in ('x', 'y', 'w', 'h'))
+            if g.get('h-a-x') is not None:
+                glyph['flags'] |= 2
+                glyph['horiz_adv_x'] = float(g.get('h-a-x'))
+            for a in g.findall('a'):
+                if a.get('n') is not None:
+                    anchor = (a.get('n').encode('utf-8'), float(a.get('x', '0')), float(a.get('y', '0')))
+                    glyph['anchors'].append(anchor)
+
+    glyph_table = bytearray()
+    anchor_table = bytearray()
+    anchor_count = 0
+    for code in sorted(glyphs):
+        glyph = glyphs[code]
+        file_name = add_string(glyph['file_name'])
+        symbol = add_string(glyph['symbol'])
+        for name, x, y in glyph['anchors']:
+            anchor_table.extend(ANCHOR.pack(*add_string(name), x, y))
+        glyph_table.extend(GLYPH.pack(code, glyph['units_per_em'], glyph['flags'], anchor_count,
+                                      len(glyph['anchors']), *file_name, *symbol, 0, *glyph['bbox'],
+                                      glyph['horiz_adv_x']))
+        anchor_count += len(glyph['anchors'])
+
+    glyph_offset = HEADER.size
+    anchor_offset = glyph_offset + len(glyph_table)
+    string_offset = anchor_offset + len(anchor_table)
+    header = HEADER.pack(b'VRVF', VERSION, len(glyphs), anchor_count, glyph_offset, anchor_offset, string_offset,
+                         len(strings))
+
+    with open(os.path.join(output_path, font_name + '.vrvfont'), 'wb') as f:
+        f.write(header)
+        f.write(glyph_table)
+        f.write(anchor_table)
+        f.write(strings)
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    output_path = None
+    if len(args) > 1 and args[0] == '-o':
+        output_path = args[1]
+        args = args[2:]
+    if len(args) < 2:
+        print('Usage: generate_bundle.py [-o <output path>] <data path> <font name> [<font name> ...]')
+        sys.exit(1)
+    for font_name in args[1:]:
+        generate(args[0], font_name, output_path or args[0])
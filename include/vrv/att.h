@@ -8,12 +8,14 @@
 #ifndef __VRV_ATT_H__
 #define __VRV_ATT_H__
 
+#include <bitset>
 #include <string>
 
 //----------------------------------------------------------------------------
 
 #include "attalternates.h"
 #include "attconverter.h"
+#include "pugixml.hpp"
 #include "vrvdef.h"
 
 namespace vrv {
@@ -110,10 +112,15 @@ public:
     std::string VUToStr(data_VU data) const;
     ///@}
 
-    /** @name Basic converters for reading */
+    /**
+     * @name Basic converters for reading
+     * The const char * overloads are the ones called by the Read* methods with the value of the pugi attribute.
+     */
     ///@{
     double StrToDbl(std::string value) const;
+    double StrToDbl(const char *value) const;
     int StrToInt(std::string value) const;
+    int StrToInt(const char *value) const;
     data_VU StrToVU(std::string value, bool logWarning = true) const;
     ///@}
 
@@ -127,6 +134,7 @@ public:
 
     std::string DurationToStr(data_DURATION data) const;
     data_DURATION StrToDuration(std::string value, bool logWarning = true) const;
+    data_DURATION StrToDuration(const char *value, bool logWarning = true) const;
 
     std::string FontsizenumericToStr(data_FONTSIZENUMERIC data) const;
     data_FONTSIZENUMERIC StrToFontsizenumeric(std::string value, bool logWarning = true) const;
@@ -169,12 +177,14 @@ public:
 
     std::string MidivalueToStr(data_MIDIVALUE data) const { return IntToStr(data); }
     data_MIDIVALUE StrToMidivalue(std::string value) const { return StrToInt(value); }
+    data_MIDIVALUE StrToMidivalue(const char *value) const { return StrToInt(value); }
 
     std::string NcnameToStr(data_NCNAME data) const { return StrToStr(data); }
     data_NCNAME StrToNcname(std::string value) const { return StrToStr(value); }
 
     std::string OctaveToStr(data_OCTAVE data) const { return IntToStr(data); }
     data_OCTAVE StrToOctave(std::string value) const { return StrToInt(value); }
+    data_OCTAVE StrToOctave(const char *value) const { return StrToInt(value); }
 
     std::string OctaveDisToStr(data_OCTAVE_DIS data) const;
     data_OCTAVE_DIS StrToOctaveDis(std::string value, bool logWarning = true) const;
@@ -193,6 +203,7 @@ public:
 
     std::string PitchnameToStr(data_PITCHNAME data) const;
     data_PITCHNAME StrToPitchname(std::string value, bool logWarning = true) const;
+    data_PITCHNAME StrToPitchname(const char *value, bool logWarning = true) const;
 
     std::string ProlatioToStr(data_PROLATIO data) const;
     data_PROLATIO StrToProlatio(std::string value, bool logWarning = true) const;
@@ -232,6 +243,87 @@ public:
     ///@}
 };
 
+//----------------------------------------------------------------------------
+// AttNameEntry
+//----------------------------------------------------------------------------
+
+/**
+ * An att class reading a name, with the index of the name in the Read* method of the class.
+ */
+struct AttNameOwner {
+    AttClassId m_attClassId;
+    int m_index;
+};
+
+/**
+ * A name read by the att classes, with the classes reading it (see AttReader::FindName).
+ */
+struct AttNameEntry {
+    const char *m_name;
+    const AttNameOwner *m_owners;
+    int m_ownerCount;
+};
+
+//----------------------------------------------------------------------------
+// AttReader
+//----------------------------------------------------------------------------
+
+/**
+ * This class dispatches the attributes of an element to the Read* methods of the att classes.
+ * It goes once over the attributes of the element and looks up each name in the table of the names read by the
+ * att classes. A Read* method then only goes over the attributes read by its class and removes them through the
+ * reader. An attribute removed from the element other than through the reader must not be read through it
+ * afterwards, and attributes added to the element are not seen. The reader has to be built again in both cases.
+ */
+class AttReader {
+public:
+    /** @name Constructors and destructor */
+    ///@{
+    AttReader(pugi::xml_node element);
+    virtual ~AttReader();
+    ///@}
+
+    /**
+     * Return true if the element has attributes read by the att class.
+     * They can have been read already.
+     */
+    bool HasAttClass(AttClassId attClassId) const { return m_attClasses.test(attClassId); }
+
+    /**
+     * @name Getters for the attributes of the element read by any att class
+     */
+    ///@{
+    int GetAttributeCount() const { return (int)m_attributes.size(); }
+    const char *GetValue(int i) const { return m_attributes[i].first.value(); }
+    ///@}
+
+    /**
+     * Return the index of the name of the attribute in the Read* method of the att class.
+     * Return -1 if the class does not read it or if the attribute was already read.
+     */
+    int GetNameIndex(int i, AttClassId attClassId) const;
+
+    /**
+     * Remove the attribute from the element once read.
+     */
+    void Remove(int i);
+
+    /**
+     * Look up a name in the table of the names read by the att classes.
+     * Return NULL if no att class reads it.
+     * The table is generated in libmei/attnames.cpp by libmei/generate_read_methods.py.
+     */
+    static const AttNameEntry *FindName(const char *name);
+
+private:
+    /** The element */
+    pugi::xml_node m_element;
+    /** The attributes of the element read by any att class, with their name (NULL once read) */
+    std::vector<std::pair<pugi::xml_attribute, const AttNameEntry *> > m_attributes;
+    /** The att classes reading at least one of the attributes */
+    std::bitset<ATT_CLASS_max> m_attClasses;
+};
+
 //----------------------------------------------------------------------------
 // Interface
 //----------------------------------------------------------------------------
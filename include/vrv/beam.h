@@ -169,6 +169,8 @@ public:
     ///@{
     BeamElementCoord() { m_element = NULL; }
     virtual ~BeamElementCoord();
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr);
 
     int m_x;
     int m_y; // represents the point farthest from the beam
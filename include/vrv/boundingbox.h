@@ -39,6 +39,15 @@ public:
     bool Is(const std::vector<ClassId> &classIds) const;
     ///@}
 
+    /**
+     * @name Allocation operators using the arena bound to the current thread.
+     * See Arena
+     */
+    ///@{
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr);
+    ///@}
+
     /**
      * @name Methods for updating the bounding boxes and for providing information about their status.
      */
@@ -222,14 +231,14 @@ private:
      * Calculate the rectangles with 2 anchor points.
      * Return false (and one single rectangle) when anchor points are out of the boundaries.
      */
-    bool GetGlyph2PointRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, Glyph *glyph1,
+    bool GetGlyph2PointRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, const Glyph *glyph1,
         Point rect[3][2], Doc *doc) const;
 
     /**
      * Calculate the rectangles with 1 anchor point.
      * Return false (and one single rectangle) when anchor points are out of the boundaries.
      */
-    bool GetGlyph1PointRectangles(const SMuFLGlyphAnchor &anchor, Glyph *glyph, Point rect[2][2], Doc *doc) const;
+    bool GetGlyph1PointRectangles(const SMuFLGlyphAnchor &anchor, const Glyph *glyph, Point rect[2][2], Doc *doc) const;
 
 public:
     //
@@ -321,6 +330,60 @@ private:
     ArrayOfIntPairs m_segments;
 };
 
+//----------------------------------------------------------------------------
+// BoundingBoxIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class indexes bounding boxes by the horizontal position of their content.
+ * It is used for finding the boxes overlapping horizontally with another one without going through all of them.
+ * Each box is identified by a position, usually the one it has in the array of boxes being indexed.
+ * The boxes are expected not to move horizontally once added.
+ */
+class BoundingBoxIndex {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    BoundingBoxIndex();
+    virtual ~BoundingBoxIndex(){};
+    ///@}
+
+    /**
+     * Add all the boxes of an array with their position in it
+     */
+    void AddBoxes(const ArrayOfBoundingBoxes &boxes);
+
+    /**
+     * Add a box with the given position.
+     * Boxes without content bounding box are ignored since they cannot overlap.
+     */
+    void AddBox(const BoundingBox *box, int position);
+
+    /**
+     * Fill positions with the positions of the boxes overlapping horizontally with the box.
+     * The overlap is the same as with BoundingBox::HorizontalContentOverlap without margin.
+     * The positions are in increasing order.
+     */
+    void FindHorizontalContentOverlaps(const BoundingBox *box, std::vector<int> &positions) const;
+
+private:
+    //
+public:
+    //
+private:
+    /**
+     * The content left, the content right and the position of the boxes, sorted by left
+     */
+    std::vector<std::tuple<int, int, int> > m_boxes;
+
+    /**
+     * The maximum width of the boxes, which bounds the search to the left
+     */
+    int m_maxWidth;
+};
+
 } // namespace vrv
 
 #endif
@@ -24,6 +24,7 @@ namespace vrv {
 
 class Glyph;
 class Object;
+class Resources;
 class View;
 class Zone;
 
@@ -75,12 +76,13 @@ public:
 
     /**
      * @name Getters and setters for common attributes.
-     * Non-virtual methods cannot be overridden and manage the width, height and user-scale
+     * The setters manage the width, height and user-scale. They are virtual only for the TeeDeviceContext to
+     * forward them and should otherwise not be overridden.
      */
     ///@{
-    void SetWidth(int width) { m_width = width; }
-    void SetHeight(int height) { m_height = height; }
-    void SetUserScale(double scaleX, double scaleY)
+    virtual void SetWidth(int width) { m_width = width; }
+    virtual void SetHeight(int height) { m_height = height; }
+    virtual void SetUserScale(double scaleX, double scaleY)
     {
         m_userScaleX = scaleX;
         m_userScaleY = scaleY;
@@ -91,17 +93,27 @@ public:
     double GetUserScaleY() { return m_userScaleY; }
     ///@}
 
+    /**
+     * @name Getter and setter for the resources (fonts) used for the glyphs and the text extends.
+     * They are set by the View before drawing.
+     */
+    ///@{
+    virtual void SetResources(const Resources *resources) { m_resources = resources; }
+    const Resources *GetResources() const { return m_resources; }
+    ///@}
+
     /**
      * @name Setters
-     * Non-virtual methods cannot be overridden and manage the Pen, Brush and FontInfo stacks
+     * The non-pure virtual methods manage the Pen, Brush and FontInfo stacks. They are virtual only for the
+     * TeeDeviceContext to forward them and should otherwise not be overridden.
      */
     ///@{
-    void SetBrush(int colour, int opacity);
-    void SetPen(int colour, int width, int opacity, int dashLength = 0, int lineCap = 0);
-    void SetFont(FontInfo *font);
-    void ResetBrush();
-    void ResetPen();
-    void ResetFont();
+    virtual void SetBrush(int colour, int opacity);
+    virtual void SetPen(int colour, int width, int opacity, int dashLength = 0, int lineCap = 0);
+    virtual void SetFont(FontInfo *font);
+    virtual void ResetBrush();
+    virtual void ResetPen();
+    virtual void ResetFont();
     virtual void SetBackground(int colour, int style = AxSOLID) = 0;
     virtual void SetBackgroundImage(void *image, double opacity = 1.0) = 0;
     virtual void SetBackgroundMode(int mode) = 0;
@@ -183,15 +195,15 @@ public:
      * @name Temporarily deactivate a graphic
      * This can be used for example for not taking into account the bounding box of parts of the graphic.
      * One example is the connectors in lyrics.
-     * This is a non-virtual method and hence cannot be overridden. In only changes a flag. The effect of the flag
-     * has to be defined in the child class. It should not be called twice in a row.
+     * The methods only change a flag and are overridden only by the TeeDeviceContext for forwarding it. The effect
+     * of the flag has to be defined in the child class. It should not be called twice in a row.
      * Is it also possible to deactivate only X or Y axis. Reactivate will reactivate both axis.
      */
     ///@{
-    void DeactivateGraphic();
-    void DeactivateGraphicX();
-    void DeactivateGraphicY();
-    void ReactivateGraphic();
+    virtual void DeactivateGraphic();
+    virtual void DeactivateGraphicX();
+    virtual void DeactivateGraphicY();
+    virtual void ReactivateGraphic();
     ///@}
 
     /**
@@ -203,6 +215,17 @@ public:
     virtual void EndGraphic(Object *object, View *view) = 0;
     ///@}
 
+    /**
+     * @name Methods for starting or resuming a graphic identified by the uuid of the object
+     * The uuid string is generated only when the context outputs it, which is not the case with
+     * the BBoxDeviceContext used for the layout passes.
+     */
+    ///@{
+    void StartGraphic(Object *object, std::string gClass);
+    void ResumeGraphic(Object *object);
+    void StartTextGraphic(Object *object, std::string gClass);
+    ///@}
+
     /**
      * @name Method for starting and ending a graphic custom graphic that do not correspond to an Object
      * For example, the method can be used for grouping shapes in <g></g> in SVG
@@ -267,7 +290,7 @@ public:
     virtual bool UseGlobalStyling() { return false; }
 
 private:
-    void AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend);
+    void AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend);
 
 public:
     //
@@ -282,6 +305,9 @@ protected:
 
     Zone *m_facsimile = NULL;
 
+    /** The resources of the document being drawn */
+    const Resources *m_resources = NULL;
+
 private:
     /** stores the width and height of the device context */
     int m_width;
@@ -8,11 +8,18 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "expansionmap.h"
 #include "facsimile.h"
 #include "options.h"
 #include "scoredef.h"
+#include "vrv.h"
 
 namespace smf {
 class MidiFile;
@@ -23,12 +30,148 @@ namespace vrv {
 class CastOffPagesParams;
 class FontInfo;
 class Glyph;
+class Measure;
 class Pages;
 class Page;
 class Score;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
+//----------------------------------------------------------------------------
+// RealTimeSpan
+//----------------------------------------------------------------------------
+
+/**
+ * A span in real time (milliseconds) of an object in the MIDI timemap index.
+ * Spans are kept sorted by start time and m_maxEnd is the maximum end of all the spans up to this one.
+ * m_order is the position of the object in the document order.
+ */
+struct RealTimeSpan {
+    double m_start;
+    double m_end;
+    double m_maxEnd;
+    int m_order;
+    Object *m_object;
+};
+
+typedef std::vector<RealTimeSpan> ArrayOfRealTimeSpans;
+
+//----------------------------------------------------------------------------
+// ClassIdIndex
+//----------------------------------------------------------------------------
+
+/**
+ * The objects processed from a root object, used for calling functors only on the classes they handle.
+ * m_objects is in processing order and m_subtreeEnds is the position after the processed descendants of each object.
+ * m_positions lists the positions of the objects of each ClassId.
+ * m_treeVersion is the tree version of the document when the index was built.
+ */
+struct ClassIdIndex {
+    ArrayOfObjects m_objects;
+    std::vector<int> m_subtreeEnds;
+    std::vector<std::vector<int> > m_positions;
+    unsigned long m_treeVersion;
+};
+
+//----------------------------------------------------------------------------
+// Arena
+//----------------------------------------------------------------------------
+
+/**
+ * This class is a pool allocator for the objects of a document.
+ * It is used by the BoundingBox (and thus all Object) and BeamElementCoord allocation operators.
+ * The blocks are taken from large chunks and recycled by size with free lists.
+ * The arena used for new allocations is the one bound to the current thread (see Toolkit::BindToCurrentThread).
+ * Each block keeps a pointer to its arena, so it can be freed from any thread.
+ * Without arena bound, or for large blocks, the global heap is used.
+ */
+class Arena {
+public:
+    /**
+     * @name Constructors, destructors
+     * The arena must not be deleted directly but with Arena::Discard.
+     */
+    ///@{
+    Arena();
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    ///@}
+
+    /**
+     * @name Allocate and free a block with the arena bound to the current thread
+     */
+    ///@{
+    static void *Allocate(std::size_t size);
+    static void Free(void *ptr);
+    ///@}
+
+    /**
+     * @name Set and get the arena bound to the current thread (NULL for the global heap)
+     */
+    ///@{
+    static void SetCurrent(Arena *arena);
+    static Arena *GetCurrent();
+    ///@}
+
+    /**
+     * Release all the chunks at once if no block is in use anymore.
+     * The chunks are kept otherwise and their free blocks reused.
+     */
+    void ReleaseUnused();
+
+    /**
+     * Delete the arena, or let the last block freed delete it if some blocks are still in use.
+     */
+    void Discard();
+
+    /**
+     * Return the number of blocks in use
+     */
+    int GetBlockCount();
+
+    /**
+     * Return the total number of blocks allocated since the arena was created.
+     * This can be used for checking that an operation (e.g., a relayout) does not allocate objects.
+     */
+    long GetAllocationCount();
+
+private:
+    virtual ~Arena();
+
+    /**
+     * @name Get a block of a size class (in multiples of the alignment) and put it back to its free list.
+     */
+    ///@{
+    void *AllocateBlock(int sizeClass);
+    void FreeBlock(void *block, int sizeClass);
+    ///@}
+
+public:
+    //
+private:
+    /** The mutex for the blocks allocated and freed from different threads */
+    std::mutex m_mutex;
+
+    /** The chunks in which the blocks are allocated */
+    std::vector<char *> m_chunks;
+
+    /** The position and the end of the unused space in the current chunk */
+    char *m_chunkCurrent;
+    char *m_chunkEnd;
+
+    /** The head of the free list for each size class */
+    std::vector<void *> m_freeLists;
+
+    /** The number of blocks in use */
+    int m_blockCount;
+
+    /** The total number of blocks allocated */
+    long m_allocationCount;
+
+    /** A flag indicating that the arena is to be deleted once no block is in use */
+    bool m_isDiscarded;
+};
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -64,12 +207,59 @@ public:
      */
     virtual void Refresh();
 
+    /**
+     * @name Methods for the uuid index of the document.
+     * The index is maintained by Object when objects are attached, detached, or when their uuid changes.
+     * Several objects can be indexed with the same uuid.
+     */
+    ///@{
+    void AddToUuidIndex(Object *object);
+    void RemoveFromUuidIndex(Object *object);
+    void FindAllInUuidIndex(const std::string &uuid, ArrayOfObjects *objects) const;
+    ///@}
+
+    /**
+     * @name Methods for the tree version and the ClassId indexes of the document (see Functor::m_classIds).
+     * The tree version changes when objects are attached, detached or modified and the indexes are cached by
+     * processing root. GetClassIdIndex returns NULL if no index was built for the current tree version.
+     * The index of an older version is evicted when it is looked up or when a newer one is set, and the index of a
+     * root when the root is removed from the uuid index (i.e., detached or deleted).
+     * Shared pointers are used because a page layout worker can replace an index another one is using.
+     */
+    ///@{
+    unsigned long GetTreeVersion() const;
+    void IncrementTreeVersion();
+    std::shared_ptr<ClassIdIndex> GetClassIdIndex(Object *root);
+    void SetClassIdIndex(Object *root, std::shared_ptr<ClassIdIndex> index);
+    ///@}
+
     /**
      * Getter for the options
      */
     Options *GetOptions() const { return m_options; }
     void SetOptions(Options *options) { (*m_options) = *options; };
 
+    /**
+     * @name Getters for the resources (path and fonts) of the document
+     */
+    ///@{
+    const Resources &GetResources() const { return m_resources; }
+    Resources &GetResourcesForModification() { return m_resources; }
+    ///@}
+
+    /**
+     * Getter for the uuid generator of the document.
+     * See Object::SetUuidGenerator
+     */
+    UuidGenerator *GetUuidGenerator() { return &m_uuidGenerator; }
+
+    /**
+     * Getter for the arena allocating the objects of the document.
+     * Reset replaces it if some of its blocks are still in use elsewhere, so it must not be kept across a Reset.
+     * See Arena::SetCurrent
+     */
+    Arena *GetArena() { return m_arena; }
+
     /**
      * Generate a document scoreDef when none is provided.
      * This only looks at the content first system of the document.
@@ -117,10 +307,17 @@ public:
     Pages *GetPages();
 
     /**
-     * Get the total page count
+     * Get the total page count.
+     * With a progressive cast off, the pending pages are cast off first (see Doc::CastOffPendingPages).
      */
     int GetPageCount();
 
+    /**
+     * Get the count of the pages cast off so far, without casting off the pending pages of a progressive cast off.
+     * The pending page is counted as one page, so the count is a lower bound of the total page count.
+     */
+    int GetCastOffPageCount();
+
     /**
      * Return true if the MIDI generation is already done
      */
@@ -199,6 +396,13 @@ public:
      */
     bool HasMidiTimemap();
 
+    /**
+     * Find the first measure enclosing the time (in milliseconds) and fill the notes sounding at that time.
+     * This uses the index of the MIDI timemap built by CalculateMidiTimemap. The index is rebuilt if objects
+     * were added or removed from the document since. Return NULL if no measure encloses the time.
+     */
+    Measure *FindMeasureAndNotesAtTime(int millisec, ArrayOfObjects *notes);
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layers and fill the midi file content.
@@ -234,6 +438,14 @@ public:
      */
     void PrepareDrawing();
 
+    /**
+     * Prepare the drawing again only for the measures modified since the last layout (see Object::Modify).
+     * Only the preparation local to a measure (cross-staff, cue size and layer element parts) is done.
+     * The links between elements (@startid, @tstamp, @next, @plist, etc.) are not resolved again and
+     * PrepareDrawing needs to be called instead when they might have changed.
+     */
+    void PrepareModifiedMeasures();
+
     /**
      * Casts off the entire document.
      * Starting from a single system, create and fill pages and systems.
@@ -243,12 +455,28 @@ public:
     /**
      * Casts off the running elements (headers and footer)
      * Called from Doc::CastOffDoc
-     * The doc needs to be empty, the methods adds two empty pages to calculate the
-     * size of the header and footer of the page one and two.
+     * The methods adds two empty pages at the beginning of the doc to calculate the
+     * size of the header and footer of the page one and two. The doc is empty unless the cast off is progressive.
      * Calcultated sizes are set in the CastOffPagesParams object.
      */
     void CastOffRunningElements(CastOffPagesParams *params);
 
+    /**
+     * Cast off the pending systems of a progressive cast off (see Options::m_progressiveCastOff) until pageCount
+     * pages are final, or until all of them are with the default value.
+     * With a progressive cast off, Doc::CastOffDoc casts off only the first page. The systems not cast off yet are
+     * kept in a pending page after the final ones, which is also counted by Doc::GetCastOffPageCount.
+     * The systems are laid out vertically and cast off by chunks, each chunk starting with a new page.
+     * The horizontal layout, the cast off of the systems and the optimization of the scoreDefs are not progressive
+     * and are still done for the whole document by Doc::CastOffDoc.
+     */
+    void CastOffPendingPages(int pageCount = VRV_UNSET);
+
+    /**
+     * Return true if a progressive cast off left systems to be cast off (see Doc::CastOffPendingPages)
+     */
+    bool HasPendingPages() const { return (m_pendingCastOffParams != NULL); }
+
     /**
      * Undo the cast off of the entire document.
      * The document will then contain one single page with one single system.
@@ -261,6 +489,24 @@ public:
      */
     void CastOffEncodingDoc();
 
+    /**
+     * Lay out the pages ahead of their rendering (see Page::LayOutAhead).
+     * The pages are laid out concurrently on threadCount threads, each with its own drawing page and fonts.
+     * The running elements shared by the pages are laid out beforehand, and again for each page when rendered.
+     * Pages sharing elements with another page (e.g., a slur continuing on the next page) or with their own
+     * dimensions are skipped and laid out when rendered.
+     * Only the pages from firstIdx to lastIdx (0-based, VRV_UNSET for the last page) are laid out. With a progressive
+     * cast off, the pending pages are cast off up to lastIdx.
+     */
+    void LayOutPagesAhead(int threadCount, int firstIdx = 0, int lastIdx = VRV_UNSET);
+
+    /**
+     * Redo the layout of the pages with measures modified since the last layout (see Object::Modify).
+     * Returns false when the document needs to be cast off again, which is when the width of a system changed,
+     * when a page overflows, or when a modified page has not been laid out since it was cast off.
+     */
+    bool LayOutModifiedPages();
+
     /**
      * Convert the doc from score-based to page-based MEI.
      * Containers will be converted to boundaryStart / boundaryEnd.
@@ -328,7 +574,7 @@ public:
      * be done with Doc::SetDrawingPage. This is only a method for
      * asserting that currently have the right page.
      */
-    Page *GetDrawingPage() const { return m_drawingPage; }
+    Page *GetDrawingPage() const;
 
     /**
      * Return the width adjusted to the content of the current drawing page.
@@ -359,7 +605,7 @@ public:
      * @name Setter and getter for facsimile
      */
     ///@{
-    void SetFacsimile(Facsimile *facsimile) { m_facsimile = facsimile; }
+    void SetFacsimile(Facsimile *facsimile);
     Facsimile *GetFacsimile() { return m_facsimile; }
     bool HasFacsimile() const { return m_facsimile != NULL; }
     ///@}
@@ -378,12 +624,51 @@ public:
      */
     virtual int PrepareTimestampsEnd(FunctorParams *functorParams);
 
+protected:
+    /**
+     * See Object::GetOwnedObjects
+     */
+    virtual void GetOwnedObjects(ArrayOfObjects *objects);
+
 private:
     /**
      * Calculates the music font size according to the m_interlDefin reference value.
      */
     int CalcMusicFontSize();
 
+    /**
+     * Build the index of the MIDI timemap with the real time spans of the measures (for each repeat)
+     * and of the notes within each measure.
+     */
+    void PrepareTimemapIndex();
+
+    /**
+     * Fill the list of the measures modified since the last layout.
+     * They are looked for only in the pages and the systems modified.
+     */
+    void FindModifiedMeasures(ArrayOfObjects *measures);
+
+    /**
+     * Mark the pages, the systems and the measures as not modified once laid out.
+     * Other objects are left untouched since ObjectListInterface relies on their flag.
+     */
+    void ResetModifiedMeasures();
+
+    /**
+     * Run the layout method (e.g., Page::LayOutAhead) of the pages on threadCount threads.
+     * Each thread takes the next page to lay out and has its own drawing page and fonts (see LayoutWorker).
+     */
+    void LayOutPagesConcurrently(const std::vector<Page *> &pages, void (Page::*layOut)(), int threadCount);
+
+    /**
+     * Lay out the content page horizontally as Page::LayOutHorizontally does, but with the content of the measures
+     * aligned concurrently on threadCount threads. For this, the content system is split into temporary pages where
+     * no element spans from one measure to the other. The measures are then put back in the content system for
+     * adjusting them across each other.
+     * Return false (with nothing done) if the content system cannot be split.
+     */
+    bool LayOutContentHorizontally(Page *contentPage, int threadCount);
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -443,6 +728,15 @@ private:
      */
     Options *m_options;
 
+    /** The resources (path and fonts) used for rendering the document */
+    Resources m_resources;
+
+    /** The generator for the uuids of the objects created for the document */
+    UuidGenerator m_uuidGenerator;
+
+    /** The arena for the objects created for the document */
+    Arena *m_arena;
+
     /*
      * The following values are set in the Doc::SetDrawingPage.
      * They are all current values to be used when drawing a page in a View and
@@ -492,6 +786,22 @@ private:
      */
     double m_MIDITimemapTempo;
 
+    /**
+     * The index of the MIDI timemap.
+     * The spans of the notes are relative to the measure, one array for each measure span order.
+     */
+    ///@{
+    ArrayOfRealTimeSpans m_timemapMeasureSpans;
+    std::vector<ArrayOfRealTimeSpans> m_timemapNoteSpans;
+    unsigned long m_timemapTreeVersion;
+    ///@}
+
+    /**
+     * A counter incremented each time an object is added to or removed from the uuid index.
+     * It is used to detect when the tree has changed, e.g., for the MIDI timemap index
+     */
+    unsigned long m_treeVersion = 0;
+
     /**
      * A flag to indicate whereas the document contains analytical markup to be converted.
      * This is currently limited to @fermata and @tie. Other attribute markup (@accid and @artic)
@@ -520,6 +830,27 @@ private:
 
     /** Facsimile information */
     Facsimile *m_facsimile = NULL;
+
+    /**
+     * The parameters for casting off the pending page of a progressive cast off (see Doc::CastOffPendingPages).
+     * NULL when the document is entirely cast off.
+     */
+    CastOffPagesParams *m_pendingCastOffParams = NULL;
+    /** The number of systems in the next chunk cast off from the pending page */
+    int m_pendingCastOffSystemCount;
+
+    /**
+     * The uuid index of all the objects in the document (including the facsimile).
+     * It is keyed by the hash of the uuid (see Object::GetUuidHash) so that it does not keep a copy of each uuid.
+     */
+    std::unordered_multimap<unsigned int, Object *> m_uuidIndex;
+    /** The mutex for the uuid index, which is modified by the page layout workers */
+    mutable std::mutex m_uuidIndexMutex;
+
+    /** The ClassId indexes by processing root */
+    std::map<Object *, std::shared_ptr<ClassIdIndex> > m_classIdIndexes;
+    /** The mutex for the ClassId indexes, which are built by the page layout workers */
+    mutable std::mutex m_classIdIndexMutex;
 };
 
 } // namespace vrv
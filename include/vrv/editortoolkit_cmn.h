@@ -28,7 +28,7 @@ namespace vrv {
 
 class EditorToolkitCMN : public EditorToolkit {
 public:
-    EditorToolkitCMN(Doc *doc, View *view) : EditorToolkit(doc, view) {}
+    EditorToolkitCMN(Doc *doc, View *view) : EditorToolkit(doc, view) { m_linksModified = false; }
     bool ParseEditorAction(const std::string &json_editorAction, bool commitOnly = false);
     virtual std::string EditInfo();
 
@@ -61,12 +61,22 @@ protected:
 
     bool DeleteNote(Note *note);
 
+    /**
+     * Mark the element as modified after a pitch change (see Doc::PrepareModifiedMeasures).
+     */
+    void PitchModified(Object *element);
+
     Object *GetElement(std::string &elementId);
 
 public:
     //
 protected:
     std::string m_chainedId;
+    /**
+     * A flag indicating that an action changed the links between elements (e.g., a note was deleted or a slur
+     * inserted) and that the whole document needs to be prepared again at the next commit.
+     */
+    bool m_linksModified;
 };
 } // namespace vrv
 
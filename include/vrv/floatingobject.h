@@ -33,7 +33,7 @@ public:
      */
     ///@{
     FloatingObject();
-    FloatingObject(std::string classid);
+    FloatingObject(const char *classid);
     virtual ~FloatingObject();
     virtual void Reset();
     virtual ClassId GetClassId() const { return FLOATING_OBJECT; }
@@ -148,6 +148,12 @@ public:
     virtual ~FloatingPositioner(){};
     virtual ClassId GetClassId() const { return FLOATING_POSITIONER; }
 
+    /**
+     * Initialize the positioner for the object.
+     * Also called when a positioner is reused for another object (see StaffAlignment::SetCurrentFloatingPositioner)
+     */
+    void InitPositioner(FloatingObject *object, StaffAlignment *alignment, char spanningType);
+
     virtual void ResetPositioner();
 
     /**
@@ -176,9 +182,13 @@ public:
     FloatingObject *GetObject() const { return m_object; }
 
     /**
-     * Getter for the StaffAlignment (asserted, cannot be NULL)
+     * @name Setter and getter for the StaffAlignment (asserted, cannot be NULL)
+     * The setter is used when the positioner is moved to another alignment (see SystemAligner::MovePositionersFrom)
      */
+    ///@{
+    void SetAlignment(StaffAlignment *alignment) { m_alignment = alignment; }
     StaffAlignment *GetAlignment() const { return m_alignment; }
+    ///@}
 
     /**
      * Getter for the spanning type
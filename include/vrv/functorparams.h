@@ -807,6 +807,8 @@ public:
  * member 2: a pointer to the current page
  * member 3: the cummulated shift (m_drawingYRel of the first system of the current page)
  * member 4: the page height
+ * member 5: the heights of the header and footer of the first and the other pages
+ * member 9: the pending page before which the pages are added (NULL for adding them at the end)
  **/
 
 class CastOffPagesParams : public FunctorParams {
@@ -816,6 +818,7 @@ public:
         m_contentPage = contentPage;
         m_doc = doc;
         m_currentPage = currentPage;
+        m_pendingPage = NULL;
         m_shift = 0;
         m_pageHeight = 0;
         m_pgHeadHeight = 0;
@@ -832,6 +835,7 @@ public:
     int m_pgFootHeight;
     int m_pgHead2Height;
     int m_pgFoot2Height;
+    Page *m_pendingPage;
 };
 
 //----------------------------------------------------------------------------
@@ -1147,12 +1151,35 @@ public:
 // GenerateMIDIParams
 //----------------------------------------------------------------------------
 
+/**
+ * The MIDI output of a staff/layer pair.
+ * Events are written to a separate buffer for each pair so that the document can be processed in a single pass.
+ * The buffers are appended to the MidiFile in staff/layer order afterwards.
+ */
+class MIDILayerBuffer {
+public:
+    MIDILayerBuffer()
+    {
+        m_midiFile = NULL;
+        m_midiChannel = 0;
+        m_midiTrack = 1;
+        m_transSemi = 0;
+    }
+    smf::MidiFile *m_midiFile;
+    int m_midiChannel;
+    int m_midiTrack;
+    int m_transSemi;
+};
+
+typedef std::map<std::pair<int, int>, MIDILayerBuffer> MapOfMIDILayerBuffers;
+
 /**
  * member 0: MidiFile*: the MidiFile we are writing to
- * member 1: int: the midi track number
+ * member 1: MapOfMIDILayerBuffers: the buffers for each staff/layer (@n) pair
+ * member 2: MIDILayerBuffer*: the buffer of the layer being processed
  * member 3: double: the score time from the start of the music to the start of the current measure
- * member 4: int: the semi tone transposition for the current track
- * member 5: int with the current tempo
+ * member 4: int with the current tempo
+ * member 5: the functor for redirection
  **/
 
 class GenerateMIDIParams : public FunctorParams {
@@ -1160,18 +1187,15 @@ public:
     GenerateMIDIParams(smf::MidiFile *midiFile, Functor *functor)
     {
         m_midiFile = midiFile;
-        m_midiChannel = 0;
-        m_midiTrack = 1;
+        m_currentLayerBuffer = NULL;
         m_totalTime = 0.0;
-        m_transSemi = 0;
         m_currentTempo = 120;
         m_functor = functor;
     }
     smf::MidiFile *m_midiFile;
-    int m_midiChannel;
-    int m_midiTrack;
+    MapOfMIDILayerBuffers m_layerBuffers;
+    MIDILayerBuffer *m_currentLayerBuffer;
     double m_totalTime;
-    int m_transSemi;
     int m_currentTempo;
     Functor *m_functor;
 };
@@ -36,12 +36,13 @@ public:
     ///@{
     Glyph();
     Glyph(std::string path, std::string codeStr);
+    Glyph(std::string path, std::string codeStr, int unitsPerEm, std::string xml);
     Glyph(int unitsPerEm);
     virtual ~Glyph();
     ///@}
 
     /** Get the bounds of the glyph */
-    void GetBoundingBox(int &x, int &y, int &w, int &h);
+    void GetBoundingBox(int &x, int &y, int &w, int &h) const;
 
     /**
      * Set the bounds of the glyph
@@ -54,16 +55,19 @@ public:
     int GetUnitsPerEm() const { return m_unitsPerEm; }
 
     /** Get the path */
-    std::string GetPath() { return m_path; }
+    std::string GetPath() const { return m_path; }
 
     /** Get the code string */
-    std::string GetCodeStr() { return m_codeStr; }
+    std::string GetCodeStr() const { return m_codeStr; }
+
+    /** Get the XML (SVG symbol) of the glyph - empty when it has to be read from the path */
+    const std::string &GetXML() const { return m_xml; }
 
     /**
      * @name Setter and getter for the horizAdvX
      */
     ///@{
-    int GetHorizAdvX() { return m_horizAdvX; }
+    int GetHorizAdvX() const { return m_horizAdvX; }
     void SetHorizAdvX(double horizAdvX) { m_horizAdvX = (int)(horizAdvX * 10.0); }
     ///@}
 
@@ -76,12 +80,12 @@ public:
     /**
      * Check if the glyph has anchor provided.
      */
-    bool HasAnchor(SMuFLGlyphAnchor anchor);
+    bool HasAnchor(SMuFLGlyphAnchor anchor) const;
 
     /**
      * Return the SMuFL anchor for the glyph.
      */
-    const Point *GetAnchor(SMuFLGlyphAnchor anchor);
+    const Point *GetAnchor(SMuFLGlyphAnchor anchor) const;
 
 private:
     //
@@ -101,6 +105,8 @@ private:
     std::string m_path;
     /** The Unicode code in hexa as string */
     std::string m_codeStr;
+    /** The XML (SVG symbol) when loaded from a font bundle */
+    std::string m_xml;
     /** A map of the available anchors */
     std::map<SMuFLGlyphAnchor, Point> m_anchors;
 };
@@ -84,6 +84,12 @@ public:
      */
     void ClearGraceAligners();
 
+    /**
+     * Clear the alignment for reusing it (see HorizontalAligner::Reset).
+     * The AlignmentReference children and the grace aligners are moved to the pools of the aligner.
+     */
+    void ClearForReuse(ArrayOfObjects *referencePool, std::vector<GraceAligner *> *graceAlignerPool);
+
     /**
      * Override the method of adding AlignmentReference children
      */
@@ -369,6 +375,21 @@ public:
 
     int GetAlignmentCount() const { return (int)m_children.size(); }
 
+    /**
+     * Return the alignment at the index.
+     * The children of the aligner are all Alignment objects (see HorizontalAligner::AddAlignment).
+     */
+    Alignment *GetAlignment(int idx) const;
+
+    /**
+     * @name Return an object to be added to one of the alignments of the aligner.
+     * It is taken from the ones of the previous layout when available (see HorizontalAligner::Reset).
+     */
+    ///@{
+    AlignmentReference *NewAlignmentReference(int staffN);
+    GraceAligner *NewGraceAligner();
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -376,7 +397,8 @@ public:
 protected:
     /**
      * Search if an alignment of the type is already there at the time.
-     * If not, return in idx the position where it needs to be inserted (-1 if it is the end)
+     * If not, return in idx the position where it needs to be inserted (-1 if it is the end).
+     * The alignments are kept sorted by time and then by type, which makes it a binary search.
      */
     Alignment *SearchAlignmentAtTime(double time, AlignmentType type, int &idx);
 
@@ -385,11 +407,32 @@ protected:
      */
     void AddAlignment(Alignment *alignment, int idx = -1);
 
+    /**
+     * Return an alignment to be added with AddAlignment.
+     * It is taken from the alignments of the previous layout when available.
+     */
+    Alignment *NewAlignment(double time, AlignmentType type);
+
+    /**
+     * Delete the objects kept for reuse.
+     * Called by Reset for the ones not reused by the previous layout, so the pools never exceed one layout.
+     */
+    void TrimPools();
+
 private:
     //
 public:
     //
 private:
+    /**
+     * @name The alignments of the previous layout and their content kept for reuse.
+     * Reset moves them to the pools instead of deleting them.
+     */
+    ///@{
+    ArrayOfObjects m_alignmentPool;
+    ArrayOfObjects m_referencePool;
+    std::vector<GraceAligner *> m_graceAlignerPool;
+    ///@}
 };
 
 //----------------------------------------------------------------------------
@@ -621,7 +664,8 @@ public:
 
     /**
      * Look for an existing TimestampAttr at a certain time.
-     * Creates it if not found
+     * Creates it if not found.
+     * The TimestampAttr are kept sorted by position, which makes it a binary search.
      */
     TimestampAttr *GetTimestampAtTime(double time);
 
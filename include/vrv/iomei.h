@@ -30,6 +30,7 @@ class App;
 class AreaPosInterface;
 class Arpeg;
 class Artic;
+class AttReader;
 class BarLine;
 class Beam;
 class BeatRpt;
@@ -186,6 +187,26 @@ public:
 private:
     bool WriteDoc(Doc *doc);
 
+    /**
+     * @name Methods for streaming the output
+     * The content of the root (<body>, or the page root with a single page) is written to the output as it is built.
+     * When an element is complete and its parent is the node of one of the containers of the score structure (see
+     * IsStreamedContainer), it is written and removed from the tree. The start tag of a container is written with its
+     * first complete child and its end tag when it is complete. The rest of the document is written around the root
+     * when it is started and ended. The depth of each node is the one of the root plus its depth in the streamed
+     * containers and is passed to pugi for the indentation.
+     */
+    ///@{
+    void StartStreaming(pugi::xml_node root);
+    void StreamNodeEnd(pugi::xml_node node);
+    void EndStreaming();
+    bool OpenStreamedNode(pugi::xml_node node);
+    void StreamChildren(pugi::xml_node node, int depth, pugi::xml_node until = pugi::xml_node());
+    void StreamStartTag(std::ostream &output, pugi::xml_node node, int depth);
+    void StreamEndTag(std::ostream &output, pugi::xml_node node, int depth);
+    bool IsStreamedContainer(Object *object) const;
+    ///@}
+
     /**
      * Write the @xml:id to the currentNode
      */
@@ -397,7 +418,26 @@ private:
     bool m_writeToStreamString;
     int m_page;
     bool m_scoreBasedMEI;
+    pugi::xml_document m_meiDoc;
     pugi::xml_node m_mei;
+    /** @name The output stream and the pugi format flags */
+    ///@{
+    std::ostream *m_output;
+    unsigned int m_outputFlags;
+    ///@}
+    /** @name The containers opened in the output, from the root, and the depth of the root */
+    ///@{
+    std::vector<pugi::xml_node> m_streamedNodes;
+    int m_streamRootDepth;
+    ///@}
+    /** The nodes of the containers being written (see IsStreamedContainer) */
+    std::vector<pugi::xml_node> m_containerNodes;
+    /** @name The document before and after the content of the root */
+    ///@{
+    std::string m_streamHead;
+    std::string m_streamTail;
+    bool m_streamHeadWritten;
+    ///@}
     /** @name Current element */
     pugi::xml_node m_currentNode;
     std::list<pugi::xml_node> m_nodeStack;
@@ -591,27 +631,28 @@ private:
 
     /**
      * @name Methods for reading MEI LayerElement, EidtorialElement and interfaces
+     * The attributes are read through the AttReader of the element built by the caller.
      */
     ///@{
-    bool ReadControlElement(pugi::xml_node element, ControlElement *object);
-    bool ReadEditorialElement(pugi::xml_node element, EditorialElement *object);
-    bool ReadLayerElement(pugi::xml_node element, LayerElement *object);
-    bool ReadRunningElement(pugi::xml_node element, RunningElement *object);
-    bool ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object);
-    bool ReadSystemElement(pugi::xml_node element, SystemElement *object);
-    bool ReadTextElement(pugi::xml_node element, TextElement *object);
-
-    bool ReadAreaPosInterface(pugi::xml_node element, AreaPosInterface *interface);
-    bool ReadDurationInterface(pugi::xml_node element, DurationInterface *interface);
-    bool ReadLinkingInterface(pugi::xml_node element, LinkingInterface *interface);
-    bool ReadFacsimileInterface(pugi::xml_node element, FacsimileInterface *interface);
-    bool ReadPitchInterface(pugi::xml_node element, PitchInterface *interface);
-    bool ReadPlistInterface(pugi::xml_node element, PlistInterface *interface);
-    bool ReadPositionInterface(pugi::xml_node element, PositionInterface *interface);
-    bool ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface);
-    bool ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface);
-    bool ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface);
-    bool ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface);
+    bool ReadControlElement(pugi::xml_node element, ControlElement *object, AttReader &reader);
+    bool ReadEditorialElement(pugi::xml_node element, EditorialElement *object, AttReader &reader);
+    bool ReadLayerElement(pugi::xml_node element, LayerElement *object, AttReader &reader);
+    bool ReadRunningElement(pugi::xml_node element, RunningElement *object, AttReader &reader);
+    bool ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object, AttReader &reader);
+    bool ReadSystemElement(pugi::xml_node element, SystemElement *object, AttReader &reader);
+    bool ReadTextElement(pugi::xml_node element, TextElement *object, AttReader &reader);
+
+    bool ReadAreaPosInterface(pugi::xml_node element, AreaPosInterface *interface, AttReader &reader);
+    bool ReadDurationInterface(pugi::xml_node element, DurationInterface *interface, AttReader &reader);
+    bool ReadLinkingInterface(pugi::xml_node element, LinkingInterface *interface, AttReader &reader);
+    bool ReadFacsimileInterface(pugi::xml_node element, FacsimileInterface *interface, AttReader &reader);
+    bool ReadPitchInterface(pugi::xml_node element, PitchInterface *interface, AttReader &reader);
+    bool ReadPlistInterface(pugi::xml_node element, PlistInterface *interface, AttReader &reader);
+    bool ReadPositionInterface(pugi::xml_node element, PositionInterface *interface, AttReader &reader);
+    bool ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface, AttReader &reader);
+    bool ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface, AttReader &reader);
+    bool ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface, AttReader &reader);
+    bool ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface, AttReader &reader);
     ///@}
 
     /**
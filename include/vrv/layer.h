@@ -203,6 +203,11 @@ public:
     virtual int CalcOnsetOffset(FunctorParams *functorParams);
     ///@}
 
+    /**
+     * See Object::GenerateMIDI
+     */
+    virtual int GenerateMIDI(FunctorParams *functorParams);
+
     /**
      * See Object::GenerateTimemap
      * To be added once Layer implements LinkingInterface
@@ -215,6 +220,12 @@ public:
      */
     // virtual int ResetDrawing(FunctorParams *);
 
+protected:
+    /**
+     * See Object::GetOwnedObjects
+     */
+    virtual void GetOwnedObjects(ArrayOfObjects *objects);
+
 private:
     //
 public:
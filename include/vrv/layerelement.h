@@ -43,7 +43,7 @@ public:
      */
     ///@{
     LayerElement();
-    LayerElement(std::string classid);
+    LayerElement(const char *classid);
     virtual ~LayerElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return LAYER_ELEMENT; }
@@ -205,6 +205,16 @@ public:
      */
     double GetRealTimeOffsetMilliseconds(int repeat) const;
 
+    /**
+     * Return the number of times the measure is played (i.e., the number of real time offsets)
+     */
+    int GetRealTimeRepeatCount() const { return (int)m_realTimeOffsetMilliseconds.size(); }
+
+    /**
+     * Return the real time duration of the measure in millisecond
+     */
+    int GetRealTimeDurationMilliseconds() const;
+
     //----------//
     // Functors //
     //----------//
@@ -426,6 +436,11 @@ protected:
      */
     int m_drawingXRel;
 
+    /**
+     * See Object::GetOwnedObjects
+     */
+    virtual void GetOwnedObjects(ArrayOfObjects *objects);
+
 private:
     bool m_measuredMusic;
 
@@ -46,6 +46,12 @@ public:
      */
     Text *GetCurrentText() { return &m_currentText; }
 
+protected:
+    /**
+     * See Object::GetOwnedObjects
+     */
+    virtual void GetOwnedObjects(ArrayOfObjects *objects);
+
 private:
     //
 public:
@@ -8,6 +8,8 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <atomic>
+#include <bitset>
 #include <cstdlib>
 #include <ctime>
 #include <iterator>
@@ -22,6 +24,7 @@
 
 namespace vrv {
 
+struct ClassIdIndex;
 class Doc;
 class DurationInterface;
 class EditorialElement;
@@ -58,7 +61,8 @@ public:
      */
     ///@{
     Object();
-    Object(std::string classid);
+    Object(const char *classid);
+    Object(const char *classid, bool generateUuid);
     virtual ~Object();
     virtual ClassId GetClassId() const;
     virtual std::string GetClassName() const { return "[MISSING]"; }
@@ -120,16 +124,10 @@ public:
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
-    bool HasAttClass(AttClassId attClassId) const
-    {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
-    }
+    void RegisterAttClass(AttClassId attClassId) { m_attClasses.set(attClassId); }
+    bool HasAttClass(AttClassId attClassId) const { return m_attClasses.test(attClassId); }
     void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
-    bool HasInterface(InterfaceId interfaceId) const
-    {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
-    }
+    bool HasInterface(InterfaceId interfaceId) const { return m_interfaces.test(interfaceId); }
     ///@}
 
     virtual DurationInterface *GetDurationInterface() { return NULL; }
@@ -174,6 +172,12 @@ public:
      */
     void MoveChildrenFrom(Object *sourceParent, int idx = -1, bool allowTypeChange = false);
 
+    /**
+     * Move the children from startIdx to endIdx (excluded) of the object passed as parameter to the end of this one.
+     * The uuid index is not updated when both objects are in the same document, since the objects stay in it.
+     */
+    void MoveChildRangeFrom(Object *sourceParent, int startIdx, int endIdx);
+
     /**
      * Replace the currentChild with the replacingChild.
      * The currentChild is not deleted by the methods.
@@ -221,11 +225,33 @@ public:
      */
     virtual void CloneReset();
 
-    std::string GetUuid() const { return m_uuid; }
+    /**
+     * @name Getter and setters for the uuid.
+     * When the object belongs to a Doc, the uuid index of the Doc is updated accordingly.
+     * The string of a generated uuid is built by the first call to GetUuid and then kept.
+     * HasUuid and GetUuidHash do not build it, so that the uuid index does not.
+     */
+    ///@{
+    const std::string &GetUuid() const;
+    bool HasUuid(const std::string &uuid) const;
+    unsigned int GetUuidHash() const;
+    static unsigned int HashUuid(const std::string &uuid);
     void SetUuid(std::string uuid);
     void SwapUuid(Object *other);
     void ResetUuid();
+    ///@}
+
+    /**
+     * @name Static methods for the uuid generator of the current thread.
+     * The generator is the one of the Doc being processed in the thread, as set by the Toolkit.
+     * When none is set, a generator owned by the thread is used.
+     * Seeding with 0 uses a random seed.
+     */
+    ///@{
     static void SeedUuid(unsigned int seed = 0);
+    static void SetUuidGenerator(UuidGenerator *generator);
+    static UuidGenerator *GetUuidGenerator();
+    ///@}
 
     std::string GetComment() const { return m_comment; }
     void SetComment(std::string comment) { m_comment = comment; }
@@ -305,7 +331,7 @@ public:
      * Reset the parent of the Object.
      * The current parent is not expected to be NULL.
      */
-    void ResetParent() { m_parent = NULL; }
+    void ResetParent();
 
     /**
      * Base method for adding children.
@@ -364,7 +390,8 @@ public:
 
     /**
      * Look for a descendant with the specified uuid (returns NULL if not found)
-     * This method is a wrapper for the Object::FindByUuid functor.
+     * When the object belongs to a Doc, the uuid index of the Doc is used.
+     * Otherwise, or when the deepness is limited, this is a wrapper for the Object::FindByUuid functor.
      */
     Object *FindDescendantByUuid(std::string uuid, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
@@ -1122,17 +1149,97 @@ public:
     static bool sortByUlx(Object *a, Object *b);
 
 protected:
-    //
+    /**
+     * Mark the object as the root of a tree maintaining a uuid index.
+     * This is set by Doc only.
+     */
+    void SetAsUuidIndexRoot(bool isUuidIndexRoot) { m_isUuidIndexRoot = isUuidIndexRoot; }
+
+    /**
+     * Keep the object and its descendants out of the uuid index of the Doc.
+     * This is set by the aligners, which have a parent but are not processed as one of its children.
+     */
+    void SetAsOutsideUuidIndex() { m_isOutsideUuidIndex = true; }
+
+    /**
+     * @name Register and unregister an object owned by the object but not one of its children.
+     * This is the case, for example, of the staffDef clef of a Layer. Owned objects are not processed by the
+     * functors but are kept in the uuid index of the Doc. They have to be returned by GetOwnedObjects.
+     * An owned object is unregistered before being deleted.
+     */
+    ///@{
+    void RegisterOwnedObject(Object *object);
+    void UnregisterOwnedObject(Object *object);
+    ///@}
+
+    /**
+     * Add the objects registered with RegisterOwnedObject to the array.
+     */
+    virtual void GetOwnedObjects(ArrayOfObjects *objects) {}
+
+    /**
+     * Return the Doc maintaining the uuid index of the tree the object belongs to (NULL if none).
+     * Only parent pointers are followed and no virtual method is called, so it can be used in destructors.
+     */
+    Doc *GetUuidIndexDoc() const;
+
 private:
     /**
      * Method for generating the uuid.
      */
     void GenerateUuid();
 
+    /**
+     * Write the 16 characters of the number of a generated uuid (as "%016d" without the null terminator).
+     */
+    void WriteUuidNr(char *str) const;
+
+    /**
+     * @name Add or remove the object and its descendants to / from the uuid index of the Doc.
+     * Children of reference objects and relinquished children are skipped. Owned objects are included.
+     */
+    ///@{
+    void AddSubtreeToUuidIndex(Doc *doc);
+    void RemoveSubtreeFromUuidIndex(Doc *doc);
+    ///@}
+
+    /**
+     * Add the object and the descendants processed with a functor (with visible only) to the ClassId index.
+     */
+    void AddSubtreeToClassIdIndex(ClassIdIndex *index);
+
+    /**
+     * Process the functor only on the objects of the classes it handles, using the ClassId index of the Doc.
+     * The index is built if the tree has changed since it was last built. Return false if there is no Doc.
+     */
+    bool ProcessClassIds(Functor *functor, FunctorParams *functorParams);
+
+    /**
+     * The recursive part of Process.
+     * The filters are indexed by ClassId (NULL for the classes without one) so that each child is matched
+     * with a single lookup. NULL means no filter.
+     */
+    void ProcessWithFilters(Functor *functor, FunctorParams *functorParams, Functor *endFunctor,
+        ArrayOfClassIdComparisons *classIdFilters, int deepness, bool direction);
+
+    /**
+     * Return true if the object is processed by a functor (with visible only) called from the ancestor.
+     * This is the case if it is a child of each object up to the ancestor and none of them is hidden.
+     * Only parent pointers are followed, so the cost depends on the depth of the object only.
+     */
+    bool IsProcessedFrom(Object *ancestor);
+
+    /**
+     * Return true if the children of the object are skipped when processing visible objects only.
+     */
+    bool IsHidden();
+
     /**
      * Initialisation method taking a uuid prefix argument.
+     * The prefix is expected to be a string literal since only the pointer is kept.
+     * No uuid is generated for the layout objects (e.g., the aligners) so they do not change the ones of the content.
      */
-    void Init(std::string);
+    void Init(const char *classid, bool generateUuid = true);
 
 public:
     /**
@@ -1155,11 +1262,17 @@ private:
     Object *m_parent;
 
     /**
-     * Members for storing / generating uuids
+     * Members for storing / generating uuids.
+     * A generated uuid is stored as its number and the prefix of the class. Its string is built by GetUuid the first
+     * time it is requested, possibly from concurrent layout workers, hence the atomic flag.
+     * The string is also used for the uuids set with SetUuid (e.g., when loading a file).
      */
     ///@{
-    std::string m_uuid;
-    std::string m_classid;
+    mutable std::string m_uuid;
+    const char *m_classid;
+    int m_uuidNr;
+    bool m_hasGeneratedUuid;
+    mutable std::atomic<bool> m_hasUuidString;
     ///@}
 
     /**
@@ -1168,13 +1281,32 @@ private:
      */
     bool m_isReferenceObject;
 
+    /**
+     * A flag indicating that the object is a Doc maintaining a uuid index.
+     * See Object::GetUuidIndexDoc
+     */
+    bool m_isUuidIndexRoot;
+
+    /**
+     * A flag indicating that the object and its descendants are not in the uuid index.
+     * See Object::SetAsOutsideUuidIndex
+     */
+    bool m_isOutsideUuidIndex;
+
+    /**
+     * A flag indicating that the object is owned by its parent but is not one of its children.
+     * See Object::RegisterOwnedObject
+     */
+    bool m_isOwnedObject;
+
     /**
      * Indicates whether the object content is up-to-date or not.
      * This is useful for object using sub-lists of objects when drawing.
      * For example, Beam has a list of children notes and this value indicates if the
      * list needs to be updated or not. Is is mostly an optimization feature.
+     * Atomic because the layout of the pages in concurrent threads propagates it to the shared doc.
      */
-    mutable bool m_isModified;
+    mutable std::atomic<bool> m_isModified;
 
     /**
      * Members used for caching iterator values.
@@ -1187,14 +1319,14 @@ private:
     ///@}
 
     /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
+     * The set of AttClassId (MEI att classes) implemented.
      */
-    std::vector<AttClassId> m_attClasses;
+    std::bitset<ATT_CLASS_max> m_attClasses;
 
     /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
+     * The set of InterfaceId (group of MEI att classes) implemented.
      */
-    std::vector<InterfaceId> m_interfaces;
+    std::bitset<INTERFACE_max> m_interfaces;
 
     /**
      * A string for storing a comment to be printed immediately before
@@ -1212,11 +1344,26 @@ private:
      * A flag indicating if the Object is a copy created by an expanded expansion element.
      */
     bool m_isExpansion;
+};
 
-    /**
-     * A static counter for uuid generation.
-     */
-    static unsigned long s_objectCounter;
+//----------------------------------------------------------------------------
+// ObjectUuidGenerator
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets a uuid generator seeded from the uuid of an object for the current thread during its lifetime.
+ * It is used for the objects created from an existing one during the layout (e.g., the drawing copies of the
+ * scoreDef), so that their uuids do not depend on the thread or on the order in which the pages are laid out.
+ * The salt distinguishes the sets of objects created from the same object.
+ */
+class ObjectUuidGenerator {
+public:
+    ObjectUuidGenerator(const Object *object, unsigned int salt = 0);
+    virtual ~ObjectUuidGenerator();
+
+private:
+    UuidGenerator m_generator;
+    UuidGenerator *m_previousGenerator;
 };
 
 //----------------------------------------------------------------------------
@@ -1362,6 +1509,15 @@ public:
      * The value is true by default.
      */
     bool m_visibleOnly;
+    /**
+     * The classes of the objects the functor has to be called on.
+     * When set, Object::Process calls the functor only on these objects, in processing order, using the index
+     * of the document (see Doc::GetClassIdIndex). It must include all the classes overriding the functor method,
+     * including the ones setting the state in the FunctorParams. It is ignored with an end functor, filters, a
+     * limited deepness, a backward processing or when processing hidden objects.
+     * The list is empty by default.
+     */
+    std::vector<ClassId> m_classIds;
 
 private:
 };
@@ -468,6 +468,7 @@ public:
     OptionBool m_condenseTempoPages;
     OptionBool m_evenNoteSpacing;
     OptionBool m_humType;
+    OptionBool m_humMeiRoundTrip;
     OptionBool m_justifyIncludeLastPage;
     OptionBool m_justifySystemsOnly;
     OptionBool m_justifyVertically;
@@ -487,9 +488,12 @@ public:
     OptionInt m_pageMarginRight;
     OptionInt m_pageMarginTop;
     OptionInt m_pageWidth;
+    OptionBool m_progressiveCastOff;
+    OptionInt m_castOffThreads;
     OptionString m_expand;
     OptionBool m_svgBoundingBoxes;
     OptionBool m_svgViewBox;
+    OptionBool m_svgFormatRaw;
     OptionInt m_unit;
     OptionBool m_useFacsimile;
     OptionBool m_usePgFooterForAll;
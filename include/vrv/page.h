@@ -94,11 +94,43 @@ public:
      */
     void LayOutTranscription(bool force = false);
 
+    /**
+     * Do the horizontal part of the layout (LayOutHorizontally and JustifyHorizontally) ahead of LayOut.
+     * LayOut will then only do the vertical part (again) unless force is true.
+     */
+    void LayOutHorizontallyAhead();
+
+    /**
+     * Do the layout of the page ahead of LayOut, without the running elements since they are shared by the pages.
+     * Their heights have to be set before with LayOutRunningElements. LayOut will then only lay out the running
+     * elements again unless force is true. The vertical part is not done for the last page, since its
+     * justification can depend on the previous page.
+     * This is what Doc::LayOutPagesAhead runs concurrently for several pages.
+     */
+    void LayOutAhead();
+
+    /**
+     * Lay out the running elements (header and footer) of the page and keep their heights.
+     * This is the part of LayOutVertically for the running elements, which is the same for all the pages but for
+     * the page number.
+     */
+    void LayOutRunningElements();
+
     /**
      * Lay out the content of the page (measures and their content) horizontally
      */
     void LayOutHorizontally();
 
+    /**
+     * @name The two parts of LayOutHorizontally.
+     * The content of the measures is first aligned, each measure on its own. This is what Doc::CastOffDoc runs
+     * concurrently for sets of measures. The measures are then adjusted across each other and aligned.
+     */
+    ///@{
+    void AlignMeasureContentHorizontally();
+    void AdjustMeasuresHorizontally();
+    ///@}
+
     /**
      * Justifiy the content of the page (measures and their content) horizontally
      */
@@ -153,6 +185,11 @@ public:
      */
     virtual int ResetVerticalAlignment(FunctorParams *functorParams);
 
+    /**
+     * See Object::ResetDrawing
+     */
+    virtual int ResetDrawing(FunctorParams *functorParams);
+
     /**
      * See Object::AlignVertically
      */
@@ -223,6 +260,15 @@ public:
      */
     int m_drawingJustifiableSystems;
 
+    /**
+     * @name The heights of the header and of the footer set by LayOutRunningElements.
+     * They are used instead of the running elements when the page is laid out by LayOutAhead.
+     */
+    ///@{
+    int m_drawingHeaderHeight;
+    int m_drawingFooterHeight;
+    ///@}
+
 private:
     /**
      * A flag for indicating whether the layout has been done or not.
@@ -230,6 +276,17 @@ private:
      * the force parameter is set.
      */
     bool m_layoutDone;
+
+    /**
+     * A flag for indicating whether the horizontal layout has been done ahead of the layout.
+     */
+    bool m_horizontalLayoutDone;
+
+    /**
+     * A flag for indicating that the page is laid out without its running elements.
+     * GetHeader and GetFooter return NULL in that case. See Page::LayOutAhead
+     */
+    bool m_withoutRunningElements;
 };
 
 } // namespace vrv
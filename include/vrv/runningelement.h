@@ -33,7 +33,7 @@ public:
      */
     ///@{
     RunningElement();
-    RunningElement(std::string classid);
+    RunningElement(const char *classid);
     virtual ~RunningElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return RUNNING_ELEMENT; }
@@ -117,9 +117,9 @@ public:
     void SetCurrentPageNum(Page *currentPage);
 
     /**
-     * Load the footer from the resources (footer.svg)
+     * Load the footer from the resources (footer.svg) of the document
      */
-    void LoadFooter();
+    void LoadFooter(const Doc *doc);
 
     /**
      * Add page numbering to the running element.
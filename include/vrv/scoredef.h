@@ -45,7 +45,7 @@ public:
      * @name Constructors, destructors, and other standard methods.
      */
     ///@{
-    ScoreDefElement(std::string classid);
+    ScoreDefElement(const char *classid);
     virtual ~ScoreDefElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return SCOREDEF_ELEMENT; }
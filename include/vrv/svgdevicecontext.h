@@ -11,8 +11,11 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -68,6 +71,12 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * Write the SVG directly to an output stream (e.g., a file).
+     * Add the xml tag if necessary.
+     */
+    void WriteSVG(std::ostream &output, bool xml_declaration = false);
+
     /**
      * @name Drawing methods
      */
@@ -182,6 +191,11 @@ public:
      */
     void SetSvgViewBox(bool svgViewBox) { m_svgViewBox = svgViewBox; }
 
+    /**
+     * Setting m_formatRaw flag (false by default)
+     */
+    void SetFormatRaw(bool formatRaw) { m_formatRaw = formatRaw; }
+
 private:
     /**
      * Copy the content of a file to the output stream.
@@ -205,10 +219,30 @@ private:
     void VrvTextFont() { m_vrvTextFont = true; }
 
     /**
-     * Flush the data to the internal buffer.
-     * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs
+     * Write the SVG to the writer.
+     * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs before the content of the page.
+     * The document itself is not modified and can be written more than once.
+     */
+    void Commit(pugi::xml_writer &writer, bool xml_declaration);
+
+    /**
+     * @name Methods for streaming the page to m_body.
+     * The start and end tags are written only for the <svg> root and the page wrappers, whose attribute values are
+     * set by the device context and need no escaping. Complete nodes are written by pugixml.
      */
-    void Commit(bool xml_declaration);
+    ///@{
+    std::string GetAttributes(pugi::xml_node node);
+    void WriteStartTag(pugi::xml_node node, int depth);
+    void WriteEndTag(pugi::xml_node node, int depth);
+    void WriteNode(pugi::xml_node node, int depth);
+    ///@}
+
+    /**
+     * Write the children of the page node to m_body and remove them from the document.
+     * This is done when a graphic is ended in the page node, so only one system is kept in the document at a time.
+     * It is not done when drawing the bounding boxes since they can be redrawn when resuming a graphic.
+     */
+    void FlushPageNode();
 
     void WriteLine(std::string);
 
@@ -216,6 +250,12 @@ private:
 
     pugi::xml_node AppendChild(std::string name);
 
+    /**
+     * Return the parsed SVG symbol of the glyph for the <defs>.
+     * Symbols are parsed once and cached for all instances.
+     */
+    static const pugi::xml_document &GetGlyphDef(const Glyph *glyph);
+
 public:
     //
 private:
@@ -226,18 +266,20 @@ private:
      */
     bool m_vrvTextFont;
 
-    // we use a std::stringstream because we want to prepend the <defs> which will know only when we reach the end of
-    // the page
+    // the <defs> are known only when we reach the end of the page
     // some viewer seem to support to have the <defs> at the end, but some do not (pdf2svg, for example)
-    // for this reason, the full svg is finally written a string from the destructor or when Flush() is called
-    std::ostringstream m_outdata;
-
-    bool m_committed; // did we flushed the file?
+    // for this reason, they are written before the content of the page when the svg is committed
     int m_originX, m_originY;
 
-    // holds the list of glyphs from the smufl font used so far
+    // holds the list of glyphs from the smufl font used so far (in order of use and as a set for lookups)
     // they will be added at the end of the file as <defs>
-    std::vector<std::string> m_smuflGlyphs;
+    std::vector<const Glyph *> m_smuflGlyphs;
+    std::unordered_set<const Glyph *> m_smuflGlyphSet;
+
+    // the parsed glyph symbols shared by all instances (see GetGlyphDef)
+    // keyed by glyph path since the same SMuFL code has a different symbol in each font
+    static std::map<std::string, pugi::xml_document> s_glyphDefs;
+    static std::mutex s_glyphDefsMutex;
 
     // pugixml data
     pugi::xml_document m_svgDoc;
@@ -245,14 +287,20 @@ private:
     pugi::xml_node m_pageNode;
     pugi::xml_node m_currentNode;
     std::list<pugi::xml_node> m_svgNodeStack;
+    // the content of the page already written, in front of which Commit adds the header and the <defs>
+    std::string m_body;
 
     // output as mm (for pdf generation with a 72 dpi)
     bool m_mmOutput;
     bool m_facsimile;
     // add bouding boxes in svg output
     bool m_svgBoundingBoxes;
+    // the bounding box graphics of the current page, redrawn when the graphic of the object is resumed
+    std::map<Object *, pugi::xml_node> m_svgBoundingBoxNodes;
     // use viewbox on svg root element
     bool m_svgViewBox;
+    // output without indentation and newlines
+    bool m_formatRaw;
 };
 
 } // namespace vrv
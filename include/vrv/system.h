@@ -293,6 +293,11 @@ protected:
      */
     int m_drawingYRel;
 
+    /**
+     * See Object::GetOwnedObjects
+     */
+    virtual void GetOwnedObjects(ArrayOfObjects *objects);
+
 private:
     /**
      * The drawing scoreDef at the beginning of the system.
@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        teedevicecontext.h
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_TEE_DC_H__
+#define __VRV_TEE_DC_H__
+
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "devicecontext.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// TeeDeviceContext
+//----------------------------------------------------------------------------
+
+/**
+ * This class forwards every call to several device contexts.
+ * It makes it possible to fill several device contexts with a single traversal of the View, for example a
+ * BBoxDeviceContext and a SvgDeviceContext when the bounding boxes are output in the SVG.
+ * The calls are forwarded in the order the device contexts were added.
+ * Getters return the values of the first device context, which is the one expected to produce the output.
+ * The device contexts are not owned by the TeeDeviceContext.
+ */
+class TeeDeviceContext : public DeviceContext {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    TeeDeviceContext();
+    virtual ~TeeDeviceContext();
+    virtual ClassId GetClassId() const { return TEE_DEVICE_CONTEXT; }
+    ///@}
+
+    /**
+     * Add a device context to which the calls are forwarded.
+     */
+    void AddDeviceContext(DeviceContext *deviceContext);
+
+    /**
+     * @name Setters for the attributes and the stacks managed in the DeviceContext
+     */
+    ///@{
+    virtual void SetWidth(int width);
+    virtual void SetHeight(int height);
+    virtual void SetUserScale(double scaleX, double scaleY);
+    virtual void SetResources(const Resources *resources);
+    virtual void SetBrush(int colour, int opacity);
+    virtual void SetPen(int colour, int width, int opacity, int dashLength = 0, int lineCap = 0);
+    virtual void SetFont(FontInfo *font);
+    virtual void ResetBrush();
+    virtual void ResetPen();
+    virtual void ResetFont();
+    ///@}
+
+    /**
+     * @name Setters
+     */
+    ///@{
+    virtual void SetBackground(int colour, int style = AxSOLID);
+    virtual void SetBackgroundImage(void *image, double opacity = 1.0);
+    virtual void SetBackgroundMode(int mode);
+    virtual void SetTextForeground(int colour);
+    virtual void SetTextBackground(int colour);
+    virtual void SetLogicalOrigin(int x, int y);
+    ///@}
+
+    /**
+     * @name Getters
+     */
+    ///@{
+    virtual Point GetLogicalOrigin();
+    ///@}
+
+    /**
+     * @name Drawing methods
+     */
+    ///@{
+    virtual void DrawSimpleBezierPath(Point bezier[4]);
+    virtual void DrawComplexBezierPath(Point bezier1[4], Point bezier2[4]);
+    virtual void DrawCircle(int x, int y, int radius);
+    virtual void DrawEllipse(int x, int y, int width, int height);
+    virtual void DrawEllipticArc(int x, int y, int width, int height, double start, double end);
+    virtual void DrawLine(int x1, int y1, int x2, int y2);
+    virtual void DrawPolygon(int n, Point points[], int xOffset, int yOffset, int fillStyle = AxODDEVEN_RULE);
+    virtual void DrawRectangle(int x, int y, int width, int height);
+    virtual void DrawRotatedText(const std::string &text, int x, int y, double angle);
+    virtual void DrawRoundedRectangle(int x, int y, int width, int height, double radius);
+    virtual void DrawText(
+        const std::string &text, const std::wstring wtext = L"", int x = VRV_UNSET, int y = VRV_UNSET);
+    virtual void DrawMusicText(const std::wstring &text, int x, int y, bool setSmuflGlyph = false);
+    virtual void DrawSpline(int n, Point points[]);
+    virtual void DrawSvgShape(int x, int y, int width, int height, pugi::xml_node svg);
+    virtual void DrawBackgroundImage(int x = 0, int y = 0);
+    ///@}
+
+    /**
+     * Special method for forcing bounding boxes to be updated
+     */
+    virtual void DrawPlaceholder(int x, int y);
+
+    /**
+     * @name Method for starting and ending a text
+     */
+    ///@{
+    virtual void StartText(int x, int y, data_HORIZONTALALIGNMENT alignment = HORIZONTALALIGNMENT_left);
+    virtual void EndText();
+    ///@}
+
+    /**
+     * @name Move a text to the specified position, for example when starting a new line.
+     */
+    ///@{
+    virtual void MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignment);
+    virtual void MoveTextVerticallyTo(int y);
+    ///@}
+
+    /**
+     * @name Temporarily deactivate a graphic
+     */
+    ///@{
+    virtual void DeactivateGraphic();
+    virtual void DeactivateGraphicX();
+    virtual void DeactivateGraphicY();
+    virtual void ReactivateGraphic();
+    ///@}
+
+    /**
+     * @name Method for starting and ending a graphic
+     */
+    ///@{
+    virtual void StartGraphic(Object *object, std::string gClass, std::string gId, bool prepend = false);
+    virtual void EndGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a graphic custom graphic that do not correspond to an Object
+     */
+    ///@{
+    virtual void StartCustomGraphic(std::string name, std::string gClass = "", std::string gId = "");
+    virtual void EndCustomGraphic();
+    ///@}
+
+    /**
+     * @name Methods for re-starting and ending a graphic for objects drawn in separate steps
+     */
+    ///@{
+    virtual void ResumeGraphic(Object *object, std::string gId);
+    virtual void EndResumedGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a text graphic
+     */
+    ///@{
+    virtual void StartTextGraphic(Object *object, std::string gClass, std::string gId);
+    virtual void EndTextGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for rotating a graphic (clockwise).
+     */
+    ///@{
+    virtual void RotateGraphic(Point const &orig, double angle);
+    ///@}
+
+    /**
+     * @name Method for starting and ending page
+     */
+    ///@{
+    virtual void StartPage();
+    virtual void EndPage();
+    ///@}
+
+    /**
+     * @name Method for adding description element
+     */
+    ///@{
+    virtual void AddDescription(const std::string &text);
+    ///@}
+
+    /**
+     * Global styling is used if the first device context uses it
+     */
+    virtual bool UseGlobalStyling();
+
+private:
+    /**
+     * The device contexts to which the calls are forwarded (not owned)
+     */
+    std::vector<DeviceContext *> m_deviceContexts;
+};
+
+} // namespace vrv
+
+#endif // __VRV_TEE_DC_H__
@@ -8,6 +8,7 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <functional>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -20,6 +21,8 @@
 namespace vrv {
 
 class EditorToolkit;
+class FileInputStream;
+class SvgDeviceContext;
 
 enum FileFormat {
     UNKNOWN = 0,
@@ -48,7 +51,7 @@ public:
      * @name Constructors and destructors
      */
     ///@{
-    /** If initFont is set to false, Resources::InitFonts will have to be called explicitely */
+    /** If initFont is set to false, SetResourcePath will have to be called explicitely */
     Toolkit(bool initFont = true);
     virtual ~Toolkit();
     ///@}
@@ -65,6 +68,12 @@ public:
      */
     bool SetResourcePath(const std::string &path);
 
+    /**
+     * Select the music font.
+     * The font is loaded from the resource path unless another toolkit already did it.
+     */
+    bool SetFont(const std::string &fontName);
+
     /**
      * Load a file with the specified type.
      */
@@ -106,9 +115,9 @@ public:
     std::string EditInfo();
 
     /**
-     * Concatenates the vrv::logBuffer into a string an returns it.
+     * Concatenates the log buffer of the toolkit into a string an returns it.
      * This is used only for Emscripten-based compilation.
-     * The vrv::logBuffer is filled by the vrv::LogXXX functions.
+     * The log buffer is filled by the vrv::LogXXX functions.
      */
     std::string GetLog();
 
@@ -119,7 +128,7 @@ public:
     std::string GetVersion();
 
     /**
-     * Resets the vrv::logBuffer.
+     * Resets the log buffer of the toolkit.
      * This is used only for Emscripten-based compilation.
      */
     void ResetLogBuffer();
@@ -142,6 +151,20 @@ public:
      */
     bool RenderToSVGFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render the pages fromPage to toPage (1-based, 0 for the last page) in SVG in a single pass.
+     * Each page is handed to the callback as soon as it is rendered, so the pages are never all held in memory.
+     * The rendering stops if the callback returns false.
+     * With threadCount other than 1, the pages of the range are first laid out concurrently (see LayOutAllPages)
+     * and each page is serialized and handed to the callback on a separate thread while the next one is drawn.
+     * The callback is called for one page at a time and in the page order.
+     * With a progressive cast off, the pages are cast off as they are rendered, or up to toPage before the concurrent
+     * layout with threadCount other than 1.
+     * Returns false if the page range is not valid or if the rendering was stopped by the callback.
+     */
+    bool RenderAllToSVG(const std::function<bool(int pageNo, const std::string &svg)> &callback, int fromPage = 1,
+        int toPage = 0, int threadCount = 1, bool xml_declaration = false);
+
     /**
      * Creates a midi file, opens it, and writes to it.
      * currently generates a dummy midi file.
@@ -199,6 +222,13 @@ public:
      */
     void RedoLayout();
 
+    /**
+     * Redo the layout of the pages modified by the editor since the last layout.
+     * The document is cast off again (as with RedoLayout()) only if the width of a modified system changed
+     * or if a modified page overflows.
+     */
+    void RedoModifiedLayout();
+
     /**
      * Redo the layout of the pitch postitions of the current drawing page.
      * Only the note vertical positions are recalculated with this method.
@@ -206,6 +236,14 @@ public:
      */
     void RedoPagePitchPosLayout();
 
+    /**
+     * Lay out the pages ahead of rendering them all.
+     * This is done concurrently with threadCount threads (by default the number of hardware threads).
+     * Only the running elements (and the vertical layout of the last page) are laid out when rendering.
+     * With a progressive cast off, all the pending pages are cast off first.
+     */
+    void LayOutAllPages(int threadCount = 0);
+
     /**
      * Return the page on which the element is the ID (xml:id) is rendered.
      * This takes into account the current layout options.
@@ -270,9 +308,14 @@ public:
 
     /**
      * @name Get the pages for a loaded file
+     * With a progressive cast off, GetPageCount casts off all the pending pages to return the exact count.
+     * GetCastOffPageCount returns the count of the pages cast off so far, with the systems not cast off yet counted
+     * as one page, so it is a lower bound of the page count as long as HasPendingPages returns true.
      */
     ///@{
     int GetPageCount();
+    int GetCastOffPageCount();
+    bool HasPendingPages();
     ///@}
 
     /**
@@ -289,6 +332,26 @@ private:
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
 
+    /**
+     * Make the log buffer, the uuid generator and the arena of the toolkit the ones used in the current thread.
+     * This is called by the methods processing the document, so toolkits can be used concurrently
+     * in different threads (one toolkit per thread).
+     */
+    void BindToCurrentThread();
+
+    /**
+     * Set the Humdrum converted from another format as Humdrum buffer and return the input for loading it.
+     * With the MEI round trip, the Humdrum is imported into a temporary document and newData is set to its MEI.
+     * Return NULL if the Humdrum cannot be imported.
+     */
+    FileInputStream *GetConvertedHumdrumInput(const std::string &humdrum, bool humMeiRoundTrip, std::string &newData);
+
+    /**
+     * Set the SVG options on the deviceContext and render the page to it.
+     * Page number is 1-based.
+     */
+    void RenderToSvgDeviceContext(int pageNo, SvgDeviceContext *svg);
+
 public:
     //
 private:
@@ -299,7 +362,7 @@ private:
     FileFormat m_outputTo;
     bool m_scoreBasedMei;
 
-    static char *m_humdrumBuffer;
+    char *m_humdrumBuffer;
 
     Options *m_options;
 
@@ -308,6 +371,11 @@ private:
      */
     char *m_cString;
 
+    /**
+     * The log buffer (used only for Emscripten-based compilation)
+     */
+    std::vector<std::string> m_logBuffer;
+
     EditorToolkit *m_editorToolkit;
 };
 
@@ -44,6 +44,13 @@ public:
      */
     virtual void Reset();
 
+    /**
+     * Move the StaffAlignment objects of another aligner to the ones kept for reuse by this one.
+     * The other aligner is reset and 1 / shareCount of its pooled objects is moved.
+     * This is used for reusing them in the new systems when the document is cast off again.
+     */
+    void ReuseAlignmentsFrom(SystemAligner *aligner, int shareCount = 1);
+
     /**
      * Get bottom StaffAlignment for the system.
      * For each SystemAligner, we keep a StaffAlignment for the bottom position.
@@ -65,6 +72,12 @@ public:
      */
     StaffAlignment *GetStaffAlignmentForStaffN(int staffN) const;
 
+    /**
+     * Move the floating positioners of another aligner to the StaffAlignment of the same staff in this one.
+     * This is used when the content of a system has been laid out in several other systems (see Doc::CastOffDoc).
+     */
+    void MovePositionersFrom(SystemAligner *aligner);
+
     /**
      * Find all the positioners pointing to an object;
      */
@@ -85,6 +98,17 @@ private:
      * A pointer to the left StaffAlignment object kept for the system bottom position
      */
     StaffAlignment *m_bottomAlignment;
+
+    /**
+     * The StaffAlignment objects of the previous layout kept for reuse.
+     * Reset moves the alignments to it instead of deleting them.
+     */
+    ArrayOfObjects m_staffAlignmentPool;
+
+    /**
+     * The number of alignments passed by ReuseAlignmentsFrom since the last Reset, which are not trimmed by it.
+     */
+    int m_reusedCount;
 };
 
 //----------------------------------------------------------------------------
@@ -103,6 +127,7 @@ public:
     ///@{
     StaffAlignment();
     virtual ~StaffAlignment();
+    virtual void Reset();
     virtual ClassId GetClassId() const { return STAFF_ALIGNMENT; }
     ///@}
 
@@ -126,6 +151,11 @@ public:
      */
     void SetCurrentFloatingPositioner(FloatingObject *object, Object *objectX, Object *objectY, char spanningType);
 
+    /**
+     * Move the FloatingPositioner objects of another alignment to the end of the ones of this one.
+     */
+    void MovePositionersFrom(StaffAlignment *alignment);
+
     /**
      * Look for the first FloatingPositioner corresponding to the FloatingObject of the ClassId.
      * Return NULL if not found and does not create anything.
@@ -245,6 +275,14 @@ private:
      * The list of FloatingPositioner for the staff.
      */
     ArrayOfFloatingPositioners m_floatingPositioners;
+    /**
+     * @name The FloatingPositioner and FloatingCurvePositioner objects kept aside when the alignment is reset.
+     * They are reused by SetCurrentFloatingPositioner and owned by the alignment. Reset deletes the ones not reused.
+     */
+    ///@{
+    ArrayOfFloatingPositioners m_positionerPool;
+    ArrayOfFloatingPositioners m_curvePositionerPool;
+    ///@}
     /**
      * Stores a pointer to the staff from which the aligner was created.
      * This is necessary since we don't always have all the staves.
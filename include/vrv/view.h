@@ -159,6 +159,13 @@ public:
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * Draw only the running elements (header and footer) of the current page.
+     * This is used for laying them out separately from the page (see Page::LayOutRunningElements).
+     * Defined in view_running.cpp
+     */
+    void DrawCurrentPageRunningElements(DeviceContext *dc);
+
     /**
      * Return the pixel per unit factor of the current page (if any, 1.0 otherwise)
      */
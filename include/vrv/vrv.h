@@ -10,6 +10,8 @@
 
 #include <cstring>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
@@ -37,12 +39,18 @@ void LogMessage(const char *fmt, ...);
 void LogWarning(const char *fmt, ...);
 void DisableLog();
 
+/**
+ * Set the buffer used by the current thread for emscripten logging (see AppendLogBuffer).
+ * Each Toolkit owns a buffer and sets it when it is used, so toolkits in different threads do not share it.
+ */
+void SetLogBuffer(std::vector<std::string> *buffer);
+std::vector<std::string> *GetLogBuffer();
+
 /**
  * Member and functions specific to emscripten loging that uses a vector of string to buffer the logs.
  */
 #ifdef __EMSCRIPTEN__
 enum consoleLogLevel { CONSOLE_LOG = 0, CONSOLE_INFO, CONSOLE_WARN, CONSOLE_ERROR };
-extern std::vector<std::string> logBuffer;
 bool LogBufferContains(const std::string &s);
 void AppendLogBuffer(bool checkDuplicate, std::string message, consoleLogLevel level);
 #endif
@@ -122,41 +130,80 @@ bool Check(Object *object);
 //----------------------------------------------------------------------------
 
 /**
- * This class provides static resource values.
- * The default values can be changed by setters.
+ * This class provides resource values (path and fonts) to a document.
+ * Each document has its own instance. The font tables are immutable once loaded and are shared
+ * (reference-counted) between all instances using the same font from the same path, so that
+ * several toolkits can be used concurrently in different threads.
  */
 
 class Resources {
 public:
+    typedef std::map<wchar_t, Glyph> GlyphTable;
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    Resources();
+    virtual ~Resources() {}
+    ///@}
+
     /**
-     * @name Setters and getters for static environment variables
+     * @name Setters and getters for the default resource path used by new instances
+     */
+    ///@{
+    static std::string GetDefaultPath();
+    static void SetDefaultPath(const std::string &path);
+    ///@}
+
+    /**
+     * @name Setters and getters for environment variables
      */
     ///@{
     /** Resource path */
-    static std::string GetPath() { return m_path; }
-    static void SetPath(std::string path) { m_path = path; }
+    std::string GetPath() const { return m_path; }
+    void SetPath(const std::string &path) { m_path = path; }
     /** Init the SMufL music and text fonts */
-    static bool InitFonts();
-    /** Init the text font (bounding boxes and ASCII only) */
-    static bool InitTextFont(std::string fontName);
+    bool InitFonts();
     /** Select a particular font */
-    static bool SetFont(std::string fontName);
+    bool SetFont(const std::string &fontName);
     /** Returns the glyph (if exists) for the current SMuFL font */
-    static Glyph *GetGlyph(wchar_t smuflCode);
+    const Glyph *GetGlyph(wchar_t smuflCode) const;
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
-    static Glyph *GetTextGlyph(wchar_t code);
+    const Glyph *GetTextGlyph(wchar_t code) const;
     ///@}
 
 private:
-    static bool LoadFont(std::string fontName);
+    /** Return the font table for the path, loading it if it is not loaded yet */
+    static std::shared_ptr<const GlyphTable> GetFontTable(const std::string &path, const std::string &fontName);
+    /** Return the text font table (bounding boxes and ASCII only) for the path */
+    static std::shared_ptr<const GlyphTable> GetTextFontTable(const std::string &path);
+    /** Load the glyphs of the font into the table, overriding the ones already in it */
+    static bool LoadFont(const std::string &path, const std::string &fontName, GlyphTable &font);
+    /**
+     * Load the glyphs from the font bundle (<fontName>.vrvfont) if any.
+     * The bundle is generated by fonts/generate_bundle.py and memory-mapped.
+     */
+    static bool LoadFontBundle(const std::string &path, const std::string &fontName, GlyphTable &font);
+    /** Read the content of a font bundle (see LoadFontBundle) */
+    static bool ReadFontBundle(
+        const char *data, size_t size, const std::string &path, const std::string &fontName, GlyphTable &font);
+    /** Load the text font bounding boxes into the table */
+    static bool LoadTextFont(const std::string &path, const std::string &fontName, GlyphTable &textFont);
 
 private:
     /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
-    static std::string m_path;
+    std::string m_path;
     /** The loaded SMuFL font */
-    static std::map<wchar_t, Glyph> m_font;
+    std::shared_ptr<const GlyphTable> m_font;
     /** A text font used for bounding box calculations */
-    static std::map<wchar_t, Glyph> m_textFont;
+    std::shared_ptr<const GlyphTable> m_textFont;
+
+    /** The default path for new instances */
+    static std::string s_defaultPath;
+    /** The loaded tables, shared by the instances as long as one of them uses it */
+    static std::map<std::string, std::weak_ptr<const GlyphTable> > s_fontTables;
+    static std::mutex s_fontTablesMutex;
 };
 
 //----------------------------------------------------------------------------
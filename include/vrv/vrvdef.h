@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <random>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -218,6 +219,7 @@ enum ClassId {
     //
     BBOX_DEVICE_CONTEXT,
     SVG_DEVICE_CONTEXT,
+    TEE_DEVICE_CONTEXT,
     CUSTOM_DEVICE_CONTEXT,
     //
     UNSPECIFIED
@@ -240,7 +242,8 @@ enum InterfaceId {
     INTERFACE_SCOREDEF,
     INTERFACE_TEXT_DIR,
     INTERFACE_TIME_POINT,
-    INTERFACE_TIME_SPANNING
+    INTERFACE_TIME_SPANNING,
+    INTERFACE_max
 };
 
 //----------------------------------------------------------------------------
@@ -274,8 +277,12 @@ class TimeSpanningInterface;
 
 typedef std::vector<Object *> ArrayOfObjects;
 
+typedef std::minstd_rand UuidGenerator;
+
 typedef std::vector<Comparison *> ArrayOfComparisons;
 
+typedef std::vector<ClassIdComparison *> ArrayOfClassIdComparisons;
+
 typedef std::vector<Note *> ChordCluster;
 
 typedef std::vector<std::tuple<Alignment *, Alignment *, int> > ArrayOfAdjustmentTuples;
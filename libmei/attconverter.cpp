@@ -17,6 +17,9 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <utility>
 
 //----------------------------------------------------------------------------
 
@@ -24,4768 +27,4366 @@
 
 namespace vrv {
 
+/**
+ * Hash function of the perfect hash tables below.
+ * The seed of each table is chosen by the generator so that its tokens do not collide.
+ */
+static uint32_t HashToken(const char *token, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (; *token; ++token) {
+        hash = (hash ^ (unsigned char)*token) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
 //----------------------------------------------------------------------------
 // AttConverter
 //----------------------------------------------------------------------------
 
 std::string AttConverter::AccidentalGesturalToStr(data_ACCIDENTAL_GESTURAL data) const
 {
-    std::string value;
-    switch (data) {
-        case ACCIDENTAL_GESTURAL_s: value = "s"; break;
-        case ACCIDENTAL_GESTURAL_f: value = "f"; break;
-        case ACCIDENTAL_GESTURAL_ss: value = "ss"; break;
-        case ACCIDENTAL_GESTURAL_ff: value = "ff"; break;
-        case ACCIDENTAL_GESTURAL_n: value = "n"; break;
-        case ACCIDENTAL_GESTURAL_su: value = "su"; break;
-        case ACCIDENTAL_GESTURAL_sd: value = "sd"; break;
-        case ACCIDENTAL_GESTURAL_fu: value = "fu"; break;
-        case ACCIDENTAL_GESTURAL_fd: value = "fd"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.ACCIDENTAL.GESTURAL", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ACCIDENTAL_GESTURAL AttConverter::StrToAccidentalGestural(std::string value, bool logWarning) const
-{
-    if (value == "s") return ACCIDENTAL_GESTURAL_s;
-    if (value == "f") return ACCIDENTAL_GESTURAL_f;
-    if (value == "ss") return ACCIDENTAL_GESTURAL_ss;
-    if (value == "ff") return ACCIDENTAL_GESTURAL_ff;
-    if (value == "n") return ACCIDENTAL_GESTURAL_n;
-    if (value == "su") return ACCIDENTAL_GESTURAL_su;
-    if (value == "sd") return ACCIDENTAL_GESTURAL_sd;
-    if (value == "fu") return ACCIDENTAL_GESTURAL_fu;
-    if (value == "fd") return ACCIDENTAL_GESTURAL_fd;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.GESTURAL", value.c_str());
+    static constexpr const char *values[ACCIDENTAL_GESTURAL_MAX] = {
+        "", "s", "f", "ss", "ff", "n", "su", "sd", "fu", "fd"
+    };
+    if ((data <= ACCIDENTAL_GESTURAL_NONE) || (data >= ACCIDENTAL_GESTURAL_MAX)) {
+        LogWarning("Unknown value '%d' for data.ACCIDENTAL.GESTURAL", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_ACCIDENTAL_GESTURAL AttConverter::StrToAccidentalGestural(const std::string &value, bool logWarning) const
+{
+    return StrToAccidentalGestural(value.c_str(), logWarning);
+}
+
+data_ACCIDENTAL_GESTURAL AttConverter::StrToAccidentalGestural(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_ACCIDENTAL_GESTURAL> table[16] = {
+        { "ff", ACCIDENTAL_GESTURAL_ff }, { "ss", ACCIDENTAL_GESTURAL_ss }, { "", ACCIDENTAL_GESTURAL_NONE },
+        { "", ACCIDENTAL_GESTURAL_NONE }, { "su", ACCIDENTAL_GESTURAL_su }, { "", ACCIDENTAL_GESTURAL_NONE },
+        { "fu", ACCIDENTAL_GESTURAL_fu }, { "n", ACCIDENTAL_GESTURAL_n }, { "", ACCIDENTAL_GESTURAL_NONE },
+        { "fd", ACCIDENTAL_GESTURAL_fd }, { "", ACCIDENTAL_GESTURAL_NONE }, { "", ACCIDENTAL_GESTURAL_NONE },
+        { "sd", ACCIDENTAL_GESTURAL_sd }, { "", ACCIDENTAL_GESTURAL_NONE }, { "s", ACCIDENTAL_GESTURAL_s },
+        { "f", ACCIDENTAL_GESTURAL_f }
+    };
+    static constexpr uint16_t seeds[4] = { 9, 2, 0, 1 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.GESTURAL", value);
     return ACCIDENTAL_GESTURAL_NONE;
 }
 
 std::string AttConverter::AccidentalWrittenToStr(data_ACCIDENTAL_WRITTEN data) const
 {
-    std::string value;
-    switch (data) {
-        case ACCIDENTAL_WRITTEN_s: value = "s"; break;
-        case ACCIDENTAL_WRITTEN_f: value = "f"; break;
-        case ACCIDENTAL_WRITTEN_ss: value = "ss"; break;
-        case ACCIDENTAL_WRITTEN_x: value = "x"; break;
-        case ACCIDENTAL_WRITTEN_ff: value = "ff"; break;
-        case ACCIDENTAL_WRITTEN_xs: value = "xs"; break;
-        case ACCIDENTAL_WRITTEN_sx: value = "sx"; break;
-        case ACCIDENTAL_WRITTEN_ts: value = "ts"; break;
-        case ACCIDENTAL_WRITTEN_tf: value = "tf"; break;
-        case ACCIDENTAL_WRITTEN_n: value = "n"; break;
-        case ACCIDENTAL_WRITTEN_nf: value = "nf"; break;
-        case ACCIDENTAL_WRITTEN_ns: value = "ns"; break;
-        case ACCIDENTAL_WRITTEN_su: value = "su"; break;
-        case ACCIDENTAL_WRITTEN_sd: value = "sd"; break;
-        case ACCIDENTAL_WRITTEN_fu: value = "fu"; break;
-        case ACCIDENTAL_WRITTEN_fd: value = "fd"; break;
-        case ACCIDENTAL_WRITTEN_nu: value = "nu"; break;
-        case ACCIDENTAL_WRITTEN_nd: value = "nd"; break;
-        case ACCIDENTAL_WRITTEN_1qf: value = "1qf"; break;
-        case ACCIDENTAL_WRITTEN_3qf: value = "3qf"; break;
-        case ACCIDENTAL_WRITTEN_1qs: value = "1qs"; break;
-        case ACCIDENTAL_WRITTEN_3qs: value = "3qs"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.ACCIDENTAL.WRITTEN", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ACCIDENTAL_WRITTEN AttConverter::StrToAccidentalWritten(std::string value, bool logWarning) const
-{
-    if (value == "s") return ACCIDENTAL_WRITTEN_s;
-    if (value == "f") return ACCIDENTAL_WRITTEN_f;
-    if (value == "ss") return ACCIDENTAL_WRITTEN_ss;
-    if (value == "x") return ACCIDENTAL_WRITTEN_x;
-    if (value == "ff") return ACCIDENTAL_WRITTEN_ff;
-    if (value == "xs") return ACCIDENTAL_WRITTEN_xs;
-    if (value == "sx") return ACCIDENTAL_WRITTEN_sx;
-    if (value == "ts") return ACCIDENTAL_WRITTEN_ts;
-    if (value == "tf") return ACCIDENTAL_WRITTEN_tf;
-    if (value == "n") return ACCIDENTAL_WRITTEN_n;
-    if (value == "nf") return ACCIDENTAL_WRITTEN_nf;
-    if (value == "ns") return ACCIDENTAL_WRITTEN_ns;
-    if (value == "su") return ACCIDENTAL_WRITTEN_su;
-    if (value == "sd") return ACCIDENTAL_WRITTEN_sd;
-    if (value == "fu") return ACCIDENTAL_WRITTEN_fu;
-    if (value == "fd") return ACCIDENTAL_WRITTEN_fd;
-    if (value == "nu") return ACCIDENTAL_WRITTEN_nu;
-    if (value == "nd") return ACCIDENTAL_WRITTEN_nd;
-    if (value == "1qf") return ACCIDENTAL_WRITTEN_1qf;
-    if (value == "3qf") return ACCIDENTAL_WRITTEN_3qf;
-    if (value == "1qs") return ACCIDENTAL_WRITTEN_1qs;
-    if (value == "3qs") return ACCIDENTAL_WRITTEN_3qs;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN", value.c_str());
+    static constexpr const char *values[ACCIDENTAL_WRITTEN_MAX] = {
+        "", "s", "f", "ss", "x", "ff", "xs", "sx", "ts", "tf", "n", "nf", "ns", "su", "sd", "fu", "fd", "nu", "nd",
+        "1qf", "3qf", "1qs", "3qs"
+    };
+    if ((data <= ACCIDENTAL_WRITTEN_NONE) || (data >= ACCIDENTAL_WRITTEN_MAX)) {
+        LogWarning("Unknown value '%d' for data.ACCIDENTAL.WRITTEN", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_ACCIDENTAL_WRITTEN AttConverter::StrToAccidentalWritten(const std::string &value, bool logWarning) const
+{
+    return StrToAccidentalWritten(value.c_str(), logWarning);
+}
+
+data_ACCIDENTAL_WRITTEN AttConverter::StrToAccidentalWritten(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_ACCIDENTAL_WRITTEN> table[32] = {
+        { "sd", ACCIDENTAL_WRITTEN_sd }, { "", ACCIDENTAL_WRITTEN_NONE }, { "", ACCIDENTAL_WRITTEN_NONE },
+        { "", ACCIDENTAL_WRITTEN_NONE }, { "nd", ACCIDENTAL_WRITTEN_nd }, { "s", ACCIDENTAL_WRITTEN_s },
+        { "fd", ACCIDENTAL_WRITTEN_fd }, { "su", ACCIDENTAL_WRITTEN_su }, { "nf", ACCIDENTAL_WRITTEN_nf },
+        { "", ACCIDENTAL_WRITTEN_NONE }, { "f", ACCIDENTAL_WRITTEN_f }, { "nu", ACCIDENTAL_WRITTEN_nu },
+        { "fu", ACCIDENTAL_WRITTEN_fu }, { "", ACCIDENTAL_WRITTEN_NONE }, { "x", ACCIDENTAL_WRITTEN_x },
+        { "ff", ACCIDENTAL_WRITTEN_ff }, { "ns", ACCIDENTAL_WRITTEN_ns }, { "", ACCIDENTAL_WRITTEN_NONE },
+        { "n", ACCIDENTAL_WRITTEN_n }, { "", ACCIDENTAL_WRITTEN_NONE }, { "tf", ACCIDENTAL_WRITTEN_tf },
+        { "", ACCIDENTAL_WRITTEN_NONE }, { "", ACCIDENTAL_WRITTEN_NONE }, { "", ACCIDENTAL_WRITTEN_NONE },
+        { "ss", ACCIDENTAL_WRITTEN_ss }, { "3qs", ACCIDENTAL_WRITTEN_3qs }, { "ts", ACCIDENTAL_WRITTEN_ts },
+        { "1qs", ACCIDENTAL_WRITTEN_1qs }, { "sx", ACCIDENTAL_WRITTEN_sx }, { "3qf", ACCIDENTAL_WRITTEN_3qf },
+        { "1qf", ACCIDENTAL_WRITTEN_1qf }, { "xs", ACCIDENTAL_WRITTEN_xs }
+    };
+    static constexpr uint16_t seeds[8] = { 0, 4, 2, 11, 0, 1, 5, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN", value);
     return ACCIDENTAL_WRITTEN_NONE;
 }
 
 std::string AttConverter::ArticulationToStr(data_ARTICULATION data) const
 {
-    std::string value;
-    switch (data) {
-        case ARTICULATION_acc: value = "acc"; break;
-        case ARTICULATION_stacc: value = "stacc"; break;
-        case ARTICULATION_ten: value = "ten"; break;
-        case ARTICULATION_stacciss: value = "stacciss"; break;
-        case ARTICULATION_marc: value = "marc"; break;
-        case ARTICULATION_spicc: value = "spicc"; break;
-        case ARTICULATION_doit: value = "doit"; break;
-        case ARTICULATION_scoop: value = "scoop"; break;
-        case ARTICULATION_rip: value = "rip"; break;
-        case ARTICULATION_plop: value = "plop"; break;
-        case ARTICULATION_fall: value = "fall"; break;
-        case ARTICULATION_longfall: value = "longfall"; break;
-        case ARTICULATION_bend: value = "bend"; break;
-        case ARTICULATION_flip: value = "flip"; break;
-        case ARTICULATION_smear: value = "smear"; break;
-        case ARTICULATION_shake: value = "shake"; break;
-        case ARTICULATION_dnbow: value = "dnbow"; break;
-        case ARTICULATION_upbow: value = "upbow"; break;
-        case ARTICULATION_harm: value = "harm"; break;
-        case ARTICULATION_snap: value = "snap"; break;
-        case ARTICULATION_fingernail: value = "fingernail"; break;
-        case ARTICULATION_damp: value = "damp"; break;
-        case ARTICULATION_dampall: value = "dampall"; break;
-        case ARTICULATION_open: value = "open"; break;
-        case ARTICULATION_stop: value = "stop"; break;
-        case ARTICULATION_dbltongue: value = "dbltongue"; break;
-        case ARTICULATION_trpltongue: value = "trpltongue"; break;
-        case ARTICULATION_heel: value = "heel"; break;
-        case ARTICULATION_toe: value = "toe"; break;
-        case ARTICULATION_tap: value = "tap"; break;
-        case ARTICULATION_lhpizz: value = "lhpizz"; break;
-        case ARTICULATION_dot: value = "dot"; break;
-        case ARTICULATION_stroke: value = "stroke"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.ARTICULATION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ARTICULATION AttConverter::StrToArticulation(std::string value, bool logWarning) const
-{
-    if (value == "acc") return ARTICULATION_acc;
-    if (value == "stacc") return ARTICULATION_stacc;
-    if (value == "ten") return ARTICULATION_ten;
-    if (value == "stacciss") return ARTICULATION_stacciss;
-    if (value == "marc") return ARTICULATION_marc;
-    if (value == "spicc") return ARTICULATION_spicc;
-    if (value == "doit") return ARTICULATION_doit;
-    if (value == "scoop") return ARTICULATION_scoop;
-    if (value == "rip") return ARTICULATION_rip;
-    if (value == "plop") return ARTICULATION_plop;
-    if (value == "fall") return ARTICULATION_fall;
-    if (value == "longfall") return ARTICULATION_longfall;
-    if (value == "bend") return ARTICULATION_bend;
-    if (value == "flip") return ARTICULATION_flip;
-    if (value == "smear") return ARTICULATION_smear;
-    if (value == "shake") return ARTICULATION_shake;
-    if (value == "dnbow") return ARTICULATION_dnbow;
-    if (value == "upbow") return ARTICULATION_upbow;
-    if (value == "harm") return ARTICULATION_harm;
-    if (value == "snap") return ARTICULATION_snap;
-    if (value == "fingernail") return ARTICULATION_fingernail;
-    if (value == "damp") return ARTICULATION_damp;
-    if (value == "dampall") return ARTICULATION_dampall;
-    if (value == "open") return ARTICULATION_open;
-    if (value == "stop") return ARTICULATION_stop;
-    if (value == "dbltongue") return ARTICULATION_dbltongue;
-    if (value == "trpltongue") return ARTICULATION_trpltongue;
-    if (value == "heel") return ARTICULATION_heel;
-    if (value == "toe") return ARTICULATION_toe;
-    if (value == "tap") return ARTICULATION_tap;
-    if (value == "lhpizz") return ARTICULATION_lhpizz;
-    if (value == "dot") return ARTICULATION_dot;
-    if (value == "stroke") return ARTICULATION_stroke;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ARTICULATION", value.c_str());
+    static constexpr const char *values[ARTICULATION_MAX] = {
+        "", "acc", "stacc", "ten", "stacciss", "marc", "spicc", "doit", "scoop", "rip", "plop", "fall", "longfall",
+        "bend", "flip", "smear", "shake", "dnbow", "upbow", "harm", "snap", "fingernail", "damp", "dampall", "open",
+        "stop", "dbltongue", "trpltongue", "heel", "toe", "tap", "lhpizz", "dot", "stroke"
+    };
+    if ((data <= ARTICULATION_NONE) || (data >= ARTICULATION_MAX)) {
+        LogWarning("Unknown value '%d' for data.ARTICULATION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_ARTICULATION AttConverter::StrToArticulation(const std::string &value, bool logWarning) const
+{
+    return StrToArticulation(value.c_str(), logWarning);
+}
+
+data_ARTICULATION AttConverter::StrToArticulation(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_ARTICULATION> table[64] = {
+        { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "marc", ARTICULATION_marc }, { "", ARTICULATION_NONE },
+        { "harm", ARTICULATION_harm }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE },
+        { "dot", ARTICULATION_dot }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE },
+        { "stacc", ARTICULATION_stacc }, { "", ARTICULATION_NONE }, { "toe", ARTICULATION_toe },
+        { "", ARTICULATION_NONE }, { "acc", ARTICULATION_acc }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE },
+        { "", ARTICULATION_NONE }, { "flip", ARTICULATION_flip }, { "dampall", ARTICULATION_dampall },
+        { "shake", ARTICULATION_shake }, { "open", ARTICULATION_open }, { "lhpizz", ARTICULATION_lhpizz },
+        { "longfall", ARTICULATION_longfall }, { "dnbow", ARTICULATION_dnbow }, { "", ARTICULATION_NONE },
+        { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE },
+        { "scoop", ARTICULATION_scoop }, { "stop", ARTICULATION_stop }, { "rip", ARTICULATION_rip },
+        { "", ARTICULATION_NONE }, { "smear", ARTICULATION_smear }, { "fingernail", ARTICULATION_fingernail },
+        { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE }, { "snap", ARTICULATION_snap },
+        { "", ARTICULATION_NONE }, { "upbow", ARTICULATION_upbow }, { "damp", ARTICULATION_damp },
+        { "", ARTICULATION_NONE }, { "ten", ARTICULATION_ten }, { "spicc", ARTICULATION_spicc },
+        { "stacciss", ARTICULATION_stacciss }, { "trpltongue", ARTICULATION_trpltongue }, { "doit", ARTICULATION_doit },
+        { "stroke", ARTICULATION_stroke }, { "", ARTICULATION_NONE }, { "", ARTICULATION_NONE },
+        { "plop", ARTICULATION_plop }, { "", ARTICULATION_NONE }, { "bend", ARTICULATION_bend },
+        { "", ARTICULATION_NONE }, { "fall", ARTICULATION_fall }, { "dbltongue", ARTICULATION_dbltongue },
+        { "", ARTICULATION_NONE }, { "tap", ARTICULATION_tap }, { "", ARTICULATION_NONE }, { "heel", ARTICULATION_heel }
+    };
+    static constexpr uint16_t seeds[16] = { 0, 4, 0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 4, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 63];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.ARTICULATION", value);
     return ARTICULATION_NONE;
 }
 
 std::string AttConverter::BarmethodToStr(data_BARMETHOD data) const
 {
-    std::string value;
-    switch (data) {
-        case BARMETHOD_mensur: value = "mensur"; break;
-        case BARMETHOD_staff: value = "staff"; break;
-        case BARMETHOD_takt: value = "takt"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.BARMETHOD", data);
-            value = "";
-            break;
+    static constexpr const char *values[BARMETHOD_MAX] = { "", "mensur", "staff", "takt" };
+    if ((data <= BARMETHOD_NONE) || (data >= BARMETHOD_MAX)) {
+        LogWarning("Unknown value '%d' for data.BARMETHOD", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_BARMETHOD AttConverter::StrToBarmethod(std::string value, bool logWarning) const
+data_BARMETHOD AttConverter::StrToBarmethod(const std::string &value, bool logWarning) const
 {
-    if (value == "mensur") return BARMETHOD_mensur;
-    if (value == "staff") return BARMETHOD_staff;
-    if (value == "takt") return BARMETHOD_takt;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BARMETHOD", value.c_str());
+    return StrToBarmethod(value.c_str(), logWarning);
+}
+
+data_BARMETHOD AttConverter::StrToBarmethod(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_BARMETHOD> table[4] = {
+        { "staff", BARMETHOD_staff }, { "takt", BARMETHOD_takt }, { "mensur", BARMETHOD_mensur }, { "", BARMETHOD_NONE }
+    };
+    const auto &entry = table[HashToken(value, 5) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.BARMETHOD", value);
     return BARMETHOD_NONE;
 }
 
 std::string AttConverter::BarrenditionToStr(data_BARRENDITION data) const
 {
-    std::string value;
-    switch (data) {
-        case BARRENDITION_dashed: value = "dashed"; break;
-        case BARRENDITION_dotted: value = "dotted"; break;
-        case BARRENDITION_dbl: value = "dbl"; break;
-        case BARRENDITION_dbldashed: value = "dbldashed"; break;
-        case BARRENDITION_dbldotted: value = "dbldotted"; break;
-        case BARRENDITION_end: value = "end"; break;
-        case BARRENDITION_invis: value = "invis"; break;
-        case BARRENDITION_rptstart: value = "rptstart"; break;
-        case BARRENDITION_rptboth: value = "rptboth"; break;
-        case BARRENDITION_rptend: value = "rptend"; break;
-        case BARRENDITION_single: value = "single"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.BARRENDITION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_BARRENDITION AttConverter::StrToBarrendition(std::string value, bool logWarning) const
-{
-    if (value == "dashed") return BARRENDITION_dashed;
-    if (value == "dotted") return BARRENDITION_dotted;
-    if (value == "dbl") return BARRENDITION_dbl;
-    if (value == "dbldashed") return BARRENDITION_dbldashed;
-    if (value == "dbldotted") return BARRENDITION_dbldotted;
-    if (value == "end") return BARRENDITION_end;
-    if (value == "invis") return BARRENDITION_invis;
-    if (value == "rptstart") return BARRENDITION_rptstart;
-    if (value == "rptboth") return BARRENDITION_rptboth;
-    if (value == "rptend") return BARRENDITION_rptend;
-    if (value == "single") return BARRENDITION_single;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BARRENDITION", value.c_str());
+    static constexpr const char *values[BARRENDITION_MAX] = {
+        "", "dashed", "dotted", "dbl", "dbldashed", "dbldotted", "end", "invis", "rptstart", "rptboth", "rptend",
+        "single"
+    };
+    if ((data <= BARRENDITION_NONE) || (data >= BARRENDITION_MAX)) {
+        LogWarning("Unknown value '%d' for data.BARRENDITION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_BARRENDITION AttConverter::StrToBarrendition(const std::string &value, bool logWarning) const
+{
+    return StrToBarrendition(value.c_str(), logWarning);
+}
+
+data_BARRENDITION AttConverter::StrToBarrendition(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_BARRENDITION> table[16] = {
+        { "single", BARRENDITION_single }, { "", BARRENDITION_NONE }, { "", BARRENDITION_NONE },
+        { "rptend", BARRENDITION_rptend }, { "end", BARRENDITION_end }, { "rptboth", BARRENDITION_rptboth },
+        { "dashed", BARRENDITION_dashed }, { "dotted", BARRENDITION_dotted }, { "rptstart", BARRENDITION_rptstart },
+        { "invis", BARRENDITION_invis }, { "", BARRENDITION_NONE }, { "dbldashed", BARRENDITION_dbldashed },
+        { "", BARRENDITION_NONE }, { "dbldotted", BARRENDITION_dbldotted }, { "dbl", BARRENDITION_dbl },
+        { "", BARRENDITION_NONE }
+    };
+    static constexpr uint16_t seeds[4] = { 0, 1, 7, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.BARRENDITION", value);
     return BARRENDITION_NONE;
 }
 
 std::string AttConverter::BeamplaceToStr(data_BEAMPLACE data) const
 {
-    std::string value;
-    switch (data) {
-        case BEAMPLACE_above: value = "above"; break;
-        case BEAMPLACE_below: value = "below"; break;
-        case BEAMPLACE_mixed: value = "mixed"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.BEAMPLACE", data);
-            value = "";
-            break;
+    static constexpr const char *values[BEAMPLACE_MAX] = { "", "above", "below", "mixed" };
+    if ((data <= BEAMPLACE_NONE) || (data >= BEAMPLACE_MAX)) {
+        LogWarning("Unknown value '%d' for data.BEAMPLACE", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_BEAMPLACE AttConverter::StrToBeamplace(std::string value, bool logWarning) const
+data_BEAMPLACE AttConverter::StrToBeamplace(const std::string &value, bool logWarning) const
 {
-    if (value == "above") return BEAMPLACE_above;
-    if (value == "below") return BEAMPLACE_below;
-    if (value == "mixed") return BEAMPLACE_mixed;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BEAMPLACE", value.c_str());
+    return StrToBeamplace(value.c_str(), logWarning);
+}
+
+data_BEAMPLACE AttConverter::StrToBeamplace(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_BEAMPLACE> table[4] = {
+        { "mixed", BEAMPLACE_mixed }, { "below", BEAMPLACE_below }, { "", BEAMPLACE_NONE }, { "above", BEAMPLACE_above }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.BEAMPLACE", value);
     return BEAMPLACE_NONE;
 }
 
 std::string AttConverter::BetypeToStr(data_BETYPE data) const
 {
-    std::string value;
-    switch (data) {
-        case BETYPE_byte: value = "byte"; break;
-        case BETYPE_smil: value = "smil"; break;
-        case BETYPE_midi: value = "midi"; break;
-        case BETYPE_mmc: value = "mmc"; break;
-        case BETYPE_mtc: value = "mtc"; break;
-        case BETYPE_smpte_25: value = "smpte-25"; break;
-        case BETYPE_smpte_24: value = "smpte-24"; break;
-        case BETYPE_smpte_df30: value = "smpte-df30"; break;
-        case BETYPE_smpte_ndf30: value = "smpte-ndf30"; break;
-        case BETYPE_smpte_df29_97: value = "smpte-df29.97"; break;
-        case BETYPE_smpte_ndf29_97: value = "smpte-ndf29.97"; break;
-        case BETYPE_tcf: value = "tcf"; break;
-        case BETYPE_time: value = "time"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.BETYPE", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_BETYPE AttConverter::StrToBetype(std::string value, bool logWarning) const
-{
-    if (value == "byte") return BETYPE_byte;
-    if (value == "smil") return BETYPE_smil;
-    if (value == "midi") return BETYPE_midi;
-    if (value == "mmc") return BETYPE_mmc;
-    if (value == "mtc") return BETYPE_mtc;
-    if (value == "smpte-25") return BETYPE_smpte_25;
-    if (value == "smpte-24") return BETYPE_smpte_24;
-    if (value == "smpte-df30") return BETYPE_smpte_df30;
-    if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
-    if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
-    if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
-    if (value == "tcf") return BETYPE_tcf;
-    if (value == "time") return BETYPE_time;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BETYPE", value.c_str());
+    static constexpr const char *values[BETYPE_MAX] = {
+        "", "byte", "smil", "midi", "mmc", "mtc", "smpte-25", "smpte-24", "smpte-df30", "smpte-ndf30", "smpte-df29.97",
+        "smpte-ndf29.97", "tcf", "time"
+    };
+    if ((data <= BETYPE_NONE) || (data >= BETYPE_MAX)) {
+        LogWarning("Unknown value '%d' for data.BETYPE", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_BETYPE AttConverter::StrToBetype(const std::string &value, bool logWarning) const
+{
+    return StrToBetype(value.c_str(), logWarning);
+}
+
+data_BETYPE AttConverter::StrToBetype(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_BETYPE> table[16] = {
+        { "midi", BETYPE_midi }, { "smil", BETYPE_smil }, { "time", BETYPE_time }, { "smpte-df30", BETYPE_smpte_df30 },
+        { "mmc", BETYPE_mmc }, { "tcf", BETYPE_tcf }, { "", BETYPE_NONE }, { "mtc", BETYPE_mtc },
+        { "smpte-df29.97", BETYPE_smpte_df29_97 }, { "byte", BETYPE_byte }, { "", BETYPE_NONE },
+        { "smpte-24", BETYPE_smpte_24 }, { "", BETYPE_NONE }, { "smpte-ndf30", BETYPE_smpte_ndf30 },
+        { "smpte-ndf29.97", BETYPE_smpte_ndf29_97 }, { "smpte-25", BETYPE_smpte_25 }
+    };
+    static constexpr uint16_t seeds[8] = { 3, 0, 0, 0, 0, 1, 1, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.BETYPE", value);
     return BETYPE_NONE;
 }
 
 std::string AttConverter::BooleanToStr(data_BOOLEAN data) const
 {
-    std::string value;
-    switch (data) {
-        case BOOLEAN_true: value = "true"; break;
-        case BOOLEAN_false: value = "false"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.BOOLEAN", data);
-            value = "";
-            break;
+    static constexpr const char *values[BOOLEAN_MAX] = { "", "true", "false" };
+    if ((data <= BOOLEAN_NONE) || (data >= BOOLEAN_MAX)) {
+        LogWarning("Unknown value '%d' for data.BOOLEAN", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_BOOLEAN AttConverter::StrToBoolean(const std::string &value, bool logWarning) const
+{
+    return StrToBoolean(value.c_str(), logWarning);
 }
 
-data_BOOLEAN AttConverter::StrToBoolean(std::string value, bool logWarning) const
+data_BOOLEAN AttConverter::StrToBoolean(const char *value, bool logWarning) const
 {
-    if (value == "true") return BOOLEAN_true;
-    if (value == "false") return BOOLEAN_false;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BOOLEAN", value.c_str());
+    static constexpr std::pair<const char *, data_BOOLEAN> table[2] = {
+        { "false", BOOLEAN_false }, { "true", BOOLEAN_true }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.BOOLEAN", value);
     return BOOLEAN_NONE;
 }
 
 std::string AttConverter::CertaintyToStr(data_CERTAINTY data) const
 {
-    std::string value;
-    switch (data) {
-        case CERTAINTY_high: value = "high"; break;
-        case CERTAINTY_medium: value = "medium"; break;
-        case CERTAINTY_low: value = "low"; break;
-        case CERTAINTY_unknown: value = "unknown"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.CERTAINTY", data);
-            value = "";
-            break;
+    static constexpr const char *values[CERTAINTY_MAX] = { "", "high", "medium", "low", "unknown" };
+    if ((data <= CERTAINTY_NONE) || (data >= CERTAINTY_MAX)) {
+        LogWarning("Unknown value '%d' for data.CERTAINTY", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_CERTAINTY AttConverter::StrToCertainty(std::string value, bool logWarning) const
+data_CERTAINTY AttConverter::StrToCertainty(const std::string &value, bool logWarning) const
 {
-    if (value == "high") return CERTAINTY_high;
-    if (value == "medium") return CERTAINTY_medium;
-    if (value == "low") return CERTAINTY_low;
-    if (value == "unknown") return CERTAINTY_unknown;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.CERTAINTY", value.c_str());
+    return StrToCertainty(value.c_str(), logWarning);
+}
+
+data_CERTAINTY AttConverter::StrToCertainty(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_CERTAINTY> table[4] = {
+        { "low", CERTAINTY_low }, { "high", CERTAINTY_high }, { "unknown", CERTAINTY_unknown },
+        { "medium", CERTAINTY_medium }
+    };
+    static constexpr uint16_t seeds[2] = { 1, 21 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.CERTAINTY", value);
     return CERTAINTY_NONE;
 }
 
 std::string AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
 {
-    std::string value;
-    switch (data) {
-        case CLEFSHAPE_G: value = "G"; break;
-        case CLEFSHAPE_GG: value = "GG"; break;
-        case CLEFSHAPE_F: value = "F"; break;
-        case CLEFSHAPE_C: value = "C"; break;
-        case CLEFSHAPE_perc: value = "perc"; break;
-        case CLEFSHAPE_TAB: value = "TAB"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.CLEFSHAPE", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_CLEFSHAPE AttConverter::StrToClefshape(std::string value, bool logWarning) const
-{
-    if (value == "G") return CLEFSHAPE_G;
-    if (value == "GG") return CLEFSHAPE_GG;
-    if (value == "F") return CLEFSHAPE_F;
-    if (value == "C") return CLEFSHAPE_C;
-    if (value == "perc") return CLEFSHAPE_perc;
-    if (value == "TAB") return CLEFSHAPE_TAB;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value.c_str());
+    static constexpr const char *values[CLEFSHAPE_MAX] = { "", "G", "GG", "F", "C", "perc", "TAB" };
+    if ((data <= CLEFSHAPE_NONE) || (data >= CLEFSHAPE_MAX)) {
+        LogWarning("Unknown value '%d' for data.CLEFSHAPE", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_CLEFSHAPE AttConverter::StrToClefshape(const std::string &value, bool logWarning) const
+{
+    return StrToClefshape(value.c_str(), logWarning);
+}
+
+data_CLEFSHAPE AttConverter::StrToClefshape(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_CLEFSHAPE> table[8] = {
+        { "", CLEFSHAPE_NONE }, { "GG", CLEFSHAPE_GG }, { "F", CLEFSHAPE_F }, { "G", CLEFSHAPE_G },
+        { "", CLEFSHAPE_NONE }, { "perc", CLEFSHAPE_perc }, { "TAB", CLEFSHAPE_TAB }, { "C", CLEFSHAPE_C }
+    };
+    static constexpr uint16_t seeds[2] = { 0, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value);
     return CLEFSHAPE_NONE;
 }
 
 std::string AttConverter::ClusterToStr(data_CLUSTER data) const
 {
-    std::string value;
-    switch (data) {
-        case CLUSTER_white: value = "white"; break;
-        case CLUSTER_black: value = "black"; break;
-        case CLUSTER_chromatic: value = "chromatic"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.CLUSTER", data);
-            value = "";
-            break;
+    static constexpr const char *values[CLUSTER_MAX] = { "", "white", "black", "chromatic" };
+    if ((data <= CLUSTER_NONE) || (data >= CLUSTER_MAX)) {
+        LogWarning("Unknown value '%d' for data.CLUSTER", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_CLUSTER AttConverter::StrToCluster(std::string value, bool logWarning) const
+data_CLUSTER AttConverter::StrToCluster(const std::string &value, bool logWarning) const
 {
-    if (value == "white") return CLUSTER_white;
-    if (value == "black") return CLUSTER_black;
-    if (value == "chromatic") return CLUSTER_chromatic;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.CLUSTER", value.c_str());
+    return StrToCluster(value.c_str(), logWarning);
+}
+
+data_CLUSTER AttConverter::StrToCluster(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_CLUSTER> table[4] = {
+        { "", CLUSTER_NONE }, { "chromatic", CLUSTER_chromatic }, { "black", CLUSTER_black }, { "white", CLUSTER_white }
+    };
+    const auto &entry = table[HashToken(value, 1) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.CLUSTER", value);
     return CLUSTER_NONE;
 }
 
 std::string AttConverter::ColornamesToStr(data_COLORNAMES data) const
 {
-    std::string value;
-    switch (data) {
-        case COLORNAMES_aliceblue: value = "aliceblue"; break;
-        case COLORNAMES_antiquewhite: value = "antiquewhite"; break;
-        case COLORNAMES_aqua: value = "aqua"; break;
-        case COLORNAMES_aquamarine: value = "aquamarine"; break;
-        case COLORNAMES_azure: value = "azure"; break;
-        case COLORNAMES_beige: value = "beige"; break;
-        case COLORNAMES_bisque: value = "bisque"; break;
-        case COLORNAMES_black: value = "black"; break;
-        case COLORNAMES_blanchedalmond: value = "blanchedalmond"; break;
-        case COLORNAMES_blue: value = "blue"; break;
-        case COLORNAMES_blueviolet: value = "blueviolet"; break;
-        case COLORNAMES_brown: value = "brown"; break;
-        case COLORNAMES_burlywood: value = "burlywood"; break;
-        case COLORNAMES_cadetblue: value = "cadetblue"; break;
-        case COLORNAMES_chartreuse: value = "chartreuse"; break;
-        case COLORNAMES_chocolate: value = "chocolate"; break;
-        case COLORNAMES_coral: value = "coral"; break;
-        case COLORNAMES_cornflowerblue: value = "cornflowerblue"; break;
-        case COLORNAMES_cornsilk: value = "cornsilk"; break;
-        case COLORNAMES_crimson: value = "crimson"; break;
-        case COLORNAMES_cyan: value = "cyan"; break;
-        case COLORNAMES_darkblue: value = "darkblue"; break;
-        case COLORNAMES_darkcyan: value = "darkcyan"; break;
-        case COLORNAMES_darkgoldenrod: value = "darkgoldenrod"; break;
-        case COLORNAMES_darkgray: value = "darkgray"; break;
-        case COLORNAMES_darkgreen: value = "darkgreen"; break;
-        case COLORNAMES_darkgrey: value = "darkgrey"; break;
-        case COLORNAMES_darkkhaki: value = "darkkhaki"; break;
-        case COLORNAMES_darkmagenta: value = "darkmagenta"; break;
-        case COLORNAMES_darkolivegreen: value = "darkolivegreen"; break;
-        case COLORNAMES_darkorange: value = "darkorange"; break;
-        case COLORNAMES_darkorchid: value = "darkorchid"; break;
-        case COLORNAMES_darkred: value = "darkred"; break;
-        case COLORNAMES_darksalmon: value = "darksalmon"; break;
-        case COLORNAMES_darkseagreen: value = "darkseagreen"; break;
-        case COLORNAMES_darkslateblue: value = "darkslateblue"; break;
-        case COLORNAMES_darkslategray: value = "darkslategray"; break;
-        case COLORNAMES_darkslategrey: value = "darkslategrey"; break;
-        case COLORNAMES_darkturquoise: value = "darkturquoise"; break;
-        case COLORNAMES_darkviolet: value = "darkviolet"; break;
-        case COLORNAMES_deeppink: value = "deeppink"; break;
-        case COLORNAMES_deepskyblue: value = "deepskyblue"; break;
-        case COLORNAMES_dimgray: value = "dimgray"; break;
-        case COLORNAMES_dimgrey: value = "dimgrey"; break;
-        case COLORNAMES_dodgerblue: value = "dodgerblue"; break;
-        case COLORNAMES_firebrick: value = "firebrick"; break;
-        case COLORNAMES_floralwhite: value = "floralwhite"; break;
-        case COLORNAMES_forestgreen: value = "forestgreen"; break;
-        case COLORNAMES_fuchsia: value = "fuchsia"; break;
-        case COLORNAMES_gainsboro: value = "gainsboro"; break;
-        case COLORNAMES_ghostwhite: value = "ghostwhite"; break;
-        case COLORNAMES_gold: value = "gold"; break;
-        case COLORNAMES_goldenrod: value = "goldenrod"; break;
-        case COLORNAMES_gray: value = "gray"; break;
-        case COLORNAMES_green: value = "green"; break;
-        case COLORNAMES_greenyellow: value = "greenyellow"; break;
-        case COLORNAMES_grey: value = "grey"; break;
-        case COLORNAMES_honeydew: value = "honeydew"; break;
-        case COLORNAMES_hotpink: value = "hotpink"; break;
-        case COLORNAMES_indianred: value = "indianred"; break;
-        case COLORNAMES_indigo: value = "indigo"; break;
-        case COLORNAMES_ivory: value = "ivory"; break;
-        case COLORNAMES_khaki: value = "khaki"; break;
-        case COLORNAMES_lavender: value = "lavender"; break;
-        case COLORNAMES_lavenderblush: value = "lavenderblush"; break;
-        case COLORNAMES_lawngreen: value = "lawngreen"; break;
-        case COLORNAMES_lemonchiffon: value = "lemonchiffon"; break;
-        case COLORNAMES_lightblue: value = "lightblue"; break;
-        case COLORNAMES_lightcoral: value = "lightcoral"; break;
-        case COLORNAMES_lightcyan: value = "lightcyan"; break;
-        case COLORNAMES_lightgoldenrodyellow: value = "lightgoldenrodyellow"; break;
-        case COLORNAMES_lightgray: value = "lightgray"; break;
-        case COLORNAMES_lightgreen: value = "lightgreen"; break;
-        case COLORNAMES_lightgrey: value = "lightgrey"; break;
-        case COLORNAMES_lightpink: value = "lightpink"; break;
-        case COLORNAMES_lightsalmon: value = "lightsalmon"; break;
-        case COLORNAMES_lightseagreen: value = "lightseagreen"; break;
-        case COLORNAMES_lightskyblue: value = "lightskyblue"; break;
-        case COLORNAMES_lightslategray: value = "lightslategray"; break;
-        case COLORNAMES_lightslategrey: value = "lightslategrey"; break;
-        case COLORNAMES_lightsteelblue: value = "lightsteelblue"; break;
-        case COLORNAMES_lightyellow: value = "lightyellow"; break;
-        case COLORNAMES_lime: value = "lime"; break;
-        case COLORNAMES_limegreen: value = "limegreen"; break;
-        case COLORNAMES_linen: value = "linen"; break;
-        case COLORNAMES_magenta: value = "magenta"; break;
-        case COLORNAMES_maroon: value = "maroon"; break;
-        case COLORNAMES_mediumaquamarine: value = "mediumaquamarine"; break;
-        case COLORNAMES_mediumblue: value = "mediumblue"; break;
-        case COLORNAMES_mediumorchid: value = "mediumorchid"; break;
-        case COLORNAMES_mediumpurple: value = "mediumpurple"; break;
-        case COLORNAMES_mediumseagreen: value = "mediumseagreen"; break;
-        case COLORNAMES_mediumslateblue: value = "mediumslateblue"; break;
-        case COLORNAMES_mediumspringgreen: value = "mediumspringgreen"; break;
-        case COLORNAMES_mediumturquoise: value = "mediumturquoise"; break;
-        case COLORNAMES_mediumvioletred: value = "mediumvioletred"; break;
-        case COLORNAMES_midnightblue: value = "midnightblue"; break;
-        case COLORNAMES_mintcream: value = "mintcream"; break;
-        case COLORNAMES_mistyrose: value = "mistyrose"; break;
-        case COLORNAMES_moccasin: value = "moccasin"; break;
-        case COLORNAMES_navajowhite: value = "navajowhite"; break;
-        case COLORNAMES_navy: value = "navy"; break;
-        case COLORNAMES_oldlace: value = "oldlace"; break;
-        case COLORNAMES_olive: value = "olive"; break;
-        case COLORNAMES_olivedrab: value = "olivedrab"; break;
-        case COLORNAMES_orange: value = "orange"; break;
-        case COLORNAMES_orangered: value = "orangered"; break;
-        case COLORNAMES_orchid: value = "orchid"; break;
-        case COLORNAMES_palegoldenrod: value = "palegoldenrod"; break;
-        case COLORNAMES_palegreen: value = "palegreen"; break;
-        case COLORNAMES_paleturquoise: value = "paleturquoise"; break;
-        case COLORNAMES_palevioletred: value = "palevioletred"; break;
-        case COLORNAMES_papayawhip: value = "papayawhip"; break;
-        case COLORNAMES_peachpuff: value = "peachpuff"; break;
-        case COLORNAMES_peru: value = "peru"; break;
-        case COLORNAMES_pink: value = "pink"; break;
-        case COLORNAMES_plum: value = "plum"; break;
-        case COLORNAMES_powderblue: value = "powderblue"; break;
-        case COLORNAMES_purple: value = "purple"; break;
-        case COLORNAMES_rebeccapurple: value = "rebeccapurple"; break;
-        case COLORNAMES_red: value = "red"; break;
-        case COLORNAMES_rosybrown: value = "rosybrown"; break;
-        case COLORNAMES_royalblue: value = "royalblue"; break;
-        case COLORNAMES_saddlebrown: value = "saddlebrown"; break;
-        case COLORNAMES_salmon: value = "salmon"; break;
-        case COLORNAMES_sandybrown: value = "sandybrown"; break;
-        case COLORNAMES_seagreen: value = "seagreen"; break;
-        case COLORNAMES_seashell: value = "seashell"; break;
-        case COLORNAMES_sienna: value = "sienna"; break;
-        case COLORNAMES_silver: value = "silver"; break;
-        case COLORNAMES_skyblue: value = "skyblue"; break;
-        case COLORNAMES_slateblue: value = "slateblue"; break;
-        case COLORNAMES_slategray: value = "slategray"; break;
-        case COLORNAMES_slategrey: value = "slategrey"; break;
-        case COLORNAMES_snow: value = "snow"; break;
-        case COLORNAMES_springgreen: value = "springgreen"; break;
-        case COLORNAMES_steelblue: value = "steelblue"; break;
-        case COLORNAMES_tan: value = "tan"; break;
-        case COLORNAMES_teal: value = "teal"; break;
-        case COLORNAMES_thistle: value = "thistle"; break;
-        case COLORNAMES_tomato: value = "tomato"; break;
-        case COLORNAMES_turquoise: value = "turquoise"; break;
-        case COLORNAMES_violet: value = "violet"; break;
-        case COLORNAMES_wheat: value = "wheat"; break;
-        case COLORNAMES_white: value = "white"; break;
-        case COLORNAMES_whitesmoke: value = "whitesmoke"; break;
-        case COLORNAMES_yellow: value = "yellow"; break;
-        case COLORNAMES_yellowgreen: value = "yellowgreen"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.COLORNAMES", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_COLORNAMES AttConverter::StrToColornames(std::string value, bool logWarning) const
-{
-    if (value == "aliceblue") return COLORNAMES_aliceblue;
-    if (value == "antiquewhite") return COLORNAMES_antiquewhite;
-    if (value == "aqua") return COLORNAMES_aqua;
-    if (value == "aquamarine") return COLORNAMES_aquamarine;
-    if (value == "azure") return COLORNAMES_azure;
-    if (value == "beige") return COLORNAMES_beige;
-    if (value == "bisque") return COLORNAMES_bisque;
-    if (value == "black") return COLORNAMES_black;
-    if (value == "blanchedalmond") return COLORNAMES_blanchedalmond;
-    if (value == "blue") return COLORNAMES_blue;
-    if (value == "blueviolet") return COLORNAMES_blueviolet;
-    if (value == "brown") return COLORNAMES_brown;
-    if (value == "burlywood") return COLORNAMES_burlywood;
-    if (value == "cadetblue") return COLORNAMES_cadetblue;
-    if (value == "chartreuse") return COLORNAMES_chartreuse;
-    if (value == "chocolate") return COLORNAMES_chocolate;
-    if (value == "coral") return COLORNAMES_coral;
-    if (value == "cornflowerblue") return COLORNAMES_cornflowerblue;
-    if (value == "cornsilk") return COLORNAMES_cornsilk;
-    if (value == "crimson") return COLORNAMES_crimson;
-    if (value == "cyan") return COLORNAMES_cyan;
-    if (value == "darkblue") return COLORNAMES_darkblue;
-    if (value == "darkcyan") return COLORNAMES_darkcyan;
-    if (value == "darkgoldenrod") return COLORNAMES_darkgoldenrod;
-    if (value == "darkgray") return COLORNAMES_darkgray;
-    if (value == "darkgreen") return COLORNAMES_darkgreen;
-    if (value == "darkgrey") return COLORNAMES_darkgrey;
-    if (value == "darkkhaki") return COLORNAMES_darkkhaki;
-    if (value == "darkmagenta") return COLORNAMES_darkmagenta;
-    if (value == "darkolivegreen") return COLORNAMES_darkolivegreen;
-    if (value == "darkorange") return COLORNAMES_darkorange;
-    if (value == "darkorchid") return COLORNAMES_darkorchid;
-    if (value == "darkred") return COLORNAMES_darkred;
-    if (value == "darksalmon") return COLORNAMES_darksalmon;
-    if (value == "darkseagreen") return COLORNAMES_darkseagreen;
-    if (value == "darkslateblue") return COLORNAMES_darkslateblue;
-    if (value == "darkslategray") return COLORNAMES_darkslategray;
-    if (value == "darkslategrey") return COLORNAMES_darkslategrey;
-    if (value == "darkturquoise") return COLORNAMES_darkturquoise;
-    if (value == "darkviolet") return COLORNAMES_darkviolet;
-    if (value == "deeppink") return COLORNAMES_deeppink;
-    if (value == "deepskyblue") return COLORNAMES_deepskyblue;
-    if (value == "dimgray") return COLORNAMES_dimgray;
-    if (value == "dimgrey") return COLORNAMES_dimgrey;
-    if (value == "dodgerblue") return COLORNAMES_dodgerblue;
-    if (value == "firebrick") return COLORNAMES_firebrick;
-    if (value == "floralwhite") return COLORNAMES_floralwhite;
-    if (value == "forestgreen") return COLORNAMES_forestgreen;
-    if (value == "fuchsia") return COLORNAMES_fuchsia;
-    if (value == "gainsboro") return COLORNAMES_gainsboro;
-    if (value == "ghostwhite") return COLORNAMES_ghostwhite;
-    if (value == "gold") return COLORNAMES_gold;
-    if (value == "goldenrod") return COLORNAMES_goldenrod;
-    if (value == "gray") return COLORNAMES_gray;
-    if (value == "green") return COLORNAMES_green;
-    if (value == "greenyellow") return COLORNAMES_greenyellow;
-    if (value == "grey") return COLORNAMES_grey;
-    if (value == "honeydew") return COLORNAMES_honeydew;
-    if (value == "hotpink") return COLORNAMES_hotpink;
-    if (value == "indianred") return COLORNAMES_indianred;
-    if (value == "indigo") return COLORNAMES_indigo;
-    if (value == "ivory") return COLORNAMES_ivory;
-    if (value == "khaki") return COLORNAMES_khaki;
-    if (value == "lavender") return COLORNAMES_lavender;
-    if (value == "lavenderblush") return COLORNAMES_lavenderblush;
-    if (value == "lawngreen") return COLORNAMES_lawngreen;
-    if (value == "lemonchiffon") return COLORNAMES_lemonchiffon;
-    if (value == "lightblue") return COLORNAMES_lightblue;
-    if (value == "lightcoral") return COLORNAMES_lightcoral;
-    if (value == "lightcyan") return COLORNAMES_lightcyan;
-    if (value == "lightgoldenrodyellow") return COLORNAMES_lightgoldenrodyellow;
-    if (value == "lightgray") return COLORNAMES_lightgray;
-    if (value == "lightgreen") return COLORNAMES_lightgreen;
-    if (value == "lightgrey") return COLORNAMES_lightgrey;
-    if (value == "lightpink") return COLORNAMES_lightpink;
-    if (value == "lightsalmon") return COLORNAMES_lightsalmon;
-    if (value == "lightseagreen") return COLORNAMES_lightseagreen;
-    if (value == "lightskyblue") return COLORNAMES_lightskyblue;
-    if (value == "lightslategray") return COLORNAMES_lightslategray;
-    if (value == "lightslategrey") return COLORNAMES_lightslategrey;
-    if (value == "lightsteelblue") return COLORNAMES_lightsteelblue;
-    if (value == "lightyellow") return COLORNAMES_lightyellow;
-    if (value == "lime") return COLORNAMES_lime;
-    if (value == "limegreen") return COLORNAMES_limegreen;
-    if (value == "linen") return COLORNAMES_linen;
-    if (value == "magenta") return COLORNAMES_magenta;
-    if (value == "maroon") return COLORNAMES_maroon;
-    if (value == "mediumaquamarine") return COLORNAMES_mediumaquamarine;
-    if (value == "mediumblue") return COLORNAMES_mediumblue;
-    if (value == "mediumorchid") return COLORNAMES_mediumorchid;
-    if (value == "mediumpurple") return COLORNAMES_mediumpurple;
-    if (value == "mediumseagreen") return COLORNAMES_mediumseagreen;
-    if (value == "mediumslateblue") return COLORNAMES_mediumslateblue;
-    if (value == "mediumspringgreen") return COLORNAMES_mediumspringgreen;
-    if (value == "mediumturquoise") return COLORNAMES_mediumturquoise;
-    if (value == "mediumvioletred") return COLORNAMES_mediumvioletred;
-    if (value == "midnightblue") return COLORNAMES_midnightblue;
-    if (value == "mintcream") return COLORNAMES_mintcream;
-    if (value == "mistyrose") return COLORNAMES_mistyrose;
-    if (value == "moccasin") return COLORNAMES_moccasin;
-    if (value == "navajowhite") return COLORNAMES_navajowhite;
-    if (value == "navy") return COLORNAMES_navy;
-    if (value == "oldlace") return COLORNAMES_oldlace;
-    if (value == "olive") return COLORNAMES_olive;
-    if (value == "olivedrab") return COLORNAMES_olivedrab;
-    if (value == "orange") return COLORNAMES_orange;
-    if (value == "orangered") return COLORNAMES_orangered;
-    if (value == "orchid") return COLORNAMES_orchid;
-    if (value == "palegoldenrod") return COLORNAMES_palegoldenrod;
-    if (value == "palegreen") return COLORNAMES_palegreen;
-    if (value == "paleturquoise") return COLORNAMES_paleturquoise;
-    if (value == "palevioletred") return COLORNAMES_palevioletred;
-    if (value == "papayawhip") return COLORNAMES_papayawhip;
-    if (value == "peachpuff") return COLORNAMES_peachpuff;
-    if (value == "peru") return COLORNAMES_peru;
-    if (value == "pink") return COLORNAMES_pink;
-    if (value == "plum") return COLORNAMES_plum;
-    if (value == "powderblue") return COLORNAMES_powderblue;
-    if (value == "purple") return COLORNAMES_purple;
-    if (value == "rebeccapurple") return COLORNAMES_rebeccapurple;
-    if (value == "red") return COLORNAMES_red;
-    if (value == "rosybrown") return COLORNAMES_rosybrown;
-    if (value == "royalblue") return COLORNAMES_royalblue;
-    if (value == "saddlebrown") return COLORNAMES_saddlebrown;
-    if (value == "salmon") return COLORNAMES_salmon;
-    if (value == "sandybrown") return COLORNAMES_sandybrown;
-    if (value == "seagreen") return COLORNAMES_seagreen;
-    if (value == "seashell") return COLORNAMES_seashell;
-    if (value == "sienna") return COLORNAMES_sienna;
-    if (value == "silver") return COLORNAMES_silver;
-    if (value == "skyblue") return COLORNAMES_skyblue;
-    if (value == "slateblue") return COLORNAMES_slateblue;
-    if (value == "slategray") return COLORNAMES_slategray;
-    if (value == "slategrey") return COLORNAMES_slategrey;
-    if (value == "snow") return COLORNAMES_snow;
-    if (value == "springgreen") return COLORNAMES_springgreen;
-    if (value == "steelblue") return COLORNAMES_steelblue;
-    if (value == "tan") return COLORNAMES_tan;
-    if (value == "teal") return COLORNAMES_teal;
-    if (value == "thistle") return COLORNAMES_thistle;
-    if (value == "tomato") return COLORNAMES_tomato;
-    if (value == "turquoise") return COLORNAMES_turquoise;
-    if (value == "violet") return COLORNAMES_violet;
-    if (value == "wheat") return COLORNAMES_wheat;
-    if (value == "white") return COLORNAMES_white;
-    if (value == "whitesmoke") return COLORNAMES_whitesmoke;
-    if (value == "yellow") return COLORNAMES_yellow;
-    if (value == "yellowgreen") return COLORNAMES_yellowgreen;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COLORNAMES", value.c_str());
+    static constexpr const char *values[COLORNAMES_MAX] = {
+        "", "aliceblue", "antiquewhite", "aqua", "aquamarine", "azure", "beige", "bisque", "black", "blanchedalmond",
+        "blue", "blueviolet", "brown", "burlywood", "cadetblue", "chartreuse", "chocolate", "coral", "cornflowerblue",
+        "cornsilk", "crimson", "cyan", "darkblue", "darkcyan", "darkgoldenrod", "darkgray", "darkgreen", "darkgrey",
+        "darkkhaki", "darkmagenta", "darkolivegreen", "darkorange", "darkorchid", "darkred", "darksalmon",
+        "darkseagreen", "darkslateblue", "darkslategray", "darkslategrey", "darkturquoise", "darkviolet", "deeppink",
+        "deepskyblue", "dimgray", "dimgrey", "dodgerblue", "firebrick", "floralwhite", "forestgreen", "fuchsia",
+        "gainsboro", "ghostwhite", "gold", "goldenrod", "gray", "green", "greenyellow", "grey", "honeydew", "hotpink",
+        "indianred", "indigo", "ivory", "khaki", "lavender", "lavenderblush", "lawngreen", "lemonchiffon", "lightblue",
+        "lightcoral", "lightcyan", "lightgoldenrodyellow", "lightgray", "lightgreen", "lightgrey", "lightpink",
+        "lightsalmon", "lightseagreen", "lightskyblue", "lightslategray", "lightslategrey", "lightsteelblue",
+        "lightyellow", "lime", "limegreen", "linen", "magenta", "maroon", "mediumaquamarine", "mediumblue",
+        "mediumorchid", "mediumpurple", "mediumseagreen", "mediumslateblue", "mediumspringgreen", "mediumturquoise",
+        "mediumvioletred", "midnightblue", "mintcream", "mistyrose", "moccasin", "navajowhite", "navy", "oldlace",
+        "olive", "olivedrab", "orange", "orangered", "orchid", "palegoldenrod", "palegreen", "paleturquoise",
+        "palevioletred", "papayawhip", "peachpuff", "peru", "pink", "plum", "powderblue", "purple", "rebeccapurple",
+        "red", "rosybrown", "royalblue", "saddlebrown", "salmon", "sandybrown", "seagreen", "seashell", "sienna",
+        "silver", "skyblue", "slateblue", "slategray", "slategrey", "snow", "springgreen", "steelblue", "tan", "teal",
+        "thistle", "tomato", "turquoise", "violet", "wheat", "white", "whitesmoke", "yellow", "yellowgreen"
+    };
+    if ((data <= COLORNAMES_NONE) || (data >= COLORNAMES_MAX)) {
+        LogWarning("Unknown value '%d' for data.COLORNAMES", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_COLORNAMES AttConverter::StrToColornames(const std::string &value, bool logWarning) const
+{
+    return StrToColornames(value.c_str(), logWarning);
+}
+
+data_COLORNAMES AttConverter::StrToColornames(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_COLORNAMES> table[256] = {
+        { "greenyellow", COLORNAMES_greenyellow }, { "royalblue", COLORNAMES_royalblue },
+        { "chocolate", COLORNAMES_chocolate }, { "cadetblue", COLORNAMES_cadetblue },
+        { "midnightblue", COLORNAMES_midnightblue }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "peru", COLORNAMES_peru }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "darkgreen", COLORNAMES_darkgreen }, { "darkorange", COLORNAMES_darkorange },
+        { "slategray", COLORNAMES_slategray }, { "", COLORNAMES_NONE }, { "darkslategray", COLORNAMES_darkslategray },
+        { "lightskyblue", COLORNAMES_lightskyblue }, { "rosybrown", COLORNAMES_rosybrown },
+        { "mediumpurple", COLORNAMES_mediumpurple }, { "", COLORNAMES_NONE }, { "teal", COLORNAMES_teal },
+        { "", COLORNAMES_NONE }, { "lavenderblush", COLORNAMES_lavenderblush }, { "", COLORNAMES_NONE },
+        { "pink", COLORNAMES_pink }, { "mediumblue", COLORNAMES_mediumblue }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "gold", COLORNAMES_gold }, { "deepskyblue", COLORNAMES_deepskyblue },
+        { "mistyrose", COLORNAMES_mistyrose }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "lavender", COLORNAMES_lavender }, { "antiquewhite", COLORNAMES_antiquewhite },
+        { "darkred", COLORNAMES_darkred }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "tomato", COLORNAMES_tomato }, { "dimgrey", COLORNAMES_dimgrey }, { "", COLORNAMES_NONE },
+        { "darkturquoise", COLORNAMES_darkturquoise }, { "hotpink", COLORNAMES_hotpink }, { "", COLORNAMES_NONE },
+        { "navy", COLORNAMES_navy }, { "turquoise", COLORNAMES_turquoise }, { "moccasin", COLORNAMES_moccasin },
+        { "blue", COLORNAMES_blue }, { "sandybrown", COLORNAMES_sandybrown }, { "", COLORNAMES_NONE },
+        { "mediumspringgreen", COLORNAMES_mediumspringgreen }, { "seashell", COLORNAMES_seashell },
+        { "steelblue", COLORNAMES_steelblue }, { "", COLORNAMES_NONE }, { "azure", COLORNAMES_azure },
+        { "forestgreen", COLORNAMES_forestgreen }, { "", COLORNAMES_NONE }, { "lightcyan", COLORNAMES_lightcyan },
+        { "", COLORNAMES_NONE }, { "wheat", COLORNAMES_wheat }, { "deeppink", COLORNAMES_deeppink },
+        { "darkseagreen", COLORNAMES_darkseagreen }, { "indianred", COLORNAMES_indianred },
+        { "darksalmon", COLORNAMES_darksalmon }, { "lightgray", COLORNAMES_lightgray },
+        { "mintcream", COLORNAMES_mintcream }, { "mediumturquoise", COLORNAMES_mediumturquoise },
+        { "mediumaquamarine", COLORNAMES_mediumaquamarine }, { "seagreen", COLORNAMES_seagreen },
+        { "darkolivegreen", COLORNAMES_darkolivegreen }, { "burlywood", COLORNAMES_burlywood }, { "", COLORNAMES_NONE },
+        { "slategrey", COLORNAMES_slategrey }, { "lightblue", COLORNAMES_lightblue }, { "sienna", COLORNAMES_sienna },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "blanchedalmond", COLORNAMES_blanchedalmond }, { "lightpink", COLORNAMES_lightpink },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "floralwhite", COLORNAMES_floralwhite }, { "", COLORNAMES_NONE }, { "darkgray", COLORNAMES_darkgray },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "navajowhite", COLORNAMES_navajowhite },
+        { "", COLORNAMES_NONE }, { "cyan", COLORNAMES_cyan }, { "", COLORNAMES_NONE }, { "linen", COLORNAMES_linen },
+        { "", COLORNAMES_NONE }, { "mediumvioletred", COLORNAMES_mediumvioletred }, { "darkcyan", COLORNAMES_darkcyan },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "mediumslateblue", COLORNAMES_mediumslateblue },
+        { "", COLORNAMES_NONE }, { "lightsalmon", COLORNAMES_lightsalmon },
+        { "palegoldenrod", COLORNAMES_palegoldenrod }, { "", COLORNAMES_NONE },
+        { "lightslategray", COLORNAMES_lightslategray }, { "", COLORNAMES_NONE }, { "orange", COLORNAMES_orange },
+        { "dodgerblue", COLORNAMES_dodgerblue }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "lawngreen", COLORNAMES_lawngreen }, { "", COLORNAMES_NONE },
+        { "saddlebrown", COLORNAMES_saddlebrown }, { "", COLORNAMES_NONE }, { "brown", COLORNAMES_brown },
+        { "aquamarine", COLORNAMES_aquamarine }, { "", COLORNAMES_NONE }, { "bisque", COLORNAMES_bisque },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "snow", COLORNAMES_snow }, { "darkslateblue", COLORNAMES_darkslateblue },
+        { "papayawhip", COLORNAMES_papayawhip }, { "", COLORNAMES_NONE }, { "plum", COLORNAMES_plum },
+        { "tan", COLORNAMES_tan }, { "", COLORNAMES_NONE }, { "darkviolet", COLORNAMES_darkviolet },
+        { "darkblue", COLORNAMES_darkblue }, { "", COLORNAMES_NONE }, { "springgreen", COLORNAMES_springgreen },
+        { "", COLORNAMES_NONE }, { "crimson", COLORNAMES_crimson }, { "white", COLORNAMES_white },
+        { "olive", COLORNAMES_olive }, { "lime", COLORNAMES_lime }, { "cornflowerblue", COLORNAMES_cornflowerblue },
+        { "", COLORNAMES_NONE }, { "purple", COLORNAMES_purple }, { "darkkhaki", COLORNAMES_darkkhaki },
+        { "beige", COLORNAMES_beige }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "lightgrey", COLORNAMES_lightgrey }, { "maroon", COLORNAMES_maroon }, { "", COLORNAMES_NONE },
+        { "powderblue", COLORNAMES_powderblue }, { "slateblue", COLORNAMES_slateblue }, { "grey", COLORNAMES_grey },
+        { "", COLORNAMES_NONE }, { "lightsteelblue", COLORNAMES_lightsteelblue }, { "", COLORNAMES_NONE },
+        { "mediumorchid", COLORNAMES_mediumorchid }, { "", COLORNAMES_NONE }, { "coral", COLORNAMES_coral },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "firebrick", COLORNAMES_firebrick },
+        { "darkslategrey", COLORNAMES_darkslategrey }, { "thistle", COLORNAMES_thistle }, { "", COLORNAMES_NONE },
+        { "ivory", COLORNAMES_ivory }, { "yellowgreen", COLORNAMES_yellowgreen }, { "limegreen", COLORNAMES_limegreen },
+        { "green", COLORNAMES_green }, { "fuchsia", COLORNAMES_fuchsia }, { "", COLORNAMES_NONE },
+        { "lightslategrey", COLORNAMES_lightslategrey }, { "", COLORNAMES_NONE }, { "palegreen", COLORNAMES_palegreen },
+        { "", COLORNAMES_NONE }, { "oldlace", COLORNAMES_oldlace }, { "darkgrey", COLORNAMES_darkgrey },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "orangered", COLORNAMES_orangered },
+        { "lightgoldenrodyellow", COLORNAMES_lightgoldenrodyellow }, { "", COLORNAMES_NONE },
+        { "goldenrod", COLORNAMES_goldenrod }, { "yellow", COLORNAMES_yellow }, { "ghostwhite", COLORNAMES_ghostwhite },
+        { "paleturquoise", COLORNAMES_paleturquoise }, { "gray", COLORNAMES_gray }, { "khaki", COLORNAMES_khaki },
+        { "honeydew", COLORNAMES_honeydew }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "indigo", COLORNAMES_indigo }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "lightcoral", COLORNAMES_lightcoral }, { "lightyellow", COLORNAMES_lightyellow }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "cornsilk", COLORNAMES_cornsilk }, { "", COLORNAMES_NONE }, { "dimgray", COLORNAMES_dimgray },
+        { "aqua", COLORNAMES_aqua }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "blueviolet", COLORNAMES_blueviolet }, { "orchid", COLORNAMES_orchid }, { "skyblue", COLORNAMES_skyblue },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "rebeccapurple", COLORNAMES_rebeccapurple },
+        { "", COLORNAMES_NONE }, { "olivedrab", COLORNAMES_olivedrab }, { "", COLORNAMES_NONE },
+        { "lightseagreen", COLORNAMES_lightseagreen }, { "whitesmoke", COLORNAMES_whitesmoke }, { "", COLORNAMES_NONE },
+        { "black", COLORNAMES_black }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "darkmagenta", COLORNAMES_darkmagenta }, { "aliceblue", COLORNAMES_aliceblue },
+        { "silver", COLORNAMES_silver }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "magenta", COLORNAMES_magenta }, { "darkorchid", COLORNAMES_darkorchid },
+        { "peachpuff", COLORNAMES_peachpuff }, { "chartreuse", COLORNAMES_chartreuse },
+        { "gainsboro", COLORNAMES_gainsboro }, { "palevioletred", COLORNAMES_palevioletred },
+        { "lemonchiffon", COLORNAMES_lemonchiffon }, { "salmon", COLORNAMES_salmon }, { "violet", COLORNAMES_violet },
+        { "", COLORNAMES_NONE }, { "red", COLORNAMES_red }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "darkgoldenrod", COLORNAMES_darkgoldenrod }, { "lightgreen", COLORNAMES_lightgreen },
+        { "mediumseagreen", COLORNAMES_mediumseagreen }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE },
+        { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }, { "", COLORNAMES_NONE }
+    };
+    static constexpr uint16_t seeds[64] = {
+        1, 1, 0, 2, 2, 1, 1, 1, 1, 1, 4, 0, 0, 0, 1, 2, 0, 1, 0, 1, 1, 0, 0, 0, 3, 9, 2, 1, 2, 1, 0, 1, 0, 1, 1, 0, 2,
+        0, 0, 4, 1, 0, 1, 1, 2, 0, 0, 2, 3, 1, 8, 1, 6, 8, 2, 2, 1, 0, 0, 4, 0, 6, 1, 3
+    };
+    const uint16_t seed = seeds[HashToken(value, 0) & 63];
+    const auto &entry = table[HashToken(value, seed) & 255];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.COLORNAMES", value);
     return COLORNAMES_NONE;
 }
 
 std::string AttConverter::CompassdirectionToStr(data_COMPASSDIRECTION data) const
 {
-    std::string value;
-    switch (data) {
-        case COMPASSDIRECTION_n: value = "n"; break;
-        case COMPASSDIRECTION_e: value = "e"; break;
-        case COMPASSDIRECTION_s: value = "s"; break;
-        case COMPASSDIRECTION_w: value = "w"; break;
-        case COMPASSDIRECTION_ne: value = "ne"; break;
-        case COMPASSDIRECTION_nw: value = "nw"; break;
-        case COMPASSDIRECTION_se: value = "se"; break;
-        case COMPASSDIRECTION_sw: value = "sw"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.COMPASSDIRECTION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_COMPASSDIRECTION AttConverter::StrToCompassdirection(std::string value, bool logWarning) const
-{
-    if (value == "n") return COMPASSDIRECTION_n;
-    if (value == "e") return COMPASSDIRECTION_e;
-    if (value == "s") return COMPASSDIRECTION_s;
-    if (value == "w") return COMPASSDIRECTION_w;
-    if (value == "ne") return COMPASSDIRECTION_ne;
-    if (value == "nw") return COMPASSDIRECTION_nw;
-    if (value == "se") return COMPASSDIRECTION_se;
-    if (value == "sw") return COMPASSDIRECTION_sw;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION", value.c_str());
+    static constexpr const char *values[COMPASSDIRECTION_MAX] = { "", "n", "e", "s", "w", "ne", "nw", "se", "sw" };
+    if ((data <= COMPASSDIRECTION_NONE) || (data >= COMPASSDIRECTION_MAX)) {
+        LogWarning("Unknown value '%d' for data.COMPASSDIRECTION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_COMPASSDIRECTION AttConverter::StrToCompassdirection(const std::string &value, bool logWarning) const
+{
+    return StrToCompassdirection(value.c_str(), logWarning);
+}
+
+data_COMPASSDIRECTION AttConverter::StrToCompassdirection(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_COMPASSDIRECTION> table[8] = {
+        { "s", COMPASSDIRECTION_s }, { "se", COMPASSDIRECTION_se }, { "e", COMPASSDIRECTION_e },
+        { "ne", COMPASSDIRECTION_ne }, { "w", COMPASSDIRECTION_w }, { "nw", COMPASSDIRECTION_nw },
+        { "sw", COMPASSDIRECTION_sw }, { "n", COMPASSDIRECTION_n }
+    };
+    static constexpr uint16_t seeds[4] = { 2, 10, 2, 13 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION", value);
     return COMPASSDIRECTION_NONE;
 }
 
 std::string AttConverter::CompassdirectionBasicToStr(data_COMPASSDIRECTION_basic data) const
 {
-    std::string value;
-    switch (data) {
-        case COMPASSDIRECTION_basic_n: value = "n"; break;
-        case COMPASSDIRECTION_basic_e: value = "e"; break;
-        case COMPASSDIRECTION_basic_s: value = "s"; break;
-        case COMPASSDIRECTION_basic_w: value = "w"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.COMPASSDIRECTION.basic", data);
-            value = "";
-            break;
+    static constexpr const char *values[COMPASSDIRECTION_basic_MAX] = { "", "n", "e", "s", "w" };
+    if ((data <= COMPASSDIRECTION_basic_NONE) || (data >= COMPASSDIRECTION_basic_MAX)) {
+        LogWarning("Unknown value '%d' for data.COMPASSDIRECTION.basic", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_COMPASSDIRECTION_basic AttConverter::StrToCompassdirectionBasic(std::string value, bool logWarning) const
+data_COMPASSDIRECTION_basic AttConverter::StrToCompassdirectionBasic(const std::string &value, bool logWarning) const
 {
-    if (value == "n") return COMPASSDIRECTION_basic_n;
-    if (value == "e") return COMPASSDIRECTION_basic_e;
-    if (value == "s") return COMPASSDIRECTION_basic_s;
-    if (value == "w") return COMPASSDIRECTION_basic_w;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.basic", value.c_str());
+    return StrToCompassdirectionBasic(value.c_str(), logWarning);
+}
+
+data_COMPASSDIRECTION_basic AttConverter::StrToCompassdirectionBasic(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_COMPASSDIRECTION_basic> table[4] = {
+        { "s", COMPASSDIRECTION_basic_s }, { "n", COMPASSDIRECTION_basic_n }, { "e", COMPASSDIRECTION_basic_e },
+        { "w", COMPASSDIRECTION_basic_w }
+    };
+    static constexpr uint16_t seeds[2] = { 58, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.basic", value);
     return COMPASSDIRECTION_basic_NONE;
 }
 
 std::string AttConverter::CompassdirectionExtendedToStr(data_COMPASSDIRECTION_extended data) const
 {
-    std::string value;
-    switch (data) {
-        case COMPASSDIRECTION_extended_ne: value = "ne"; break;
-        case COMPASSDIRECTION_extended_nw: value = "nw"; break;
-        case COMPASSDIRECTION_extended_se: value = "se"; break;
-        case COMPASSDIRECTION_extended_sw: value = "sw"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.COMPASSDIRECTION.extended", data);
-            value = "";
-            break;
+    static constexpr const char *values[COMPASSDIRECTION_extended_MAX] = { "", "ne", "nw", "se", "sw" };
+    if ((data <= COMPASSDIRECTION_extended_NONE) || (data >= COMPASSDIRECTION_extended_MAX)) {
+        LogWarning("Unknown value '%d' for data.COMPASSDIRECTION.extended", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_COMPASSDIRECTION_extended AttConverter::StrToCompassdirectionExtended(
+    const std::string &value, bool logWarning) const
+{
+    return StrToCompassdirectionExtended(value.c_str(), logWarning);
 }
 
-data_COMPASSDIRECTION_extended AttConverter::StrToCompassdirectionExtended(std::string value, bool logWarning) const
+data_COMPASSDIRECTION_extended AttConverter::StrToCompassdirectionExtended(const char *value, bool logWarning) const
 {
-    if (value == "ne") return COMPASSDIRECTION_extended_ne;
-    if (value == "nw") return COMPASSDIRECTION_extended_nw;
-    if (value == "se") return COMPASSDIRECTION_extended_se;
-    if (value == "sw") return COMPASSDIRECTION_extended_sw;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.extended", value.c_str());
+    static constexpr std::pair<const char *, data_COMPASSDIRECTION_extended> table[4] = {
+        { "nw", COMPASSDIRECTION_extended_nw }, { "sw", COMPASSDIRECTION_extended_sw },
+        { "ne", COMPASSDIRECTION_extended_ne }, { "se", COMPASSDIRECTION_extended_se }
+    };
+    static constexpr uint16_t seeds[2] = { 0, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.extended", value);
     return COMPASSDIRECTION_extended_NONE;
 }
 
 std::string AttConverter::EnclosureToStr(data_ENCLOSURE data) const
 {
-    std::string value;
-    switch (data) {
-        case ENCLOSURE_paren: value = "paren"; break;
-        case ENCLOSURE_brack: value = "brack"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.ENCLOSURE", data);
-            value = "";
-            break;
+    static constexpr const char *values[ENCLOSURE_MAX] = { "", "paren", "brack" };
+    if ((data <= ENCLOSURE_NONE) || (data >= ENCLOSURE_MAX)) {
+        LogWarning("Unknown value '%d' for data.ENCLOSURE", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_ENCLOSURE AttConverter::StrToEnclosure(const std::string &value, bool logWarning) const
+{
+    return StrToEnclosure(value.c_str(), logWarning);
 }
 
-data_ENCLOSURE AttConverter::StrToEnclosure(std::string value, bool logWarning) const
+data_ENCLOSURE AttConverter::StrToEnclosure(const char *value, bool logWarning) const
 {
-    if (value == "paren") return ENCLOSURE_paren;
-    if (value == "brack") return ENCLOSURE_brack;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ENCLOSURE", value.c_str());
+    static constexpr std::pair<const char *, data_ENCLOSURE> table[2] = {
+        { "paren", ENCLOSURE_paren }, { "brack", ENCLOSURE_brack }
+    };
+    const auto &entry = table[HashToken(value, 1) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.ENCLOSURE", value);
     return ENCLOSURE_NONE;
 }
 
 std::string AttConverter::EventrelToStr(data_EVENTREL data) const
 {
-    std::string value;
-    switch (data) {
-        case EVENTREL_above: value = "above"; break;
-        case EVENTREL_below: value = "below"; break;
-        case EVENTREL_left: value = "left"; break;
-        case EVENTREL_right: value = "right"; break;
-        case EVENTREL_above_left: value = "above-left"; break;
-        case EVENTREL_above_right: value = "above-right"; break;
-        case EVENTREL_below_left: value = "below-left"; break;
-        case EVENTREL_below_right: value = "below-right"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.EVENTREL", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_EVENTREL AttConverter::StrToEventrel(std::string value, bool logWarning) const
-{
-    if (value == "above") return EVENTREL_above;
-    if (value == "below") return EVENTREL_below;
-    if (value == "left") return EVENTREL_left;
-    if (value == "right") return EVENTREL_right;
-    if (value == "above-left") return EVENTREL_above_left;
-    if (value == "above-right") return EVENTREL_above_right;
-    if (value == "below-left") return EVENTREL_below_left;
-    if (value == "below-right") return EVENTREL_below_right;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.EVENTREL", value.c_str());
+    static constexpr const char *values[EVENTREL_MAX] = {
+        "", "above", "below", "left", "right", "above-left", "above-right", "below-left", "below-right"
+    };
+    if ((data <= EVENTREL_NONE) || (data >= EVENTREL_MAX)) {
+        LogWarning("Unknown value '%d' for data.EVENTREL", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_EVENTREL AttConverter::StrToEventrel(const std::string &value, bool logWarning) const
+{
+    return StrToEventrel(value.c_str(), logWarning);
+}
+
+data_EVENTREL AttConverter::StrToEventrel(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_EVENTREL> table[8] = {
+        { "left", EVENTREL_left }, { "above-right", EVENTREL_above_right }, { "above-left", EVENTREL_above_left },
+        { "right", EVENTREL_right }, { "below", EVENTREL_below }, { "above", EVENTREL_above },
+        { "below-right", EVENTREL_below_right }, { "below-left", EVENTREL_below_left }
+    };
+    static constexpr uint16_t seeds[4] = { 1, 3, 5, 1 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.EVENTREL", value);
     return EVENTREL_NONE;
 }
 
 std::string AttConverter::EventrelBasicToStr(data_EVENTREL_basic data) const
 {
-    std::string value;
-    switch (data) {
-        case EVENTREL_basic_above: value = "above"; break;
-        case EVENTREL_basic_below: value = "below"; break;
-        case EVENTREL_basic_left: value = "left"; break;
-        case EVENTREL_basic_right: value = "right"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.EVENTREL.basic", data);
-            value = "";
-            break;
+    static constexpr const char *values[EVENTREL_basic_MAX] = { "", "above", "below", "left", "right" };
+    if ((data <= EVENTREL_basic_NONE) || (data >= EVENTREL_basic_MAX)) {
+        LogWarning("Unknown value '%d' for data.EVENTREL.basic", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_EVENTREL_basic AttConverter::StrToEventrelBasic(std::string value, bool logWarning) const
+data_EVENTREL_basic AttConverter::StrToEventrelBasic(const std::string &value, bool logWarning) const
 {
-    if (value == "above") return EVENTREL_basic_above;
-    if (value == "below") return EVENTREL_basic_below;
-    if (value == "left") return EVENTREL_basic_left;
-    if (value == "right") return EVENTREL_basic_right;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.EVENTREL.basic", value.c_str());
+    return StrToEventrelBasic(value.c_str(), logWarning);
+}
+
+data_EVENTREL_basic AttConverter::StrToEventrelBasic(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_EVENTREL_basic> table[4] = {
+        { "right", EVENTREL_basic_right }, { "below", EVENTREL_basic_below }, { "above", EVENTREL_basic_above },
+        { "left", EVENTREL_basic_left }
+    };
+    static constexpr uint16_t seeds[2] = { 4, 16 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.EVENTREL.basic", value);
     return EVENTREL_basic_NONE;
 }
 
 std::string AttConverter::EventrelExtendedToStr(data_EVENTREL_extended data) const
 {
-    std::string value;
-    switch (data) {
-        case EVENTREL_extended_above_left: value = "above-left"; break;
-        case EVENTREL_extended_above_right: value = "above-right"; break;
-        case EVENTREL_extended_below_left: value = "below-left"; break;
-        case EVENTREL_extended_below_right: value = "below-right"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.EVENTREL.extended", data);
-            value = "";
-            break;
+    static constexpr const char *values[EVENTREL_extended_MAX] = {
+        "", "above-left", "above-right", "below-left", "below-right"
+    };
+    if ((data <= EVENTREL_extended_NONE) || (data >= EVENTREL_extended_MAX)) {
+        LogWarning("Unknown value '%d' for data.EVENTREL.extended", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_EVENTREL_extended AttConverter::StrToEventrelExtended(const std::string &value, bool logWarning) const
+{
+    return StrToEventrelExtended(value.c_str(), logWarning);
 }
 
-data_EVENTREL_extended AttConverter::StrToEventrelExtended(std::string value, bool logWarning) const
+data_EVENTREL_extended AttConverter::StrToEventrelExtended(const char *value, bool logWarning) const
 {
-    if (value == "above-left") return EVENTREL_extended_above_left;
-    if (value == "above-right") return EVENTREL_extended_above_right;
-    if (value == "below-left") return EVENTREL_extended_below_left;
-    if (value == "below-right") return EVENTREL_extended_below_right;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.EVENTREL.extended", value.c_str());
+    static constexpr std::pair<const char *, data_EVENTREL_extended> table[4] = {
+        { "above-right", EVENTREL_extended_above_right }, { "above-left", EVENTREL_extended_above_left },
+        { "below-right", EVENTREL_extended_below_right }, { "below-left", EVENTREL_extended_below_left }
+    };
+    static constexpr uint16_t seeds[2] = { 7, 6 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.EVENTREL.extended", value);
     return EVENTREL_extended_NONE;
 }
 
 std::string AttConverter::FillToStr(data_FILL data) const
 {
-    std::string value;
-    switch (data) {
-        case FILL_void: value = "void"; break;
-        case FILL_solid: value = "solid"; break;
-        case FILL_top: value = "top"; break;
-        case FILL_bottom: value = "bottom"; break;
-        case FILL_left: value = "left"; break;
-        case FILL_right: value = "right"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.FILL", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_FILL AttConverter::StrToFill(std::string value, bool logWarning) const
-{
-    if (value == "void") return FILL_void;
-    if (value == "solid") return FILL_solid;
-    if (value == "top") return FILL_top;
-    if (value == "bottom") return FILL_bottom;
-    if (value == "left") return FILL_left;
-    if (value == "right") return FILL_right;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FILL", value.c_str());
+    static constexpr const char *values[FILL_MAX] = { "", "void", "solid", "top", "bottom", "left", "right" };
+    if ((data <= FILL_NONE) || (data >= FILL_MAX)) {
+        LogWarning("Unknown value '%d' for data.FILL", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_FILL AttConverter::StrToFill(const std::string &value, bool logWarning) const
+{
+    return StrToFill(value.c_str(), logWarning);
+}
+
+data_FILL AttConverter::StrToFill(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_FILL> table[8] = {
+        { "void", FILL_void }, { "", FILL_NONE }, { "solid", FILL_solid }, { "left", FILL_left }, { "", FILL_NONE },
+        { "right", FILL_right }, { "top", FILL_top }, { "bottom", FILL_bottom }
+    };
+    static constexpr uint16_t seeds[2] = { 11, 9 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.FILL", value);
     return FILL_NONE;
 }
 
 std::string AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
 {
-    std::string value;
-    switch (data) {
-        case FONTSIZETERM_xx_small: value = "xx-small"; break;
-        case FONTSIZETERM_x_small: value = "x-small"; break;
-        case FONTSIZETERM_small: value = "small"; break;
-        case FONTSIZETERM_normal: value = "normal"; break;
-        case FONTSIZETERM_large: value = "large"; break;
-        case FONTSIZETERM_x_large: value = "x-large"; break;
-        case FONTSIZETERM_xx_large: value = "xx-large"; break;
-        case FONTSIZETERM_smaller: value = "smaller"; break;
-        case FONTSIZETERM_larger: value = "larger"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.FONTSIZETERM", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string value, bool logWarning) const
-{
-    if (value == "xx-small") return FONTSIZETERM_xx_small;
-    if (value == "x-small") return FONTSIZETERM_x_small;
-    if (value == "small") return FONTSIZETERM_small;
-    if (value == "normal") return FONTSIZETERM_normal;
-    if (value == "large") return FONTSIZETERM_large;
-    if (value == "x-large") return FONTSIZETERM_x_large;
-    if (value == "xx-large") return FONTSIZETERM_xx_large;
-    if (value == "smaller") return FONTSIZETERM_smaller;
-    if (value == "larger") return FONTSIZETERM_larger;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value.c_str());
+    static constexpr const char *values[FONTSIZETERM_MAX] = {
+        "", "xx-small", "x-small", "small", "normal", "large", "x-large", "xx-large", "smaller", "larger"
+    };
+    if ((data <= FONTSIZETERM_NONE) || (data >= FONTSIZETERM_MAX)) {
+        LogWarning("Unknown value '%d' for data.FONTSIZETERM", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_FONTSIZETERM AttConverter::StrToFontsizeterm(const std::string &value, bool logWarning) const
+{
+    return StrToFontsizeterm(value.c_str(), logWarning);
+}
+
+data_FONTSIZETERM AttConverter::StrToFontsizeterm(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_FONTSIZETERM> table[16] = {
+        { "", FONTSIZETERM_NONE }, { "", FONTSIZETERM_NONE }, { "", FONTSIZETERM_NONE },
+        { "xx-large", FONTSIZETERM_xx_large }, { "small", FONTSIZETERM_small }, { "larger", FONTSIZETERM_larger },
+        { "", FONTSIZETERM_NONE }, { "large", FONTSIZETERM_large }, { "smaller", FONTSIZETERM_smaller },
+        { "normal", FONTSIZETERM_normal }, { "", FONTSIZETERM_NONE }, { "x-large", FONTSIZETERM_x_large },
+        { "", FONTSIZETERM_NONE }, { "x-small", FONTSIZETERM_x_small }, { "", FONTSIZETERM_NONE },
+        { "xx-small", FONTSIZETERM_xx_small }
+    };
+    static constexpr uint16_t seeds[4] = { 1, 1, 5, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value);
     return FONTSIZETERM_NONE;
 }
 
 std::string AttConverter::FontstyleToStr(data_FONTSTYLE data) const
 {
-    std::string value;
-    switch (data) {
-        case FONTSTYLE_italic: value = "italic"; break;
-        case FONTSTYLE_normal: value = "normal"; break;
-        case FONTSTYLE_oblique: value = "oblique"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.FONTSTYLE", data);
-            value = "";
-            break;
+    static constexpr const char *values[FONTSTYLE_MAX] = { "", "italic", "normal", "oblique" };
+    if ((data <= FONTSTYLE_NONE) || (data >= FONTSTYLE_MAX)) {
+        LogWarning("Unknown value '%d' for data.FONTSTYLE", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_FONTSTYLE AttConverter::StrToFontstyle(const std::string &value, bool logWarning) const
+{
+    return StrToFontstyle(value.c_str(), logWarning);
 }
 
-data_FONTSTYLE AttConverter::StrToFontstyle(std::string value, bool logWarning) const
+data_FONTSTYLE AttConverter::StrToFontstyle(const char *value, bool logWarning) const
 {
-    if (value == "italic") return FONTSTYLE_italic;
-    if (value == "normal") return FONTSTYLE_normal;
-    if (value == "oblique") return FONTSTYLE_oblique;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FONTSTYLE", value.c_str());
+    static constexpr std::pair<const char *, data_FONTSTYLE> table[4] = {
+        { "italic", FONTSTYLE_italic }, { "normal", FONTSTYLE_normal }, { "", FONTSTYLE_NONE },
+        { "oblique", FONTSTYLE_oblique }
+    };
+    const auto &entry = table[HashToken(value, 5) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.FONTSTYLE", value);
     return FONTSTYLE_NONE;
 }
 
 std::string AttConverter::FontweightToStr(data_FONTWEIGHT data) const
 {
-    std::string value;
-    switch (data) {
-        case FONTWEIGHT_bold: value = "bold"; break;
-        case FONTWEIGHT_normal: value = "normal"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.FONTWEIGHT", data);
-            value = "";
-            break;
+    static constexpr const char *values[FONTWEIGHT_MAX] = { "", "bold", "normal" };
+    if ((data <= FONTWEIGHT_NONE) || (data >= FONTWEIGHT_MAX)) {
+        LogWarning("Unknown value '%d' for data.FONTWEIGHT", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_FONTWEIGHT AttConverter::StrToFontweight(std::string value, bool logWarning) const
+data_FONTWEIGHT AttConverter::StrToFontweight(const std::string &value, bool logWarning) const
 {
-    if (value == "bold") return FONTWEIGHT_bold;
-    if (value == "normal") return FONTWEIGHT_normal;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value.c_str());
+    return StrToFontweight(value.c_str(), logWarning);
+}
+
+data_FONTWEIGHT AttConverter::StrToFontweight(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_FONTWEIGHT> table[2] = {
+        { "bold", FONTWEIGHT_bold }, { "normal", FONTWEIGHT_normal }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value);
     return FONTWEIGHT_NONE;
 }
 
 std::string AttConverter::FrbrrelationshipToStr(data_FRBRRELATIONSHIP data) const
 {
-    std::string value;
-    switch (data) {
-        case FRBRRELATIONSHIP_hasAbridgement: value = "hasAbridgement"; break;
-        case FRBRRELATIONSHIP_isAbridgementOf: value = "isAbridgementOf"; break;
-        case FRBRRELATIONSHIP_hasAdaptation: value = "hasAdaptation"; break;
-        case FRBRRELATIONSHIP_isAdaptationOf: value = "isAdaptationOf"; break;
-        case FRBRRELATIONSHIP_hasAlternate: value = "hasAlternate"; break;
-        case FRBRRELATIONSHIP_isAlternateOf: value = "isAlternateOf"; break;
-        case FRBRRELATIONSHIP_hasArrangement: value = "hasArrangement"; break;
-        case FRBRRELATIONSHIP_isArrangementOf: value = "isArrangementOf"; break;
-        case FRBRRELATIONSHIP_hasComplement: value = "hasComplement"; break;
-        case FRBRRELATIONSHIP_isComplementOf: value = "isComplementOf"; break;
-        case FRBRRELATIONSHIP_hasEmbodiment: value = "hasEmbodiment"; break;
-        case FRBRRELATIONSHIP_isEmbodimentOf: value = "isEmbodimentOf"; break;
-        case FRBRRELATIONSHIP_hasExemplar: value = "hasExemplar"; break;
-        case FRBRRELATIONSHIP_isExemplarOf: value = "isExemplarOf"; break;
-        case FRBRRELATIONSHIP_hasImitation: value = "hasImitation"; break;
-        case FRBRRELATIONSHIP_isImitationOf: value = "isImitationOf"; break;
-        case FRBRRELATIONSHIP_hasPart: value = "hasPart"; break;
-        case FRBRRELATIONSHIP_isPartOf: value = "isPartOf"; break;
-        case FRBRRELATIONSHIP_hasRealization: value = "hasRealization"; break;
-        case FRBRRELATIONSHIP_isRealizationOf: value = "isRealizationOf"; break;
-        case FRBRRELATIONSHIP_hasReconfiguration: value = "hasReconfiguration"; break;
-        case FRBRRELATIONSHIP_isReconfigurationOf: value = "isReconfigurationOf"; break;
-        case FRBRRELATIONSHIP_hasReproduction: value = "hasReproduction"; break;
-        case FRBRRELATIONSHIP_isReproductionOf: value = "isReproductionOf"; break;
-        case FRBRRELATIONSHIP_hasRevision: value = "hasRevision"; break;
-        case FRBRRELATIONSHIP_isRevisionOf: value = "isRevisionOf"; break;
-        case FRBRRELATIONSHIP_hasSuccessor: value = "hasSuccessor"; break;
-        case FRBRRELATIONSHIP_isSuccessorOf: value = "isSuccessorOf"; break;
-        case FRBRRELATIONSHIP_hasSummarization: value = "hasSummarization"; break;
-        case FRBRRELATIONSHIP_isSummarizationOf: value = "isSummarizationOf"; break;
-        case FRBRRELATIONSHIP_hasSupplement: value = "hasSupplement"; break;
-        case FRBRRELATIONSHIP_isSupplementOf: value = "isSupplementOf"; break;
-        case FRBRRELATIONSHIP_hasTransformation: value = "hasTransformation"; break;
-        case FRBRRELATIONSHIP_isTransformationOf: value = "isTransformationOf"; break;
-        case FRBRRELATIONSHIP_hasTranslation: value = "hasTranslation"; break;
-        case FRBRRELATIONSHIP_isTranslationOf: value = "isTranslationOf"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.FRBRRELATIONSHIP", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_FRBRRELATIONSHIP AttConverter::StrToFrbrrelationship(std::string value, bool logWarning) const
-{
-    if (value == "hasAbridgement") return FRBRRELATIONSHIP_hasAbridgement;
-    if (value == "isAbridgementOf") return FRBRRELATIONSHIP_isAbridgementOf;
-    if (value == "hasAdaptation") return FRBRRELATIONSHIP_hasAdaptation;
-    if (value == "isAdaptationOf") return FRBRRELATIONSHIP_isAdaptationOf;
-    if (value == "hasAlternate") return FRBRRELATIONSHIP_hasAlternate;
-    if (value == "isAlternateOf") return FRBRRELATIONSHIP_isAlternateOf;
-    if (value == "hasArrangement") return FRBRRELATIONSHIP_hasArrangement;
-    if (value == "isArrangementOf") return FRBRRELATIONSHIP_isArrangementOf;
-    if (value == "hasComplement") return FRBRRELATIONSHIP_hasComplement;
-    if (value == "isComplementOf") return FRBRRELATIONSHIP_isComplementOf;
-    if (value == "hasEmbodiment") return FRBRRELATIONSHIP_hasEmbodiment;
-    if (value == "isEmbodimentOf") return FRBRRELATIONSHIP_isEmbodimentOf;
-    if (value == "hasExemplar") return FRBRRELATIONSHIP_hasExemplar;
-    if (value == "isExemplarOf") return FRBRRELATIONSHIP_isExemplarOf;
-    if (value == "hasImitation") return FRBRRELATIONSHIP_hasImitation;
-    if (value == "isImitationOf") return FRBRRELATIONSHIP_isImitationOf;
-    if (value == "hasPart") return FRBRRELATIONSHIP_hasPart;
-    if (value == "isPartOf") return FRBRRELATIONSHIP_isPartOf;
-    if (value == "hasRealization") return FRBRRELATIONSHIP_hasRealization;
-    if (value == "isRealizationOf") return FRBRRELATIONSHIP_isRealizationOf;
-    if (value == "hasReconfiguration") return FRBRRELATIONSHIP_hasReconfiguration;
-    if (value == "isReconfigurationOf") return FRBRRELATIONSHIP_isReconfigurationOf;
-    if (value == "hasReproduction") return FRBRRELATIONSHIP_hasReproduction;
-    if (value == "isReproductionOf") return FRBRRELATIONSHIP_isReproductionOf;
-    if (value == "hasRevision") return FRBRRELATIONSHIP_hasRevision;
-    if (value == "isRevisionOf") return FRBRRELATIONSHIP_isRevisionOf;
-    if (value == "hasSuccessor") return FRBRRELATIONSHIP_hasSuccessor;
-    if (value == "isSuccessorOf") return FRBRRELATIONSHIP_isSuccessorOf;
-    if (value == "hasSummarization") return FRBRRELATIONSHIP_hasSummarization;
-    if (value == "isSummarizationOf") return FRBRRELATIONSHIP_isSummarizationOf;
-    if (value == "hasSupplement") return FRBRRELATIONSHIP_hasSupplement;
-    if (value == "isSupplementOf") return FRBRRELATIONSHIP_isSupplementOf;
-    if (value == "hasTransformation") return FRBRRELATIONSHIP_hasTransformation;
-    if (value == "isTransformationOf") return FRBRRELATIONSHIP_isTransformationOf;
-    if (value == "hasTranslation") return FRBRRELATIONSHIP_hasTranslation;
-    if (value == "isTranslationOf") return FRBRRELATIONSHIP_isTranslationOf;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FRBRRELATIONSHIP", value.c_str());
+    static constexpr const char *values[FRBRRELATIONSHIP_MAX] = {
+        "", "hasAbridgement", "isAbridgementOf", "hasAdaptation", "isAdaptationOf", "hasAlternate", "isAlternateOf",
+        "hasArrangement", "isArrangementOf", "hasComplement", "isComplementOf", "hasEmbodiment", "isEmbodimentOf",
+        "hasExemplar", "isExemplarOf", "hasImitation", "isImitationOf", "hasPart", "isPartOf", "hasRealization",
+        "isRealizationOf", "hasReconfiguration", "isReconfigurationOf", "hasReproduction", "isReproductionOf",
+        "hasRevision", "isRevisionOf", "hasSuccessor", "isSuccessorOf", "hasSummarization", "isSummarizationOf",
+        "hasSupplement", "isSupplementOf", "hasTransformation", "isTransformationOf", "hasTranslation",
+        "isTranslationOf"
+    };
+    if ((data <= FRBRRELATIONSHIP_NONE) || (data >= FRBRRELATIONSHIP_MAX)) {
+        LogWarning("Unknown value '%d' for data.FRBRRELATIONSHIP", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_FRBRRELATIONSHIP AttConverter::StrToFrbrrelationship(const std::string &value, bool logWarning) const
+{
+    return StrToFrbrrelationship(value.c_str(), logWarning);
+}
+
+data_FRBRRELATIONSHIP AttConverter::StrToFrbrrelationship(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_FRBRRELATIONSHIP> table[64] = {
+        { "", FRBRRELATIONSHIP_NONE }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasArrangement", FRBRRELATIONSHIP_hasArrangement }, { "hasImitation", FRBRRELATIONSHIP_hasImitation },
+        { "hasReconfiguration", FRBRRELATIONSHIP_hasReconfiguration },
+        { "isImitationOf", FRBRRELATIONSHIP_isImitationOf }, { "isTranslationOf", FRBRRELATIONSHIP_isTranslationOf },
+        { "isPartOf", FRBRRELATIONSHIP_isPartOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasAlternate", FRBRRELATIONSHIP_hasAlternate }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasComplement", FRBRRELATIONSHIP_hasComplement }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "hasExemplar", FRBRRELATIONSHIP_hasExemplar },
+        { "isReconfigurationOf", FRBRRELATIONSHIP_isReconfigurationOf },
+        { "isAdaptationOf", FRBRRELATIONSHIP_isAdaptationOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "hasReproduction", FRBRRELATIONSHIP_hasReproduction },
+        { "isArrangementOf", FRBRRELATIONSHIP_isArrangementOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "", FRBRRELATIONSHIP_NONE }, { "", FRBRRELATIONSHIP_NONE },
+        { "isSupplementOf", FRBRRELATIONSHIP_isSupplementOf }, { "hasRevision", FRBRRELATIONSHIP_hasRevision },
+        { "isEmbodimentOf", FRBRRELATIONSHIP_isEmbodimentOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "hasRealization", FRBRRELATIONSHIP_hasRealization },
+        { "isSuccessorOf", FRBRRELATIONSHIP_isSuccessorOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasTransformation", FRBRRELATIONSHIP_hasTransformation }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "isReproductionOf", FRBRRELATIONSHIP_isReproductionOf },
+        { "isRealizationOf", FRBRRELATIONSHIP_isRealizationOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "isTransformationOf", FRBRRELATIONSHIP_isTransformationOf },
+        { "isAbridgementOf", FRBRRELATIONSHIP_isAbridgementOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasSuccessor", FRBRRELATIONSHIP_hasSuccessor }, { "hasEmbodiment", FRBRRELATIONSHIP_hasEmbodiment },
+        { "", FRBRRELATIONSHIP_NONE }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasSummarization", FRBRRELATIONSHIP_hasSummarization }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "hasTranslation", FRBRRELATIONSHIP_hasTranslation },
+        { "isComplementOf", FRBRRELATIONSHIP_isComplementOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "isExemplarOf", FRBRRELATIONSHIP_isExemplarOf }, { "", FRBRRELATIONSHIP_NONE },
+        { "hasAdaptation", FRBRRELATIONSHIP_hasAdaptation }, { "isRevisionOf", FRBRRELATIONSHIP_isRevisionOf },
+        { "hasSupplement", FRBRRELATIONSHIP_hasSupplement }, { "", FRBRRELATIONSHIP_NONE },
+        { "", FRBRRELATIONSHIP_NONE }, { "isAlternateOf", FRBRRELATIONSHIP_isAlternateOf },
+        { "hasPart", FRBRRELATIONSHIP_hasPart }, { "isSummarizationOf", FRBRRELATIONSHIP_isSummarizationOf },
+        { "hasAbridgement", FRBRRELATIONSHIP_hasAbridgement }
+    };
+    static constexpr uint16_t seeds[16] = { 2, 1, 1, 1, 0, 0, 2, 1, 1, 0, 4, 0, 0, 0, 2, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 63];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.FRBRRELATIONSHIP", value);
     return FRBRRELATIONSHIP_NONE;
 }
 
 std::string AttConverter::GlissandoToStr(data_GLISSANDO data) const
 {
-    std::string value;
-    switch (data) {
-        case GLISSANDO_i: value = "i"; break;
-        case GLISSANDO_m: value = "m"; break;
-        case GLISSANDO_t: value = "t"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.GLISSANDO", data);
-            value = "";
-            break;
+    static constexpr const char *values[GLISSANDO_MAX] = { "", "i", "m", "t" };
+    if ((data <= GLISSANDO_NONE) || (data >= GLISSANDO_MAX)) {
+        LogWarning("Unknown value '%d' for data.GLISSANDO", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_GLISSANDO AttConverter::StrToGlissando(std::string value, bool logWarning) const
+data_GLISSANDO AttConverter::StrToGlissando(const std::string &value, bool logWarning) const
 {
-    if (value == "i") return GLISSANDO_i;
-    if (value == "m") return GLISSANDO_m;
-    if (value == "t") return GLISSANDO_t;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.GLISSANDO", value.c_str());
+    return StrToGlissando(value.c_str(), logWarning);
+}
+
+data_GLISSANDO AttConverter::StrToGlissando(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_GLISSANDO> table[4] = {
+        { "", GLISSANDO_NONE }, { "t", GLISSANDO_t }, { "m", GLISSANDO_m }, { "i", GLISSANDO_i }
+    };
+    const auto &entry = table[HashToken(value, 728) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.GLISSANDO", value);
     return GLISSANDO_NONE;
 }
 
 std::string AttConverter::GraceToStr(data_GRACE data) const
 {
-    std::string value;
-    switch (data) {
-        case GRACE_acc: value = "acc"; break;
-        case GRACE_unacc: value = "unacc"; break;
-        case GRACE_unknown: value = "unknown"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.GRACE", data);
-            value = "";
-            break;
+    static constexpr const char *values[GRACE_MAX] = { "", "acc", "unacc", "unknown" };
+    if ((data <= GRACE_NONE) || (data >= GRACE_MAX)) {
+        LogWarning("Unknown value '%d' for data.GRACE", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_GRACE AttConverter::StrToGrace(std::string value, bool logWarning) const
+data_GRACE AttConverter::StrToGrace(const std::string &value, bool logWarning) const
 {
-    if (value == "acc") return GRACE_acc;
-    if (value == "unacc") return GRACE_unacc;
-    if (value == "unknown") return GRACE_unknown;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.GRACE", value.c_str());
+    return StrToGrace(value.c_str(), logWarning);
+}
+
+data_GRACE AttConverter::StrToGrace(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_GRACE> table[4] = {
+        { "", GRACE_NONE }, { "unacc", GRACE_unacc }, { "unknown", GRACE_unknown }, { "acc", GRACE_acc }
+    };
+    const auto &entry = table[HashToken(value, 1) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.GRACE", value);
     return GRACE_NONE;
 }
 
 std::string AttConverter::HeadshapeToStr(data_HEADSHAPE data) const
 {
-    std::string value;
-    switch (data) {
-        case HEADSHAPE_quarter: value = "quarter"; break;
-        case HEADSHAPE_half: value = "half"; break;
-        case HEADSHAPE_whole: value = "whole"; break;
-        case HEADSHAPE_backslash: value = "backslash"; break;
-        case HEADSHAPE_circle: value = "circle"; break;
-        case HEADSHAPE_plus: value = "+"; break;
-        case HEADSHAPE_diamond: value = "diamond"; break;
-        case HEADSHAPE_isotriangle: value = "isotriangle"; break;
-        case HEADSHAPE_oval: value = "oval"; break;
-        case HEADSHAPE_piewedge: value = "piewedge"; break;
-        case HEADSHAPE_rectangle: value = "rectangle"; break;
-        case HEADSHAPE_rtriangle: value = "rtriangle"; break;
-        case HEADSHAPE_semicircle: value = "semicircle"; break;
-        case HEADSHAPE_slash: value = "slash"; break;
-        case HEADSHAPE_square: value = "square"; break;
-        case HEADSHAPE_x: value = "x"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.HEADSHAPE", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_HEADSHAPE AttConverter::StrToHeadshape(std::string value, bool logWarning) const
-{
-    if (value == "quarter") return HEADSHAPE_quarter;
-    if (value == "half") return HEADSHAPE_half;
-    if (value == "whole") return HEADSHAPE_whole;
-    if (value == "backslash") return HEADSHAPE_backslash;
-    if (value == "circle") return HEADSHAPE_circle;
-    if (value == "+") return HEADSHAPE_plus;
-    if (value == "diamond") return HEADSHAPE_diamond;
-    if (value == "isotriangle") return HEADSHAPE_isotriangle;
-    if (value == "oval") return HEADSHAPE_oval;
-    if (value == "piewedge") return HEADSHAPE_piewedge;
-    if (value == "rectangle") return HEADSHAPE_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_semicircle;
-    if (value == "slash") return HEADSHAPE_slash;
-    if (value == "square") return HEADSHAPE_square;
-    if (value == "x") return HEADSHAPE_x;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.HEADSHAPE", value.c_str());
+    static constexpr const char *values[HEADSHAPE_MAX] = {
+        "", "quarter", "half", "whole", "backslash", "circle", "+", "diamond", "isotriangle", "oval", "piewedge",
+        "rectangle", "rtriangle", "semicircle", "slash", "square", "x"
+    };
+    if ((data <= HEADSHAPE_NONE) || (data >= HEADSHAPE_MAX)) {
+        LogWarning("Unknown value '%d' for data.HEADSHAPE", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_HEADSHAPE AttConverter::StrToHeadshape(const std::string &value, bool logWarning) const
+{
+    return StrToHeadshape(value.c_str(), logWarning);
+}
+
+data_HEADSHAPE AttConverter::StrToHeadshape(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_HEADSHAPE> table[16] = {
+        { "semicircle", HEADSHAPE_semicircle }, { "x", HEADSHAPE_x }, { "quarter", HEADSHAPE_quarter },
+        { "square", HEADSHAPE_square }, { "diamond", HEADSHAPE_diamond }, { "whole", HEADSHAPE_whole },
+        { "rtriangle", HEADSHAPE_rtriangle }, { "circle", HEADSHAPE_circle }, { "half", HEADSHAPE_half },
+        { "oval", HEADSHAPE_oval }, { "rectangle", HEADSHAPE_rectangle }, { "+", HEADSHAPE_plus },
+        { "backslash", HEADSHAPE_backslash }, { "isotriangle", HEADSHAPE_isotriangle }, { "slash", HEADSHAPE_slash },
+        { "piewedge", HEADSHAPE_piewedge }
+    };
+    static constexpr uint16_t seeds[8] = { 1, 2, 1, 2, 0, 2, 3, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.HEADSHAPE", value);
     return HEADSHAPE_NONE;
 }
 
 std::string AttConverter::HeadshapeListToStr(data_HEADSHAPE_list data) const
 {
-    std::string value;
-    switch (data) {
-        case HEADSHAPE_list_quarter: value = "quarter"; break;
-        case HEADSHAPE_list_half: value = "half"; break;
-        case HEADSHAPE_list_whole: value = "whole"; break;
-        case HEADSHAPE_list_backslash: value = "backslash"; break;
-        case HEADSHAPE_list_circle: value = "circle"; break;
-        case HEADSHAPE_list_plus: value = "+"; break;
-        case HEADSHAPE_list_diamond: value = "diamond"; break;
-        case HEADSHAPE_list_isotriangle: value = "isotriangle"; break;
-        case HEADSHAPE_list_oval: value = "oval"; break;
-        case HEADSHAPE_list_piewedge: value = "piewedge"; break;
-        case HEADSHAPE_list_rectangle: value = "rectangle"; break;
-        case HEADSHAPE_list_rtriangle: value = "rtriangle"; break;
-        case HEADSHAPE_list_semicircle: value = "semicircle"; break;
-        case HEADSHAPE_list_slash: value = "slash"; break;
-        case HEADSHAPE_list_square: value = "square"; break;
-        case HEADSHAPE_list_x: value = "x"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.HEADSHAPE.list", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_HEADSHAPE_list AttConverter::StrToHeadshapeList(std::string value, bool logWarning) const
-{
-    if (value == "quarter") return HEADSHAPE_list_quarter;
-    if (value == "half") return HEADSHAPE_list_half;
-    if (value == "whole") return HEADSHAPE_list_whole;
-    if (value == "backslash") return HEADSHAPE_list_backslash;
-    if (value == "circle") return HEADSHAPE_list_circle;
-    if (value == "+") return HEADSHAPE_list_plus;
-    if (value == "diamond") return HEADSHAPE_list_diamond;
-    if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
-    if (value == "oval") return HEADSHAPE_list_oval;
-    if (value == "piewedge") return HEADSHAPE_list_piewedge;
-    if (value == "rectangle") return HEADSHAPE_list_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_list_semicircle;
-    if (value == "slash") return HEADSHAPE_list_slash;
-    if (value == "square") return HEADSHAPE_list_square;
-    if (value == "x") return HEADSHAPE_list_x;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value.c_str());
+    static constexpr const char *values[HEADSHAPE_list_MAX] = {
+        "", "quarter", "half", "whole", "backslash", "circle", "+", "diamond", "isotriangle", "oval", "piewedge",
+        "rectangle", "rtriangle", "semicircle", "slash", "square", "x"
+    };
+    if ((data <= HEADSHAPE_list_NONE) || (data >= HEADSHAPE_list_MAX)) {
+        LogWarning("Unknown value '%d' for data.HEADSHAPE.list", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_HEADSHAPE_list AttConverter::StrToHeadshapeList(const std::string &value, bool logWarning) const
+{
+    return StrToHeadshapeList(value.c_str(), logWarning);
+}
+
+data_HEADSHAPE_list AttConverter::StrToHeadshapeList(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_HEADSHAPE_list> table[16] = {
+        { "semicircle", HEADSHAPE_list_semicircle }, { "x", HEADSHAPE_list_x }, { "quarter", HEADSHAPE_list_quarter },
+        { "square", HEADSHAPE_list_square }, { "diamond", HEADSHAPE_list_diamond }, { "whole", HEADSHAPE_list_whole },
+        { "rtriangle", HEADSHAPE_list_rtriangle }, { "circle", HEADSHAPE_list_circle }, { "half", HEADSHAPE_list_half },
+        { "oval", HEADSHAPE_list_oval }, { "rectangle", HEADSHAPE_list_rectangle }, { "+", HEADSHAPE_list_plus },
+        { "backslash", HEADSHAPE_list_backslash }, { "isotriangle", HEADSHAPE_list_isotriangle },
+        { "slash", HEADSHAPE_list_slash }, { "piewedge", HEADSHAPE_list_piewedge }
+    };
+    static constexpr uint16_t seeds[8] = { 1, 2, 1, 2, 0, 2, 3, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value);
     return HEADSHAPE_list_NONE;
 }
 
 std::string AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data) const
 {
-    std::string value;
-    switch (data) {
-        case HORIZONTALALIGNMENT_left: value = "left"; break;
-        case HORIZONTALALIGNMENT_right: value = "right"; break;
-        case HORIZONTALALIGNMENT_center: value = "center"; break;
-        case HORIZONTALALIGNMENT_justify: value = "justify"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.HORIZONTALALIGNMENT", data);
-            value = "";
-            break;
+    static constexpr const char *values[HORIZONTALALIGNMENT_MAX] = { "", "left", "right", "center", "justify" };
+    if ((data <= HORIZONTALALIGNMENT_NONE) || (data >= HORIZONTALALIGNMENT_MAX)) {
+        LogWarning("Unknown value '%d' for data.HORIZONTALALIGNMENT", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string value, bool logWarning) const
+data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(const std::string &value, bool logWarning) const
 {
-    if (value == "left") return HORIZONTALALIGNMENT_left;
-    if (value == "right") return HORIZONTALALIGNMENT_right;
-    if (value == "center") return HORIZONTALALIGNMENT_center;
-    if (value == "justify") return HORIZONTALALIGNMENT_justify;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value.c_str());
+    return StrToHorizontalalignment(value.c_str(), logWarning);
+}
+
+data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_HORIZONTALALIGNMENT> table[4] = {
+        { "right", HORIZONTALALIGNMENT_right }, { "justify", HORIZONTALALIGNMENT_justify },
+        { "center", HORIZONTALALIGNMENT_center }, { "left", HORIZONTALALIGNMENT_left }
+    };
+    static constexpr uint16_t seeds[2] = { 4, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value);
     return HORIZONTALALIGNMENT_NONE;
 }
 
 std::string AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
 {
-    std::string value;
-    switch (data) {
-        case LAYERSCHEME_1: value = "1"; break;
-        case LAYERSCHEME_2o: value = "2o"; break;
-        case LAYERSCHEME_2f: value = "2f"; break;
-        case LAYERSCHEME_3o: value = "3o"; break;
-        case LAYERSCHEME_3f: value = "3f"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.LAYERSCHEME", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string value, bool logWarning) const
-{
-    if (value == "1") return LAYERSCHEME_1;
-    if (value == "2o") return LAYERSCHEME_2o;
-    if (value == "2f") return LAYERSCHEME_2f;
-    if (value == "3o") return LAYERSCHEME_3o;
-    if (value == "3f") return LAYERSCHEME_3f;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value.c_str());
+    static constexpr const char *values[LAYERSCHEME_MAX] = { "", "1", "2o", "2f", "3o", "3f" };
+    if ((data <= LAYERSCHEME_NONE) || (data >= LAYERSCHEME_MAX)) {
+        LogWarning("Unknown value '%d' for data.LAYERSCHEME", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_LAYERSCHEME AttConverter::StrToLayerscheme(const std::string &value, bool logWarning) const
+{
+    return StrToLayerscheme(value.c_str(), logWarning);
+}
+
+data_LAYERSCHEME AttConverter::StrToLayerscheme(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_LAYERSCHEME> table[8] = {
+        { "2o", LAYERSCHEME_2o }, { "", LAYERSCHEME_NONE }, { "", LAYERSCHEME_NONE }, { "1", LAYERSCHEME_1 },
+        { "3o", LAYERSCHEME_3o }, { "3f", LAYERSCHEME_3f }, { "2f", LAYERSCHEME_2f }, { "", LAYERSCHEME_NONE }
+    };
+    static constexpr uint16_t seeds[2] = { 1, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value);
     return LAYERSCHEME_NONE;
 }
 
 std::string AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
 {
-    std::string value;
-    switch (data) {
-        case LIGATUREFORM_recta: value = "recta"; break;
-        case LIGATUREFORM_obliqua: value = "obliqua"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.LIGATUREFORM", data);
-            value = "";
-            break;
+    static constexpr const char *values[LIGATUREFORM_MAX] = { "", "recta", "obliqua" };
+    if ((data <= LIGATUREFORM_NONE) || (data >= LIGATUREFORM_MAX)) {
+        LogWarning("Unknown value '%d' for data.LIGATUREFORM", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_LIGATUREFORM AttConverter::StrToLigatureform(std::string value, bool logWarning) const
+data_LIGATUREFORM AttConverter::StrToLigatureform(const std::string &value, bool logWarning) const
 {
-    if (value == "recta") return LIGATUREFORM_recta;
-    if (value == "obliqua") return LIGATUREFORM_obliqua;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value.c_str());
+    return StrToLigatureform(value.c_str(), logWarning);
+}
+
+data_LIGATUREFORM AttConverter::StrToLigatureform(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_LIGATUREFORM> table[2] = {
+        { "obliqua", LIGATUREFORM_obliqua }, { "recta", LIGATUREFORM_recta }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value);
     return LIGATUREFORM_NONE;
 }
 
 std::string AttConverter::LineformToStr(data_LINEFORM data) const
 {
-    std::string value;
-    switch (data) {
-        case LINEFORM_dashed: value = "dashed"; break;
-        case LINEFORM_dotted: value = "dotted"; break;
-        case LINEFORM_solid: value = "solid"; break;
-        case LINEFORM_wavy: value = "wavy"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.LINEFORM", data);
-            value = "";
-            break;
+    static constexpr const char *values[LINEFORM_MAX] = { "", "dashed", "dotted", "solid", "wavy" };
+    if ((data <= LINEFORM_NONE) || (data >= LINEFORM_MAX)) {
+        LogWarning("Unknown value '%d' for data.LINEFORM", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_LINEFORM AttConverter::StrToLineform(std::string value, bool logWarning) const
+data_LINEFORM AttConverter::StrToLineform(const std::string &value, bool logWarning) const
 {
-    if (value == "dashed") return LINEFORM_dashed;
-    if (value == "dotted") return LINEFORM_dotted;
-    if (value == "solid") return LINEFORM_solid;
-    if (value == "wavy") return LINEFORM_wavy;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LINEFORM", value.c_str());
+    return StrToLineform(value.c_str(), logWarning);
+}
+
+data_LINEFORM AttConverter::StrToLineform(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_LINEFORM> table[4] = {
+        { "wavy", LINEFORM_wavy }, { "dashed", LINEFORM_dashed }, { "dotted", LINEFORM_dotted },
+        { "solid", LINEFORM_solid }
+    };
+    static constexpr uint16_t seeds[2] = { 1, 3 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.LINEFORM", value);
     return LINEFORM_NONE;
 }
 
 std::string AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data) const
 {
-    std::string value;
-    switch (data) {
-        case LINESTARTENDSYMBOL_angledown: value = "angledown"; break;
-        case LINESTARTENDSYMBOL_angleup: value = "angleup"; break;
-        case LINESTARTENDSYMBOL_angleright: value = "angleright"; break;
-        case LINESTARTENDSYMBOL_angleleft: value = "angleleft"; break;
-        case LINESTARTENDSYMBOL_arrow: value = "arrow"; break;
-        case LINESTARTENDSYMBOL_arrowopen: value = "arrowopen"; break;
-        case LINESTARTENDSYMBOL_arrowwhite: value = "arrowwhite"; break;
-        case LINESTARTENDSYMBOL_harpoonleft: value = "harpoonleft"; break;
-        case LINESTARTENDSYMBOL_harpoonright: value = "harpoonright"; break;
-        case LINESTARTENDSYMBOL_H: value = "H"; break;
-        case LINESTARTENDSYMBOL_N: value = "N"; break;
-        case LINESTARTENDSYMBOL_Th: value = "Th"; break;
-        case LINESTARTENDSYMBOL_ThRetro: value = "ThRetro"; break;
-        case LINESTARTENDSYMBOL_ThRetroInv: value = "ThRetroInv"; break;
-        case LINESTARTENDSYMBOL_ThInv: value = "ThInv"; break;
-        case LINESTARTENDSYMBOL_T: value = "T"; break;
-        case LINESTARTENDSYMBOL_TInv: value = "TInv"; break;
-        case LINESTARTENDSYMBOL_CH: value = "CH"; break;
-        case LINESTARTENDSYMBOL_RH: value = "RH"; break;
-        case LINESTARTENDSYMBOL_none: value = "none"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.LINESTARTENDSYMBOL", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string value, bool logWarning) const
-{
-    if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
-    if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
-    if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
-    if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
-    if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
-    if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
-    if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
-    if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
-    if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
-    if (value == "H") return LINESTARTENDSYMBOL_H;
-    if (value == "N") return LINESTARTENDSYMBOL_N;
-    if (value == "Th") return LINESTARTENDSYMBOL_Th;
-    if (value == "ThRetro") return LINESTARTENDSYMBOL_ThRetro;
-    if (value == "ThRetroInv") return LINESTARTENDSYMBOL_ThRetroInv;
-    if (value == "ThInv") return LINESTARTENDSYMBOL_ThInv;
-    if (value == "T") return LINESTARTENDSYMBOL_T;
-    if (value == "TInv") return LINESTARTENDSYMBOL_TInv;
-    if (value == "CH") return LINESTARTENDSYMBOL_CH;
-    if (value == "RH") return LINESTARTENDSYMBOL_RH;
-    if (value == "none") return LINESTARTENDSYMBOL_none;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value.c_str());
+    static constexpr const char *values[LINESTARTENDSYMBOL_MAX] = {
+        "", "angledown", "angleup", "angleright", "angleleft", "arrow", "arrowopen", "arrowwhite", "harpoonleft",
+        "harpoonright", "H", "N", "Th", "ThRetro", "ThRetroInv", "ThInv", "T", "TInv", "CH", "RH", "none"
+    };
+    if ((data <= LINESTARTENDSYMBOL_NONE) || (data >= LINESTARTENDSYMBOL_MAX)) {
+        LogWarning("Unknown value '%d' for data.LINESTARTENDSYMBOL", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(const std::string &value, bool logWarning) const
+{
+    return StrToLinestartendsymbol(value.c_str(), logWarning);
+}
+
+data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_LINESTARTENDSYMBOL> table[32] = {
+        { "angleleft", LINESTARTENDSYMBOL_angleleft }, { "", LINESTARTENDSYMBOL_NONE }, { "", LINESTARTENDSYMBOL_NONE },
+        { "ThInv", LINESTARTENDSYMBOL_ThInv }, { "", LINESTARTENDSYMBOL_NONE },
+        { "arrowopen", LINESTARTENDSYMBOL_arrowopen }, { "ThRetro", LINESTARTENDSYMBOL_ThRetro },
+        { "", LINESTARTENDSYMBOL_NONE }, { "H", LINESTARTENDSYMBOL_H }, { "angledown", LINESTARTENDSYMBOL_angledown },
+        { "CH", LINESTARTENDSYMBOL_CH }, { "", LINESTARTENDSYMBOL_NONE }, { "", LINESTARTENDSYMBOL_NONE },
+        { "angleright", LINESTARTENDSYMBOL_angleright }, { "angleup", LINESTARTENDSYMBOL_angleup },
+        { "T", LINESTARTENDSYMBOL_T }, { "", LINESTARTENDSYMBOL_NONE },
+        { "harpoonright", LINESTARTENDSYMBOL_harpoonright }, { "", LINESTARTENDSYMBOL_NONE },
+        { "", LINESTARTENDSYMBOL_NONE }, { "", LINESTARTENDSYMBOL_NONE }, { "TInv", LINESTARTENDSYMBOL_TInv },
+        { "arrowwhite", LINESTARTENDSYMBOL_arrowwhite }, { "none", LINESTARTENDSYMBOL_none },
+        { "", LINESTARTENDSYMBOL_NONE }, { "ThRetroInv", LINESTARTENDSYMBOL_ThRetroInv },
+        { "RH", LINESTARTENDSYMBOL_RH }, { "Th", LINESTARTENDSYMBOL_Th }, { "arrow", LINESTARTENDSYMBOL_arrow },
+        { "N", LINESTARTENDSYMBOL_N }, { "harpoonleft", LINESTARTENDSYMBOL_harpoonleft },
+        { "", LINESTARTENDSYMBOL_NONE }
+    };
+    static constexpr uint16_t seeds[8] = { 2, 0, 2, 1, 1, 0, 3, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value);
     return LINESTARTENDSYMBOL_NONE;
 }
 
 std::string AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
 {
-    std::string value;
-    switch (data) {
-        case LINEWIDTHTERM_narrow: value = "narrow"; break;
-        case LINEWIDTHTERM_medium: value = "medium"; break;
-        case LINEWIDTHTERM_wide: value = "wide"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.LINEWIDTHTERM", data);
-            value = "";
-            break;
+    static constexpr const char *values[LINEWIDTHTERM_MAX] = { "", "narrow", "medium", "wide" };
+    if ((data <= LINEWIDTHTERM_NONE) || (data >= LINEWIDTHTERM_MAX)) {
+        LogWarning("Unknown value '%d' for data.LINEWIDTHTERM", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(const std::string &value, bool logWarning) const
+{
+    return StrToLinewidthterm(value.c_str(), logWarning);
 }
 
-data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string value, bool logWarning) const
+data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(const char *value, bool logWarning) const
 {
-    if (value == "narrow") return LINEWIDTHTERM_narrow;
-    if (value == "medium") return LINEWIDTHTERM_medium;
-    if (value == "wide") return LINEWIDTHTERM_wide;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value.c_str());
+    static constexpr std::pair<const char *, data_LINEWIDTHTERM> table[4] = {
+        { "wide", LINEWIDTHTERM_wide }, { "medium", LINEWIDTHTERM_medium }, { "", LINEWIDTHTERM_NONE },
+        { "narrow", LINEWIDTHTERM_narrow }
+    };
+    const auto &entry = table[HashToken(value, 4) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value);
     return LINEWIDTHTERM_NONE;
 }
 
 std::string AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
 {
-    std::string value;
-    switch (data) {
-        case MELODICFUNCTION_aln: value = "aln"; break;
-        case MELODICFUNCTION_ant: value = "ant"; break;
-        case MELODICFUNCTION_app: value = "app"; break;
-        case MELODICFUNCTION_apt: value = "apt"; break;
-        case MELODICFUNCTION_arp: value = "arp"; break;
-        case MELODICFUNCTION_arp7: value = "arp7"; break;
-        case MELODICFUNCTION_aun: value = "aun"; break;
-        case MELODICFUNCTION_chg: value = "chg"; break;
-        case MELODICFUNCTION_cln: value = "cln"; break;
-        case MELODICFUNCTION_ct: value = "ct"; break;
-        case MELODICFUNCTION_ct7: value = "ct7"; break;
-        case MELODICFUNCTION_cun: value = "cun"; break;
-        case MELODICFUNCTION_cup: value = "cup"; break;
-        case MELODICFUNCTION_et: value = "et"; break;
-        case MELODICFUNCTION_ln: value = "ln"; break;
-        case MELODICFUNCTION_ped: value = "ped"; break;
-        case MELODICFUNCTION_rep: value = "rep"; break;
-        case MELODICFUNCTION_ret: value = "ret"; break;
-        case MELODICFUNCTION_23ret: value = "23ret"; break;
-        case MELODICFUNCTION_78ret: value = "78ret"; break;
-        case MELODICFUNCTION_sus: value = "sus"; break;
-        case MELODICFUNCTION_43sus: value = "43sus"; break;
-        case MELODICFUNCTION_98sus: value = "98sus"; break;
-        case MELODICFUNCTION_76sus: value = "76sus"; break;
-        case MELODICFUNCTION_un: value = "un"; break;
-        case MELODICFUNCTION_un7: value = "un7"; break;
-        case MELODICFUNCTION_upt: value = "upt"; break;
-        case MELODICFUNCTION_upt7: value = "upt7"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.MELODICFUNCTION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string value, bool logWarning) const
-{
-    if (value == "aln") return MELODICFUNCTION_aln;
-    if (value == "ant") return MELODICFUNCTION_ant;
-    if (value == "app") return MELODICFUNCTION_app;
-    if (value == "apt") return MELODICFUNCTION_apt;
-    if (value == "arp") return MELODICFUNCTION_arp;
-    if (value == "arp7") return MELODICFUNCTION_arp7;
-    if (value == "aun") return MELODICFUNCTION_aun;
-    if (value == "chg") return MELODICFUNCTION_chg;
-    if (value == "cln") return MELODICFUNCTION_cln;
-    if (value == "ct") return MELODICFUNCTION_ct;
-    if (value == "ct7") return MELODICFUNCTION_ct7;
-    if (value == "cun") return MELODICFUNCTION_cun;
-    if (value == "cup") return MELODICFUNCTION_cup;
-    if (value == "et") return MELODICFUNCTION_et;
-    if (value == "ln") return MELODICFUNCTION_ln;
-    if (value == "ped") return MELODICFUNCTION_ped;
-    if (value == "rep") return MELODICFUNCTION_rep;
-    if (value == "ret") return MELODICFUNCTION_ret;
-    if (value == "23ret") return MELODICFUNCTION_23ret;
-    if (value == "78ret") return MELODICFUNCTION_78ret;
-    if (value == "sus") return MELODICFUNCTION_sus;
-    if (value == "43sus") return MELODICFUNCTION_43sus;
-    if (value == "98sus") return MELODICFUNCTION_98sus;
-    if (value == "76sus") return MELODICFUNCTION_76sus;
-    if (value == "un") return MELODICFUNCTION_un;
-    if (value == "un7") return MELODICFUNCTION_un7;
-    if (value == "upt") return MELODICFUNCTION_upt;
-    if (value == "upt7") return MELODICFUNCTION_upt7;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value.c_str());
+    static constexpr const char *values[MELODICFUNCTION_MAX] = {
+        "", "aln", "ant", "app", "apt", "arp", "arp7", "aun", "chg", "cln", "ct", "ct7", "cun", "cup", "et", "ln",
+        "ped", "rep", "ret", "23ret", "78ret", "sus", "43sus", "98sus", "76sus", "un", "un7", "upt", "upt7"
+    };
+    if ((data <= MELODICFUNCTION_NONE) || (data >= MELODICFUNCTION_MAX)) {
+        LogWarning("Unknown value '%d' for data.MELODICFUNCTION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_MELODICFUNCTION AttConverter::StrToMelodicfunction(const std::string &value, bool logWarning) const
+{
+    return StrToMelodicfunction(value.c_str(), logWarning);
+}
+
+data_MELODICFUNCTION AttConverter::StrToMelodicfunction(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_MELODICFUNCTION> table[32] = {
+        { "", MELODICFUNCTION_NONE }, { "arp7", MELODICFUNCTION_arp7 }, { "23ret", MELODICFUNCTION_23ret },
+        { "un7", MELODICFUNCTION_un7 }, { "sus", MELODICFUNCTION_sus }, { "aun", MELODICFUNCTION_aun },
+        { "ct", MELODICFUNCTION_ct }, { "", MELODICFUNCTION_NONE }, { "app", MELODICFUNCTION_app },
+        { "", MELODICFUNCTION_NONE }, { "apt", MELODICFUNCTION_apt }, { "upt", MELODICFUNCTION_upt },
+        { "ln", MELODICFUNCTION_ln }, { "ct7", MELODICFUNCTION_ct7 }, { "cup", MELODICFUNCTION_cup },
+        { "cun", MELODICFUNCTION_cun }, { "ped", MELODICFUNCTION_ped }, { "43sus", MELODICFUNCTION_43sus },
+        { "98sus", MELODICFUNCTION_98sus }, { "upt7", MELODICFUNCTION_upt7 }, { "arp", MELODICFUNCTION_arp },
+        { "ret", MELODICFUNCTION_ret }, { "et", MELODICFUNCTION_et }, { "aln", MELODICFUNCTION_aln },
+        { "ant", MELODICFUNCTION_ant }, { "rep", MELODICFUNCTION_rep }, { "un", MELODICFUNCTION_un },
+        { "cln", MELODICFUNCTION_cln }, { "78ret", MELODICFUNCTION_78ret }, { "chg", MELODICFUNCTION_chg },
+        { "76sus", MELODICFUNCTION_76sus }, { "", MELODICFUNCTION_NONE }
+    };
+    static constexpr uint16_t seeds[16] = { 0, 2, 0, 0, 3, 6, 2, 1, 2, 4, 0, 6, 1, 0, 1, 9 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value);
     return MELODICFUNCTION_NONE;
 }
 
 std::string AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
 {
-    std::string value;
-    switch (data) {
-        case MENSURATIONSIGN_C: value = "C"; break;
-        case MENSURATIONSIGN_O: value = "O"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.MENSURATIONSIGN", data);
-            value = "";
-            break;
+    static constexpr const char *values[MENSURATIONSIGN_MAX] = { "", "C", "O" };
+    if ((data <= MENSURATIONSIGN_NONE) || (data >= MENSURATIONSIGN_MAX)) {
+        LogWarning("Unknown value '%d' for data.MENSURATIONSIGN", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_MENSURATIONSIGN AttConverter::StrToMensurationsign(const std::string &value, bool logWarning) const
+{
+    return StrToMensurationsign(value.c_str(), logWarning);
 }
 
-data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string value, bool logWarning) const
+data_MENSURATIONSIGN AttConverter::StrToMensurationsign(const char *value, bool logWarning) const
 {
-    if (value == "C") return MENSURATIONSIGN_C;
-    if (value == "O") return MENSURATIONSIGN_O;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value.c_str());
+    static constexpr std::pair<const char *, data_MENSURATIONSIGN> table[2] = {
+        { "O", MENSURATIONSIGN_O }, { "C", MENSURATIONSIGN_C }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value);
     return MENSURATIONSIGN_NONE;
 }
 
 std::string AttConverter::MeterformToStr(data_METERFORM data) const
 {
-    std::string value;
-    switch (data) {
-        case METERFORM_num: value = "num"; break;
-        case METERFORM_denomsym: value = "denomsym"; break;
-        case METERFORM_norm: value = "norm"; break;
-        case METERFORM_invis: value = "invis"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.METERFORM", data);
-            value = "";
-            break;
+    static constexpr const char *values[METERFORM_MAX] = { "", "num", "denomsym", "norm", "invis" };
+    if ((data <= METERFORM_NONE) || (data >= METERFORM_MAX)) {
+        LogWarning("Unknown value '%d' for data.METERFORM", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_METERFORM AttConverter::StrToMeterform(const std::string &value, bool logWarning) const
+{
+    return StrToMeterform(value.c_str(), logWarning);
 }
 
-data_METERFORM AttConverter::StrToMeterform(std::string value, bool logWarning) const
+data_METERFORM AttConverter::StrToMeterform(const char *value, bool logWarning) const
 {
-    if (value == "num") return METERFORM_num;
-    if (value == "denomsym") return METERFORM_denomsym;
-    if (value == "norm") return METERFORM_norm;
-    if (value == "invis") return METERFORM_invis;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.METERFORM", value.c_str());
+    static constexpr std::pair<const char *, data_METERFORM> table[4] = {
+        { "norm", METERFORM_norm }, { "num", METERFORM_num }, { "invis", METERFORM_invis },
+        { "denomsym", METERFORM_denomsym }
+    };
+    static constexpr uint16_t seeds[2] = { 0, 15 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.METERFORM", value);
     return METERFORM_NONE;
 }
 
 std::string AttConverter::MetersignToStr(data_METERSIGN data) const
 {
-    std::string value;
-    switch (data) {
-        case METERSIGN_common: value = "common"; break;
-        case METERSIGN_cut: value = "cut"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.METERSIGN", data);
-            value = "";
-            break;
+    static constexpr const char *values[METERSIGN_MAX] = { "", "common", "cut" };
+    if ((data <= METERSIGN_NONE) || (data >= METERSIGN_MAX)) {
+        LogWarning("Unknown value '%d' for data.METERSIGN", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_METERSIGN AttConverter::StrToMetersign(std::string value, bool logWarning) const
+data_METERSIGN AttConverter::StrToMetersign(const std::string &value, bool logWarning) const
 {
-    if (value == "common") return METERSIGN_common;
-    if (value == "cut") return METERSIGN_cut;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.METERSIGN", value.c_str());
+    return StrToMetersign(value.c_str(), logWarning);
+}
+
+data_METERSIGN AttConverter::StrToMetersign(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_METERSIGN> table[2] = {
+        { "common", METERSIGN_common }, { "cut", METERSIGN_cut }
+    };
+    const auto &entry = table[HashToken(value, 1) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.METERSIGN", value);
     return METERSIGN_NONE;
 }
 
 std::string AttConverter::MidinamesToStr(data_MIDINAMES data) const
 {
-    std::string value;
-    switch (data) {
-        case MIDINAMES_Acoustic_Grand_Piano: value = "Acoustic_Grand_Piano"; break;
-        case MIDINAMES_Bright_Acoustic_Piano: value = "Bright_Acoustic_Piano"; break;
-        case MIDINAMES_Electric_Grand_Piano: value = "Electric_Grand_Piano"; break;
-        case MIDINAMES_Honky_tonk_Piano: value = "Honky-tonk_Piano"; break;
-        case MIDINAMES_Electric_Piano_1: value = "Electric_Piano_1"; break;
-        case MIDINAMES_Electric_Piano_2: value = "Electric_Piano_2"; break;
-        case MIDINAMES_Harpsichord: value = "Harpsichord"; break;
-        case MIDINAMES_Clavi: value = "Clavi"; break;
-        case MIDINAMES_Celesta: value = "Celesta"; break;
-        case MIDINAMES_Glockenspiel: value = "Glockenspiel"; break;
-        case MIDINAMES_Music_Box: value = "Music_Box"; break;
-        case MIDINAMES_Vibraphone: value = "Vibraphone"; break;
-        case MIDINAMES_Marimba: value = "Marimba"; break;
-        case MIDINAMES_Xylophone: value = "Xylophone"; break;
-        case MIDINAMES_Tubular_Bells: value = "Tubular_Bells"; break;
-        case MIDINAMES_Dulcimer: value = "Dulcimer"; break;
-        case MIDINAMES_Drawbar_Organ: value = "Drawbar_Organ"; break;
-        case MIDINAMES_Percussive_Organ: value = "Percussive_Organ"; break;
-        case MIDINAMES_Rock_Organ: value = "Rock_Organ"; break;
-        case MIDINAMES_Church_Organ: value = "Church_Organ"; break;
-        case MIDINAMES_Reed_Organ: value = "Reed_Organ"; break;
-        case MIDINAMES_Accordion: value = "Accordion"; break;
-        case MIDINAMES_Harmonica: value = "Harmonica"; break;
-        case MIDINAMES_Tango_Accordion: value = "Tango_Accordion"; break;
-        case MIDINAMES_Acoustic_Guitar_nylon: value = "Acoustic_Guitar_nylon"; break;
-        case MIDINAMES_Acoustic_Guitar_steel: value = "Acoustic_Guitar_steel"; break;
-        case MIDINAMES_Electric_Guitar_jazz: value = "Electric_Guitar_jazz"; break;
-        case MIDINAMES_Electric_Guitar_clean: value = "Electric_Guitar_clean"; break;
-        case MIDINAMES_Electric_Guitar_muted: value = "Electric_Guitar_muted"; break;
-        case MIDINAMES_Overdriven_Guitar: value = "Overdriven_Guitar"; break;
-        case MIDINAMES_Distortion_Guitar: value = "Distortion_Guitar"; break;
-        case MIDINAMES_Guitar_harmonics: value = "Guitar_harmonics"; break;
-        case MIDINAMES_Acoustic_Bass: value = "Acoustic_Bass"; break;
-        case MIDINAMES_Electric_Bass_finger: value = "Electric_Bass_finger"; break;
-        case MIDINAMES_Electric_Bass_pick: value = "Electric_Bass_pick"; break;
-        case MIDINAMES_Fretless_Bass: value = "Fretless_Bass"; break;
-        case MIDINAMES_Slap_Bass_1: value = "Slap_Bass_1"; break;
-        case MIDINAMES_Slap_Bass_2: value = "Slap_Bass_2"; break;
-        case MIDINAMES_Synth_Bass_1: value = "Synth_Bass_1"; break;
-        case MIDINAMES_Synth_Bass_2: value = "Synth_Bass_2"; break;
-        case MIDINAMES_Violin: value = "Violin"; break;
-        case MIDINAMES_Viola: value = "Viola"; break;
-        case MIDINAMES_Cello: value = "Cello"; break;
-        case MIDINAMES_Contrabass: value = "Contrabass"; break;
-        case MIDINAMES_Tremolo_Strings: value = "Tremolo_Strings"; break;
-        case MIDINAMES_Pizzicato_Strings: value = "Pizzicato_Strings"; break;
-        case MIDINAMES_Orchestral_Harp: value = "Orchestral_Harp"; break;
-        case MIDINAMES_Timpani: value = "Timpani"; break;
-        case MIDINAMES_String_Ensemble_1: value = "String_Ensemble_1"; break;
-        case MIDINAMES_String_Ensemble_2: value = "String_Ensemble_2"; break;
-        case MIDINAMES_SynthStrings_1: value = "SynthStrings_1"; break;
-        case MIDINAMES_SynthStrings_2: value = "SynthStrings_2"; break;
-        case MIDINAMES_Choir_Aahs: value = "Choir_Aahs"; break;
-        case MIDINAMES_Voice_Oohs: value = "Voice_Oohs"; break;
-        case MIDINAMES_Synth_Voice: value = "Synth_Voice"; break;
-        case MIDINAMES_Orchestra_Hit: value = "Orchestra_Hit"; break;
-        case MIDINAMES_Trumpet: value = "Trumpet"; break;
-        case MIDINAMES_Trombone: value = "Trombone"; break;
-        case MIDINAMES_Tuba: value = "Tuba"; break;
-        case MIDINAMES_Muted_Trumpet: value = "Muted_Trumpet"; break;
-        case MIDINAMES_French_Horn: value = "French_Horn"; break;
-        case MIDINAMES_Brass_Section: value = "Brass_Section"; break;
-        case MIDINAMES_SynthBrass_1: value = "SynthBrass_1"; break;
-        case MIDINAMES_SynthBrass_2: value = "SynthBrass_2"; break;
-        case MIDINAMES_Soprano_Sax: value = "Soprano_Sax"; break;
-        case MIDINAMES_Alto_Sax: value = "Alto_Sax"; break;
-        case MIDINAMES_Tenor_Sax: value = "Tenor_Sax"; break;
-        case MIDINAMES_Baritone_Sax: value = "Baritone_Sax"; break;
-        case MIDINAMES_Oboe: value = "Oboe"; break;
-        case MIDINAMES_English_Horn: value = "English_Horn"; break;
-        case MIDINAMES_Bassoon: value = "Bassoon"; break;
-        case MIDINAMES_Clarinet: value = "Clarinet"; break;
-        case MIDINAMES_Piccolo: value = "Piccolo"; break;
-        case MIDINAMES_Flute: value = "Flute"; break;
-        case MIDINAMES_Recorder: value = "Recorder"; break;
-        case MIDINAMES_Pan_Flute: value = "Pan_Flute"; break;
-        case MIDINAMES_Blown_Bottle: value = "Blown_Bottle"; break;
-        case MIDINAMES_Shakuhachi: value = "Shakuhachi"; break;
-        case MIDINAMES_Whistle: value = "Whistle"; break;
-        case MIDINAMES_Ocarina: value = "Ocarina"; break;
-        case MIDINAMES_Lead_1_square: value = "Lead_1_square"; break;
-        case MIDINAMES_Lead_2_sawtooth: value = "Lead_2_sawtooth"; break;
-        case MIDINAMES_Lead_3_calliope: value = "Lead_3_calliope"; break;
-        case MIDINAMES_Lead_4_chiff: value = "Lead_4_chiff"; break;
-        case MIDINAMES_Lead_5_charang: value = "Lead_5_charang"; break;
-        case MIDINAMES_Lead_6_voice: value = "Lead_6_voice"; break;
-        case MIDINAMES_Lead_7_fifths: value = "Lead_7_fifths"; break;
-        case MIDINAMES_Lead_8_bass_and_lead: value = "Lead_8_bass_and_lead"; break;
-        case MIDINAMES_Pad_1_new_age: value = "Pad_1_new_age"; break;
-        case MIDINAMES_Pad_2_warm: value = "Pad_2_warm"; break;
-        case MIDINAMES_Pad_3_polysynth: value = "Pad_3_polysynth"; break;
-        case MIDINAMES_Pad_4_choir: value = "Pad_4_choir"; break;
-        case MIDINAMES_Pad_5_bowed: value = "Pad_5_bowed"; break;
-        case MIDINAMES_Pad_6_metallic: value = "Pad_6_metallic"; break;
-        case MIDINAMES_Pad_7_halo: value = "Pad_7_halo"; break;
-        case MIDINAMES_Pad_8_sweep: value = "Pad_8_sweep"; break;
-        case MIDINAMES_FX_1_rain: value = "FX_1_rain"; break;
-        case MIDINAMES_FX_2_soundtrack: value = "FX_2_soundtrack"; break;
-        case MIDINAMES_FX_3_crystal: value = "FX_3_crystal"; break;
-        case MIDINAMES_FX_4_atmosphere: value = "FX_4_atmosphere"; break;
-        case MIDINAMES_FX_5_brightness: value = "FX_5_brightness"; break;
-        case MIDINAMES_FX_6_goblins: value = "FX_6_goblins"; break;
-        case MIDINAMES_FX_7_echoes: value = "FX_7_echoes"; break;
-        case MIDINAMES_FX_8_sci_fi: value = "FX_8_sci-fi"; break;
-        case MIDINAMES_Sitar: value = "Sitar"; break;
-        case MIDINAMES_Banjo: value = "Banjo"; break;
-        case MIDINAMES_Shamisen: value = "Shamisen"; break;
-        case MIDINAMES_Koto: value = "Koto"; break;
-        case MIDINAMES_Kalimba: value = "Kalimba"; break;
-        case MIDINAMES_Bagpipe: value = "Bagpipe"; break;
-        case MIDINAMES_Fiddle: value = "Fiddle"; break;
-        case MIDINAMES_Shanai: value = "Shanai"; break;
-        case MIDINAMES_Tinkle_Bell: value = "Tinkle_Bell"; break;
-        case MIDINAMES_Agogo: value = "Agogo"; break;
-        case MIDINAMES_Steel_Drums: value = "Steel_Drums"; break;
-        case MIDINAMES_Woodblock: value = "Woodblock"; break;
-        case MIDINAMES_Taiko_Drum: value = "Taiko_Drum"; break;
-        case MIDINAMES_Melodic_Tom: value = "Melodic_Tom"; break;
-        case MIDINAMES_Synth_Drum: value = "Synth_Drum"; break;
-        case MIDINAMES_Reverse_Cymbal: value = "Reverse_Cymbal"; break;
-        case MIDINAMES_Guitar_Fret_Noise: value = "Guitar_Fret_Noise"; break;
-        case MIDINAMES_Breath_Noise: value = "Breath_Noise"; break;
-        case MIDINAMES_Seashore: value = "Seashore"; break;
-        case MIDINAMES_Bird_Tweet: value = "Bird_Tweet"; break;
-        case MIDINAMES_Telephone_Ring: value = "Telephone_Ring"; break;
-        case MIDINAMES_Helicopter: value = "Helicopter"; break;
-        case MIDINAMES_Applause: value = "Applause"; break;
-        case MIDINAMES_Gunshot: value = "Gunshot"; break;
-        case MIDINAMES_Acoustic_Bass_Drum: value = "Acoustic_Bass_Drum"; break;
-        case MIDINAMES_Bass_Drum_1: value = "Bass_Drum_1"; break;
-        case MIDINAMES_Side_Stick: value = "Side_Stick"; break;
-        case MIDINAMES_Acoustic_Snare: value = "Acoustic_Snare"; break;
-        case MIDINAMES_Hand_Clap: value = "Hand_Clap"; break;
-        case MIDINAMES_Electric_Snare: value = "Electric_Snare"; break;
-        case MIDINAMES_Low_Floor_Tom: value = "Low_Floor_Tom"; break;
-        case MIDINAMES_Closed_Hi_Hat: value = "Closed_Hi_Hat"; break;
-        case MIDINAMES_High_Floor_Tom: value = "High_Floor_Tom"; break;
-        case MIDINAMES_Pedal_Hi_Hat: value = "Pedal_Hi-Hat"; break;
-        case MIDINAMES_Low_Tom: value = "Low_Tom"; break;
-        case MIDINAMES_Open_Hi_Hat: value = "Open_Hi-Hat"; break;
-        case MIDINAMES_Low_Mid_Tom: value = "Low-Mid_Tom"; break;
-        case MIDINAMES_Hi_Mid_Tom: value = "Hi-Mid_Tom"; break;
-        case MIDINAMES_Crash_Cymbal_1: value = "Crash_Cymbal_1"; break;
-        case MIDINAMES_High_Tom: value = "High_Tom"; break;
-        case MIDINAMES_Ride_Cymbal_1: value = "Ride_Cymbal_1"; break;
-        case MIDINAMES_Chinese_Cymbal: value = "Chinese_Cymbal"; break;
-        case MIDINAMES_Ride_Bell: value = "Ride_Bell"; break;
-        case MIDINAMES_Tambourine: value = "Tambourine"; break;
-        case MIDINAMES_Splash_Cymbal: value = "Splash_Cymbal"; break;
-        case MIDINAMES_Cowbell: value = "Cowbell"; break;
-        case MIDINAMES_Crash_Cymbal_2: value = "Crash_Cymbal_2"; break;
-        case MIDINAMES_Vibraslap: value = "Vibraslap"; break;
-        case MIDINAMES_Ride_Cymbal_2: value = "Ride_Cymbal_2"; break;
-        case MIDINAMES_Hi_Bongo: value = "Hi_Bongo"; break;
-        case MIDINAMES_Low_Bongo: value = "Low_Bongo"; break;
-        case MIDINAMES_Mute_Hi_Conga: value = "Mute_Hi_Conga"; break;
-        case MIDINAMES_Open_Hi_Conga: value = "Open_Hi_Conga"; break;
-        case MIDINAMES_Low_Conga: value = "Low_Conga"; break;
-        case MIDINAMES_High_Timbale: value = "High_Timbale"; break;
-        case MIDINAMES_Low_Timbale: value = "Low_Timbale"; break;
-        case MIDINAMES_High_Agogo: value = "High_Agogo"; break;
-        case MIDINAMES_Low_Agogo: value = "Low_Agogo"; break;
-        case MIDINAMES_Cabasa: value = "Cabasa"; break;
-        case MIDINAMES_Maracas: value = "Maracas"; break;
-        case MIDINAMES_Short_Whistle: value = "Short_Whistle"; break;
-        case MIDINAMES_Long_Whistle: value = "Long_Whistle"; break;
-        case MIDINAMES_Short_Guiro: value = "Short_Guiro"; break;
-        case MIDINAMES_Long_Guiro: value = "Long_Guiro"; break;
-        case MIDINAMES_Claves: value = "Claves"; break;
-        case MIDINAMES_Hi_Wood_Block: value = "Hi_Wood_Block"; break;
-        case MIDINAMES_Low_Wood_Block: value = "Low_Wood_Block"; break;
-        case MIDINAMES_Mute_Cuica: value = "Mute_Cuica"; break;
-        case MIDINAMES_Open_Cuica: value = "Open_Cuica"; break;
-        case MIDINAMES_Mute_Triangle: value = "Mute_Triangle"; break;
-        case MIDINAMES_Open_Triangle: value = "Open_Triangle"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.MIDINAMES", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_MIDINAMES AttConverter::StrToMidinames(std::string value, bool logWarning) const
-{
-    if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
-    if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
-    if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
-    if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
-    if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
-    if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
-    if (value == "Harpsichord") return MIDINAMES_Harpsichord;
-    if (value == "Clavi") return MIDINAMES_Clavi;
-    if (value == "Celesta") return MIDINAMES_Celesta;
-    if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
-    if (value == "Music_Box") return MIDINAMES_Music_Box;
-    if (value == "Vibraphone") return MIDINAMES_Vibraphone;
-    if (value == "Marimba") return MIDINAMES_Marimba;
-    if (value == "Xylophone") return MIDINAMES_Xylophone;
-    if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
-    if (value == "Dulcimer") return MIDINAMES_Dulcimer;
-    if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
-    if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
-    if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
-    if (value == "Church_Organ") return MIDINAMES_Church_Organ;
-    if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
-    if (value == "Accordion") return MIDINAMES_Accordion;
-    if (value == "Harmonica") return MIDINAMES_Harmonica;
-    if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
-    if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
-    if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
-    if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
-    if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
-    if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
-    if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
-    if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
-    if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
-    if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
-    if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
-    if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
-    if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
-    if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
-    if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
-    if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
-    if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
-    if (value == "Violin") return MIDINAMES_Violin;
-    if (value == "Viola") return MIDINAMES_Viola;
-    if (value == "Cello") return MIDINAMES_Cello;
-    if (value == "Contrabass") return MIDINAMES_Contrabass;
-    if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
-    if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
-    if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
-    if (value == "Timpani") return MIDINAMES_Timpani;
-    if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
-    if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
-    if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
-    if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
-    if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
-    if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
-    if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
-    if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
-    if (value == "Trumpet") return MIDINAMES_Trumpet;
-    if (value == "Trombone") return MIDINAMES_Trombone;
-    if (value == "Tuba") return MIDINAMES_Tuba;
-    if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
-    if (value == "French_Horn") return MIDINAMES_French_Horn;
-    if (value == "Brass_Section") return MIDINAMES_Brass_Section;
-    if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
-    if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
-    if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
-    if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
-    if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
-    if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
-    if (value == "Oboe") return MIDINAMES_Oboe;
-    if (value == "English_Horn") return MIDINAMES_English_Horn;
-    if (value == "Bassoon") return MIDINAMES_Bassoon;
-    if (value == "Clarinet") return MIDINAMES_Clarinet;
-    if (value == "Piccolo") return MIDINAMES_Piccolo;
-    if (value == "Flute") return MIDINAMES_Flute;
-    if (value == "Recorder") return MIDINAMES_Recorder;
-    if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
-    if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
-    if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
-    if (value == "Whistle") return MIDINAMES_Whistle;
-    if (value == "Ocarina") return MIDINAMES_Ocarina;
-    if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
-    if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
-    if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
-    if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
-    if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
-    if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
-    if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
-    if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
-    if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
-    if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
-    if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
-    if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
-    if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
-    if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
-    if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
-    if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
-    if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
-    if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
-    if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
-    if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
-    if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
-    if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
-    if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
-    if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
-    if (value == "Sitar") return MIDINAMES_Sitar;
-    if (value == "Banjo") return MIDINAMES_Banjo;
-    if (value == "Shamisen") return MIDINAMES_Shamisen;
-    if (value == "Koto") return MIDINAMES_Koto;
-    if (value == "Kalimba") return MIDINAMES_Kalimba;
-    if (value == "Bagpipe") return MIDINAMES_Bagpipe;
-    if (value == "Fiddle") return MIDINAMES_Fiddle;
-    if (value == "Shanai") return MIDINAMES_Shanai;
-    if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
-    if (value == "Agogo") return MIDINAMES_Agogo;
-    if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
-    if (value == "Woodblock") return MIDINAMES_Woodblock;
-    if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
-    if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
-    if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
-    if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
-    if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
-    if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
-    if (value == "Seashore") return MIDINAMES_Seashore;
-    if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
-    if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
-    if (value == "Helicopter") return MIDINAMES_Helicopter;
-    if (value == "Applause") return MIDINAMES_Applause;
-    if (value == "Gunshot") return MIDINAMES_Gunshot;
-    if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
-    if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
-    if (value == "Side_Stick") return MIDINAMES_Side_Stick;
-    if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
-    if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
-    if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
-    if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
-    if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
-    if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
-    if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
-    if (value == "Low_Tom") return MIDINAMES_Low_Tom;
-    if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
-    if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
-    if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
-    if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
-    if (value == "High_Tom") return MIDINAMES_High_Tom;
-    if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
-    if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
-    if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
-    if (value == "Tambourine") return MIDINAMES_Tambourine;
-    if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
-    if (value == "Cowbell") return MIDINAMES_Cowbell;
-    if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
-    if (value == "Vibraslap") return MIDINAMES_Vibraslap;
-    if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
-    if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
-    if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
-    if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
-    if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
-    if (value == "Low_Conga") return MIDINAMES_Low_Conga;
-    if (value == "High_Timbale") return MIDINAMES_High_Timbale;
-    if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
-    if (value == "High_Agogo") return MIDINAMES_High_Agogo;
-    if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
-    if (value == "Cabasa") return MIDINAMES_Cabasa;
-    if (value == "Maracas") return MIDINAMES_Maracas;
-    if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
-    if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
-    if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
-    if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
-    if (value == "Claves") return MIDINAMES_Claves;
-    if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
-    if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
-    if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
-    if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
-    if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
-    if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MIDINAMES", value.c_str());
+    static constexpr const char *values[MIDINAMES_MAX] = {
+        "", "Acoustic_Grand_Piano", "Bright_Acoustic_Piano", "Electric_Grand_Piano", "Honky-tonk_Piano",
+        "Electric_Piano_1", "Electric_Piano_2", "Harpsichord", "Clavi", "Celesta", "Glockenspiel", "Music_Box",
+        "Vibraphone", "Marimba", "Xylophone", "Tubular_Bells", "Dulcimer", "Drawbar_Organ", "Percussive_Organ",
+        "Rock_Organ", "Church_Organ", "Reed_Organ", "Accordion", "Harmonica", "Tango_Accordion",
+        "Acoustic_Guitar_nylon", "Acoustic_Guitar_steel", "Electric_Guitar_jazz", "Electric_Guitar_clean",
+        "Electric_Guitar_muted", "Overdriven_Guitar", "Distortion_Guitar", "Guitar_harmonics", "Acoustic_Bass",
+        "Electric_Bass_finger", "Electric_Bass_pick", "Fretless_Bass", "Slap_Bass_1", "Slap_Bass_2", "Synth_Bass_1",
+        "Synth_Bass_2", "Violin", "Viola", "Cello", "Contrabass", "Tremolo_Strings", "Pizzicato_Strings",
+        "Orchestral_Harp", "Timpani", "String_Ensemble_1", "String_Ensemble_2", "SynthStrings_1", "SynthStrings_2",
+        "Choir_Aahs", "Voice_Oohs", "Synth_Voice", "Orchestra_Hit", "Trumpet", "Trombone", "Tuba", "Muted_Trumpet",
+        "French_Horn", "Brass_Section", "SynthBrass_1", "SynthBrass_2", "Soprano_Sax", "Alto_Sax", "Tenor_Sax",
+        "Baritone_Sax", "Oboe", "English_Horn", "Bassoon", "Clarinet", "Piccolo", "Flute", "Recorder", "Pan_Flute",
+        "Blown_Bottle", "Shakuhachi", "Whistle", "Ocarina", "Lead_1_square", "Lead_2_sawtooth", "Lead_3_calliope",
+        "Lead_4_chiff", "Lead_5_charang", "Lead_6_voice", "Lead_7_fifths", "Lead_8_bass_and_lead", "Pad_1_new_age",
+        "Pad_2_warm", "Pad_3_polysynth", "Pad_4_choir", "Pad_5_bowed", "Pad_6_metallic", "Pad_7_halo", "Pad_8_sweep",
+        "FX_1_rain", "FX_2_soundtrack", "FX_3_crystal", "FX_4_atmosphere", "FX_5_brightness", "FX_6_goblins",
+        "FX_7_echoes", "FX_8_sci-fi", "Sitar", "Banjo", "Shamisen", "Koto", "Kalimba", "Bagpipe", "Fiddle", "Shanai",
+        "Tinkle_Bell", "Agogo", "Steel_Drums", "Woodblock", "Taiko_Drum", "Melodic_Tom", "Synth_Drum", "Reverse_Cymbal",
+        "Guitar_Fret_Noise", "Breath_Noise", "Seashore", "Bird_Tweet", "Telephone_Ring", "Helicopter", "Applause",
+        "Gunshot", "Acoustic_Bass_Drum", "Bass_Drum_1", "Side_Stick", "Acoustic_Snare", "Hand_Clap", "Electric_Snare",
+        "Low_Floor_Tom", "Closed_Hi_Hat", "High_Floor_Tom", "Pedal_Hi-Hat", "Low_Tom", "Open_Hi-Hat", "Low-Mid_Tom",
+        "Hi-Mid_Tom", "Crash_Cymbal_1", "High_Tom", "Ride_Cymbal_1", "Chinese_Cymbal", "Ride_Bell", "Tambourine",
+        "Splash_Cymbal", "Cowbell", "Crash_Cymbal_2", "Vibraslap", "Ride_Cymbal_2", "Hi_Bongo", "Low_Bongo",
+        "Mute_Hi_Conga", "Open_Hi_Conga", "Low_Conga", "High_Timbale", "Low_Timbale", "High_Agogo", "Low_Agogo",
+        "Cabasa", "Maracas", "Short_Whistle", "Long_Whistle", "Short_Guiro", "Long_Guiro", "Claves", "Hi_Wood_Block",
+        "Low_Wood_Block", "Mute_Cuica", "Open_Cuica", "Mute_Triangle", "Open_Triangle"
+    };
+    if ((data <= MIDINAMES_NONE) || (data >= MIDINAMES_MAX)) {
+        LogWarning("Unknown value '%d' for data.MIDINAMES", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_MIDINAMES AttConverter::StrToMidinames(const std::string &value, bool logWarning) const
+{
+    return StrToMidinames(value.c_str(), logWarning);
+}
+
+data_MIDINAMES AttConverter::StrToMidinames(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_MIDINAMES> table[256] = {
+        { "Splash_Cymbal", MIDINAMES_Splash_Cymbal }, { "Whistle", MIDINAMES_Whistle }, { "", MIDINAMES_NONE },
+        { "Electric_Guitar_clean", MIDINAMES_Electric_Guitar_clean }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Helicopter", MIDINAMES_Helicopter }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Cello", MIDINAMES_Cello }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Lead_2_sawtooth", MIDINAMES_Lead_2_sawtooth }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "French_Horn", MIDINAMES_French_Horn }, { "SynthBrass_1", MIDINAMES_SynthBrass_1 },
+        { "Low_Timbale", MIDINAMES_Low_Timbale }, { "", MIDINAMES_NONE }, { "Tinkle_Bell", MIDINAMES_Tinkle_Bell },
+        { "Electric_Guitar_muted", MIDINAMES_Electric_Guitar_muted }, { "Timpani", MIDINAMES_Timpani },
+        { "Synth_Bass_2", MIDINAMES_Synth_Bass_2 }, { "", MIDINAMES_NONE }, { "Piccolo", MIDINAMES_Piccolo },
+        { "Tuba", MIDINAMES_Tuba }, { "FX_8_sci-fi", MIDINAMES_FX_8_sci_fi }, { "", MIDINAMES_NONE },
+        { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Mute_Triangle", MIDINAMES_Mute_Triangle }, { "", MIDINAMES_NONE }, { "High_Tom", MIDINAMES_High_Tom },
+        { "FX_2_soundtrack", MIDINAMES_FX_2_soundtrack }, { "Tambourine", MIDINAMES_Tambourine },
+        { "", MIDINAMES_NONE }, { "SynthStrings_2", MIDINAMES_SynthStrings_2 }, { "Music_Box", MIDINAMES_Music_Box },
+        { "", MIDINAMES_NONE }, { "Baritone_Sax", MIDINAMES_Baritone_Sax }, { "", MIDINAMES_NONE },
+        { "", MIDINAMES_NONE }, { "Bird_Tweet", MIDINAMES_Bird_Tweet }, { "FX_3_crystal", MIDINAMES_FX_3_crystal },
+        { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE }, { "Voice_Oohs", MIDINAMES_Voice_Oohs },
+        { "Bassoon", MIDINAMES_Bassoon }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Guitar_Fret_Noise", MIDINAMES_Guitar_Fret_Noise }, { "Chinese_Cymbal", MIDINAMES_Chinese_Cymbal },
+        { "Tango_Accordion", MIDINAMES_Tango_Accordion }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Orchestral_Harp", MIDINAMES_Orchestral_Harp }, { "Guitar_harmonics", MIDINAMES_Guitar_harmonics },
+        { "Clavi", MIDINAMES_Clavi }, { "Harpsichord", MIDINAMES_Harpsichord },
+        { "Lead_7_fifths", MIDINAMES_Lead_7_fifths }, { "Clarinet", MIDINAMES_Clarinet },
+        { "Low_Bongo", MIDINAMES_Low_Bongo }, { "Drawbar_Organ", MIDINAMES_Drawbar_Organ },
+        { "Acoustic_Snare", MIDINAMES_Acoustic_Snare }, { "FX_1_rain", MIDINAMES_FX_1_rain },
+        { "Electric_Bass_finger", MIDINAMES_Electric_Bass_finger }, { "Crash_Cymbal_1", MIDINAMES_Crash_Cymbal_1 },
+        { "Distortion_Guitar", MIDINAMES_Distortion_Guitar }, { "Breath_Noise", MIDINAMES_Breath_Noise },
+        { "Pad_4_choir", MIDINAMES_Pad_4_choir }, { "Open_Triangle", MIDINAMES_Open_Triangle },
+        { "Overdriven_Guitar", MIDINAMES_Overdriven_Guitar }, { "Applause", MIDINAMES_Applause },
+        { "", MIDINAMES_NONE }, { "Low_Floor_Tom", MIDINAMES_Low_Floor_Tom }, { "Gunshot", MIDINAMES_Gunshot },
+        { "Electric_Guitar_jazz", MIDINAMES_Electric_Guitar_jazz }, { "", MIDINAMES_NONE },
+        { "Kalimba", MIDINAMES_Kalimba }, { "Contrabass", MIDINAMES_Contrabass }, { "Agogo", MIDINAMES_Agogo },
+        { "FX_7_echoes", MIDINAMES_FX_7_echoes }, { "Long_Whistle", MIDINAMES_Long_Whistle },
+        { "Synth_Drum", MIDINAMES_Synth_Drum }, { "Electric_Snare", MIDINAMES_Electric_Snare },
+        { "String_Ensemble_2", MIDINAMES_String_Ensemble_2 }, { "Flute", MIDINAMES_Flute },
+        { "Brass_Section", MIDINAMES_Brass_Section }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "", MIDINAMES_NONE }, { "Tremolo_Strings", MIDINAMES_Tremolo_Strings },
+        { "Lead_3_calliope", MIDINAMES_Lead_3_calliope }, { "Tenor_Sax", MIDINAMES_Tenor_Sax },
+        { "Fiddle", MIDINAMES_Fiddle }, { "", MIDINAMES_NONE }, { "Ride_Bell", MIDINAMES_Ride_Bell },
+        { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Muted_Trumpet", MIDINAMES_Muted_Trumpet }, { "Shanai", MIDINAMES_Shanai },
+        { "Slap_Bass_2", MIDINAMES_Slap_Bass_2 }, { "", MIDINAMES_NONE },
+        { "Lead_5_charang", MIDINAMES_Lead_5_charang }, { "", MIDINAMES_NONE },
+        { "Pedal_Hi-Hat", MIDINAMES_Pedal_Hi_Hat }, { "SynthStrings_1", MIDINAMES_SynthStrings_1 },
+        { "High_Agogo", MIDINAMES_High_Agogo }, { "Bagpipe", MIDINAMES_Bagpipe },
+        { "Long_Guiro", MIDINAMES_Long_Guiro }, { "Low_Tom", MIDINAMES_Low_Tom }, { "Pan_Flute", MIDINAMES_Pan_Flute },
+        { "Ride_Cymbal_2", MIDINAMES_Ride_Cymbal_2 }, { "Choir_Aahs", MIDINAMES_Choir_Aahs }, { "", MIDINAMES_NONE },
+        { "", MIDINAMES_NONE }, { "Accordion", MIDINAMES_Accordion }, { "Church_Organ", MIDINAMES_Church_Organ },
+        { "Electric_Piano_2", MIDINAMES_Electric_Piano_2 }, { "Taiko_Drum", MIDINAMES_Taiko_Drum },
+        { "Electric_Bass_pick", MIDINAMES_Electric_Bass_pick }, { "Acoustic_Bass", MIDINAMES_Acoustic_Bass },
+        { "Shamisen", MIDINAMES_Shamisen }, { "SynthBrass_2", MIDINAMES_SynthBrass_2 },
+        { "Hand_Clap", MIDINAMES_Hand_Clap }, { "Reed_Organ", MIDINAMES_Reed_Organ },
+        { "Dulcimer", MIDINAMES_Dulcimer }, { "Orchestra_Hit", MIDINAMES_Orchestra_Hit }, { "", MIDINAMES_NONE },
+        { "FX_6_goblins", MIDINAMES_FX_6_goblins }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Tubular_Bells", MIDINAMES_Tubular_Bells }, { "Electric_Piano_1", MIDINAMES_Electric_Piano_1 },
+        { "Side_Stick", MIDINAMES_Side_Stick }, { "Pad_3_polysynth", MIDINAMES_Pad_3_polysynth },
+        { "Seashore", MIDINAMES_Seashore }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Bass_Drum_1", MIDINAMES_Bass_Drum_1 }, { "Fretless_Bass", MIDINAMES_Fretless_Bass },
+        { "Pad_1_new_age", MIDINAMES_Pad_1_new_age }, { "Lead_1_square", MIDINAMES_Lead_1_square },
+        { "", MIDINAMES_NONE }, { "Slap_Bass_1", MIDINAMES_Slap_Bass_1 },
+        { "Electric_Grand_Piano", MIDINAMES_Electric_Grand_Piano }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Low_Conga", MIDINAMES_Low_Conga }, { "Pad_2_warm", MIDINAMES_Pad_2_warm }, { "Marimba", MIDINAMES_Marimba },
+        { "English_Horn", MIDINAMES_English_Horn }, { "Claves", MIDINAMES_Claves },
+        { "Hi-Mid_Tom", MIDINAMES_Hi_Mid_Tom }, { "", MIDINAMES_NONE }, { "Trumpet", MIDINAMES_Trumpet },
+        { "Open_Cuica", MIDINAMES_Open_Cuica }, { "", MIDINAMES_NONE }, { "Short_Guiro", MIDINAMES_Short_Guiro },
+        { "", MIDINAMES_NONE }, { "Pizzicato_Strings", MIDINAMES_Pizzicato_Strings }, { "", MIDINAMES_NONE },
+        { "High_Timbale", MIDINAMES_High_Timbale }, { "", MIDINAMES_NONE }, { "Banjo", MIDINAMES_Banjo },
+        { "Glockenspiel", MIDINAMES_Glockenspiel }, { "Hi_Bongo", MIDINAMES_Hi_Bongo },
+        { "Acoustic_Bass_Drum", MIDINAMES_Acoustic_Bass_Drum },
+        { "Acoustic_Guitar_steel", MIDINAMES_Acoustic_Guitar_steel }, { "Trombone", MIDINAMES_Trombone },
+        { "Steel_Drums", MIDINAMES_Steel_Drums }, { "", MIDINAMES_NONE }, { "Soprano_Sax", MIDINAMES_Soprano_Sax },
+        { "Vibraphone", MIDINAMES_Vibraphone }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "String_Ensemble_1", MIDINAMES_String_Ensemble_1 }, { "Pad_5_bowed", MIDINAMES_Pad_5_bowed },
+        { "Blown_Bottle", MIDINAMES_Blown_Bottle }, { "FX_5_brightness", MIDINAMES_FX_5_brightness },
+        { "", MIDINAMES_NONE }, { "Cabasa", MIDINAMES_Cabasa }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Oboe", MIDINAMES_Oboe }, { "Low_Agogo", MIDINAMES_Low_Agogo }, { "Alto_Sax", MIDINAMES_Alto_Sax },
+        { "", MIDINAMES_NONE }, { "Hi_Wood_Block", MIDINAMES_Hi_Wood_Block }, { "Harmonica", MIDINAMES_Harmonica },
+        { "", MIDINAMES_NONE }, { "Viola", MIDINAMES_Viola }, { "Rock_Organ", MIDINAMES_Rock_Organ },
+        { "", MIDINAMES_NONE }, { "Violin", MIDINAMES_Violin }, { "Open_Hi_Conga", MIDINAMES_Open_Hi_Conga },
+        { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE }, { "Vibraslap", MIDINAMES_Vibraslap },
+        { "Low-Mid_Tom", MIDINAMES_Low_Mid_Tom }, { "Ride_Cymbal_1", MIDINAMES_Ride_Cymbal_1 },
+        { "Sitar", MIDINAMES_Sitar }, { "Percussive_Organ", MIDINAMES_Percussive_Organ },
+        { "FX_4_atmosphere", MIDINAMES_FX_4_atmosphere }, { "", MIDINAMES_NONE },
+        { "Shakuhachi", MIDINAMES_Shakuhachi }, { "Synth_Bass_1", MIDINAMES_Synth_Bass_1 },
+        { "High_Floor_Tom", MIDINAMES_High_Floor_Tom }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "", MIDINAMES_NONE }, { "Acoustic_Grand_Piano", MIDINAMES_Acoustic_Grand_Piano },
+        { "Open_Hi-Hat", MIDINAMES_Open_Hi_Hat }, { "Cowbell", MIDINAMES_Cowbell },
+        { "Mute_Cuica", MIDINAMES_Mute_Cuica }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Lead_6_voice", MIDINAMES_Lead_6_voice }, { "Honky-tonk_Piano", MIDINAMES_Honky_tonk_Piano },
+        { "Lead_8_bass_and_lead", MIDINAMES_Lead_8_bass_and_lead }, { "Koto", MIDINAMES_Koto }, { "", MIDINAMES_NONE },
+        { "Lead_4_chiff", MIDINAMES_Lead_4_chiff }, { "", MIDINAMES_NONE }, { "", MIDINAMES_NONE },
+        { "Pad_8_sweep", MIDINAMES_Pad_8_sweep }, { "Bright_Acoustic_Piano", MIDINAMES_Bright_Acoustic_Piano },
+        { "", MIDINAMES_NONE }, { "Pad_6_metallic", MIDINAMES_Pad_6_metallic },
+        { "Closed_Hi_Hat", MIDINAMES_Closed_Hi_Hat }, { "Low_Wood_Block", MIDINAMES_Low_Wood_Block },
+        { "", MIDINAMES_NONE }, { "Ocarina", MIDINAMES_Ocarina }, { "Crash_Cymbal_2", MIDINAMES_Crash_Cymbal_2 },
+        { "", MIDINAMES_NONE }, { "Acoustic_Guitar_nylon", MIDINAMES_Acoustic_Guitar_nylon },
+        { "Celesta", MIDINAMES_Celesta }, { "", MIDINAMES_NONE }, { "Recorder", MIDINAMES_Recorder },
+        { "", MIDINAMES_NONE }, { "Melodic_Tom", MIDINAMES_Melodic_Tom },
+        { "Telephone_Ring", MIDINAMES_Telephone_Ring }, { "Maracas", MIDINAMES_Maracas },
+        { "Mute_Hi_Conga", MIDINAMES_Mute_Hi_Conga }, { "Synth_Voice", MIDINAMES_Synth_Voice },
+        { "Short_Whistle", MIDINAMES_Short_Whistle }, { "Reverse_Cymbal", MIDINAMES_Reverse_Cymbal },
+        { "Pad_7_halo", MIDINAMES_Pad_7_halo }, { "", MIDINAMES_NONE }, { "Woodblock", MIDINAMES_Woodblock },
+        { "", MIDINAMES_NONE }, { "Xylophone", MIDINAMES_Xylophone }, { "", MIDINAMES_NONE }
+    };
+    static constexpr uint16_t seeds[64] = {
+        1, 2, 4, 3, 3, 1, 0, 8, 0, 6, 1, 1, 3, 3, 3, 0, 0, 9, 1, 4, 1, 4, 5, 9, 2, 2, 1, 3, 9, 0, 5, 7, 3, 1, 0, 2, 3,
+        3, 1, 6, 1, 6, 7, 1, 5, 1, 14, 0, 1, 2, 7, 1, 1, 0, 9, 4, 7, 0, 2, 2, 0, 0, 1, 14
+    };
+    const uint16_t seed = seeds[HashToken(value, 0) & 63];
+    const auto &entry = table[HashToken(value, seed) & 255];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.MIDINAMES", value);
     return MIDINAMES_NONE;
 }
 
 std::string AttConverter::ModeToStr(data_MODE data) const
 {
-    std::string value;
-    switch (data) {
-        case MODE_major: value = "major"; break;
-        case MODE_minor: value = "minor"; break;
-        case MODE_dorian: value = "dorian"; break;
-        case MODE_phrygian: value = "phrygian"; break;
-        case MODE_lydian: value = "lydian"; break;
-        case MODE_mixolydian: value = "mixolydian"; break;
-        case MODE_aeolian: value = "aeolian"; break;
-        case MODE_locrian: value = "locrian"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.MODE", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_MODE AttConverter::StrToMode(std::string value, bool logWarning) const
-{
-    if (value == "major") return MODE_major;
-    if (value == "minor") return MODE_minor;
-    if (value == "dorian") return MODE_dorian;
-    if (value == "phrygian") return MODE_phrygian;
-    if (value == "lydian") return MODE_lydian;
-    if (value == "mixolydian") return MODE_mixolydian;
-    if (value == "aeolian") return MODE_aeolian;
-    if (value == "locrian") return MODE_locrian;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MODE", value.c_str());
+    static constexpr const char *values[MODE_MAX] = {
+        "", "major", "minor", "dorian", "phrygian", "lydian", "mixolydian", "aeolian", "locrian"
+    };
+    if ((data <= MODE_NONE) || (data >= MODE_MAX)) {
+        LogWarning("Unknown value '%d' for data.MODE", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_MODE AttConverter::StrToMode(const std::string &value, bool logWarning) const
+{
+    return StrToMode(value.c_str(), logWarning);
+}
+
+data_MODE AttConverter::StrToMode(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_MODE> table[8] = {
+        { "aeolian", MODE_aeolian }, { "phrygian", MODE_phrygian }, { "lydian", MODE_lydian },
+        { "dorian", MODE_dorian }, { "major", MODE_major }, { "locrian", MODE_locrian },
+        { "mixolydian", MODE_mixolydian }, { "minor", MODE_minor }
+    };
+    static constexpr uint16_t seeds[4] = { 0, 2, 3, 3 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.MODE", value);
     return MODE_NONE;
 }
 
 std::string AttConverter::ModsrelationshipToStr(data_MODSRELATIONSHIP data) const
 {
-    std::string value;
-    switch (data) {
-        case MODSRELATIONSHIP_preceding: value = "preceding"; break;
-        case MODSRELATIONSHIP_succeeding: value = "succeeding"; break;
-        case MODSRELATIONSHIP_original: value = "original"; break;
-        case MODSRELATIONSHIP_host: value = "host"; break;
-        case MODSRELATIONSHIP_constituent: value = "constituent"; break;
-        case MODSRELATIONSHIP_otherVersion: value = "otherVersion"; break;
-        case MODSRELATIONSHIP_otherFormat: value = "otherFormat"; break;
-        case MODSRELATIONSHIP_isReferencedBy: value = "isReferencedBy"; break;
-        case MODSRELATIONSHIP_references: value = "references"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.MODSRELATIONSHIP", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_MODSRELATIONSHIP AttConverter::StrToModsrelationship(std::string value, bool logWarning) const
-{
-    if (value == "preceding") return MODSRELATIONSHIP_preceding;
-    if (value == "succeeding") return MODSRELATIONSHIP_succeeding;
-    if (value == "original") return MODSRELATIONSHIP_original;
-    if (value == "host") return MODSRELATIONSHIP_host;
-    if (value == "constituent") return MODSRELATIONSHIP_constituent;
-    if (value == "otherVersion") return MODSRELATIONSHIP_otherVersion;
-    if (value == "otherFormat") return MODSRELATIONSHIP_otherFormat;
-    if (value == "isReferencedBy") return MODSRELATIONSHIP_isReferencedBy;
-    if (value == "references") return MODSRELATIONSHIP_references;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MODSRELATIONSHIP", value.c_str());
+    static constexpr const char *values[MODSRELATIONSHIP_MAX] = {
+        "", "preceding", "succeeding", "original", "host", "constituent", "otherVersion", "otherFormat",
+        "isReferencedBy", "references"
+    };
+    if ((data <= MODSRELATIONSHIP_NONE) || (data >= MODSRELATIONSHIP_MAX)) {
+        LogWarning("Unknown value '%d' for data.MODSRELATIONSHIP", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_MODSRELATIONSHIP AttConverter::StrToModsrelationship(const std::string &value, bool logWarning) const
+{
+    return StrToModsrelationship(value.c_str(), logWarning);
+}
+
+data_MODSRELATIONSHIP AttConverter::StrToModsrelationship(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_MODSRELATIONSHIP> table[16] = {
+        { "succeeding", MODSRELATIONSHIP_succeeding }, { "", MODSRELATIONSHIP_NONE },
+        { "original", MODSRELATIONSHIP_original }, { "host", MODSRELATIONSHIP_host }, { "", MODSRELATIONSHIP_NONE },
+        { "", MODSRELATIONSHIP_NONE }, { "otherVersion", MODSRELATIONSHIP_otherVersion }, { "", MODSRELATIONSHIP_NONE },
+        { "references", MODSRELATIONSHIP_references }, { "constituent", MODSRELATIONSHIP_constituent },
+        { "otherFormat", MODSRELATIONSHIP_otherFormat }, { "isReferencedBy", MODSRELATIONSHIP_isReferencedBy },
+        { "", MODSRELATIONSHIP_NONE }, { "", MODSRELATIONSHIP_NONE }, { "preceding", MODSRELATIONSHIP_preceding },
+        { "", MODSRELATIONSHIP_NONE }
+    };
+    static constexpr uint16_t seeds[4] = { 8, 1, 0, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.MODSRELATIONSHIP", value);
     return MODSRELATIONSHIP_NONE;
 }
 
 std::string AttConverter::NonstaffplaceToStr(data_NONSTAFFPLACE data) const
 {
-    std::string value;
-    switch (data) {
-        case NONSTAFFPLACE_botmar: value = "botmar"; break;
-        case NONSTAFFPLACE_topmar: value = "topmar"; break;
-        case NONSTAFFPLACE_leftmar: value = "leftmar"; break;
-        case NONSTAFFPLACE_rightmar: value = "rightmar"; break;
-        case NONSTAFFPLACE_facing: value = "facing"; break;
-        case NONSTAFFPLACE_overleaf: value = "overleaf"; break;
-        case NONSTAFFPLACE_end: value = "end"; break;
-        case NONSTAFFPLACE_inter: value = "inter"; break;
-        case NONSTAFFPLACE_intra: value = "intra"; break;
-        case NONSTAFFPLACE_super: value = "super"; break;
-        case NONSTAFFPLACE_sub: value = "sub"; break;
-        case NONSTAFFPLACE_inspace: value = "inspace"; break;
-        case NONSTAFFPLACE_superimposed: value = "superimposed"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.NONSTAFFPLACE", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_NONSTAFFPLACE AttConverter::StrToNonstaffplace(std::string value, bool logWarning) const
-{
-    if (value == "botmar") return NONSTAFFPLACE_botmar;
-    if (value == "topmar") return NONSTAFFPLACE_topmar;
-    if (value == "leftmar") return NONSTAFFPLACE_leftmar;
-    if (value == "rightmar") return NONSTAFFPLACE_rightmar;
-    if (value == "facing") return NONSTAFFPLACE_facing;
-    if (value == "overleaf") return NONSTAFFPLACE_overleaf;
-    if (value == "end") return NONSTAFFPLACE_end;
-    if (value == "inter") return NONSTAFFPLACE_inter;
-    if (value == "intra") return NONSTAFFPLACE_intra;
-    if (value == "super") return NONSTAFFPLACE_super;
-    if (value == "sub") return NONSTAFFPLACE_sub;
-    if (value == "inspace") return NONSTAFFPLACE_inspace;
-    if (value == "superimposed") return NONSTAFFPLACE_superimposed;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NONSTAFFPLACE", value.c_str());
+    static constexpr const char *values[NONSTAFFPLACE_MAX] = {
+        "", "botmar", "topmar", "leftmar", "rightmar", "facing", "overleaf", "end", "inter", "intra", "super", "sub",
+        "inspace", "superimposed"
+    };
+    if ((data <= NONSTAFFPLACE_NONE) || (data >= NONSTAFFPLACE_MAX)) {
+        LogWarning("Unknown value '%d' for data.NONSTAFFPLACE", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_NONSTAFFPLACE AttConverter::StrToNonstaffplace(const std::string &value, bool logWarning) const
+{
+    return StrToNonstaffplace(value.c_str(), logWarning);
+}
+
+data_NONSTAFFPLACE AttConverter::StrToNonstaffplace(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_NONSTAFFPLACE> table[16] = {
+        { "topmar", NONSTAFFPLACE_topmar }, { "rightmar", NONSTAFFPLACE_rightmar }, { "intra", NONSTAFFPLACE_intra },
+        { "inspace", NONSTAFFPLACE_inspace }, { "inter", NONSTAFFPLACE_inter }, { "super", NONSTAFFPLACE_super },
+        { "end", NONSTAFFPLACE_end }, { "", NONSTAFFPLACE_NONE }, { "superimposed", NONSTAFFPLACE_superimposed },
+        { "leftmar", NONSTAFFPLACE_leftmar }, { "botmar", NONSTAFFPLACE_botmar }, { "", NONSTAFFPLACE_NONE },
+        { "", NONSTAFFPLACE_NONE }, { "sub", NONSTAFFPLACE_sub }, { "overleaf", NONSTAFFPLACE_overleaf },
+        { "facing", NONSTAFFPLACE_facing }
+    };
+    static constexpr uint16_t seeds[8] = { 0, 2, 1, 9, 3, 0, 1, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.NONSTAFFPLACE", value);
     return NONSTAFFPLACE_NONE;
 }
 
 std::string AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
 {
-    std::string value;
-    switch (data) {
-        case NOTATIONTYPE_cmn: value = "cmn"; break;
-        case NOTATIONTYPE_mensural: value = "mensural"; break;
-        case NOTATIONTYPE_mensural_black: value = "mensural.black"; break;
-        case NOTATIONTYPE_mensural_white: value = "mensural.white"; break;
-        case NOTATIONTYPE_neume: value = "neume"; break;
-        case NOTATIONTYPE_tab: value = "tab"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.NOTATIONTYPE", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string value, bool logWarning) const
-{
-    if (value == "cmn") return NOTATIONTYPE_cmn;
-    if (value == "mensural") return NOTATIONTYPE_mensural;
-    if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
-    if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
-    if (value == "neume") return NOTATIONTYPE_neume;
-    if (value == "tab") return NOTATIONTYPE_tab;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value.c_str());
+    static constexpr const char *values[NOTATIONTYPE_MAX] = {
+        "", "cmn", "mensural", "mensural.black", "mensural.white", "neume", "tab"
+    };
+    if ((data <= NOTATIONTYPE_NONE) || (data >= NOTATIONTYPE_MAX)) {
+        LogWarning("Unknown value '%d' for data.NOTATIONTYPE", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_NOTATIONTYPE AttConverter::StrToNotationtype(const std::string &value, bool logWarning) const
+{
+    return StrToNotationtype(value.c_str(), logWarning);
+}
+
+data_NOTATIONTYPE AttConverter::StrToNotationtype(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_NOTATIONTYPE> table[8] = {
+        { "cmn", NOTATIONTYPE_cmn }, { "mensural", NOTATIONTYPE_mensural }, { "", NOTATIONTYPE_NONE },
+        { "neume", NOTATIONTYPE_neume }, { "mensural.white", NOTATIONTYPE_mensural_white },
+        { "mensural.black", NOTATIONTYPE_mensural_black }, { "", NOTATIONTYPE_NONE }, { "tab", NOTATIONTYPE_tab }
+    };
+    static constexpr uint16_t seeds[2] = { 0, 1 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value);
     return NOTATIONTYPE_NONE;
 }
 
 std::string AttConverter::NoteheadmodifierToStr(data_NOTEHEADMODIFIER data) const
 {
-    std::string value;
-    switch (data) {
-        case NOTEHEADMODIFIER_slash: value = "slash"; break;
-        case NOTEHEADMODIFIER_backslash: value = "backslash"; break;
-        case NOTEHEADMODIFIER_vline: value = "vline"; break;
-        case NOTEHEADMODIFIER_hline: value = "hline"; break;
-        case NOTEHEADMODIFIER_centerdot: value = "centerdot"; break;
-        case NOTEHEADMODIFIER_paren: value = "paren"; break;
-        case NOTEHEADMODIFIER_brack: value = "brack"; break;
-        case NOTEHEADMODIFIER_box: value = "box"; break;
-        case NOTEHEADMODIFIER_circle: value = "circle"; break;
-        case NOTEHEADMODIFIER_dblwhole: value = "dblwhole"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.NOTEHEADMODIFIER", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_NOTEHEADMODIFIER AttConverter::StrToNoteheadmodifier(std::string value, bool logWarning) const
-{
-    if (value == "slash") return NOTEHEADMODIFIER_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_brack;
-    if (value == "box") return NOTEHEADMODIFIER_box;
-    if (value == "circle") return NOTEHEADMODIFIER_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_dblwhole;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER", value.c_str());
+    static constexpr const char *values[NOTEHEADMODIFIER_MAX] = {
+        "", "slash", "backslash", "vline", "hline", "centerdot", "paren", "brack", "box", "circle", "dblwhole"
+    };
+    if ((data <= NOTEHEADMODIFIER_NONE) || (data >= NOTEHEADMODIFIER_MAX)) {
+        LogWarning("Unknown value '%d' for data.NOTEHEADMODIFIER", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_NOTEHEADMODIFIER AttConverter::StrToNoteheadmodifier(const std::string &value, bool logWarning) const
+{
+    return StrToNoteheadmodifier(value.c_str(), logWarning);
+}
+
+data_NOTEHEADMODIFIER AttConverter::StrToNoteheadmodifier(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_NOTEHEADMODIFIER> table[16] = {
+        { "", NOTEHEADMODIFIER_NONE }, { "", NOTEHEADMODIFIER_NONE }, { "", NOTEHEADMODIFIER_NONE },
+        { "backslash", NOTEHEADMODIFIER_backslash }, { "", NOTEHEADMODIFIER_NONE }, { "", NOTEHEADMODIFIER_NONE },
+        { "hline", NOTEHEADMODIFIER_hline }, { "", NOTEHEADMODIFIER_NONE }, { "vline", NOTEHEADMODIFIER_vline },
+        { "slash", NOTEHEADMODIFIER_slash }, { "dblwhole", NOTEHEADMODIFIER_dblwhole },
+        { "brack", NOTEHEADMODIFIER_brack }, { "box", NOTEHEADMODIFIER_box }, { "circle", NOTEHEADMODIFIER_circle },
+        { "paren", NOTEHEADMODIFIER_paren }, { "centerdot", NOTEHEADMODIFIER_centerdot }
+    };
+    static constexpr uint16_t seeds[4] = { 2, 0, 10, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER", value);
     return NOTEHEADMODIFIER_NONE;
 }
 
 std::string AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list data) const
 {
-    std::string value;
-    switch (data) {
-        case NOTEHEADMODIFIER_list_slash: value = "slash"; break;
-        case NOTEHEADMODIFIER_list_backslash: value = "backslash"; break;
-        case NOTEHEADMODIFIER_list_vline: value = "vline"; break;
-        case NOTEHEADMODIFIER_list_hline: value = "hline"; break;
-        case NOTEHEADMODIFIER_list_centerdot: value = "centerdot"; break;
-        case NOTEHEADMODIFIER_list_paren: value = "paren"; break;
-        case NOTEHEADMODIFIER_list_brack: value = "brack"; break;
-        case NOTEHEADMODIFIER_list_box: value = "box"; break;
-        case NOTEHEADMODIFIER_list_circle: value = "circle"; break;
-        case NOTEHEADMODIFIER_list_dblwhole: value = "dblwhole"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.NOTEHEADMODIFIER.list", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string value, bool logWarning) const
-{
-    if (value == "slash") return NOTEHEADMODIFIER_list_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_list_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_list_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_list_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_list_brack;
-    if (value == "box") return NOTEHEADMODIFIER_list_box;
-    if (value == "circle") return NOTEHEADMODIFIER_list_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_list_dblwhole;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value.c_str());
+    static constexpr const char *values[NOTEHEADMODIFIER_list_MAX] = {
+        "", "slash", "backslash", "vline", "hline", "centerdot", "paren", "brack", "box", "circle", "dblwhole"
+    };
+    if ((data <= NOTEHEADMODIFIER_list_NONE) || (data >= NOTEHEADMODIFIER_list_MAX)) {
+        LogWarning("Unknown value '%d' for data.NOTEHEADMODIFIER.list", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(const std::string &value, bool logWarning) const
+{
+    return StrToNoteheadmodifierList(value.c_str(), logWarning);
+}
+
+data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_NOTEHEADMODIFIER_list> table[16] = {
+        { "", NOTEHEADMODIFIER_list_NONE }, { "", NOTEHEADMODIFIER_list_NONE }, { "", NOTEHEADMODIFIER_list_NONE },
+        { "backslash", NOTEHEADMODIFIER_list_backslash }, { "", NOTEHEADMODIFIER_list_NONE },
+        { "", NOTEHEADMODIFIER_list_NONE }, { "hline", NOTEHEADMODIFIER_list_hline },
+        { "", NOTEHEADMODIFIER_list_NONE }, { "vline", NOTEHEADMODIFIER_list_vline },
+        { "slash", NOTEHEADMODIFIER_list_slash }, { "dblwhole", NOTEHEADMODIFIER_list_dblwhole },
+        { "brack", NOTEHEADMODIFIER_list_brack }, { "box", NOTEHEADMODIFIER_list_box },
+        { "circle", NOTEHEADMODIFIER_list_circle }, { "paren", NOTEHEADMODIFIER_list_paren },
+        { "centerdot", NOTEHEADMODIFIER_list_centerdot }
+    };
+    static constexpr uint16_t seeds[4] = { 2, 0, 10, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value);
     return NOTEHEADMODIFIER_list_NONE;
 }
 
 std::string AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
 {
-    std::string value;
-    switch (data) {
-        case OTHERSTAFF_above: value = "above"; break;
-        case OTHERSTAFF_below: value = "below"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.OTHERSTAFF", data);
-            value = "";
-            break;
+    static constexpr const char *values[OTHERSTAFF_MAX] = { "", "above", "below" };
+    if ((data <= OTHERSTAFF_NONE) || (data >= OTHERSTAFF_MAX)) {
+        LogWarning("Unknown value '%d' for data.OTHERSTAFF", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_OTHERSTAFF AttConverter::StrToOtherstaff(const std::string &value, bool logWarning) const
+{
+    return StrToOtherstaff(value.c_str(), logWarning);
 }
 
-data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string value, bool logWarning) const
+data_OTHERSTAFF AttConverter::StrToOtherstaff(const char *value, bool logWarning) const
 {
-    if (value == "above") return OTHERSTAFF_above;
-    if (value == "below") return OTHERSTAFF_below;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value.c_str());
+    static constexpr std::pair<const char *, data_OTHERSTAFF> table[2] = {
+        { "below", OTHERSTAFF_below }, { "above", OTHERSTAFF_above }
+    };
+    const auto &entry = table[HashToken(value, 2) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value);
     return OTHERSTAFF_NONE;
 }
 
 std::string AttConverter::RelationshipToStr(data_RELATIONSHIP data) const
 {
-    std::string value;
-    switch (data) {
-        case RELATIONSHIP_hasAbridgement: value = "hasAbridgement"; break;
-        case RELATIONSHIP_isAbridgementOf: value = "isAbridgementOf"; break;
-        case RELATIONSHIP_hasAdaptation: value = "hasAdaptation"; break;
-        case RELATIONSHIP_isAdaptationOf: value = "isAdaptationOf"; break;
-        case RELATIONSHIP_hasAlternate: value = "hasAlternate"; break;
-        case RELATIONSHIP_isAlternateOf: value = "isAlternateOf"; break;
-        case RELATIONSHIP_hasArrangement: value = "hasArrangement"; break;
-        case RELATIONSHIP_isArrangementOf: value = "isArrangementOf"; break;
-        case RELATIONSHIP_hasComplement: value = "hasComplement"; break;
-        case RELATIONSHIP_isComplementOf: value = "isComplementOf"; break;
-        case RELATIONSHIP_hasEmbodiment: value = "hasEmbodiment"; break;
-        case RELATIONSHIP_isEmbodimentOf: value = "isEmbodimentOf"; break;
-        case RELATIONSHIP_hasExemplar: value = "hasExemplar"; break;
-        case RELATIONSHIP_isExemplarOf: value = "isExemplarOf"; break;
-        case RELATIONSHIP_hasImitation: value = "hasImitation"; break;
-        case RELATIONSHIP_isImitationOf: value = "isImitationOf"; break;
-        case RELATIONSHIP_hasPart: value = "hasPart"; break;
-        case RELATIONSHIP_isPartOf: value = "isPartOf"; break;
-        case RELATIONSHIP_hasRealization: value = "hasRealization"; break;
-        case RELATIONSHIP_isRealizationOf: value = "isRealizationOf"; break;
-        case RELATIONSHIP_hasReconfiguration: value = "hasReconfiguration"; break;
-        case RELATIONSHIP_isReconfigurationOf: value = "isReconfigurationOf"; break;
-        case RELATIONSHIP_hasReproduction: value = "hasReproduction"; break;
-        case RELATIONSHIP_isReproductionOf: value = "isReproductionOf"; break;
-        case RELATIONSHIP_hasRevision: value = "hasRevision"; break;
-        case RELATIONSHIP_isRevisionOf: value = "isRevisionOf"; break;
-        case RELATIONSHIP_hasSuccessor: value = "hasSuccessor"; break;
-        case RELATIONSHIP_isSuccessorOf: value = "isSuccessorOf"; break;
-        case RELATIONSHIP_hasSummarization: value = "hasSummarization"; break;
-        case RELATIONSHIP_isSummarizationOf: value = "isSummarizationOf"; break;
-        case RELATIONSHIP_hasSupplement: value = "hasSupplement"; break;
-        case RELATIONSHIP_isSupplementOf: value = "isSupplementOf"; break;
-        case RELATIONSHIP_hasTransformation: value = "hasTransformation"; break;
-        case RELATIONSHIP_isTransformationOf: value = "isTransformationOf"; break;
-        case RELATIONSHIP_hasTranslation: value = "hasTranslation"; break;
-        case RELATIONSHIP_isTranslationOf: value = "isTranslationOf"; break;
-        case RELATIONSHIP_preceding: value = "preceding"; break;
-        case RELATIONSHIP_succeeding: value = "succeeding"; break;
-        case RELATIONSHIP_original: value = "original"; break;
-        case RELATIONSHIP_host: value = "host"; break;
-        case RELATIONSHIP_constituent: value = "constituent"; break;
-        case RELATIONSHIP_otherVersion: value = "otherVersion"; break;
-        case RELATIONSHIP_otherFormat: value = "otherFormat"; break;
-        case RELATIONSHIP_isReferencedBy: value = "isReferencedBy"; break;
-        case RELATIONSHIP_references: value = "references"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.RELATIONSHIP", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_RELATIONSHIP AttConverter::StrToRelationship(std::string value, bool logWarning) const
-{
-    if (value == "hasAbridgement") return RELATIONSHIP_hasAbridgement;
-    if (value == "isAbridgementOf") return RELATIONSHIP_isAbridgementOf;
-    if (value == "hasAdaptation") return RELATIONSHIP_hasAdaptation;
-    if (value == "isAdaptationOf") return RELATIONSHIP_isAdaptationOf;
-    if (value == "hasAlternate") return RELATIONSHIP_hasAlternate;
-    if (value == "isAlternateOf") return RELATIONSHIP_isAlternateOf;
-    if (value == "hasArrangement") return RELATIONSHIP_hasArrangement;
-    if (value == "isArrangementOf") return RELATIONSHIP_isArrangementOf;
-    if (value == "hasComplement") return RELATIONSHIP_hasComplement;
-    if (value == "isComplementOf") return RELATIONSHIP_isComplementOf;
-    if (value == "hasEmbodiment") return RELATIONSHIP_hasEmbodiment;
-    if (value == "isEmbodimentOf") return RELATIONSHIP_isEmbodimentOf;
-    if (value == "hasExemplar") return RELATIONSHIP_hasExemplar;
-    if (value == "isExemplarOf") return RELATIONSHIP_isExemplarOf;
-    if (value == "hasImitation") return RELATIONSHIP_hasImitation;
-    if (value == "isImitationOf") return RELATIONSHIP_isImitationOf;
-    if (value == "hasPart") return RELATIONSHIP_hasPart;
-    if (value == "isPartOf") return RELATIONSHIP_isPartOf;
-    if (value == "hasRealization") return RELATIONSHIP_hasRealization;
-    if (value == "isRealizationOf") return RELATIONSHIP_isRealizationOf;
-    if (value == "hasReconfiguration") return RELATIONSHIP_hasReconfiguration;
-    if (value == "isReconfigurationOf") return RELATIONSHIP_isReconfigurationOf;
-    if (value == "hasReproduction") return RELATIONSHIP_hasReproduction;
-    if (value == "isReproductionOf") return RELATIONSHIP_isReproductionOf;
-    if (value == "hasRevision") return RELATIONSHIP_hasRevision;
-    if (value == "isRevisionOf") return RELATIONSHIP_isRevisionOf;
-    if (value == "hasSuccessor") return RELATIONSHIP_hasSuccessor;
-    if (value == "isSuccessorOf") return RELATIONSHIP_isSuccessorOf;
-    if (value == "hasSummarization") return RELATIONSHIP_hasSummarization;
-    if (value == "isSummarizationOf") return RELATIONSHIP_isSummarizationOf;
-    if (value == "hasSupplement") return RELATIONSHIP_hasSupplement;
-    if (value == "isSupplementOf") return RELATIONSHIP_isSupplementOf;
-    if (value == "hasTransformation") return RELATIONSHIP_hasTransformation;
-    if (value == "isTransformationOf") return RELATIONSHIP_isTransformationOf;
-    if (value == "hasTranslation") return RELATIONSHIP_hasTranslation;
-    if (value == "isTranslationOf") return RELATIONSHIP_isTranslationOf;
-    if (value == "preceding") return RELATIONSHIP_preceding;
-    if (value == "succeeding") return RELATIONSHIP_succeeding;
-    if (value == "original") return RELATIONSHIP_original;
-    if (value == "host") return RELATIONSHIP_host;
-    if (value == "constituent") return RELATIONSHIP_constituent;
-    if (value == "otherVersion") return RELATIONSHIP_otherVersion;
-    if (value == "otherFormat") return RELATIONSHIP_otherFormat;
-    if (value == "isReferencedBy") return RELATIONSHIP_isReferencedBy;
-    if (value == "references") return RELATIONSHIP_references;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.RELATIONSHIP", value.c_str());
+    static constexpr const char *values[RELATIONSHIP_MAX] = {
+        "", "hasAbridgement", "isAbridgementOf", "hasAdaptation", "isAdaptationOf", "hasAlternate", "isAlternateOf",
+        "hasArrangement", "isArrangementOf", "hasComplement", "isComplementOf", "hasEmbodiment", "isEmbodimentOf",
+        "hasExemplar", "isExemplarOf", "hasImitation", "isImitationOf", "hasPart", "isPartOf", "hasRealization",
+        "isRealizationOf", "hasReconfiguration", "isReconfigurationOf", "hasReproduction", "isReproductionOf",
+        "hasRevision", "isRevisionOf", "hasSuccessor", "isSuccessorOf", "hasSummarization", "isSummarizationOf",
+        "hasSupplement", "isSupplementOf", "hasTransformation", "isTransformationOf", "hasTranslation",
+        "isTranslationOf", "preceding", "succeeding", "original", "host", "constituent", "otherVersion", "otherFormat",
+        "isReferencedBy", "references"
+    };
+    if ((data <= RELATIONSHIP_NONE) || (data >= RELATIONSHIP_MAX)) {
+        LogWarning("Unknown value '%d' for data.RELATIONSHIP", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_RELATIONSHIP AttConverter::StrToRelationship(const std::string &value, bool logWarning) const
+{
+    return StrToRelationship(value.c_str(), logWarning);
+}
+
+data_RELATIONSHIP AttConverter::StrToRelationship(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_RELATIONSHIP> table[64] = {
+        { "", RELATIONSHIP_NONE }, { "hasAlternate", RELATIONSHIP_hasAlternate }, { "", RELATIONSHIP_NONE },
+        { "hasImitation", RELATIONSHIP_hasImitation }, { "hasReconfiguration", RELATIONSHIP_hasReconfiguration },
+        { "isImitationOf", RELATIONSHIP_isImitationOf }, { "isTranslationOf", RELATIONSHIP_isTranslationOf },
+        { "isPartOf", RELATIONSHIP_isPartOf }, { "", RELATIONSHIP_NONE },
+        { "hasAdaptation", RELATIONSHIP_hasAdaptation }, { "", RELATIONSHIP_NONE }, { "", RELATIONSHIP_NONE },
+        { "", RELATIONSHIP_NONE }, { "original", RELATIONSHIP_original },
+        { "isReproductionOf", RELATIONSHIP_isReproductionOf }, { "", RELATIONSHIP_NONE },
+        { "isAdaptationOf", RELATIONSHIP_isAdaptationOf }, { "", RELATIONSHIP_NONE },
+        { "otherFormat", RELATIONSHIP_otherFormat }, { "hasReproduction", RELATIONSHIP_hasReproduction },
+        { "isArrangementOf", RELATIONSHIP_isArrangementOf }, { "", RELATIONSHIP_NONE },
+        { "hasArrangement", RELATIONSHIP_hasArrangement }, { "", RELATIONSHIP_NONE },
+        { "succeeding", RELATIONSHIP_succeeding }, { "references", RELATIONSHIP_references },
+        { "hasRevision", RELATIONSHIP_hasRevision }, { "isEmbodimentOf", RELATIONSHIP_isEmbodimentOf },
+        { "", RELATIONSHIP_NONE }, { "isReconfigurationOf", RELATIONSHIP_isReconfigurationOf },
+        { "preceding", RELATIONSHIP_preceding }, { "isSuccessorOf", RELATIONSHIP_isSuccessorOf },
+        { "", RELATIONSHIP_NONE }, { "hasTransformation", RELATIONSHIP_hasTransformation },
+        { "hasEmbodiment", RELATIONSHIP_hasEmbodiment }, { "isReferencedBy", RELATIONSHIP_isReferencedBy },
+        { "", RELATIONSHIP_NONE }, { "", RELATIONSHIP_NONE }, { "", RELATIONSHIP_NONE }, { "", RELATIONSHIP_NONE },
+        { "isTransformationOf", RELATIONSHIP_isTransformationOf }, { "isAbridgementOf", RELATIONSHIP_isAbridgementOf },
+        { "hasSuccessor", RELATIONSHIP_hasSuccessor }, { "constituent", RELATIONSHIP_constituent },
+        { "isComplementOf", RELATIONSHIP_isComplementOf }, { "", RELATIONSHIP_NONE },
+        { "isSupplementOf", RELATIONSHIP_isSupplementOf }, { "hasSummarization", RELATIONSHIP_hasSummarization },
+        { "hasRealization", RELATIONSHIP_hasRealization }, { "hasExemplar", RELATIONSHIP_hasExemplar },
+        { "hasTranslation", RELATIONSHIP_hasTranslation }, { "host", RELATIONSHIP_host },
+        { "isExemplarOf", RELATIONSHIP_isExemplarOf }, { "otherVersion", RELATIONSHIP_otherVersion },
+        { "hasSupplement", RELATIONSHIP_hasSupplement }, { "hasComplement", RELATIONSHIP_hasComplement },
+        { "isRevisionOf", RELATIONSHIP_isRevisionOf }, { "", RELATIONSHIP_NONE },
+        { "isRealizationOf", RELATIONSHIP_isRealizationOf }, { "", RELATIONSHIP_NONE },
+        { "isAlternateOf", RELATIONSHIP_isAlternateOf }, { "hasPart", RELATIONSHIP_hasPart },
+        { "isSummarizationOf", RELATIONSHIP_isSummarizationOf }, { "hasAbridgement", RELATIONSHIP_hasAbridgement }
+    };
+    static constexpr uint16_t seeds[16] = { 5, 1, 1, 1, 5, 1, 2, 3, 1, 4, 1, 10, 2, 0, 10, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 63];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.RELATIONSHIP", value);
     return RELATIONSHIP_NONE;
 }
 
 std::string AttConverter::RotationToStr(data_ROTATION data) const
 {
-    std::string value;
-    switch (data) {
-        case ROTATION_none: value = "none"; break;
-        case ROTATION_down: value = "down"; break;
-        case ROTATION_left: value = "left"; break;
-        case ROTATION_ne: value = "ne"; break;
-        case ROTATION_nw: value = "nw"; break;
-        case ROTATION_se: value = "se"; break;
-        case ROTATION_sw: value = "sw"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.ROTATION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ROTATION AttConverter::StrToRotation(std::string value, bool logWarning) const
-{
-    if (value == "none") return ROTATION_none;
-    if (value == "down") return ROTATION_down;
-    if (value == "left") return ROTATION_left;
-    if (value == "ne") return ROTATION_ne;
-    if (value == "nw") return ROTATION_nw;
-    if (value == "se") return ROTATION_se;
-    if (value == "sw") return ROTATION_sw;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ROTATION", value.c_str());
+    static constexpr const char *values[ROTATION_MAX] = { "", "none", "down", "left", "ne", "nw", "se", "sw" };
+    if ((data <= ROTATION_NONE) || (data >= ROTATION_MAX)) {
+        LogWarning("Unknown value '%d' for data.ROTATION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_ROTATION AttConverter::StrToRotation(const std::string &value, bool logWarning) const
+{
+    return StrToRotation(value.c_str(), logWarning);
+}
+
+data_ROTATION AttConverter::StrToRotation(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_ROTATION> table[8] = {
+        { "", ROTATION_NONE }, { "left", ROTATION_left }, { "none", ROTATION_none }, { "nw", ROTATION_nw },
+        { "down", ROTATION_down }, { "sw", ROTATION_sw }, { "ne", ROTATION_ne }, { "se", ROTATION_se }
+    };
+    static constexpr uint16_t seeds[4] = { 3, 0, 10, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.ROTATION", value);
     return ROTATION_NONE;
 }
 
 std::string AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) const
 {
-    std::string value;
-    switch (data) {
-        case ROTATIONDIRECTION_none: value = "none"; break;
-        case ROTATIONDIRECTION_down: value = "down"; break;
-        case ROTATIONDIRECTION_left: value = "left"; break;
-        case ROTATIONDIRECTION_ne: value = "ne"; break;
-        case ROTATIONDIRECTION_nw: value = "nw"; break;
-        case ROTATIONDIRECTION_se: value = "se"; break;
-        case ROTATIONDIRECTION_sw: value = "sw"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.ROTATIONDIRECTION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string value, bool logWarning) const
-{
-    if (value == "none") return ROTATIONDIRECTION_none;
-    if (value == "down") return ROTATIONDIRECTION_down;
-    if (value == "left") return ROTATIONDIRECTION_left;
-    if (value == "ne") return ROTATIONDIRECTION_ne;
-    if (value == "nw") return ROTATIONDIRECTION_nw;
-    if (value == "se") return ROTATIONDIRECTION_se;
-    if (value == "sw") return ROTATIONDIRECTION_sw;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value.c_str());
+    static constexpr const char *values[ROTATIONDIRECTION_MAX] = { "", "none", "down", "left", "ne", "nw", "se", "sw" };
+    if ((data <= ROTATIONDIRECTION_NONE) || (data >= ROTATIONDIRECTION_MAX)) {
+        LogWarning("Unknown value '%d' for data.ROTATIONDIRECTION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(const std::string &value, bool logWarning) const
+{
+    return StrToRotationdirection(value.c_str(), logWarning);
+}
+
+data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_ROTATIONDIRECTION> table[8] = {
+        { "", ROTATIONDIRECTION_NONE }, { "left", ROTATIONDIRECTION_left }, { "none", ROTATIONDIRECTION_none },
+        { "nw", ROTATIONDIRECTION_nw }, { "down", ROTATIONDIRECTION_down }, { "sw", ROTATIONDIRECTION_sw },
+        { "ne", ROTATIONDIRECTION_ne }, { "se", ROTATIONDIRECTION_se }
+    };
+    static constexpr uint16_t seeds[4] = { 3, 0, 10, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value);
     return ROTATIONDIRECTION_NONE;
 }
 
 std::string AttConverter::StaffitemToStr(data_STAFFITEM data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFITEM_accid: value = "accid"; break;
-        case STAFFITEM_annot: value = "annot"; break;
-        case STAFFITEM_artic: value = "artic"; break;
-        case STAFFITEM_dir: value = "dir"; break;
-        case STAFFITEM_dynam: value = "dynam"; break;
-        case STAFFITEM_harm: value = "harm"; break;
-        case STAFFITEM_ornam: value = "ornam"; break;
-        case STAFFITEM_sp: value = "sp"; break;
-        case STAFFITEM_stageDir: value = "stageDir"; break;
-        case STAFFITEM_tempo: value = "tempo"; break;
-        case STAFFITEM_beam: value = "beam"; break;
-        case STAFFITEM_bend: value = "bend"; break;
-        case STAFFITEM_bracketSpan: value = "bracketSpan"; break;
-        case STAFFITEM_breath: value = "breath"; break;
-        case STAFFITEM_cpMark: value = "cpMark"; break;
-        case STAFFITEM_fermata: value = "fermata"; break;
-        case STAFFITEM_fing: value = "fing"; break;
-        case STAFFITEM_hairpin: value = "hairpin"; break;
-        case STAFFITEM_harpPedal: value = "harpPedal"; break;
-        case STAFFITEM_lv: value = "lv"; break;
-        case STAFFITEM_mordent: value = "mordent"; break;
-        case STAFFITEM_octave: value = "octave"; break;
-        case STAFFITEM_pedal: value = "pedal"; break;
-        case STAFFITEM_reh: value = "reh"; break;
-        case STAFFITEM_tie: value = "tie"; break;
-        case STAFFITEM_trill: value = "trill"; break;
-        case STAFFITEM_tuplet: value = "tuplet"; break;
-        case STAFFITEM_turn: value = "turn"; break;
-        case STAFFITEM_ligature: value = "ligature"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFITEM", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_STAFFITEM AttConverter::StrToStaffitem(std::string value, bool logWarning) const
-{
-    if (value == "accid") return STAFFITEM_accid;
-    if (value == "annot") return STAFFITEM_annot;
-    if (value == "artic") return STAFFITEM_artic;
-    if (value == "dir") return STAFFITEM_dir;
-    if (value == "dynam") return STAFFITEM_dynam;
-    if (value == "harm") return STAFFITEM_harm;
-    if (value == "ornam") return STAFFITEM_ornam;
-    if (value == "sp") return STAFFITEM_sp;
-    if (value == "stageDir") return STAFFITEM_stageDir;
-    if (value == "tempo") return STAFFITEM_tempo;
-    if (value == "beam") return STAFFITEM_beam;
-    if (value == "bend") return STAFFITEM_bend;
-    if (value == "bracketSpan") return STAFFITEM_bracketSpan;
-    if (value == "breath") return STAFFITEM_breath;
-    if (value == "cpMark") return STAFFITEM_cpMark;
-    if (value == "fermata") return STAFFITEM_fermata;
-    if (value == "fing") return STAFFITEM_fing;
-    if (value == "hairpin") return STAFFITEM_hairpin;
-    if (value == "harpPedal") return STAFFITEM_harpPedal;
-    if (value == "lv") return STAFFITEM_lv;
-    if (value == "mordent") return STAFFITEM_mordent;
-    if (value == "octave") return STAFFITEM_octave;
-    if (value == "pedal") return STAFFITEM_pedal;
-    if (value == "reh") return STAFFITEM_reh;
-    if (value == "tie") return STAFFITEM_tie;
-    if (value == "trill") return STAFFITEM_trill;
-    if (value == "tuplet") return STAFFITEM_tuplet;
-    if (value == "turn") return STAFFITEM_turn;
-    if (value == "ligature") return STAFFITEM_ligature;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM", value.c_str());
+    static constexpr const char *values[STAFFITEM_MAX] = {
+        "", "accid", "annot", "artic", "dir", "dynam", "harm", "ornam", "sp", "stageDir", "tempo", "beam", "bend",
+        "bracketSpan", "breath", "cpMark", "fermata", "fing", "hairpin", "harpPedal", "lv", "mordent", "octave",
+        "pedal", "reh", "tie", "trill", "tuplet", "turn", "ligature"
+    };
+    if ((data <= STAFFITEM_NONE) || (data >= STAFFITEM_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFITEM", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_STAFFITEM AttConverter::StrToStaffitem(const std::string &value, bool logWarning) const
+{
+    return StrToStaffitem(value.c_str(), logWarning);
+}
+
+data_STAFFITEM AttConverter::StrToStaffitem(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFITEM> table[32] = {
+        { "", STAFFITEM_NONE }, { "tempo", STAFFITEM_tempo }, { "dir", STAFFITEM_dir },
+        { "bracketSpan", STAFFITEM_bracketSpan }, { "stageDir", STAFFITEM_stageDir }, { "tie", STAFFITEM_tie },
+        { "hairpin", STAFFITEM_hairpin }, { "harm", STAFFITEM_harm }, { "sp", STAFFITEM_sp },
+        { "dynam", STAFFITEM_dynam }, { "reh", STAFFITEM_reh }, { "harpPedal", STAFFITEM_harpPedal },
+        { "ligature", STAFFITEM_ligature }, { "ornam", STAFFITEM_ornam }, { "annot", STAFFITEM_annot },
+        { "fermata", STAFFITEM_fermata }, { "beam", STAFFITEM_beam }, { "turn", STAFFITEM_turn },
+        { "tuplet", STAFFITEM_tuplet }, { "lv", STAFFITEM_lv }, { "", STAFFITEM_NONE }, { "fing", STAFFITEM_fing },
+        { "mordent", STAFFITEM_mordent }, { "bend", STAFFITEM_bend }, { "accid", STAFFITEM_accid },
+        { "trill", STAFFITEM_trill }, { "artic", STAFFITEM_artic }, { "breath", STAFFITEM_breath },
+        { "octave", STAFFITEM_octave }, { "pedal", STAFFITEM_pedal }, { "cpMark", STAFFITEM_cpMark },
+        { "", STAFFITEM_NONE }
+    };
+    static constexpr uint16_t seeds[16] = { 1, 0, 0, 3, 2, 0, 2, 1, 13, 0, 11, 15, 5, 1, 0, 3 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFITEM", value);
     return STAFFITEM_NONE;
 }
 
 std::string AttConverter::StaffitemBasicToStr(data_STAFFITEM_basic data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFITEM_basic_accid: value = "accid"; break;
-        case STAFFITEM_basic_annot: value = "annot"; break;
-        case STAFFITEM_basic_artic: value = "artic"; break;
-        case STAFFITEM_basic_dir: value = "dir"; break;
-        case STAFFITEM_basic_dynam: value = "dynam"; break;
-        case STAFFITEM_basic_harm: value = "harm"; break;
-        case STAFFITEM_basic_ornam: value = "ornam"; break;
-        case STAFFITEM_basic_sp: value = "sp"; break;
-        case STAFFITEM_basic_stageDir: value = "stageDir"; break;
-        case STAFFITEM_basic_tempo: value = "tempo"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFITEM.basic", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_STAFFITEM_basic AttConverter::StrToStaffitemBasic(std::string value, bool logWarning) const
-{
-    if (value == "accid") return STAFFITEM_basic_accid;
-    if (value == "annot") return STAFFITEM_basic_annot;
-    if (value == "artic") return STAFFITEM_basic_artic;
-    if (value == "dir") return STAFFITEM_basic_dir;
-    if (value == "dynam") return STAFFITEM_basic_dynam;
-    if (value == "harm") return STAFFITEM_basic_harm;
-    if (value == "ornam") return STAFFITEM_basic_ornam;
-    if (value == "sp") return STAFFITEM_basic_sp;
-    if (value == "stageDir") return STAFFITEM_basic_stageDir;
-    if (value == "tempo") return STAFFITEM_basic_tempo;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM.basic", value.c_str());
+    static constexpr const char *values[STAFFITEM_basic_MAX] = {
+        "", "accid", "annot", "artic", "dir", "dynam", "harm", "ornam", "sp", "stageDir", "tempo"
+    };
+    if ((data <= STAFFITEM_basic_NONE) || (data >= STAFFITEM_basic_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFITEM.basic", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_STAFFITEM_basic AttConverter::StrToStaffitemBasic(const std::string &value, bool logWarning) const
+{
+    return StrToStaffitemBasic(value.c_str(), logWarning);
+}
+
+data_STAFFITEM_basic AttConverter::StrToStaffitemBasic(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFITEM_basic> table[16] = {
+        { "artic", STAFFITEM_basic_artic }, { "tempo", STAFFITEM_basic_tempo }, { "", STAFFITEM_basic_NONE },
+        { "", STAFFITEM_basic_NONE }, { "dynam", STAFFITEM_basic_dynam }, { "", STAFFITEM_basic_NONE },
+        { "", STAFFITEM_basic_NONE }, { "", STAFFITEM_basic_NONE }, { "harm", STAFFITEM_basic_harm },
+        { "", STAFFITEM_basic_NONE }, { "dir", STAFFITEM_basic_dir }, { "sp", STAFFITEM_basic_sp },
+        { "stageDir", STAFFITEM_basic_stageDir }, { "accid", STAFFITEM_basic_accid },
+        { "annot", STAFFITEM_basic_annot }, { "ornam", STAFFITEM_basic_ornam }
+    };
+    static constexpr uint16_t seeds[4] = { 1, 0, 1, 6 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFITEM.basic", value);
     return STAFFITEM_basic_NONE;
 }
 
 std::string AttConverter::StaffitemCmnToStr(data_STAFFITEM_cmn data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFITEM_cmn_beam: value = "beam"; break;
-        case STAFFITEM_cmn_bend: value = "bend"; break;
-        case STAFFITEM_cmn_bracketSpan: value = "bracketSpan"; break;
-        case STAFFITEM_cmn_breath: value = "breath"; break;
-        case STAFFITEM_cmn_cpMark: value = "cpMark"; break;
-        case STAFFITEM_cmn_fermata: value = "fermata"; break;
-        case STAFFITEM_cmn_fing: value = "fing"; break;
-        case STAFFITEM_cmn_hairpin: value = "hairpin"; break;
-        case STAFFITEM_cmn_harpPedal: value = "harpPedal"; break;
-        case STAFFITEM_cmn_lv: value = "lv"; break;
-        case STAFFITEM_cmn_mordent: value = "mordent"; break;
-        case STAFFITEM_cmn_octave: value = "octave"; break;
-        case STAFFITEM_cmn_pedal: value = "pedal"; break;
-        case STAFFITEM_cmn_reh: value = "reh"; break;
-        case STAFFITEM_cmn_tie: value = "tie"; break;
-        case STAFFITEM_cmn_trill: value = "trill"; break;
-        case STAFFITEM_cmn_tuplet: value = "tuplet"; break;
-        case STAFFITEM_cmn_turn: value = "turn"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFITEM.cmn", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_STAFFITEM_cmn AttConverter::StrToStaffitemCmn(std::string value, bool logWarning) const
-{
-    if (value == "beam") return STAFFITEM_cmn_beam;
-    if (value == "bend") return STAFFITEM_cmn_bend;
-    if (value == "bracketSpan") return STAFFITEM_cmn_bracketSpan;
-    if (value == "breath") return STAFFITEM_cmn_breath;
-    if (value == "cpMark") return STAFFITEM_cmn_cpMark;
-    if (value == "fermata") return STAFFITEM_cmn_fermata;
-    if (value == "fing") return STAFFITEM_cmn_fing;
-    if (value == "hairpin") return STAFFITEM_cmn_hairpin;
-    if (value == "harpPedal") return STAFFITEM_cmn_harpPedal;
-    if (value == "lv") return STAFFITEM_cmn_lv;
-    if (value == "mordent") return STAFFITEM_cmn_mordent;
-    if (value == "octave") return STAFFITEM_cmn_octave;
-    if (value == "pedal") return STAFFITEM_cmn_pedal;
-    if (value == "reh") return STAFFITEM_cmn_reh;
-    if (value == "tie") return STAFFITEM_cmn_tie;
-    if (value == "trill") return STAFFITEM_cmn_trill;
-    if (value == "tuplet") return STAFFITEM_cmn_tuplet;
-    if (value == "turn") return STAFFITEM_cmn_turn;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM.cmn", value.c_str());
+    static constexpr const char *values[STAFFITEM_cmn_MAX] = {
+        "", "beam", "bend", "bracketSpan", "breath", "cpMark", "fermata", "fing", "hairpin", "harpPedal", "lv",
+        "mordent", "octave", "pedal", "reh", "tie", "trill", "tuplet", "turn"
+    };
+    if ((data <= STAFFITEM_cmn_NONE) || (data >= STAFFITEM_cmn_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFITEM.cmn", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_STAFFITEM_cmn AttConverter::StrToStaffitemCmn(const std::string &value, bool logWarning) const
+{
+    return StrToStaffitemCmn(value.c_str(), logWarning);
+}
+
+data_STAFFITEM_cmn AttConverter::StrToStaffitemCmn(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFITEM_cmn> table[32] = {
+        { "", STAFFITEM_cmn_NONE }, { "bracketSpan", STAFFITEM_cmn_bracketSpan }, { "", STAFFITEM_cmn_NONE },
+        { "bend", STAFFITEM_cmn_bend }, { "beam", STAFFITEM_cmn_beam }, { "", STAFFITEM_cmn_NONE },
+        { "fermata", STAFFITEM_cmn_fermata }, { "", STAFFITEM_cmn_NONE }, { "", STAFFITEM_cmn_NONE },
+        { "", STAFFITEM_cmn_NONE }, { "tie", STAFFITEM_cmn_tie }, { "harpPedal", STAFFITEM_cmn_harpPedal },
+        { "", STAFFITEM_cmn_NONE }, { "hairpin", STAFFITEM_cmn_hairpin }, { "", STAFFITEM_cmn_NONE },
+        { "", STAFFITEM_cmn_NONE }, { "reh", STAFFITEM_cmn_reh }, { "turn", STAFFITEM_cmn_turn },
+        { "tuplet", STAFFITEM_cmn_tuplet }, { "", STAFFITEM_cmn_NONE }, { "", STAFFITEM_cmn_NONE },
+        { "fing", STAFFITEM_cmn_fing }, { "lv", STAFFITEM_cmn_lv }, { "octave", STAFFITEM_cmn_octave },
+        { "mordent", STAFFITEM_cmn_mordent }, { "trill", STAFFITEM_cmn_trill }, { "breath", STAFFITEM_cmn_breath },
+        { "", STAFFITEM_cmn_NONE }, { "", STAFFITEM_cmn_NONE }, { "pedal", STAFFITEM_cmn_pedal },
+        { "cpMark", STAFFITEM_cmn_cpMark }, { "", STAFFITEM_cmn_NONE }
+    };
+    static constexpr uint16_t seeds[8] = { 2, 0, 0, 0, 1, 3, 0, 1 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFITEM.cmn", value);
     return STAFFITEM_cmn_NONE;
 }
 
 std::string AttConverter::StaffitemMensuralToStr(data_STAFFITEM_mensural data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFITEM_mensural_ligature: value = "ligature"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFITEM.mensural", data);
-            value = "";
-            break;
+    static constexpr const char *values[STAFFITEM_mensural_MAX] = { "", "ligature" };
+    if ((data <= STAFFITEM_mensural_NONE) || (data >= STAFFITEM_mensural_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFITEM.mensural", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_STAFFITEM_mensural AttConverter::StrToStaffitemMensural(std::string value, bool logWarning) const
+data_STAFFITEM_mensural AttConverter::StrToStaffitemMensural(const std::string &value, bool logWarning) const
 {
-    if (value == "ligature") return STAFFITEM_mensural_ligature;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM.mensural", value.c_str());
+    return StrToStaffitemMensural(value.c_str(), logWarning);
+}
+
+data_STAFFITEM_mensural AttConverter::StrToStaffitemMensural(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFITEM_mensural> table[1] = {
+        { "ligature", STAFFITEM_mensural_ligature }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFITEM.mensural", value);
     return STAFFITEM_mensural_NONE;
 }
 
 std::string AttConverter::StaffrelToStr(data_STAFFREL data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFREL_above: value = "above"; break;
-        case STAFFREL_below: value = "below"; break;
-        case STAFFREL_between: value = "between"; break;
-        case STAFFREL_within: value = "within"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFREL", data);
-            value = "";
-            break;
+    static constexpr const char *values[STAFFREL_MAX] = { "", "above", "below", "between", "within" };
+    if ((data <= STAFFREL_NONE) || (data >= STAFFREL_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFREL", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_STAFFREL AttConverter::StrToStaffrel(std::string value, bool logWarning) const
+data_STAFFREL AttConverter::StrToStaffrel(const std::string &value, bool logWarning) const
 {
-    if (value == "above") return STAFFREL_above;
-    if (value == "below") return STAFFREL_below;
-    if (value == "between") return STAFFREL_between;
-    if (value == "within") return STAFFREL_within;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFREL", value.c_str());
+    return StrToStaffrel(value.c_str(), logWarning);
+}
+
+data_STAFFREL AttConverter::StrToStaffrel(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFREL> table[4] = {
+        { "below", STAFFREL_below }, { "between", STAFFREL_between }, { "within", STAFFREL_within },
+        { "above", STAFFREL_above }
+    };
+    static constexpr uint16_t seeds[2] = { 2, 4 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFREL", value);
     return STAFFREL_NONE;
 }
 
 std::string AttConverter::StaffrelBasicToStr(data_STAFFREL_basic data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFREL_basic_above: value = "above"; break;
-        case STAFFREL_basic_below: value = "below"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFREL.basic", data);
-            value = "";
-            break;
+    static constexpr const char *values[STAFFREL_basic_MAX] = { "", "above", "below" };
+    if ((data <= STAFFREL_basic_NONE) || (data >= STAFFREL_basic_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFREL.basic", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_STAFFREL_basic AttConverter::StrToStaffrelBasic(std::string value, bool logWarning) const
+data_STAFFREL_basic AttConverter::StrToStaffrelBasic(const std::string &value, bool logWarning) const
 {
-    if (value == "above") return STAFFREL_basic_above;
-    if (value == "below") return STAFFREL_basic_below;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFREL.basic", value.c_str());
+    return StrToStaffrelBasic(value.c_str(), logWarning);
+}
+
+data_STAFFREL_basic AttConverter::StrToStaffrelBasic(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFREL_basic> table[2] = {
+        { "below", STAFFREL_basic_below }, { "above", STAFFREL_basic_above }
+    };
+    const auto &entry = table[HashToken(value, 2) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFREL.basic", value);
     return STAFFREL_basic_NONE;
 }
 
 std::string AttConverter::StaffrelExtendedToStr(data_STAFFREL_extended data) const
 {
-    std::string value;
-    switch (data) {
-        case STAFFREL_extended_between: value = "between"; break;
-        case STAFFREL_extended_within: value = "within"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STAFFREL.extended", data);
-            value = "";
-            break;
+    static constexpr const char *values[STAFFREL_extended_MAX] = { "", "between", "within" };
+    if ((data <= STAFFREL_extended_NONE) || (data >= STAFFREL_extended_MAX)) {
+        LogWarning("Unknown value '%d' for data.STAFFREL.extended", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_STAFFREL_extended AttConverter::StrToStaffrelExtended(std::string value, bool logWarning) const
+data_STAFFREL_extended AttConverter::StrToStaffrelExtended(const std::string &value, bool logWarning) const
 {
-    if (value == "between") return STAFFREL_extended_between;
-    if (value == "within") return STAFFREL_extended_within;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFREL.extended", value.c_str());
+    return StrToStaffrelExtended(value.c_str(), logWarning);
+}
+
+data_STAFFREL_extended AttConverter::StrToStaffrelExtended(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STAFFREL_extended> table[2] = {
+        { "within", STAFFREL_extended_within }, { "between", STAFFREL_extended_between }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STAFFREL.extended", value);
     return STAFFREL_extended_NONE;
 }
 
 std::string AttConverter::StemdirectionToStr(data_STEMDIRECTION data) const
 {
-    std::string value;
-    switch (data) {
-        case STEMDIRECTION_up: value = "up"; break;
-        case STEMDIRECTION_down: value = "down"; break;
-        case STEMDIRECTION_left: value = "left"; break;
-        case STEMDIRECTION_right: value = "right"; break;
-        case STEMDIRECTION_ne: value = "ne"; break;
-        case STEMDIRECTION_se: value = "se"; break;
-        case STEMDIRECTION_nw: value = "nw"; break;
-        case STEMDIRECTION_sw: value = "sw"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STEMDIRECTION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_STEMDIRECTION AttConverter::StrToStemdirection(std::string value, bool logWarning) const
-{
-    if (value == "up") return STEMDIRECTION_up;
-    if (value == "down") return STEMDIRECTION_down;
-    if (value == "left") return STEMDIRECTION_left;
-    if (value == "right") return STEMDIRECTION_right;
-    if (value == "ne") return STEMDIRECTION_ne;
-    if (value == "se") return STEMDIRECTION_se;
-    if (value == "nw") return STEMDIRECTION_nw;
-    if (value == "sw") return STEMDIRECTION_sw;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMDIRECTION", value.c_str());
+    static constexpr const char *values[STEMDIRECTION_MAX] = {
+        "", "up", "down", "left", "right", "ne", "se", "nw", "sw"
+    };
+    if ((data <= STEMDIRECTION_NONE) || (data >= STEMDIRECTION_MAX)) {
+        LogWarning("Unknown value '%d' for data.STEMDIRECTION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_STEMDIRECTION AttConverter::StrToStemdirection(const std::string &value, bool logWarning) const
+{
+    return StrToStemdirection(value.c_str(), logWarning);
+}
+
+data_STEMDIRECTION AttConverter::StrToStemdirection(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STEMDIRECTION> table[8] = {
+        { "down", STEMDIRECTION_down }, { "se", STEMDIRECTION_se }, { "sw", STEMDIRECTION_sw },
+        { "left", STEMDIRECTION_left }, { "right", STEMDIRECTION_right }, { "nw", STEMDIRECTION_nw },
+        { "up", STEMDIRECTION_up }, { "ne", STEMDIRECTION_ne }
+    };
+    static constexpr uint16_t seeds[4] = { 2, 1, 4, 13 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STEMDIRECTION", value);
     return STEMDIRECTION_NONE;
 }
 
 std::string AttConverter::StemdirectionBasicToStr(data_STEMDIRECTION_basic data) const
 {
-    std::string value;
-    switch (data) {
-        case STEMDIRECTION_basic_up: value = "up"; break;
-        case STEMDIRECTION_basic_down: value = "down"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STEMDIRECTION.basic", data);
-            value = "";
-            break;
+    static constexpr const char *values[STEMDIRECTION_basic_MAX] = { "", "up", "down" };
+    if ((data <= STEMDIRECTION_basic_NONE) || (data >= STEMDIRECTION_basic_MAX)) {
+        LogWarning("Unknown value '%d' for data.STEMDIRECTION.basic", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_STEMDIRECTION_basic AttConverter::StrToStemdirectionBasic(const std::string &value, bool logWarning) const
+{
+    return StrToStemdirectionBasic(value.c_str(), logWarning);
 }
 
-data_STEMDIRECTION_basic AttConverter::StrToStemdirectionBasic(std::string value, bool logWarning) const
+data_STEMDIRECTION_basic AttConverter::StrToStemdirectionBasic(const char *value, bool logWarning) const
 {
-    if (value == "up") return STEMDIRECTION_basic_up;
-    if (value == "down") return STEMDIRECTION_basic_down;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.basic", value.c_str());
+    static constexpr std::pair<const char *, data_STEMDIRECTION_basic> table[2] = {
+        { "down", STEMDIRECTION_basic_down }, { "up", STEMDIRECTION_basic_up }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.basic", value);
     return STEMDIRECTION_basic_NONE;
 }
 
 std::string AttConverter::StemdirectionExtendedToStr(data_STEMDIRECTION_extended data) const
 {
-    std::string value;
-    switch (data) {
-        case STEMDIRECTION_extended_left: value = "left"; break;
-        case STEMDIRECTION_extended_right: value = "right"; break;
-        case STEMDIRECTION_extended_ne: value = "ne"; break;
-        case STEMDIRECTION_extended_se: value = "se"; break;
-        case STEMDIRECTION_extended_nw: value = "nw"; break;
-        case STEMDIRECTION_extended_sw: value = "sw"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STEMDIRECTION.extended", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_STEMDIRECTION_extended AttConverter::StrToStemdirectionExtended(std::string value, bool logWarning) const
-{
-    if (value == "left") return STEMDIRECTION_extended_left;
-    if (value == "right") return STEMDIRECTION_extended_right;
-    if (value == "ne") return STEMDIRECTION_extended_ne;
-    if (value == "se") return STEMDIRECTION_extended_se;
-    if (value == "nw") return STEMDIRECTION_extended_nw;
-    if (value == "sw") return STEMDIRECTION_extended_sw;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.extended", value.c_str());
+    static constexpr const char *values[STEMDIRECTION_extended_MAX] = { "", "left", "right", "ne", "se", "nw", "sw" };
+    if ((data <= STEMDIRECTION_extended_NONE) || (data >= STEMDIRECTION_extended_MAX)) {
+        LogWarning("Unknown value '%d' for data.STEMDIRECTION.extended", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_STEMDIRECTION_extended AttConverter::StrToStemdirectionExtended(const std::string &value, bool logWarning) const
+{
+    return StrToStemdirectionExtended(value.c_str(), logWarning);
+}
+
+data_STEMDIRECTION_extended AttConverter::StrToStemdirectionExtended(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STEMDIRECTION_extended> table[8] = {
+        { "se", STEMDIRECTION_extended_se }, { "nw", STEMDIRECTION_extended_nw }, { "", STEMDIRECTION_extended_NONE },
+        { "left", STEMDIRECTION_extended_left }, { "right", STEMDIRECTION_extended_right },
+        { "", STEMDIRECTION_extended_NONE }, { "sw", STEMDIRECTION_extended_sw }, { "ne", STEMDIRECTION_extended_ne }
+    };
+    static constexpr uint16_t seeds[2] = { 4, 3 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.extended", value);
     return STEMDIRECTION_extended_NONE;
 }
 
 std::string AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
 {
-    std::string value;
-    switch (data) {
-        case STEMMODIFIER_none: value = "none"; break;
-        case STEMMODIFIER_1slash: value = "1slash"; break;
-        case STEMMODIFIER_2slash: value = "2slash"; break;
-        case STEMMODIFIER_3slash: value = "3slash"; break;
-        case STEMMODIFIER_4slash: value = "4slash"; break;
-        case STEMMODIFIER_5slash: value = "5slash"; break;
-        case STEMMODIFIER_6slash: value = "6slash"; break;
-        case STEMMODIFIER_sprech: value = "sprech"; break;
-        case STEMMODIFIER_z: value = "z"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STEMMODIFIER", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string value, bool logWarning) const
-{
-    if (value == "none") return STEMMODIFIER_none;
-    if (value == "1slash") return STEMMODIFIER_1slash;
-    if (value == "2slash") return STEMMODIFIER_2slash;
-    if (value == "3slash") return STEMMODIFIER_3slash;
-    if (value == "4slash") return STEMMODIFIER_4slash;
-    if (value == "5slash") return STEMMODIFIER_5slash;
-    if (value == "6slash") return STEMMODIFIER_6slash;
-    if (value == "sprech") return STEMMODIFIER_sprech;
-    if (value == "z") return STEMMODIFIER_z;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value.c_str());
+    static constexpr const char *values[STEMMODIFIER_MAX] = {
+        "", "none", "1slash", "2slash", "3slash", "4slash", "5slash", "6slash", "sprech", "z"
+    };
+    if ((data <= STEMMODIFIER_NONE) || (data >= STEMMODIFIER_MAX)) {
+        LogWarning("Unknown value '%d' for data.STEMMODIFIER", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_STEMMODIFIER AttConverter::StrToStemmodifier(const std::string &value, bool logWarning) const
+{
+    return StrToStemmodifier(value.c_str(), logWarning);
+}
+
+data_STEMMODIFIER AttConverter::StrToStemmodifier(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STEMMODIFIER> table[16] = {
+        { "", STEMMODIFIER_NONE }, { "sprech", STEMMODIFIER_sprech }, { "", STEMMODIFIER_NONE },
+        { "", STEMMODIFIER_NONE }, { "", STEMMODIFIER_NONE }, { "6slash", STEMMODIFIER_6slash },
+        { "2slash", STEMMODIFIER_2slash }, { "1slash", STEMMODIFIER_1slash }, { "3slash", STEMMODIFIER_3slash },
+        { "", STEMMODIFIER_NONE }, { "none", STEMMODIFIER_none }, { "z", STEMMODIFIER_z },
+        { "5slash", STEMMODIFIER_5slash }, { "4slash", STEMMODIFIER_4slash }, { "", STEMMODIFIER_NONE },
+        { "", STEMMODIFIER_NONE }
+    };
+    static constexpr uint16_t seeds[4] = { 3, 2, 2, 16 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 15];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value);
     return STEMMODIFIER_NONE;
 }
 
 std::string AttConverter::StempositionToStr(data_STEMPOSITION data) const
 {
-    std::string value;
-    switch (data) {
-        case STEMPOSITION_left: value = "left"; break;
-        case STEMPOSITION_right: value = "right"; break;
-        case STEMPOSITION_center: value = "center"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.STEMPOSITION", data);
-            value = "";
-            break;
+    static constexpr const char *values[STEMPOSITION_MAX] = { "", "left", "right", "center" };
+    if ((data <= STEMPOSITION_NONE) || (data >= STEMPOSITION_MAX)) {
+        LogWarning("Unknown value '%d' for data.STEMPOSITION", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-data_STEMPOSITION AttConverter::StrToStemposition(std::string value, bool logWarning) const
+data_STEMPOSITION AttConverter::StrToStemposition(const std::string &value, bool logWarning) const
 {
-    if (value == "left") return STEMPOSITION_left;
-    if (value == "right") return STEMPOSITION_right;
-    if (value == "center") return STEMPOSITION_center;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMPOSITION", value.c_str());
+    return StrToStemposition(value.c_str(), logWarning);
+}
+
+data_STEMPOSITION AttConverter::StrToStemposition(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_STEMPOSITION> table[4] = {
+        { "right", STEMPOSITION_right }, { "", STEMPOSITION_NONE }, { "center", STEMPOSITION_center },
+        { "left", STEMPOSITION_left }
+    };
+    const auto &entry = table[HashToken(value, 4) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.STEMPOSITION", value);
     return STEMPOSITION_NONE;
 }
 
 std::string AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
 {
-    std::string value;
-    switch (data) {
-        case TEMPERAMENT_equal: value = "equal"; break;
-        case TEMPERAMENT_just: value = "just"; break;
-        case TEMPERAMENT_mean: value = "mean"; break;
-        case TEMPERAMENT_pythagorean: value = "pythagorean"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.TEMPERAMENT", data);
-            value = "";
-            break;
+    static constexpr const char *values[TEMPERAMENT_MAX] = { "", "equal", "just", "mean", "pythagorean" };
+    if ((data <= TEMPERAMENT_NONE) || (data >= TEMPERAMENT_MAX)) {
+        LogWarning("Unknown value '%d' for data.TEMPERAMENT", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_TEMPERAMENT AttConverter::StrToTemperament(const std::string &value, bool logWarning) const
+{
+    return StrToTemperament(value.c_str(), logWarning);
 }
 
-data_TEMPERAMENT AttConverter::StrToTemperament(std::string value, bool logWarning) const
+data_TEMPERAMENT AttConverter::StrToTemperament(const char *value, bool logWarning) const
 {
-    if (value == "equal") return TEMPERAMENT_equal;
-    if (value == "just") return TEMPERAMENT_just;
-    if (value == "mean") return TEMPERAMENT_mean;
-    if (value == "pythagorean") return TEMPERAMENT_pythagorean;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value.c_str());
+    static constexpr std::pair<const char *, data_TEMPERAMENT> table[4] = {
+        { "mean", TEMPERAMENT_mean }, { "just", TEMPERAMENT_just }, { "equal", TEMPERAMENT_equal },
+        { "pythagorean", TEMPERAMENT_pythagorean }
+    };
+    static constexpr uint16_t seeds[2] = { 6, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value);
     return TEMPERAMENT_NONE;
 }
 
 std::string AttConverter::TextrenditionToStr(data_TEXTRENDITION data) const
 {
-    std::string value;
-    switch (data) {
-        case TEXTRENDITION_quote: value = "quote"; break;
-        case TEXTRENDITION_quotedbl: value = "quotedbl"; break;
-        case TEXTRENDITION_italic: value = "italic"; break;
-        case TEXTRENDITION_oblique: value = "oblique"; break;
-        case TEXTRENDITION_smcaps: value = "smcaps"; break;
-        case TEXTRENDITION_bold: value = "bold"; break;
-        case TEXTRENDITION_bolder: value = "bolder"; break;
-        case TEXTRENDITION_lighter: value = "lighter"; break;
-        case TEXTRENDITION_box: value = "box"; break;
-        case TEXTRENDITION_circle: value = "circle"; break;
-        case TEXTRENDITION_dbox: value = "dbox"; break;
-        case TEXTRENDITION_tbox: value = "tbox"; break;
-        case TEXTRENDITION_bslash: value = "bslash"; break;
-        case TEXTRENDITION_fslash: value = "fslash"; break;
-        case TEXTRENDITION_line_through: value = "line-through"; break;
-        case TEXTRENDITION_none: value = "none"; break;
-        case TEXTRENDITION_overline: value = "overline"; break;
-        case TEXTRENDITION_overstrike: value = "overstrike"; break;
-        case TEXTRENDITION_strike: value = "strike"; break;
-        case TEXTRENDITION_sub: value = "sub"; break;
-        case TEXTRENDITION_sup: value = "sup"; break;
-        case TEXTRENDITION_superimpose: value = "superimpose"; break;
-        case TEXTRENDITION_underline: value = "underline"; break;
-        case TEXTRENDITION_x_through: value = "x-through"; break;
-        case TEXTRENDITION_ltr: value = "ltr"; break;
-        case TEXTRENDITION_rtl: value = "rtl"; break;
-        case TEXTRENDITION_lro: value = "lro"; break;
-        case TEXTRENDITION_rlo: value = "rlo"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.TEXTRENDITION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_TEXTRENDITION AttConverter::StrToTextrendition(std::string value, bool logWarning) const
-{
-    if (value == "quote") return TEXTRENDITION_quote;
-    if (value == "quotedbl") return TEXTRENDITION_quotedbl;
-    if (value == "italic") return TEXTRENDITION_italic;
-    if (value == "oblique") return TEXTRENDITION_oblique;
-    if (value == "smcaps") return TEXTRENDITION_smcaps;
-    if (value == "bold") return TEXTRENDITION_bold;
-    if (value == "bolder") return TEXTRENDITION_bolder;
-    if (value == "lighter") return TEXTRENDITION_lighter;
-    if (value == "box") return TEXTRENDITION_box;
-    if (value == "circle") return TEXTRENDITION_circle;
-    if (value == "dbox") return TEXTRENDITION_dbox;
-    if (value == "tbox") return TEXTRENDITION_tbox;
-    if (value == "bslash") return TEXTRENDITION_bslash;
-    if (value == "fslash") return TEXTRENDITION_fslash;
-    if (value == "line-through") return TEXTRENDITION_line_through;
-    if (value == "none") return TEXTRENDITION_none;
-    if (value == "overline") return TEXTRENDITION_overline;
-    if (value == "overstrike") return TEXTRENDITION_overstrike;
-    if (value == "strike") return TEXTRENDITION_strike;
-    if (value == "sub") return TEXTRENDITION_sub;
-    if (value == "sup") return TEXTRENDITION_sup;
-    if (value == "superimpose") return TEXTRENDITION_superimpose;
-    if (value == "underline") return TEXTRENDITION_underline;
-    if (value == "x-through") return TEXTRENDITION_x_through;
-    if (value == "ltr") return TEXTRENDITION_ltr;
-    if (value == "rtl") return TEXTRENDITION_rtl;
-    if (value == "lro") return TEXTRENDITION_lro;
-    if (value == "rlo") return TEXTRENDITION_rlo;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.TEXTRENDITION", value.c_str());
+    static constexpr const char *values[TEXTRENDITION_MAX] = {
+        "", "quote", "quotedbl", "italic", "oblique", "smcaps", "bold", "bolder", "lighter", "box", "circle", "dbox",
+        "tbox", "bslash", "fslash", "line-through", "none", "overline", "overstrike", "strike", "sub", "sup",
+        "superimpose", "underline", "x-through", "ltr", "rtl", "lro", "rlo"
+    };
+    if ((data <= TEXTRENDITION_NONE) || (data >= TEXTRENDITION_MAX)) {
+        LogWarning("Unknown value '%d' for data.TEXTRENDITION", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_TEXTRENDITION AttConverter::StrToTextrendition(const std::string &value, bool logWarning) const
+{
+    return StrToTextrendition(value.c_str(), logWarning);
+}
+
+data_TEXTRENDITION AttConverter::StrToTextrendition(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_TEXTRENDITION> table[32] = {
+        { "box", TEXTRENDITION_box }, { "overstrike", TEXTRENDITION_overstrike }, { "smcaps", TEXTRENDITION_smcaps },
+        { "lighter", TEXTRENDITION_lighter }, { "x-through", TEXTRENDITION_x_through },
+        { "oblique", TEXTRENDITION_oblique }, { "overline", TEXTRENDITION_overline }, { "tbox", TEXTRENDITION_tbox },
+        { "dbox", TEXTRENDITION_dbox }, { "", TEXTRENDITION_NONE }, { "strike", TEXTRENDITION_strike },
+        { "bold", TEXTRENDITION_bold }, { "lro", TEXTRENDITION_lro }, { "quotedbl", TEXTRENDITION_quotedbl },
+        { "italic", TEXTRENDITION_italic }, { "bslash", TEXTRENDITION_bslash }, { "sub", TEXTRENDITION_sub },
+        { "sup", TEXTRENDITION_sup }, { "rtl", TEXTRENDITION_rtl }, { "bolder", TEXTRENDITION_bolder },
+        { "quote", TEXTRENDITION_quote }, { "", TEXTRENDITION_NONE }, { "fslash", TEXTRENDITION_fslash },
+        { "", TEXTRENDITION_NONE }, { "rlo", TEXTRENDITION_rlo }, { "none", TEXTRENDITION_none },
+        { "underline", TEXTRENDITION_underline }, { "superimpose", TEXTRENDITION_superimpose },
+        { "ltr", TEXTRENDITION_ltr }, { "circle", TEXTRENDITION_circle }, { "", TEXTRENDITION_NONE },
+        { "line-through", TEXTRENDITION_line_through }
+    };
+    static constexpr uint16_t seeds[16] = { 1, 0, 14, 0, 1, 1, 2, 3, 2, 3, 0, 4, 15, 7, 2, 13 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.TEXTRENDITION", value);
     return TEXTRENDITION_NONE;
 }
 
 std::string AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) const
 {
-    std::string value;
-    switch (data) {
-        case TEXTRENDITIONLIST_quote: value = "quote"; break;
-        case TEXTRENDITIONLIST_quotedbl: value = "quotedbl"; break;
-        case TEXTRENDITIONLIST_italic: value = "italic"; break;
-        case TEXTRENDITIONLIST_oblique: value = "oblique"; break;
-        case TEXTRENDITIONLIST_smcaps: value = "smcaps"; break;
-        case TEXTRENDITIONLIST_bold: value = "bold"; break;
-        case TEXTRENDITIONLIST_bolder: value = "bolder"; break;
-        case TEXTRENDITIONLIST_lighter: value = "lighter"; break;
-        case TEXTRENDITIONLIST_box: value = "box"; break;
-        case TEXTRENDITIONLIST_circle: value = "circle"; break;
-        case TEXTRENDITIONLIST_dbox: value = "dbox"; break;
-        case TEXTRENDITIONLIST_tbox: value = "tbox"; break;
-        case TEXTRENDITIONLIST_bslash: value = "bslash"; break;
-        case TEXTRENDITIONLIST_fslash: value = "fslash"; break;
-        case TEXTRENDITIONLIST_line_through: value = "line-through"; break;
-        case TEXTRENDITIONLIST_none: value = "none"; break;
-        case TEXTRENDITIONLIST_overline: value = "overline"; break;
-        case TEXTRENDITIONLIST_overstrike: value = "overstrike"; break;
-        case TEXTRENDITIONLIST_strike: value = "strike"; break;
-        case TEXTRENDITIONLIST_sub: value = "sub"; break;
-        case TEXTRENDITIONLIST_sup: value = "sup"; break;
-        case TEXTRENDITIONLIST_superimpose: value = "superimpose"; break;
-        case TEXTRENDITIONLIST_underline: value = "underline"; break;
-        case TEXTRENDITIONLIST_x_through: value = "x-through"; break;
-        case TEXTRENDITIONLIST_ltr: value = "ltr"; break;
-        case TEXTRENDITIONLIST_rtl: value = "rtl"; break;
-        case TEXTRENDITIONLIST_lro: value = "lro"; break;
-        case TEXTRENDITIONLIST_rlo: value = "rlo"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.TEXTRENDITIONLIST", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string value, bool logWarning) const
-{
-    if (value == "quote") return TEXTRENDITIONLIST_quote;
-    if (value == "quotedbl") return TEXTRENDITIONLIST_quotedbl;
-    if (value == "italic") return TEXTRENDITIONLIST_italic;
-    if (value == "oblique") return TEXTRENDITIONLIST_oblique;
-    if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
-    if (value == "bold") return TEXTRENDITIONLIST_bold;
-    if (value == "bolder") return TEXTRENDITIONLIST_bolder;
-    if (value == "lighter") return TEXTRENDITIONLIST_lighter;
-    if (value == "box") return TEXTRENDITIONLIST_box;
-    if (value == "circle") return TEXTRENDITIONLIST_circle;
-    if (value == "dbox") return TEXTRENDITIONLIST_dbox;
-    if (value == "tbox") return TEXTRENDITIONLIST_tbox;
-    if (value == "bslash") return TEXTRENDITIONLIST_bslash;
-    if (value == "fslash") return TEXTRENDITIONLIST_fslash;
-    if (value == "line-through") return TEXTRENDITIONLIST_line_through;
-    if (value == "none") return TEXTRENDITIONLIST_none;
-    if (value == "overline") return TEXTRENDITIONLIST_overline;
-    if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
-    if (value == "strike") return TEXTRENDITIONLIST_strike;
-    if (value == "sub") return TEXTRENDITIONLIST_sub;
-    if (value == "sup") return TEXTRENDITIONLIST_sup;
-    if (value == "superimpose") return TEXTRENDITIONLIST_superimpose;
-    if (value == "underline") return TEXTRENDITIONLIST_underline;
-    if (value == "x-through") return TEXTRENDITIONLIST_x_through;
-    if (value == "ltr") return TEXTRENDITIONLIST_ltr;
-    if (value == "rtl") return TEXTRENDITIONLIST_rtl;
-    if (value == "lro") return TEXTRENDITIONLIST_lro;
-    if (value == "rlo") return TEXTRENDITIONLIST_rlo;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value.c_str());
+    static constexpr const char *values[TEXTRENDITIONLIST_MAX] = {
+        "", "quote", "quotedbl", "italic", "oblique", "smcaps", "bold", "bolder", "lighter", "box", "circle", "dbox",
+        "tbox", "bslash", "fslash", "line-through", "none", "overline", "overstrike", "strike", "sub", "sup",
+        "superimpose", "underline", "x-through", "ltr", "rtl", "lro", "rlo"
+    };
+    if ((data <= TEXTRENDITIONLIST_NONE) || (data >= TEXTRENDITIONLIST_MAX)) {
+        LogWarning("Unknown value '%d' for data.TEXTRENDITIONLIST", data);
+        return "";
+    }
+    return values[data];
+}
+
+data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(const std::string &value, bool logWarning) const
+{
+    return StrToTextrenditionlist(value.c_str(), logWarning);
+}
+
+data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, data_TEXTRENDITIONLIST> table[32] = {
+        { "box", TEXTRENDITIONLIST_box }, { "overstrike", TEXTRENDITIONLIST_overstrike },
+        { "smcaps", TEXTRENDITIONLIST_smcaps }, { "lighter", TEXTRENDITIONLIST_lighter },
+        { "x-through", TEXTRENDITIONLIST_x_through }, { "oblique", TEXTRENDITIONLIST_oblique },
+        { "overline", TEXTRENDITIONLIST_overline }, { "tbox", TEXTRENDITIONLIST_tbox },
+        { "dbox", TEXTRENDITIONLIST_dbox }, { "", TEXTRENDITIONLIST_NONE }, { "strike", TEXTRENDITIONLIST_strike },
+        { "bold", TEXTRENDITIONLIST_bold }, { "lro", TEXTRENDITIONLIST_lro },
+        { "quotedbl", TEXTRENDITIONLIST_quotedbl }, { "italic", TEXTRENDITIONLIST_italic },
+        { "bslash", TEXTRENDITIONLIST_bslash }, { "sub", TEXTRENDITIONLIST_sub }, { "sup", TEXTRENDITIONLIST_sup },
+        { "rtl", TEXTRENDITIONLIST_rtl }, { "bolder", TEXTRENDITIONLIST_bolder }, { "quote", TEXTRENDITIONLIST_quote },
+        { "", TEXTRENDITIONLIST_NONE }, { "fslash", TEXTRENDITIONLIST_fslash }, { "", TEXTRENDITIONLIST_NONE },
+        { "rlo", TEXTRENDITIONLIST_rlo }, { "none", TEXTRENDITIONLIST_none },
+        { "underline", TEXTRENDITIONLIST_underline }, { "superimpose", TEXTRENDITIONLIST_superimpose },
+        { "ltr", TEXTRENDITIONLIST_ltr }, { "circle", TEXTRENDITIONLIST_circle }, { "", TEXTRENDITIONLIST_NONE },
+        { "line-through", TEXTRENDITIONLIST_line_through }
+    };
+    static constexpr uint16_t seeds[16] = { 1, 0, 14, 0, 1, 1, 2, 3, 2, 3, 0, 4, 15, 7, 2, 13 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 15];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value);
     return TEXTRENDITIONLIST_NONE;
 }
 
 std::string AttConverter::VerticalalignmentToStr(data_VERTICALALIGNMENT data) const
 {
-    std::string value;
-    switch (data) {
-        case VERTICALALIGNMENT_top: value = "top"; break;
-        case VERTICALALIGNMENT_middle: value = "middle"; break;
-        case VERTICALALIGNMENT_bottom: value = "bottom"; break;
-        case VERTICALALIGNMENT_baseline: value = "baseline"; break;
-        default:
-            LogWarning("Unknown value '%d' for data.VERTICALALIGNMENT", data);
-            value = "";
-            break;
+    static constexpr const char *values[VERTICALALIGNMENT_MAX] = { "", "top", "middle", "bottom", "baseline" };
+    if ((data <= VERTICALALIGNMENT_NONE) || (data >= VERTICALALIGNMENT_MAX)) {
+        LogWarning("Unknown value '%d' for data.VERTICALALIGNMENT", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+data_VERTICALALIGNMENT AttConverter::StrToVerticalalignment(const std::string &value, bool logWarning) const
+{
+    return StrToVerticalalignment(value.c_str(), logWarning);
 }
 
-data_VERTICALALIGNMENT AttConverter::StrToVerticalalignment(std::string value, bool logWarning) const
+data_VERTICALALIGNMENT AttConverter::StrToVerticalalignment(const char *value, bool logWarning) const
 {
-    if (value == "top") return VERTICALALIGNMENT_top;
-    if (value == "middle") return VERTICALALIGNMENT_middle;
-    if (value == "bottom") return VERTICALALIGNMENT_bottom;
-    if (value == "baseline") return VERTICALALIGNMENT_baseline;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.VERTICALALIGNMENT", value.c_str());
+    static constexpr std::pair<const char *, data_VERTICALALIGNMENT> table[4] = {
+        { "middle", VERTICALALIGNMENT_middle }, { "bottom", VERTICALALIGNMENT_bottom },
+        { "baseline", VERTICALALIGNMENT_baseline }, { "top", VERTICALALIGNMENT_top }
+    };
+    static constexpr uint16_t seeds[2] = { 4, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for data.VERTICALALIGNMENT", value);
     return VERTICALALIGNMENT_NONE;
 }
 
 std::string AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case accidLog_FUNC_caution: value = "caution"; break;
-        case accidLog_FUNC_edit: value = "edit"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.accid.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[accidLog_FUNC_MAX] = { "", "caution", "edit" };
+    if ((data <= accidLog_FUNC_NONE) || (data >= accidLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.accid.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+accidLog_FUNC AttConverter::StrToAccidLogFunc(const std::string &value, bool logWarning) const
+{
+    return StrToAccidLogFunc(value.c_str(), logWarning);
 }
 
-accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string value, bool logWarning) const
+accidLog_FUNC AttConverter::StrToAccidLogFunc(const char *value, bool logWarning) const
 {
-    if (value == "caution") return accidLog_FUNC_caution;
-    if (value == "edit") return accidLog_FUNC_edit;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.accid.log@func", value.c_str());
+    static constexpr std::pair<const char *, accidLog_FUNC> table[2] = {
+        { "edit", accidLog_FUNC_edit }, { "caution", accidLog_FUNC_caution }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.accid.log@func", value);
     return accidLog_FUNC_NONE;
 }
 
 std::string AttConverter::AnchoredTextLogFuncToStr(anchoredTextLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case anchoredTextLog_FUNC_unknown: value = "unknown"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.anchoredText.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[anchoredTextLog_FUNC_MAX] = { "", "unknown" };
+    if ((data <= anchoredTextLog_FUNC_NONE) || (data >= anchoredTextLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.anchoredText.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-anchoredTextLog_FUNC AttConverter::StrToAnchoredTextLogFunc(std::string value, bool logWarning) const
+anchoredTextLog_FUNC AttConverter::StrToAnchoredTextLogFunc(const std::string &value, bool logWarning) const
 {
-    if (value == "unknown") return anchoredTextLog_FUNC_unknown;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.anchoredText.log@func", value.c_str());
+    return StrToAnchoredTextLogFunc(value.c_str(), logWarning);
+}
+
+anchoredTextLog_FUNC AttConverter::StrToAnchoredTextLogFunc(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, anchoredTextLog_FUNC> table[1] = {
+        { "unknown", anchoredTextLog_FUNC_unknown }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.anchoredText.log@func", value);
     return anchoredTextLog_FUNC_NONE;
 }
 
 std::string AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
 {
-    std::string value;
-    switch (data) {
-        case arpegLog_ORDER_up: value = "up"; break;
-        case arpegLog_ORDER_down: value = "down"; break;
-        case arpegLog_ORDER_nonarp: value = "nonarp"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.arpeg.log@order", data);
-            value = "";
-            break;
+    static constexpr const char *values[arpegLog_ORDER_MAX] = { "", "up", "down", "nonarp" };
+    if ((data <= arpegLog_ORDER_NONE) || (data >= arpegLog_ORDER_MAX)) {
+        LogWarning("Unknown value '%d' for att.arpeg.log@order", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string value, bool logWarning) const
+arpegLog_ORDER AttConverter::StrToArpegLogOrder(const std::string &value, bool logWarning) const
 {
-    if (value == "up") return arpegLog_ORDER_up;
-    if (value == "down") return arpegLog_ORDER_down;
-    if (value == "nonarp") return arpegLog_ORDER_nonarp;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.arpeg.log@order", value.c_str());
+    return StrToArpegLogOrder(value.c_str(), logWarning);
+}
+
+arpegLog_ORDER AttConverter::StrToArpegLogOrder(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, arpegLog_ORDER> table[4] = {
+        { "down", arpegLog_ORDER_down }, { "nonarp", arpegLog_ORDER_nonarp }, { "", arpegLog_ORDER_NONE },
+        { "up", arpegLog_ORDER_up }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.arpeg.log@order", value);
     return arpegLog_ORDER_NONE;
 }
 
 std::string AttConverter::AudienceAudienceToStr(audience_AUDIENCE data) const
 {
-    std::string value;
-    switch (data) {
-        case audience_AUDIENCE_private: value = "private"; break;
-        case audience_AUDIENCE_public: value = "public"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.audience@audience", data);
-            value = "";
-            break;
+    static constexpr const char *values[audience_AUDIENCE_MAX] = { "", "private", "public" };
+    if ((data <= audience_AUDIENCE_NONE) || (data >= audience_AUDIENCE_MAX)) {
+        LogWarning("Unknown value '%d' for att.audience@audience", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-audience_AUDIENCE AttConverter::StrToAudienceAudience(std::string value, bool logWarning) const
+audience_AUDIENCE AttConverter::StrToAudienceAudience(const std::string &value, bool logWarning) const
 {
-    if (value == "private") return audience_AUDIENCE_private;
-    if (value == "public") return audience_AUDIENCE_public;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.audience@audience", value.c_str());
+    return StrToAudienceAudience(value.c_str(), logWarning);
+}
+
+audience_AUDIENCE AttConverter::StrToAudienceAudience(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, audience_AUDIENCE> table[2] = {
+        { "public", audience_AUDIENCE_public }, { "private", audience_AUDIENCE_private }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.audience@audience", value);
     return audience_AUDIENCE_NONE;
 }
 
 std::string AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case bTremLog_FORM_meas: value = "meas"; break;
-        case bTremLog_FORM_unmeas: value = "unmeas"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.bTrem.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[bTremLog_FORM_MAX] = { "", "meas", "unmeas" };
+    if ((data <= bTremLog_FORM_NONE) || (data >= bTremLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.bTrem.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+bTremLog_FORM AttConverter::StrToBTremLogForm(const std::string &value, bool logWarning) const
+{
+    return StrToBTremLogForm(value.c_str(), logWarning);
 }
 
-bTremLog_FORM AttConverter::StrToBTremLogForm(std::string value, bool logWarning) const
+bTremLog_FORM AttConverter::StrToBTremLogForm(const char *value, bool logWarning) const
 {
-    if (value == "meas") return bTremLog_FORM_meas;
-    if (value == "unmeas") return bTremLog_FORM_unmeas;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.bTrem.log@form", value.c_str());
+    static constexpr std::pair<const char *, bTremLog_FORM> table[2] = {
+        { "meas", bTremLog_FORM_meas }, { "unmeas", bTremLog_FORM_unmeas }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.bTrem.log@form", value);
     return bTremLog_FORM_NONE;
 }
 
 std::string AttConverter::BeamRendFormToStr(beamRend_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case beamRend_FORM_acc: value = "acc"; break;
-        case beamRend_FORM_mixed: value = "mixed"; break;
-        case beamRend_FORM_rit: value = "rit"; break;
-        case beamRend_FORM_norm: value = "norm"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.beamRend@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[beamRend_FORM_MAX] = { "", "acc", "mixed", "rit", "norm" };
+    if ((data <= beamRend_FORM_NONE) || (data >= beamRend_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.beamRend@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+beamRend_FORM AttConverter::StrToBeamRendForm(const std::string &value, bool logWarning) const
+{
+    return StrToBeamRendForm(value.c_str(), logWarning);
 }
 
-beamRend_FORM AttConverter::StrToBeamRendForm(std::string value, bool logWarning) const
+beamRend_FORM AttConverter::StrToBeamRendForm(const char *value, bool logWarning) const
 {
-    if (value == "acc") return beamRend_FORM_acc;
-    if (value == "mixed") return beamRend_FORM_mixed;
-    if (value == "rit") return beamRend_FORM_rit;
-    if (value == "norm") return beamRend_FORM_norm;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.beamRend@form", value.c_str());
+    static constexpr std::pair<const char *, beamRend_FORM> table[4] = {
+        { "rit", beamRend_FORM_rit }, { "mixed", beamRend_FORM_mixed }, { "acc", beamRend_FORM_acc },
+        { "norm", beamRend_FORM_norm }
+    };
+    static constexpr uint16_t seeds[2] = { 10, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.beamRend@form", value);
     return beamRend_FORM_NONE;
 }
 
 std::string AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) const
 {
-    std::string value;
-    switch (data) {
-        case beamingVis_BEAMREND_acc: value = "acc"; break;
-        case beamingVis_BEAMREND_rit: value = "rit"; break;
-        case beamingVis_BEAMREND_norm: value = "norm"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.beaming.vis@beam.rend", data);
-            value = "";
-            break;
+    static constexpr const char *values[beamingVis_BEAMREND_MAX] = { "", "acc", "rit", "norm" };
+    if ((data <= beamingVis_BEAMREND_NONE) || (data >= beamingVis_BEAMREND_MAX)) {
+        LogWarning("Unknown value '%d' for att.beaming.vis@beam.rend", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string value, bool logWarning) const
+beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(const std::string &value, bool logWarning) const
 {
-    if (value == "acc") return beamingVis_BEAMREND_acc;
-    if (value == "rit") return beamingVis_BEAMREND_rit;
-    if (value == "norm") return beamingVis_BEAMREND_norm;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value.c_str());
+    return StrToBeamingVisBeamrend(value.c_str(), logWarning);
+}
+
+beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, beamingVis_BEAMREND> table[4] = {
+        { "rit", beamingVis_BEAMREND_rit }, { "norm", beamingVis_BEAMREND_norm }, { "", beamingVis_BEAMREND_NONE },
+        { "acc", beamingVis_BEAMREND_acc }
+    };
+    const auto &entry = table[HashToken(value, 5) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value);
     return beamingVis_BEAMREND_NONE;
 }
 
 std::string AttConverter::BracketSpanLogFuncToStr(bracketSpanLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case bracketSpanLog_FUNC_coloration: value = "coloration"; break;
-        case bracketSpanLog_FUNC_cross_rhythm: value = "cross-rhythm"; break;
-        case bracketSpanLog_FUNC_ligature: value = "ligature"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.bracketSpan.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[bracketSpanLog_FUNC_MAX] = { "", "coloration", "cross-rhythm", "ligature" };
+    if ((data <= bracketSpanLog_FUNC_NONE) || (data >= bracketSpanLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.bracketSpan.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-bracketSpanLog_FUNC AttConverter::StrToBracketSpanLogFunc(std::string value, bool logWarning) const
+bracketSpanLog_FUNC AttConverter::StrToBracketSpanLogFunc(const std::string &value, bool logWarning) const
 {
-    if (value == "coloration") return bracketSpanLog_FUNC_coloration;
-    if (value == "cross-rhythm") return bracketSpanLog_FUNC_cross_rhythm;
-    if (value == "ligature") return bracketSpanLog_FUNC_ligature;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.bracketSpan.log@func", value.c_str());
+    return StrToBracketSpanLogFunc(value.c_str(), logWarning);
+}
+
+bracketSpanLog_FUNC AttConverter::StrToBracketSpanLogFunc(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, bracketSpanLog_FUNC> table[4] = {
+        { "", bracketSpanLog_FUNC_NONE }, { "cross-rhythm", bracketSpanLog_FUNC_cross_rhythm },
+        { "ligature", bracketSpanLog_FUNC_ligature }, { "coloration", bracketSpanLog_FUNC_coloration }
+    };
+    const auto &entry = table[HashToken(value, 2) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.bracketSpan.log@func", value);
     return bracketSpanLog_FUNC_NONE;
 }
 
 std::string AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
 {
-    std::string value;
-    switch (data) {
-        case curvature_CURVEDIR_above: value = "above"; break;
-        case curvature_CURVEDIR_below: value = "below"; break;
-        case curvature_CURVEDIR_mixed: value = "mixed"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.curvature@curvedir", data);
-            value = "";
-            break;
+    static constexpr const char *values[curvature_CURVEDIR_MAX] = { "", "above", "below", "mixed" };
+    if ((data <= curvature_CURVEDIR_NONE) || (data >= curvature_CURVEDIR_MAX)) {
+        LogWarning("Unknown value '%d' for att.curvature@curvedir", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string value, bool logWarning) const
+curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(const std::string &value, bool logWarning) const
 {
-    if (value == "above") return curvature_CURVEDIR_above;
-    if (value == "below") return curvature_CURVEDIR_below;
-    if (value == "mixed") return curvature_CURVEDIR_mixed;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.curvature@curvedir", value.c_str());
+    return StrToCurvatureCurvedir(value.c_str(), logWarning);
+}
+
+curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, curvature_CURVEDIR> table[4] = {
+        { "mixed", curvature_CURVEDIR_mixed }, { "below", curvature_CURVEDIR_below }, { "", curvature_CURVEDIR_NONE },
+        { "above", curvature_CURVEDIR_above }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.curvature@curvedir", value);
     return curvature_CURVEDIR_NONE;
 }
 
 std::string AttConverter::CurveLogFuncToStr(curveLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case curveLog_FUNC_unknown: value = "unknown"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.curve.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[curveLog_FUNC_MAX] = { "", "unknown" };
+    if ((data <= curveLog_FUNC_NONE) || (data >= curveLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.curve.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-curveLog_FUNC AttConverter::StrToCurveLogFunc(std::string value, bool logWarning) const
+curveLog_FUNC AttConverter::StrToCurveLogFunc(const std::string &value, bool logWarning) const
 {
-    if (value == "unknown") return curveLog_FUNC_unknown;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.curve.log@func", value.c_str());
+    return StrToCurveLogFunc(value.c_str(), logWarning);
+}
+
+curveLog_FUNC AttConverter::StrToCurveLogFunc(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, curveLog_FUNC> table[1] = {
+        { "unknown", curveLog_FUNC_unknown }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.curve.log@func", value);
     return curveLog_FUNC_NONE;
 }
 
 std::string AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
 {
-    std::string value;
-    switch (data) {
-        case cutout_CUTOUT_cutout: value = "cutout"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.cutout@cutout", data);
-            value = "";
-            break;
+    static constexpr const char *values[cutout_CUTOUT_MAX] = { "", "cutout" };
+    if ((data <= cutout_CUTOUT_NONE) || (data >= cutout_CUTOUT_MAX)) {
+        LogWarning("Unknown value '%d' for att.cutout@cutout", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+cutout_CUTOUT AttConverter::StrToCutoutCutout(const std::string &value, bool logWarning) const
+{
+    return StrToCutoutCutout(value.c_str(), logWarning);
 }
 
-cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string value, bool logWarning) const
+cutout_CUTOUT AttConverter::StrToCutoutCutout(const char *value, bool logWarning) const
 {
-    if (value == "cutout") return cutout_CUTOUT_cutout;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.cutout@cutout", value.c_str());
+    static constexpr std::pair<const char *, cutout_CUTOUT> table[1] = {
+        { "cutout", cutout_CUTOUT_cutout }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.cutout@cutout", value);
     return cutout_CUTOUT_NONE;
 }
 
 std::string AttConverter::DotLogFormToStr(dotLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case dotLog_FORM_aug: value = "aug"; break;
-        case dotLog_FORM_div: value = "div"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.dot.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[dotLog_FORM_MAX] = { "", "aug", "div" };
+    if ((data <= dotLog_FORM_NONE) || (data >= dotLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.dot.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+dotLog_FORM AttConverter::StrToDotLogForm(const std::string &value, bool logWarning) const
+{
+    return StrToDotLogForm(value.c_str(), logWarning);
 }
 
-dotLog_FORM AttConverter::StrToDotLogForm(std::string value, bool logWarning) const
+dotLog_FORM AttConverter::StrToDotLogForm(const char *value, bool logWarning) const
 {
-    if (value == "aug") return dotLog_FORM_aug;
-    if (value == "div") return dotLog_FORM_div;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.dot.log@form", value.c_str());
+    static constexpr std::pair<const char *, dotLog_FORM> table[2] = {
+        { "div", dotLog_FORM_div }, { "aug", dotLog_FORM_aug }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.dot.log@form", value);
     return dotLog_FORM_NONE;
 }
 
 std::string AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
 {
-    std::string value;
-    switch (data) {
-        case endings_ENDINGREND_top: value = "top"; break;
-        case endings_ENDINGREND_barred: value = "barred"; break;
-        case endings_ENDINGREND_grouped: value = "grouped"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.endings@ending.rend", data);
-            value = "";
-            break;
+    static constexpr const char *values[endings_ENDINGREND_MAX] = { "", "top", "barred", "grouped" };
+    if ((data <= endings_ENDINGREND_NONE) || (data >= endings_ENDINGREND_MAX)) {
+        LogWarning("Unknown value '%d' for att.endings@ending.rend", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+endings_ENDINGREND AttConverter::StrToEndingsEndingrend(const std::string &value, bool logWarning) const
+{
+    return StrToEndingsEndingrend(value.c_str(), logWarning);
 }
 
-endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string value, bool logWarning) const
+endings_ENDINGREND AttConverter::StrToEndingsEndingrend(const char *value, bool logWarning) const
 {
-    if (value == "top") return endings_ENDINGREND_top;
-    if (value == "barred") return endings_ENDINGREND_barred;
-    if (value == "grouped") return endings_ENDINGREND_grouped;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.endings@ending.rend", value.c_str());
+    static constexpr std::pair<const char *, endings_ENDINGREND> table[4] = {
+        { "top", endings_ENDINGREND_top }, { "barred", endings_ENDINGREND_barred }, { "", endings_ENDINGREND_NONE },
+        { "grouped", endings_ENDINGREND_grouped }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.endings@ending.rend", value);
     return endings_ENDINGREND_NONE;
 }
 
 std::string AttConverter::EpisemaVisFormToStr(episemaVis_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case episemaVis_FORM_h: value = "h"; break;
-        case episemaVis_FORM_v: value = "v"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.episema.vis@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[episemaVis_FORM_MAX] = { "", "h", "v" };
+    if ((data <= episemaVis_FORM_NONE) || (data >= episemaVis_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.episema.vis@form", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-episemaVis_FORM AttConverter::StrToEpisemaVisForm(std::string value, bool logWarning) const
+episemaVis_FORM AttConverter::StrToEpisemaVisForm(const std::string &value, bool logWarning) const
 {
-    if (value == "h") return episemaVis_FORM_h;
-    if (value == "v") return episemaVis_FORM_v;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.episema.vis@form", value.c_str());
+    return StrToEpisemaVisForm(value.c_str(), logWarning);
+}
+
+episemaVis_FORM AttConverter::StrToEpisemaVisForm(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, episemaVis_FORM> table[2] = {
+        { "h", episemaVis_FORM_h }, { "v", episemaVis_FORM_v }
+    };
+    const auto &entry = table[HashToken(value, 36) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.episema.vis@form", value);
     return episemaVis_FORM_NONE;
 }
 
 std::string AttConverter::EvidenceEvidenceToStr(evidence_EVIDENCE data) const
 {
-    std::string value;
-    switch (data) {
-        case evidence_EVIDENCE_internal: value = "internal"; break;
-        case evidence_EVIDENCE_external: value = "external"; break;
-        case evidence_EVIDENCE_conjecture: value = "conjecture"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.evidence@evidence", data);
-            value = "";
-            break;
+    static constexpr const char *values[evidence_EVIDENCE_MAX] = { "", "internal", "external", "conjecture" };
+    if ((data <= evidence_EVIDENCE_NONE) || (data >= evidence_EVIDENCE_MAX)) {
+        LogWarning("Unknown value '%d' for att.evidence@evidence", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+evidence_EVIDENCE AttConverter::StrToEvidenceEvidence(const std::string &value, bool logWarning) const
+{
+    return StrToEvidenceEvidence(value.c_str(), logWarning);
 }
 
-evidence_EVIDENCE AttConverter::StrToEvidenceEvidence(std::string value, bool logWarning) const
+evidence_EVIDENCE AttConverter::StrToEvidenceEvidence(const char *value, bool logWarning) const
 {
-    if (value == "internal") return evidence_EVIDENCE_internal;
-    if (value == "external") return evidence_EVIDENCE_external;
-    if (value == "conjecture") return evidence_EVIDENCE_conjecture;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.evidence@evidence", value.c_str());
+    static constexpr std::pair<const char *, evidence_EVIDENCE> table[4] = {
+        { "", evidence_EVIDENCE_NONE }, { "internal", evidence_EVIDENCE_internal },
+        { "conjecture", evidence_EVIDENCE_conjecture }, { "external", evidence_EVIDENCE_external }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.evidence@evidence", value);
     return evidence_EVIDENCE_NONE;
 }
 
 std::string AttConverter::ExtSymGlyphauthToStr(extSym_GLYPHAUTH data) const
 {
-    std::string value;
-    switch (data) {
-        case extSym_GLYPHAUTH_smufl: value = "smufl"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.extSym@glyph.auth", data);
-            value = "";
-            break;
+    static constexpr const char *values[extSym_GLYPHAUTH_MAX] = { "", "smufl" };
+    if ((data <= extSym_GLYPHAUTH_NONE) || (data >= extSym_GLYPHAUTH_MAX)) {
+        LogWarning("Unknown value '%d' for att.extSym@glyph.auth", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-extSym_GLYPHAUTH AttConverter::StrToExtSymGlyphauth(std::string value, bool logWarning) const
+extSym_GLYPHAUTH AttConverter::StrToExtSymGlyphauth(const std::string &value, bool logWarning) const
 {
-    if (value == "smufl") return extSym_GLYPHAUTH_smufl;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.extSym@glyph.auth", value.c_str());
+    return StrToExtSymGlyphauth(value.c_str(), logWarning);
+}
+
+extSym_GLYPHAUTH AttConverter::StrToExtSymGlyphauth(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, extSym_GLYPHAUTH> table[1] = {
+        { "smufl", extSym_GLYPHAUTH_smufl }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.extSym@glyph.auth", value);
     return extSym_GLYPHAUTH_NONE;
 }
 
 std::string AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case fTremLog_FORM_meas: value = "meas"; break;
-        case fTremLog_FORM_unmeas: value = "unmeas"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.fTrem.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[fTremLog_FORM_MAX] = { "", "meas", "unmeas" };
+    if ((data <= fTremLog_FORM_NONE) || (data >= fTremLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.fTrem.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+fTremLog_FORM AttConverter::StrToFTremLogForm(const std::string &value, bool logWarning) const
+{
+    return StrToFTremLogForm(value.c_str(), logWarning);
 }
 
-fTremLog_FORM AttConverter::StrToFTremLogForm(std::string value, bool logWarning) const
+fTremLog_FORM AttConverter::StrToFTremLogForm(const char *value, bool logWarning) const
 {
-    if (value == "meas") return fTremLog_FORM_meas;
-    if (value == "unmeas") return fTremLog_FORM_unmeas;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fTrem.log@form", value.c_str());
+    static constexpr std::pair<const char *, fTremLog_FORM> table[2] = {
+        { "meas", fTremLog_FORM_meas }, { "unmeas", fTremLog_FORM_unmeas }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.fTrem.log@form", value);
     return fTremLog_FORM_NONE;
 }
 
 std::string AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case fermataVis_FORM_inv: value = "inv"; break;
-        case fermataVis_FORM_norm: value = "norm"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.fermata.vis@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[fermataVis_FORM_MAX] = { "", "inv", "norm" };
+    if ((data <= fermataVis_FORM_NONE) || (data >= fermataVis_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.fermata.vis@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+fermataVis_FORM AttConverter::StrToFermataVisForm(const std::string &value, bool logWarning) const
+{
+    return StrToFermataVisForm(value.c_str(), logWarning);
 }
 
-fermataVis_FORM AttConverter::StrToFermataVisForm(std::string value, bool logWarning) const
+fermataVis_FORM AttConverter::StrToFermataVisForm(const char *value, bool logWarning) const
 {
-    if (value == "inv") return fermataVis_FORM_inv;
-    if (value == "norm") return fermataVis_FORM_norm;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fermata.vis@form", value.c_str());
+    static constexpr std::pair<const char *, fermataVis_FORM> table[2] = {
+        { "norm", fermataVis_FORM_norm }, { "inv", fermataVis_FORM_inv }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.fermata.vis@form", value);
     return fermataVis_FORM_NONE;
 }
 
 std::string AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
 {
-    std::string value;
-    switch (data) {
-        case fermataVis_SHAPE_curved: value = "curved"; break;
-        case fermataVis_SHAPE_square: value = "square"; break;
-        case fermataVis_SHAPE_angular: value = "angular"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.fermata.vis@shape", data);
-            value = "";
-            break;
+    static constexpr const char *values[fermataVis_SHAPE_MAX] = { "", "curved", "square", "angular" };
+    if ((data <= fermataVis_SHAPE_NONE) || (data >= fermataVis_SHAPE_MAX)) {
+        LogWarning("Unknown value '%d' for att.fermata.vis@shape", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string value, bool logWarning) const
+fermataVis_SHAPE AttConverter::StrToFermataVisShape(const std::string &value, bool logWarning) const
 {
-    if (value == "curved") return fermataVis_SHAPE_curved;
-    if (value == "square") return fermataVis_SHAPE_square;
-    if (value == "angular") return fermataVis_SHAPE_angular;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value.c_str());
+    return StrToFermataVisShape(value.c_str(), logWarning);
+}
+
+fermataVis_SHAPE AttConverter::StrToFermataVisShape(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, fermataVis_SHAPE> table[4] = {
+        { "square", fermataVis_SHAPE_square }, { "angular", fermataVis_SHAPE_angular },
+        { "curved", fermataVis_SHAPE_curved }, { "", fermataVis_SHAPE_NONE }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value);
     return fermataVis_SHAPE_NONE;
 }
 
 std::string AttConverter::FingGrpLogFormToStr(fingGrpLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case fingGrpLog_FORM_alter: value = "alter"; break;
-        case fingGrpLog_FORM_combi: value = "combi"; break;
-        case fingGrpLog_FORM_subst: value = "subst"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.fingGrp.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[fingGrpLog_FORM_MAX] = { "", "alter", "combi", "subst" };
+    if ((data <= fingGrpLog_FORM_NONE) || (data >= fingGrpLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.fingGrp.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-fingGrpLog_FORM AttConverter::StrToFingGrpLogForm(std::string value, bool logWarning) const
+fingGrpLog_FORM AttConverter::StrToFingGrpLogForm(const std::string &value, bool logWarning) const
 {
-    if (value == "alter") return fingGrpLog_FORM_alter;
-    if (value == "combi") return fingGrpLog_FORM_combi;
-    if (value == "subst") return fingGrpLog_FORM_subst;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fingGrp.log@form", value.c_str());
+    return StrToFingGrpLogForm(value.c_str(), logWarning);
+}
+
+fingGrpLog_FORM AttConverter::StrToFingGrpLogForm(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, fingGrpLog_FORM> table[4] = {
+        { "", fingGrpLog_FORM_NONE }, { "alter", fingGrpLog_FORM_alter }, { "subst", fingGrpLog_FORM_subst },
+        { "combi", fingGrpLog_FORM_combi }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.fingGrp.log@form", value);
     return fingGrpLog_FORM_NONE;
 }
 
 std::string AttConverter::FingGrpVisOrientToStr(fingGrpVis_ORIENT data) const
 {
-    std::string value;
-    switch (data) {
-        case fingGrpVis_ORIENT_horiz: value = "horiz"; break;
-        case fingGrpVis_ORIENT_vert: value = "vert"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.fingGrp.vis@orient", data);
-            value = "";
-            break;
+    static constexpr const char *values[fingGrpVis_ORIENT_MAX] = { "", "horiz", "vert" };
+    if ((data <= fingGrpVis_ORIENT_NONE) || (data >= fingGrpVis_ORIENT_MAX)) {
+        LogWarning("Unknown value '%d' for att.fingGrp.vis@orient", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+fingGrpVis_ORIENT AttConverter::StrToFingGrpVisOrient(const std::string &value, bool logWarning) const
+{
+    return StrToFingGrpVisOrient(value.c_str(), logWarning);
 }
 
-fingGrpVis_ORIENT AttConverter::StrToFingGrpVisOrient(std::string value, bool logWarning) const
+fingGrpVis_ORIENT AttConverter::StrToFingGrpVisOrient(const char *value, bool logWarning) const
 {
-    if (value == "horiz") return fingGrpVis_ORIENT_horiz;
-    if (value == "vert") return fingGrpVis_ORIENT_vert;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fingGrp.vis@orient", value.c_str());
+    static constexpr std::pair<const char *, fingGrpVis_ORIENT> table[2] = {
+        { "horiz", fingGrpVis_ORIENT_horiz }, { "vert", fingGrpVis_ORIENT_vert }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.fingGrp.vis@orient", value);
     return fingGrpVis_ORIENT_NONE;
 }
 
 std::string AttConverter::GraceGrpLogAttachToStr(graceGrpLog_ATTACH data) const
 {
-    std::string value;
-    switch (data) {
-        case graceGrpLog_ATTACH_pre: value = "pre"; break;
-        case graceGrpLog_ATTACH_post: value = "post"; break;
-        case graceGrpLog_ATTACH_unknown: value = "unknown"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.graceGrp.log@attach", data);
-            value = "";
-            break;
+    static constexpr const char *values[graceGrpLog_ATTACH_MAX] = { "", "pre", "post", "unknown" };
+    if ((data <= graceGrpLog_ATTACH_NONE) || (data >= graceGrpLog_ATTACH_MAX)) {
+        LogWarning("Unknown value '%d' for att.graceGrp.log@attach", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-graceGrpLog_ATTACH AttConverter::StrToGraceGrpLogAttach(std::string value, bool logWarning) const
+graceGrpLog_ATTACH AttConverter::StrToGraceGrpLogAttach(const std::string &value, bool logWarning) const
 {
-    if (value == "pre") return graceGrpLog_ATTACH_pre;
-    if (value == "post") return graceGrpLog_ATTACH_post;
-    if (value == "unknown") return graceGrpLog_ATTACH_unknown;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.graceGrp.log@attach", value.c_str());
+    return StrToGraceGrpLogAttach(value.c_str(), logWarning);
+}
+
+graceGrpLog_ATTACH AttConverter::StrToGraceGrpLogAttach(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, graceGrpLog_ATTACH> table[4] = {
+        { "", graceGrpLog_ATTACH_NONE }, { "pre", graceGrpLog_ATTACH_pre }, { "unknown", graceGrpLog_ATTACH_unknown },
+        { "post", graceGrpLog_ATTACH_post }
+    };
+    const auto &entry = table[HashToken(value, 1) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.graceGrp.log@attach", value);
     return graceGrpLog_ATTACH_NONE;
 }
 
 std::string AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case hairpinLog_FORM_cres: value = "cres"; break;
-        case hairpinLog_FORM_dim: value = "dim"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.hairpin.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[hairpinLog_FORM_MAX] = { "", "cres", "dim" };
+    if ((data <= hairpinLog_FORM_NONE) || (data >= hairpinLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.hairpin.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+hairpinLog_FORM AttConverter::StrToHairpinLogForm(const std::string &value, bool logWarning) const
+{
+    return StrToHairpinLogForm(value.c_str(), logWarning);
 }
 
-hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string value, bool logWarning) const
+hairpinLog_FORM AttConverter::StrToHairpinLogForm(const char *value, bool logWarning) const
 {
-    if (value == "cres") return hairpinLog_FORM_cres;
-    if (value == "dim") return hairpinLog_FORM_dim;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.hairpin.log@form", value.c_str());
+    static constexpr std::pair<const char *, hairpinLog_FORM> table[2] = {
+        { "dim", hairpinLog_FORM_dim }, { "cres", hairpinLog_FORM_cres }
+    };
+    const auto &entry = table[HashToken(value, 11) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.hairpin.log@form", value);
     return hairpinLog_FORM_NONE;
 }
 
 std::string AttConverter::HarmAnlFormToStr(harmAnl_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case harmAnl_FORM_explicit: value = "explicit"; break;
-        case harmAnl_FORM_implied: value = "implied"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harm.anl@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[harmAnl_FORM_MAX] = { "", "explicit", "implied" };
+    if ((data <= harmAnl_FORM_NONE) || (data >= harmAnl_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.harm.anl@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+harmAnl_FORM AttConverter::StrToHarmAnlForm(const std::string &value, bool logWarning) const
+{
+    return StrToHarmAnlForm(value.c_str(), logWarning);
 }
 
-harmAnl_FORM AttConverter::StrToHarmAnlForm(std::string value, bool logWarning) const
+harmAnl_FORM AttConverter::StrToHarmAnlForm(const char *value, bool logWarning) const
 {
-    if (value == "explicit") return harmAnl_FORM_explicit;
-    if (value == "implied") return harmAnl_FORM_implied;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harm.anl@form", value.c_str());
+    static constexpr std::pair<const char *, harmAnl_FORM> table[2] = {
+        { "explicit", harmAnl_FORM_explicit }, { "implied", harmAnl_FORM_implied }
+    };
+    const auto &entry = table[HashToken(value, 1) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harm.anl@form", value);
     return harmAnl_FORM_NONE;
 }
 
 std::string AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
 {
-    std::string value;
-    switch (data) {
-        case harmVis_RENDGRID_grid: value = "grid"; break;
-        case harmVis_RENDGRID_gridtext: value = "gridtext"; break;
-        case harmVis_RENDGRID_text: value = "text"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harm.vis@rendgrid", data);
-            value = "";
-            break;
+    static constexpr const char *values[harmVis_RENDGRID_MAX] = { "", "grid", "gridtext", "text" };
+    if ((data <= harmVis_RENDGRID_NONE) || (data >= harmVis_RENDGRID_MAX)) {
+        LogWarning("Unknown value '%d' for att.harm.vis@rendgrid", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string value, bool logWarning) const
+harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(const std::string &value, bool logWarning) const
 {
-    if (value == "grid") return harmVis_RENDGRID_grid;
-    if (value == "gridtext") return harmVis_RENDGRID_gridtext;
-    if (value == "text") return harmVis_RENDGRID_text;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value.c_str());
+    return StrToHarmVisRendgrid(value.c_str(), logWarning);
+}
+
+harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, harmVis_RENDGRID> table[4] = {
+        { "", harmVis_RENDGRID_NONE }, { "gridtext", harmVis_RENDGRID_gridtext }, { "grid", harmVis_RENDGRID_grid },
+        { "text", harmVis_RENDGRID_text }
+    };
+    const auto &entry = table[HashToken(value, 4) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value);
     return harmVis_RENDGRID_NONE;
 }
 
 std::string AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_A_f: value = "f"; break;
-        case harpPedalLog_A_n: value = "n"; break;
-        case harpPedalLog_A_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@a", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_A_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_A_NONE) || (data >= harpPedalLog_A_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@a", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string value, bool logWarning) const
+harpPedalLog_A AttConverter::StrToHarpPedalLogA(const std::string &value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_A_f;
-    if (value == "n") return harpPedalLog_A_n;
-    if (value == "s") return harpPedalLog_A_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value.c_str());
+    return StrToHarpPedalLogA(value.c_str(), logWarning);
+}
+
+harpPedalLog_A AttConverter::StrToHarpPedalLogA(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, harpPedalLog_A> table[4] = {
+        { "", harpPedalLog_A_NONE }, { "s", harpPedalLog_A_s }, { "n", harpPedalLog_A_n }, { "f", harpPedalLog_A_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value);
     return harpPedalLog_A_NONE;
 }
 
 std::string AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_B_f: value = "f"; break;
-        case harpPedalLog_B_n: value = "n"; break;
-        case harpPedalLog_B_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@b", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_B_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_B_NONE) || (data >= harpPedalLog_B_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@b", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string value, bool logWarning) const
+harpPedalLog_B AttConverter::StrToHarpPedalLogB(const std::string &value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_B_f;
-    if (value == "n") return harpPedalLog_B_n;
-    if (value == "s") return harpPedalLog_B_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value.c_str());
+    return StrToHarpPedalLogB(value.c_str(), logWarning);
+}
+
+harpPedalLog_B AttConverter::StrToHarpPedalLogB(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, harpPedalLog_B> table[4] = {
+        { "", harpPedalLog_B_NONE }, { "s", harpPedalLog_B_s }, { "n", harpPedalLog_B_n }, { "f", harpPedalLog_B_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value);
     return harpPedalLog_B_NONE;
 }
 
 std::string AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_C_f: value = "f"; break;
-        case harpPedalLog_C_n: value = "n"; break;
-        case harpPedalLog_C_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@c", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_C_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_C_NONE) || (data >= harpPedalLog_C_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@c", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string value, bool logWarning) const
+harpPedalLog_C AttConverter::StrToHarpPedalLogC(const std::string &value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_C_f;
-    if (value == "n") return harpPedalLog_C_n;
-    if (value == "s") return harpPedalLog_C_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value.c_str());
+    return StrToHarpPedalLogC(value.c_str(), logWarning);
+}
+
+harpPedalLog_C AttConverter::StrToHarpPedalLogC(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, harpPedalLog_C> table[4] = {
+        { "", harpPedalLog_C_NONE }, { "s", harpPedalLog_C_s }, { "n", harpPedalLog_C_n }, { "f", harpPedalLog_C_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value);
     return harpPedalLog_C_NONE;
 }
 
 std::string AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_D_f: value = "f"; break;
-        case harpPedalLog_D_n: value = "n"; break;
-        case harpPedalLog_D_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@d", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_D_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_D_NONE) || (data >= harpPedalLog_D_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@d", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+harpPedalLog_D AttConverter::StrToHarpPedalLogD(const std::string &value, bool logWarning) const
+{
+    return StrToHarpPedalLogD(value.c_str(), logWarning);
 }
 
-harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string value, bool logWarning) const
+harpPedalLog_D AttConverter::StrToHarpPedalLogD(const char *value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_D_f;
-    if (value == "n") return harpPedalLog_D_n;
-    if (value == "s") return harpPedalLog_D_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value.c_str());
+    static constexpr std::pair<const char *, harpPedalLog_D> table[4] = {
+        { "", harpPedalLog_D_NONE }, { "s", harpPedalLog_D_s }, { "n", harpPedalLog_D_n }, { "f", harpPedalLog_D_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value);
     return harpPedalLog_D_NONE;
 }
 
 std::string AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_E_f: value = "f"; break;
-        case harpPedalLog_E_n: value = "n"; break;
-        case harpPedalLog_E_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@e", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_E_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_E_NONE) || (data >= harpPedalLog_E_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@e", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+harpPedalLog_E AttConverter::StrToHarpPedalLogE(const std::string &value, bool logWarning) const
+{
+    return StrToHarpPedalLogE(value.c_str(), logWarning);
 }
 
-harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string value, bool logWarning) const
+harpPedalLog_E AttConverter::StrToHarpPedalLogE(const char *value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_E_f;
-    if (value == "n") return harpPedalLog_E_n;
-    if (value == "s") return harpPedalLog_E_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value.c_str());
+    static constexpr std::pair<const char *, harpPedalLog_E> table[4] = {
+        { "", harpPedalLog_E_NONE }, { "s", harpPedalLog_E_s }, { "n", harpPedalLog_E_n }, { "f", harpPedalLog_E_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value);
     return harpPedalLog_E_NONE;
 }
 
 std::string AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_F_f: value = "f"; break;
-        case harpPedalLog_F_n: value = "n"; break;
-        case harpPedalLog_F_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@f", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_F_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_F_NONE) || (data >= harpPedalLog_F_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@f", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string value, bool logWarning) const
+harpPedalLog_F AttConverter::StrToHarpPedalLogF(const std::string &value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_F_f;
-    if (value == "n") return harpPedalLog_F_n;
-    if (value == "s") return harpPedalLog_F_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value.c_str());
+    return StrToHarpPedalLogF(value.c_str(), logWarning);
+}
+
+harpPedalLog_F AttConverter::StrToHarpPedalLogF(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, harpPedalLog_F> table[4] = {
+        { "", harpPedalLog_F_NONE }, { "s", harpPedalLog_F_s }, { "n", harpPedalLog_F_n }, { "f", harpPedalLog_F_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value);
     return harpPedalLog_F_NONE;
 }
 
 std::string AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
 {
-    std::string value;
-    switch (data) {
-        case harpPedalLog_G_f: value = "f"; break;
-        case harpPedalLog_G_n: value = "n"; break;
-        case harpPedalLog_G_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.harpPedal.log@g", data);
-            value = "";
-            break;
+    static constexpr const char *values[harpPedalLog_G_MAX] = { "", "f", "n", "s" };
+    if ((data <= harpPedalLog_G_NONE) || (data >= harpPedalLog_G_MAX)) {
+        LogWarning("Unknown value '%d' for att.harpPedal.log@g", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string value, bool logWarning) const
+harpPedalLog_G AttConverter::StrToHarpPedalLogG(const std::string &value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_G_f;
-    if (value == "n") return harpPedalLog_G_n;
-    if (value == "s") return harpPedalLog_G_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value.c_str());
+    return StrToHarpPedalLogG(value.c_str(), logWarning);
+}
+
+harpPedalLog_G AttConverter::StrToHarpPedalLogG(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, harpPedalLog_G> table[4] = {
+        { "", harpPedalLog_G_NONE }, { "s", harpPedalLog_G_s }, { "n", harpPedalLog_G_n }, { "f", harpPedalLog_G_f }
+    };
+    const auto &entry = table[HashToken(value, 320) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value);
     return harpPedalLog_G_NONE;
 }
 
 std::string AttConverter::LineLogFuncToStr(lineLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case lineLog_FUNC_coloration: value = "coloration"; break;
-        case lineLog_FUNC_ligature: value = "ligature"; break;
-        case lineLog_FUNC_unknown: value = "unknown"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.line.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[lineLog_FUNC_MAX] = { "", "coloration", "ligature", "unknown" };
+    if ((data <= lineLog_FUNC_NONE) || (data >= lineLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.line.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+lineLog_FUNC AttConverter::StrToLineLogFunc(const std::string &value, bool logWarning) const
+{
+    return StrToLineLogFunc(value.c_str(), logWarning);
 }
 
-lineLog_FUNC AttConverter::StrToLineLogFunc(std::string value, bool logWarning) const
+lineLog_FUNC AttConverter::StrToLineLogFunc(const char *value, bool logWarning) const
 {
-    if (value == "coloration") return lineLog_FUNC_coloration;
-    if (value == "ligature") return lineLog_FUNC_ligature;
-    if (value == "unknown") return lineLog_FUNC_unknown;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.line.log@func", value.c_str());
+    static constexpr std::pair<const char *, lineLog_FUNC> table[4] = {
+        { "unknown", lineLog_FUNC_unknown }, { "", lineLog_FUNC_NONE }, { "ligature", lineLog_FUNC_ligature },
+        { "coloration", lineLog_FUNC_coloration }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.line.log@func", value);
     return lineLog_FUNC_NONE;
 }
 
 std::string AttConverter::LiquescentVisCurveToStr(liquescentVis_CURVE data) const
 {
-    std::string value;
-    switch (data) {
-        case liquescentVis_CURVE_a: value = "a"; break;
-        case liquescentVis_CURVE_c: value = "c"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.liquescent.vis@curve", data);
-            value = "";
-            break;
+    static constexpr const char *values[liquescentVis_CURVE_MAX] = { "", "a", "c" };
+    if ((data <= liquescentVis_CURVE_NONE) || (data >= liquescentVis_CURVE_MAX)) {
+        LogWarning("Unknown value '%d' for att.liquescent.vis@curve", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+liquescentVis_CURVE AttConverter::StrToLiquescentVisCurve(const std::string &value, bool logWarning) const
+{
+    return StrToLiquescentVisCurve(value.c_str(), logWarning);
 }
 
-liquescentVis_CURVE AttConverter::StrToLiquescentVisCurve(std::string value, bool logWarning) const
+liquescentVis_CURVE AttConverter::StrToLiquescentVisCurve(const char *value, bool logWarning) const
 {
-    if (value == "a") return liquescentVis_CURVE_a;
-    if (value == "c") return liquescentVis_CURVE_c;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.liquescent.vis@curve", value.c_str());
+    static constexpr std::pair<const char *, liquescentVis_CURVE> table[2] = {
+        { "c", liquescentVis_CURVE_c }, { "a", liquescentVis_CURVE_a }
+    };
+    const auto &entry = table[HashToken(value, 44) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.liquescent.vis@curve", value);
     return liquescentVis_CURVE_NONE;
 }
 
 std::string AttConverter::MeasurementUnitToStr(measurement_UNIT data) const
 {
-    std::string value;
-    switch (data) {
-        case measurement_UNIT_byte: value = "byte"; break;
-        case measurement_UNIT_char: value = "char"; break;
-        case measurement_UNIT_cm: value = "cm"; break;
-        case measurement_UNIT_deg: value = "deg"; break;
-        case measurement_UNIT_in: value = "in"; break;
-        case measurement_UNIT_issue: value = "issue"; break;
-        case measurement_UNIT_ft: value = "ft"; break;
-        case measurement_UNIT_m: value = "m"; break;
-        case measurement_UNIT_mm: value = "mm"; break;
-        case measurement_UNIT_page: value = "page"; break;
-        case measurement_UNIT_pc: value = "pc"; break;
-        case measurement_UNIT_pt: value = "pt"; break;
-        case measurement_UNIT_px: value = "px"; break;
-        case measurement_UNIT_rad: value = "rad"; break;
-        case measurement_UNIT_record: value = "record"; break;
-        case measurement_UNIT_vol: value = "vol"; break;
-        case measurement_UNIT_vu: value = "vu"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.measurement@unit", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-measurement_UNIT AttConverter::StrToMeasurementUnit(std::string value, bool logWarning) const
-{
-    if (value == "byte") return measurement_UNIT_byte;
-    if (value == "char") return measurement_UNIT_char;
-    if (value == "cm") return measurement_UNIT_cm;
-    if (value == "deg") return measurement_UNIT_deg;
-    if (value == "in") return measurement_UNIT_in;
-    if (value == "issue") return measurement_UNIT_issue;
-    if (value == "ft") return measurement_UNIT_ft;
-    if (value == "m") return measurement_UNIT_m;
-    if (value == "mm") return measurement_UNIT_mm;
-    if (value == "page") return measurement_UNIT_page;
-    if (value == "pc") return measurement_UNIT_pc;
-    if (value == "pt") return measurement_UNIT_pt;
-    if (value == "px") return measurement_UNIT_px;
-    if (value == "rad") return measurement_UNIT_rad;
-    if (value == "record") return measurement_UNIT_record;
-    if (value == "vol") return measurement_UNIT_vol;
-    if (value == "vu") return measurement_UNIT_vu;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.measurement@unit", value.c_str());
+    static constexpr const char *values[measurement_UNIT_MAX] = {
+        "", "byte", "char", "cm", "deg", "in", "issue", "ft", "m", "mm", "page", "pc", "pt", "px", "rad", "record",
+        "vol", "vu"
+    };
+    if ((data <= measurement_UNIT_NONE) || (data >= measurement_UNIT_MAX)) {
+        LogWarning("Unknown value '%d' for att.measurement@unit", data);
+        return "";
+    }
+    return values[data];
+}
+
+measurement_UNIT AttConverter::StrToMeasurementUnit(const std::string &value, bool logWarning) const
+{
+    return StrToMeasurementUnit(value.c_str(), logWarning);
+}
+
+measurement_UNIT AttConverter::StrToMeasurementUnit(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, measurement_UNIT> table[32] = {
+        { "", measurement_UNIT_NONE }, { "mm", measurement_UNIT_mm }, { "", measurement_UNIT_NONE },
+        { "px", measurement_UNIT_px }, { "cm", measurement_UNIT_cm }, { "byte", measurement_UNIT_byte },
+        { "", measurement_UNIT_NONE }, { "", measurement_UNIT_NONE }, { "vol", measurement_UNIT_vol },
+        { "", measurement_UNIT_NONE }, { "pc", measurement_UNIT_pc }, { "deg", measurement_UNIT_deg },
+        { "", measurement_UNIT_NONE }, { "issue", measurement_UNIT_issue }, { "", measurement_UNIT_NONE },
+        { "pt", measurement_UNIT_pt }, { "in", measurement_UNIT_in }, { "char", measurement_UNIT_char },
+        { "", measurement_UNIT_NONE }, { "", measurement_UNIT_NONE }, { "m", measurement_UNIT_m },
+        { "ft", measurement_UNIT_ft }, { "", measurement_UNIT_NONE }, { "rad", measurement_UNIT_rad },
+        { "", measurement_UNIT_NONE }, { "", measurement_UNIT_NONE }, { "", measurement_UNIT_NONE },
+        { "", measurement_UNIT_NONE }, { "record", measurement_UNIT_record }, { "vu", measurement_UNIT_vu },
+        { "page", measurement_UNIT_page }, { "", measurement_UNIT_NONE }
+    };
+    static constexpr uint16_t seeds[8] = { 0, 0, 0, 2, 0, 0, 2, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.measurement@unit", value);
     return measurement_UNIT_NONE;
 }
 
 std::string AttConverter::MeiVersionMeiversionToStr(meiVersion_MEIVERSION data) const
 {
-    std::string value;
-    switch (data) {
-        case meiVersion_MEIVERSION_4_0_0: value = "4.0.0"; break;
-        case meiVersion_MEIVERSION_4_0_1: value = "4.0.1"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.meiVersion@meiversion", data);
-            value = "";
-            break;
+    static constexpr const char *values[meiVersion_MEIVERSION_MAX] = { "", "4.0.0", "4.0.1" };
+    if ((data <= meiVersion_MEIVERSION_NONE) || (data >= meiVersion_MEIVERSION_MAX)) {
+        LogWarning("Unknown value '%d' for att.meiVersion@meiversion", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+meiVersion_MEIVERSION AttConverter::StrToMeiVersionMeiversion(const std::string &value, bool logWarning) const
+{
+    return StrToMeiVersionMeiversion(value.c_str(), logWarning);
 }
 
-meiVersion_MEIVERSION AttConverter::StrToMeiVersionMeiversion(std::string value, bool logWarning) const
+meiVersion_MEIVERSION AttConverter::StrToMeiVersionMeiversion(const char *value, bool logWarning) const
 {
-    if (value == "4.0.0") return meiVersion_MEIVERSION_4_0_0;
-    if (value == "4.0.1") return meiVersion_MEIVERSION_4_0_1;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.meiVersion@meiversion", value.c_str());
+    static constexpr std::pair<const char *, meiVersion_MEIVERSION> table[2] = {
+        { "4.0.0", meiVersion_MEIVERSION_4_0_0 }, { "4.0.1", meiVersion_MEIVERSION_4_0_1 }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.meiVersion@meiversion", value);
     return meiVersion_MEIVERSION_NONE;
 }
 
 std::string AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case mensurVis_FORM_horizontal: value = "horizontal"; break;
-        case mensurVis_FORM_vertical: value = "vertical"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.mensur.vis@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[mensurVis_FORM_MAX] = { "", "horizontal", "vertical" };
+    if ((data <= mensurVis_FORM_NONE) || (data >= mensurVis_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.mensur.vis@form", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-mensurVis_FORM AttConverter::StrToMensurVisForm(std::string value, bool logWarning) const
+mensurVis_FORM AttConverter::StrToMensurVisForm(const std::string &value, bool logWarning) const
 {
-    if (value == "horizontal") return mensurVis_FORM_horizontal;
-    if (value == "vertical") return mensurVis_FORM_vertical;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.mensur.vis@form", value.c_str());
+    return StrToMensurVisForm(value.c_str(), logWarning);
+}
+
+mensurVis_FORM AttConverter::StrToMensurVisForm(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, mensurVis_FORM> table[2] = {
+        { "horizontal", mensurVis_FORM_horizontal }, { "vertical", mensurVis_FORM_vertical }
+    };
+    const auto &entry = table[HashToken(value, 3) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.mensur.vis@form", value);
     return mensurVis_FORM_NONE;
 }
 
 std::string AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data) const
 {
-    std::string value;
-    switch (data) {
-        case mensuralVis_MENSURFORM_horizontal: value = "horizontal"; break;
-        case mensuralVis_MENSURFORM_vertical: value = "vertical"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.mensural.vis@mensur.form", data);
-            value = "";
-            break;
+    static constexpr const char *values[mensuralVis_MENSURFORM_MAX] = { "", "horizontal", "vertical" };
+    if ((data <= mensuralVis_MENSURFORM_NONE) || (data >= mensuralVis_MENSURFORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.mensural.vis@mensur.form", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string value, bool logWarning) const
+mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(const std::string &value, bool logWarning) const
 {
-    if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
-    if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value.c_str());
+    return StrToMensuralVisMensurform(value.c_str(), logWarning);
+}
+
+mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, mensuralVis_MENSURFORM> table[2] = {
+        { "horizontal", mensuralVis_MENSURFORM_horizontal }, { "vertical", mensuralVis_MENSURFORM_vertical }
+    };
+    const auto &entry = table[HashToken(value, 3) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value);
     return mensuralVis_MENSURFORM_NONE;
 }
 
 std::string AttConverter::MeterConformanceMetconToStr(meterConformance_METCON data) const
 {
-    std::string value;
-    switch (data) {
-        case meterConformance_METCON_c: value = "c"; break;
-        case meterConformance_METCON_i: value = "i"; break;
-        case meterConformance_METCON_o: value = "o"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.meterConformance@metcon", data);
-            value = "";
-            break;
+    static constexpr const char *values[meterConformance_METCON_MAX] = { "", "c", "i", "o" };
+    if ((data <= meterConformance_METCON_NONE) || (data >= meterConformance_METCON_MAX)) {
+        LogWarning("Unknown value '%d' for att.meterConformance@metcon", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+meterConformance_METCON AttConverter::StrToMeterConformanceMetcon(const std::string &value, bool logWarning) const
+{
+    return StrToMeterConformanceMetcon(value.c_str(), logWarning);
 }
 
-meterConformance_METCON AttConverter::StrToMeterConformanceMetcon(std::string value, bool logWarning) const
+meterConformance_METCON AttConverter::StrToMeterConformanceMetcon(const char *value, bool logWarning) const
 {
-    if (value == "c") return meterConformance_METCON_c;
-    if (value == "i") return meterConformance_METCON_i;
-    if (value == "o") return meterConformance_METCON_o;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.meterConformance@metcon", value.c_str());
+    static constexpr std::pair<const char *, meterConformance_METCON> table[4] = {
+        { "i", meterConformance_METCON_i }, { "c", meterConformance_METCON_c }, { "o", meterConformance_METCON_o },
+        { "", meterConformance_METCON_NONE }
+    };
+    const auto &entry = table[HashToken(value, 32) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.meterConformance@metcon", value);
     return meterConformance_METCON_NONE;
 }
 
 std::string AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case meterSigGrpLog_FUNC_alternating: value = "alternating"; break;
-        case meterSigGrpLog_FUNC_interchanging: value = "interchanging"; break;
-        case meterSigGrpLog_FUNC_mixed: value = "mixed"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.meterSigGrp.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[meterSigGrpLog_FUNC_MAX] = { "", "alternating", "interchanging", "mixed" };
+    if ((data <= meterSigGrpLog_FUNC_NONE) || (data >= meterSigGrpLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.meterSigGrp.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(const std::string &value, bool logWarning) const
+{
+    return StrToMeterSigGrpLogFunc(value.c_str(), logWarning);
 }
 
-meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string value, bool logWarning) const
+meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(const char *value, bool logWarning) const
 {
-    if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
-    if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
-    if (value == "mixed") return meterSigGrpLog_FUNC_mixed;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value.c_str());
+    static constexpr std::pair<const char *, meterSigGrpLog_FUNC> table[4] = {
+        { "mixed", meterSigGrpLog_FUNC_mixed }, { "", meterSigGrpLog_FUNC_NONE },
+        { "alternating", meterSigGrpLog_FUNC_alternating }, { "interchanging", meterSigGrpLog_FUNC_interchanging }
+    };
+    const auto &entry = table[HashToken(value, 2) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value);
     return meterSigGrpLog_FUNC_NONE;
 }
 
 std::string AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case mordentLog_FORM_lower: value = "lower"; break;
-        case mordentLog_FORM_upper: value = "upper"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.mordent.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[mordentLog_FORM_MAX] = { "", "lower", "upper" };
+    if ((data <= mordentLog_FORM_NONE) || (data >= mordentLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.mordent.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+mordentLog_FORM AttConverter::StrToMordentLogForm(const std::string &value, bool logWarning) const
+{
+    return StrToMordentLogForm(value.c_str(), logWarning);
 }
 
-mordentLog_FORM AttConverter::StrToMordentLogForm(std::string value, bool logWarning) const
+mordentLog_FORM AttConverter::StrToMordentLogForm(const char *value, bool logWarning) const
 {
-    if (value == "lower") return mordentLog_FORM_lower;
-    if (value == "upper") return mordentLog_FORM_upper;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.mordent.log@form", value.c_str());
+    static constexpr std::pair<const char *, mordentLog_FORM> table[2] = {
+        { "lower", mordentLog_FORM_lower }, { "upper", mordentLog_FORM_upper }
+    };
+    const auto &entry = table[HashToken(value, 1) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.mordent.log@form", value);
     return mordentLog_FORM_NONE;
 }
 
 std::string AttConverter::NcFormConToStr(ncForm_CON data) const
 {
-    std::string value;
-    switch (data) {
-        case ncForm_CON_g: value = "g"; break;
-        case ncForm_CON_l: value = "l"; break;
-        case ncForm_CON_e: value = "e"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.ncForm@con", data);
-            value = "";
-            break;
+    static constexpr const char *values[ncForm_CON_MAX] = { "", "g", "l", "e" };
+    if ((data <= ncForm_CON_NONE) || (data >= ncForm_CON_MAX)) {
+        LogWarning("Unknown value '%d' for att.ncForm@con", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-ncForm_CON AttConverter::StrToNcFormCon(std::string value, bool logWarning) const
+ncForm_CON AttConverter::StrToNcFormCon(const std::string &value, bool logWarning) const
 {
-    if (value == "g") return ncForm_CON_g;
-    if (value == "l") return ncForm_CON_l;
-    if (value == "e") return ncForm_CON_e;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.ncForm@con", value.c_str());
+    return StrToNcFormCon(value.c_str(), logWarning);
+}
+
+ncForm_CON AttConverter::StrToNcFormCon(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, ncForm_CON> table[4] = {
+        { "e", ncForm_CON_e }, { "", ncForm_CON_NONE }, { "g", ncForm_CON_g }, { "l", ncForm_CON_l }
+    };
+    const auto &entry = table[HashToken(value, 0) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.ncForm@con", value);
     return ncForm_CON_NONE;
 }
 
 std::string AttConverter::NcFormCurveToStr(ncForm_CURVE data) const
 {
-    std::string value;
-    switch (data) {
-        case ncForm_CURVE_a: value = "a"; break;
-        case ncForm_CURVE_c: value = "c"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.ncForm@curve", data);
-            value = "";
-            break;
+    static constexpr const char *values[ncForm_CURVE_MAX] = { "", "a", "c" };
+    if ((data <= ncForm_CURVE_NONE) || (data >= ncForm_CURVE_MAX)) {
+        LogWarning("Unknown value '%d' for att.ncForm@curve", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-ncForm_CURVE AttConverter::StrToNcFormCurve(std::string value, bool logWarning) const
+ncForm_CURVE AttConverter::StrToNcFormCurve(const std::string &value, bool logWarning) const
 {
-    if (value == "a") return ncForm_CURVE_a;
-    if (value == "c") return ncForm_CURVE_c;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.ncForm@curve", value.c_str());
+    return StrToNcFormCurve(value.c_str(), logWarning);
+}
+
+ncForm_CURVE AttConverter::StrToNcFormCurve(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, ncForm_CURVE> table[2] = {
+        { "c", ncForm_CURVE_c }, { "a", ncForm_CURVE_a }
+    };
+    const auto &entry = table[HashToken(value, 44) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.ncForm@curve", value);
     return ncForm_CURVE_NONE;
 }
 
 std::string AttConverter::NcFormRellenToStr(ncForm_RELLEN data) const
 {
-    std::string value;
-    switch (data) {
-        case ncForm_RELLEN_l: value = "l"; break;
-        case ncForm_RELLEN_s: value = "s"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.ncForm@rellen", data);
-            value = "";
-            break;
+    static constexpr const char *values[ncForm_RELLEN_MAX] = { "", "l", "s" };
+    if ((data <= ncForm_RELLEN_NONE) || (data >= ncForm_RELLEN_MAX)) {
+        LogWarning("Unknown value '%d' for att.ncForm@rellen", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-ncForm_RELLEN AttConverter::StrToNcFormRellen(std::string value, bool logWarning) const
+ncForm_RELLEN AttConverter::StrToNcFormRellen(const std::string &value, bool logWarning) const
 {
-    if (value == "l") return ncForm_RELLEN_l;
-    if (value == "s") return ncForm_RELLEN_s;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.ncForm@rellen", value.c_str());
+    return StrToNcFormRellen(value.c_str(), logWarning);
+}
+
+ncForm_RELLEN AttConverter::StrToNcFormRellen(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, ncForm_RELLEN> table[2] = {
+        { "s", ncForm_RELLEN_s }, { "l", ncForm_RELLEN_l }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.ncForm@rellen", value);
     return ncForm_RELLEN_NONE;
 }
 
 std::string AttConverter::NoteAnlMensuralLigToStr(noteAnlMensural_LIG data) const
 {
-    std::string value;
-    switch (data) {
-        case noteAnlMensural_LIG_recta: value = "recta"; break;
-        case noteAnlMensural_LIG_obliqua: value = "obliqua"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.note.anl.mensural@lig", data);
-            value = "";
-            break;
+    static constexpr const char *values[noteAnlMensural_LIG_MAX] = { "", "recta", "obliqua" };
+    if ((data <= noteAnlMensural_LIG_NONE) || (data >= noteAnlMensural_LIG_MAX)) {
+        LogWarning("Unknown value '%d' for att.note.anl.mensural@lig", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+noteAnlMensural_LIG AttConverter::StrToNoteAnlMensuralLig(const std::string &value, bool logWarning) const
+{
+    return StrToNoteAnlMensuralLig(value.c_str(), logWarning);
 }
 
-noteAnlMensural_LIG AttConverter::StrToNoteAnlMensuralLig(std::string value, bool logWarning) const
+noteAnlMensural_LIG AttConverter::StrToNoteAnlMensuralLig(const char *value, bool logWarning) const
 {
-    if (value == "recta") return noteAnlMensural_LIG_recta;
-    if (value == "obliqua") return noteAnlMensural_LIG_obliqua;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.note.anl.mensural@lig", value.c_str());
+    static constexpr std::pair<const char *, noteAnlMensural_LIG> table[2] = {
+        { "obliqua", noteAnlMensural_LIG_obliqua }, { "recta", noteAnlMensural_LIG_recta }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.note.anl.mensural@lig", value);
     return noteAnlMensural_LIG_NONE;
 }
 
 std::string AttConverter::NoteGesExtremisToStr(noteGes_EXTREMIS data) const
 {
-    std::string value;
-    switch (data) {
-        case noteGes_EXTREMIS_highest: value = "highest"; break;
-        case noteGes_EXTREMIS_lowest: value = "lowest"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.note.ges@extremis", data);
-            value = "";
-            break;
+    static constexpr const char *values[noteGes_EXTREMIS_MAX] = { "", "highest", "lowest" };
+    if ((data <= noteGes_EXTREMIS_NONE) || (data >= noteGes_EXTREMIS_MAX)) {
+        LogWarning("Unknown value '%d' for att.note.ges@extremis", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+noteGes_EXTREMIS AttConverter::StrToNoteGesExtremis(const std::string &value, bool logWarning) const
+{
+    return StrToNoteGesExtremis(value.c_str(), logWarning);
 }
 
-noteGes_EXTREMIS AttConverter::StrToNoteGesExtremis(std::string value, bool logWarning) const
+noteGes_EXTREMIS AttConverter::StrToNoteGesExtremis(const char *value, bool logWarning) const
 {
-    if (value == "highest") return noteGes_EXTREMIS_highest;
-    if (value == "lowest") return noteGes_EXTREMIS_lowest;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.note.ges@extremis", value.c_str());
+    static constexpr std::pair<const char *, noteGes_EXTREMIS> table[2] = {
+        { "highest", noteGes_EXTREMIS_highest }, { "lowest", noteGes_EXTREMIS_lowest }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.note.ges@extremis", value);
     return noteGes_EXTREMIS_NONE;
 }
 
 std::string AttConverter::NoteHeadsHeadauthToStr(noteHeads_HEADAUTH data) const
 {
-    std::string value;
-    switch (data) {
-        case noteHeads_HEADAUTH_smufl: value = "smufl"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.noteHeads@head.auth", data);
-            value = "";
-            break;
+    static constexpr const char *values[noteHeads_HEADAUTH_MAX] = { "", "smufl" };
+    if ((data <= noteHeads_HEADAUTH_NONE) || (data >= noteHeads_HEADAUTH_MAX)) {
+        LogWarning("Unknown value '%d' for att.noteHeads@head.auth", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-noteHeads_HEADAUTH AttConverter::StrToNoteHeadsHeadauth(std::string value, bool logWarning) const
+noteHeads_HEADAUTH AttConverter::StrToNoteHeadsHeadauth(const std::string &value, bool logWarning) const
 {
-    if (value == "smufl") return noteHeads_HEADAUTH_smufl;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.noteHeads@head.auth", value.c_str());
+    return StrToNoteHeadsHeadauth(value.c_str(), logWarning);
+}
+
+noteHeads_HEADAUTH AttConverter::StrToNoteHeadsHeadauth(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, noteHeads_HEADAUTH> table[1] = {
+        { "smufl", noteHeads_HEADAUTH_smufl }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.noteHeads@head.auth", value);
     return noteHeads_HEADAUTH_NONE;
 }
 
 std::string AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
 {
-    std::string value;
-    switch (data) {
-        case octaveLog_COLL_coll: value = "coll"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.octave.log@coll", data);
-            value = "";
-            break;
+    static constexpr const char *values[octaveLog_COLL_MAX] = { "", "coll" };
+    if ((data <= octaveLog_COLL_NONE) || (data >= octaveLog_COLL_MAX)) {
+        LogWarning("Unknown value '%d' for att.octave.log@coll", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string value, bool logWarning) const
+octaveLog_COLL AttConverter::StrToOctaveLogColl(const std::string &value, bool logWarning) const
 {
-    if (value == "coll") return octaveLog_COLL_coll;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.octave.log@coll", value.c_str());
+    return StrToOctaveLogColl(value.c_str(), logWarning);
+}
+
+octaveLog_COLL AttConverter::StrToOctaveLogColl(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, octaveLog_COLL> table[1] = {
+        { "coll", octaveLog_COLL_coll }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.octave.log@coll", value);
     return octaveLog_COLL_NONE;
 }
 
 std::string AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
 {
-    std::string value;
-    switch (data) {
-        case pbVis_FOLIUM_verso: value = "verso"; break;
-        case pbVis_FOLIUM_recto: value = "recto"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pb.vis@folium", data);
-            value = "";
-            break;
+    static constexpr const char *values[pbVis_FOLIUM_MAX] = { "", "verso", "recto" };
+    if ((data <= pbVis_FOLIUM_NONE) || (data >= pbVis_FOLIUM_MAX)) {
+        LogWarning("Unknown value '%d' for att.pb.vis@folium", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string value, bool logWarning) const
+pbVis_FOLIUM AttConverter::StrToPbVisFolium(const std::string &value, bool logWarning) const
 {
-    if (value == "verso") return pbVis_FOLIUM_verso;
-    if (value == "recto") return pbVis_FOLIUM_recto;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pb.vis@folium", value.c_str());
+    return StrToPbVisFolium(value.c_str(), logWarning);
+}
+
+pbVis_FOLIUM AttConverter::StrToPbVisFolium(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, pbVis_FOLIUM> table[2] = {
+        { "recto", pbVis_FOLIUM_recto }, { "verso", pbVis_FOLIUM_verso }
+    };
+    const auto &entry = table[HashToken(value, 2) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pb.vis@folium", value);
     return pbVis_FOLIUM_NONE;
 }
 
 std::string AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
 {
-    std::string value;
-    switch (data) {
-        case pedalLog_DIR_down: value = "down"; break;
-        case pedalLog_DIR_up: value = "up"; break;
-        case pedalLog_DIR_half: value = "half"; break;
-        case pedalLog_DIR_bounce: value = "bounce"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pedal.log@dir", data);
-            value = "";
-            break;
+    static constexpr const char *values[pedalLog_DIR_MAX] = { "", "down", "up", "half", "bounce" };
+    if ((data <= pedalLog_DIR_NONE) || (data >= pedalLog_DIR_MAX)) {
+        LogWarning("Unknown value '%d' for att.pedal.log@dir", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-pedalLog_DIR AttConverter::StrToPedalLogDir(std::string value, bool logWarning) const
+pedalLog_DIR AttConverter::StrToPedalLogDir(const std::string &value, bool logWarning) const
 {
-    if (value == "down") return pedalLog_DIR_down;
-    if (value == "up") return pedalLog_DIR_up;
-    if (value == "half") return pedalLog_DIR_half;
-    if (value == "bounce") return pedalLog_DIR_bounce;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pedal.log@dir", value.c_str());
+    return StrToPedalLogDir(value.c_str(), logWarning);
+}
+
+pedalLog_DIR AttConverter::StrToPedalLogDir(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, pedalLog_DIR> table[4] = {
+        { "down", pedalLog_DIR_down }, { "up", pedalLog_DIR_up }, { "bounce", pedalLog_DIR_bounce },
+        { "half", pedalLog_DIR_half }
+    };
+    static constexpr uint16_t seeds[2] = { 2, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pedal.log@dir", value);
     return pedalLog_DIR_NONE;
 }
 
 std::string AttConverter::PedalLogFuncToStr(pedalLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case pedalLog_FUNC_sustain: value = "sustain"; break;
-        case pedalLog_FUNC_soft: value = "soft"; break;
-        case pedalLog_FUNC_sostenuto: value = "sostenuto"; break;
-        case pedalLog_FUNC_silent: value = "silent"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pedal.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[pedalLog_FUNC_MAX] = { "", "sustain", "soft", "sostenuto", "silent" };
+    if ((data <= pedalLog_FUNC_NONE) || (data >= pedalLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.pedal.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+pedalLog_FUNC AttConverter::StrToPedalLogFunc(const std::string &value, bool logWarning) const
+{
+    return StrToPedalLogFunc(value.c_str(), logWarning);
 }
 
-pedalLog_FUNC AttConverter::StrToPedalLogFunc(std::string value, bool logWarning) const
+pedalLog_FUNC AttConverter::StrToPedalLogFunc(const char *value, bool logWarning) const
 {
-    if (value == "sustain") return pedalLog_FUNC_sustain;
-    if (value == "soft") return pedalLog_FUNC_soft;
-    if (value == "sostenuto") return pedalLog_FUNC_sostenuto;
-    if (value == "silent") return pedalLog_FUNC_silent;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pedal.log@func", value.c_str());
+    static constexpr std::pair<const char *, pedalLog_FUNC> table[4] = {
+        { "soft", pedalLog_FUNC_soft }, { "sostenuto", pedalLog_FUNC_sostenuto }, { "silent", pedalLog_FUNC_silent },
+        { "sustain", pedalLog_FUNC_sustain }
+    };
+    static constexpr uint16_t seeds[2] = { 0, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pedal.log@func", value);
     return pedalLog_FUNC_NONE;
 }
 
 std::string AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case pedalVis_FORM_line: value = "line"; break;
-        case pedalVis_FORM_pedstar: value = "pedstar"; break;
-        case pedalVis_FORM_altpedstar: value = "altpedstar"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pedal.vis@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[pedalVis_FORM_MAX] = { "", "line", "pedstar", "altpedstar" };
+    if ((data <= pedalVis_FORM_NONE) || (data >= pedalVis_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.pedal.vis@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+pedalVis_FORM AttConverter::StrToPedalVisForm(const std::string &value, bool logWarning) const
+{
+    return StrToPedalVisForm(value.c_str(), logWarning);
 }
 
-pedalVis_FORM AttConverter::StrToPedalVisForm(std::string value, bool logWarning) const
+pedalVis_FORM AttConverter::StrToPedalVisForm(const char *value, bool logWarning) const
 {
-    if (value == "line") return pedalVis_FORM_line;
-    if (value == "pedstar") return pedalVis_FORM_pedstar;
-    if (value == "altpedstar") return pedalVis_FORM_altpedstar;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pedal.vis@form", value.c_str());
+    static constexpr std::pair<const char *, pedalVis_FORM> table[4] = {
+        { "pedstar", pedalVis_FORM_pedstar }, { "altpedstar", pedalVis_FORM_altpedstar }, { "", pedalVis_FORM_NONE },
+        { "line", pedalVis_FORM_line }
+    };
+    const auto &entry = table[HashToken(value, 1) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pedal.vis@form", value);
     return pedalVis_FORM_NONE;
 }
 
 std::string AttConverter::PianoPedalsPedalstyleToStr(pianoPedals_PEDALSTYLE data) const
 {
-    std::string value;
-    switch (data) {
-        case pianoPedals_PEDALSTYLE_line: value = "line"; break;
-        case pianoPedals_PEDALSTYLE_pedstar: value = "pedstar"; break;
-        case pianoPedals_PEDALSTYLE_altpedstar: value = "altpedstar"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pianoPedals@pedal.style", data);
-            value = "";
-            break;
+    static constexpr const char *values[pianoPedals_PEDALSTYLE_MAX] = { "", "line", "pedstar", "altpedstar" };
+    if ((data <= pianoPedals_PEDALSTYLE_NONE) || (data >= pianoPedals_PEDALSTYLE_MAX)) {
+        LogWarning("Unknown value '%d' for att.pianoPedals@pedal.style", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+pianoPedals_PEDALSTYLE AttConverter::StrToPianoPedalsPedalstyle(const std::string &value, bool logWarning) const
+{
+    return StrToPianoPedalsPedalstyle(value.c_str(), logWarning);
 }
 
-pianoPedals_PEDALSTYLE AttConverter::StrToPianoPedalsPedalstyle(std::string value, bool logWarning) const
+pianoPedals_PEDALSTYLE AttConverter::StrToPianoPedalsPedalstyle(const char *value, bool logWarning) const
 {
-    if (value == "line") return pianoPedals_PEDALSTYLE_line;
-    if (value == "pedstar") return pianoPedals_PEDALSTYLE_pedstar;
-    if (value == "altpedstar") return pianoPedals_PEDALSTYLE_altpedstar;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pianoPedals@pedal.style", value.c_str());
+    static constexpr std::pair<const char *, pianoPedals_PEDALSTYLE> table[4] = {
+        { "pedstar", pianoPedals_PEDALSTYLE_pedstar }, { "altpedstar", pianoPedals_PEDALSTYLE_altpedstar },
+        { "", pianoPedals_PEDALSTYLE_NONE }, { "line", pianoPedals_PEDALSTYLE_line }
+    };
+    const auto &entry = table[HashToken(value, 1) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pianoPedals@pedal.style", value);
     return pianoPedals_PEDALSTYLE_NONE;
 }
 
 std::string AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data) const
 {
-    std::string value;
-    switch (data) {
-        case pointing_XLINKACTUATE_onLoad: value = "onLoad"; break;
-        case pointing_XLINKACTUATE_onRequest: value = "onRequest"; break;
-        case pointing_XLINKACTUATE_none: value = "none"; break;
-        case pointing_XLINKACTUATE_other: value = "other"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pointing@xlink:actuate", data);
-            value = "";
-            break;
+    static constexpr const char *values[pointing_XLINKACTUATE_MAX] = { "", "onLoad", "onRequest", "none", "other" };
+    if ((data <= pointing_XLINKACTUATE_NONE) || (data >= pointing_XLINKACTUATE_MAX)) {
+        LogWarning("Unknown value '%d' for att.pointing@xlink:actuate", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string value, bool logWarning) const
+pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(const std::string &value, bool logWarning) const
 {
-    if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
-    if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
-    if (value == "none") return pointing_XLINKACTUATE_none;
-    if (value == "other") return pointing_XLINKACTUATE_other;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value.c_str());
+    return StrToPointingXlinkactuate(value.c_str(), logWarning);
+}
+
+pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, pointing_XLINKACTUATE> table[4] = {
+        { "other", pointing_XLINKACTUATE_other }, { "onRequest", pointing_XLINKACTUATE_onRequest },
+        { "onLoad", pointing_XLINKACTUATE_onLoad }, { "none", pointing_XLINKACTUATE_none }
+    };
+    static constexpr uint16_t seeds[2] = { 1, 3 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value);
     return pointing_XLINKACTUATE_NONE;
 }
 
 std::string AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
 {
-    std::string value;
-    switch (data) {
-        case pointing_XLINKSHOW_new: value = "new"; break;
-        case pointing_XLINKSHOW_replace: value = "replace"; break;
-        case pointing_XLINKSHOW_embed: value = "embed"; break;
-        case pointing_XLINKSHOW_none: value = "none"; break;
-        case pointing_XLINKSHOW_other: value = "other"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.pointing@xlink:show", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string value, bool logWarning) const
-{
-    if (value == "new") return pointing_XLINKSHOW_new;
-    if (value == "replace") return pointing_XLINKSHOW_replace;
-    if (value == "embed") return pointing_XLINKSHOW_embed;
-    if (value == "none") return pointing_XLINKSHOW_none;
-    if (value == "other") return pointing_XLINKSHOW_other;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value.c_str());
+    static constexpr const char *values[pointing_XLINKSHOW_MAX] = { "", "new", "replace", "embed", "none", "other" };
+    if ((data <= pointing_XLINKSHOW_NONE) || (data >= pointing_XLINKSHOW_MAX)) {
+        LogWarning("Unknown value '%d' for att.pointing@xlink:show", data);
+        return "";
+    }
+    return values[data];
+}
+
+pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(const std::string &value, bool logWarning) const
+{
+    return StrToPointingXlinkshow(value.c_str(), logWarning);
+}
+
+pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, pointing_XLINKSHOW> table[8] = {
+        { "new", pointing_XLINKSHOW_new }, { "", pointing_XLINKSHOW_NONE }, { "", pointing_XLINKSHOW_NONE },
+        { "replace", pointing_XLINKSHOW_replace }, { "other", pointing_XLINKSHOW_other },
+        { "embed", pointing_XLINKSHOW_embed }, { "", pointing_XLINKSHOW_NONE }, { "none", pointing_XLINKSHOW_none }
+    };
+    static constexpr uint16_t seeds[2] = { 1, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value);
     return pointing_XLINKSHOW_NONE;
 }
 
 std::string AttConverter::RecordTypeRecordtypeToStr(recordType_RECORDTYPE data) const
 {
-    std::string value;
-    switch (data) {
-        case recordType_RECORDTYPE_a: value = "a"; break;
-        case recordType_RECORDTYPE_c: value = "c"; break;
-        case recordType_RECORDTYPE_d: value = "d"; break;
-        case recordType_RECORDTYPE_e: value = "e"; break;
-        case recordType_RECORDTYPE_f: value = "f"; break;
-        case recordType_RECORDTYPE_g: value = "g"; break;
-        case recordType_RECORDTYPE_i: value = "i"; break;
-        case recordType_RECORDTYPE_j: value = "j"; break;
-        case recordType_RECORDTYPE_k: value = "k"; break;
-        case recordType_RECORDTYPE_m: value = "m"; break;
-        case recordType_RECORDTYPE_o: value = "o"; break;
-        case recordType_RECORDTYPE_p: value = "p"; break;
-        case recordType_RECORDTYPE_r: value = "r"; break;
-        case recordType_RECORDTYPE_t: value = "t"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.recordType@recordtype", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-recordType_RECORDTYPE AttConverter::StrToRecordTypeRecordtype(std::string value, bool logWarning) const
-{
-    if (value == "a") return recordType_RECORDTYPE_a;
-    if (value == "c") return recordType_RECORDTYPE_c;
-    if (value == "d") return recordType_RECORDTYPE_d;
-    if (value == "e") return recordType_RECORDTYPE_e;
-    if (value == "f") return recordType_RECORDTYPE_f;
-    if (value == "g") return recordType_RECORDTYPE_g;
-    if (value == "i") return recordType_RECORDTYPE_i;
-    if (value == "j") return recordType_RECORDTYPE_j;
-    if (value == "k") return recordType_RECORDTYPE_k;
-    if (value == "m") return recordType_RECORDTYPE_m;
-    if (value == "o") return recordType_RECORDTYPE_o;
-    if (value == "p") return recordType_RECORDTYPE_p;
-    if (value == "r") return recordType_RECORDTYPE_r;
-    if (value == "t") return recordType_RECORDTYPE_t;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.recordType@recordtype", value.c_str());
+    static constexpr const char *values[recordType_RECORDTYPE_MAX] = {
+        "", "a", "c", "d", "e", "f", "g", "i", "j", "k", "m", "o", "p", "r", "t"
+    };
+    if ((data <= recordType_RECORDTYPE_NONE) || (data >= recordType_RECORDTYPE_MAX)) {
+        LogWarning("Unknown value '%d' for att.recordType@recordtype", data);
+        return "";
+    }
+    return values[data];
+}
+
+recordType_RECORDTYPE AttConverter::StrToRecordTypeRecordtype(const std::string &value, bool logWarning) const
+{
+    return StrToRecordTypeRecordtype(value.c_str(), logWarning);
+}
+
+recordType_RECORDTYPE AttConverter::StrToRecordTypeRecordtype(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, recordType_RECORDTYPE> table[32] = {
+        { "a", recordType_RECORDTYPE_a }, { "", recordType_RECORDTYPE_NONE }, { "", recordType_RECORDTYPE_NONE },
+        { "p", recordType_RECORDTYPE_p }, { "", recordType_RECORDTYPE_NONE }, { "", recordType_RECORDTYPE_NONE },
+        { "k", recordType_RECORDTYPE_k }, { "", recordType_RECORDTYPE_NONE }, { "i", recordType_RECORDTYPE_i },
+        { "", recordType_RECORDTYPE_NONE }, { "g", recordType_RECORDTYPE_g }, { "", recordType_RECORDTYPE_NONE },
+        { "e", recordType_RECORDTYPE_e }, { "", recordType_RECORDTYPE_NONE }, { "", recordType_RECORDTYPE_NONE },
+        { "t", recordType_RECORDTYPE_t }, { "", recordType_RECORDTYPE_NONE }, { "j", recordType_RECORDTYPE_j },
+        { "o", recordType_RECORDTYPE_o }, { "", recordType_RECORDTYPE_NONE }, { "m", recordType_RECORDTYPE_m },
+        { "f", recordType_RECORDTYPE_f }, { "", recordType_RECORDTYPE_NONE }, { "", recordType_RECORDTYPE_NONE },
+        { "", recordType_RECORDTYPE_NONE }, { "r", recordType_RECORDTYPE_r }, { "", recordType_RECORDTYPE_NONE },
+        { "", recordType_RECORDTYPE_NONE }, { "", recordType_RECORDTYPE_NONE }, { "", recordType_RECORDTYPE_NONE },
+        { "c", recordType_RECORDTYPE_c }, { "d", recordType_RECORDTYPE_d }
+    };
+    static constexpr uint16_t seeds[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 7];
+    const auto &entry = table[HashToken(value, seed) & 31];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.recordType@recordtype", value);
     return recordType_RECORDTYPE_NONE;
 }
 
 std::string AttConverter::RegularMethodMethodToStr(regularMethod_METHOD data) const
 {
-    std::string value;
-    switch (data) {
-        case regularMethod_METHOD_silent: value = "silent"; break;
-        case regularMethod_METHOD_tags: value = "tags"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.regularMethod@method", data);
-            value = "";
-            break;
+    static constexpr const char *values[regularMethod_METHOD_MAX] = { "", "silent", "tags" };
+    if ((data <= regularMethod_METHOD_NONE) || (data >= regularMethod_METHOD_MAX)) {
+        LogWarning("Unknown value '%d' for att.regularMethod@method", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-regularMethod_METHOD AttConverter::StrToRegularMethodMethod(std::string value, bool logWarning) const
+regularMethod_METHOD AttConverter::StrToRegularMethodMethod(const std::string &value, bool logWarning) const
 {
-    if (value == "silent") return regularMethod_METHOD_silent;
-    if (value == "tags") return regularMethod_METHOD_tags;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.regularMethod@method", value.c_str());
+    return StrToRegularMethodMethod(value.c_str(), logWarning);
+}
+
+regularMethod_METHOD AttConverter::StrToRegularMethodMethod(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, regularMethod_METHOD> table[2] = {
+        { "silent", regularMethod_METHOD_silent }, { "tags", regularMethod_METHOD_tags }
+    };
+    const auto &entry = table[HashToken(value, 3) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.regularMethod@method", value);
     return regularMethod_METHOD_NONE;
 }
 
 std::string AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) const
 {
-    std::string value;
-    switch (data) {
-        case rehearsal_REHENCLOSE_box: value = "box"; break;
-        case rehearsal_REHENCLOSE_circle: value = "circle"; break;
-        case rehearsal_REHENCLOSE_none: value = "none"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.rehearsal@reh.enclose", data);
-            value = "";
-            break;
+    static constexpr const char *values[rehearsal_REHENCLOSE_MAX] = { "", "box", "circle", "none" };
+    if ((data <= rehearsal_REHENCLOSE_NONE) || (data >= rehearsal_REHENCLOSE_MAX)) {
+        LogWarning("Unknown value '%d' for att.rehearsal@reh.enclose", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string value, bool logWarning) const
+rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(const std::string &value, bool logWarning) const
 {
-    if (value == "box") return rehearsal_REHENCLOSE_box;
-    if (value == "circle") return rehearsal_REHENCLOSE_circle;
-    if (value == "none") return rehearsal_REHENCLOSE_none;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value.c_str());
+    return StrToRehearsalRehenclose(value.c_str(), logWarning);
+}
+
+rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, rehearsal_REHENCLOSE> table[4] = {
+        { "circle", rehearsal_REHENCLOSE_circle }, { "", rehearsal_REHENCLOSE_NONE },
+        { "none", rehearsal_REHENCLOSE_none }, { "box", rehearsal_REHENCLOSE_box }
+    };
+    const auto &entry = table[HashToken(value, 7) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value);
     return rehearsal_REHENCLOSE_NONE;
 }
 
 std::string AttConverter::SbVisFormToStr(sbVis_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case sbVis_FORM_hash: value = "hash"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.sb.vis@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[sbVis_FORM_MAX] = { "", "hash" };
+    if ((data <= sbVis_FORM_NONE) || (data >= sbVis_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.sb.vis@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+sbVis_FORM AttConverter::StrToSbVisForm(const std::string &value, bool logWarning) const
+{
+    return StrToSbVisForm(value.c_str(), logWarning);
 }
 
-sbVis_FORM AttConverter::StrToSbVisForm(std::string value, bool logWarning) const
+sbVis_FORM AttConverter::StrToSbVisForm(const char *value, bool logWarning) const
 {
-    if (value == "hash") return sbVis_FORM_hash;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.sb.vis@form", value.c_str());
+    static constexpr std::pair<const char *, sbVis_FORM> table[1] = {
+        { "hash", sbVis_FORM_hash }
+    };
+    const auto &entry = table[HashToken(value, 0) & 0];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.sb.vis@form", value);
     return sbVis_FORM_NONE;
 }
 
 std::string AttConverter::StaffGroupingSymSymbolToStr(staffGroupingSym_SYMBOL data) const
 {
-    std::string value;
-    switch (data) {
-        case staffGroupingSym_SYMBOL_brace: value = "brace"; break;
-        case staffGroupingSym_SYMBOL_bracket: value = "bracket"; break;
-        case staffGroupingSym_SYMBOL_bracketsq: value = "bracketsq"; break;
-        case staffGroupingSym_SYMBOL_line: value = "line"; break;
-        case staffGroupingSym_SYMBOL_none: value = "none"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.staffGroupingSym@symbol", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-staffGroupingSym_SYMBOL AttConverter::StrToStaffGroupingSymSymbol(std::string value, bool logWarning) const
-{
-    if (value == "brace") return staffGroupingSym_SYMBOL_brace;
-    if (value == "bracket") return staffGroupingSym_SYMBOL_bracket;
-    if (value == "bracketsq") return staffGroupingSym_SYMBOL_bracketsq;
-    if (value == "line") return staffGroupingSym_SYMBOL_line;
-    if (value == "none") return staffGroupingSym_SYMBOL_none;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.staffGroupingSym@symbol", value.c_str());
+    static constexpr const char *values[staffGroupingSym_SYMBOL_MAX] = {
+        "", "brace", "bracket", "bracketsq", "line", "none"
+    };
+    if ((data <= staffGroupingSym_SYMBOL_NONE) || (data >= staffGroupingSym_SYMBOL_MAX)) {
+        LogWarning("Unknown value '%d' for att.staffGroupingSym@symbol", data);
+        return "";
+    }
+    return values[data];
+}
+
+staffGroupingSym_SYMBOL AttConverter::StrToStaffGroupingSymSymbol(const std::string &value, bool logWarning) const
+{
+    return StrToStaffGroupingSymSymbol(value.c_str(), logWarning);
+}
+
+staffGroupingSym_SYMBOL AttConverter::StrToStaffGroupingSymSymbol(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, staffGroupingSym_SYMBOL> table[8] = {
+        { "bracket", staffGroupingSym_SYMBOL_bracket }, { "bracketsq", staffGroupingSym_SYMBOL_bracketsq },
+        { "", staffGroupingSym_SYMBOL_NONE }, { "brace", staffGroupingSym_SYMBOL_brace },
+        { "", staffGroupingSym_SYMBOL_NONE }, { "line", staffGroupingSym_SYMBOL_line },
+        { "", staffGroupingSym_SYMBOL_NONE }, { "none", staffGroupingSym_SYMBOL_none }
+    };
+    static constexpr uint16_t seeds[2] = { 5, 6 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.staffGroupingSym@symbol", value);
     return staffGroupingSym_SYMBOL_NONE;
 }
 
 std::string AttConverter::SylLogConToStr(sylLog_CON data) const
 {
-    std::string value;
-    switch (data) {
-        case sylLog_CON_s: value = "s"; break;
-        case sylLog_CON_d: value = "d"; break;
-        case sylLog_CON_u: value = "u"; break;
-        case sylLog_CON_t: value = "t"; break;
-        case sylLog_CON_c: value = "c"; break;
-        case sylLog_CON_v: value = "v"; break;
-        case sylLog_CON_i: value = "i"; break;
-        case sylLog_CON_b: value = "b"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.syl.log@con", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-sylLog_CON AttConverter::StrToSylLogCon(std::string value, bool logWarning) const
-{
-    if (value == "s") return sylLog_CON_s;
-    if (value == "d") return sylLog_CON_d;
-    if (value == "u") return sylLog_CON_u;
-    if (value == "t") return sylLog_CON_t;
-    if (value == "c") return sylLog_CON_c;
-    if (value == "v") return sylLog_CON_v;
-    if (value == "i") return sylLog_CON_i;
-    if (value == "b") return sylLog_CON_b;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.syl.log@con", value.c_str());
+    static constexpr const char *values[sylLog_CON_MAX] = { "", "s", "d", "u", "t", "c", "v", "i", "b" };
+    if ((data <= sylLog_CON_NONE) || (data >= sylLog_CON_MAX)) {
+        LogWarning("Unknown value '%d' for att.syl.log@con", data);
+        return "";
+    }
+    return values[data];
+}
+
+sylLog_CON AttConverter::StrToSylLogCon(const std::string &value, bool logWarning) const
+{
+    return StrToSylLogCon(value.c_str(), logWarning);
+}
+
+sylLog_CON AttConverter::StrToSylLogCon(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, sylLog_CON> table[8] = {
+        { "i", sylLog_CON_i }, { "b", sylLog_CON_b }, { "d", sylLog_CON_d }, { "t", sylLog_CON_t },
+        { "u", sylLog_CON_u }, { "v", sylLog_CON_v }, { "s", sylLog_CON_s }, { "c", sylLog_CON_c }
+    };
+    static constexpr uint16_t seeds[4] = { 0, 0, 321, 321 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 3];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.syl.log@con", value);
     return sylLog_CON_NONE;
 }
 
 std::string AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
 {
-    std::string value;
-    switch (data) {
-        case sylLog_WORDPOS_i: value = "i"; break;
-        case sylLog_WORDPOS_m: value = "m"; break;
-        case sylLog_WORDPOS_s: value = "s"; break;
-        case sylLog_WORDPOS_t: value = "t"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.syl.log@wordpos", data);
-            value = "";
-            break;
+    static constexpr const char *values[sylLog_WORDPOS_MAX] = { "", "i", "m", "s", "t" };
+    if ((data <= sylLog_WORDPOS_NONE) || (data >= sylLog_WORDPOS_MAX)) {
+        LogWarning("Unknown value '%d' for att.syl.log@wordpos", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string value, bool logWarning) const
+sylLog_WORDPOS AttConverter::StrToSylLogWordpos(const std::string &value, bool logWarning) const
 {
-    if (value == "i") return sylLog_WORDPOS_i;
-    if (value == "m") return sylLog_WORDPOS_m;
-    if (value == "s") return sylLog_WORDPOS_s;
-    if (value == "t") return sylLog_WORDPOS_t;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value.c_str());
+    return StrToSylLogWordpos(value.c_str(), logWarning);
+}
+
+sylLog_WORDPOS AttConverter::StrToSylLogWordpos(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, sylLog_WORDPOS> table[4] = {
+        { "i", sylLog_WORDPOS_i }, { "t", sylLog_WORDPOS_t }, { "s", sylLog_WORDPOS_s }, { "m", sylLog_WORDPOS_m }
+    };
+    static constexpr uint16_t seeds[2] = { 32, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value);
     return sylLog_WORDPOS_NONE;
 }
 
 std::string AttConverter::TargetEvalEvaluateToStr(targetEval_EVALUATE data) const
 {
-    std::string value;
-    switch (data) {
-        case targetEval_EVALUATE_all: value = "all"; break;
-        case targetEval_EVALUATE_one: value = "one"; break;
-        case targetEval_EVALUATE_none: value = "none"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.targetEval@evaluate", data);
-            value = "";
-            break;
+    static constexpr const char *values[targetEval_EVALUATE_MAX] = { "", "all", "one", "none" };
+    if ((data <= targetEval_EVALUATE_NONE) || (data >= targetEval_EVALUATE_MAX)) {
+        LogWarning("Unknown value '%d' for att.targetEval@evaluate", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-targetEval_EVALUATE AttConverter::StrToTargetEvalEvaluate(std::string value, bool logWarning) const
+targetEval_EVALUATE AttConverter::StrToTargetEvalEvaluate(const std::string &value, bool logWarning) const
 {
-    if (value == "all") return targetEval_EVALUATE_all;
-    if (value == "one") return targetEval_EVALUATE_one;
-    if (value == "none") return targetEval_EVALUATE_none;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.targetEval@evaluate", value.c_str());
+    return StrToTargetEvalEvaluate(value.c_str(), logWarning);
+}
+
+targetEval_EVALUATE AttConverter::StrToTargetEvalEvaluate(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, targetEval_EVALUATE> table[4] = {
+        { "all", targetEval_EVALUATE_all }, { "", targetEval_EVALUATE_NONE }, { "one", targetEval_EVALUATE_one },
+        { "none", targetEval_EVALUATE_none }
+    };
+    const auto &entry = table[HashToken(value, 5) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.targetEval@evaluate", value);
     return targetEval_EVALUATE_NONE;
 }
 
 std::string AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
 {
-    std::string value;
-    switch (data) {
-        case tempoLog_FUNC_continuous: value = "continuous"; break;
-        case tempoLog_FUNC_instantaneous: value = "instantaneous"; break;
-        case tempoLog_FUNC_metricmod: value = "metricmod"; break;
-        case tempoLog_FUNC_precedente: value = "precedente"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.tempo.log@func", data);
-            value = "";
-            break;
+    static constexpr const char *values[tempoLog_FUNC_MAX] = {
+        "", "continuous", "instantaneous", "metricmod", "precedente"
+    };
+    if ((data <= tempoLog_FUNC_NONE) || (data >= tempoLog_FUNC_MAX)) {
+        LogWarning("Unknown value '%d' for att.tempo.log@func", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string value, bool logWarning) const
+tempoLog_FUNC AttConverter::StrToTempoLogFunc(const std::string &value, bool logWarning) const
 {
-    if (value == "continuous") return tempoLog_FUNC_continuous;
-    if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
-    if (value == "metricmod") return tempoLog_FUNC_metricmod;
-    if (value == "precedente") return tempoLog_FUNC_precedente;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.tempo.log@func", value.c_str());
+    return StrToTempoLogFunc(value.c_str(), logWarning);
+}
+
+tempoLog_FUNC AttConverter::StrToTempoLogFunc(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, tempoLog_FUNC> table[4] = {
+        { "instantaneous", tempoLog_FUNC_instantaneous }, { "precedente", tempoLog_FUNC_precedente },
+        { "continuous", tempoLog_FUNC_continuous }, { "metricmod", tempoLog_FUNC_metricmod }
+    };
+    static constexpr uint16_t seeds[2] = { 2, 2 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 3];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.tempo.log@func", value);
     return tempoLog_FUNC_NONE;
 }
 
 std::string AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) const
 {
-    std::string value;
-    switch (data) {
-        case tupletVis_NUMFORMAT_count: value = "count"; break;
-        case tupletVis_NUMFORMAT_ratio: value = "ratio"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.tuplet.vis@num.format", data);
-            value = "";
-            break;
+    static constexpr const char *values[tupletVis_NUMFORMAT_MAX] = { "", "count", "ratio" };
+    if ((data <= tupletVis_NUMFORMAT_NONE) || (data >= tupletVis_NUMFORMAT_MAX)) {
+        LogWarning("Unknown value '%d' for att.tuplet.vis@num.format", data);
+        return "";
     }
-    return value;
+    return values[data];
 }
 
-tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string value, bool logWarning) const
+tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(const std::string &value, bool logWarning) const
 {
-    if (value == "count") return tupletVis_NUMFORMAT_count;
-    if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value.c_str());
+    return StrToTupletVisNumformat(value.c_str(), logWarning);
+}
+
+tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, tupletVis_NUMFORMAT> table[2] = {
+        { "ratio", tupletVis_NUMFORMAT_ratio }, { "count", tupletVis_NUMFORMAT_count }
+    };
+    const auto &entry = table[HashToken(value, 0) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value);
     return tupletVis_NUMFORMAT_NONE;
 }
 
 std::string AttConverter::TurnLogFormToStr(turnLog_FORM data) const
 {
-    std::string value;
-    switch (data) {
-        case turnLog_FORM_lower: value = "lower"; break;
-        case turnLog_FORM_upper: value = "upper"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.turn.log@form", data);
-            value = "";
-            break;
+    static constexpr const char *values[turnLog_FORM_MAX] = { "", "lower", "upper" };
+    if ((data <= turnLog_FORM_NONE) || (data >= turnLog_FORM_MAX)) {
+        LogWarning("Unknown value '%d' for att.turn.log@form", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+turnLog_FORM AttConverter::StrToTurnLogForm(const std::string &value, bool logWarning) const
+{
+    return StrToTurnLogForm(value.c_str(), logWarning);
 }
 
-turnLog_FORM AttConverter::StrToTurnLogForm(std::string value, bool logWarning) const
+turnLog_FORM AttConverter::StrToTurnLogForm(const char *value, bool logWarning) const
 {
-    if (value == "lower") return turnLog_FORM_lower;
-    if (value == "upper") return turnLog_FORM_upper;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.turn.log@form", value.c_str());
+    static constexpr std::pair<const char *, turnLog_FORM> table[2] = {
+        { "lower", turnLog_FORM_lower }, { "upper", turnLog_FORM_upper }
+    };
+    const auto &entry = table[HashToken(value, 1) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.turn.log@form", value);
     return turnLog_FORM_NONE;
 }
 
 std::string AttConverter::VoltaGroupingSymVoltasymToStr(voltaGroupingSym_VOLTASYM data) const
 {
-    std::string value;
-    switch (data) {
-        case voltaGroupingSym_VOLTASYM_brace: value = "brace"; break;
-        case voltaGroupingSym_VOLTASYM_bracket: value = "bracket"; break;
-        case voltaGroupingSym_VOLTASYM_bracketsq: value = "bracketsq"; break;
-        case voltaGroupingSym_VOLTASYM_line: value = "line"; break;
-        case voltaGroupingSym_VOLTASYM_none: value = "none"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.voltaGroupingSym@voltasym", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-voltaGroupingSym_VOLTASYM AttConverter::StrToVoltaGroupingSymVoltasym(std::string value, bool logWarning) const
-{
-    if (value == "brace") return voltaGroupingSym_VOLTASYM_brace;
-    if (value == "bracket") return voltaGroupingSym_VOLTASYM_bracket;
-    if (value == "bracketsq") return voltaGroupingSym_VOLTASYM_bracketsq;
-    if (value == "line") return voltaGroupingSym_VOLTASYM_line;
-    if (value == "none") return voltaGroupingSym_VOLTASYM_none;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.voltaGroupingSym@voltasym", value.c_str());
+    static constexpr const char *values[voltaGroupingSym_VOLTASYM_MAX] = {
+        "", "brace", "bracket", "bracketsq", "line", "none"
+    };
+    if ((data <= voltaGroupingSym_VOLTASYM_NONE) || (data >= voltaGroupingSym_VOLTASYM_MAX)) {
+        LogWarning("Unknown value '%d' for att.voltaGroupingSym@voltasym", data);
+        return "";
+    }
+    return values[data];
+}
+
+voltaGroupingSym_VOLTASYM AttConverter::StrToVoltaGroupingSymVoltasym(const std::string &value, bool logWarning) const
+{
+    return StrToVoltaGroupingSymVoltasym(value.c_str(), logWarning);
+}
+
+voltaGroupingSym_VOLTASYM AttConverter::StrToVoltaGroupingSymVoltasym(const char *value, bool logWarning) const
+{
+    static constexpr std::pair<const char *, voltaGroupingSym_VOLTASYM> table[8] = {
+        { "bracket", voltaGroupingSym_VOLTASYM_bracket }, { "bracketsq", voltaGroupingSym_VOLTASYM_bracketsq },
+        { "", voltaGroupingSym_VOLTASYM_NONE }, { "brace", voltaGroupingSym_VOLTASYM_brace },
+        { "", voltaGroupingSym_VOLTASYM_NONE }, { "line", voltaGroupingSym_VOLTASYM_line },
+        { "", voltaGroupingSym_VOLTASYM_NONE }, { "none", voltaGroupingSym_VOLTASYM_none }
+    };
+    static constexpr uint16_t seeds[2] = { 5, 6 };
+    const uint16_t seed = seeds[HashToken(value, 0) & 1];
+    const auto &entry = table[HashToken(value, seed) & 7];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.voltaGroupingSym@voltasym", value);
     return voltaGroupingSym_VOLTASYM_NONE;
 }
 
 std::string AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) const
 {
-    std::string value;
-    switch (data) {
-        case whitespace_XMLSPACE_default: value = "default"; break;
-        case whitespace_XMLSPACE_preserve: value = "preserve"; break;
-        default:
-            LogWarning("Unknown value '%d' for att.whitespace@xml:space", data);
-            value = "";
-            break;
+    static constexpr const char *values[whitespace_XMLSPACE_MAX] = { "", "default", "preserve" };
+    if ((data <= whitespace_XMLSPACE_NONE) || (data >= whitespace_XMLSPACE_MAX)) {
+        LogWarning("Unknown value '%d' for att.whitespace@xml:space", data);
+        return "";
     }
-    return value;
+    return values[data];
+}
+
+whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(const std::string &value, bool logWarning) const
+{
+    return StrToWhitespaceXmlspace(value.c_str(), logWarning);
 }
 
-whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string value, bool logWarning) const
+whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(const char *value, bool logWarning) const
 {
-    if (value == "default") return whitespace_XMLSPACE_default;
-    if (value == "preserve") return whitespace_XMLSPACE_preserve;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value.c_str());
+    static constexpr std::pair<const char *, whitespace_XMLSPACE> table[2] = {
+        { "default", whitespace_XMLSPACE_default }, { "preserve", whitespace_XMLSPACE_preserve }
+    };
+    const auto &entry = table[HashToken(value, 3) & 1];
+    if (strcmp(value, entry.first) == 0) return entry.second;
+    if (logWarning && (*value != '\0'))
+        LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value);
     return whitespace_XMLSPACE_NONE;
 }
 
@@ -0,0 +1,338 @@
+/////////////////////////////////////////////////////////////////////////////
+// Authors:     Laurent Pugin and Rodolfo Zitellini
+// Created:     2014
+// Copyright (c) Authors and others. All rights reserved.
+//
+// Code generated using a modified version of libmei
+// by Andrew Hankinson, Alastair Porter, and Others
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// NOTE: this file was generated with the Verovio libmei version and
+// should not be edited because changes will be lost.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "att.h"
+
+//----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// AttReader
+//----------------------------------------------------------------------------
+
+/**
+ * Hash function of the perfect hash table below.
+ * The seeds are chosen by the generator so that the names do not collide.
+ */
+static uint32_t HashName(const char *name, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (; *name; ++name) {
+        hash = (hash ^ (unsigned char)*name) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+/**
+ * The att classes reading each name of the table, with the index of the name in the Read* method of the class.
+ */
+static constexpr AttNameOwner s_owners[476] = {
+    { ATT_HARPPEDALLOG, 5 }, { ATT_STAFFITEMS, 0 }, { ATT_ACCIDENTAL, 0 }, { ATT_ACCIDENTALGESTURAL, 0 },
+    { ATT_ORNAMENTACCID, 1 }, { ATT_ORNAMENTACCID, 0 }, { ATT_AGENTIDENT, 0 }, { ATT_TEXTRENDITION, 0 },
+    { ATT_ALTSYM, 0 }, { ATT_BENDGES, 0 }, { ATT_BIBL, 0 }, { ATT_NCFORM, 0 }, { ATT_ARPEGVIS, 0 }, { ATT_ARPEGVIS, 3 },
+    { ATT_ARPEGVIS, 4 }, { ATT_ARPEGVIS, 1 }, { ATT_ARPEGVIS, 2 }, { ATT_ARTICULATION, 0 },
+    { ATT_ARTICULATIONGESTURAL, 0 }, { ATT_RANGING, 0 }, { ATT_RANGING, 1 }, { ATT_SECTIONGES, 0 },
+    { ATT_GRACEGRPLOG, 0 }, { ATT_AUDIENCE, 0 }, { ATT_AUTHORIZED, 0 }, { ATT_AUTHORIZED, 1 }, { ATT_SOUNDLOCATION, 0 },
+    { ATT_HARPPEDALLOG, 6 }, { ATT_BARRING, 0 }, { ATT_BARRING, 1 }, { ATT_BARRING, 2 }, { ATT_STAFFGRPVIS, 0 },
+    { ATT_BEAMPRESENT, 0 }, { ATT_BEAMINGVIS, 0 }, { ATT_BEAMINGLOG, 0 }, { ATT_BEAMINGVIS, 1 }, { ATT_BEAMINGLOG, 1 },
+    { ATT_BEAMINGVIS, 2 }, { ATT_BEAMEDWITH, 0 }, { ATT_FTREMVIS, 0 }, { ATT_FTREMVIS, 1 }, { ATT_BEATRPTLOG, 0 },
+    { ATT_MEDIABOUNDS, 0 }, { ATT_STAFFITEMS, 1 }, { ATT_STAFFITEMS, 2 }, { ATT_MEDIABOUNDS, 2 }, { ATT_CURVATURE, 0 },
+    { ATT_MULTIRESTVIS, 0 }, { ATT_TUPLETVIS, 0 }, { ATT_TUPLETVIS, 1 }, { ATT_BEAMSECONDARY, 0 }, { ATT_CURVATURE, 1 },
+    { ATT_HARPPEDALLOG, 0 }, { ATT_CALENDARED, 0 }, { ATT_CRIT, 0 }, { ATT_CLEFLOG, 0 }, { ATT_EVIDENCE, 0 },
+    { ATT_HARMLOG, 0 }, { ATT_CLASSED, 0 }, { ATT_CLEFFINGVIS, 0 }, { ATT_CLEFFINGLOG, 2 }, { ATT_CLEFFINGLOG, 3 },
+    { ATT_CLEFFINGLOG, 1 }, { ATT_CLEFFINGLOG, 0 }, { ATT_CLEFFINGVIS, 1 }, { ATT_CHORDVIS, 0 }, { ATT_CANONICAL, 0 },
+    { ATT_OCTAVELOG, 0 }, { ATT_COLOR, 0 }, { ATT_COLORATION, 0 }, { ATT_TABULAR, 0 }, { ATT_SPACEVIS, 0 },
+    { ATT_NCFORM, 1 }, { ATT_SYLLOG, 0 }, { ATT_RANGING, 4 }, { ATT_METERCONFORMANCEBAR, 1 }, { ATT_LINKING, 0 },
+    { ATT_LINKING, 1 }, { ATT_METERSIGLOG, 0 }, { ATT_CUE, 0 }, { ATT_NCFORM, 2 }, { ATT_LIQUESCENTVIS, 0 },
+    { ATT_CURVATURE, 2 }, { ATT_CUTOUT, 0 }, { ATT_HARPPEDALLOG, 1 }, { ATT_DATAPOINTING, 0 },
+    { ATT_METADATAPOINTING, 0 }, { ATT_LAYERLOG, 0 }, { ATT_STAFFLOG, 0 }, { ATT_HARMONICFUNCTION, 0 },
+    { ATT_TURNLOG, 0 }, { ATT_PEDALLOG, 0 }, { ATT_OCTAVEDISPLACEMENT, 0 }, { ATT_OCTAVEDISPLACEMENT, 1 },
+    { ATT_MENSURLOG, 0 }, { ATT_AUGMENTDOTS, 0 }, { ATT_DURATIONGESTURAL, 1 }, { ATT_DURATIONADDITIVE, 0 },
+    { ATT_DURATIONLOGICAL, 0 }, { ATT_DURATIONDEFAULT, 0 }, { ATT_DURATIONGESTURAL, 0 }, { ATT_DURATIONGESTURAL, 2 },
+    { ATT_DURATIONGESTURAL, 3 }, { ATT_DURATIONGESTURAL, 4 }, { ATT_DURATIONGESTURAL, 5 }, { ATT_TUPLETVIS, 2 },
+    { ATT_DISTANCES, 0 }, { ATT_HARPPEDALLOG, 2 }, { ATT_SOUNDLOCATION, 1 }, { ATT_ENCLOSINGCHARS, 0 },
+    { ATT_MEDIABOUNDS, 1 }, { ATT_DATABLE, 0 }, { ATT_VISUALOFFSET2HO, 1 }, { ATT_STARTENDID, 0 }, { ATT_ENDINGS, 0 },
+    { ATT_LINEVIS, 2 }, { ATT_LINEVIS, 3 }, { ATT_VISUALOFFSET2TO, 1 }, { ATT_VISUALOFFSET2VO, 1 },
+    { ATT_TARGETEVAL, 0 }, { ATT_EVIDENCE, 1 }, { ATT_EXPANDABLE, 0 }, { ATT_EXTENDER, 0 }, { ATT_EXTENT, 0 },
+    { ATT_NOTEGES, 0 }, { ATT_HARPPEDALLOG, 3 }, { ATT_FACSIMILE, 0 }, { ATT_FERMATAPRESENT, 0 }, { ATT_FTREMVIS, 2 },
+    { ATT_PBVIS, 0 }, { ATT_LINKING, 2 }, { ATT_TYPOGRAPHY, 0 }, { ATT_TYPOGRAPHY, 1 }, { ATT_TYPOGRAPHY, 2 },
+    { ATT_TYPOGRAPHY, 3 }, { ATT_TYPOGRAPHY, 4 }, { ATT_HARMANL, 0 }, { ATT_BTREMLOG, 0 }, { ATT_BEAMREND, 0 },
+    { ATT_FTREMLOG, 0 }, { ATT_HAIRPINLOG, 0 }, { ATT_MORDENTLOG, 0 }, { ATT_TURNLOG, 1 }, { ATT_FINGGRPLOG, 0 },
+    { ATT_LIGATURELOG, 0 }, { ATT_BARLINELOG, 0 }, { ATT_DOTLOG, 0 }, { ATT_EPISEMAVIS, 0 }, { ATT_FERMATAVIS, 0 },
+    { ATT_LINEVIS, 0 }, { ATT_MENSURVIS, 0 }, { ATT_METERSIGVIS, 0 }, { ATT_PEDALVIS, 0 }, { ATT_SBVIS, 0 },
+    { ATT_BRACKETSPANLOG, 0 }, { ATT_METERSIGGRPLOG, 0 }, { ATT_PEDALLOG, 1 }, { ATT_ACCIDLOG, 0 }, { ATT_TEMPOLOG, 0 },
+    { ATT_ANCHOREDTEXTLOG, 0 }, { ATT_CURVELOG, 0 }, { ATT_LINELOG, 0 }, { ATT_HARPPEDALLOG, 4 },
+    { ATT_GLISSPRESENT, 0 }, { ATT_EXTSYM, 0 }, { ATT_EXTSYM, 1 }, { ATT_EXTSYM, 2 }, { ATT_EXTSYM, 3 },
+    { ATT_GRACED, 0 }, { ATT_GRACED, 1 }, { ATT_SCOREDEFVISCMN, 0 }, { ATT_STAFFDEFVIS, 0 }, { ATT_HORIZONTALALIGN, 0 },
+    { ATT_HANDIDENT, 0 }, { ATT_DISTANCES, 1 }, { ATT_NOTEHEADS, 0 }, { ATT_NOTEHEADS, 1 }, { ATT_NOTEHEADS, 2 },
+    { ATT_NOTEHEADS, 3 }, { ATT_NOTEHEADS, 4 }, { ATT_NOTEHEADS, 5 }, { ATT_NOTEHEADS, 6 }, { ATT_NOTEHEADS, 7 },
+    { ATT_NOTEHEADS, 8 }, { ATT_HEIGHT, 0 }, { ATT_VISUALOFFSETHO, 0 }, { ATT_NCFORM, 3 }, { ATT_BIFOLIUMSURFACES, 2 },
+    { ATT_BIFOLIUMSURFACES, 1 }, { ATT_INSTRUMENTIDENT, 0 }, { ATT_INTERVALHARMONIC, 0 }, { ATT_INTERVALMELODIC, 0 },
+    { ATT_DATABLE, 1 }, { ATT_JOINED, 0 }, { ATT_KEYSIGDEFAULTANL, 0 }, { ATT_KEYSIGDEFAULTANL, 1 },
+    { ATT_KEYSIGDEFAULTANL, 2 }, { ATT_KEYSIGDEFAULTLOG, 0 }, { ATT_KEYSIGDEFAULTVIS, 0 }, { ATT_KEYSIGDEFAULTVIS, 1 },
+    { ATT_LABELLED, 0 }, { ATT_LAYERIDENT, 0 }, { ATT_STAFFDEFVIS, 1 }, { ATT_MEASURELOG, 0 }, { ATT_BARLINEVIS, 0 },
+    { ATT_LINEREND, 0 }, { ATT_LINEREND, 1 }, { ATT_GRPSYMLOG, 0 }, { ATT_CURVEREND, 0 }, { ATT_LINERENDBASE, 0 },
+    { ATT_NOTEANLMENSURAL, 0 }, { ATT_NCFORM, 4 }, { ATT_LINELOC, 0 }, { ATT_ARPEGVIS, 5 }, { ATT_ARPEGVIS, 6 },
+    { ATT_STAFFDEFLOG, 0 }, { ATT_STAFFDEFVIS, 2 }, { ATT_STAFFDEFVIS, 3 }, { ATT_STAFFLOC, 0 }, { ATT_MORDENTLOG, 1 },
+    { ATT_LIQUESCENTVIS, 1 }, { ATT_COORDINATED, 2 }, { ATT_COORDINATED, 3 }, { ATT_LINERENDBASE, 1 },
+    { ATT_LINEREND, 2 }, { ATT_LINEREND, 3 }, { ATT_LVPRESENT, 0 }, { ATT_CURVEREND, 1 }, { ATT_LINERENDBASE, 2 },
+    { ATT_LYRICSTYLE, 0 }, { ATT_LYRICSTYLE, 1 }, { ATT_LYRICSTYLE, 2 }, { ATT_LYRICSTYLE, 3 }, { ATT_LYRICSTYLE, 4 },
+    { ATT_LYRICSTYLE, 5 }, { ATT_RANGING, 3 }, { ATT_MEDIUM, 0 }, { ATT_MEIVERSION, 0 }, { ATT_MENSURALVIS, 0 },
+    { ATT_MENSURALLOG, 0 }, { ATT_MENSURALVIS, 1 }, { ATT_MENSURALVIS, 2 }, { ATT_MENSURALVIS, 3 },
+    { ATT_MENSURALLOG, 1 }, { ATT_MENSURALVIS, 4 }, { ATT_MENSURALLOG, 2 }, { ATT_METERCONFORMANCE, 0 },
+    { ATT_METERCONFORMANCEBAR, 0 }, { ATT_METERSIGDEFAULTLOG, 0 }, { ATT_METERSIGDEFAULTVIS, 0 },
+    { ATT_METERSIGDEFAULTVIS, 1 }, { ATT_METERSIGDEFAULTLOG, 2 }, { ATT_METERSIGDEFAULTLOG, 1 },
+    { ATT_REGULARMETHOD, 0 }, { ATT_BARLINEVIS, 1 }, { ATT_MELODICFUNCTION, 0 }, { ATT_MIDITEMPO, 0 },
+    { ATT_CHANNELIZED, 0 }, { ATT_CHANNELIZED, 1 }, { ATT_MIDIINSTRUMENT, 1 }, { ATT_MIDIINSTRUMENT, 0 },
+    { ATT_MIDITEMPO, 1 }, { ATT_MIDIINSTRUMENT, 2 }, { ATT_MIDIINSTRUMENT, 3 }, { ATT_MIDIINSTRUMENT, 4 },
+    { ATT_CHANNELIZED, 2 }, { ATT_CHANNELIZED, 3 }, { ATT_MIDIINSTRUMENT, 5 }, { ATT_INTERNETMEDIA, 0 },
+    { ATT_RANGING, 2 }, { ATT_MMTEMPO, 0 }, { ATT_MMTEMPO, 2 }, { ATT_MMTEMPO, 1 }, { ATT_MEASURENUMBERS, 0 },
+    { ATT_KEYSIGANL, 0 }, { ATT_MENSURALSHARED, 0 }, { ATT_MENSURALSHARED, 1 }, { ATT_MULTINUMMEASURES, 0 },
+    { ATT_NOTATIONSTYLE, 0 }, { ATT_NOTATIONSTYLE, 1 }, { ATT_NINTEGER, 0 }, { ATT_NNUMBERLIKE, 0 }, { ATT_LINKING, 3 },
+    { ATT_HAIRPINLOG, 1 }, { ATT_FILING, 0 }, { ATT_DATABLE, 2 }, { ATT_NOTATIONTYPE, 1 }, { ATT_NOTATIONTYPE, 0 },
+    { ATT_DATABLE, 3 }, { ATT_NUMBERED, 0 }, { ATT_MIDINUMBER, 0 }, { ATT_DURATIONRATIO, 0 },
+    { ATT_DURATIONDEFAULT, 1 }, { ATT_TUPLETVIS, 3 }, { ATT_NUMBERPLACEMENT, 0 }, { ATT_NUMBERPLACEMENT, 1 },
+    { ATT_DURATIONRATIO, 1 }, { ATT_DURATIONDEFAULT, 2 }, { ATT_NAME, 0 }, { ATT_NCLOG, 0 }, { ATT_OCTAVE, 0 },
+    { ATT_OCTAVEDEFAULT, 0 }, { ATT_NCGES, 0 }, { ATT_NOTEGES, 1 }, { ATT_STAFFLOCPITCHED, 1 }, { ATT_ONELINESTAFF, 0 },
+    { ATT_HAIRPINVIS, 0 }, { ATT_OPTIMIZATION, 0 }, { ATT_ARPEGLOG, 0 }, { ATT_FINGGRPVIS, 0 }, { ATT_MENSURVIS, 1 },
+    { ATT_ORIGINSTARTENDID, 1 }, { ATT_ORIGINLAYERIDENT, 0 }, { ATT_ORIGINSTAFFIDENT, 0 }, { ATT_ORIGINSTARTENDID, 0 },
+    { ATT_ORIGINTIMESTAMPLOGICAL, 0 }, { ATT_ORIGINTIMESTAMPLOGICAL, 1 }, { ATT_ORNAMPRESENT, 0 },
+    { ATT_BIFOLIUMSURFACES, 0 }, { ATT_BIFOLIUMSURFACES, 3 }, { ATT_PAGES, 3 }, { ATT_PAGES, 0 }, { ATT_PAGES, 4 },
+    { ATT_PAGES, 6 }, { ATT_PAGES, 5 }, { ATT_PAGES, 7 }, { ATT_PAGES, 2 }, { ATT_PAGES, 1 }, { ATT_PARTIDENT, 0 },
+    { ATT_PARTIDENT, 1 }, { ATT_PITCHCLASS, 0 }, { ATT_PIANOPEDALS, 0 }, { ATT_BEAMREND, 1 }, { ATT_PLACEMENT, 0 },
+    { ATT_ANNOTVIS, 0 }, { ATT_BARLINEVIS, 2 }, { ATT_EPISEMAVIS, 1 }, { ATT_HISPANTICKVIS, 0 },
+    { ATT_SIGNIFLETVIS, 0 }, { ATT_PLIST, 0 }, { ATT_STAFFLOCPITCHED, 0 }, { ATT_NCLOG, 1 }, { ATT_PITCH, 0 },
+    { ATT_NCGES, 1 }, { ATT_NOTEGES, 2 }, { ATT_NCGES, 2 }, { ATT_NOTEGES, 3 }, { ATT_TIMEBASE, 0 }, { ATT_LINKING, 4 },
+    { ATT_LINKING, 5 }, { ATT_MENSURALSHARED, 2 }, { ATT_MENSURALLOG, 3 }, { ATT_MENSURALLOG, 4 }, { ATT_SOLFA, 0 },
+    { ATT_QUANTITY, 0 }, { ATT_REASONIDENT, 0 }, { ATT_RECORDTYPE, 0 }, { ATT_FOLIUMSURFACES, 0 }, { ATT_REHEARSAL, 0 },
+    { ATT_NCFORM, 5 }, { ATT_TEXTRENDITION, 1 }, { ATT_HARMVIS, 0 }, { ATT_RESPONSIBILITY, 0 }, { ATT_SECTIONVIS, 0 },
+    { ATT_MEASURELOG, 1 }, { ATT_NAME, 1 }, { ATT_TABULAR, 1 }, { ATT_NCFORM, 6 }, { ATT_LINKING, 6 },
+    { ATT_SCALABLE, 0 }, { ATT_SEQUENCE, 0 }, { ATT_CLEFSHAPE, 0 }, { ATT_FERMATAVIS, 1 }, { ATT_KEYSIGLOG, 0 },
+    { ATT_KEYSIGVIS, 0 }, { ATT_MENSURLOG, 1 }, { ATT_BEAMREND, 2 }, { ATT_SLASHCOUNT, 0 }, { ATT_BEATRPTVIS, 0 },
+    { ATT_BEAMREND, 3 }, { ATT_SLURPRESENT, 0 }, { ATT_SLURREND, 0 }, { ATT_SLURREND, 1 }, { ATT_SOURCE, 0 },
+    { ATT_RESTVISMENSURAL, 0 }, { ATT_STAFFDEFVIS, 4 }, { ATT_SPACING, 0 }, { ATT_SPACING, 1 }, { ATT_SPACING, 2 },
+    { ATT_SPACING, 3 }, { ATT_STAFFIDENT, 0 }, { ATT_DATABLE, 4 }, { ATT_VISUALOFFSET2HO, 0 }, { ATT_STARTID, 0 },
+    { ATT_LINEVIS, 4 }, { ATT_LINEVIS, 5 }, { ATT_VISUALOFFSET2TO, 0 }, { ATT_VISUALOFFSET2VO, 0 }, { ATT_STEMS, 0 },
+    { ATT_STEMS, 1 }, { ATT_STEMS, 2 }, { ATT_STEMS, 3 }, { ATT_STEMS, 4 }, { ATT_STEMSCMN, 0 }, { ATT_STEMS, 5 },
+    { ATT_STEMS, 6 }, { ATT_SURFACE, 0 }, { ATT_SYLTEXT, 0 }, { ATT_METERSIGLOG, 1 }, { ATT_STAFFGROUPINGSYM, 0 },
+    { ATT_LINKING, 7 }, { ATT_SYSTEMS, 0 }, { ATT_SYSTEMS, 1 }, { ATT_SYSTEMS, 2 }, { ATT_SYSTEMS, 3 },
+    { ATT_ATTACCALOG, 0 }, { ATT_CUSTOSLOG, 0 }, { ATT_MENSURALSHARED, 3 }, { ATT_DISTANCES, 2 }, { ATT_TEXTSTYLE, 0 },
+    { ATT_TEXTSTYLE, 1 }, { ATT_TEXTSTYLE, 2 }, { ATT_TEXTSTYLE, 3 }, { ATT_TEXTSTYLE, 4 }, { ATT_TIEPRESENT, 0 },
+    { ATT_TIEREND, 0 }, { ATT_TIEREND, 1 }, { ATT_NCFORM, 7 }, { ATT_HISPANTICKVIS, 1 }, { ATT_VISUALOFFSETTO, 0 },
+    { ATT_TRANSPOSITION, 0 }, { ATT_TRANSPOSITION, 1 }, { ATT_TIMESTAMPLOGICAL, 0 }, { ATT_TIMESTAMPGESTURAL, 0 },
+    { ATT_TIMESTAMPGESTURAL, 1 }, { ATT_TIMESTAMP2LOGICAL, 0 }, { ATT_TIMESTAMP2GESTURAL, 0 },
+    { ATT_TIMESTAMP2GESTURAL, 1 }, { ATT_SCOREDEFGES, 1 }, { ATT_SCOREDEFGES, 0 }, { ATT_SCOREDEFGES, 2 },
+    { ATT_TUPLETPRESENT, 0 }, { ATT_TYPED, 0 }, { ATT_COORDINATED, 0 }, { ATT_COORDINATED, 1 }, { ATT_MEASUREMENT, 0 },
+    { ATT_METERSIGLOG, 2 }, { ATT_TREMMEASURED, 0 }, { ATT_MIDIVALUE, 0 }, { ATT_MIDIVALUE2, 0 },
+    { ATT_VERTICALALIGN, 0 }, { ATT_MIDIVELOCITY, 0 }, { ATT_FOLIUMSURFACES, 1 }, { ATT_VERTICALGROUP, 0 },
+    { ATT_VISIBILITY, 0 }, { ATT_VISUALOFFSETVO, 0 }, { ATT_VOLTAGROUPINGSYM, 0 }, { ATT_SCOREDEFVIS, 0 },
+    { ATT_QUILISMAVIS, 0 }, { ATT_ALIGNMENT, 0 }, { ATT_WIDTH, 0 }, { ATT_LINEVIS, 1 }, { ATT_SYLLOG, 1 },
+    { ATT_XY, 0 }, { ATT_XY2, 0 }, { ATT_POINTING, 0 }, { ATT_POINTING, 1 }, { ATT_POINTING, 2 }, { ATT_POINTING, 3 },
+    { ATT_POINTING, 4 }, { ATT_BASIC, 0 }, { ATT_LANG, 0 }, { ATT_WHITESPACE, 0 }, { ATT_LANG, 1 }, { ATT_XY, 1 },
+    { ATT_XY2, 1 }
+};
+
+const AttNameEntry *AttReader::FindName(const char *name)
+{
+    static constexpr AttNameEntry names[512] = {
+        { "tie.lform", s_owners + 425, 1 }, { "origin.tstamp2", s_owners + 316, 1 },
+        { "tstamp.real", s_owners + 434, 1 }, { "opening", s_owners + 306, 1 }, { "", NULL, 0 },
+        { "dur.ges", s_owners + 100, 1 }, { "text.fam", s_owners + 419, 1 }, { "num", s_owners + 289, 3 },
+        { "midi.duty", s_owners + 258, 1 }, { "ho", s_owners + 185, 1 }, { "d", s_owners + 84, 1 },
+        { "beam.color", s_owners + 33, 1 }, { "altsym", s_owners + 8, 1 }, { "", NULL, 0 },
+        { "voltasym", s_owners + 456, 1 }, { "mm.unit", s_owners + 272, 1 }, { "halign", s_owners + 172, 1 },
+        { "clef.line", s_owners + 62, 1 }, { "orient", s_owners + 309, 2 }, { "right", s_owners + 364, 1 },
+        { "num.visible", s_owners + 295, 1 }, { "meter.count", s_owners + 248, 1 }, { "looped", s_owners + 220, 1 },
+        { "tune.Hz", s_owners + 438, 1 }, { "startid", s_owners + 393, 1 }, { "", NULL, 0 },
+        { "dir", s_owners + 91, 1 }, { "left", s_owners + 203, 1 }, { "extremis", s_owners + 124, 1 },
+        { "line", s_owners + 212, 1 }, { "hand", s_owners + 173, 1 }, { "", NULL, 0 },
+        { "system.leftmar", s_owners + 412, 1 }, { "", NULL, 0 }, { "", NULL, 0 },
+        { "system.topmar", s_owners + 414, 1 }, { "lv", s_owners + 226, 1 }, { "evaluate", s_owners + 119, 1 },
+        { "", NULL, 0 }, { "", NULL, 0 }, { "dur.real", s_owners + 103, 1 }, { "arrow.color", s_owners + 13, 1 },
+        { "numbase.default", s_owners + 297, 1 }, { "sameas", s_owners + 368, 1 },
+        { "clef.dis.place", s_owners + 61, 1 }, { "", NULL, 0 }, { "", NULL, 0 }, { "oct.default", s_owners + 301, 1 },
+        { "place", s_owners + 332, 7 }, { "beloworder", s_owners + 43, 1 }, { "beam", s_owners + 32, 1 },
+        { "", NULL, 0 }, { "accidupper", s_owners + 5, 1 }, { "page.topmar", s_owners + 326, 1 },
+        { "fontfam", s_owners + 131, 1 }, { "", NULL, 0 }, { "mfunc", s_owners + 255, 1 },
+        { "clef.color", s_owners + 59, 1 }, { "system.leftline", s_owners + 411, 1 },
+        { "dur.default", s_owners + 99, 1 }, { "slope", s_owners + 379, 1 }, { "", NULL, 0 },
+        { "pedal.style", s_owners + 331, 1 }, { "width", s_owners + 460, 2 }, { "hooked", s_owners + 186, 1 },
+        { "", NULL, 0 }, { "slur.lwidth", s_owners + 382, 1 }, { "sShape", s_owners + 367, 1 }, { "", NULL, 0 },
+        { "harm.dist", s_owners + 174, 1 }, { "colspan", s_owners + 70, 1 }, { "startho", s_owners + 392, 1 },
+        { "val2", s_owners + 449, 1 }, { "stem.len", s_owners + 399, 1 }, { "source", s_owners + 383, 1 },
+        { "notbefore", s_owners + 288, 1 }, { "spaces", s_owners + 384, 1 }, { "coll", s_owners + 67, 1 },
+        { "line.width", s_owners + 214, 1 }, { "expand", s_owners + 121, 1 }, { "y", s_owners + 474, 1 },
+        { "optimize", s_owners + 307, 1 }, { "inner.verso", s_owners + 188, 1 }, { "syl", s_owners + 407, 1 },
+        { "key.sig", s_owners + 197, 1 }, { "lstartsym.size", s_owners + 225, 1 }, { "tstamp2", s_owners + 435, 1 },
+        { "page.panels", s_owners + 323, 1 }, { "count", s_owners + 78, 1 }, { "modusminor", s_owners + 276, 1 },
+        { "ulx", s_owners + 443, 1 }, { "f", s_owners + 125, 1 }, { "slash", s_owners + 376, 3 }, { "", NULL, 0 },
+        { "midi.patchname", s_owners + 263, 1 }, { "deg", s_owners + 89, 1 }, { "unitdur", s_owners + 447, 1 },
+        { "medium", s_owners + 236, 1 }, { "", NULL, 0 }, { "notationtype", s_owners + 287, 1 }, { "", NULL, 0 },
+        { "", NULL, 0 }, { "partstaff", s_owners + 329, 1 }, { "page.scale", s_owners + 325, 1 },
+        { "glyph.uri", s_owners + 167, 1 }, { "arrow.size", s_owners + 16, 1 }, { "cause", s_owners + 54, 1 },
+        { "", NULL, 0 }, { "part", s_owners + 328, 1 }, { "music.size", s_owners + 279, 1 },
+        { "copyof", s_owners + 76, 1 }, { "spacing.system", s_owners + 389, 1 }, { "", NULL, 0 },
+        { "audience", s_owners + 23, 1 }, { "", NULL, 0 }, { "", NULL, 0 }, { "data", s_owners + 85, 1 },
+        { "order", s_owners + 308, 1 }, { "page.botmar", s_owners + 320, 1 }, { "compressable", s_owners + 71, 1 },
+        { "outer.verso", s_owners + 319, 1 }, { "wordpos", s_owners + 462, 1 }, { "head.color", s_owners + 177, 1 },
+        { "", NULL, 0 }, { "head.fill", s_owners + 178, 1 }, { "follows", s_owners + 130, 1 },
+        { "midi.mspb", s_owners + 261, 1 }, { "mensur.color", s_owners + 238, 1 }, { "endsym", s_owners + 115, 1 },
+        { "stem.mod", s_owners + 400, 1 }, { "tuplet", s_owners + 441, 1 }, { "endid", s_owners + 113, 1 },
+        { "key.mode", s_owners + 195, 1 }, { "block", s_owners + 47, 1 }, { "tilt", s_owners + 427, 2 },
+        { "", NULL, 0 }, { "mensur.form", s_owners + 240, 1 }, { "dis", s_owners + 92, 1 }, { "", NULL, 0 },
+        { "modusmaior", s_owners + 275, 1 }, { "pname", s_owners + 341, 2 }, { "grace", s_owners + 168, 1 },
+        { "text.size", s_owners + 421, 1 }, { "text.weight", s_owners + 423, 1 }, { "", NULL, 0 },
+        { "tune.temper", s_owners + 440, 1 }, { "n", s_owners + 280, 2 }, { "uly", s_owners + 444, 1 },
+        { "def", s_owners + 87, 2 }, { "func", s_owners + 154, 8 }, { "", NULL, 0 },
+        { "spacing.packexp", s_owners + 386, 1 }, { "music.name", s_owners + 278, 1 }, { "lig", s_owners + 210, 1 },
+        { "", NULL, 0 }, { "seq", s_owners + 370, 1 }, { "restart", s_owners + 363, 1 }, { "", NULL, 0 },
+        { "glyph.num", s_owners + 166, 1 }, { "", NULL, 0 }, { "beam.group", s_owners + 34, 1 },
+        { "prev", s_owners + 349, 1 }, { "beam.with", s_owners + 38, 1 }, { "endho", s_owners + 112, 1 },
+        { "x", s_owners + 463, 1 }, { "num.default", s_owners + 292, 1 }, { "long", s_owners + 219, 1 },
+        { "slur", s_owners + 380, 1 }, { "dur.recip", s_owners + 104, 1 }, { "num.place", s_owners + 294, 1 },
+        { "trans.diat", s_owners + 430, 1 }, { "glyph.name", s_owners + 165, 1 }, { "", NULL, 0 },
+        { "endsym.size", s_owners + 116, 1 }, { "", NULL, 0 }, { "b", s_owners + 27, 1 }, { "", NULL, 0 },
+        { "bezier", s_owners + 46, 1 }, { "scale", s_owners + 369, 1 }, { "keysig.show", s_owners + 198, 1 },
+        { "atleast", s_owners + 19, 1 }, { "mensur.slash", s_owners + 245, 1 }, { "tstamp2.ges", s_owners + 436, 1 },
+        { "", NULL, 0 }, { "", NULL, 0 }, { "lstartsym", s_owners + 224, 1 }, { "", NULL, 0 },
+        { "sig", s_owners + 373, 1 }, { "", NULL, 0 }, { "bar.place", s_owners + 30, 1 },
+        { "precedes", s_owners + 348, 1 }, { "agent", s_owners + 6, 1 }, { "page.width", s_owners + 327, 1 },
+        { "target", s_owners + 415, 2 }, { "ending.rend", s_owners + 114, 1 }, { "mensur.sign", s_owners + 243, 1 },
+        { "", NULL, 0 }, { "clef.dis", s_owners + 60, 1 }, { "vel", s_owners + 451, 1 },
+        { "stem.x", s_owners + 404, 1 }, { "clef.visible", s_owners + 64, 1 }, { "lyric.style", s_owners + 233, 1 },
+        { "symbol", s_owners + 409, 1 }, { "", NULL, 0 }, { "head.visible", s_owners + 183, 1 },
+        { "layer", s_owners + 201, 1 }, { "", NULL, 0 }, { "multi.number", s_owners + 277, 1 },
+        { "head.shape", s_owners + 182, 1 }, { "niente", s_owners + 283, 1 }, { "x2", s_owners + 464, 1 },
+        { "fontname", s_owners + 132, 1 }, { "gliss", s_owners + 163, 1 }, { "inner.recto", s_owners + 187, 1 },
+        { "", NULL, 0 }, { "rendgrid", s_owners + 361, 1 }, { "", NULL, 0 }, { "plist", s_owners + 339, 1 },
+        { "delayed", s_owners + 90, 1 }, { "dot", s_owners + 94, 1 }, { "", NULL, 0 },
+        { "recordtype", s_owners + 356, 1 }, { "midi.instrnum", s_owners + 260, 1 }, { "con", s_owners + 72, 2 },
+        { "class", s_owners + 58, 1 }, { "text.name", s_owners + 420, 1 }, { "head.rotation", s_owners + 181, 1 },
+        { "e", s_owners + 107, 1 }, { "angled", s_owners + 11, 1 }, { "oct.ges", s_owners + 302, 2 },
+        { "lform", s_owners + 208, 2 }, { "", NULL, 0 }, { "level", s_owners + 207, 1 }, { "c", s_owners + 52, 1 },
+        { "artic", s_owners + 17, 1 }, { "chordref", s_owners + 57, 1 }, { "g", s_owners + 162, 1 },
+        { "xlink:target", s_owners + 468, 1 }, { "lines.color", s_owners + 216, 1 }, { "notafter", s_owners + 285, 1 },
+        { "azimuth", s_owners + 26, 1 }, { "altrend", s_owners + 7, 1 }, { "lendsym", s_owners + 205, 1 },
+        { "midi.volume", s_owners + 267, 1 }, { "mode", s_owners + 274, 1 }, { "mnum.visible", s_owners + 273, 1 },
+        { "", NULL, 0 }, { "mensur.dot", s_owners + 239, 1 }, { "next", s_owners + 282, 1 },
+        { "origin.staff", s_owners + 313, 1 }, { "lendsym.size", s_owners + 206, 1 },
+        { "startsym.size", s_owners + 395, 1 }, { "loc", s_owners + 218, 1 }, { "layerscheme", s_owners + 202, 1 },
+        { "instr", s_owners + 189, 1 }, { "height", s_owners + 184, 1 }, { "atmost", s_owners + 20, 1 },
+        { "stem.visible", s_owners + 402, 1 }, { "dur.visible", s_owners + 105, 1 }, { "beam.rend", s_owners + 35, 1 },
+        { "grid.show", s_owners + 170, 2 }, { "analog", s_owners + 10, 1 }, { "", NULL, 0 },
+        { "oct", s_owners + 299, 2 }, { "midi.bpm", s_owners + 256, 1 }, { "ppq", s_owners + 347, 1 },
+        { "xlink:show", s_owners + 467, 1 }, { "", NULL, 0 }, { "sign", s_owners + 375, 1 },
+        { "xml:space", s_owners + 472, 1 }, { "", NULL, 0 }, { "join", s_owners + 193, 1 },
+        { "head.fillcolor", s_owners + 179, 1 }, { "folium", s_owners + 129, 1 }, { "", NULL, 0 },
+        { "surface", s_owners + 406, 1 }, { "midi.pan", s_owners + 262, 1 }, { "bracket.visible", s_owners + 49, 1 },
+        { "facs", s_owners + 126, 1 }, { "pnum", s_owners + 345, 2 }, { "", NULL, 0 }, { "bulge", s_owners + 51, 1 },
+        { "", NULL, 0 }, { "float.gap", s_owners + 128, 1 }, { "ontheline", s_owners + 305, 1 },
+        { "begin", s_owners + 42, 1 }, { "", NULL, 0 }, { "arrow", s_owners + 12, 1 }, { "a", s_owners + 0, 1 },
+        { "", NULL, 0 }, { "midi.track", s_owners + 266, 1 }, { "cutout", s_owners + 83, 1 },
+        { "stem.dir", s_owners + 398, 1 }, { "startvo", s_owners + 397, 1 }, { "color", s_owners + 68, 1 },
+        { "type", s_owners + 442, 1 }, { "staff", s_owners + 390, 1 }, { "accid.ges", s_owners + 3, 1 },
+        { "notationsubtype", s_owners + 286, 1 }, { "keysig.showchange", s_owners + 199, 1 },
+        { "len", s_owners + 204, 1 }, { "psolfa", s_owners + 353, 1 }, { "metcon", s_owners + 246, 2 },
+        { "origin.endid", s_owners + 311, 1 }, { "when", s_owners + 459, 1 }, { "spacing.staff", s_owners + 388, 1 },
+        { "curvedir", s_owners + 82, 1 }, { "mm", s_owners + 270, 1 }, { "meter.unit", s_owners + 252, 1 },
+        { "proport.numbase", s_owners + 352, 1 }, { "curve", s_owners + 80, 2 }, { "colored", s_owners + 69, 1 },
+        { "fontstyle", s_owners + 134, 1 }, { "cue", s_owners + 79, 1 }, { "reason", s_owners + 355, 1 },
+        { "", NULL, 0 }, { "tstamp.ges", s_owners + 433, 1 }, { "mensur.size", s_owners + 244, 1 },
+        { "key.pname", s_owners + 196, 1 }, { "mimetype", s_owners + 268, 1 }, { "recto", s_owners + 357, 1 },
+        { "xlink:role", s_owners + 466, 1 }, { "origin.startid", s_owners + 314, 1 }, { "", NULL, 0 },
+        { "betweenorder", s_owners + 44, 1 }, { "cert", s_owners + 56, 1 }, { "page.leftmar", s_owners + 322, 1 },
+        { "betype", s_owners + 45, 1 }, { "xml:translit", s_owners + 473, 1 }, { "", NULL, 0 },
+        { "synch", s_owners + 410, 1 }, { "min", s_owners + 269, 1 }, { "decls", s_owners + 86, 1 },
+        { "tie", s_owners + 424, 1 }, { "dots.ges", s_owners + 96, 1 }, { "midi.port", s_owners + 265, 1 },
+        { "unit", s_owners + 445, 2 }, { "xml:base", s_owners + 470, 1 }, { "", NULL, 0 },
+        { "line.form", s_owners + 213, 1 }, { "nonfiling", s_owners + 284, 1 },
+        { "xlink:targettype", s_owners + 469, 1 }, { "end", s_owners + 110, 1 }, { "max", s_owners + 235, 1 },
+        { "", NULL, 0 }, { "val", s_owners + 448, 1 }, { "arrow.shape", s_owners + 15, 1 }, { "", NULL, 0 },
+        { "vo", s_owners + 455, 1 }, { "nymref", s_owners + 298, 1 }, { "stem.pos", s_owners + 401, 1 },
+        { "", NULL, 0 }, { "xlink:actuate", s_owners + 465, 1 }, { "", NULL, 0 }, { "ligated", s_owners + 211, 1 },
+        { "accidlower", s_owners + 4, 1 }, { "meiversion", s_owners + 237, 1 }, { "waves", s_owners + 458, 1 },
+        { "beatdef", s_owners + 41, 1 }, { "aboveorder", s_owners + 1, 1 }, { "beam.slope", s_owners + 37, 1 },
+        { "bar.method", s_owners + 29, 1 }, { "", NULL, 0 }, { "num.format", s_owners + 293, 1 },
+        { "meter.sym", s_owners + 251, 1 }, { "", NULL, 0 }, { "lry", s_owners + 222, 1 },
+        { "mm.dots", s_owners + 271, 1 }, { "midi.instrname", s_owners + 259, 1 }, { "vgrp", s_owners + 453, 1 },
+        { "rowspan", s_owners + 366, 1 }, { "y2", s_owners + 475, 1 }, { "stem.y", s_owners + 405, 1 },
+        { "confidence", s_owners + 74, 1 }, { "form", s_owners + 136, 18 }, { "inth", s_owners + 190, 1 },
+        { "dynam.dist", s_owners + 106, 1 }, { "beams", s_owners + 39, 1 }, { "", NULL, 0 }, { "", NULL, 0 },
+        { "numbase", s_owners + 296, 1 }, { "", NULL, 0 }, { "meter.form", s_owners + 249, 1 },
+        { "grace.time", s_owners + 169, 1 }, { "dis.place", s_owners + 93, 1 }, { "bar.len", s_owners + 28, 1 },
+        { "tune.pname", s_owners + 439, 1 }, { "rend", s_owners + 360, 1 }, { "lsegs", s_owners + 223, 1 },
+        { "ploc", s_owners + 340, 1 }, { "cautionary", s_owners + 55, 1 }, { "glyph.auth", s_owners + 164, 1 },
+        { "lines", s_owners + 215, 1 }, { "bracket.place", s_owners + 48, 1 }, { "auth.uri", s_owners + 25, 1 },
+        { "artic.ges", s_owners + 18, 1 }, { "endto", s_owners + 117, 1 }, { "xml:lang", s_owners + 471, 1 },
+        { "extent", s_owners + 123, 1 }, { "pclass", s_owners + 330, 1 }, { "", NULL, 0 },
+        { "stem.with", s_owners + 403, 1 }, { "mensur.orient", s_owners + 242, 1 }, { "", NULL, 0 },
+        { "endvo", s_owners + 118, 1 }, { "", NULL, 0 }, { "spacing", s_owners + 385, 1 },
+        { "lyric.size", s_owners + 232, 1 }, { "outer.recto", s_owners + 318, 1 }, { "dur", s_owners + 97, 2 },
+        { "proport.num", s_owners + 351, 1 }, { "verso", s_owners + 452, 1 }, { "", NULL, 0 },
+        { "fontweight", s_owners + 135, 1 }, { "beam.rests", s_owners + 36, 1 }, { "method", s_owners + 253, 2 },
+        { "enddate", s_owners + 111, 1 }, { "lyric.weight", s_owners + 234, 1 }, { "bar.thru", s_owners + 31, 1 },
+        { "control", s_owners + 75, 1 }, { "", NULL, 0 }, { "startsym", s_owners + 394, 1 }, { "", NULL, 0 },
+        { "", NULL, 0 }, { "", NULL, 0 }, { "lyric.align", s_owners + 229, 1 },
+        { "meter.showchange", s_owners + 250, 1 }, { "amount", s_owners + 9, 1 }, { "", NULL, 0 },
+        { "resp", s_owners + 362, 1 }, { "to", s_owners + 429, 1 }, { "ornam", s_owners + 317, 1 }, { "", NULL, 0 },
+        { "extender", s_owners + 122, 1 }, { "origin.layer", s_owners + 312, 1 }, { "cluster", s_owners + 65, 1 },
+        { "startdate", s_owners + 391, 1 }, { "attach", s_owners + 22, 1 }, { "reh.enclose", s_owners + 358, 1 },
+        { "dur.ppq", s_owners + 102, 1 }, { "enclose", s_owners + 109, 1 }, { "accid", s_owners + 2, 1 },
+        { "auth", s_owners + 24, 1 }, { "", NULL, 0 }, { "lyric.fam", s_owners + 230, 1 }, { "", NULL, 0 },
+        { "tstamp", s_owners + 432, 1 }, { "attacca", s_owners + 21, 1 }, { "vu.height", s_owners + 457, 1 },
+        { "", NULL, 0 }, { "isodate", s_owners + 192, 1 }, { "", NULL, 0 }, { "arrow.fillcolor", s_owners + 14, 1 },
+        { "system.rightmar", s_owners + 413, 1 }, { "dots", s_owners + 95, 1 }, { "valign", s_owners + 450, 1 },
+        { "breaksec", s_owners + 50, 1 }, { "evidence", s_owners + 120, 1 }, { "", NULL, 0 },
+        { "tie.lwidth", s_owners + 426, 1 }, { "", NULL, 0 }, { "fermata", s_owners + 127, 1 },
+        { "startto", s_owners + 396, 1 }, { "dur.metrical", s_owners + 101, 1 }, { "", NULL, 0 },
+        { "lines.visible", s_owners + 217, 1 }, { "pname.ges", s_owners + 343, 2 }, { "key.accid", s_owners + 194, 1 },
+        { "page.height", s_owners + 321, 1 }, { "beams.float", s_owners + 40, 1 },
+        { "spacing.packfact", s_owners + 387, 1 }, { "origin.tstamp", s_owners + 315, 1 }, { "", NULL, 0 },
+        { "clef.shape", s_owners + 63, 1 }, { "mensur.loc", s_owners + 241, 1 }, { "", NULL, 0 }, { "", NULL, 0 },
+        { "label", s_owners + 200, 1 }, { "", NULL, 0 }, { "intm", s_owners + 191, 1 }, { "lwidth", s_owners + 227, 2 },
+        { "rellen", s_owners + 359, 1 }, { "", NULL, 0 }, { "tstamp2.real", s_owners + 437, 1 },
+        { "page.rightmar", s_owners + 324, 1 }, { "text.style", s_owners + 422, 1 }, { "tempus", s_owners + 417, 1 },
+        { "midi.patchnum", s_owners + 264, 1 }, { "shape", s_owners + 371, 2 }, { "sig.showchange", s_owners + 374, 1 },
+        { "midi.channel", s_owners + 257, 1 }, { "", NULL, 0 }, { "head.auth", s_owners + 176, 1 },
+        { "elevation", s_owners + 108, 1 }, { "text.dist", s_owners + 418, 1 }, { "head.altsym", s_owners + 175, 1 },
+        { "corresp", s_owners + 77, 1 }, { "codedval", s_owners + 66, 1 }, { "oloc", s_owners + 304, 1 },
+        { "fontsize", s_owners + 133, 1 }, { "role", s_owners + 365, 1 }, { "calendar", s_owners + 53, 1 },
+        { "head.mod", s_owners + 180, 1 }, { "", NULL, 0 }, { "slur.lform", s_owners + 381, 1 },
+        { "prolatio", s_owners + 350, 1 }, { "sym", s_owners + 408, 1 }, { "visible", s_owners + 454, 1 },
+        { "lyric.name", s_owners + 231, 1 }, { "lrx", s_owners + 221, 1 }, { "quantity", s_owners + 354, 1 },
+        { "trans.semi", s_owners + 431, 1 }
+    };
+    static constexpr uint16_t seeds[256] = {
+        3, 4, 0, 2, 1, 0, 3, 2, 0, 0, 2, 5, 1, 7, 2, 5, 2, 2, 1, 5, 1, 0, 0, 4, 1, 0, 0, 1, 2, 1, 0, 1, 0, 4, 3, 2, 3,
+        7, 0, 1, 5, 0, 1, 6, 2, 10, 0, 0, 2, 14, 7, 0, 0, 2, 0, 0, 2, 1, 4, 1, 2, 1, 0, 0, 1, 2, 1, 2, 1, 1, 1, 1, 1, 0,
+        6, 0, 0, 1, 0, 7, 6, 0, 5, 3, 0, 3, 2, 3, 0, 0, 2, 3, 3, 0, 1, 3, 3, 1, 0, 1, 1, 0, 10, 0, 2, 6, 2, 0, 0, 2, 5,
+        1, 1, 0, 0, 18, 3, 3, 1, 0, 0, 3, 3, 5, 2, 2, 2, 3, 0, 0, 4, 0, 0, 1, 1, 0, 8, 3, 2, 5, 1, 4, 6, 3, 0, 0, 4, 1,
+        6, 14, 0, 2, 3, 1, 9, 0, 2, 2, 1, 0, 0, 0, 12, 2, 0, 5, 0, 3, 1, 8, 1, 0, 0, 0, 4, 0, 1, 11, 6, 2, 0, 9, 0, 0,
+        4, 1, 1, 14, 3, 1, 0, 2, 1, 2, 1, 4, 6, 0, 8, 10, 0, 13, 2, 0, 1, 3, 0, 0, 1, 2, 5, 0, 3, 2, 0, 5, 4, 5, 6, 2,
+        1, 1, 2, 11, 0, 2, 0, 4, 0, 1, 3, 12, 0, 22, 10, 3, 21, 10, 8, 0, 30, 1, 8, 2, 0, 8, 1, 3, 8, 6, 0, 3, 10, 15,
+        5, 0
+    };
+    const uint16_t seed = seeds[HashName(name, 0) & 255];
+    const AttNameEntry &entry = names[HashName(name, seed) & 511];
+    if ((entry.m_ownerCount > 0) && (strcmp(name, entry.m_name) == 0)) return &entry;
+    return NULL;
+}
+
+} // namespace vrv
@@ -46,10 +46,20 @@ void AttHarmAnl::ResetHarmAnl()
 
 bool AttHarmAnl::ReadHarmAnl(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHarmAnl(reader);
+}
+
+bool AttHarmAnl::ReadHarmAnl(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HARMANL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHarmAnlForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HARMANL)) {
+            case 0: this->SetForm(StrToHarmAnlForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -92,10 +102,20 @@ void AttHarmonicFunction::ResetHarmonicFunction()
 
 bool AttHarmonicFunction::ReadHarmonicFunction(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHarmonicFunction(reader);
+}
+
+bool AttHarmonicFunction::ReadHarmonicFunction(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HARMONICFUNCTION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToStr(element.attribute("deg").value()));
-        element.remove_attribute("deg");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HARMONICFUNCTION)) {
+            case 0: this->SetDeg(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,10 +158,20 @@ void AttIntervalHarmonic::ResetIntervalHarmonic()
 
 bool AttIntervalHarmonic::ReadIntervalHarmonic(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadIntervalHarmonic(reader);
+}
+
+bool AttIntervalHarmonic::ReadIntervalHarmonic(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_INTERVALHARMONIC)) return false;
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToStr(element.attribute("inth").value()));
-        element.remove_attribute("inth");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_INTERVALHARMONIC)) {
+            case 0: this->SetInth(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -184,10 +214,20 @@ void AttIntervalMelodic::ResetIntervalMelodic()
 
 bool AttIntervalMelodic::ReadIntervalMelodic(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadIntervalMelodic(reader);
+}
+
+bool AttIntervalMelodic::ReadIntervalMelodic(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_INTERVALMELODIC)) return false;
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToStr(element.attribute("intm").value()));
-        element.remove_attribute("intm");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_INTERVALMELODIC)) {
+            case 0: this->SetIntm(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -230,10 +270,20 @@ void AttKeySigAnl::ResetKeySigAnl()
 
 bool AttKeySigAnl::ReadKeySigAnl(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadKeySigAnl(reader);
+}
+
+bool AttKeySigAnl::ReadKeySigAnl(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_KEYSIGANL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        element.remove_attribute("mode");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_KEYSIGANL)) {
+            case 0: this->SetMode(StrToMode(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -278,20 +328,22 @@ void AttKeySigDefaultAnl::ResetKeySigDefaultAnl()
 
 bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadKeySigDefaultAnl(reader);
+}
+
+bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_KEYSIGDEFAULTANL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalGestural(element.attribute("key.accid").value()));
-        element.remove_attribute("key.accid");
-        hasAttribute = true;
-    }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        element.remove_attribute("key.mode");
-        hasAttribute = true;
-    }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        element.remove_attribute("key.pname");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_KEYSIGDEFAULTANL)) {
+            case 0: this->SetKeyAccid(StrToAccidentalGestural(reader.GetValue(i))); break;
+            case 1: this->SetKeyMode(StrToMode(reader.GetValue(i))); break;
+            case 2: this->SetKeyPname(StrToPitchname(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -352,10 +404,20 @@ void AttMelodicFunction::ResetMelodicFunction()
 
 bool AttMelodicFunction::ReadMelodicFunction(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMelodicFunction(reader);
+}
+
+bool AttMelodicFunction::ReadMelodicFunction(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MELODICFUNCTION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        element.remove_attribute("mfunc");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MELODICFUNCTION)) {
+            case 0: this->SetMfunc(StrToMelodicfunction(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -398,10 +460,20 @@ void AttPitchClass::ResetPitchClass()
 
 bool AttPitchClass::ReadPitchClass(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPitchClass(reader);
+}
+
+bool AttPitchClass::ReadPitchClass(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PITCHCLASS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToInt(element.attribute("pclass").value()));
-        element.remove_attribute("pclass");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PITCHCLASS)) {
+            case 0: this->SetPclass(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -444,10 +516,20 @@ void AttSolfa::ResetSolfa()
 
 bool AttSolfa::ReadSolfa(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSolfa(reader);
+}
+
+bool AttSolfa::ReadSolfa(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SOLFA)) return false;
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        element.remove_attribute("psolfa");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SOLFA)) {
+            case 0: this->SetPsolfa(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
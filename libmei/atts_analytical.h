@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHarmAnl(pugi::xml_node element);
+    bool ReadHarmAnl(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHarmAnl(pugi::xml_node element);
@@ -75,6 +76,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHarmonicFunction(pugi::xml_node element);
+    bool ReadHarmonicFunction(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHarmonicFunction(pugi::xml_node element);
@@ -118,6 +120,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadIntervalHarmonic(pugi::xml_node element);
+    bool ReadIntervalHarmonic(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteIntervalHarmonic(pugi::xml_node element);
@@ -154,6 +157,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadIntervalMelodic(pugi::xml_node element);
+    bool ReadIntervalMelodic(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteIntervalMelodic(pugi::xml_node element);
@@ -195,6 +199,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadKeySigAnl(pugi::xml_node element);
+    bool ReadKeySigAnl(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigAnl(pugi::xml_node element);
@@ -231,6 +236,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadKeySigDefaultAnl(pugi::xml_node element);
+    bool ReadKeySigDefaultAnl(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultAnl(pugi::xml_node element);
@@ -285,6 +291,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMelodicFunction(pugi::xml_node element);
+    bool ReadMelodicFunction(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMelodicFunction(pugi::xml_node element);
@@ -321,6 +328,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPitchClass(pugi::xml_node element);
+    bool ReadPitchClass(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePitchClass(pugi::xml_node element);
@@ -357,6 +365,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSolfa(pugi::xml_node element);
+    bool ReadSolfa(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSolfa(pugi::xml_node element);
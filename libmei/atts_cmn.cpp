@@ -46,10 +46,20 @@ void AttArpegLog::ResetArpegLog()
 
 bool AttArpegLog::ReadArpegLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadArpegLog(reader);
+}
+
+bool AttArpegLog::ReadArpegLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ARPEGLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        element.remove_attribute("order");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ARPEGLOG)) {
+            case 0: this->SetOrder(StrToArpegLogOrder(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -92,10 +102,20 @@ void AttBTremLog::ResetBTremLog()
 
 bool AttBTremLog::ReadBTremLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBTremLog(reader);
+}
+
+bool AttBTremLog::ReadBTremLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BTREMLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BTREMLOG)) {
+            case 0: this->SetForm(StrToBTremLogForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,10 +158,20 @@ void AttBeamPresent::ResetBeamPresent()
 
 bool AttBeamPresent::ReadBeamPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeamPresent(reader);
+}
+
+bool AttBeamPresent::ReadBeamPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEAMPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        element.remove_attribute("beam");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEAMPRESENT)) {
+            case 0: this->SetBeam(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -187,25 +217,23 @@ void AttBeamRend::ResetBeamRend()
 
 bool AttBeamRend::ReadBeamRend(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeamRend(reader);
+}
+
+bool AttBeamRend::ReadBeamRend(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEAMREND)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamRendForm(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToBeamplace(element.attribute("place").value()));
-        element.remove_attribute("place");
-        hasAttribute = true;
-    }
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBoolean(element.attribute("slash").value()));
-        element.remove_attribute("slash");
-        hasAttribute = true;
-    }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        element.remove_attribute("slope");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEAMREND)) {
+            case 0: this->SetForm(StrToBeamRendForm(reader.GetValue(i))); break;
+            case 1: this->SetPlace(StrToBeamplace(reader.GetValue(i))); break;
+            case 2: this->SetSlash(StrToBoolean(reader.GetValue(i))); break;
+            case 3: this->SetSlope(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -275,10 +303,20 @@ void AttBeamSecondary::ResetBeamSecondary()
 
 bool AttBeamSecondary::ReadBeamSecondary(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeamSecondary(reader);
+}
+
+bool AttBeamSecondary::ReadBeamSecondary(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEAMSECONDARY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        element.remove_attribute("breaksec");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEAMSECONDARY)) {
+            case 0: this->SetBreaksec(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -321,10 +359,20 @@ void AttBeamedWith::ResetBeamedWith()
 
 bool AttBeamedWith::ReadBeamedWith(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeamedWith(reader);
+}
+
+bool AttBeamedWith::ReadBeamedWith(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEAMEDWITH)) return false;
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToOtherstaff(element.attribute("beam.with").value()));
-        element.remove_attribute("beam.with");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEAMEDWITH)) {
+            case 0: this->SetBeamWith(StrToOtherstaff(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -368,15 +416,21 @@ void AttBeamingLog::ResetBeamingLog()
 
 bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeamingLog(reader);
+}
+
+bool AttBeamingLog::ReadBeamingLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEAMINGLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        element.remove_attribute("beam.group");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        element.remove_attribute("beam.rests");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEAMINGLOG)) {
+            case 0: this->SetBeamGroup(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetBeamRests(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -428,10 +482,20 @@ void AttBeatRptLog::ResetBeatRptLog()
 
 bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeatRptLog(reader);
+}
+
+bool AttBeatRptLog::ReadBeatRptLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEATRPTLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("beatdef")) {
-        this->SetBeatdef(StrToDbl(element.attribute("beatdef").value()));
-        element.remove_attribute("beatdef");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEATRPTLOG)) {
+            case 0: this->SetBeatdef(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -474,10 +538,20 @@ void AttBracketSpanLog::ResetBracketSpanLog()
 
 bool AttBracketSpanLog::ReadBracketSpanLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBracketSpanLog(reader);
+}
+
+bool AttBracketSpanLog::ReadBracketSpanLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BRACKETSPANLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BRACKETSPANLOG)) {
+            case 0: this->SetFunc(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -520,10 +594,20 @@ void AttCutout::ResetCutout()
 
 bool AttCutout::ReadCutout(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCutout(reader);
+}
+
+bool AttCutout::ReadCutout(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CUTOUT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        element.remove_attribute("cutout");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CUTOUT)) {
+            case 0: this->SetCutout(StrToCutoutCutout(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -566,10 +650,20 @@ void AttExpandable::ResetExpandable()
 
 bool AttExpandable::ReadExpandable(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadExpandable(reader);
+}
+
+bool AttExpandable::ReadExpandable(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_EXPANDABLE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        element.remove_attribute("expand");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_EXPANDABLE)) {
+            case 0: this->SetExpand(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -612,10 +706,20 @@ void AttFTremLog::ResetFTremLog()
 
 bool AttFTremLog::ReadFTremLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFTremLog(reader);
+}
+
+bool AttFTremLog::ReadFTremLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FTREMLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FTREMLOG)) {
+            case 0: this->SetForm(StrToFTremLogForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -658,10 +762,20 @@ void AttGlissPresent::ResetGlissPresent()
 
 bool AttGlissPresent::ReadGlissPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadGlissPresent(reader);
+}
+
+bool AttGlissPresent::ReadGlissPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_GLISSPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        element.remove_attribute("gliss");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_GLISSPRESENT)) {
+            case 0: this->SetGliss(StrToGlissando(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -704,10 +818,20 @@ void AttGraceGrpLog::ResetGraceGrpLog()
 
 bool AttGraceGrpLog::ReadGraceGrpLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadGraceGrpLog(reader);
+}
+
+bool AttGraceGrpLog::ReadGraceGrpLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_GRACEGRPLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("attach")) {
-        this->SetAttach(StrToGraceGrpLogAttach(element.attribute("attach").value()));
-        element.remove_attribute("attach");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_GRACEGRPLOG)) {
+            case 0: this->SetAttach(StrToGraceGrpLogAttach(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -751,15 +875,21 @@ void AttGraced::ResetGraced()
 
 bool AttGraced::ReadGraced(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadGraced(reader);
+}
+
+bool AttGraced::ReadGraced(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_GRACED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        element.remove_attribute("grace");
-        hasAttribute = true;
-    }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        element.remove_attribute("grace.time");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_GRACED)) {
+            case 0: this->SetGrace(StrToGrace(reader.GetValue(i))); break;
+            case 1: this->SetGraceTime(StrToPercent(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -812,15 +942,21 @@ void AttHairpinLog::ResetHairpinLog()
 
 bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHairpinLog(reader);
+}
+
+bool AttHairpinLog::ReadHairpinLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HAIRPINLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        element.remove_attribute("niente");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HAIRPINLOG)) {
+            case 0: this->SetForm(StrToHairpinLogForm(reader.GetValue(i))); break;
+            case 1: this->SetNiente(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -878,40 +1014,26 @@ void AttHarpPedalLog::ResetHarpPedalLog()
 
 bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHarpPedalLog(reader);
+}
+
+bool AttHarpPedalLog::ReadHarpPedalLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HARPPEDALLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarpPedalLogC(element.attribute("c").value()));
-        element.remove_attribute("c");
-        hasAttribute = true;
-    }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarpPedalLogD(element.attribute("d").value()));
-        element.remove_attribute("d");
-        hasAttribute = true;
-    }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarpPedalLogE(element.attribute("e").value()));
-        element.remove_attribute("e");
-        hasAttribute = true;
-    }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarpPedalLogF(element.attribute("f").value()));
-        element.remove_attribute("f");
-        hasAttribute = true;
-    }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarpPedalLogG(element.attribute("g").value()));
-        element.remove_attribute("g");
-        hasAttribute = true;
-    }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarpPedalLogA(element.attribute("a").value()));
-        element.remove_attribute("a");
-        hasAttribute = true;
-    }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarpPedalLogB(element.attribute("b").value()));
-        element.remove_attribute("b");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HARPPEDALLOG)) {
+            case 0: this->SetC(StrToHarpPedalLogC(reader.GetValue(i))); break;
+            case 1: this->SetD(StrToHarpPedalLogD(reader.GetValue(i))); break;
+            case 2: this->SetE(StrToHarpPedalLogE(reader.GetValue(i))); break;
+            case 3: this->SetF(StrToHarpPedalLogF(reader.GetValue(i))); break;
+            case 4: this->SetG(StrToHarpPedalLogG(reader.GetValue(i))); break;
+            case 5: this->SetA(StrToHarpPedalLogA(reader.GetValue(i))); break;
+            case 6: this->SetB(StrToHarpPedalLogB(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1008,10 +1130,20 @@ void AttLvPresent::ResetLvPresent()
 
 bool AttLvPresent::ReadLvPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLvPresent(reader);
+}
+
+bool AttLvPresent::ReadLvPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LVPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        element.remove_attribute("lv");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LVPRESENT)) {
+            case 0: this->SetLv(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1055,15 +1187,21 @@ void AttMeasureLog::ResetMeasureLog()
 
 bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeasureLog(reader);
+}
+
+bool AttMeasureLog::ReadMeasureLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MEASURELOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        element.remove_attribute("left");
-        hasAttribute = true;
-    }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        element.remove_attribute("right");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MEASURELOG)) {
+            case 0: this->SetLeft(StrToBarrendition(reader.GetValue(i))); break;
+            case 1: this->SetRight(StrToBarrendition(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1115,10 +1253,20 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
 
 bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterSigGrpLog(reader);
+}
+
+bool AttMeterSigGrpLog::ReadMeterSigGrpLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERSIGGRPLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERSIGGRPLOG)) {
+            case 0: this->SetFunc(StrToMeterSigGrpLogFunc(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1162,15 +1310,21 @@ void AttNumberPlacement::ResetNumberPlacement()
 
 bool AttNumberPlacement::ReadNumberPlacement(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNumberPlacement(reader);
+}
+
+bool AttNumberPlacement::ReadNumberPlacement(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NUMBERPLACEMENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToStaffrelBasic(element.attribute("num.place").value()));
-        element.remove_attribute("num.place");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        element.remove_attribute("num.visible");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NUMBERPLACEMENT)) {
+            case 0: this->SetNumPlace(StrToStaffrelBasic(reader.GetValue(i))); break;
+            case 1: this->SetNumVisible(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1222,10 +1376,20 @@ void AttNumbered::ResetNumbered()
 
 bool AttNumbered::ReadNumbered(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNumbered(reader);
+}
+
+bool AttNumbered::ReadNumbered(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NUMBERED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NUMBERED)) {
+            case 0: this->SetNum(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1268,10 +1432,20 @@ void AttOctaveLog::ResetOctaveLog()
 
 bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOctaveLog(reader);
+}
+
+bool AttOctaveLog::ReadOctaveLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_OCTAVELOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        element.remove_attribute("coll");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_OCTAVELOG)) {
+            case 0: this->SetColl(StrToOctaveLogColl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1315,15 +1489,21 @@ void AttPedalLog::ResetPedalLog()
 
 bool AttPedalLog::ReadPedalLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPedalLog(reader);
+}
+
+bool AttPedalLog::ReadPedalLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PEDALLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        element.remove_attribute("dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PEDALLOG)) {
+            case 0: this->SetDir(StrToPedalLogDir(reader.GetValue(i))); break;
+            case 1: this->SetFunc(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1375,10 +1555,20 @@ void AttPianoPedals::ResetPianoPedals()
 
 bool AttPianoPedals::ReadPianoPedals(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPianoPedals(reader);
+}
+
+bool AttPianoPedals::ReadPianoPedals(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PIANOPEDALS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPianoPedalsPedalstyle(element.attribute("pedal.style").value()));
-        element.remove_attribute("pedal.style");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PIANOPEDALS)) {
+            case 0: this->SetPedalStyle(StrToPianoPedalsPedalstyle(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1421,10 +1611,20 @@ void AttRehearsal::ResetRehearsal()
 
 bool AttRehearsal::ReadRehearsal(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadRehearsal(reader);
+}
+
+bool AttRehearsal::ReadRehearsal(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_REHEARSAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        element.remove_attribute("reh.enclose");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_REHEARSAL)) {
+            case 0: this->SetRehEnclose(StrToRehearsalRehenclose(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1467,10 +1667,20 @@ void AttScoreDefVisCmn::ResetScoreDefVisCmn()
 
 bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadScoreDefVisCmn(reader);
+}
+
+bool AttScoreDefVisCmn::ReadScoreDefVisCmn(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SCOREDEFVISCMN)) return false;
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SCOREDEFVISCMN)) {
+            case 0: this->SetGridShow(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1514,15 +1724,21 @@ void AttSlurRend::ResetSlurRend()
 
 bool AttSlurRend::ReadSlurRend(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSlurRend(reader);
+}
+
+bool AttSlurRend::ReadSlurRend(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SLURREND)) return false;
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        element.remove_attribute("slur.lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToLinewidth(element.attribute("slur.lwidth").value()));
-        element.remove_attribute("slur.lwidth");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SLURREND)) {
+            case 0: this->SetSlurLform(StrToLineform(reader.GetValue(i))); break;
+            case 1: this->SetSlurLwidth(StrToLinewidth(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1574,10 +1790,20 @@ void AttStemsCmn::ResetStemsCmn()
 
 bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStemsCmn(reader);
+}
+
+bool AttStemsCmn::ReadStemsCmn(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STEMSCMN)) return false;
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToOtherstaff(element.attribute("stem.with").value()));
-        element.remove_attribute("stem.with");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STEMSCMN)) {
+            case 0: this->SetStemWith(StrToOtherstaff(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1621,15 +1847,21 @@ void AttTieRend::ResetTieRend()
 
 bool AttTieRend::ReadTieRend(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTieRend(reader);
+}
+
+bool AttTieRend::ReadTieRend(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIEREND)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        element.remove_attribute("tie.lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToLinewidth(element.attribute("tie.lwidth").value()));
-        element.remove_attribute("tie.lwidth");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIEREND)) {
+            case 0: this->SetTieLform(StrToLineform(reader.GetValue(i))); break;
+            case 1: this->SetTieLwidth(StrToLinewidth(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1681,10 +1913,20 @@ void AttTremMeasured::ResetTremMeasured()
 
 bool AttTremMeasured::ReadTremMeasured(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTremMeasured(reader);
+}
+
+bool AttTremMeasured::ReadTremMeasured(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TREMMEASURED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("unitdur")) {
-        this->SetUnitdur(StrToDuration(element.attribute("unitdur").value()));
-        element.remove_attribute("unitdur");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TREMMEASURED)) {
+            case 0: this->SetUnitdur(StrToDuration(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadArpegLog(pugi::xml_node element);
+    bool ReadArpegLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteArpegLog(pugi::xml_node element);
@@ -75,6 +76,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBTremLog(pugi::xml_node element);
+    bool ReadBTremLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBTremLog(pugi::xml_node element);
@@ -111,6 +113,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeamPresent(pugi::xml_node element);
+    bool ReadBeamPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeamPresent(pugi::xml_node element);
@@ -147,6 +150,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeamRend(pugi::xml_node element);
+    bool ReadBeamRend(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeamRend(pugi::xml_node element);
@@ -201,6 +205,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeamSecondary(pugi::xml_node element);
+    bool ReadBeamSecondary(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeamSecondary(pugi::xml_node element);
@@ -242,6 +247,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeamedWith(pugi::xml_node element);
+    bool ReadBeamedWith(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeamedWith(pugi::xml_node element);
@@ -282,6 +288,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeamingLog(pugi::xml_node element);
+    bool ReadBeamingLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeamingLog(pugi::xml_node element);
@@ -330,6 +337,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeatRptLog(pugi::xml_node element);
+    bool ReadBeatRptLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeatRptLog(pugi::xml_node element);
@@ -369,6 +377,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBracketSpanLog(pugi::xml_node element);
+    bool ReadBracketSpanLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBracketSpanLog(pugi::xml_node element);
@@ -405,6 +414,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCutout(pugi::xml_node element);
+    bool ReadCutout(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCutout(pugi::xml_node element);
@@ -441,6 +451,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadExpandable(pugi::xml_node element);
+    bool ReadExpandable(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteExpandable(pugi::xml_node element);
@@ -482,6 +493,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFTremLog(pugi::xml_node element);
+    bool ReadFTremLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFTremLog(pugi::xml_node element);
@@ -518,6 +530,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadGlissPresent(pugi::xml_node element);
+    bool ReadGlissPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteGlissPresent(pugi::xml_node element);
@@ -557,6 +570,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadGraceGrpLog(pugi::xml_node element);
+    bool ReadGraceGrpLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteGraceGrpLog(pugi::xml_node element);
@@ -597,6 +611,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadGraced(pugi::xml_node element);
+    bool ReadGraced(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteGraced(pugi::xml_node element);
@@ -642,6 +657,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHairpinLog(pugi::xml_node element);
+    bool ReadHairpinLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHairpinLog(pugi::xml_node element);
@@ -688,6 +704,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHarpPedalLog(pugi::xml_node element);
+    bool ReadHarpPedalLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHarpPedalLog(pugi::xml_node element);
@@ -760,6 +777,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLvPresent(pugi::xml_node element);
+    bool ReadLvPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLvPresent(pugi::xml_node element);
@@ -799,6 +817,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeasureLog(pugi::xml_node element);
+    bool ReadMeasureLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeasureLog(pugi::xml_node element);
@@ -845,6 +864,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterSigGrpLog(pugi::xml_node element);
+    bool ReadMeterSigGrpLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigGrpLog(pugi::xml_node element);
@@ -881,6 +901,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNumberPlacement(pugi::xml_node element);
+    bool ReadNumberPlacement(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNumberPlacement(pugi::xml_node element);
@@ -923,6 +944,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNumbered(pugi::xml_node element);
+    bool ReadNumbered(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNumbered(pugi::xml_node element);
@@ -959,6 +981,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOctaveLog(pugi::xml_node element);
+    bool ReadOctaveLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveLog(pugi::xml_node element);
@@ -1001,6 +1024,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPedalLog(pugi::xml_node element);
+    bool ReadPedalLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePedalLog(pugi::xml_node element);
@@ -1043,6 +1067,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPianoPedals(pugi::xml_node element);
+    bool ReadPianoPedals(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePianoPedals(pugi::xml_node element);
@@ -1079,6 +1104,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadRehearsal(pugi::xml_node element);
+    bool ReadRehearsal(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteRehearsal(pugi::xml_node element);
@@ -1115,6 +1141,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadScoreDefVisCmn(pugi::xml_node element);
+    bool ReadScoreDefVisCmn(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefVisCmn(pugi::xml_node element);
@@ -1151,6 +1178,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSlurRend(pugi::xml_node element);
+    bool ReadSlurRend(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSlurRend(pugi::xml_node element);
@@ -1195,6 +1223,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStemsCmn(pugi::xml_node element);
+    bool ReadStemsCmn(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStemsCmn(pugi::xml_node element);
@@ -1235,6 +1264,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTieRend(pugi::xml_node element);
+    bool ReadTieRend(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTieRend(pugi::xml_node element);
@@ -1279,6 +1309,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTremMeasured(pugi::xml_node element);
+    bool ReadTremMeasured(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTremMeasured(pugi::xml_node element);
@@ -47,15 +47,21 @@ void AttMordentLog::ResetMordentLog()
 
 bool AttMordentLog::ReadMordentLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMordentLog(reader);
+}
+
+bool AttMordentLog::ReadMordentLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MORDENTLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        element.remove_attribute("long");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MORDENTLOG)) {
+            case 0: this->SetForm(StrToMordentLogForm(reader.GetValue(i))); break;
+            case 1: this->SetLong(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -107,10 +113,20 @@ void AttOrnamPresent::ResetOrnamPresent()
 
 bool AttOrnamPresent::ReadOrnamPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOrnamPresent(reader);
+}
+
+bool AttOrnamPresent::ReadOrnamPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ORNAMPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        element.remove_attribute("ornam");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ORNAMPRESENT)) {
+            case 0: this->SetOrnam(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -154,15 +170,21 @@ void AttOrnamentAccid::ResetOrnamentAccid()
 
 bool AttOrnamentAccid::ReadOrnamentAccid(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOrnamentAccid(reader);
+}
+
+bool AttOrnamentAccid::ReadOrnamentAccid(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ORNAMENTACCID)) return false;
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalWritten(element.attribute("accidupper").value()));
-        element.remove_attribute("accidupper");
-        hasAttribute = true;
-    }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalWritten(element.attribute("accidlower").value()));
-        element.remove_attribute("accidlower");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ORNAMENTACCID)) {
+            case 0: this->SetAccidupper(StrToAccidentalWritten(reader.GetValue(i))); break;
+            case 1: this->SetAccidlower(StrToAccidentalWritten(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -215,15 +237,21 @@ void AttTurnLog::ResetTurnLog()
 
 bool AttTurnLog::ReadTurnLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTurnLog(reader);
+}
+
+bool AttTurnLog::ReadTurnLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TURNLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        element.remove_attribute("delayed");
-        hasAttribute = true;
-    }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TURNLOG)) {
+            case 0: this->SetDelayed(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetForm(StrToTurnLogForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMordentLog(pugi::xml_node element);
+    bool ReadMordentLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMordentLog(pugi::xml_node element);
@@ -84,6 +85,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOrnamPresent(pugi::xml_node element);
+    bool ReadOrnamPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOrnamPresent(pugi::xml_node element);
@@ -124,6 +126,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOrnamentAccid(pugi::xml_node element);
+    bool ReadOrnamentAccid(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOrnamentAccid(pugi::xml_node element);
@@ -166,6 +169,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTurnLog(pugi::xml_node element);
+    bool ReadTurnLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTurnLog(pugi::xml_node element);
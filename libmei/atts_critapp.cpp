@@ -46,10 +46,20 @@ void AttCrit::ResetCrit()
 
 bool AttCrit::ReadCrit(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCrit(reader);
+}
+
+bool AttCrit::ReadCrit(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CRIT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        element.remove_attribute("cause");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CRIT)) {
+            case 0: this->SetCause(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCrit(pugi::xml_node element);
+    bool ReadCrit(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCrit(pugi::xml_node element);
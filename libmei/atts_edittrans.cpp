@@ -46,10 +46,20 @@ void AttAgentIdent::ResetAgentIdent()
 
 bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAgentIdent(reader);
+}
+
+bool AttAgentIdent::ReadAgentIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_AGENTIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        element.remove_attribute("agent");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_AGENTIDENT)) {
+            case 0: this->SetAgent(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -92,10 +102,20 @@ void AttReasonIdent::ResetReasonIdent()
 
 bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadReasonIdent(reader);
+}
+
+bool AttReasonIdent::ReadReasonIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_REASONIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        element.remove_attribute("reason");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_REASONIDENT)) {
+            case 0: this->SetReason(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
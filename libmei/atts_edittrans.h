@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAgentIdent(pugi::xml_node element);
+    bool ReadAgentIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAgentIdent(pugi::xml_node element);
@@ -78,6 +79,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadReasonIdent(pugi::xml_node element);
+    bool ReadReasonIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteReasonIdent(pugi::xml_node element);
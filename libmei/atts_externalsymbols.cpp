@@ -49,25 +49,23 @@ void AttExtSym::ResetExtSym()
 
 bool AttExtSym::ReadExtSym(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadExtSym(reader);
+}
+
+bool AttExtSym::ReadExtSym(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_EXTSYM)) return false;
     bool hasAttribute = false;
-    if (element.attribute("glyph.auth")) {
-        this->SetGlyphAuth(StrToStr(element.attribute("glyph.auth").value()));
-        element.remove_attribute("glyph.auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.name")) {
-        this->SetGlyphName(StrToStr(element.attribute("glyph.name").value()));
-        element.remove_attribute("glyph.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.num")) {
-        this->SetGlyphNum(StrToHexnum(element.attribute("glyph.num").value()));
-        element.remove_attribute("glyph.num");
-        hasAttribute = true;
-    }
-    if (element.attribute("glyph.uri")) {
-        this->SetGlyphUri(StrToStr(element.attribute("glyph.uri").value()));
-        element.remove_attribute("glyph.uri");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_EXTSYM)) {
+            case 0: this->SetGlyphAuth(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetGlyphName(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetGlyphNum(StrToHexnum(reader.GetValue(i))); break;
+            case 3: this->SetGlyphUri(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadExtSym(pugi::xml_node element);
+    bool ReadExtSym(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteExtSym(pugi::xml_node element);
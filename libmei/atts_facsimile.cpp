@@ -46,10 +46,20 @@ void AttFacsimile::ResetFacsimile()
 
 bool AttFacsimile::ReadFacsimile(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFacsimile(reader);
+}
+
+bool AttFacsimile::ReadFacsimile(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FACSIMILE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("facs")) {
-        this->SetFacs(StrToStr(element.attribute("facs").value()));
-        element.remove_attribute("facs");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FACSIMILE)) {
+            case 0: this->SetFacs(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
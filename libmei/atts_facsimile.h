@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFacsimile(pugi::xml_node element);
+    bool ReadFacsimile(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFacsimile(pugi::xml_node element);
@@ -47,15 +47,21 @@ void AttTabular::ResetTabular()
 
 bool AttTabular::ReadTabular(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTabular(reader);
+}
+
+bool AttTabular::ReadTabular(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TABULAR)) return false;
     bool hasAttribute = false;
-    if (element.attribute("colspan")) {
-        this->SetColspan(StrToInt(element.attribute("colspan").value()));
-        element.remove_attribute("colspan");
-        hasAttribute = true;
-    }
-    if (element.attribute("rowspan")) {
-        this->SetRowspan(StrToInt(element.attribute("rowspan").value()));
-        element.remove_attribute("rowspan");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TABULAR)) {
+            case 0: this->SetColspan(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetRowspan(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
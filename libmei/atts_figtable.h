@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTabular(pugi::xml_node element);
+    bool ReadTabular(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTabular(pugi::xml_node element);
@@ -46,10 +46,20 @@ void AttFingGrpLog::ResetFingGrpLog()
 
 bool AttFingGrpLog::ReadFingGrpLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFingGrpLog(reader);
+}
+
+bool AttFingGrpLog::ReadFingGrpLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FINGGRPLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFingGrpLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FINGGRPLOG)) {
+            case 0: this->SetForm(StrToFingGrpLogForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
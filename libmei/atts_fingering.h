@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFingGrpLog(pugi::xml_node element);
+    bool ReadFingGrpLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFingGrpLog(pugi::xml_node element);
@@ -46,10 +46,20 @@ void AttAccidentalGestural::ResetAccidentalGestural()
 
 bool AttAccidentalGestural::ReadAccidentalGestural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAccidentalGestural(reader);
+}
+
+bool AttAccidentalGestural::ReadAccidentalGestural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ACCIDENTALGESTURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalGestural(element.attribute("accid.ges").value()));
-        element.remove_attribute("accid.ges");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ACCIDENTALGESTURAL)) {
+            case 0: this->SetAccidGes(StrToAccidentalGestural(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -92,10 +102,20 @@ void AttArticulationGestural::ResetArticulationGestural()
 
 bool AttArticulationGestural::ReadArticulationGestural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadArticulationGestural(reader);
+}
+
+bool AttArticulationGestural::ReadArticulationGestural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ARTICULATIONGESTURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulation(element.attribute("artic.ges").value()));
-        element.remove_attribute("artic.ges");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ARTICULATIONGESTURAL)) {
+            case 0: this->SetArticGes(StrToArticulation(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,10 +158,20 @@ void AttBendGes::ResetBendGes()
 
 bool AttBendGes::ReadBendGes(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBendGes(reader);
+}
+
+bool AttBendGes::ReadBendGes(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BENDGES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        element.remove_attribute("amount");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BENDGES)) {
+            case 0: this->SetAmount(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -189,35 +219,25 @@ void AttDurationGestural::ResetDurationGestural()
 
 bool AttDurationGestural::ReadDurationGestural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDurationGestural(reader);
+}
+
+bool AttDurationGestural::ReadDurationGestural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DURATIONGESTURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        element.remove_attribute("dur.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("dots.ges")) {
-        this->SetDotsGes(StrToInt(element.attribute("dots.ges").value()));
-        element.remove_attribute("dots.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.metrical")) {
-        this->SetDurMetrical(StrToDbl(element.attribute("dur.metrical").value()));
-        element.remove_attribute("dur.metrical");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.ppq")) {
-        this->SetDurPpq(StrToInt(element.attribute("dur.ppq").value()));
-        element.remove_attribute("dur.ppq");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.real")) {
-        this->SetDurReal(StrToDbl(element.attribute("dur.real").value()));
-        element.remove_attribute("dur.real");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.recip")) {
-        this->SetDurRecip(StrToStr(element.attribute("dur.recip").value()));
-        element.remove_attribute("dur.recip");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DURATIONGESTURAL)) {
+            case 0: this->SetDurGes(StrToDuration(reader.GetValue(i))); break;
+            case 1: this->SetDotsGes(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetDurMetrical(StrToDbl(reader.GetValue(i))); break;
+            case 3: this->SetDurPpq(StrToInt(reader.GetValue(i))); break;
+            case 4: this->SetDurReal(StrToDbl(reader.GetValue(i))); break;
+            case 5: this->SetDurRecip(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -307,20 +327,22 @@ void AttNcGes::ResetNcGes()
 
 bool AttNcGes::ReadNcGes(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNcGes(reader);
+}
+
+bool AttNcGes::ReadNcGes(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NCGES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        element.remove_attribute("oct.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        element.remove_attribute("pname.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        element.remove_attribute("pnum");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NCGES)) {
+            case 0: this->SetOctGes(StrToOctave(reader.GetValue(i))); break;
+            case 1: this->SetPnameGes(StrToPitchname(reader.GetValue(i))); break;
+            case 2: this->SetPnum(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -384,25 +406,23 @@ void AttNoteGes::ResetNoteGes()
 
 bool AttNoteGes::ReadNoteGes(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNoteGes(reader);
+}
+
+bool AttNoteGes::ReadNoteGes(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NOTEGES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("extremis")) {
-        this->SetExtremis(StrToNoteGesExtremis(element.attribute("extremis").value()));
-        element.remove_attribute("extremis");
-        hasAttribute = true;
-    }
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        element.remove_attribute("oct.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        element.remove_attribute("pname.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        element.remove_attribute("pnum");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NOTEGES)) {
+            case 0: this->SetExtremis(StrToNoteGesExtremis(reader.GetValue(i))); break;
+            case 1: this->SetOctGes(StrToOctave(reader.GetValue(i))); break;
+            case 2: this->SetPnameGes(StrToPitchname(reader.GetValue(i))); break;
+            case 3: this->SetPnum(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -474,20 +494,22 @@ void AttScoreDefGes::ResetScoreDefGes()
 
 bool AttScoreDefGes::ReadScoreDefGes(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadScoreDefGes(reader);
+}
+
+bool AttScoreDefGes::ReadScoreDefGes(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SCOREDEFGES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        element.remove_attribute("tune.pname");
-        hasAttribute = true;
-    }
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        element.remove_attribute("tune.Hz");
-        hasAttribute = true;
-    }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        element.remove_attribute("tune.temper");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SCOREDEFGES)) {
+            case 0: this->SetTunePname(StrToPitchname(reader.GetValue(i))); break;
+            case 1: this->SetTuneHz(StrToDbl(reader.GetValue(i))); break;
+            case 2: this->SetTuneTemper(StrToTemperament(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -548,10 +570,20 @@ void AttSectionGes::ResetSectionGes()
 
 bool AttSectionGes::ReadSectionGes(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSectionGes(reader);
+}
+
+bool AttSectionGes::ReadSectionGes(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SECTIONGES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("attacca")) {
-        this->SetAttacca(StrToBoolean(element.attribute("attacca").value()));
-        element.remove_attribute("attacca");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SECTIONGES)) {
+            case 0: this->SetAttacca(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -595,15 +627,21 @@ void AttSoundLocation::ResetSoundLocation()
 
 bool AttSoundLocation::ReadSoundLocation(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSoundLocation(reader);
+}
+
+bool AttSoundLocation::ReadSoundLocation(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SOUNDLOCATION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("azimuth")) {
-        this->SetAzimuth(StrToDbl(element.attribute("azimuth").value()));
-        element.remove_attribute("azimuth");
-        hasAttribute = true;
-    }
-    if (element.attribute("elevation")) {
-        this->SetElevation(StrToDbl(element.attribute("elevation").value()));
-        element.remove_attribute("elevation");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SOUNDLOCATION)) {
+            case 0: this->SetAzimuth(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetElevation(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -656,15 +694,21 @@ void AttTimestampGestural::ResetTimestampGestural()
 
 bool AttTimestampGestural::ReadTimestampGestural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTimestampGestural(reader);
+}
+
+bool AttTimestampGestural::ReadTimestampGestural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIMESTAMPGESTURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDbl(element.attribute("tstamp.ges").value()));
-        element.remove_attribute("tstamp.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        element.remove_attribute("tstamp.real");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIMESTAMPGESTURAL)) {
+            case 0: this->SetTstampGes(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetTstampReal(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -717,15 +761,21 @@ void AttTimestamp2Gestural::ResetTimestamp2Gestural()
 
 bool AttTimestamp2Gestural::ReadTimestamp2Gestural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTimestamp2Gestural(reader);
+}
+
+bool AttTimestamp2Gestural::ReadTimestamp2Gestural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIMESTAMP2GESTURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tstamp2.ges")) {
-        this->SetTstamp2Ges(StrToMeasurebeat(element.attribute("tstamp2.ges").value()));
-        element.remove_attribute("tstamp2.ges");
-        hasAttribute = true;
-    }
-    if (element.attribute("tstamp2.real")) {
-        this->SetTstamp2Real(StrToStr(element.attribute("tstamp2.real").value()));
-        element.remove_attribute("tstamp2.real");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIMESTAMP2GESTURAL)) {
+            case 0: this->SetTstamp2Ges(StrToMeasurebeat(reader.GetValue(i))); break;
+            case 1: this->SetTstamp2Real(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAccidentalGestural(pugi::xml_node element);
+    bool ReadAccidentalGestural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAccidentalGestural(pugi::xml_node element);
@@ -75,6 +76,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadArticulationGestural(pugi::xml_node element);
+    bool ReadArticulationGestural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteArticulationGestural(pugi::xml_node element);
@@ -111,6 +113,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBendGes(pugi::xml_node element);
+    bool ReadBendGes(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBendGes(pugi::xml_node element);
@@ -151,6 +154,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDurationGestural(pugi::xml_node element);
+    bool ReadDurationGestural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDurationGestural(pugi::xml_node element);
@@ -226,6 +230,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNcGes(pugi::xml_node element);
+    bool ReadNcGes(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNcGes(pugi::xml_node element);
@@ -274,6 +279,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNoteGes(pugi::xml_node element);
+    bool ReadNoteGes(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNoteGes(pugi::xml_node element);
@@ -328,6 +334,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadScoreDefGes(pugi::xml_node element);
+    bool ReadScoreDefGes(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefGes(pugi::xml_node element);
@@ -376,6 +383,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSectionGes(pugi::xml_node element);
+    bool ReadSectionGes(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSectionGes(pugi::xml_node element);
@@ -415,6 +423,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSoundLocation(pugi::xml_node element);
+    bool ReadSoundLocation(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSoundLocation(pugi::xml_node element);
@@ -457,6 +466,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTimestampGestural(pugi::xml_node element);
+    bool ReadTimestampGestural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTimestampGestural(pugi::xml_node element);
@@ -502,6 +512,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTimestamp2Gestural(pugi::xml_node element);
+    bool ReadTimestamp2Gestural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Gestural(pugi::xml_node element);
@@ -46,10 +46,20 @@ void AttHarmLog::ResetHarmLog()
 
 bool AttHarmLog::ReadHarmLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHarmLog(reader);
+}
+
+bool AttHarmLog::ReadHarmLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HARMLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("chordref")) {
-        this->SetChordref(StrToStr(element.attribute("chordref").value()));
-        element.remove_attribute("chordref");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HARMLOG)) {
+            case 0: this->SetChordref(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
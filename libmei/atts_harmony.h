@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHarmLog(pugi::xml_node element);
+    bool ReadHarmLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHarmLog(pugi::xml_node element);
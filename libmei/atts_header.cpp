@@ -49,25 +49,23 @@ void AttBifoliumSurfaces::ResetBifoliumSurfaces()
 
 bool AttBifoliumSurfaces::ReadBifoliumSurfaces(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBifoliumSurfaces(reader);
+}
+
+bool AttBifoliumSurfaces::ReadBifoliumSurfaces(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BIFOLIUMSURFACES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("outer.recto")) {
-        this->SetOuterRecto(StrToStr(element.attribute("outer.recto").value()));
-        element.remove_attribute("outer.recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("inner.verso")) {
-        this->SetInnerVerso(StrToStr(element.attribute("inner.verso").value()));
-        element.remove_attribute("inner.verso");
-        hasAttribute = true;
-    }
-    if (element.attribute("inner.recto")) {
-        this->SetInnerRecto(StrToStr(element.attribute("inner.recto").value()));
-        element.remove_attribute("inner.recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("outer.verso")) {
-        this->SetOuterVerso(StrToStr(element.attribute("outer.verso").value()));
-        element.remove_attribute("outer.verso");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BIFOLIUMSURFACES)) {
+            case 0: this->SetOuterRecto(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetInnerVerso(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetInnerRecto(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetOuterVerso(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,15 +136,21 @@ void AttFoliumSurfaces::ResetFoliumSurfaces()
 
 bool AttFoliumSurfaces::ReadFoliumSurfaces(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFoliumSurfaces(reader);
+}
+
+bool AttFoliumSurfaces::ReadFoliumSurfaces(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FOLIUMSURFACES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("recto")) {
-        this->SetRecto(StrToStr(element.attribute("recto").value()));
-        element.remove_attribute("recto");
-        hasAttribute = true;
-    }
-    if (element.attribute("verso")) {
-        this->SetVerso(StrToStr(element.attribute("verso").value()));
-        element.remove_attribute("verso");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FOLIUMSURFACES)) {
+            case 0: this->SetRecto(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetVerso(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -198,10 +202,20 @@ void AttRecordType::ResetRecordType()
 
 bool AttRecordType::ReadRecordType(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadRecordType(reader);
+}
+
+bool AttRecordType::ReadRecordType(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_RECORDTYPE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("recordtype")) {
-        this->SetRecordtype(StrToRecordTypeRecordtype(element.attribute("recordtype").value()));
-        element.remove_attribute("recordtype");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_RECORDTYPE)) {
+            case 0: this->SetRecordtype(StrToRecordTypeRecordtype(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -244,10 +258,20 @@ void AttRegularMethod::ResetRegularMethod()
 
 bool AttRegularMethod::ReadRegularMethod(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadRegularMethod(reader);
+}
+
+bool AttRegularMethod::ReadRegularMethod(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_REGULARMETHOD)) return false;
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularMethodMethod(element.attribute("method").value()));
-        element.remove_attribute("method");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_REGULARMETHOD)) {
+            case 0: this->SetMethod(StrToRegularMethodMethod(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
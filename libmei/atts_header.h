@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBifoliumSurfaces(pugi::xml_node element);
+    bool ReadBifoliumSurfaces(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBifoliumSurfaces(pugi::xml_node element);
@@ -93,6 +94,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFoliumSurfaces(pugi::xml_node element);
+    bool ReadFoliumSurfaces(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFoliumSurfaces(pugi::xml_node element);
@@ -135,6 +137,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadRecordType(pugi::xml_node element);
+    bool ReadRecordType(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteRecordType(pugi::xml_node element);
@@ -171,6 +174,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadRegularMethod(pugi::xml_node element);
+    bool ReadRegularMethod(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteRegularMethod(pugi::xml_node element);
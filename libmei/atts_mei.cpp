@@ -47,15 +47,21 @@ void AttNotationType::ResetNotationType()
 
 bool AttNotationType::ReadNotationType(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNotationType(reader);
+}
+
+bool AttNotationType::ReadNotationType(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NOTATIONTYPE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        element.remove_attribute("notationtype");
-        hasAttribute = true;
-    }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        element.remove_attribute("notationsubtype");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NOTATIONTYPE)) {
+            case 0: this->SetNotationtype(StrToNotationtype(reader.GetValue(i))); break;
+            case 1: this->SetNotationsubtype(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNotationType(pugi::xml_node element);
+    bool ReadNotationType(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNotationType(pugi::xml_node element);
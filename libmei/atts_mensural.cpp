@@ -46,10 +46,20 @@ void AttLigatureLog::ResetLigatureLog()
 
 bool AttLigatureLog::ReadLigatureLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLigatureLog(reader);
+}
+
+bool AttLigatureLog::ReadLigatureLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LIGATURELOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LIGATURELOG)) {
+            case 0: this->SetForm(StrToLigatureform(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -96,30 +106,24 @@ void AttMensuralLog::ResetMensuralLog()
 
 bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMensuralLog(reader);
+}
+
+bool AttMensuralLog::ReadMensuralLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MENSURALLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        element.remove_attribute("mensur.dot");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        element.remove_attribute("mensur.sign");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        element.remove_attribute("mensur.slash");
-        hasAttribute = true;
-    }
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        element.remove_attribute("proport.num");
-        hasAttribute = true;
-    }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        element.remove_attribute("proport.numbase");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MENSURALLOG)) {
+            case 0: this->SetMensurDot(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetMensurSign(StrToMensurationsign(reader.GetValue(i))); break;
+            case 2: this->SetMensurSlash(StrToInt(reader.GetValue(i))); break;
+            case 3: this->SetProportNum(StrToInt(reader.GetValue(i))); break;
+            case 4: this->SetProportNumbase(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -201,25 +205,23 @@ void AttMensuralShared::ResetMensuralShared()
 
 bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMensuralShared(reader);
+}
+
+bool AttMensuralShared::ReadMensuralShared(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MENSURALSHARED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        element.remove_attribute("modusmaior");
-        hasAttribute = true;
-    }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        element.remove_attribute("modusminor");
-        hasAttribute = true;
-    }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        element.remove_attribute("prolatio");
-        hasAttribute = true;
-    }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        element.remove_attribute("tempus");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MENSURALSHARED)) {
+            case 0: this->SetModusmaior(StrToModusmaior(reader.GetValue(i))); break;
+            case 1: this->SetModusminor(StrToModusminor(reader.GetValue(i))); break;
+            case 2: this->SetProlatio(StrToProlatio(reader.GetValue(i))); break;
+            case 3: this->SetTempus(StrToTempus(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -289,10 +291,20 @@ void AttNoteAnlMensural::ResetNoteAnlMensural()
 
 bool AttNoteAnlMensural::ReadNoteAnlMensural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNoteAnlMensural(reader);
+}
+
+bool AttNoteAnlMensural::ReadNoteAnlMensural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NOTEANLMENSURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToNoteAnlMensuralLig(element.attribute("lig").value()));
-        element.remove_attribute("lig");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NOTEANLMENSURAL)) {
+            case 0: this->SetLig(StrToNoteAnlMensuralLig(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -335,10 +347,20 @@ void AttRestVisMensural::ResetRestVisMensural()
 
 bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadRestVisMensural(reader);
+}
+
+bool AttRestVisMensural::ReadRestVisMensural(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_RESTVISMENSURAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        element.remove_attribute("spaces");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_RESTVISMENSURAL)) {
+            case 0: this->SetSpaces(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLigatureLog(pugi::xml_node element);
+    bool ReadLigatureLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLigatureLog(pugi::xml_node element);
@@ -75,6 +76,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMensuralLog(pugi::xml_node element);
+    bool ReadMensuralLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralLog(pugi::xml_node element);
@@ -146,6 +148,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMensuralShared(pugi::xml_node element);
+    bool ReadMensuralShared(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralShared(pugi::xml_node element);
@@ -200,6 +203,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNoteAnlMensural(pugi::xml_node element);
+    bool ReadNoteAnlMensural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNoteAnlMensural(pugi::xml_node element);
@@ -236,6 +240,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadRestVisMensural(pugi::xml_node element);
+    bool ReadRestVisMensural(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteRestVisMensural(pugi::xml_node element);
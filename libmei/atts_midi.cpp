@@ -49,25 +49,23 @@ void AttChannelized::ResetChannelized()
 
 bool AttChannelized::ReadChannelized(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadChannelized(reader);
+}
+
+bool AttChannelized::ReadChannelized(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CHANNELIZED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        element.remove_attribute("midi.channel");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercentLimited(element.attribute("midi.duty").value()));
-        element.remove_attribute("midi.duty");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalueName(element.attribute("midi.port").value()));
-        element.remove_attribute("midi.port");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        element.remove_attribute("midi.track");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CHANNELIZED)) {
+            case 0: this->SetMidiChannel(StrToMidichannel(reader.GetValue(i))); break;
+            case 1: this->SetMidiDuty(StrToPercentLimited(reader.GetValue(i))); break;
+            case 2: this->SetMidiPort(StrToMidivalueName(reader.GetValue(i))); break;
+            case 3: this->SetMidiTrack(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -137,10 +135,20 @@ void AttInstrumentIdent::ResetInstrumentIdent()
 
 bool AttInstrumentIdent::ReadInstrumentIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadInstrumentIdent(reader);
+}
+
+bool AttInstrumentIdent::ReadInstrumentIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_INSTRUMENTIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        element.remove_attribute("instr");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_INSTRUMENTIDENT)) {
+            case 0: this->SetInstr(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -188,35 +196,25 @@ void AttMidiInstrument::ResetMidiInstrument()
 
 bool AttMidiInstrument::ReadMidiInstrument(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMidiInstrument(reader);
+}
+
+bool AttMidiInstrument::ReadMidiInstrument(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MIDIINSTRUMENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        element.remove_attribute("midi.instrnum");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.instrname")) {
-        this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        element.remove_attribute("midi.instrname");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivaluePan(element.attribute("midi.pan").value()));
-        element.remove_attribute("midi.pan");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.patchname")) {
-        this->SetMidiPatchname(StrToStr(element.attribute("midi.patchname").value()));
-        element.remove_attribute("midi.patchname");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.patchnum")) {
-        this->SetMidiPatchnum(StrToMidivalue(element.attribute("midi.patchnum").value()));
-        element.remove_attribute("midi.patchnum");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToPercent(element.attribute("midi.volume").value()));
-        element.remove_attribute("midi.volume");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MIDIINSTRUMENT)) {
+            case 0: this->SetMidiInstrnum(StrToMidivalue(reader.GetValue(i))); break;
+            case 1: this->SetMidiInstrname(StrToMidinames(reader.GetValue(i))); break;
+            case 2: this->SetMidiPan(StrToMidivaluePan(reader.GetValue(i))); break;
+            case 3: this->SetMidiPatchname(StrToStr(reader.GetValue(i))); break;
+            case 4: this->SetMidiPatchnum(StrToMidivalue(reader.GetValue(i))); break;
+            case 5: this->SetMidiVolume(StrToPercent(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -304,10 +302,20 @@ void AttMidiNumber::ResetMidiNumber()
 
 bool AttMidiNumber::ReadMidiNumber(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMidiNumber(reader);
+}
+
+bool AttMidiNumber::ReadMidiNumber(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MIDINUMBER)) return false;
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MIDINUMBER)) {
+            case 0: this->SetNum(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -351,15 +359,21 @@ void AttMidiTempo::ResetMidiTempo()
 
 bool AttMidiTempo::ReadMidiTempo(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMidiTempo(reader);
+}
+
+bool AttMidiTempo::ReadMidiTempo(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MIDITEMPO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToMidibpm(element.attribute("midi.bpm").value()));
-        element.remove_attribute("midi.bpm");
-        hasAttribute = true;
-    }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        element.remove_attribute("midi.mspb");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MIDITEMPO)) {
+            case 0: this->SetMidiBpm(StrToMidibpm(reader.GetValue(i))); break;
+            case 1: this->SetMidiMspb(StrToMidimspb(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -411,10 +425,20 @@ void AttMidiValue::ResetMidiValue()
 
 bool AttMidiValue::ReadMidiValue(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMidiValue(reader);
+}
+
+bool AttMidiValue::ReadMidiValue(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MIDIVALUE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        element.remove_attribute("val");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MIDIVALUE)) {
+            case 0: this->SetVal(StrToMidivalue(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -457,10 +481,20 @@ void AttMidiValue2::ResetMidiValue2()
 
 bool AttMidiValue2::ReadMidiValue2(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMidiValue2(reader);
+}
+
+bool AttMidiValue2::ReadMidiValue2(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MIDIVALUE2)) return false;
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        element.remove_attribute("val2");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MIDIVALUE2)) {
+            case 0: this->SetVal2(StrToMidivalue(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -503,10 +537,20 @@ void AttMidiVelocity::ResetMidiVelocity()
 
 bool AttMidiVelocity::ReadMidiVelocity(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMidiVelocity(reader);
+}
+
+bool AttMidiVelocity::ReadMidiVelocity(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MIDIVELOCITY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        element.remove_attribute("vel");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MIDIVELOCITY)) {
+            case 0: this->SetVel(StrToMidivalue(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -549,10 +593,20 @@ void AttTimeBase::ResetTimeBase()
 
 bool AttTimeBase::ReadTimeBase(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTimeBase(reader);
+}
+
+bool AttTimeBase::ReadTimeBase(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIMEBASE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        element.remove_attribute("ppq");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIMEBASE)) {
+            case 0: this->SetPpq(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
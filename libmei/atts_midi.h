@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadChannelized(pugi::xml_node element);
+    bool ReadChannelized(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteChannelized(pugi::xml_node element);
@@ -93,6 +94,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadInstrumentIdent(pugi::xml_node element);
+    bool ReadInstrumentIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteInstrumentIdent(pugi::xml_node element);
@@ -132,6 +134,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMidiInstrument(pugi::xml_node element);
+    bool ReadMidiInstrument(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMidiInstrument(pugi::xml_node element);
@@ -207,6 +210,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMidiNumber(pugi::xml_node element);
+    bool ReadMidiNumber(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMidiNumber(pugi::xml_node element);
@@ -243,6 +247,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMidiTempo(pugi::xml_node element);
+    bool ReadMidiTempo(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMidiTempo(pugi::xml_node element);
@@ -294,6 +299,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMidiValue(pugi::xml_node element);
+    bool ReadMidiValue(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMidiValue(pugi::xml_node element);
@@ -330,6 +336,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMidiValue2(pugi::xml_node element);
+    bool ReadMidiValue2(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMidiValue2(pugi::xml_node element);
@@ -366,6 +373,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMidiVelocity(pugi::xml_node element);
+    bool ReadMidiVelocity(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMidiVelocity(pugi::xml_node element);
@@ -402,6 +410,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTimeBase(pugi::xml_node element);
+    bool ReadTimeBase(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTimeBase(pugi::xml_node element);
@@ -47,15 +47,21 @@ void AttNcLog::ResetNcLog()
 
 bool AttNcLog::ReadNcLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNcLog(reader);
+}
+
+bool AttNcLog::ReadNcLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NCLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToStr(element.attribute("oct").value()));
-        element.remove_attribute("oct");
-        hasAttribute = true;
-    }
-    if (element.attribute("pname")) {
-        this->SetPname(StrToStr(element.attribute("pname").value()));
-        element.remove_attribute("pname");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NCLOG)) {
+            case 0: this->SetOct(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetPname(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -114,45 +120,27 @@ void AttNcForm::ResetNcForm()
 
 bool AttNcForm::ReadNcForm(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNcForm(reader);
+}
+
+bool AttNcForm::ReadNcForm(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NCFORM)) return false;
     bool hasAttribute = false;
-    if (element.attribute("angled")) {
-        this->SetAngled(StrToBoolean(element.attribute("angled").value()));
-        element.remove_attribute("angled");
-        hasAttribute = true;
-    }
-    if (element.attribute("con")) {
-        this->SetCon(StrToNcFormCon(element.attribute("con").value()));
-        element.remove_attribute("con");
-        hasAttribute = true;
-    }
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToNcFormCurve(element.attribute("curve").value()));
-        element.remove_attribute("curve");
-        hasAttribute = true;
-    }
-    if (element.attribute("hooked")) {
-        this->SetHooked(StrToBoolean(element.attribute("hooked").value()));
-        element.remove_attribute("hooked");
-        hasAttribute = true;
-    }
-    if (element.attribute("ligated")) {
-        this->SetLigated(StrToBoolean(element.attribute("ligated").value()));
-        element.remove_attribute("ligated");
-        hasAttribute = true;
-    }
-    if (element.attribute("rellen")) {
-        this->SetRellen(StrToNcFormRellen(element.attribute("rellen").value()));
-        element.remove_attribute("rellen");
-        hasAttribute = true;
-    }
-    if (element.attribute("sShape")) {
-        this->SetSShape(StrToStr(element.attribute("sShape").value()));
-        element.remove_attribute("sShape");
-        hasAttribute = true;
-    }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        element.remove_attribute("tilt");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NCFORM)) {
+            case 0: this->SetAngled(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetCon(StrToNcFormCon(reader.GetValue(i))); break;
+            case 2: this->SetCurve(StrToNcFormCurve(reader.GetValue(i))); break;
+            case 3: this->SetHooked(StrToBoolean(reader.GetValue(i))); break;
+            case 4: this->SetLigated(StrToBoolean(reader.GetValue(i))); break;
+            case 5: this->SetRellen(StrToNcFormRellen(reader.GetValue(i))); break;
+            case 6: this->SetSShape(StrToStr(reader.GetValue(i))); break;
+            case 7: this->SetTilt(StrToCompassdirection(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
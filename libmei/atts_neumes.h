@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNcLog(pugi::xml_node element);
+    bool ReadNcLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNcLog(pugi::xml_node element);
@@ -81,6 +82,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNcForm(pugi::xml_node element);
+    bool ReadNcForm(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNcForm(pugi::xml_node element);
@@ -46,10 +46,20 @@ void AttSurface::ResetSurface()
 
 bool AttSurface::ReadSurface(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSurface(reader);
+}
+
+bool AttSurface::ReadSurface(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SURFACE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("surface")) {
-        this->SetSurface(StrToStr(element.attribute("surface").value()));
-        element.remove_attribute("surface");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SURFACE)) {
+            case 0: this->SetSurface(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
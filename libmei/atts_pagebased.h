@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSurface(pugi::xml_node element);
+    bool ReadSurface(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSurface(pugi::xml_node element);
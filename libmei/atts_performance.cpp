@@ -46,10 +46,20 @@ void AttAlignment::ResetAlignment()
 
 bool AttAlignment::ReadAlignment(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAlignment(reader);
+}
+
+bool AttAlignment::ReadAlignment(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ALIGNMENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("when")) {
-        this->SetWhen(StrToStr(element.attribute("when").value()));
-        element.remove_attribute("when");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ALIGNMENT)) {
+            case 0: this->SetWhen(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
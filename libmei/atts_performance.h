@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAlignment(pugi::xml_node element);
+    bool ReadAlignment(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAlignment(pugi::xml_node element);
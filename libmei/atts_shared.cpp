@@ -46,10 +46,20 @@ void AttAccidLog::ResetAccidLog()
 
 bool AttAccidLog::ReadAccidLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAccidLog(reader);
+}
+
+bool AttAccidLog::ReadAccidLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ACCIDLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ACCIDLOG)) {
+            case 0: this->SetFunc(StrToAccidLogFunc(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -92,10 +102,20 @@ void AttAccidental::ResetAccidental()
 
 bool AttAccidental::ReadAccidental(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAccidental(reader);
+}
+
+bool AttAccidental::ReadAccidental(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ACCIDENTAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalWritten(element.attribute("accid").value()));
-        element.remove_attribute("accid");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ACCIDENTAL)) {
+            case 0: this->SetAccid(StrToAccidentalWritten(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,10 +158,20 @@ void AttArticulation::ResetArticulation()
 
 bool AttArticulation::ReadArticulation(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadArticulation(reader);
+}
+
+bool AttArticulation::ReadArticulation(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ARTICULATION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        element.remove_attribute("artic");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ARTICULATION)) {
+            case 0: this->SetArtic(StrToArticulationList(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -184,10 +214,20 @@ void AttAttaccaLog::ResetAttaccaLog()
 
 bool AttAttaccaLog::ReadAttaccaLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAttaccaLog(reader);
+}
+
+bool AttAttaccaLog::ReadAttaccaLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ATTACCALOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        element.remove_attribute("target");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ATTACCALOG)) {
+            case 0: this->SetTarget(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -230,10 +270,20 @@ void AttAudience::ResetAudience()
 
 bool AttAudience::ReadAudience(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAudience(reader);
+}
+
+bool AttAudience::ReadAudience(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_AUDIENCE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("audience")) {
-        this->SetAudience(StrToAudienceAudience(element.attribute("audience").value()));
-        element.remove_attribute("audience");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_AUDIENCE)) {
+            case 0: this->SetAudience(StrToAudienceAudience(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -276,10 +326,20 @@ void AttAugmentDots::ResetAugmentDots()
 
 bool AttAugmentDots::ReadAugmentDots(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAugmentDots(reader);
+}
+
+bool AttAugmentDots::ReadAugmentDots(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_AUGMENTDOTS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        element.remove_attribute("dots");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_AUGMENTDOTS)) {
+            case 0: this->SetDots(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -323,15 +383,21 @@ void AttAuthorized::ResetAuthorized()
 
 bool AttAuthorized::ReadAuthorized(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAuthorized(reader);
+}
+
+bool AttAuthorized::ReadAuthorized(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_AUTHORIZED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("auth")) {
-        this->SetAuth(StrToStr(element.attribute("auth").value()));
-        element.remove_attribute("auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("auth.uri")) {
-        this->SetAuthUri(StrToStr(element.attribute("auth.uri").value()));
-        element.remove_attribute("auth.uri");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_AUTHORIZED)) {
+            case 0: this->SetAuth(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetAuthUri(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -383,10 +449,20 @@ void AttBarLineLog::ResetBarLineLog()
 
 bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBarLineLog(reader);
+}
+
+bool AttBarLineLog::ReadBarLineLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BARLINELOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BARLINELOG)) {
+            case 0: this->SetForm(StrToBarrendition(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -431,20 +507,22 @@ void AttBarring::ResetBarring()
 
 bool AttBarring::ReadBarring(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBarring(reader);
+}
+
+bool AttBarring::ReadBarring(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BARRING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("bar.len")) {
-        this->SetBarLen(StrToDbl(element.attribute("bar.len").value()));
-        element.remove_attribute("bar.len");
-        hasAttribute = true;
-    }
-    if (element.attribute("bar.method")) {
-        this->SetBarMethod(StrToBarmethod(element.attribute("bar.method").value()));
-        element.remove_attribute("bar.method");
-        hasAttribute = true;
-    }
-    if (element.attribute("bar.place")) {
-        this->SetBarPlace(StrToInt(element.attribute("bar.place").value()));
-        element.remove_attribute("bar.place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BARRING)) {
+            case 0: this->SetBarLen(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetBarMethod(StrToBarmethod(reader.GetValue(i))); break;
+            case 2: this->SetBarPlace(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -505,10 +583,20 @@ void AttBasic::ResetBasic()
 
 bool AttBasic::ReadBasic(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBasic(reader);
+}
+
+bool AttBasic::ReadBasic(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BASIC)) return false;
     bool hasAttribute = false;
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        element.remove_attribute("xml:base");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BASIC)) {
+            case 0: this->SetBase(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -551,10 +639,20 @@ void AttBibl::ResetBibl()
 
 bool AttBibl::ReadBibl(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBibl(reader);
+}
+
+bool AttBibl::ReadBibl(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BIBL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        element.remove_attribute("analog");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BIBL)) {
+            case 0: this->SetAnalog(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -597,10 +695,20 @@ void AttCalendared::ResetCalendared()
 
 bool AttCalendared::ReadCalendared(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCalendared(reader);
+}
+
+bool AttCalendared::ReadCalendared(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CALENDARED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        element.remove_attribute("calendar");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CALENDARED)) {
+            case 0: this->SetCalendar(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -643,10 +751,20 @@ void AttCanonical::ResetCanonical()
 
 bool AttCanonical::ReadCanonical(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCanonical(reader);
+}
+
+bool AttCanonical::ReadCanonical(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CANONICAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        element.remove_attribute("codedval");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CANONICAL)) {
+            case 0: this->SetCodedval(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -689,10 +807,20 @@ void AttClassed::ResetClassed()
 
 bool AttClassed::ReadClassed(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadClassed(reader);
+}
+
+bool AttClassed::ReadClassed(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CLASSED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("class")) {
-        this->SetClass(StrToStr(element.attribute("class").value()));
-        element.remove_attribute("class");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CLASSED)) {
+            case 0: this->SetClass(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -735,10 +863,20 @@ void AttClefLog::ResetClefLog()
 
 bool AttClefLog::ReadClefLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadClefLog(reader);
+}
+
+bool AttClefLog::ReadClefLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CLEFLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        element.remove_attribute("cautionary");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CLEFLOG)) {
+            case 0: this->SetCautionary(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -781,10 +919,20 @@ void AttClefShape::ResetClefShape()
 
 bool AttClefShape::ReadClefShape(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadClefShape(reader);
+}
+
+bool AttClefShape::ReadClefShape(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CLEFSHAPE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CLEFSHAPE)) {
+            case 0: this->SetShape(StrToClefshape(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -830,25 +978,23 @@ void AttCleffingLog::ResetCleffingLog()
 
 bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCleffingLog(reader);
+}
+
+bool AttCleffingLog::ReadCleffingLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CLEFFINGLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        element.remove_attribute("clef.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        element.remove_attribute("clef.line");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        element.remove_attribute("clef.dis");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToStaffrelBasic(element.attribute("clef.dis.place").value()));
-        element.remove_attribute("clef.dis.place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CLEFFINGLOG)) {
+            case 0: this->SetClefShape(StrToClefshape(reader.GetValue(i))); break;
+            case 1: this->SetClefLine(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetClefDis(StrToOctaveDis(reader.GetValue(i))); break;
+            case 3: this->SetClefDisPlace(StrToStaffrelBasic(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -918,10 +1064,20 @@ void AttColor::ResetColor()
 
 bool AttColor::ReadColor(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadColor(reader);
+}
+
+bool AttColor::ReadColor(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_COLOR)) return false;
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        element.remove_attribute("color");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_COLOR)) {
+            case 0: this->SetColor(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -964,10 +1120,20 @@ void AttColoration::ResetColoration()
 
 bool AttColoration::ReadColoration(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadColoration(reader);
+}
+
+bool AttColoration::ReadColoration(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_COLORATION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        element.remove_attribute("colored");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_COLORATION)) {
+            case 0: this->SetColored(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1013,25 +1179,23 @@ void AttCoordinated::ResetCoordinated()
 
 bool AttCoordinated::ReadCoordinated(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCoordinated(reader);
+}
+
+bool AttCoordinated::ReadCoordinated(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_COORDINATED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        element.remove_attribute("ulx");
-        hasAttribute = true;
-    }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        element.remove_attribute("uly");
-        hasAttribute = true;
-    }
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        element.remove_attribute("lrx");
-        hasAttribute = true;
-    }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        element.remove_attribute("lry");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_COORDINATED)) {
+            case 0: this->SetUlx(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetUly(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetLrx(StrToInt(reader.GetValue(i))); break;
+            case 3: this->SetLry(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1101,10 +1265,20 @@ void AttCue::ResetCue()
 
 bool AttCue::ReadCue(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCue(reader);
+}
+
+bool AttCue::ReadCue(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CUE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("cue")) {
-        this->SetCue(StrToBoolean(element.attribute("cue").value()));
-        element.remove_attribute("cue");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CUE)) {
+            case 0: this->SetCue(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1149,20 +1323,22 @@ void AttCurvature::ResetCurvature()
 
 bool AttCurvature::ReadCurvature(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCurvature(reader);
+}
+
+bool AttCurvature::ReadCurvature(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CURVATURE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        element.remove_attribute("bezier");
-        hasAttribute = true;
-    }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToDbl(element.attribute("bulge").value()));
-        element.remove_attribute("bulge");
-        hasAttribute = true;
-    }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        element.remove_attribute("curvedir");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CURVATURE)) {
+            case 0: this->SetBezier(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetBulge(StrToDbl(reader.GetValue(i))); break;
+            case 2: this->SetCurvedir(StrToCurvatureCurvedir(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1224,15 +1400,21 @@ void AttCurveRend::ResetCurveRend()
 
 bool AttCurveRend::ReadCurveRend(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCurveRend(reader);
+}
+
+bool AttCurveRend::ReadCurveRend(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CURVEREND)) return false;
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CURVEREND)) {
+            case 0: this->SetLform(StrToLineform(reader.GetValue(i))); break;
+            case 1: this->SetLwidth(StrToLinewidth(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1284,10 +1466,20 @@ void AttCustosLog::ResetCustosLog()
 
 bool AttCustosLog::ReadCustosLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCustosLog(reader);
+}
+
+bool AttCustosLog::ReadCustosLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CUSTOSLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        element.remove_attribute("target");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CUSTOSLOG)) {
+            case 0: this->SetTarget(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1330,10 +1522,20 @@ void AttDataPointing::ResetDataPointing()
 
 bool AttDataPointing::ReadDataPointing(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDataPointing(reader);
+}
+
+bool AttDataPointing::ReadDataPointing(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DATAPOINTING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        element.remove_attribute("data");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DATAPOINTING)) {
+            case 0: this->SetData(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1380,30 +1582,24 @@ void AttDatable::ResetDatable()
 
 bool AttDatable::ReadDatable(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDatable(reader);
+}
+
+bool AttDatable::ReadDatable(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DATABLE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        element.remove_attribute("enddate");
-        hasAttribute = true;
-    }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        element.remove_attribute("isodate");
-        hasAttribute = true;
-    }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        element.remove_attribute("notafter");
-        hasAttribute = true;
-    }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        element.remove_attribute("notbefore");
-        hasAttribute = true;
-    }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        element.remove_attribute("startdate");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DATABLE)) {
+            case 0: this->SetEnddate(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetIsodate(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetNotafter(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetNotbefore(StrToStr(reader.GetValue(i))); break;
+            case 4: this->SetStartdate(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1484,20 +1680,22 @@ void AttDistances::ResetDistances()
 
 bool AttDistances::ReadDistances(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDistances(reader);
+}
+
+bool AttDistances::ReadDistances(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DISTANCES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToMeasurementrel(element.attribute("dynam.dist").value()));
-        element.remove_attribute("dynam.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToMeasurementrel(element.attribute("harm.dist").value()));
-        element.remove_attribute("harm.dist");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.dist")) {
-        this->SetTextDist(StrToMeasurementrel(element.attribute("text.dist").value()));
-        element.remove_attribute("text.dist");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DISTANCES)) {
+            case 0: this->SetDynamDist(StrToMeasurementrel(reader.GetValue(i))); break;
+            case 1: this->SetHarmDist(StrToMeasurementrel(reader.GetValue(i))); break;
+            case 2: this->SetTextDist(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1558,10 +1756,20 @@ void AttDotLog::ResetDotLog()
 
 bool AttDotLog::ReadDotLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDotLog(reader);
+}
+
+bool AttDotLog::ReadDotLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DOTLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DOTLOG)) {
+            case 0: this->SetForm(StrToDotLogForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1604,10 +1812,20 @@ void AttDurationAdditive::ResetDurationAdditive()
 
 bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDurationAdditive(reader);
+}
+
+bool AttDurationAdditive::ReadDurationAdditive(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DURATIONADDITIVE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DURATIONADDITIVE)) {
+            case 0: this->SetDur(StrToDuration(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1652,20 +1870,22 @@ void AttDurationDefault::ResetDurationDefault()
 
 bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDurationDefault(reader);
+}
+
+bool AttDurationDefault::ReadDurationDefault(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DURATIONDEFAULT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        element.remove_attribute("dur.default");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        element.remove_attribute("num.default");
-        hasAttribute = true;
-    }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        element.remove_attribute("numbase.default");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DURATIONDEFAULT)) {
+            case 0: this->SetDurDefault(StrToDuration(reader.GetValue(i))); break;
+            case 1: this->SetNumDefault(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetNumbaseDefault(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1726,10 +1946,20 @@ void AttDurationLogical::ResetDurationLogical()
 
 bool AttDurationLogical::ReadDurationLogical(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDurationLogical(reader);
+}
+
+bool AttDurationLogical::ReadDurationLogical(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DURATIONLOGICAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DURATIONLOGICAL)) {
+            case 0: this->SetDur(StrToDuration(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1773,15 +2003,21 @@ void AttDurationRatio::ResetDurationRatio()
 
 bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadDurationRatio(reader);
+}
+
+bool AttDurationRatio::ReadDurationRatio(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_DURATIONRATIO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
-        hasAttribute = true;
-    }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        element.remove_attribute("numbase");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_DURATIONRATIO)) {
+            case 0: this->SetNum(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetNumbase(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1833,10 +2069,20 @@ void AttEnclosingChars::ResetEnclosingChars()
 
 bool AttEnclosingChars::ReadEnclosingChars(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadEnclosingChars(reader);
+}
+
+bool AttEnclosingChars::ReadEnclosingChars(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ENCLOSINGCHARS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        element.remove_attribute("enclose");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ENCLOSINGCHARS)) {
+            case 0: this->SetEnclose(StrToEnclosure(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1879,10 +2125,20 @@ void AttEndings::ResetEndings()
 
 bool AttEndings::ReadEndings(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadEndings(reader);
+}
+
+bool AttEndings::ReadEndings(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ENDINGS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        element.remove_attribute("ending.rend");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ENDINGS)) {
+            case 0: this->SetEndingRend(StrToEndingsEndingrend(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1926,15 +2182,21 @@ void AttEvidence::ResetEvidence()
 
 bool AttEvidence::ReadEvidence(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadEvidence(reader);
+}
+
+bool AttEvidence::ReadEvidence(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_EVIDENCE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        element.remove_attribute("cert");
-        hasAttribute = true;
-    }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        element.remove_attribute("evidence");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_EVIDENCE)) {
+            case 0: this->SetCert(StrToCertainty(reader.GetValue(i))); break;
+            case 1: this->SetEvidence(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1986,10 +2248,20 @@ void AttExtender::ResetExtender()
 
 bool AttExtender::ReadExtender(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadExtender(reader);
+}
+
+bool AttExtender::ReadExtender(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_EXTENDER)) return false;
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        element.remove_attribute("extender");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_EXTENDER)) {
+            case 0: this->SetExtender(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2032,10 +2304,20 @@ void AttExtent::ResetExtent()
 
 bool AttExtent::ReadExtent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadExtent(reader);
+}
+
+bool AttExtent::ReadExtent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_EXTENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        element.remove_attribute("extent");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_EXTENT)) {
+            case 0: this->SetExtent(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2078,10 +2360,20 @@ void AttFermataPresent::ResetFermataPresent()
 
 bool AttFermataPresent::ReadFermataPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFermataPresent(reader);
+}
+
+bool AttFermataPresent::ReadFermataPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FERMATAPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToStaffrelBasic(element.attribute("fermata").value()));
-        element.remove_attribute("fermata");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FERMATAPRESENT)) {
+            case 0: this->SetFermata(StrToStaffrelBasic(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2124,10 +2416,20 @@ void AttFiling::ResetFiling()
 
 bool AttFiling::ReadFiling(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFiling(reader);
+}
+
+bool AttFiling::ReadFiling(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FILING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        element.remove_attribute("nonfiling");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FILING)) {
+            case 0: this->SetNonfiling(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2170,10 +2472,20 @@ void AttGrpSymLog::ResetGrpSymLog()
 
 bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadGrpSymLog(reader);
+}
+
+bool AttGrpSymLog::ReadGrpSymLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_GRPSYMLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        element.remove_attribute("level");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_GRPSYMLOG)) {
+            case 0: this->SetLevel(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2216,10 +2528,20 @@ void AttHandIdent::ResetHandIdent()
 
 bool AttHandIdent::ReadHandIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHandIdent(reader);
+}
+
+bool AttHandIdent::ReadHandIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HANDIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        element.remove_attribute("hand");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HANDIDENT)) {
+            case 0: this->SetHand(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2262,10 +2584,20 @@ void AttHeight::ResetHeight()
 
 bool AttHeight::ReadHeight(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHeight(reader);
+}
+
+bool AttHeight::ReadHeight(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HEIGHT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToMeasurementabs(element.attribute("height").value()));
-        element.remove_attribute("height");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HEIGHT)) {
+            case 0: this->SetHeight(StrToMeasurementabs(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2308,10 +2640,20 @@ void AttHorizontalAlign::ResetHorizontalAlign()
 
 bool AttHorizontalAlign::ReadHorizontalAlign(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHorizontalAlign(reader);
+}
+
+bool AttHorizontalAlign::ReadHorizontalAlign(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HORIZONTALALIGN)) return false;
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        element.remove_attribute("halign");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HORIZONTALALIGN)) {
+            case 0: this->SetHalign(StrToHorizontalalignment(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2354,10 +2696,20 @@ void AttInternetMedia::ResetInternetMedia()
 
 bool AttInternetMedia::ReadInternetMedia(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadInternetMedia(reader);
+}
+
+bool AttInternetMedia::ReadInternetMedia(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_INTERNETMEDIA)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        element.remove_attribute("mimetype");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_INTERNETMEDIA)) {
+            case 0: this->SetMimetype(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2400,10 +2752,20 @@ void AttJoined::ResetJoined()
 
 bool AttJoined::ReadJoined(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadJoined(reader);
+}
+
+bool AttJoined::ReadJoined(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_JOINED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        element.remove_attribute("join");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_JOINED)) {
+            case 0: this->SetJoin(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2446,10 +2808,20 @@ void AttKeySigLog::ResetKeySigLog()
 
 bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadKeySigLog(reader);
+}
+
+bool AttKeySigLog::ReadKeySigLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_KEYSIGLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        element.remove_attribute("sig");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_KEYSIGLOG)) {
+            case 0: this->SetSig(StrToKeysignature(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2492,10 +2864,20 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
 
 bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadKeySigDefaultLog(reader);
+}
+
+bool AttKeySigDefaultLog::ReadKeySigDefaultLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_KEYSIGDEFAULTLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("key.sig")) {
-        this->SetKeySig(StrToKeysignature(element.attribute("key.sig").value()));
-        element.remove_attribute("key.sig");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_KEYSIGDEFAULTLOG)) {
+            case 0: this->SetKeySig(StrToKeysignature(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2538,10 +2920,20 @@ void AttLabelled::ResetLabelled()
 
 bool AttLabelled::ReadLabelled(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLabelled(reader);
+}
+
+bool AttLabelled::ReadLabelled(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LABELLED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        element.remove_attribute("label");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LABELLED)) {
+            case 0: this->SetLabel(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2585,15 +2977,21 @@ void AttLang::ResetLang()
 
 bool AttLang::ReadLang(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLang(reader);
+}
+
+bool AttLang::ReadLang(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LANG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        element.remove_attribute("xml:lang");
-        hasAttribute = true;
-    }
-    if (element.attribute("xml:translit")) {
-        this->SetTranslit(StrToStr(element.attribute("xml:translit").value()));
-        element.remove_attribute("xml:translit");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LANG)) {
+            case 0: this->SetLang(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetTranslit(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2645,10 +3043,20 @@ void AttLayerLog::ResetLayerLog()
 
 bool AttLayerLog::ReadLayerLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLayerLog(reader);
+}
+
+bool AttLayerLog::ReadLayerLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LAYERLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LAYERLOG)) {
+            case 0: this->SetDef(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2691,10 +3099,20 @@ void AttLayerIdent::ResetLayerIdent()
 
 bool AttLayerIdent::ReadLayerIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLayerIdent(reader);
+}
+
+bool AttLayerIdent::ReadLayerIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LAYERIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        element.remove_attribute("layer");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LAYERIDENT)) {
+            case 0: this->SetLayer(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2737,10 +3155,20 @@ void AttLineLoc::ResetLineLoc()
 
 bool AttLineLoc::ReadLineLoc(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLineLoc(reader);
+}
+
+bool AttLineLoc::ReadLineLoc(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LINELOC)) return false;
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        element.remove_attribute("line");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LINELOC)) {
+            case 0: this->SetLine(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2786,25 +3214,23 @@ void AttLineRend::ResetLineRend()
 
 bool AttLineRend::ReadLineRend(pugi::xml_node element)
 {
-    bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        element.remove_attribute("lendsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("lendsym.size")) {
-        this->SetLendsymSize(StrToInt(element.attribute("lendsym.size").value()));
-        element.remove_attribute("lendsym.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        element.remove_attribute("lstartsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("lstartsym.size")) {
-        this->SetLstartsymSize(StrToInt(element.attribute("lstartsym.size").value()));
-        element.remove_attribute("lstartsym.size");
+    AttReader reader(element);
+    return this->ReadLineRend(reader);
+}
+
+bool AttLineRend::ReadLineRend(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LINEREND)) return false;
+    bool hasAttribute = false;
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LINEREND)) {
+            case 0: this->SetLendsym(StrToLinestartendsymbol(reader.GetValue(i))); break;
+            case 1: this->SetLendsymSize(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetLstartsym(StrToLinestartendsymbol(reader.GetValue(i))); break;
+            case 3: this->SetLstartsymSize(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2876,20 +3302,22 @@ void AttLineRendBase::ResetLineRendBase()
 
 bool AttLineRendBase::ReadLineRendBase(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLineRendBase(reader);
+}
+
+bool AttLineRendBase::ReadLineRendBase(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LINERENDBASE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
-        hasAttribute = true;
-    }
-    if (element.attribute("lsegs")) {
-        this->SetLsegs(StrToInt(element.attribute("lsegs").value()));
-        element.remove_attribute("lsegs");
-        hasAttribute = true;
-    }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LINERENDBASE)) {
+            case 0: this->SetLform(StrToLineform(reader.GetValue(i))); break;
+            case 1: this->SetLsegs(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetLwidth(StrToLinewidth(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2957,45 +3385,27 @@ void AttLinking::ResetLinking()
 
 bool AttLinking::ReadLinking(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLinking(reader);
+}
+
+bool AttLinking::ReadLinking(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LINKING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        element.remove_attribute("copyof");
-        hasAttribute = true;
-    }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        element.remove_attribute("corresp");
-        hasAttribute = true;
-    }
-    if (element.attribute("follows")) {
-        this->SetFollows(StrToStr(element.attribute("follows").value()));
-        element.remove_attribute("follows");
-        hasAttribute = true;
-    }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        element.remove_attribute("next");
-        hasAttribute = true;
-    }
-    if (element.attribute("precedes")) {
-        this->SetPrecedes(StrToStr(element.attribute("precedes").value()));
-        element.remove_attribute("precedes");
-        hasAttribute = true;
-    }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        element.remove_attribute("prev");
-        hasAttribute = true;
-    }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        element.remove_attribute("sameas");
-        hasAttribute = true;
-    }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        element.remove_attribute("synch");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LINKING)) {
+            case 0: this->SetCopyof(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetCorresp(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetFollows(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetNext(StrToStr(reader.GetValue(i))); break;
+            case 4: this->SetPrecedes(StrToStr(reader.GetValue(i))); break;
+            case 5: this->SetPrev(StrToStr(reader.GetValue(i))); break;
+            case 6: this->SetSameas(StrToStr(reader.GetValue(i))); break;
+            case 7: this->SetSynch(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3106,35 +3516,25 @@ void AttLyricStyle::ResetLyricStyle()
 
 bool AttLyricStyle::ReadLyricStyle(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLyricStyle(reader);
+}
+
+bool AttLyricStyle::ReadLyricStyle(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LYRICSTYLE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToMeasurementrel(element.attribute("lyric.align").value()));
-        element.remove_attribute("lyric.align");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        element.remove_attribute("lyric.fam");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        element.remove_attribute("lyric.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToFontsize(element.attribute("lyric.size").value()));
-        element.remove_attribute("lyric.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        element.remove_attribute("lyric.style");
-        hasAttribute = true;
-    }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        element.remove_attribute("lyric.weight");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LYRICSTYLE)) {
+            case 0: this->SetLyricAlign(StrToMeasurementrel(reader.GetValue(i))); break;
+            case 1: this->SetLyricFam(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetLyricName(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetLyricSize(StrToFontsize(reader.GetValue(i))); break;
+            case 4: this->SetLyricStyle(StrToFontstyle(reader.GetValue(i))); break;
+            case 5: this->SetLyricWeight(StrToFontweight(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3222,10 +3622,20 @@ void AttMeasureNumbers::ResetMeasureNumbers()
 
 bool AttMeasureNumbers::ReadMeasureNumbers(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeasureNumbers(reader);
+}
+
+bool AttMeasureNumbers::ReadMeasureNumbers(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MEASURENUMBERS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        element.remove_attribute("mnum.visible");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MEASURENUMBERS)) {
+            case 0: this->SetMnumVisible(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3268,10 +3678,20 @@ void AttMeasurement::ResetMeasurement()
 
 bool AttMeasurement::ReadMeasurement(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeasurement(reader);
+}
+
+bool AttMeasurement::ReadMeasurement(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MEASUREMENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MEASUREMENT)) {
+            case 0: this->SetUnit(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3316,20 +3736,22 @@ void AttMediaBounds::ResetMediaBounds()
 
 bool AttMediaBounds::ReadMediaBounds(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMediaBounds(reader);
+}
+
+bool AttMediaBounds::ReadMediaBounds(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MEDIABOUNDS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        element.remove_attribute("begin");
-        hasAttribute = true;
-    }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        element.remove_attribute("end");
-        hasAttribute = true;
-    }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        element.remove_attribute("betype");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MEDIABOUNDS)) {
+            case 0: this->SetBegin(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetEnd(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetBetype(StrToBetype(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3390,10 +3812,20 @@ void AttMedium::ResetMedium()
 
 bool AttMedium::ReadMedium(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMedium(reader);
+}
+
+bool AttMedium::ReadMedium(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MEDIUM)) return false;
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        element.remove_attribute("medium");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MEDIUM)) {
+            case 0: this->SetMedium(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3436,10 +3868,20 @@ void AttMeiVersion::ResetMeiVersion()
 
 bool AttMeiVersion::ReadMeiVersion(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeiVersion(reader);
+}
+
+bool AttMeiVersion::ReadMeiVersion(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MEIVERSION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiVersionMeiversion(element.attribute("meiversion").value()));
-        element.remove_attribute("meiversion");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MEIVERSION)) {
+            case 0: this->SetMeiversion(StrToMeiVersionMeiversion(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3483,15 +3925,21 @@ void AttMensurLog::ResetMensurLog()
 
 bool AttMensurLog::ReadMensurLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMensurLog(reader);
+}
+
+bool AttMensurLog::ReadMensurLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MENSURLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        element.remove_attribute("dot");
-        hasAttribute = true;
-    }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        element.remove_attribute("sign");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MENSURLOG)) {
+            case 0: this->SetDot(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetSign(StrToMensurationsign(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3543,10 +3991,20 @@ void AttMetadataPointing::ResetMetadataPointing()
 
 bool AttMetadataPointing::ReadMetadataPointing(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMetadataPointing(reader);
+}
+
+bool AttMetadataPointing::ReadMetadataPointing(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METADATAPOINTING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        element.remove_attribute("decls");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METADATAPOINTING)) {
+            case 0: this->SetDecls(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3589,10 +4047,20 @@ void AttMeterConformance::ResetMeterConformance()
 
 bool AttMeterConformance::ReadMeterConformance(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterConformance(reader);
+}
+
+bool AttMeterConformance::ReadMeterConformance(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERCONFORMANCE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterConformanceMetcon(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERCONFORMANCE)) {
+            case 0: this->SetMetcon(StrToMeterConformanceMetcon(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3636,15 +4104,21 @@ void AttMeterConformanceBar::ResetMeterConformanceBar()
 
 bool AttMeterConformanceBar::ReadMeterConformanceBar(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterConformanceBar(reader);
+}
+
+bool AttMeterConformanceBar::ReadMeterConformanceBar(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERCONFORMANCEBAR)) return false;
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
-        hasAttribute = true;
-    }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        element.remove_attribute("control");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERCONFORMANCEBAR)) {
+            case 0: this->SetMetcon(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetControl(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3698,20 +4172,22 @@ void AttMeterSigLog::ResetMeterSigLog()
 
 bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterSigLog(reader);
+}
+
+bool AttMeterSigLog::ReadMeterSigLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERSIGLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        element.remove_attribute("count");
-        hasAttribute = true;
-    }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        element.remove_attribute("sym");
-        hasAttribute = true;
-    }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERSIGLOG)) {
+            case 0: this->SetCount(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetSym(StrToMetersign(reader.GetValue(i))); break;
+            case 2: this->SetUnit(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3774,20 +4250,22 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
 
 bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterSigDefaultLog(reader);
+}
+
+bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERSIGDEFAULTLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToInt(element.attribute("meter.count").value()));
-        element.remove_attribute("meter.count");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        element.remove_attribute("meter.unit");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        element.remove_attribute("meter.sym");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERSIGDEFAULTLOG)) {
+            case 0: this->SetMeterCount(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetMeterUnit(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetMeterSym(StrToMetersign(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3850,20 +4328,22 @@ void AttMmTempo::ResetMmTempo()
 
 bool AttMmTempo::ReadMmTempo(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMmTempo(reader);
+}
+
+bool AttMmTempo::ReadMmTempo(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MMTEMPO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToInt(element.attribute("mm").value()));
-        element.remove_attribute("mm");
-        hasAttribute = true;
-    }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        element.remove_attribute("mm.unit");
-        hasAttribute = true;
-    }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        element.remove_attribute("mm.dots");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MMTEMPO)) {
+            case 0: this->SetMm(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetMmUnit(StrToDuration(reader.GetValue(i))); break;
+            case 2: this->SetMmDots(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3924,10 +4404,20 @@ void AttMultinumMeasures::ResetMultinumMeasures()
 
 bool AttMultinumMeasures::ReadMultinumMeasures(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMultinumMeasures(reader);
+}
+
+bool AttMultinumMeasures::ReadMultinumMeasures(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MULTINUMMEASURES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        element.remove_attribute("multi.number");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MULTINUMMEASURES)) {
+            case 0: this->SetMultiNumber(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3970,10 +4460,20 @@ void AttNInteger::ResetNInteger()
 
 bool AttNInteger::ReadNInteger(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNInteger(reader);
+}
+
+bool AttNInteger::ReadNInteger(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NINTEGER)) return false;
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        element.remove_attribute("n");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NINTEGER)) {
+            case 0: this->SetN(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4016,10 +4516,20 @@ void AttNNumberLike::ResetNNumberLike()
 
 bool AttNNumberLike::ReadNNumberLike(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNNumberLike(reader);
+}
+
+bool AttNNumberLike::ReadNNumberLike(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NNUMBERLIKE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToStr(element.attribute("n").value()));
-        element.remove_attribute("n");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NNUMBERLIKE)) {
+            case 0: this->SetN(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4063,15 +4573,21 @@ void AttName::ResetName()
 
 bool AttName::ReadName(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadName(reader);
+}
+
+bool AttName::ReadName(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NAME)) return false;
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        element.remove_attribute("nymref");
-        hasAttribute = true;
-    }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        element.remove_attribute("role");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NAME)) {
+            case 0: this->SetNymref(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetRole(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4124,15 +4640,21 @@ void AttNotationStyle::ResetNotationStyle()
 
 bool AttNotationStyle::ReadNotationStyle(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNotationStyle(reader);
+}
+
+bool AttNotationStyle::ReadNotationStyle(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NOTATIONSTYLE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        element.remove_attribute("music.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToFontsize(element.attribute("music.size").value()));
-        element.remove_attribute("music.size");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NOTATIONSTYLE)) {
+            case 0: this->SetMusicName(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetMusicSize(StrToFontsize(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4192,50 +4714,28 @@ void AttNoteHeads::ResetNoteHeads()
 
 bool AttNoteHeads::ReadNoteHeads(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadNoteHeads(reader);
+}
+
+bool AttNoteHeads::ReadNoteHeads(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_NOTEHEADS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("head.altsym")) {
-        this->SetHeadAltsym(StrToStr(element.attribute("head.altsym").value()));
-        element.remove_attribute("head.altsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.auth")) {
-        this->SetHeadAuth(StrToStr(element.attribute("head.auth").value()));
-        element.remove_attribute("head.auth");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        element.remove_attribute("head.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        element.remove_attribute("head.fill");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        element.remove_attribute("head.fillcolor");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToNoteheadmodifier(element.attribute("head.mod").value()));
-        element.remove_attribute("head.mod");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToRotation(element.attribute("head.rotation").value()));
-        element.remove_attribute("head.rotation");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshape(element.attribute("head.shape").value()));
-        element.remove_attribute("head.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        element.remove_attribute("head.visible");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_NOTEHEADS)) {
+            case 0: this->SetHeadAltsym(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetHeadAuth(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetHeadColor(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetHeadFill(StrToFill(reader.GetValue(i))); break;
+            case 4: this->SetHeadFillcolor(StrToStr(reader.GetValue(i))); break;
+            case 5: this->SetHeadMod(StrToNoteheadmodifier(reader.GetValue(i))); break;
+            case 6: this->SetHeadRotation(StrToRotation(reader.GetValue(i))); break;
+            case 7: this->SetHeadShape(StrToHeadshape(reader.GetValue(i))); break;
+            case 8: this->SetHeadVisible(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4350,10 +4850,20 @@ void AttOctave::ResetOctave()
 
 bool AttOctave::ReadOctave(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOctave(reader);
+}
+
+bool AttOctave::ReadOctave(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_OCTAVE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToOctave(element.attribute("oct").value()));
-        element.remove_attribute("oct");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_OCTAVE)) {
+            case 0: this->SetOct(StrToOctave(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4396,10 +4906,20 @@ void AttOctaveDefault::ResetOctaveDefault()
 
 bool AttOctaveDefault::ReadOctaveDefault(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOctaveDefault(reader);
+}
+
+bool AttOctaveDefault::ReadOctaveDefault(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_OCTAVEDEFAULT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("oct.default")) {
-        this->SetOctDefault(StrToOctave(element.attribute("oct.default").value()));
-        element.remove_attribute("oct.default");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_OCTAVEDEFAULT)) {
+            case 0: this->SetOctDefault(StrToOctave(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4443,15 +4963,21 @@ void AttOctaveDisplacement::ResetOctaveDisplacement()
 
 bool AttOctaveDisplacement::ReadOctaveDisplacement(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOctaveDisplacement(reader);
+}
+
+bool AttOctaveDisplacement::ReadOctaveDisplacement(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_OCTAVEDISPLACEMENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        element.remove_attribute("dis");
-        hasAttribute = true;
-    }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToStaffrelBasic(element.attribute("dis.place").value()));
-        element.remove_attribute("dis.place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_OCTAVEDISPLACEMENT)) {
+            case 0: this->SetDis(StrToOctaveDis(reader.GetValue(i))); break;
+            case 1: this->SetDisPlace(StrToStaffrelBasic(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4503,10 +5029,20 @@ void AttOneLineStaff::ResetOneLineStaff()
 
 bool AttOneLineStaff::ReadOneLineStaff(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOneLineStaff(reader);
+}
+
+bool AttOneLineStaff::ReadOneLineStaff(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ONELINESTAFF)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        element.remove_attribute("ontheline");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ONELINESTAFF)) {
+            case 0: this->SetOntheline(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4549,10 +5085,20 @@ void AttOptimization::ResetOptimization()
 
 bool AttOptimization::ReadOptimization(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOptimization(reader);
+}
+
+bool AttOptimization::ReadOptimization(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_OPTIMIZATION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        element.remove_attribute("optimize");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_OPTIMIZATION)) {
+            case 0: this->SetOptimize(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4595,10 +5141,20 @@ void AttOriginLayerIdent::ResetOriginLayerIdent()
 
 bool AttOriginLayerIdent::ReadOriginLayerIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOriginLayerIdent(reader);
+}
+
+bool AttOriginLayerIdent::ReadOriginLayerIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ORIGINLAYERIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        element.remove_attribute("origin.layer");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ORIGINLAYERIDENT)) {
+            case 0: this->SetOriginLayer(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4641,10 +5197,20 @@ void AttOriginStaffIdent::ResetOriginStaffIdent()
 
 bool AttOriginStaffIdent::ReadOriginStaffIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOriginStaffIdent(reader);
+}
+
+bool AttOriginStaffIdent::ReadOriginStaffIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ORIGINSTAFFIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        element.remove_attribute("origin.staff");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ORIGINSTAFFIDENT)) {
+            case 0: this->SetOriginStaff(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4688,15 +5254,21 @@ void AttOriginStartEndId::ResetOriginStartEndId()
 
 bool AttOriginStartEndId::ReadOriginStartEndId(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOriginStartEndId(reader);
+}
+
+bool AttOriginStartEndId::ReadOriginStartEndId(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ORIGINSTARTENDID)) return false;
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        element.remove_attribute("origin.startid");
-        hasAttribute = true;
-    }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        element.remove_attribute("origin.endid");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ORIGINSTARTENDID)) {
+            case 0: this->SetOriginStartid(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetOriginEndid(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4749,15 +5321,21 @@ void AttOriginTimestampLogical::ResetOriginTimestampLogical()
 
 bool AttOriginTimestampLogical::ReadOriginTimestampLogical(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadOriginTimestampLogical(reader);
+}
+
+bool AttOriginTimestampLogical::ReadOriginTimestampLogical(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ORIGINTIMESTAMPLOGICAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        element.remove_attribute("origin.tstamp");
-        hasAttribute = true;
-    }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        element.remove_attribute("origin.tstamp2");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ORIGINTIMESTAMPLOGICAL)) {
+            case 0: this->SetOriginTstamp(StrToMeasurebeat(reader.GetValue(i))); break;
+            case 1: this->SetOriginTstamp2(StrToMeasurebeat(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4816,45 +5394,27 @@ void AttPages::ResetPages()
 
 bool AttPages::ReadPages(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPages(reader);
+}
+
+bool AttPages::ReadPages(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PAGES)) return false;
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToMeasurementabs(element.attribute("page.height").value()));
-        element.remove_attribute("page.height");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToMeasurementabs(element.attribute("page.width").value()));
-        element.remove_attribute("page.width");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToMeasurementabs(element.attribute("page.topmar").value()));
-        element.remove_attribute("page.topmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToMeasurementabs(element.attribute("page.botmar").value()));
-        element.remove_attribute("page.botmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToMeasurementabs(element.attribute("page.leftmar").value()));
-        element.remove_attribute("page.leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToMeasurementabs(element.attribute("page.rightmar").value()));
-        element.remove_attribute("page.rightmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        element.remove_attribute("page.panels");
-        hasAttribute = true;
-    }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        element.remove_attribute("page.scale");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PAGES)) {
+            case 0: this->SetPageHeight(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 1: this->SetPageWidth(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 2: this->SetPageTopmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 3: this->SetPageBotmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 4: this->SetPageLeftmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 5: this->SetPageRightmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 6: this->SetPagePanels(StrToStr(reader.GetValue(i))); break;
+            case 7: this->SetPageScale(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4961,15 +5521,21 @@ void AttPartIdent::ResetPartIdent()
 
 bool AttPartIdent::ReadPartIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPartIdent(reader);
+}
+
+bool AttPartIdent::ReadPartIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PARTIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("part")) {
-        this->SetPart(StrToStr(element.attribute("part").value()));
-        element.remove_attribute("part");
-        hasAttribute = true;
-    }
-    if (element.attribute("partstaff")) {
-        this->SetPartstaff(StrToStr(element.attribute("partstaff").value()));
-        element.remove_attribute("partstaff");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PARTIDENT)) {
+            case 0: this->SetPart(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetPartstaff(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5021,10 +5587,20 @@ void AttPitch::ResetPitch()
 
 bool AttPitch::ReadPitch(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPitch(reader);
+}
+
+bool AttPitch::ReadPitch(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PITCH)) return false;
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        element.remove_attribute("pname");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PITCH)) {
+            case 0: this->SetPname(StrToPitchname(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5067,10 +5643,20 @@ void AttPlacement::ResetPlacement()
 
 bool AttPlacement::ReadPlacement(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPlacement(reader);
+}
+
+bool AttPlacement::ReadPlacement(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PLACEMENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PLACEMENT)) {
+            case 0: this->SetPlace(StrToStaffrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5113,10 +5699,20 @@ void AttPlist::ResetPlist()
 
 bool AttPlist::ReadPlist(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPlist(reader);
+}
+
+bool AttPlist::ReadPlist(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PLIST)) return false;
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToXsdAnyURIList(element.attribute("plist").value()));
-        element.remove_attribute("plist");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PLIST)) {
+            case 0: this->SetPlist(StrToXsdAnyURIList(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5163,30 +5759,24 @@ void AttPointing::ResetPointing()
 
 bool AttPointing::ReadPointing(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPointing(reader);
+}
+
+bool AttPointing::ReadPointing(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_POINTING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        element.remove_attribute("xlink:actuate");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        element.remove_attribute("xlink:role");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        element.remove_attribute("xlink:show");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:target")) {
-        this->SetTarget(StrToStr(element.attribute("xlink:target").value()));
-        element.remove_attribute("xlink:target");
-        hasAttribute = true;
-    }
-    if (element.attribute("xlink:targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("xlink:targettype").value()));
-        element.remove_attribute("xlink:targettype");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_POINTING)) {
+            case 0: this->SetActuate(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetRole(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetShow(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetTarget(StrToStr(reader.GetValue(i))); break;
+            case 4: this->SetTargettype(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5265,10 +5855,20 @@ void AttQuantity::ResetQuantity()
 
 bool AttQuantity::ReadQuantity(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadQuantity(reader);
+}
+
+bool AttQuantity::ReadQuantity(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_QUANTITY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        element.remove_attribute("quantity");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_QUANTITY)) {
+            case 0: this->SetQuantity(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5315,30 +5915,24 @@ void AttRanging::ResetRanging()
 
 bool AttRanging::ReadRanging(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadRanging(reader);
+}
+
+bool AttRanging::ReadRanging(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_RANGING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("atleast")) {
-        this->SetAtleast(StrToDbl(element.attribute("atleast").value()));
-        element.remove_attribute("atleast");
-        hasAttribute = true;
-    }
-    if (element.attribute("atmost")) {
-        this->SetAtmost(StrToDbl(element.attribute("atmost").value()));
-        element.remove_attribute("atmost");
-        hasAttribute = true;
-    }
-    if (element.attribute("min")) {
-        this->SetMin(StrToDbl(element.attribute("min").value()));
-        element.remove_attribute("min");
-        hasAttribute = true;
-    }
-    if (element.attribute("max")) {
-        this->SetMax(StrToDbl(element.attribute("max").value()));
-        element.remove_attribute("max");
-        hasAttribute = true;
-    }
-    if (element.attribute("confidence")) {
-        this->SetConfidence(StrToDbl(element.attribute("confidence").value()));
-        element.remove_attribute("confidence");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_RANGING)) {
+            case 0: this->SetAtleast(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetAtmost(StrToDbl(reader.GetValue(i))); break;
+            case 2: this->SetMin(StrToDbl(reader.GetValue(i))); break;
+            case 3: this->SetMax(StrToDbl(reader.GetValue(i))); break;
+            case 4: this->SetConfidence(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5417,10 +6011,20 @@ void AttResponsibility::ResetResponsibility()
 
 bool AttResponsibility::ReadResponsibility(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadResponsibility(reader);
+}
+
+bool AttResponsibility::ReadResponsibility(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_RESPONSIBILITY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        element.remove_attribute("resp");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_RESPONSIBILITY)) {
+            case 0: this->SetResp(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5463,10 +6067,20 @@ void AttScalable::ResetScalable()
 
 bool AttScalable::ReadScalable(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadScalable(reader);
+}
+
+bool AttScalable::ReadScalable(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SCALABLE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        element.remove_attribute("scale");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SCALABLE)) {
+            case 0: this->SetScale(StrToPercent(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5509,10 +6123,20 @@ void AttSequence::ResetSequence()
 
 bool AttSequence::ReadSequence(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSequence(reader);
+}
+
+bool AttSequence::ReadSequence(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SEQUENCE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        element.remove_attribute("seq");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SEQUENCE)) {
+            case 0: this->SetSeq(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5555,10 +6179,20 @@ void AttSlashCount::ResetSlashCount()
 
 bool AttSlashCount::ReadSlashCount(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSlashCount(reader);
+}
+
+bool AttSlashCount::ReadSlashCount(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SLASHCOUNT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SLASHCOUNT)) {
+            case 0: this->SetSlash(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5601,10 +6235,20 @@ void AttSlurPresent::ResetSlurPresent()
 
 bool AttSlurPresent::ReadSlurPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSlurPresent(reader);
+}
+
+bool AttSlurPresent::ReadSlurPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SLURPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        element.remove_attribute("slur");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SLURPRESENT)) {
+            case 0: this->SetSlur(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5647,10 +6291,20 @@ void AttSource::ResetSource()
 
 bool AttSource::ReadSource(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSource(reader);
+}
+
+bool AttSource::ReadSource(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SOURCE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        element.remove_attribute("source");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SOURCE)) {
+            case 0: this->SetSource(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5696,25 +6350,23 @@ void AttSpacing::ResetSpacing()
 
 bool AttSpacing::ReadSpacing(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSpacing(reader);
+}
+
+bool AttSpacing::ReadSpacing(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SPACING)) return false;
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        element.remove_attribute("spacing.packexp");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        element.remove_attribute("spacing.packfact");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToMeasurementrel(element.attribute("spacing.staff").value()));
-        element.remove_attribute("spacing.staff");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToMeasurementrel(element.attribute("spacing.system").value()));
-        element.remove_attribute("spacing.system");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SPACING)) {
+            case 0: this->SetSpacingPackexp(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetSpacingPackfact(StrToDbl(reader.GetValue(i))); break;
+            case 2: this->SetSpacingStaff(StrToMeasurementrel(reader.GetValue(i))); break;
+            case 3: this->SetSpacingSystem(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5784,10 +6436,20 @@ void AttStaffLog::ResetStaffLog()
 
 bool AttStaffLog::ReadStaffLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffLog(reader);
+}
+
+bool AttStaffLog::ReadStaffLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFLOG)) {
+            case 0: this->SetDef(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5830,10 +6492,20 @@ void AttStaffDefLog::ResetStaffDefLog()
 
 bool AttStaffDefLog::ReadStaffDefLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffDefLog(reader);
+}
+
+bool AttStaffDefLog::ReadStaffDefLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFDEFLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        element.remove_attribute("lines");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFDEFLOG)) {
+            case 0: this->SetLines(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5876,10 +6548,20 @@ void AttStaffGroupingSym::ResetStaffGroupingSym()
 
 bool AttStaffGroupingSym::ReadStaffGroupingSym(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffGroupingSym(reader);
+}
+
+bool AttStaffGroupingSym::ReadStaffGroupingSym(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFGROUPINGSYM)) return false;
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffGroupingSymSymbol(element.attribute("symbol").value()));
-        element.remove_attribute("symbol");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFGROUPINGSYM)) {
+            case 0: this->SetSymbol(StrToStaffGroupingSymSymbol(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5922,10 +6604,20 @@ void AttStaffIdent::ResetStaffIdent()
 
 bool AttStaffIdent::ReadStaffIdent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffIdent(reader);
+}
+
+bool AttStaffIdent::ReadStaffIdent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFIDENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        element.remove_attribute("staff");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFIDENT)) {
+            case 0: this->SetStaff(StrToXsdPositiveIntegerList(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5970,20 +6662,22 @@ void AttStaffItems::ResetStaffItems()
 
 bool AttStaffItems::ReadStaffItems(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffItems(reader);
+}
+
+bool AttStaffItems::ReadStaffItems(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFITEMS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("aboveorder")) {
-        this->SetAboveorder(StrToStaffitem(element.attribute("aboveorder").value()));
-        element.remove_attribute("aboveorder");
-        hasAttribute = true;
-    }
-    if (element.attribute("beloworder")) {
-        this->SetBeloworder(StrToStaffitem(element.attribute("beloworder").value()));
-        element.remove_attribute("beloworder");
-        hasAttribute = true;
-    }
-    if (element.attribute("betweenorder")) {
-        this->SetBetweenorder(StrToStaffitem(element.attribute("betweenorder").value()));
-        element.remove_attribute("betweenorder");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFITEMS)) {
+            case 0: this->SetAboveorder(StrToStaffitem(reader.GetValue(i))); break;
+            case 1: this->SetBeloworder(StrToStaffitem(reader.GetValue(i))); break;
+            case 2: this->SetBetweenorder(StrToStaffitem(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6044,10 +6738,20 @@ void AttStaffLoc::ResetStaffLoc()
 
 bool AttStaffLoc::ReadStaffLoc(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffLoc(reader);
+}
+
+bool AttStaffLoc::ReadStaffLoc(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFLOC)) return false;
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        element.remove_attribute("loc");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFLOC)) {
+            case 0: this->SetLoc(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6091,15 +6795,21 @@ void AttStaffLocPitched::ResetStaffLocPitched()
 
 bool AttStaffLocPitched::ReadStaffLocPitched(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffLocPitched(reader);
+}
+
+bool AttStaffLocPitched::ReadStaffLocPitched(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFLOCPITCHED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        element.remove_attribute("ploc");
-        hasAttribute = true;
-    }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToOctave(element.attribute("oloc").value()));
-        element.remove_attribute("oloc");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFLOCPITCHED)) {
+            case 0: this->SetPloc(StrToPitchname(reader.GetValue(i))); break;
+            case 1: this->SetOloc(StrToOctave(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6151,10 +6861,20 @@ void AttStartEndId::ResetStartEndId()
 
 bool AttStartEndId::ReadStartEndId(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStartEndId(reader);
+}
+
+bool AttStartEndId::ReadStartEndId(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STARTENDID)) return false;
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        element.remove_attribute("endid");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STARTENDID)) {
+            case 0: this->SetEndid(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6197,10 +6917,20 @@ void AttStartId::ResetStartId()
 
 bool AttStartId::ReadStartId(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStartId(reader);
+}
+
+bool AttStartId::ReadStartId(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STARTID)) return false;
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        element.remove_attribute("startid");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STARTID)) {
+            case 0: this->SetStartid(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6249,40 +6979,26 @@ void AttStems::ResetStems()
 
 bool AttStems::ReadStems(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStems(reader);
+}
+
+bool AttStems::ReadStems(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STEMS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        element.remove_attribute("stem.dir");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToDbl(element.attribute("stem.len").value()));
-        element.remove_attribute("stem.len");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        element.remove_attribute("stem.mod");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        element.remove_attribute("stem.pos");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.visible")) {
-        this->SetStemVisible(StrToBoolean(element.attribute("stem.visible").value()));
-        element.remove_attribute("stem.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        element.remove_attribute("stem.x");
-        hasAttribute = true;
-    }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        element.remove_attribute("stem.y");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STEMS)) {
+            case 0: this->SetStemDir(StrToStemdirection(reader.GetValue(i))); break;
+            case 1: this->SetStemLen(StrToDbl(reader.GetValue(i))); break;
+            case 2: this->SetStemMod(StrToStemmodifier(reader.GetValue(i))); break;
+            case 3: this->SetStemPos(StrToStemposition(reader.GetValue(i))); break;
+            case 4: this->SetStemVisible(StrToBoolean(reader.GetValue(i))); break;
+            case 5: this->SetStemX(StrToDbl(reader.GetValue(i))); break;
+            case 6: this->SetStemY(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6380,15 +7096,21 @@ void AttSylLog::ResetSylLog()
 
 bool AttSylLog::ReadSylLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSylLog(reader);
+}
+
+bool AttSylLog::ReadSylLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SYLLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        element.remove_attribute("con");
-        hasAttribute = true;
-    }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        element.remove_attribute("wordpos");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SYLLOG)) {
+            case 0: this->SetCon(StrToSylLogCon(reader.GetValue(i))); break;
+            case 1: this->SetWordpos(StrToSylLogWordpos(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6440,10 +7162,20 @@ void AttSylText::ResetSylText()
 
 bool AttSylText::ReadSylText(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSylText(reader);
+}
+
+bool AttSylText::ReadSylText(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SYLTEXT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        element.remove_attribute("syl");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SYLTEXT)) {
+            case 0: this->SetSyl(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6489,25 +7221,23 @@ void AttSystems::ResetSystems()
 
 bool AttSystems::ReadSystems(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSystems(reader);
+}
+
+bool AttSystems::ReadSystems(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SYSTEMS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        element.remove_attribute("system.leftline");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToMeasurementabs(element.attribute("system.leftmar").value()));
-        element.remove_attribute("system.leftmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToMeasurementabs(element.attribute("system.rightmar").value()));
-        element.remove_attribute("system.rightmar");
-        hasAttribute = true;
-    }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToMeasurementabs(element.attribute("system.topmar").value()));
-        element.remove_attribute("system.topmar");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SYSTEMS)) {
+            case 0: this->SetSystemLeftline(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetSystemLeftmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 2: this->SetSystemRightmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            case 3: this->SetSystemTopmar(StrToMeasurementabs(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6577,10 +7307,20 @@ void AttTargetEval::ResetTargetEval()
 
 bool AttTargetEval::ReadTargetEval(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTargetEval(reader);
+}
+
+bool AttTargetEval::ReadTargetEval(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TARGETEVAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetEvalEvaluate(element.attribute("evaluate").value()));
-        element.remove_attribute("evaluate");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TARGETEVAL)) {
+            case 0: this->SetEvaluate(StrToTargetEvalEvaluate(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6623,10 +7363,20 @@ void AttTempoLog::ResetTempoLog()
 
 bool AttTempoLog::ReadTempoLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTempoLog(reader);
+}
+
+bool AttTempoLog::ReadTempoLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TEMPOLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TEMPOLOG)) {
+            case 0: this->SetFunc(StrToTempoLogFunc(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6670,15 +7420,21 @@ void AttTextRendition::ResetTextRendition()
 
 bool AttTextRendition::ReadTextRendition(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTextRendition(reader);
+}
+
+bool AttTextRendition::ReadTextRendition(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TEXTRENDITION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("altrend")) {
-        this->SetAltrend(StrToStr(element.attribute("altrend").value()));
-        element.remove_attribute("altrend");
-        hasAttribute = true;
-    }
-    if (element.attribute("rend")) {
-        this->SetRend(StrToTextrendition(element.attribute("rend").value()));
-        element.remove_attribute("rend");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TEXTRENDITION)) {
+            case 0: this->SetAltrend(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetRend(StrToTextrendition(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6734,30 +7490,24 @@ void AttTextStyle::ResetTextStyle()
 
 bool AttTextStyle::ReadTextStyle(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTextStyle(reader);
+}
+
+bool AttTextStyle::ReadTextStyle(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TEXTSTYLE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        element.remove_attribute("text.fam");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        element.remove_attribute("text.name");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToFontsize(element.attribute("text.size").value()));
-        element.remove_attribute("text.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        element.remove_attribute("text.style");
-        hasAttribute = true;
-    }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        element.remove_attribute("text.weight");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TEXTSTYLE)) {
+            case 0: this->SetTextFam(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetTextName(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetTextSize(StrToFontsize(reader.GetValue(i))); break;
+            case 3: this->SetTextStyle(StrToFontstyle(reader.GetValue(i))); break;
+            case 4: this->SetTextWeight(StrToFontweight(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6836,10 +7586,20 @@ void AttTiePresent::ResetTiePresent()
 
 bool AttTiePresent::ReadTiePresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTiePresent(reader);
+}
+
+bool AttTiePresent::ReadTiePresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIEPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        element.remove_attribute("tie");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIEPRESENT)) {
+            case 0: this->SetTie(StrToTie(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6882,10 +7642,20 @@ void AttTimestampLogical::ResetTimestampLogical()
 
 bool AttTimestampLogical::ReadTimestampLogical(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTimestampLogical(reader);
+}
+
+bool AttTimestampLogical::ReadTimestampLogical(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIMESTAMPLOGICAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        element.remove_attribute("tstamp");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIMESTAMPLOGICAL)) {
+            case 0: this->SetTstamp(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6928,10 +7698,20 @@ void AttTimestamp2Logical::ResetTimestamp2Logical()
 
 bool AttTimestamp2Logical::ReadTimestamp2Logical(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTimestamp2Logical(reader);
+}
+
+bool AttTimestamp2Logical::ReadTimestamp2Logical(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TIMESTAMP2LOGICAL)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        element.remove_attribute("tstamp2");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TIMESTAMP2LOGICAL)) {
+            case 0: this->SetTstamp2(StrToMeasurebeat(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6975,15 +7755,21 @@ void AttTransposition::ResetTransposition()
 
 bool AttTransposition::ReadTransposition(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTransposition(reader);
+}
+
+bool AttTransposition::ReadTransposition(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TRANSPOSITION)) return false;
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToDbl(element.attribute("trans.diat").value()));
-        element.remove_attribute("trans.diat");
-        hasAttribute = true;
-    }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToDbl(element.attribute("trans.semi").value()));
-        element.remove_attribute("trans.semi");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TRANSPOSITION)) {
+            case 0: this->SetTransDiat(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetTransSemi(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7035,10 +7821,20 @@ void AttTupletPresent::ResetTupletPresent()
 
 bool AttTupletPresent::ReadTupletPresent(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTupletPresent(reader);
+}
+
+bool AttTupletPresent::ReadTupletPresent(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TUPLETPRESENT)) return false;
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        element.remove_attribute("tuplet");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TUPLETPRESENT)) {
+            case 0: this->SetTuplet(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7081,10 +7877,20 @@ void AttTyped::ResetTyped()
 
 bool AttTyped::ReadTyped(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTyped(reader);
+}
+
+bool AttTyped::ReadTyped(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TYPED)) return false;
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        element.remove_attribute("type");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TYPED)) {
+            case 0: this->SetType(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7131,30 +7937,24 @@ void AttTypography::ResetTypography()
 
 bool AttTypography::ReadTypography(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTypography(reader);
+}
+
+bool AttTypography::ReadTypography(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TYPOGRAPHY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        element.remove_attribute("fontfam");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        element.remove_attribute("fontname");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToFontsize(element.attribute("fontsize").value()));
-        element.remove_attribute("fontsize");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        element.remove_attribute("fontstyle");
-        hasAttribute = true;
-    }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        element.remove_attribute("fontweight");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TYPOGRAPHY)) {
+            case 0: this->SetFontfam(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetFontname(StrToStr(reader.GetValue(i))); break;
+            case 2: this->SetFontsize(StrToFontsize(reader.GetValue(i))); break;
+            case 3: this->SetFontstyle(StrToFontstyle(reader.GetValue(i))); break;
+            case 4: this->SetFontweight(StrToFontweight(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7233,10 +8033,20 @@ void AttVerticalAlign::ResetVerticalAlign()
 
 bool AttVerticalAlign::ReadVerticalAlign(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVerticalAlign(reader);
+}
+
+bool AttVerticalAlign::ReadVerticalAlign(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VERTICALALIGN)) return false;
     bool hasAttribute = false;
-    if (element.attribute("valign")) {
-        this->SetValign(StrToVerticalalignment(element.attribute("valign").value()));
-        element.remove_attribute("valign");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VERTICALALIGN)) {
+            case 0: this->SetValign(StrToVerticalalignment(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7279,10 +8089,20 @@ void AttVerticalGroup::ResetVerticalGroup()
 
 bool AttVerticalGroup::ReadVerticalGroup(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVerticalGroup(reader);
+}
+
+bool AttVerticalGroup::ReadVerticalGroup(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VERTICALGROUP)) return false;
     bool hasAttribute = false;
-    if (element.attribute("vgrp")) {
-        this->SetVgrp(StrToInt(element.attribute("vgrp").value()));
-        element.remove_attribute("vgrp");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VERTICALGROUP)) {
+            case 0: this->SetVgrp(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7325,10 +8145,20 @@ void AttVisibility::ResetVisibility()
 
 bool AttVisibility::ReadVisibility(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisibility(reader);
+}
+
+bool AttVisibility::ReadVisibility(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISIBILITY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        element.remove_attribute("visible");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISIBILITY)) {
+            case 0: this->SetVisible(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7371,10 +8201,20 @@ void AttVisualOffsetHo::ResetVisualOffsetHo()
 
 bool AttVisualOffsetHo::ReadVisualOffsetHo(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisualOffsetHo(reader);
+}
+
+bool AttVisualOffsetHo::ReadVisualOffsetHo(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISUALOFFSETHO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToMeasurementrel(element.attribute("ho").value()));
-        element.remove_attribute("ho");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISUALOFFSETHO)) {
+            case 0: this->SetHo(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7417,10 +8257,20 @@ void AttVisualOffsetTo::ResetVisualOffsetTo()
 
 bool AttVisualOffsetTo::ReadVisualOffsetTo(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisualOffsetTo(reader);
+}
+
+bool AttVisualOffsetTo::ReadVisualOffsetTo(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISUALOFFSETTO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        element.remove_attribute("to");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISUALOFFSETTO)) {
+            case 0: this->SetTo(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7463,10 +8313,20 @@ void AttVisualOffsetVo::ResetVisualOffsetVo()
 
 bool AttVisualOffsetVo::ReadVisualOffsetVo(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisualOffsetVo(reader);
+}
+
+bool AttVisualOffsetVo::ReadVisualOffsetVo(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISUALOFFSETVO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToMeasurementrel(element.attribute("vo").value()));
-        element.remove_attribute("vo");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISUALOFFSETVO)) {
+            case 0: this->SetVo(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7510,15 +8370,21 @@ void AttVisualOffset2Ho::ResetVisualOffset2Ho()
 
 bool AttVisualOffset2Ho::ReadVisualOffset2Ho(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisualOffset2Ho(reader);
+}
+
+bool AttVisualOffset2Ho::ReadVisualOffset2Ho(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISUALOFFSET2HO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToMeasurementrel(element.attribute("startho").value()));
-        element.remove_attribute("startho");
-        hasAttribute = true;
-    }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToMeasurementrel(element.attribute("endho").value()));
-        element.remove_attribute("endho");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISUALOFFSET2HO)) {
+            case 0: this->SetStartho(StrToMeasurementrel(reader.GetValue(i))); break;
+            case 1: this->SetEndho(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7571,15 +8437,21 @@ void AttVisualOffset2To::ResetVisualOffset2To()
 
 bool AttVisualOffset2To::ReadVisualOffset2To(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisualOffset2To(reader);
+}
+
+bool AttVisualOffset2To::ReadVisualOffset2To(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISUALOFFSET2TO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        element.remove_attribute("startto");
-        hasAttribute = true;
-    }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        element.remove_attribute("endto");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISUALOFFSET2TO)) {
+            case 0: this->SetStartto(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetEndto(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7632,15 +8504,21 @@ void AttVisualOffset2Vo::ResetVisualOffset2Vo()
 
 bool AttVisualOffset2Vo::ReadVisualOffset2Vo(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVisualOffset2Vo(reader);
+}
+
+bool AttVisualOffset2Vo::ReadVisualOffset2Vo(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VISUALOFFSET2VO)) return false;
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToMeasurementrel(element.attribute("startvo").value()));
-        element.remove_attribute("startvo");
-        hasAttribute = true;
-    }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToMeasurementrel(element.attribute("endvo").value()));
-        element.remove_attribute("endvo");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VISUALOFFSET2VO)) {
+            case 0: this->SetStartvo(StrToMeasurementrel(reader.GetValue(i))); break;
+            case 1: this->SetEndvo(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7692,10 +8570,20 @@ void AttVoltaGroupingSym::ResetVoltaGroupingSym()
 
 bool AttVoltaGroupingSym::ReadVoltaGroupingSym(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadVoltaGroupingSym(reader);
+}
+
+bool AttVoltaGroupingSym::ReadVoltaGroupingSym(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_VOLTAGROUPINGSYM)) return false;
     bool hasAttribute = false;
-    if (element.attribute("voltasym")) {
-        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(element.attribute("voltasym").value()));
-        element.remove_attribute("voltasym");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_VOLTAGROUPINGSYM)) {
+            case 0: this->SetVoltasym(StrToVoltaGroupingSymVoltasym(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7738,10 +8626,20 @@ void AttWhitespace::ResetWhitespace()
 
 bool AttWhitespace::ReadWhitespace(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadWhitespace(reader);
+}
+
+bool AttWhitespace::ReadWhitespace(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_WHITESPACE)) return false;
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        element.remove_attribute("xml:space");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_WHITESPACE)) {
+            case 0: this->SetSpace(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7784,10 +8682,20 @@ void AttWidth::ResetWidth()
 
 bool AttWidth::ReadWidth(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadWidth(reader);
+}
+
+bool AttWidth::ReadWidth(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_WIDTH)) return false;
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToMeasurementabs(element.attribute("width").value()));
-        element.remove_attribute("width");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_WIDTH)) {
+            case 0: this->SetWidth(StrToMeasurementabs(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7831,15 +8739,21 @@ void AttXy::ResetXy()
 
 bool AttXy::ReadXy(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadXy(reader);
+}
+
+bool AttXy::ReadXy(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_XY)) return false;
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        element.remove_attribute("x");
-        hasAttribute = true;
-    }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        element.remove_attribute("y");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_XY)) {
+            case 0: this->SetX(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetY(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7892,15 +8806,21 @@ void AttXy2::ResetXy2()
 
 bool AttXy2::ReadXy2(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadXy2(reader);
+}
+
+bool AttXy2::ReadXy2(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_XY2)) return false;
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        element.remove_attribute("x2");
-        hasAttribute = true;
-    }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        element.remove_attribute("y2");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_XY2)) {
+            case 0: this->SetX2(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetY2(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
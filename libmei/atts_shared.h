@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAccidLog(pugi::xml_node element);
+    bool ReadAccidLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAccidLog(pugi::xml_node element);
@@ -75,6 +76,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAccidental(pugi::xml_node element);
+    bool ReadAccidental(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAccidental(pugi::xml_node element);
@@ -111,6 +113,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadArticulation(pugi::xml_node element);
+    bool ReadArticulation(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteArticulation(pugi::xml_node element);
@@ -153,6 +156,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAttaccaLog(pugi::xml_node element);
+    bool ReadAttaccaLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAttaccaLog(pugi::xml_node element);
@@ -189,6 +193,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAudience(pugi::xml_node element);
+    bool ReadAudience(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAudience(pugi::xml_node element);
@@ -225,6 +230,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAugmentDots(pugi::xml_node element);
+    bool ReadAugmentDots(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAugmentDots(pugi::xml_node element);
@@ -261,6 +267,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAuthorized(pugi::xml_node element);
+    bool ReadAuthorized(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAuthorized(pugi::xml_node element);
@@ -311,6 +318,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBarLineLog(pugi::xml_node element);
+    bool ReadBarLineLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBarLineLog(pugi::xml_node element);
@@ -347,6 +355,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBarring(pugi::xml_node element);
+    bool ReadBarring(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBarring(pugi::xml_node element);
@@ -402,6 +411,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBasic(pugi::xml_node element);
+    bool ReadBasic(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBasic(pugi::xml_node element);
@@ -438,6 +448,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBibl(pugi::xml_node element);
+    bool ReadBibl(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBibl(pugi::xml_node element);
@@ -477,6 +488,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCalendared(pugi::xml_node element);
+    bool ReadCalendared(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCalendared(pugi::xml_node element);
@@ -516,6 +528,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCanonical(pugi::xml_node element);
+    bool ReadCanonical(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCanonical(pugi::xml_node element);
@@ -556,6 +569,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadClassed(pugi::xml_node element);
+    bool ReadClassed(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteClassed(pugi::xml_node element);
@@ -595,6 +609,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadClefLog(pugi::xml_node element);
+    bool ReadClefLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteClefLog(pugi::xml_node element);
@@ -634,6 +649,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadClefShape(pugi::xml_node element);
+    bool ReadClefShape(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteClefShape(pugi::xml_node element);
@@ -670,6 +686,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCleffingLog(pugi::xml_node element);
+    bool ReadCleffingLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCleffingLog(pugi::xml_node element);
@@ -728,6 +745,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadColor(pugi::xml_node element);
+    bool ReadColor(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteColor(pugi::xml_node element);
@@ -767,6 +785,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadColoration(pugi::xml_node element);
+    bool ReadColoration(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteColoration(pugi::xml_node element);
@@ -810,6 +829,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCoordinated(pugi::xml_node element);
+    bool ReadCoordinated(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCoordinated(pugi::xml_node element);
@@ -864,6 +884,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCue(pugi::xml_node element);
+    bool ReadCue(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCue(pugi::xml_node element);
@@ -900,6 +921,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCurvature(pugi::xml_node element);
+    bool ReadCurvature(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCurvature(pugi::xml_node element);
@@ -959,6 +981,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCurveRend(pugi::xml_node element);
+    bool ReadCurveRend(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCurveRend(pugi::xml_node element);
@@ -1003,6 +1026,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCustosLog(pugi::xml_node element);
+    bool ReadCustosLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCustosLog(pugi::xml_node element);
@@ -1039,6 +1063,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDataPointing(pugi::xml_node element);
+    bool ReadDataPointing(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDataPointing(pugi::xml_node element);
@@ -1075,6 +1100,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDatable(pugi::xml_node element);
+    bool ReadDatable(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDatable(pugi::xml_node element);
@@ -1135,6 +1161,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDistances(pugi::xml_node element);
+    bool ReadDistances(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDistances(pugi::xml_node element);
@@ -1186,6 +1213,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDotLog(pugi::xml_node element);
+    bool ReadDotLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDotLog(pugi::xml_node element);
@@ -1222,6 +1250,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDurationAdditive(pugi::xml_node element);
+    bool ReadDurationAdditive(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDurationAdditive(pugi::xml_node element);
@@ -1261,6 +1290,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDurationDefault(pugi::xml_node element);
+    bool ReadDurationDefault(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDurationDefault(pugi::xml_node element);
@@ -1319,6 +1349,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDurationLogical(pugi::xml_node element);
+    bool ReadDurationLogical(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDurationLogical(pugi::xml_node element);
@@ -1358,6 +1389,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadDurationRatio(pugi::xml_node element);
+    bool ReadDurationRatio(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteDurationRatio(pugi::xml_node element);
@@ -1403,6 +1435,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadEnclosingChars(pugi::xml_node element);
+    bool ReadEnclosingChars(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteEnclosingChars(pugi::xml_node element);
@@ -1444,6 +1477,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadEndings(pugi::xml_node element);
+    bool ReadEndings(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteEndings(pugi::xml_node element);
@@ -1480,6 +1514,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadEvidence(pugi::xml_node element);
+    bool ReadEvidence(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteEvidence(pugi::xml_node element);
@@ -1525,6 +1560,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadExtender(pugi::xml_node element);
+    bool ReadExtender(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteExtender(pugi::xml_node element);
@@ -1561,6 +1597,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadExtent(pugi::xml_node element);
+    bool ReadExtent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteExtent(pugi::xml_node element);
@@ -1601,6 +1638,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFermataPresent(pugi::xml_node element);
+    bool ReadFermataPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFermataPresent(pugi::xml_node element);
@@ -1640,6 +1678,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFiling(pugi::xml_node element);
+    bool ReadFiling(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFiling(pugi::xml_node element);
@@ -1679,6 +1718,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadGrpSymLog(pugi::xml_node element);
+    bool ReadGrpSymLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteGrpSymLog(pugi::xml_node element);
@@ -1715,6 +1755,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHandIdent(pugi::xml_node element);
+    bool ReadHandIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHandIdent(pugi::xml_node element);
@@ -1754,6 +1795,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHeight(pugi::xml_node element);
+    bool ReadHeight(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHeight(pugi::xml_node element);
@@ -1790,6 +1832,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHorizontalAlign(pugi::xml_node element);
+    bool ReadHorizontalAlign(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHorizontalAlign(pugi::xml_node element);
@@ -1826,6 +1869,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadInternetMedia(pugi::xml_node element);
+    bool ReadInternetMedia(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteInternetMedia(pugi::xml_node element);
@@ -1866,6 +1910,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadJoined(pugi::xml_node element);
+    bool ReadJoined(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteJoined(pugi::xml_node element);
@@ -1909,6 +1954,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadKeySigLog(pugi::xml_node element);
+    bool ReadKeySigLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigLog(pugi::xml_node element);
@@ -1945,6 +1991,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadKeySigDefaultLog(pugi::xml_node element);
+    bool ReadKeySigDefaultLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultLog(pugi::xml_node element);
@@ -1981,6 +2028,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLabelled(pugi::xml_node element);
+    bool ReadLabelled(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLabelled(pugi::xml_node element);
@@ -2021,6 +2069,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLang(pugi::xml_node element);
+    bool ReadLang(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLang(pugi::xml_node element);
@@ -2063,6 +2112,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLayerLog(pugi::xml_node element);
+    bool ReadLayerLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLayerLog(pugi::xml_node element);
@@ -2099,6 +2149,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLayerIdent(pugi::xml_node element);
+    bool ReadLayerIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLayerIdent(pugi::xml_node element);
@@ -2135,6 +2186,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLineLoc(pugi::xml_node element);
+    bool ReadLineLoc(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLineLoc(pugi::xml_node element);
@@ -2175,6 +2227,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLineRend(pugi::xml_node element);
+    bool ReadLineRend(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLineRend(pugi::xml_node element);
@@ -2229,6 +2282,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLineRendBase(pugi::xml_node element);
+    bool ReadLineRendBase(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLineRendBase(pugi::xml_node element);
@@ -2285,6 +2339,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLinking(pugi::xml_node element);
+    bool ReadLinking(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLinking(pugi::xml_node element);
@@ -2375,6 +2430,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLyricStyle(pugi::xml_node element);
+    bool ReadLyricStyle(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLyricStyle(pugi::xml_node element);
@@ -2443,6 +2499,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeasureNumbers(pugi::xml_node element);
+    bool ReadMeasureNumbers(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeasureNumbers(pugi::xml_node element);
@@ -2479,6 +2536,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeasurement(pugi::xml_node element);
+    bool ReadMeasurement(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeasurement(pugi::xml_node element);
@@ -2515,6 +2573,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMediaBounds(pugi::xml_node element);
+    bool ReadMediaBounds(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMediaBounds(pugi::xml_node element);
@@ -2576,6 +2635,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMedium(pugi::xml_node element);
+    bool ReadMedium(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMedium(pugi::xml_node element);
@@ -2612,6 +2672,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeiVersion(pugi::xml_node element);
+    bool ReadMeiVersion(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeiVersion(pugi::xml_node element);
@@ -2648,6 +2709,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMensurLog(pugi::xml_node element);
+    bool ReadMensurLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMensurLog(pugi::xml_node element);
@@ -2690,6 +2752,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMetadataPointing(pugi::xml_node element);
+    bool ReadMetadataPointing(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMetadataPointing(pugi::xml_node element);
@@ -2730,6 +2793,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterConformance(pugi::xml_node element);
+    bool ReadMeterConformance(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterConformance(pugi::xml_node element);
@@ -2769,6 +2833,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterConformanceBar(pugi::xml_node element);
+    bool ReadMeterConformanceBar(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterConformanceBar(pugi::xml_node element);
@@ -2819,6 +2884,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterSigLog(pugi::xml_node element);
+    bool ReadMeterSigLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigLog(pugi::xml_node element);
@@ -2870,6 +2936,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterSigDefaultLog(pugi::xml_node element);
+    bool ReadMeterSigDefaultLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultLog(pugi::xml_node element);
@@ -2929,6 +2996,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMmTempo(pugi::xml_node element);
+    bool ReadMmTempo(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMmTempo(pugi::xml_node element);
@@ -2983,6 +3051,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMultinumMeasures(pugi::xml_node element);
+    bool ReadMultinumMeasures(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMultinumMeasures(pugi::xml_node element);
@@ -3022,6 +3091,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNInteger(pugi::xml_node element);
+    bool ReadNInteger(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNInteger(pugi::xml_node element);
@@ -3062,6 +3132,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNNumberLike(pugi::xml_node element);
+    bool ReadNNumberLike(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNNumberLike(pugi::xml_node element);
@@ -3102,6 +3173,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadName(pugi::xml_node element);
+    bool ReadName(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteName(pugi::xml_node element);
@@ -3150,6 +3222,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNotationStyle(pugi::xml_node element);
+    bool ReadNotationStyle(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNotationStyle(pugi::xml_node element);
@@ -3194,6 +3267,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadNoteHeads(pugi::xml_node element);
+    bool ReadNoteHeads(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteNoteHeads(pugi::xml_node element);
@@ -3291,6 +3365,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOctave(pugi::xml_node element);
+    bool ReadOctave(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOctave(pugi::xml_node element);
@@ -3327,6 +3402,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOctaveDefault(pugi::xml_node element);
+    bool ReadOctaveDefault(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveDefault(pugi::xml_node element);
@@ -3367,6 +3443,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOctaveDisplacement(pugi::xml_node element);
+    bool ReadOctaveDisplacement(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveDisplacement(pugi::xml_node element);
@@ -3409,6 +3486,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOneLineStaff(pugi::xml_node element);
+    bool ReadOneLineStaff(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOneLineStaff(pugi::xml_node element);
@@ -3449,6 +3527,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOptimization(pugi::xml_node element);
+    bool ReadOptimization(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOptimization(pugi::xml_node element);
@@ -3488,6 +3567,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOriginLayerIdent(pugi::xml_node element);
+    bool ReadOriginLayerIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOriginLayerIdent(pugi::xml_node element);
@@ -3524,6 +3604,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOriginStaffIdent(pugi::xml_node element);
+    bool ReadOriginStaffIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOriginStaffIdent(pugi::xml_node element);
@@ -3563,6 +3644,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOriginStartEndId(pugi::xml_node element);
+    bool ReadOriginStartEndId(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOriginStartEndId(pugi::xml_node element);
@@ -3605,6 +3687,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadOriginTimestampLogical(pugi::xml_node element);
+    bool ReadOriginTimestampLogical(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteOriginTimestampLogical(pugi::xml_node element);
@@ -3654,6 +3737,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPages(pugi::xml_node element);
+    bool ReadPages(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePages(pugi::xml_node element);
@@ -3738,6 +3822,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPartIdent(pugi::xml_node element);
+    bool ReadPartIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePartIdent(pugi::xml_node element);
@@ -3786,6 +3871,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPitch(pugi::xml_node element);
+    bool ReadPitch(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePitch(pugi::xml_node element);
@@ -3822,6 +3908,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPlacement(pugi::xml_node element);
+    bool ReadPlacement(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePlacement(pugi::xml_node element);
@@ -3858,6 +3945,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPlist(pugi::xml_node element);
+    bool ReadPlist(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePlist(pugi::xml_node element);
@@ -3900,6 +3988,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPointing(pugi::xml_node element);
+    bool ReadPointing(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePointing(pugi::xml_node element);
@@ -3966,6 +4055,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadQuantity(pugi::xml_node element);
+    bool ReadQuantity(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteQuantity(pugi::xml_node element);
@@ -4005,6 +4095,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadRanging(pugi::xml_node element);
+    bool ReadRanging(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteRanging(pugi::xml_node element);
@@ -4075,6 +4166,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadResponsibility(pugi::xml_node element);
+    bool ReadResponsibility(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteResponsibility(pugi::xml_node element);
@@ -4115,6 +4207,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadScalable(pugi::xml_node element);
+    bool ReadScalable(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteScalable(pugi::xml_node element);
@@ -4151,6 +4244,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSequence(pugi::xml_node element);
+    bool ReadSequence(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSequence(pugi::xml_node element);
@@ -4190,6 +4284,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSlashCount(pugi::xml_node element);
+    bool ReadSlashCount(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSlashCount(pugi::xml_node element);
@@ -4226,6 +4321,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSlurPresent(pugi::xml_node element);
+    bool ReadSlurPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSlurPresent(pugi::xml_node element);
@@ -4265,6 +4361,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSource(pugi::xml_node element);
+    bool ReadSource(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSource(pugi::xml_node element);
@@ -4305,6 +4402,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSpacing(pugi::xml_node element);
+    bool ReadSpacing(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSpacing(pugi::xml_node element);
@@ -4368,6 +4466,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffLog(pugi::xml_node element);
+    bool ReadStaffLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLog(pugi::xml_node element);
@@ -4404,6 +4503,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffDefLog(pugi::xml_node element);
+    bool ReadStaffDefLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffDefLog(pugi::xml_node element);
@@ -4440,6 +4540,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffGroupingSym(pugi::xml_node element);
+    bool ReadStaffGroupingSym(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffGroupingSym(pugi::xml_node element);
@@ -4476,6 +4577,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffIdent(pugi::xml_node element);
+    bool ReadStaffIdent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffIdent(pugi::xml_node element);
@@ -4516,6 +4618,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffItems(pugi::xml_node element);
+    bool ReadStaffItems(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffItems(pugi::xml_node element);
@@ -4570,6 +4673,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffLoc(pugi::xml_node element);
+    bool ReadStaffLoc(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLoc(pugi::xml_node element);
@@ -4606,6 +4710,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffLocPitched(pugi::xml_node element);
+    bool ReadStaffLocPitched(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLocPitched(pugi::xml_node element);
@@ -4648,6 +4753,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStartEndId(pugi::xml_node element);
+    bool ReadStartEndId(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStartEndId(pugi::xml_node element);
@@ -4687,6 +4793,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStartId(pugi::xml_node element);
+    bool ReadStartId(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStartId(pugi::xml_node element);
@@ -4726,6 +4833,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStems(pugi::xml_node element);
+    bool ReadStems(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStems(pugi::xml_node element);
@@ -4801,6 +4909,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSylLog(pugi::xml_node element);
+    bool ReadSylLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSylLog(pugi::xml_node element);
@@ -4846,6 +4955,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSylText(pugi::xml_node element);
+    bool ReadSylText(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSylText(pugi::xml_node element);
@@ -4882,6 +4992,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSystems(pugi::xml_node element);
+    bool ReadSystems(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSystems(pugi::xml_node element);
@@ -4949,6 +5060,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTargetEval(pugi::xml_node element);
+    bool ReadTargetEval(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTargetEval(pugi::xml_node element);
@@ -4988,6 +5100,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTempoLog(pugi::xml_node element);
+    bool ReadTempoLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTempoLog(pugi::xml_node element);
@@ -5024,6 +5137,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTextRendition(pugi::xml_node element);
+    bool ReadTextRendition(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTextRendition(pugi::xml_node element);
@@ -5066,6 +5180,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTextStyle(pugi::xml_node element);
+    bool ReadTextStyle(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTextStyle(pugi::xml_node element);
@@ -5143,6 +5258,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTiePresent(pugi::xml_node element);
+    bool ReadTiePresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTiePresent(pugi::xml_node element);
@@ -5182,6 +5298,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTimestampLogical(pugi::xml_node element);
+    bool ReadTimestampLogical(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTimestampLogical(pugi::xml_node element);
@@ -5221,6 +5338,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTimestamp2Logical(pugi::xml_node element);
+    bool ReadTimestamp2Logical(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Logical(pugi::xml_node element);
@@ -5260,6 +5378,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTransposition(pugi::xml_node element);
+    bool ReadTransposition(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTransposition(pugi::xml_node element);
@@ -5308,6 +5427,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTupletPresent(pugi::xml_node element);
+    bool ReadTupletPresent(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTupletPresent(pugi::xml_node element);
@@ -5347,6 +5467,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTyped(pugi::xml_node element);
+    bool ReadTyped(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTyped(pugi::xml_node element);
@@ -5386,6 +5507,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTypography(pugi::xml_node element);
+    bool ReadTypography(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTypography(pugi::xml_node element);
@@ -5452,6 +5574,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVerticalAlign(pugi::xml_node element);
+    bool ReadVerticalAlign(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVerticalAlign(pugi::xml_node element);
@@ -5488,6 +5611,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVerticalGroup(pugi::xml_node element);
+    bool ReadVerticalGroup(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVerticalGroup(pugi::xml_node element);
@@ -5524,6 +5648,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisibility(pugi::xml_node element);
+    bool ReadVisibility(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisibility(pugi::xml_node element);
@@ -5563,6 +5688,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisualOffsetHo(pugi::xml_node element);
+    bool ReadVisualOffsetHo(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetHo(pugi::xml_node element);
@@ -5603,6 +5729,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisualOffsetTo(pugi::xml_node element);
+    bool ReadVisualOffsetTo(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetTo(pugi::xml_node element);
@@ -5642,6 +5769,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisualOffsetVo(pugi::xml_node element);
+    bool ReadVisualOffsetVo(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetVo(pugi::xml_node element);
@@ -5682,6 +5810,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisualOffset2Ho(pugi::xml_node element);
+    bool ReadVisualOffset2Ho(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2Ho(pugi::xml_node element);
@@ -5730,6 +5859,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisualOffset2To(pugi::xml_node element);
+    bool ReadVisualOffset2To(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2To(pugi::xml_node element);
@@ -5778,6 +5908,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVisualOffset2Vo(pugi::xml_node element);
+    bool ReadVisualOffset2Vo(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2Vo(pugi::xml_node element);
@@ -5826,6 +5957,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadVoltaGroupingSym(pugi::xml_node element);
+    bool ReadVoltaGroupingSym(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteVoltaGroupingSym(pugi::xml_node element);
@@ -5862,6 +5994,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadWhitespace(pugi::xml_node element);
+    bool ReadWhitespace(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteWhitespace(pugi::xml_node element);
@@ -5898,6 +6031,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadWidth(pugi::xml_node element);
+    bool ReadWidth(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteWidth(pugi::xml_node element);
@@ -5934,6 +6068,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadXy(pugi::xml_node element);
+    bool ReadXy(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteXy(pugi::xml_node element);
@@ -5984,6 +6119,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadXy2(pugi::xml_node element);
+    bool ReadXy2(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteXy2(pugi::xml_node element);
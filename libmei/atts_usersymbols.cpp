@@ -46,10 +46,20 @@ void AttAltSym::ResetAltSym()
 
 bool AttAltSym::ReadAltSym(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAltSym(reader);
+}
+
+bool AttAltSym::ReadAltSym(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ALTSYM)) return false;
     bool hasAttribute = false;
-    if (element.attribute("altsym")) {
-        this->SetAltsym(StrToStr(element.attribute("altsym").value()));
-        element.remove_attribute("altsym");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ALTSYM)) {
+            case 0: this->SetAltsym(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -92,10 +102,20 @@ void AttAnchoredTextLog::ResetAnchoredTextLog()
 
 bool AttAnchoredTextLog::ReadAnchoredTextLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAnchoredTextLog(reader);
+}
+
+bool AttAnchoredTextLog::ReadAnchoredTextLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ANCHOREDTEXTLOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ANCHOREDTEXTLOG)) {
+            case 0: this->SetFunc(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,10 +158,20 @@ void AttCurveLog::ResetCurveLog()
 
 bool AttCurveLog::ReadCurveLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCurveLog(reader);
+}
+
+bool AttCurveLog::ReadCurveLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CURVELOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CURVELOG)) {
+            case 0: this->SetFunc(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -184,10 +214,20 @@ void AttLineLog::ResetLineLog()
 
 bool AttLineLog::ReadLineLog(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLineLog(reader);
+}
+
+bool AttLineLog::ReadLineLog(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LINELOG)) return false;
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LINELOG)) {
+            case 0: this->SetFunc(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAltSym(pugi::xml_node element);
+    bool ReadAltSym(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAltSym(pugi::xml_node element);
@@ -78,6 +79,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAnchoredTextLog(pugi::xml_node element);
+    bool ReadAnchoredTextLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAnchoredTextLog(pugi::xml_node element);
@@ -114,6 +116,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCurveLog(pugi::xml_node element);
+    bool ReadCurveLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCurveLog(pugi::xml_node element);
@@ -150,6 +153,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLineLog(pugi::xml_node element);
+    bool ReadLineLog(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLineLog(pugi::xml_node element);
@@ -46,10 +46,20 @@ void AttAnnotVis::ResetAnnotVis()
 
 bool AttAnnotVis::ReadAnnotVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadAnnotVis(reader);
+}
+
+bool AttAnnotVis::ReadAnnotVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ANNOTVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToPlacement(element.attribute("place").value()));
-        element.remove_attribute("place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ANNOTVIS)) {
+            case 0: this->SetPlace(StrToPlacement(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -98,40 +108,26 @@ void AttArpegVis::ResetArpegVis()
 
 bool AttArpegVis::ReadArpegVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadArpegVis(reader);
+}
+
+bool AttArpegVis::ReadArpegVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_ARPEGVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        element.remove_attribute("arrow");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.shape")) {
-        this->SetArrowShape(StrToLinestartendsymbol(element.attribute("arrow.shape").value()));
-        element.remove_attribute("arrow.shape");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.size")) {
-        this->SetArrowSize(StrToInt(element.attribute("arrow.size").value()));
-        element.remove_attribute("arrow.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.color")) {
-        this->SetArrowColor(StrToStr(element.attribute("arrow.color").value()));
-        element.remove_attribute("arrow.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("arrow.fillcolor")) {
-        this->SetArrowFillcolor(StrToStr(element.attribute("arrow.fillcolor").value()));
-        element.remove_attribute("arrow.fillcolor");
-        hasAttribute = true;
-    }
-    if (element.attribute("line.form")) {
-        this->SetLineForm(StrToLineform(element.attribute("line.form").value()));
-        element.remove_attribute("line.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("line.width")) {
-        this->SetLineWidth(StrToLinewidth(element.attribute("line.width").value()));
-        element.remove_attribute("line.width");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_ARPEGVIS)) {
+            case 0: this->SetArrow(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetArrowShape(StrToLinestartendsymbol(reader.GetValue(i))); break;
+            case 2: this->SetArrowSize(StrToInt(reader.GetValue(i))); break;
+            case 3: this->SetArrowColor(StrToStr(reader.GetValue(i))); break;
+            case 4: this->SetArrowFillcolor(StrToStr(reader.GetValue(i))); break;
+            case 5: this->SetLineForm(StrToLineform(reader.GetValue(i))); break;
+            case 6: this->SetLineWidth(StrToLinewidth(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -230,20 +226,22 @@ void AttBarLineVis::ResetBarLineVis()
 
 bool AttBarLineVis::ReadBarLineVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBarLineVis(reader);
+}
+
+bool AttBarLineVis::ReadBarLineVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BARLINEVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("len")) {
-        this->SetLen(StrToDbl(element.attribute("len").value()));
-        element.remove_attribute("len");
-        hasAttribute = true;
-    }
-    if (element.attribute("method")) {
-        this->SetMethod(StrToBarmethod(element.attribute("method").value()));
-        element.remove_attribute("method");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToInt(element.attribute("place").value()));
-        element.remove_attribute("place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BARLINEVIS)) {
+            case 0: this->SetLen(StrToDbl(reader.GetValue(i))); break;
+            case 1: this->SetMethod(StrToBarmethod(reader.GetValue(i))); break;
+            case 2: this->SetPlace(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -306,20 +304,22 @@ void AttBeamingVis::ResetBeamingVis()
 
 bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeamingVis(reader);
+}
+
+bool AttBeamingVis::ReadBeamingVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEAMINGVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        element.remove_attribute("beam.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        element.remove_attribute("beam.rend");
-        hasAttribute = true;
-    }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        element.remove_attribute("beam.slope");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEAMINGVIS)) {
+            case 0: this->SetBeamColor(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetBeamRend(StrToBeamingVisBeamrend(reader.GetValue(i))); break;
+            case 2: this->SetBeamSlope(StrToDbl(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -380,10 +380,20 @@ void AttBeatRptVis::ResetBeatRptVis()
 
 bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadBeatRptVis(reader);
+}
+
+bool AttBeatRptVis::ReadBeatRptVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_BEATRPTVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBeatrptRend(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_BEATRPTVIS)) {
+            case 0: this->SetSlash(StrToBeatrptRend(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -426,10 +436,20 @@ void AttChordVis::ResetChordVis()
 
 bool AttChordVis::ReadChordVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadChordVis(reader);
+}
+
+bool AttChordVis::ReadChordVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CHORDVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        element.remove_attribute("cluster");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CHORDVIS)) {
+            case 0: this->SetCluster(StrToCluster(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -473,15 +493,21 @@ void AttCleffingVis::ResetCleffingVis()
 
 bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadCleffingVis(reader);
+}
+
+bool AttCleffingVis::ReadCleffingVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_CLEFFINGVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        element.remove_attribute("clef.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        element.remove_attribute("clef.visible");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_CLEFFINGVIS)) {
+            case 0: this->SetClefColor(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetClefVisible(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -534,15 +560,21 @@ void AttEpisemaVis::ResetEpisemaVis()
 
 bool AttEpisemaVis::ReadEpisemaVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadEpisemaVis(reader);
+}
+
+bool AttEpisemaVis::ReadEpisemaVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_EPISEMAVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToEpisemaVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_EPISEMAVIS)) {
+            case 0: this->SetForm(StrToEpisemaVisForm(reader.GetValue(i))); break;
+            case 1: this->SetPlace(StrToEventrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -596,20 +628,22 @@ void AttFTremVis::ResetFTremVis()
 
 bool AttFTremVis::ReadFTremVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFTremVis(reader);
+}
+
+bool AttFTremVis::ReadFTremVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FTREMVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("beams")) {
-        this->SetBeams(StrToInt(element.attribute("beams").value()));
-        element.remove_attribute("beams");
-        hasAttribute = true;
-    }
-    if (element.attribute("beams.float")) {
-        this->SetBeamsFloat(StrToInt(element.attribute("beams.float").value()));
-        element.remove_attribute("beams.float");
-        hasAttribute = true;
-    }
-    if (element.attribute("float.gap")) {
-        this->SetFloatGap(StrToMeasurementabs(element.attribute("float.gap").value()));
-        element.remove_attribute("float.gap");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FTREMVIS)) {
+            case 0: this->SetBeams(StrToInt(reader.GetValue(i))); break;
+            case 1: this->SetBeamsFloat(StrToInt(reader.GetValue(i))); break;
+            case 2: this->SetFloatGap(StrToMeasurementabs(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -671,15 +705,21 @@ void AttFermataVis::ResetFermataVis()
 
 bool AttFermataVis::ReadFermataVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFermataVis(reader);
+}
+
+bool AttFermataVis::ReadFermataVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FERMATAVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FERMATAVIS)) {
+            case 0: this->SetForm(StrToFermataVisForm(reader.GetValue(i))); break;
+            case 1: this->SetShape(StrToFermataVisShape(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -731,10 +771,20 @@ void AttFingGrpVis::ResetFingGrpVis()
 
 bool AttFingGrpVis::ReadFingGrpVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadFingGrpVis(reader);
+}
+
+bool AttFingGrpVis::ReadFingGrpVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_FINGGRPVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToFingGrpVisOrient(element.attribute("orient").value()));
-        element.remove_attribute("orient");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_FINGGRPVIS)) {
+            case 0: this->SetOrient(StrToFingGrpVisOrient(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -777,10 +827,20 @@ void AttHairpinVis::ResetHairpinVis()
 
 bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHairpinVis(reader);
+}
+
+bool AttHairpinVis::ReadHairpinVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HAIRPINVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToMeasurementabs(element.attribute("opening").value()));
-        element.remove_attribute("opening");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HAIRPINVIS)) {
+            case 0: this->SetOpening(StrToMeasurementabs(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -823,10 +883,20 @@ void AttHarmVis::ResetHarmVis()
 
 bool AttHarmVis::ReadHarmVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHarmVis(reader);
+}
+
+bool AttHarmVis::ReadHarmVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HARMVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        element.remove_attribute("rendgrid");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HARMVIS)) {
+            case 0: this->SetRendgrid(StrToHarmVisRendgrid(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -870,15 +940,21 @@ void AttHispanTickVis::ResetHispanTickVis()
 
 bool AttHispanTickVis::ReadHispanTickVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadHispanTickVis(reader);
+}
+
+bool AttHispanTickVis::ReadHispanTickVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_HISPANTICKVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        element.remove_attribute("place");
-        hasAttribute = true;
-    }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        element.remove_attribute("tilt");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_HISPANTICKVIS)) {
+            case 0: this->SetPlace(StrToEventrel(reader.GetValue(i))); break;
+            case 1: this->SetTilt(StrToCompassdirection(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -930,10 +1006,20 @@ void AttKeySigVis::ResetKeySigVis()
 
 bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadKeySigVis(reader);
+}
+
+bool AttKeySigVis::ReadKeySigVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_KEYSIGVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("sig.showchange")) {
-        this->SetSigShowchange(StrToBoolean(element.attribute("sig.showchange").value()));
-        element.remove_attribute("sig.showchange");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_KEYSIGVIS)) {
+            case 0: this->SetSigShowchange(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -977,15 +1063,21 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
 
 bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadKeySigDefaultVis(reader);
+}
+
+bool AttKeySigDefaultVis::ReadKeySigDefaultVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_KEYSIGDEFAULTVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("keysig.show")) {
-        this->SetKeysigShow(StrToBoolean(element.attribute("keysig.show").value()));
-        element.remove_attribute("keysig.show");
-        hasAttribute = true;
-    }
-    if (element.attribute("keysig.showchange")) {
-        this->SetKeysigShowchange(StrToBoolean(element.attribute("keysig.showchange").value()));
-        element.remove_attribute("keysig.showchange");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_KEYSIGDEFAULTVIS)) {
+            case 0: this->SetKeysigShow(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetKeysigShowchange(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1042,35 +1134,25 @@ void AttLineVis::ResetLineVis()
 
 bool AttLineVis::ReadLineVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLineVis(reader);
+}
+
+bool AttLineVis::ReadLineVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LINEVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToLinewidth(element.attribute("width").value()));
-        element.remove_attribute("width");
-        hasAttribute = true;
-    }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        element.remove_attribute("endsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("endsym.size")) {
-        this->SetEndsymSize(StrToInt(element.attribute("endsym.size").value()));
-        element.remove_attribute("endsym.size");
-        hasAttribute = true;
-    }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        element.remove_attribute("startsym");
-        hasAttribute = true;
-    }
-    if (element.attribute("startsym.size")) {
-        this->SetStartsymSize(StrToInt(element.attribute("startsym.size").value()));
-        element.remove_attribute("startsym.size");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LINEVIS)) {
+            case 0: this->SetForm(StrToLineform(reader.GetValue(i))); break;
+            case 1: this->SetWidth(StrToLinewidth(reader.GetValue(i))); break;
+            case 2: this->SetEndsym(StrToLinestartendsymbol(reader.GetValue(i))); break;
+            case 3: this->SetEndsymSize(StrToInt(reader.GetValue(i))); break;
+            case 4: this->SetStartsym(StrToLinestartendsymbol(reader.GetValue(i))); break;
+            case 5: this->SetStartsymSize(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1159,15 +1241,21 @@ void AttLiquescentVis::ResetLiquescentVis()
 
 bool AttLiquescentVis::ReadLiquescentVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadLiquescentVis(reader);
+}
+
+bool AttLiquescentVis::ReadLiquescentVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_LIQUESCENTVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToLiquescentVisCurve(element.attribute("curve").value()));
-        element.remove_attribute("curve");
-        hasAttribute = true;
-    }
-    if (element.attribute("looped")) {
-        this->SetLooped(StrToBoolean(element.attribute("looped").value()));
-        element.remove_attribute("looped");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_LIQUESCENTVIS)) {
+            case 0: this->SetCurve(StrToLiquescentVisCurve(reader.GetValue(i))); break;
+            case 1: this->SetLooped(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1220,15 +1308,21 @@ void AttMensurVis::ResetMensurVis()
 
 bool AttMensurVis::ReadMensurVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMensurVis(reader);
+}
+
+bool AttMensurVis::ReadMensurVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MENSURVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
-        hasAttribute = true;
-    }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        element.remove_attribute("orient");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MENSURVIS)) {
+            case 0: this->SetForm(StrToMensurVisForm(reader.GetValue(i))); break;
+            case 1: this->SetOrient(StrToOrientation(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1284,30 +1378,24 @@ void AttMensuralVis::ResetMensuralVis()
 
 bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMensuralVis(reader);
+}
+
+bool AttMensuralVis::ReadMensuralVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MENSURALVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        element.remove_attribute("mensur.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        element.remove_attribute("mensur.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        element.remove_attribute("mensur.loc");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        element.remove_attribute("mensur.orient");
-        hasAttribute = true;
-    }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToFontsize(element.attribute("mensur.size").value()));
-        element.remove_attribute("mensur.size");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MENSURALVIS)) {
+            case 0: this->SetMensurColor(StrToStr(reader.GetValue(i))); break;
+            case 1: this->SetMensurForm(StrToMensuralVisMensurform(reader.GetValue(i))); break;
+            case 2: this->SetMensurLoc(StrToInt(reader.GetValue(i))); break;
+            case 3: this->SetMensurOrient(StrToOrientation(reader.GetValue(i))); break;
+            case 4: this->SetMensurSize(StrToFontsize(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1386,10 +1474,20 @@ void AttMeterSigVis::ResetMeterSigVis()
 
 bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterSigVis(reader);
+}
+
+bool AttMeterSigVis::ReadMeterSigVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERSIGVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERSIGVIS)) {
+            case 0: this->SetForm(StrToMeterform(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1433,15 +1531,21 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
 
 bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMeterSigDefaultVis(reader);
+}
+
+bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_METERSIGDEFAULTVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("meter.form")) {
-        this->SetMeterForm(StrToMeterform(element.attribute("meter.form").value()));
-        element.remove_attribute("meter.form");
-        hasAttribute = true;
-    }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        element.remove_attribute("meter.showchange");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_METERSIGDEFAULTVIS)) {
+            case 0: this->SetMeterForm(StrToMeterform(reader.GetValue(i))); break;
+            case 1: this->SetMeterShowchange(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1493,10 +1597,20 @@ void AttMultiRestVis::ResetMultiRestVis()
 
 bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadMultiRestVis(reader);
+}
+
+bool AttMultiRestVis::ReadMultiRestVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_MULTIRESTVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        element.remove_attribute("block");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_MULTIRESTVIS)) {
+            case 0: this->SetBlock(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1539,10 +1653,20 @@ void AttPbVis::ResetPbVis()
 
 bool AttPbVis::ReadPbVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPbVis(reader);
+}
+
+bool AttPbVis::ReadPbVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PBVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        element.remove_attribute("folium");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PBVIS)) {
+            case 0: this->SetFolium(StrToPbVisFolium(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1585,10 +1709,20 @@ void AttPedalVis::ResetPedalVis()
 
 bool AttPedalVis::ReadPedalVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadPedalVis(reader);
+}
+
+bool AttPedalVis::ReadPedalVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_PEDALVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_PEDALVIS)) {
+            case 0: this->SetForm(StrToPedalVisForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1631,10 +1765,20 @@ void AttQuilismaVis::ResetQuilismaVis()
 
 bool AttQuilismaVis::ReadQuilismaVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadQuilismaVis(reader);
+}
+
+bool AttQuilismaVis::ReadQuilismaVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_QUILISMAVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("waves")) {
-        this->SetWaves(StrToInt(element.attribute("waves").value()));
-        element.remove_attribute("waves");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_QUILISMAVIS)) {
+            case 0: this->SetWaves(StrToInt(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1677,10 +1821,20 @@ void AttSbVis::ResetSbVis()
 
 bool AttSbVis::ReadSbVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSbVis(reader);
+}
+
+bool AttSbVis::ReadSbVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SBVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SBVIS)) {
+            case 0: this->SetForm(StrToSbVisForm(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1723,10 +1877,20 @@ void AttScoreDefVis::ResetScoreDefVis()
 
 bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadScoreDefVis(reader);
+}
+
+bool AttScoreDefVis::ReadScoreDefVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SCOREDEFVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        element.remove_attribute("vu.height");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SCOREDEFVIS)) {
+            case 0: this->SetVuHeight(StrToStr(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1769,10 +1933,20 @@ void AttSectionVis::ResetSectionVis()
 
 bool AttSectionVis::ReadSectionVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSectionVis(reader);
+}
+
+bool AttSectionVis::ReadSectionVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SECTIONVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        element.remove_attribute("restart");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SECTIONVIS)) {
+            case 0: this->SetRestart(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1815,10 +1989,20 @@ void AttSignifLetVis::ResetSignifLetVis()
 
 bool AttSignifLetVis::ReadSignifLetVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSignifLetVis(reader);
+}
+
+bool AttSignifLetVis::ReadSignifLetVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SIGNIFLETVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SIGNIFLETVIS)) {
+            case 0: this->SetPlace(StrToEventrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1861,10 +2045,20 @@ void AttSpaceVis::ResetSpaceVis()
 
 bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadSpaceVis(reader);
+}
+
+bool AttSpaceVis::ReadSpaceVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_SPACEVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        element.remove_attribute("compressable");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_SPACEVIS)) {
+            case 0: this->SetCompressable(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1911,30 +2105,24 @@ void AttStaffDefVis::ResetStaffDefVis()
 
 bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffDefVis(reader);
+}
+
+bool AttStaffDefVis::ReadStaffDefVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFDEFVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
-        hasAttribute = true;
-    }
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        element.remove_attribute("layerscheme");
-        hasAttribute = true;
-    }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        element.remove_attribute("lines.color");
-        hasAttribute = true;
-    }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        element.remove_attribute("lines.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToMeasurementrel(element.attribute("spacing").value()));
-        element.remove_attribute("spacing");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFDEFVIS)) {
+            case 0: this->SetGridShow(StrToBoolean(reader.GetValue(i))); break;
+            case 1: this->SetLayerscheme(StrToLayerscheme(reader.GetValue(i))); break;
+            case 2: this->SetLinesColor(StrToStr(reader.GetValue(i))); break;
+            case 3: this->SetLinesVisible(StrToBoolean(reader.GetValue(i))); break;
+            case 4: this->SetSpacing(StrToMeasurementrel(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2013,10 +2201,20 @@ void AttStaffGrpVis::ResetStaffGrpVis()
 
 bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadStaffGrpVis(reader);
+}
+
+bool AttStaffGrpVis::ReadStaffGrpVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_STAFFGRPVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("bar.thru")) {
-        this->SetBarThru(StrToBoolean(element.attribute("bar.thru").value()));
-        element.remove_attribute("bar.thru");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_STAFFGRPVIS)) {
+            case 0: this->SetBarThru(StrToBoolean(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2062,25 +2260,23 @@ void AttTupletVis::ResetTupletVis()
 
 bool AttTupletVis::ReadTupletVis(pugi::xml_node element)
 {
+    AttReader reader(element);
+    return this->ReadTupletVis(reader);
+}
+
+bool AttTupletVis::ReadTupletVis(AttReader &reader)
+{
+    if (!reader.HasAttClass(ATT_TUPLETVIS)) return false;
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToStaffrelBasic(element.attribute("bracket.place").value()));
-        element.remove_attribute("bracket.place");
-        hasAttribute = true;
-    }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        element.remove_attribute("bracket.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        element.remove_attribute("dur.visible");
-        hasAttribute = true;
-    }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        element.remove_attribute("num.format");
+    for (int i = 0; i < reader.GetAttributeCount(); ++i) {
+        switch (reader.GetNameIndex(i, ATT_TUPLETVIS)) {
+            case 0: this->SetBracketPlace(StrToStaffrelBasic(reader.GetValue(i))); break;
+            case 1: this->SetBracketVisible(StrToBoolean(reader.GetValue(i))); break;
+            case 2: this->SetDurVisible(StrToBoolean(reader.GetValue(i))); break;
+            case 3: this->SetNumFormat(StrToTupletVisNumformat(reader.GetValue(i))); break;
+            default: continue;
+        }
+        reader.Remove(i);
         hasAttribute = true;
     }
     return hasAttribute;
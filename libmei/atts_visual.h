@@ -39,6 +39,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadAnnotVis(pugi::xml_node element);
+    bool ReadAnnotVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteAnnotVis(pugi::xml_node element);
@@ -77,6 +78,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadArpegVis(pugi::xml_node element);
+    bool ReadArpegVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteArpegVis(pugi::xml_node element);
@@ -151,6 +153,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBarLineVis(pugi::xml_node element);
+    bool ReadBarLineVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBarLineVis(pugi::xml_node element);
@@ -203,6 +206,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeamingVis(pugi::xml_node element);
+    bool ReadBeamingVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeamingVis(pugi::xml_node element);
@@ -251,6 +255,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadBeatRptVis(pugi::xml_node element);
+    bool ReadBeatRptVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteBeatRptVis(pugi::xml_node element);
@@ -287,6 +292,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadChordVis(pugi::xml_node element);
+    bool ReadChordVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteChordVis(pugi::xml_node element);
@@ -328,6 +334,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadCleffingVis(pugi::xml_node element);
+    bool ReadCleffingVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteCleffingVis(pugi::xml_node element);
@@ -370,6 +377,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadEpisemaVis(pugi::xml_node element);
+    bool ReadEpisemaVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteEpisemaVis(pugi::xml_node element);
@@ -412,6 +420,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFTremVis(pugi::xml_node element);
+    bool ReadFTremVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFTremVis(pugi::xml_node element);
@@ -460,6 +469,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFermataVis(pugi::xml_node element);
+    bool ReadFermataVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFermataVis(pugi::xml_node element);
@@ -502,6 +512,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadFingGrpVis(pugi::xml_node element);
+    bool ReadFingGrpVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteFingGrpVis(pugi::xml_node element);
@@ -538,6 +549,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHairpinVis(pugi::xml_node element);
+    bool ReadHairpinVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHairpinVis(pugi::xml_node element);
@@ -577,6 +589,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHarmVis(pugi::xml_node element);
+    bool ReadHarmVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHarmVis(pugi::xml_node element);
@@ -613,6 +626,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadHispanTickVis(pugi::xml_node element);
+    bool ReadHispanTickVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteHispanTickVis(pugi::xml_node element);
@@ -655,6 +669,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadKeySigVis(pugi::xml_node element);
+    bool ReadKeySigVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigVis(pugi::xml_node element);
@@ -691,6 +706,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadKeySigDefaultVis(pugi::xml_node element);
+    bool ReadKeySigDefaultVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultVis(pugi::xml_node element);
@@ -733,6 +749,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLineVis(pugi::xml_node element);
+    bool ReadLineVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLineVis(pugi::xml_node element);
@@ -801,6 +818,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadLiquescentVis(pugi::xml_node element);
+    bool ReadLiquescentVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteLiquescentVis(pugi::xml_node element);
@@ -843,6 +861,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMensurVis(pugi::xml_node element);
+    bool ReadMensurVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMensurVis(pugi::xml_node element);
@@ -885,6 +904,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMensuralVis(pugi::xml_node element);
+    bool ReadMensuralVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralVis(pugi::xml_node element);
@@ -950,6 +970,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterSigVis(pugi::xml_node element);
+    bool ReadMeterSigVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigVis(pugi::xml_node element);
@@ -986,6 +1007,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMeterSigDefaultVis(pugi::xml_node element);
+    bool ReadMeterSigDefaultVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultVis(pugi::xml_node element);
@@ -1031,6 +1053,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadMultiRestVis(pugi::xml_node element);
+    bool ReadMultiRestVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteMultiRestVis(pugi::xml_node element);
@@ -1071,6 +1094,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPbVis(pugi::xml_node element);
+    bool ReadPbVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePbVis(pugi::xml_node element);
@@ -1110,6 +1134,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadPedalVis(pugi::xml_node element);
+    bool ReadPedalVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WritePedalVis(pugi::xml_node element);
@@ -1146,6 +1171,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadQuilismaVis(pugi::xml_node element);
+    bool ReadQuilismaVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteQuilismaVis(pugi::xml_node element);
@@ -1182,6 +1208,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSbVis(pugi::xml_node element);
+    bool ReadSbVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSbVis(pugi::xml_node element);
@@ -1218,6 +1245,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadScoreDefVis(pugi::xml_node element);
+    bool ReadScoreDefVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefVis(pugi::xml_node element);
@@ -1258,6 +1286,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSectionVis(pugi::xml_node element);
+    bool ReadSectionVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSectionVis(pugi::xml_node element);
@@ -1294,6 +1323,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSignifLetVis(pugi::xml_node element);
+    bool ReadSignifLetVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSignifLetVis(pugi::xml_node element);
@@ -1330,6 +1360,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadSpaceVis(pugi::xml_node element);
+    bool ReadSpaceVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteSpaceVis(pugi::xml_node element);
@@ -1369,6 +1400,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffDefVis(pugi::xml_node element);
+    bool ReadStaffDefVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffDefVis(pugi::xml_node element);
@@ -1435,6 +1467,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadStaffGrpVis(pugi::xml_node element);
+    bool ReadStaffGrpVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteStaffGrpVis(pugi::xml_node element);
@@ -1474,6 +1507,7 @@ public:
 
     /** Read the values for the attribute class **/
     bool ReadTupletVis(pugi::xml_node element);
+    bool ReadTupletVis(AttReader &reader);
 
     /** Write the values for the attribute class **/
     bool WriteTupletVis(pugi::xml_node element);
@@ -0,0 +1,244 @@
+#! /usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# generate_attconverter.py
+# Rewrites the enum converters of attconverter.cpp / .h generated by libmei with tables.
+# libmei emits a switch for each *ToStr converter and a chain of string comparisons for each StrTo* converter.
+# - *ToStr indexes a static array of the tokens by the enum value.
+# - StrTo* looks the value up in a perfect hash table of the tokens. The table has a power-of-two size and is keyed
+#   by a seeded FNV-1a hash (HashToken in attconverter.cpp, which has to match fnv below). For the larger enums,
+#   a first-level table of seeds per bucket (hash and displace) keeps the table at most twice the number of tokens.
+#   Each StrTo* has an overload taking a const char *, which the Att*::Read* methods call with the value of the
+#   pugi attribute without building a std::string. The std::string one calls it.
+# The tokens are read from the *ToStr converters (in either form) and the order of the enum values from atttypes.h,
+# so rewriting files already rewritten does not change them.
+# Usage: python3 generate_attconverter.py [libmei directory]
+
+import os
+import re
+import sys
+
+TO_STR = re.compile(r'std::string AttConverter::(\w+)ToStr\((\w+) data\) const\n\{\n(.*?)\n\}\n', re.S)
+STR_TO = re.compile(r'(\w+) AttConverter::StrTo(\w+)\([^)]*\) const\n\{\n(.*?)\n\}\n', re.S)
+# The std::string overload calling the const char * one, removed before rewriting the latter
+STR_TO_STRING = re.compile(r'\w+ AttConverter::StrTo(\w+)\(\s*const std::string &value, bool logWarning\) const\n\{\n'
+                           r'    return StrTo\1\(value\.c_str\(\), logWarning\);\n\}\n\n')
+STR_TO_DECLARATION = re.compile(r'( +)(\w+) StrTo(\w+)\([^)]*value, bool logWarning = true\) const;\n')
+STR_TO_CHAR_DECLARATION = re.compile(r' +\w+ StrTo\w+\(const char \*value, bool logWarning = true\) const;\n')
+
+# The seeds are stored as uint16_t
+MAX_SEED = 1 << 16
+
+
+def fnv(token, seed):
+    token_hash = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in token.encode('utf-8'):
+        token_hash = ((token_hash ^ c) * 16777619) & 0xFFFFFFFF
+    return token_hash ^ (token_hash >> 16)
+
+
+def read_enums(path):
+    """ Return the values of each enum of atttypes.h in declaration order """
+    with open(path) as f:
+        content = f.read()
+    enums = {}
+    for match in re.finditer(r'enum (\w+) \{\n(.*?)\n\};', content, re.S):
+        lines = [line.strip() for line in match.group(2).split('\n')]
+        enums[match.group(1)] = [line.rstrip(',').split(' ')[0] for line in lines if line and not line.startswith('//')]
+    return enums
+
+
+def read_tokens(body, values):
+    """ Return the token of each value of the enum (but _NONE and _MAX) and the description used in the warnings """
+    description = re.search(r'LogWarning\("Unknown value \'%d\' for ([^"]+)", data\);', body).group(1)
+    cases = re.findall(r'        case (\w+): value = "([^"]*)"; break;\n', body)
+    if cases:
+        tokens = dict(cases)
+        return [tokens[value] for value in values[1:-1]], description
+    tokens = re.findall(r'"([^"]*)"', body[:body.index('};')])
+    assert len(tokens) == len(values) - 1 and tokens[0] == '', values[0]
+    return tokens[1:], description
+
+
+def wrap(items, indent):
+    """ Pack the items of a braced list in lines of at most 120 characters as clang-format does """
+    lines = []
+    line = ''
+    for i, item in enumerate(items):
+        piece = item + (',' if i < len(items) - 1 else '')
+        if line and len(indent) + len(line) + 1 + len(piece) > 120:
+            lines.append(indent + line)
+            line = ''
+        line += (' ' if line else '') + piece
+    lines.append(indent + line)
+    return lines
+
+
+def wrap_parameters(head, parameters, tail, indent=''):
+    """ Return a declaration, with its parameters on a second line if it is longer than 120 characters """
+    line = '%s%s(%s)%s' % (indent, head, parameters, tail)
+    if len(line) <= 120:
+        return line
+    return '%s%s(\n%s    %s)%s' % (indent, head, indent, parameters, tail)
+
+
+def write_list(declaration, items):
+    single = '    %s = { %s };' % (declaration, ', '.join(items))
+    if len(single) <= 120:
+        return [single]
+    return ['    %s = {' % declaration] + wrap(items, '        ') + ['    };']
+
+
+def place(tokens, size, buckets):
+    """ Place the tokens in a table of the given size, or return None if no seed is found for a bucket """
+    groups = [[] for _ in range(buckets)]
+    for token in tokens:
+        groups[fnv(token, 0) & (buckets - 1)].append(token)
+    table = [None] * size
+    seeds = [0] * buckets
+    # The largest buckets first, while the table has most of its slots free
+    for bucket in sorted(range(buckets), key=lambda b: -len(groups[b])):
+        if not groups[bucket]:
+            continue
+        for seed in range(MAX_SEED):
+            slots = [fnv(token, seed) & (size - 1) for token in groups[bucket]]
+            if len(set(slots)) == len(slots) and all(table[slot] is None for slot in slots):
+                for token, slot in zip(groups[bucket], slots):
+                    table[slot] = token
+                seeds[bucket] = seed
+                break
+        else:
+            return None, None
+    return table, seeds
+
+
+def write_to_str(name, enum, values, tokens, description):
+    lines = ['std::string AttConverter::%sToStr(%s data) const' % (name, enum), '{']
+    lines += write_list('static constexpr const char *values[%s]' % values[-1], ['""'] + ['"%s"' % t for t in tokens])
+    lines += ['    if ((data <= %s) || (data >= %s)) {' % (values[0], values[-1]),
+              '        LogWarning("Unknown value \'%%d\' for %s", data);' % description,
+              '        return "";',
+              '    }',
+              '    return values[data];',
+              '}', '']
+    return '\n'.join(lines)
+
+
+def write_str_to(name, enum, values, tokens, description):
+    size = 1
+    while size < len(tokens):
+        size *= 2
+    buckets = 1
+    while buckets * 3 < len(tokens):
+        buckets *= 2
+    while True:
+        table, seeds = place(tokens, size, buckets)
+        if table:
+            break
+        size *= 2
+    value_of = dict(zip(tokens, values[1:-1]))
+    items = ['{ "%s", %s }' % (t, value_of[t]) if t is not None else '{ "", %s }' % values[0] for t in table]
+    head = '%s AttConverter::StrTo%s' % (enum, name)
+    lines = [wrap_parameters(head, 'const std::string &value, bool logWarning', ' const'), '{',
+             '    return StrTo%s(value.c_str(), logWarning);' % name,
+             '}', '']
+    lines += [wrap_parameters(head, 'const char *value, bool logWarning', ' const'), '{']
+    lines += ['    static constexpr std::pair<const char *, %s> table[%d] = {' % (enum, size)]
+    lines += wrap(items, '        ') + ['    };']
+    if buckets == 1:
+        lines.append('    const auto &entry = table[HashToken(value, %d) & %d];' % (seeds[0], size - 1))
+    else:
+        lines += write_list('static constexpr uint16_t seeds[%d]' % buckets, [str(s) for s in seeds])
+        lines.append('    const uint16_t seed = seeds[HashToken(value, 0) & %d];' % (buckets - 1))
+        lines.append('    const auto &entry = table[HashToken(value, seed) & %d];' % (size - 1))
+    lines += ['    if (strcmp(value, entry.first) == 0) return entry.second;',
+              '    if (logWarning && (*value != \'\\0\'))',
+              '        LogWarning("Unsupported value \'%%s\' for %s", value);' % description,
+              '    return %s;' % values[0],
+              '}', '']
+    return '\n'.join(lines)
+
+
+HASH_TOKEN = '''/**
+ * Hash function of the perfect hash tables below.
+ * The seed of each table is chosen by the generator so that its tokens do not collide.
+ */
+static uint32_t HashToken(const char *token, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (; *token; ++token) {
+        hash = (hash ^ (unsigned char)*token) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+'''
+
+HASH_TOKEN_DEFINITION = re.compile(r'/\*\*\n \* Hash function of the perfect hash tables below\..*?\n\}\n\n', re.S)
+
+CLASS_SEPARATOR = '''//----------------------------------------------------------------------------
+// AttConverter
+//----------------------------------------------------------------------------
+'''
+
+
+def rewrite_source(path, enums):
+    with open(path) as f:
+        content = f.read()
+
+    converters = {}
+    for match in TO_STR.finditer(content):
+        name, enum, body = match.groups()
+        values = enums[enum]
+        assert values[0].endswith('_NONE') and values[-1].endswith('_MAX'), enum
+        tokens, description = read_tokens(body, values)
+        assert len(set(tokens)) == len(tokens), enum
+        converters[name] = (enum, values, tokens, description)
+
+    def rewrite_to_str(match):
+        return write_to_str(match.group(1), *converters[match.group(1)])
+
+    def rewrite_str_to(match):
+        return write_str_to(match.group(2), *converters[match.group(2)])
+
+    content = STR_TO_STRING.sub('', content)
+    content, to_str_count = TO_STR.subn(rewrite_to_str, content)
+    content, str_to_count = STR_TO.subn(rewrite_str_to, content)
+    assert to_str_count == str_to_count == len(converters)
+
+    content = HASH_TOKEN_DEFINITION.sub('', content)
+    content = content.replace(CLASS_SEPARATOR, HASH_TOKEN + CLASS_SEPARATOR, 1)
+    if '#include <stdint.h>\n' not in content:
+        includes = '#include <assert.h>\n#include <stdint.h>\n#include <utility>\n'
+        content = content.replace('#include <assert.h>\n', includes, 1)
+    if '#include <string.h>\n' not in content:
+        content = content.replace('#include <stdint.h>\n', '#include <stdint.h>\n#include <string.h>\n', 1)
+    with open(path, 'w') as f:
+        f.write(content)
+    return len(converters)
+
+
+def rewrite_header(path):
+    with open(path) as f:
+        content = f.read()
+    content = content.replace('#include <string_view>\n', '')
+    content = STR_TO_CHAR_DECLARATION.sub('', content)
+
+    def declare(match):
+        indent, enum, name = match.groups()
+        head = '%s StrTo%s' % (enum, name)
+        return ''.join(wrap_parameters(head, '%svalue, bool logWarning = true' % value, ' const;\n', indent)
+                       for value in ('const std::string &', 'const char *'))
+
+    content, count = STR_TO_DECLARATION.subn(declare, content)
+    with open(path, 'w') as f:
+        f.write(content)
+    return count
+
+
+if __name__ == '__main__':
+    directory = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    enums = read_enums(os.path.join(directory, 'atttypes.h'))
+    count = rewrite_source(os.path.join(directory, 'attconverter.cpp'), enums)
+    assert rewrite_header(os.path.join(directory, 'attconverter.h')) == count
+    print('Rewrote %d converters' % count)
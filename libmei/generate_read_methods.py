@@ -0,0 +1,253 @@
+#! /usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# generate_read_methods.py
+# Rewrites the Att*::Read* methods of the atts_*.cpp files generated by libmei so that the attributes of an element
+# are dispatched in a single pass over them. libmei emits one element.attribute(name) look-up per attribute of the
+# class, each of them scanning all the attributes of the element, and looks the attribute up again for its value and
+# for its removal.
+# - attnames.cpp is written with a perfect hash table of all the names read by the att classes. Each name lists the
+#   classes reading it and its index in each of them. The table has a power-of-two size and is keyed by a seeded
+#   FNV-1a hash, with a first-level table of seeds per bucket, as in attconverter.cpp.
+# - An AttReader (see att.h) goes once over the attributes of an element and looks each of them up in the table.
+# - Each Read* method gets an overload taking the AttReader. It returns at once if the element has no attribute of the
+#   class, and otherwise switches on the index of the name in the class for the attributes of the element. The
+#   attributes read are removed through the AttReader. The overload taking the element builds an AttReader for it.
+# The attributes of each method are read from the code generated by libmei or from the methods already rewritten,
+# with the names of the latter taken from attnames.cpp, so rewriting files already rewritten does not change them.
+# To be run each time the files of this directory are generated.
+# Usage: python3 generate_read_methods.py [libmei directory]
+
+import glob
+import os
+import re
+import sys
+
+from generate_attconverter import fnv, place, wrap
+
+READ_METHOD = re.compile(r'bool (Att\w+)::Read(\w+)\(pugi::xml_node element\)\n\{\n(.*?)\n\}\n', re.S)
+READER_METHOD = re.compile(r'bool (Att\w+)::Read(\w+)\(AttReader &reader\)\n\{\n(.*?)\n\}\n\n', re.S)
+
+# The block generated by libmei for one attribute
+GENERATED_BLOCK = re.compile(r'    if \(element\.attribute\("([^"]+)"\)\) \{\n'
+                             r'        (this->Set\w+\(\w+\()element\.attribute\("\1"\)\.value\(\)(\)\);)\n'
+                             r'        element\.remove_attribute\("\1"\);\n'
+                             r'        hasAttribute = true;\n'
+                             r'    \}\n')
+
+# The branch of a single pass comparing the names of the class
+PASS_BRANCH = re.compile(r'        (?:else )?if \(strcmp\(name, "([^"]+)"\) == 0\) \{\n'
+                         r'            (this->Set\w+\(\w+\()attribute\.value\(\)(\)\);)\n'
+                         r'        \}\n')
+
+# The case of the dispatch for one attribute, on a single line or not
+DISPATCH_CASE = re.compile(r'            case (\d+):(?: |\n                )(this->Set\w+\(\w+\()reader\.GetValue\(i\)(\)\);)'
+                           r'(?: |\n                )break;\n')
+
+# The entries of the table in attnames.cpp
+NAME_ENTRY = re.compile(r'\{ "([^"]+)", s_owners \+ (\d+), (\d+) \}')
+OWNER_ENTRY = re.compile(r'\{ (ATT_\w+), (\d+) \}')
+
+READ_DECLARATION = re.compile(r'( +)bool Read(\w+)\(pugi::xml_node element\);\n(?: +bool Read\2\(AttReader &reader\);\n)?')
+
+
+def class_id(class_name):
+    return 'ATT_' + class_name[len('Att'):].upper()
+
+
+def read_names(path):
+    """ Return the names by class and index of an existing attnames.cpp """
+    names = {}
+    if not os.path.exists(path):
+        return names
+    with open(path) as f:
+        content = f.read()
+    owners = OWNER_ENTRY.findall(content[content.index('s_owners['):])
+    for name, first, count in NAME_ENTRY.findall(content):
+        for attClassId, index in owners[int(first):int(first) + int(count)]:
+            names[(attClassId, int(index))] = name
+    return names
+
+
+def parse_attributes(class_name, body, rewritten, names):
+    """ Return the (name, setter prefix, setter suffix) of the attributes read by a method """
+    if rewritten is not None:
+        cases = DISPATCH_CASE.findall(rewritten)
+        attributes = [(names[(class_id(class_name), int(index))], prefix, suffix) for index, prefix, suffix in cases]
+        if attributes and all(int(index) == i for i, (index, _, _) in enumerate(cases)):
+            return attributes
+        return None
+    body += '\n'
+    attributes = GENERATED_BLOCK.findall(body)
+    if attributes and GENERATED_BLOCK.sub('', body) == '    bool hasAttribute = false;\n    return hasAttribute;\n':
+        return attributes
+    attributes = PASS_BRANCH.findall(body)
+    if attributes and body.count('strcmp(') == len(attributes):
+        return attributes
+    return None
+
+
+def write_case(index, prefix, suffix):
+    line = '            case %d: %sreader.GetValue(i)%s break;' % (index, prefix, suffix)
+    if len(line) <= 120:
+        return [line]
+    return ['            case %d:' % index, '                %sreader.GetValue(i)%s' % (prefix, suffix),
+            '                break;']
+
+
+def write_methods(class_name, method, attributes):
+    lines = ['bool %s::Read%s(pugi::xml_node element)' % (class_name, method), '{',
+             '    AttReader reader(element);',
+             '    return this->Read%s(reader);' % method, '}', '',
+             'bool %s::Read%s(AttReader &reader)' % (class_name, method), '{',
+             '    if (!reader.HasAttClass(%s)) return false;' % class_id(class_name),
+             '    bool hasAttribute = false;',
+             '    for (int i = 0; i < reader.GetAttributeCount(); ++i) {',
+             '        switch (reader.GetNameIndex(i, %s)) {' % class_id(class_name)]
+    for index, (name, prefix, suffix) in enumerate(attributes):
+        lines += write_case(index, prefix, suffix)
+    lines += ['            default: continue;',
+              '        }',
+              '        reader.Remove(i);',
+              '        hasAttribute = true;',
+              '    }',
+              '    return hasAttribute;',
+              '}', '']
+    return '\n'.join(lines)
+
+
+def rewrite_file(path, names, owners):
+    """ Rewrite the Read* methods of an atts_*.cpp file and add the names they read to owners """
+    with open(path) as f:
+        content = f.read()
+    rewritten = dict((match.group(1), match.group(3)) for match in READER_METHOD.finditer(content))
+    content = READER_METHOD.sub('', content)
+
+    def rewrite_method(match):
+        class_name, method, body = match.groups()
+        if class_name in rewritten:
+            attributes = parse_attributes(class_name, body, rewritten[class_name], names)
+        elif body == '    bool hasAttribute = false;\n    return hasAttribute;':
+            attributes = []
+        else:
+            attributes = parse_attributes(class_name, body, None, names)
+        if attributes is None:
+            sys.exit('Unexpected code in %s::Read%s' % (class_name, method))
+        for index, (name, _, _) in enumerate(attributes):
+            owners.setdefault(name, []).append((class_id(class_name), index))
+        return write_methods(class_name, method, attributes)
+
+    content, count = READ_METHOD.subn(rewrite_method, content)
+    # The strcmp of the previous single pass is gone
+    content = content.replace('#include <assert.h>\n#include <string.h>\n', '#include <assert.h>\n', 1)
+    with open(path, 'w') as f:
+        f.write(content)
+    return count
+
+
+def rewrite_header(path):
+    with open(path) as f:
+        content = f.read()
+
+    def declare(match):
+        indent, method = match.groups()
+        return '%sbool Read%s(pugi::xml_node element);\n%sbool Read%s(AttReader &reader);\n' % (
+            indent, method, indent, method)
+
+    content = READ_DECLARATION.sub(declare, content)
+    with open(path, 'w') as f:
+        f.write(content)
+
+
+HEADER = '''/////////////////////////////////////////////////////////////////////////////
+// Authors:     Laurent Pugin and Rodolfo Zitellini
+// Created:     2014
+// Copyright (c) Authors and others. All rights reserved.
+//
+// Code generated using a modified version of libmei
+// by Andrew Hankinson, Alastair Porter, and Others
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// NOTE: this file was generated with the Verovio libmei version and
+// should not be edited because changes will be lost.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "att.h"
+
+//----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// AttReader
+//----------------------------------------------------------------------------
+
+/**
+ * Hash function of the perfect hash table below.
+ * The seeds are chosen by the generator so that the names do not collide.
+ */
+static uint32_t HashName(const char *name, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (; *name; ++name) {
+        hash = (hash ^ (unsigned char)*name) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+/**
+ * The att classes reading each name of the table, with the index of the name in the Read* method of the class.
+ */
+'''
+
+
+def write_names(path, owners):
+    names = sorted(owners)
+    size = 1
+    while size < len(names):
+        size *= 2
+    buckets = 1
+    while buckets * 3 < len(names):
+        buckets *= 2
+    while True:
+        table, seeds = place(names, size, buckets)
+        if table:
+            break
+        size *= 2
+    first = {}
+    owner_items = []
+    for name in names:
+        first[name] = len(owner_items)
+        owner_items += ['{ %s, %d }' % owner for owner in owners[name]]
+    items = ['{ "%s", s_owners + %d, %d }' % (name, first[name], len(owners[name])) if name is not None
+             else '{ "", NULL, 0 }' for name in table]
+    lines = ['static constexpr AttNameOwner s_owners[%d] = {' % len(owner_items)] + wrap(owner_items, '    ') + ['};', '']
+    lines += ['const AttNameEntry *AttReader::FindName(const char *name)', '{',
+              '    static constexpr AttNameEntry names[%d] = {' % size] + wrap(items, '        ') + ['    };']
+    lines += ['    static constexpr uint16_t seeds[%d] = {' % buckets] + wrap([str(s) for s in seeds], '        ')
+    lines += ['    };',
+              '    const uint16_t seed = seeds[HashName(name, 0) & %d];' % (buckets - 1),
+              '    const AttNameEntry &entry = names[HashName(name, seed) & %d];' % (size - 1),
+              '    if ((entry.m_ownerCount > 0) && (strcmp(name, entry.m_name) == 0)) return &entry;',
+              '    return NULL;', '}', '', '} // namespace vrv', '']
+    with open(path, 'w') as f:
+        f.write(HEADER + '\n'.join(lines))
+    return len(names)
+
+
+if __name__ == '__main__':
+    directory = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    names_path = os.path.join(directory, 'attnames.cpp')
+    names = read_names(names_path)
+    owners = {}
+    count = 0
+    for path in sorted(glob.glob(os.path.join(directory, 'atts_*.cpp'))):
+        count += rewrite_file(path, names, owners)
+        rewrite_header(path[:-len('.cpp')] + '.h')
+    print('Rewrote %d methods reading %d names' % (count, write_names(names_path, owners)))
@@ -9,9 +9,11 @@
 
 //----------------------------------------------------------------------------
 
+#include <assert.h>
 #include <regex>
 #include <sstream>
 #include <stdlib.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
@@ -57,11 +59,21 @@ double Att::StrToDbl(std::string value) const
     return atof(value.c_str());
 }
 
+double Att::StrToDbl(const char *value) const
+{
+    return atof(value);
+}
+
 int Att::StrToInt(std::string value) const
 {
     return atoi(value.c_str());
 }
 
+int Att::StrToInt(const char *value) const
+{
+    return atoi(value);
+}
+
 data_VU Att::StrToVU(std::string value, bool logWarning) const
 {
     std::regex test("[0-9]*(\\.[0-9]+)?(vu)?");
@@ -162,33 +174,39 @@ std::string Att::DurationToStr(data_DURATION data) const
 
 data_DURATION Att::StrToDuration(std::string value, bool logWarning) const
 {
-    if (value == "maxima") return DURATION_maxima;
-    if (value == "longa") return DURATION_longa;
-    if (value == "brevis") return DURATION_brevis;
-    if (value == "semibrevis") return DURATION_semibrevis;
-    if (value == "minima") return DURATION_minima;
-    if (value == "semiminima") return DURATION_semiminima;
-    if (value == "fusa") return DURATION_fusa;
-    if (value == "semifusa") return DURATION_semifusa;
-    if (value == "long") return DURATION_long;
-    if (value == "breve") return DURATION_breve;
-    if (value == "1") return DURATION_1;
-    if (value == "2") return DURATION_2;
-    if (value == "4") return DURATION_4;
-    if (value == "8") return DURATION_8;
-    if (value == "16") return DURATION_16;
-    if (value == "32") return DURATION_32;
-    if (value == "64") return DURATION_64;
-    if (value == "128") return DURATION_128;
-    if (value == "256") return DURATION_256;
-    if (value == "512") return DURATION_512;
-    if (value == "1024") return DURATION_1024;
-    if ((value.length() > 0) && (value[value.length() - 1] == 'p')) {
+    return StrToDuration(value.c_str(), logWarning);
+}
+
+data_DURATION Att::StrToDuration(const char *value, bool logWarning) const
+{
+    if (strcmp(value, "maxima") == 0) return DURATION_maxima;
+    if (strcmp(value, "longa") == 0) return DURATION_longa;
+    if (strcmp(value, "brevis") == 0) return DURATION_brevis;
+    if (strcmp(value, "semibrevis") == 0) return DURATION_semibrevis;
+    if (strcmp(value, "minima") == 0) return DURATION_minima;
+    if (strcmp(value, "semiminima") == 0) return DURATION_semiminima;
+    if (strcmp(value, "fusa") == 0) return DURATION_fusa;
+    if (strcmp(value, "semifusa") == 0) return DURATION_semifusa;
+    if (strcmp(value, "long") == 0) return DURATION_long;
+    if (strcmp(value, "breve") == 0) return DURATION_breve;
+    if (strcmp(value, "1") == 0) return DURATION_1;
+    if (strcmp(value, "2") == 0) return DURATION_2;
+    if (strcmp(value, "4") == 0) return DURATION_4;
+    if (strcmp(value, "8") == 0) return DURATION_8;
+    if (strcmp(value, "16") == 0) return DURATION_16;
+    if (strcmp(value, "32") == 0) return DURATION_32;
+    if (strcmp(value, "64") == 0) return DURATION_64;
+    if (strcmp(value, "128") == 0) return DURATION_128;
+    if (strcmp(value, "256") == 0) return DURATION_256;
+    if (strcmp(value, "512") == 0) return DURATION_512;
+    if (strcmp(value, "1024") == 0) return DURATION_1024;
+    size_t length = strlen(value);
+    if ((length > 0) && (value[length - 1] == 'p')) {
         // if (logWarning)
         // LogWarning("PPQ duration dur_s are not supported"); // remove it for now
     }
     else {
-        LogWarning("Unknown dur '%s'", value.c_str());
+        LogWarning("Unknown dur '%s'", value);
     }
     return DURATION_NONE;
 }
@@ -567,14 +585,19 @@ std::string Att::PitchnameToStr(data_PITCHNAME data) const
 
 data_PITCHNAME Att::StrToPitchname(std::string value, bool logWarning) const
 {
-    if (value == "c") return PITCHNAME_c;
-    if (value == "d") return PITCHNAME_d;
-    if (value == "e") return PITCHNAME_e;
-    if (value == "f") return PITCHNAME_f;
-    if (value == "g") return PITCHNAME_g;
-    if (value == "a") return PITCHNAME_a;
-    if (value == "b") return PITCHNAME_b;
-    if (logWarning && !value.empty()) LogWarning("Unsupported pitch name '%s'", value.c_str());
+    return StrToPitchname(value.c_str(), logWarning);
+}
+
+data_PITCHNAME Att::StrToPitchname(const char *value, bool logWarning) const
+{
+    if (strcmp(value, "c") == 0) return PITCHNAME_c;
+    if (strcmp(value, "d") == 0) return PITCHNAME_d;
+    if (strcmp(value, "e") == 0) return PITCHNAME_e;
+    if (strcmp(value, "f") == 0) return PITCHNAME_f;
+    if (strcmp(value, "g") == 0) return PITCHNAME_g;
+    if (strcmp(value, "a") == 0) return PITCHNAME_a;
+    if (strcmp(value, "b") == 0) return PITCHNAME_b;
+    if (logWarning && (*value != '\0')) LogWarning("Unsupported pitch name '%s'", value);
     return PITCHNAME_NONE;
 }
 
@@ -800,4 +823,43 @@ data_STAFFREL_basic Att::StaffrelToStaffrelBasic(data_STAFFREL staffrel)
     return staffrelBasic;
 }
 
+//----------------------------------------------------------------------------
+// AttReader
+//----------------------------------------------------------------------------
+
+AttReader::AttReader(pugi::xml_node element) : m_element(element)
+{
+    for (pugi::xml_attribute attribute : element.attributes()) {
+        const AttNameEntry *name = FindName(attribute.name());
+        if (!name) continue;
+        m_attributes.push_back(std::make_pair(attribute, name));
+        for (int j = 0; j < name->m_ownerCount; ++j) {
+            m_attClasses.set(name->m_owners[j].m_attClassId);
+        }
+    }
+}
+
+AttReader::~AttReader() {}
+
+int AttReader::GetNameIndex(int i, AttClassId attClassId) const
+{
+    assert((i >= 0) && (i < (int)m_attributes.size()));
+
+    const AttNameEntry *name = m_attributes[i].second;
+    if (!name) return -1;
+    for (int j = 0; j < name->m_ownerCount; ++j) {
+        if (name->m_owners[j].m_attClassId == attClassId) return name->m_owners[j].m_index;
+    }
+    return -1;
+}
+
+void AttReader::Remove(int i)
+{
+    assert((i >= 0) && (i < (int)m_attributes.size()));
+    assert(m_attributes[i].second);
+
+    m_element.remove_attribute(m_attributes[i].first);
+    m_attributes[i].second = NULL;
+}
+
 } // namespace vrv
@@ -322,7 +322,7 @@ void BBoxDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bo
 
     for (unsigned int i = 0; i < text.length(); i++) {
         wchar_t c = text.at(i);
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
@@ -368,21 +368,25 @@ void BBoxDeviceContext::UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph)
     assert(!m_objects.empty());
 
     // we need to store logical coordinates in the objects, we need to convert them back (this is why we need a View
-    // object)
+    // object) - the conversion is done once for the object and all its ancestors in the stack
+    Object *object = m_objects.back();
     if (!m_isDeactivatedX) {
-        (m_objects.back())->UpdateSelfBBoxX(m_view->ToLogicalX(x1), m_view->ToLogicalX(x2));
-        if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
+        x1 = m_view->ToLogicalX(x1);
+        x2 = m_view->ToLogicalX(x2);
+        object->UpdateSelfBBoxX(x1, x2);
+        if (glyph != 0) object->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
     }
     if (!m_isDeactivatedY) {
-        (m_objects.back())->UpdateSelfBBoxY(m_view->ToLogicalY(y1), m_view->ToLogicalY(y2));
-        if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
+        y1 = m_view->ToLogicalY(y1);
+        y2 = m_view->ToLogicalY(y2);
+        object->UpdateSelfBBoxY(y1, y2);
+        if (glyph != 0) object->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
     }
 
-    int i;
     // Stretch the content BB of the other objects
-    for (i = 0; i < (int)m_objects.size(); i++) {
-        if (!m_isDeactivatedX) (m_objects.at(i))->UpdateContentBBoxX(m_view->ToLogicalX(x1), m_view->ToLogicalX(x2));
-        if (!m_isDeactivatedY) (m_objects.at(i))->UpdateContentBBoxY(m_view->ToLogicalY(y1), m_view->ToLogicalY(y2));
+    for (Object *stacked : m_objects) {
+        if (!m_isDeactivatedX) stacked->UpdateContentBBoxX(x1, x2);
+        if (!m_isDeactivatedY) stacked->UpdateContentBBoxY(y1, y2);
     }
 }
 
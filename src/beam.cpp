@@ -634,6 +634,16 @@ BeamElementCoord::~BeamElementCoord()
     if (m_element) m_element->m_beamElementCoord = NULL;
 }
 
+void *BeamElementCoord::operator new(std::size_t size)
+{
+    return Arena::Allocate(size);
+}
+
+void BeamElementCoord::operator delete(void *ptr)
+{
+    Arena::Free(ptr);
+}
+
 //----------------------------------------------------------------------------
 // Functors methods
 //----------------------------------------------------------------------------
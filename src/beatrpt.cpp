@@ -79,16 +79,19 @@ int BeatRpt::GenerateMIDI(FunctorParams *functorParams)
     double starttime = params->m_totalTime + this->GetScoreTimeOnset();
     int tpq = params->m_midiFile->getTPQ();
 
+    MIDILayerBuffer *layerBuffer = params->m_currentLayerBuffer;
+    assert(layerBuffer);
+
     // filter last beat and copy all notes
     smf::MidiEvent event;
-    int eventcount = params->m_midiFile->getEventCount(params->m_midiTrack);
+    int eventcount = layerBuffer->m_midiFile->getEventCount(layerBuffer->m_midiTrack);
     for (int i = 0; i < eventcount; i++) {
-        event = params->m_midiFile->getEvent(params->m_midiTrack, i);
+        event = layerBuffer->m_midiFile->getEvent(layerBuffer->m_midiTrack, i);
         if (event.tick > starttime * tpq)
             break;
         else if (event.tick >= (starttime - beatLength) * tpq) {
             if (((event[0] & 0xf0) == 0x80) || ((event[0] & 0xf0) == 0x90)) {
-                params->m_midiFile->addEvent(params->m_midiTrack, event.tick + beatLength * tpq, event);
+                layerBuffer->m_midiFile->addEvent(layerBuffer->m_midiTrack, event.tick + beatLength * tpq, event);
             }
         }
     }
@@ -54,6 +54,16 @@ bool BoundingBox::Is(const std::vector<ClassId> &classIds) const
     return (std::find(classIds.begin(), classIds.end(), this->GetClassId()) != classIds.end());
 }
 
+void *BoundingBox::operator new(std::size_t size)
+{
+    return Arena::Allocate(size);
+}
+
+void BoundingBox::operator delete(void *ptr)
+{
+    Arena::Free(ptr);
+}
+
 void BoundingBox::UpdateContentBBoxX(int x1, int x2)
 {
     // LogDebug("CB Was: %i %i %i %i", m_contentBB_x1, m_contentBB_y1, m_contentBB_x2, m_contentBB_y2);
@@ -317,12 +327,12 @@ int BoundingBox::VerticalBottomOverlap(const BoundingBox *other, Doc *doc, int m
 int BoundingBox::GetRectangles(
     const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, Point rect[3][2], Doc *doc) const
 {
-    Glyph *glyph = NULL;
+    const Glyph *glyph = NULL;
 
     bool glyphRect = true;
 
     if (m_smuflGlyph != 0) {
-        glyph = Resources::GetGlyph(m_smuflGlyph);
+        glyph = doc->GetResources().GetGlyph(m_smuflGlyph);
         assert(glyph);
 
         if (glyph->HasAnchor(anchor1) && glyph->HasAnchor(anchor2)) {
@@ -348,8 +358,8 @@ int BoundingBox::GetRectangles(
     return 1;
 }
 
-bool BoundingBox::GetGlyph2PointRectangles(
-    const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, Glyph *glyph, Point rect[3][2], Doc *doc) const
+bool BoundingBox::GetGlyph2PointRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2,
+    const Glyph *glyph, Point rect[3][2], Doc *doc) const
 {
     assert(glyph);
 
@@ -437,7 +447,7 @@ bool BoundingBox::GetGlyph2PointRectangles(
 }
 
 bool BoundingBox::GetGlyph1PointRectangles(
-    const SMuFLGlyphAnchor &anchor, Glyph *glyph, Point rect[2][2], Doc *doc) const
+    const SMuFLGlyphAnchor &anchor, const Glyph *glyph, Point rect[2][2], Doc *doc) const
 {
     assert(glyph);
 
@@ -924,4 +934,59 @@ void SegmentedLine::AddGap(int start, int end)
     }
 }
 
+//----------------------------------------------------------------------------
+// BoundingBoxIndex
+//----------------------------------------------------------------------------
+
+BoundingBoxIndex::BoundingBoxIndex()
+{
+    m_maxWidth = 0;
+}
+
+void BoundingBoxIndex::AddBoxes(const ArrayOfBoundingBoxes &boxes)
+{
+    m_boxes.reserve(m_boxes.size() + boxes.size());
+    for (int i = 0; i < (int)boxes.size(); ++i) {
+        this->AddBox(boxes.at(i), i);
+    }
+}
+
+void BoundingBoxIndex::AddBox(const BoundingBox *box, int position)
+{
+    assert(box);
+
+    if (!box->HasContentBB()) return;
+
+    std::tuple<int, int, int> entry(box->GetContentLeft(), box->GetContentRight(), position);
+    m_maxWidth = std::max(m_maxWidth, std::get<1>(entry) - std::get<0>(entry));
+    // keep the boxes sorted by left
+    auto iter = std::upper_bound(m_boxes.begin(), m_boxes.end(), entry,
+        [](const std::tuple<int, int, int> &a, const std::tuple<int, int, int> &b) {
+            return (std::get<0>(a) < std::get<0>(b));
+        });
+    m_boxes.insert(iter, entry);
+}
+
+void BoundingBoxIndex::FindHorizontalContentOverlaps(const BoundingBox *box, std::vector<int> &positions) const
+{
+    assert(box);
+
+    positions.clear();
+    if (!box->HasContentBB()) return;
+
+    int left = box->GetContentLeft();
+    int right = box->GetContentRight();
+
+    // the first box starting at or after the right of the box cannot overlap, and neither can the following ones
+    auto iter = std::lower_bound(m_boxes.begin(), m_boxes.end(), right,
+        [](const std::tuple<int, int, int> &a, int x) { return (std::get<0>(a) < x); });
+    // going back, the boxes starting more than the maximum width before the left of the box cannot overlap
+    while (iter != m_boxes.begin()) {
+        --iter;
+        if (std::get<0>(*iter) + m_maxWidth <= left) break;
+        if (std::get<1>(*iter) > left) positions.push_back(std::get<2>(*iter));
+    }
+    std::sort(positions.begin(), positions.end());
+}
+
 } // namespace vrv
@@ -16,6 +16,7 @@
 //----------------------------------------------------------------------------
 
 #include "glyph.h"
+#include "object.h"
 #include "vrv.h"
 
 namespace vrv {
@@ -126,6 +127,27 @@ void DeviceContext::ReactivateGraphic()
     m_isDeactivatedX = false;
 }
 
+void DeviceContext::StartGraphic(Object *object, std::string gClass)
+{
+    assert(object);
+
+    StartGraphic(object, gClass, this->Is(BBOX_DEVICE_CONTEXT) ? "" : object->GetUuid());
+}
+
+void DeviceContext::ResumeGraphic(Object *object)
+{
+    assert(object);
+
+    ResumeGraphic(object, this->Is(BBOX_DEVICE_CONTEXT) ? "" : object->GetUuid());
+}
+
+void DeviceContext::StartTextGraphic(Object *object, std::string gClass)
+{
+    assert(object);
+
+    StartTextGraphic(object, gClass, this->Is(BBOX_DEVICE_CONTEXT) ? "" : object->GetUuid());
+}
+
 void DeviceContext::GetTextExtent(const std::string &string, TextExtend *extend, bool typeSize)
 {
     std::wstring wtext(string.begin(), string.end());
@@ -136,23 +158,24 @@ void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend
 {
     assert(m_fontStack.top());
     assert(extend);
+    assert(m_resources);
 
     extend->m_width = 0;
     extend->m_height = 0;
 
     if (typeSize) {
-        AddGlyphToTextExtend(Resources::GetTextGlyph(L'p'), extend);
-        AddGlyphToTextExtend(Resources::GetTextGlyph(L'M'), extend);
+        AddGlyphToTextExtend(m_resources->GetTextGlyph(L'p'), extend);
+        AddGlyphToTextExtend(m_resources->GetTextGlyph(L'M'), extend);
         extend->m_width = 0;
     }
 
-    Glyph *unkown = Resources::GetTextGlyph(L'o');
+    const Glyph *unkown = m_resources->GetTextGlyph(L'o');
 
     for (unsigned int i = 0; i < string.length(); ++i) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetTextGlyph(c);
+        const Glyph *glyph = m_resources->GetTextGlyph(c);
         if (!glyph) {
-            glyph = Resources::GetGlyph(c);
+            glyph = m_resources->GetGlyph(c);
         }
         if (!glyph) {
             glyph = unkown;
@@ -165,13 +188,14 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
 {
     assert(m_fontStack.top());
     assert(extend);
+    assert(m_resources);
 
     extend->m_width = 0;
     extend->m_height = 0;
 
     for (unsigned int i = 0; i < string.length(); ++i) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
@@ -179,7 +203,7 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
     }
 }
 
-void DeviceContext::AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend)
+void DeviceContext::AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend)
 {
     assert(glyph);
     assert(extend);
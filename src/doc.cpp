@@ -10,12 +10,16 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <atomic>
 #include <math.h>
+#include <set>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
 #include "barline.h"
 #include "beatrpt.h"
+#include "boundary.h"
 #include "chord.h"
 #include "comparison.h"
 #include "expansion.h"
@@ -64,6 +68,196 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// LayoutWorker
+//----------------------------------------------------------------------------
+
+/**
+ * The drawing state of a thread laying out pages in Doc::LayOutPagesConcurrently.
+ * It replaces the drawing page and the fonts of the Doc for that thread.
+ * The page dimensions and the font sizes are read from the Doc since they are the same for all the pages.
+ */
+struct LayoutWorker {
+    const Doc *m_doc = NULL;
+    Page *m_drawingPage = NULL;
+    FontInfo m_drawingSmuflFont;
+    FontInfo m_drawingLyricFont;
+};
+
+static thread_local LayoutWorker s_layoutWorker;
+
+/** The number of systems in the first chunk of a progressive cast off, which is doubled for each chunk */
+#define PENDING_CAST_OFF_SYSTEM_COUNT 8
+
+/** The number of sets of measures per thread aligned concurrently when casting off (see LayOutContentHorizontally) */
+#define CAST_OFF_CHUNKS_PER_THREAD 4
+
+//----------------------------------------------------------------------------
+// Arena
+//----------------------------------------------------------------------------
+
+/** The alignment of the blocks, which is also the space reserved for the header of each block */
+#define ARENA_ALIGNMENT 16
+/** The largest size allocated from an arena, larger objects are taken from the global heap */
+#define ARENA_MAX_SIZE 2048
+/** The size of the chunks the blocks are taken from */
+#define ARENA_CHUNK_SIZE (256 * 1024)
+
+/**
+ * The header stored before each block.
+ * The arena is NULL for blocks taken from the global heap.
+ */
+struct ArenaHeader {
+    Arena *m_arena;
+    int m_sizeClass;
+};
+
+static_assert(sizeof(ArenaHeader) <= ARENA_ALIGNMENT, "The arena header does not fit in the alignment");
+
+/** The arena bound to the current thread */
+static thread_local Arena *s_arena = NULL;
+
+Arena::Arena()
+{
+    m_chunkCurrent = NULL;
+    m_chunkEnd = NULL;
+    m_freeLists.resize(ARENA_MAX_SIZE / ARENA_ALIGNMENT + 1, NULL);
+    m_blockCount = 0;
+    m_allocationCount = 0;
+    m_isDiscarded = false;
+}
+
+Arena::~Arena()
+{
+    for (char *chunk : m_chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+void *Arena::Allocate(std::size_t size)
+{
+    Arena *arena = s_arena;
+    int sizeClass = std::max(1, (int)((size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT));
+
+    char *block = NULL;
+    if (arena && (size <= ARENA_MAX_SIZE)) {
+        block = static_cast<char *>(arena->AllocateBlock(sizeClass));
+    }
+    else {
+        arena = NULL;
+        block = static_cast<char *>(::operator new(size + ARENA_ALIGNMENT));
+    }
+
+    ArenaHeader *header = reinterpret_cast<ArenaHeader *>(block);
+    header->m_arena = arena;
+    header->m_sizeClass = sizeClass;
+    return block + ARENA_ALIGNMENT;
+}
+
+void Arena::Free(void *ptr)
+{
+    if (!ptr) return;
+
+    char *block = static_cast<char *>(ptr) - ARENA_ALIGNMENT;
+    ArenaHeader *header = reinterpret_cast<ArenaHeader *>(block);
+    if (!header->m_arena) {
+        ::operator delete(block);
+        return;
+    }
+    header->m_arena->FreeBlock(block, header->m_sizeClass);
+}
+
+void Arena::SetCurrent(Arena *arena)
+{
+    s_arena = arena;
+}
+
+Arena *Arena::GetCurrent()
+{
+    return s_arena;
+}
+
+void Arena::ReleaseUnused()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_blockCount > 0) return;
+
+    for (char *chunk : m_chunks) {
+        ::operator delete(chunk);
+    }
+    m_chunks.clear();
+    std::fill(m_freeLists.begin(), m_freeLists.end(), (void *)NULL);
+    m_chunkCurrent = NULL;
+    m_chunkEnd = NULL;
+}
+
+void Arena::Discard()
+{
+    bool isUnused = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isDiscarded = true;
+        isUnused = (m_blockCount == 0);
+    }
+    if (isUnused) delete this;
+}
+
+int Arena::GetBlockCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_blockCount;
+}
+
+long Arena::GetAllocationCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_allocationCount;
+}
+
+void *Arena::AllocateBlock(int sizeClass)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_blockCount++;
+    m_allocationCount++;
+
+    // Reuse a free block of the same size, which stores the next free one
+    void *block = m_freeLists.at(sizeClass);
+    if (block) {
+        m_freeLists.at(sizeClass) = *static_cast<void **>(block);
+        return block;
+    }
+
+    // Otherwise take it from the current chunk
+    std::size_t blockSize = (sizeClass + 1) * ARENA_ALIGNMENT;
+    if ((std::size_t)(m_chunkEnd - m_chunkCurrent) < blockSize) {
+        char *chunk = static_cast<char *>(::operator new(ARENA_CHUNK_SIZE));
+        m_chunks.push_back(chunk);
+        m_chunkCurrent = chunk;
+        m_chunkEnd = chunk + ARENA_CHUNK_SIZE;
+    }
+    block = m_chunkCurrent;
+    m_chunkCurrent += blockSize;
+    return block;
+}
+
+void Arena::FreeBlock(void *block, int sizeClass)
+{
+    bool isUnused = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        *static_cast<void **>(block) = m_freeLists.at(sizeClass);
+        m_freeLists.at(sizeClass) = block;
+        m_blockCount--;
+        isUnused = (m_isDiscarded && (m_blockCount == 0));
+    }
+    // The document was deleted before the last block
+    if (isUnused) delete this;
+}
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -72,18 +266,45 @@ Doc::Doc() : Object("doc-")
 {
     m_options = new Options();
 
+    m_arena = new Arena();
+
+    m_uuidGenerator.seed(std::random_device()());
+
+    this->SetAsUuidIndexRoot(true);
+
     Reset();
 }
 
 Doc::~Doc()
 {
+    // Children are deleted in the Object destructor, so we need to disable the index before
+    this->SetAsUuidIndexRoot(false);
+    m_uuidIndex.clear();
+
+    if (m_facsimile) delete m_facsimile;
+
+    if (m_pendingCastOffParams) delete m_pendingCastOffParams;
+
     delete m_options;
+
+    // The children are deleted afterwards in the Object destructor
+    m_arena->Discard();
 }
 
 void Doc::Reset()
 {
+    // Clearing the index first avoids each deleted object to be removed from it one by one
+    m_uuidIndex.clear();
+    m_treeVersion++;
+    m_classIdIndexes.clear();
     Object::Reset();
 
+    if (m_facsimile) {
+        this->UnregisterOwnedObject(m_facsimile);
+        delete m_facsimile;
+        m_facsimile = NULL;
+    }
+
     m_type = Raw;
     m_notationType = NOTATIONTYPE_NONE;
     m_pageWidth = -1;
@@ -94,9 +315,17 @@ void Doc::Reset()
     m_pageMarginTop = 0;
 
     m_drawingPage = NULL;
+    if (m_pendingCastOffParams) {
+        delete m_pendingCastOffParams;
+        m_pendingCastOffParams = NULL;
+    }
+    m_pendingCastOffSystemCount = 0;
     m_currentScoreDefDone = false;
     m_drawingPreparationDone = false;
     m_MIDITimemapTempo = 0.0;
+    m_timemapMeasureSpans.clear();
+    m_timemapNoteSpans.clear();
+    m_timemapTreeVersion = 0;
     m_hasAnalyticalMarkup = false;
     m_isMensuralMusicOnly = false;
 
@@ -108,6 +337,19 @@ void Doc::Reset()
     m_header.reset();
     m_front.reset();
     m_back.reset();
+
+    // Give the memory back at once when all the objects are deleted
+    // Blocks can still be in use outside the document, e.g., by the drawing scoreDef of a View. The arena is then
+    // replaced and deleted with the last of these blocks
+    if (m_arena->GetBlockCount() > 0) {
+        Arena *arena = new Arena();
+        if (Arena::GetCurrent() == m_arena) Arena::SetCurrent(arena);
+        m_arena->Discard();
+        m_arena = arena;
+    }
+    else {
+        m_arena->ReleaseUnused();
+    }
 }
 
 void Doc::SetType(DocType type)
@@ -130,6 +372,110 @@ void Doc::AddChild(Object *child)
     Modify();
 }
 
+void Doc::AddToUuidIndex(Object *object)
+{
+    assert(object);
+
+    if (object == this) return;
+    std::lock_guard<std::mutex> lock(m_uuidIndexMutex);
+    m_uuidIndex.insert(std::make_pair(object->GetUuidHash(), object));
+    m_treeVersion++;
+}
+
+void Doc::RemoveFromUuidIndex(Object *object)
+{
+    assert(object);
+
+    {
+        std::lock_guard<std::mutex> lock(m_uuidIndexMutex);
+        m_treeVersion++;
+        auto range = m_uuidIndex.equal_range(object->GetUuidHash());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == object) {
+                m_uuidIndex.erase(it);
+                break;
+            }
+        }
+    }
+
+    // The object can be a processing root and its address be reused once it is deleted
+    std::lock_guard<std::mutex> lock(m_classIdIndexMutex);
+    m_classIdIndexes.erase(object);
+}
+
+void Doc::FindAllInUuidIndex(const std::string &uuid, ArrayOfObjects *objects) const
+{
+    assert(objects);
+
+    std::lock_guard<std::mutex> lock(m_uuidIndexMutex);
+    auto range = m_uuidIndex.equal_range(Object::HashUuid(uuid));
+    for (auto it = range.first; it != range.second; ++it) {
+        // Objects with another uuid can have the same hash
+        if (it->second->HasUuid(uuid)) objects->push_back(it->second);
+    }
+}
+
+unsigned long Doc::GetTreeVersion() const
+{
+    std::lock_guard<std::mutex> lock(m_uuidIndexMutex);
+    return m_treeVersion;
+}
+
+void Doc::IncrementTreeVersion()
+{
+    std::lock_guard<std::mutex> lock(m_uuidIndexMutex);
+    m_treeVersion++;
+}
+
+std::shared_ptr<ClassIdIndex> Doc::GetClassIdIndex(Object *root)
+{
+    assert(root);
+
+    unsigned long treeVersion = this->GetTreeVersion();
+    std::lock_guard<std::mutex> lock(m_classIdIndexMutex);
+    auto it = m_classIdIndexes.find(root);
+    if (it == m_classIdIndexes.end()) return NULL;
+    if (it->second->m_treeVersion != treeVersion) {
+        m_classIdIndexes.erase(it);
+        return NULL;
+    }
+    return it->second;
+}
+
+void Doc::SetClassIdIndex(Object *root, std::shared_ptr<ClassIdIndex> index)
+{
+    assert(root);
+    assert(index);
+
+    std::lock_guard<std::mutex> lock(m_classIdIndexMutex);
+    // The indexes built for a previous tree version cannot be used anymore
+    for (auto it = m_classIdIndexes.begin(); it != m_classIdIndexes.end();) {
+        if (it->second->m_treeVersion < index->m_treeVersion) {
+            it = m_classIdIndexes.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    m_classIdIndexes[root] = index;
+}
+
+void Doc::SetFacsimile(Facsimile *facsimile)
+{
+    if (m_facsimile) {
+        this->UnregisterOwnedObject(m_facsimile);
+        delete m_facsimile;
+    }
+    m_facsimile = facsimile;
+    // The facsimile is not a child but owning it makes it part of the uuid index
+    if (m_facsimile) this->RegisterOwnedObject(m_facsimile);
+}
+
+void Doc::GetOwnedObjects(ArrayOfObjects *objects)
+{
+    if (m_facsimile) objects->push_back(m_facsimile);
+}
+
 void Doc::Refresh()
 {
     RefreshViews();
@@ -180,13 +526,13 @@ bool Doc::GenerateFooter()
     PgFoot *pgFoot = new PgFoot();
     // We mark it as generated for not having it written in the output
     pgFoot->IsGenerated(true);
-    pgFoot->LoadFooter();
+    pgFoot->LoadFooter(this);
     pgFoot->SetType("autogenerated");
     m_scoreDef.AddChild(pgFoot);
 
     PgFoot2 *pgFoot2 = new PgFoot2();
     pgFoot2->IsGenerated(true);
-    pgFoot2->LoadFooter();
+    pgFoot2->LoadFooter(this);
     pgFoot2->SetType("autogenerated");
     m_scoreDef.AddChild(pgFoot2);
 
@@ -247,7 +593,7 @@ void Doc::CalculateMidiTimemap()
     m_MIDITimemapTempo = 0.0;
 
     // This happens if the document was never cast off (no-layout option in the toolkit)
-    if (!m_drawingPage && GetPageCount() == 1) {
+    if (!m_drawingPage && GetCastOffPageCount() == 1) {
         Page *page = this->SetDrawingPage(0);
         if (!page) {
             return;
@@ -280,9 +626,106 @@ void Doc::CalculateMidiTimemap()
     Functor resolveMIDITies(&Object::ResolveMIDITies);
     this->Process(&resolveMIDITies, NULL, NULL, NULL, UNLIMITED_DEPTH, BACKWARD);
 
+    this->PrepareTimemapIndex();
+
     m_MIDITimemapTempo = m_options->m_midiTempoAdjustment.GetValue();
 }
 
+// Sort the spans by start time and set the maximum end values
+static void SortRealTimeSpans(ArrayOfRealTimeSpans &spans)
+{
+    std::stable_sort(spans.begin(), spans.end(),
+        [](const RealTimeSpan &span1, const RealTimeSpan &span2) { return span1.m_start < span2.m_start; });
+    double maxEnd = 0.0;
+    for (auto iter = spans.begin(); iter != spans.end(); ++iter) {
+        if ((iter == spans.begin()) || (iter->m_end > maxEnd)) maxEnd = iter->m_end;
+        iter->m_maxEnd = maxEnd;
+    }
+}
+
+// Fill the spans enclosing the time, sorted by document order
+static void FindRealTimeSpans(const ArrayOfRealTimeSpans &spans, double time, std::vector<const RealTimeSpan *> &found)
+{
+    // The first span starting after the time - all the ones before start before (or at) the time
+    auto iter = std::upper_bound(spans.begin(), spans.end(), time,
+        [](double value, const RealTimeSpan &span) { return value < span.m_start; });
+    while (iter != spans.begin()) {
+        --iter;
+        // None of the spans up to this one ends after the time
+        if (iter->m_maxEnd < time) break;
+        if (iter->m_end >= time) found.push_back(&(*iter));
+    }
+    std::sort(found.begin(), found.end(),
+        [](const RealTimeSpan *span1, const RealTimeSpan *span2) { return span1->m_order < span2->m_order; });
+}
+
+void Doc::PrepareTimemapIndex()
+{
+    m_timemapMeasureSpans.clear();
+    m_timemapNoteSpans.clear();
+
+    ArrayOfObjects measures;
+    ClassIdComparison matchMeasure(MEASURE);
+    this->FindAllDescendantByComparison(&measures, &matchMeasure);
+
+    ClassIdComparison matchNote(NOTE);
+    int order = 0;
+    for (auto &object : measures) {
+        Measure *measure = dynamic_cast<Measure *>(object);
+        assert(measure);
+        int duration = measure->GetRealTimeDurationMilliseconds();
+        for (int repeat = 1; repeat <= measure->GetRealTimeRepeatCount(); ++repeat) {
+            double offset = measure->GetRealTimeOffsetMilliseconds(repeat);
+            m_timemapMeasureSpans.push_back({ offset, offset + duration, 0.0, order, measure });
+        }
+
+        ArrayOfObjects notes;
+        measure->FindAllDescendantByComparison(&notes, &matchNote);
+        ArrayOfRealTimeSpans noteSpans;
+        int noteOrder = 0;
+        for (auto &noteObject : notes) {
+            Note *note = dynamic_cast<Note *>(noteObject);
+            assert(note);
+            noteSpans.push_back({ note->GetRealTimeOnsetMilliseconds(), note->GetRealTimeOffsetMilliseconds(), 0.0,
+                noteOrder++, note });
+        }
+        SortRealTimeSpans(noteSpans);
+        m_timemapNoteSpans.push_back(noteSpans);
+        order++;
+    }
+    SortRealTimeSpans(m_timemapMeasureSpans);
+
+    m_timemapTreeVersion = m_treeVersion;
+}
+
+Measure *Doc::FindMeasureAndNotesAtTime(int millisec, ArrayOfObjects *notes)
+{
+    assert(notes);
+
+    if (m_timemapTreeVersion != m_treeVersion) {
+        this->PrepareTimemapIndex();
+    }
+
+    std::vector<const RealTimeSpan *> spans;
+    FindRealTimeSpans(m_timemapMeasureSpans, millisec, spans);
+    if (spans.empty()) return NULL;
+
+    Measure *measure = dynamic_cast<Measure *>(spans.front()->m_object);
+    assert(measure);
+    int repeat = measure->EnclosesTime(millisec);
+    int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(repeat);
+
+    // The note spans are relative to the measure
+    const ArrayOfRealTimeSpans &noteSpans = m_timemapNoteSpans.at(spans.front()->m_order);
+    spans.clear();
+    FindRealTimeSpans(noteSpans, millisec - measureTimeOffset, spans);
+    for (auto &span : spans) {
+        notes->push_back(span->m_object);
+    }
+
+    return measure;
+}
+
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
 {
 
@@ -312,18 +755,20 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separatly
-    // For this, we use a array of AttNIntegerComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The tree is used to set up a buffer for each staff/layer pair, with the MIDI track, channel and
+    // transposition of the staff. The document is then processed only once with each layer writing to its buffer.
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
 
+    Functor generateMIDI(&Object::GenerateMIDI);
+    GenerateMIDIParams generateMIDIParams(midiFile, &generateMIDI);
+    generateMIDIParams.m_currentTempo = tempo;
+
     // Process notes and chords, rests, spaces layer by layer
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiChannel = 0;
     int midiTrack = 1;
-    ArrayOfComparisons filters;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
 
@@ -368,23 +813,27 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
         }
 
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
+            MIDILayerBuffer &layerBuffer = generateMIDIParams.m_layerBuffers[std::make_pair(staves->first, layers->first)];
+            layerBuffer.m_midiFile = new smf::MidiFile();
+            layerBuffer.m_midiFile->setTPQ(midiFile->getTPQ());
+            layerBuffer.m_midiFile->addTracks(midiTrack);
+            layerBuffer.m_midiChannel = midiChannel;
+            layerBuffer.m_midiTrack = midiTrack;
+            layerBuffer.m_transSemi = transSemi;
+        }
+    }
 
-            Functor generateMIDI(&Object::GenerateMIDI);
-            GenerateMIDIParams generateMIDIParams(midiFile, &generateMIDI);
-            generateMIDIParams.m_midiChannel = midiChannel;
-            generateMIDIParams.m_midiTrack = midiTrack;
-            generateMIDIParams.m_transSemi = transSemi;
-            generateMIDIParams.m_currentTempo = tempo;
+    this->Process(&generateMIDI, &generateMIDIParams);
 
-            // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, NULL, &filters);
+    // Append the buffers in staff/layer order, which is the order in which the layers were written one by one before
+    for (auto &layerBuffer : generateMIDIParams.m_layerBuffers) {
+        smf::MidiFile *buffer = layerBuffer.second.m_midiFile;
+        int track = layerBuffer.second.m_midiTrack;
+        int eventCount = buffer->getEventCount(track);
+        for (int i = 0; i < eventCount; ++i) {
+            midiFile->addEvent(track, buffer->getEvent(track, i));
         }
+        delete buffer;
     }
 }
 
@@ -738,6 +1187,33 @@ void Doc::PrepareDrawing()
     m_drawingPreparationDone = true;
 }
 
+void Doc::PrepareModifiedMeasures()
+{
+    if (!m_drawingPreparationDone) {
+        this->PrepareDrawing();
+        return;
+    }
+
+    ArrayOfObjects measures;
+    this->FindModifiedMeasures(&measures);
+
+    for (ArrayOfObjects::iterator it = measures.begin(); it != measures.end(); ++it) {
+        // Prepare the cross-staff pointers
+        PrepareCrossStaffParams prepareCrossStaffParams;
+        Functor prepareCrossStaff(&Object::PrepareCrossStaff);
+        Functor prepareCrossStaffEnd(&Object::PrepareCrossStaffEnd);
+        (*it)->Process(&prepareCrossStaff, &prepareCrossStaffParams, &prepareCrossStaffEnd);
+
+        // Prepare the drawing cue size
+        Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+        (*it)->Process(&prepareDrawingCueSize, NULL);
+
+        // Add or remove the LayerElement parts (stem, flag, dots, etc) according to the new values
+        Functor prepareLayerElementParts(&Object::PrepareLayerElementParts);
+        (*it)->Process(&prepareLayerElementParts, NULL);
+    }
+}
+
 void Doc::SetCurrentScoreDefDoc(bool force)
 {
     if (m_currentScoreDefDone && !force) {
@@ -750,6 +1226,8 @@ void Doc::SetCurrentScoreDefDoc(bool force)
         this->Process(&unsetCurrentScoreDef, &unsetCurrentScoreDefParams);
     }
 
+    // The objects created for it are numbered from the scoreDef, whatever the pages cast off before
+    ObjectUuidGenerator uuidGenerator(&m_scoreDef);
     ScoreDef upcomingScoreDef = m_scoreDef;
     SetCurrentScoreDefParams setCurrentScoreDefParams(this, &upcomingScoreDef);
     Functor setCurrentScoreDef(&Object::SetCurrentScoreDef);
@@ -793,7 +1271,11 @@ void Doc::CastOffDoc()
 
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
-    contentPage->LayOutHorizontally();
+    int threadCount = m_options->m_castOffThreads.GetValue();
+    if (threadCount < 1) threadCount = std::thread::hardware_concurrency();
+    if ((threadCount < 2) || !this->LayOutContentHorizontally(contentPage, threadCount)) {
+        contentPage->LayOutHorizontally();
+    }
 
     System *contentSystem = dynamic_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
@@ -810,6 +1292,13 @@ void Doc::CastOffDoc()
     Functor castOffSystems(&Object::CastOffSystems);
     Functor castOffSystemsEnd(&Object::CastOffSystemsEnd);
     contentSystem->Process(&castOffSystems, &castOffSystemsParams, &castOffSystemsEnd);
+    // Share the staff alignments of the previous layout between the new systems (see System::UnCastOff)
+    const ArrayOfObjects *systems = contentPage->GetChildren();
+    int systemCount = (int)systems->size();
+    for (ArrayOfObjects::const_iterator iter = systems->begin(); iter != systems->end(); ++iter, --systemCount) {
+        System *system = dynamic_cast<System *>(*iter);
+        if (system) system->m_systemAligner.ReuseAlignmentsFrom(&contentSystem->m_systemAligner, systemCount);
+    }
     delete contentSystem;
 
     // Reset the scoreDef at the beginning of each system
@@ -818,6 +1307,18 @@ void Doc::CastOffDoc()
         this->OptimizeScoreDefDoc();
     }
 
+    if (m_options->m_progressiveCastOff.GetValue()) {
+        // Keep the content page as the pending page and cast off only the first page
+        this->ResetDrawingPage();
+        m_pendingCastOffParams = new CastOffPagesParams(NULL, this, NULL);
+        this->CastOffRunningElements(m_pendingCastOffParams);
+        m_pendingCastOffParams->m_pageHeight = this->m_drawingPageHeight - this->m_drawingPageMarginBot;
+        m_pendingCastOffSystemCount = PENDING_CAST_OFF_SYSTEM_COUNT;
+        this->CastOffPendingPages(1);
+        this->ResetModifiedMeasures();
+        return;
+    }
+
     // Here we redo the alignment because of the new scoreDefs
     // We can actually optimise this and have a custom version that does not redo all the calculation
     contentPage->LayOutVertically();
@@ -840,16 +1341,20 @@ void Doc::CastOffDoc()
     if (optimize) {
         this->OptimizeScoreDefDoc();
     }
+
+    this->ResetModifiedMeasures();
 }
 
 void Doc::CastOffRunningElements(CastOffPagesParams *params)
 {
     Pages *pages = this->GetPages();
     assert(pages);
-    assert(pages->GetChildCount() == 0);
+    assert((pages->GetChildCount() == 0) || m_pendingCastOffParams);
 
+    // The pages are inserted at the beginning since a progressive cast off keeps the pending page
     Page *page1 = new Page();
-    pages->AddChild(page1);
+    page1->SetParent(pages);
+    pages->InsertChild(page1, 0);
     this->SetDrawingPage(0);
     page1->LayOutVertically();
 
@@ -861,7 +1366,8 @@ void Doc::CastOffRunningElements(CastOffPagesParams *params)
     }
 
     Page *page2 = new Page();
-    pages->AddChild(page2);
+    page2->SetParent(pages);
+    pages->InsertChild(page2, 1);
     this->SetDrawingPage(1);
     page2->LayOutVertically();
 
@@ -878,11 +1384,392 @@ void Doc::CastOffRunningElements(CastOffPagesParams *params)
     this->ResetDrawingPage();
 }
 
+void Doc::LayOutPagesAhead(int threadCount, int firstIdx, int lastIdx)
+{
+    // Transcription and facsimile pages have their own layout
+    if (this->GetType() != Raw) return;
+
+    this->CastOffPendingPages((lastIdx == VRV_UNSET) ? VRV_UNSET : lastIdx + 1);
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // The pending page left by a progressive cast off is after the range
+    const ArrayOfObjects *children = pages->GetChildren();
+    const int pageCount = (int)children->size() - (this->HasPendingPages() ? 1 : 0);
+    if ((lastIdx == VRV_UNSET) || (lastIdx >= pageCount)) lastIdx = pageCount - 1;
+    if ((firstIdx < 0) || (firstIdx > lastIdx)) return;
+    ArrayOfObjects::const_iterator first = children->begin() + firstIdx;
+    ArrayOfObjects::const_iterator last = children->begin() + lastIdx + 1;
+
+    // The workers use the drawing values of the Doc, so they need to be the same for all pages
+    for (ArrayOfObjects::const_iterator it = first; it != last; ++it) {
+        Page *page = dynamic_cast<Page *>(*it);
+        assert(page);
+        if (page->m_pageHeight != -1) return;
+    }
+
+    // Look for the pages with a control element pointing to another page
+    ArrayOfObjects controlElements;
+    InterfaceComparison matchTimePoint(INTERFACE_TIME_POINT);
+    this->FindAllDescendantByComparison(&controlElements, &matchTimePoint);
+    InterfaceComparison matchTimeSpanning(INTERFACE_TIME_SPANNING);
+    this->FindAllDescendantByComparison(&controlElements, &matchTimeSpanning, UNLIMITED_DEPTH, FORWARD, false);
+
+    std::set<Object *> linkedPages;
+    for (ArrayOfObjects::iterator it = controlElements.begin(); it != controlElements.end(); ++it) {
+        Object *page = (*it)->GetFirstAncestor(PAGE);
+        std::set<Object *> pointedPages;
+        if (TimeSpanningInterface *interface = (*it)->GetTimeSpanningInterface()) {
+            if (interface->GetStart()) pointedPages.insert(interface->GetStart()->GetFirstAncestor(PAGE));
+            if (interface->GetEnd()) pointedPages.insert(interface->GetEnd()->GetFirstAncestor(PAGE));
+        }
+        else if (TimePointInterface *interface = (*it)->GetTimePointInterface()) {
+            if (interface->GetStart()) pointedPages.insert(interface->GetStart()->GetFirstAncestor(PAGE));
+        }
+        pointedPages.erase(page);
+        if (pointedPages.empty()) continue;
+        linkedPages.insert(page);
+        linkedPages.insert(pointedPages.begin(), pointedPages.end());
+    }
+
+    std::vector<Page *> layoutPages;
+    for (ArrayOfObjects::const_iterator it = first; it != last; ++it) {
+        if (linkedPages.count(*it)) continue;
+        layoutPages.push_back(dynamic_cast<Page *>(*it));
+    }
+
+    if ((threadCount < 2) || (layoutPages.size() < 2)) return;
+
+    Page *drawingPage = m_drawingPage;
+
+    // The heights of the running elements are needed by the workers, which cannot lay them out
+    for (Page *page : layoutPages) {
+        this->SetDrawingPage(page->GetIdx());
+        page->LayOutRunningElements();
+    }
+
+    // Set the drawing values shared by the workers
+    this->SetDrawingPage(layoutPages.front()->GetIdx());
+
+    this->LayOutPagesConcurrently(layoutPages, &Page::LayOutAhead, threadCount);
+
+    if (drawingPage) {
+        this->SetDrawingPage(drawingPage->GetIdx());
+    }
+    else {
+        this->ResetDrawingPage();
+    }
+}
+
+void Doc::LayOutPagesConcurrently(const std::vector<Page *> &pages, void (Page::*layOut)(), int threadCount)
+{
+    threadCount = std::min(threadCount, (int)pages.size());
+
+    // Make sure the list of the scoreDef is up to date since the workers all read it
+    m_scoreDef.ResetList(&m_scoreDef);
+
+    std::atomic<int> nextPage(0);
+    auto layOutPages = [this, &pages, layOut, &nextPage]() {
+        s_layoutWorker.m_doc = this;
+        s_layoutWorker.m_drawingSmuflFont = m_drawingSmuflFont;
+        s_layoutWorker.m_drawingLyricFont = m_drawingLyricFont;
+        // Allocate the layout objects from the arena of the document as in the calling thread
+        Arena *arena = Arena::GetCurrent();
+        Arena::SetCurrent(m_arena);
+        for (int i = nextPage++; i < (int)pages.size(); i = nextPage++) {
+            Page *page = pages.at(i);
+            this->SetDrawingPage(page->GetIdx());
+            (page->*layOut)();
+        }
+        Arena::SetCurrent(arena);
+        s_layoutWorker = LayoutWorker();
+    };
+
+    // The calling thread is one of the workers
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threadCount; ++i) {
+        workers.push_back(std::thread(layOutPages));
+    }
+    layOutPages();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+bool Doc::LayOutContentHorizontally(Page *contentPage, int threadCount)
+{
+    assert(contentPage);
+
+    // The spacing by the longest duration needs the one of the whole content
+    if (m_options->m_spacingDurDetection.GetValue()) return false;
+
+    System *contentSystem = dynamic_cast<System *>(contentPage->GetFirst(SYSTEM));
+    assert(contentSystem);
+    const ArrayOfObjects *children = contentSystem->GetChildren();
+    int childCount = (int)children->size();
+
+    std::unordered_map<Object *, int> childIndexes;
+    for (int i = 0; i < childCount; ++i) {
+        childIndexes[children->at(i)] = i;
+    }
+    // The index of the child of the content system containing the object (-1 if not in it)
+    auto getChildIndex = [contentSystem, &childIndexes](Object *object) {
+        while (object && (object->GetParent() != contentSystem)) {
+            object = object->GetParent();
+        }
+        return (object) ? childIndexes.at(object) : -1;
+    };
+
+    // Count the elements spanning over each boundary between two children with a difference array
+    std::vector<int> spannings(childCount + 1, 0);
+    auto addSpanning = [&spannings](int first, int last) {
+        if (first >= last) return;
+        spannings.at(first + 1)++;
+        spannings.at(last + 1)--;
+    };
+
+    // Control elements pointing to another measure (e.g., a slur or a tie) and endings
+    ArrayOfObjects controlElements;
+    InterfaceComparison matchTimePoint(INTERFACE_TIME_POINT);
+    contentSystem->FindAllDescendantByComparison(&controlElements, &matchTimePoint);
+    InterfaceComparison matchTimeSpanning(INTERFACE_TIME_SPANNING);
+    contentSystem->FindAllDescendantByComparison(
+        &controlElements, &matchTimeSpanning, UNLIMITED_DEPTH, FORWARD, false);
+    for (Object *element : controlElements) {
+        std::vector<Object *> pointedElements;
+        if (TimeSpanningInterface *interface = element->GetTimeSpanningInterface()) {
+            pointedElements = { interface->GetStart(), interface->GetEnd() };
+        }
+        else if (TimePointInterface *interface = element->GetTimePointInterface()) {
+            pointedElements = { interface->GetStart() };
+        }
+        int first = getChildIndex(element);
+        int last = first;
+        for (Object *pointedElement : pointedElements) {
+            int idx = (pointedElement) ? getChildIndex(pointedElement) : -1;
+            if (idx == -1) continue;
+            first = std::min(first, idx);
+            last = std::max(last, idx);
+        }
+        addSpanning(first, last);
+    }
+    for (int i = 0; i < childCount; ++i) {
+        Object *child = children->at(i);
+        if (!child->Is(ENDING) || !child->IsBoundaryElement()) continue;
+        BoundaryStartInterface *interface = dynamic_cast<BoundaryStartInterface *>(child);
+        assert(interface);
+        addSpanning(i, getChildIndex(interface->GetEnd()));
+    }
+
+    // Split between two measures with nothing spanning over, and not before a measure with a scoreDef change since
+    // its scoreDef would be taken for the one of the system (see Layer::AlignHorizontally)
+    int chunkSize = std::max(1, childCount / (threadCount * CAST_OFF_CHUNKS_PER_THREAD));
+    std::vector<int> chunkStarts = { 0 };
+    int spanningCount = 0;
+    for (int i = 1; i < childCount; ++i) {
+        spanningCount += spannings.at(i);
+        if ((spanningCount > 0) || (i - chunkStarts.back() < chunkSize)) continue;
+        Measure *measure = dynamic_cast<Measure *>(children->at(i));
+        if (!measure || measure->GetDrawingScoreDef() || !children->at(i - 1)->Is(MEASURE)) continue;
+        chunkStarts.push_back(i);
+    }
+    if (chunkStarts.size() < 2) return false;
+    chunkStarts.push_back(childCount);
+
+    // Move the content to the temporary pages, which have the scoreDef of the content page and system
+    Pages *pages = this->GetPages();
+    assert(pages);
+    std::vector<Page *> chunkPages;
+    // The temporary objects do not use the generator of the document so that the uuids are the same as without threads
+    ObjectUuidGenerator uuidGenerator(contentPage);
+    for (int i = 0; i < (int)chunkStarts.size() - 1; ++i) {
+        Page *chunkPage = new Page();
+        chunkPage->m_drawingScoreDef = contentPage->m_drawingScoreDef;
+        System *chunkSystem = new System();
+        chunkSystem->SetDrawingScoreDef(contentSystem->GetDrawingScoreDef());
+        chunkPage->AddChild(chunkSystem);
+        pages->AddChild(chunkPage);
+        chunkSystem->MoveChildRangeFrom(contentSystem, 0, chunkStarts.at(i + 1) - chunkStarts.at(i));
+        chunkPages.push_back(chunkPage);
+    }
+
+    // Reset the (now empty) content system as LayOutHorizontally does
+    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
+    contentPage->Process(&resetHorizontalAlignment, NULL);
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    contentPage->Process(&resetVerticalAlignment, NULL);
+
+    this->LayOutPagesConcurrently(chunkPages, &Page::AlignMeasureContentHorizontally, threadCount);
+
+    // Move the content back with the label widths of the first system
+    for (Page *chunkPage : chunkPages) {
+        System *chunkSystem = dynamic_cast<System *>(chunkPage->GetFirst());
+        assert(chunkSystem);
+        if (chunkPage == chunkPages.front()) {
+            contentSystem->SetDrawingLabelsWidth(chunkSystem->GetDrawingLabelsWidth());
+            contentSystem->SetDrawingAbbrLabelsWidth(chunkSystem->GetDrawingAbbrLabelsWidth());
+        }
+        contentSystem->MoveChildRangeFrom(chunkSystem, 0, chunkSystem->GetChildCount());
+    }
+
+    // Align the staves of the content system and move the positioners of the floating elements to it
+    Functor alignVertically(&Object::AlignVertically);
+    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd);
+    AlignVerticallyParams alignVerticallyParams(this, &alignVertically, &alignVerticallyEnd);
+    contentPage->Process(&alignVertically, &alignVerticallyParams, &alignVerticallyEnd);
+    for (Page *chunkPage : chunkPages) {
+        System *chunkSystem = dynamic_cast<System *>(chunkPage->GetFirst());
+        assert(chunkSystem);
+        contentSystem->m_systemAligner.MovePositionersFrom(&chunkSystem->m_systemAligner);
+        pages->DeleteChild(chunkPage);
+    }
+
+    contentPage->AdjustMeasuresHorizontally();
+
+    return true;
+}
+
+bool Doc::LayOutModifiedPages()
+{
+    // Transcription and facsimile pages have their own layout
+    if (this->GetType() != Raw) return false;
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    Page *drawingPage = m_drawingPage;
+    bool success = true;
+
+    const ArrayOfObjects *children = pages->GetChildren();
+    for (ArrayOfObjects::const_iterator it = children->begin(); it != children->end(); ++it) {
+        Page *page = dynamic_cast<Page *>(*it);
+        assert(page);
+        if (!page->IsModified()) continue;
+
+        // Keep the width of the systems from the previous layout of the page
+        std::vector<int> systemWidths;
+        const ArrayOfObjects *systems = page->GetChildren();
+        for (ArrayOfObjects::const_iterator iter = systems->begin(); iter != systems->end(); ++iter) {
+            System *system = dynamic_cast<System *>(*iter);
+            assert(system);
+            // The page has not been laid out since it was cast off, so we cannot compare
+            if (system->m_drawingTotalWidth == 0) success = false;
+            systemWidths.push_back(system->m_drawingTotalWidth);
+        }
+        if (!success) break;
+        int justifiableHeight = page->m_drawingJustifiableHeight;
+
+        this->SetDrawingPage(page->GetIdx());
+        page->LayOutHorizontallyAhead();
+
+        // Cast off again if the width of a system changed since measures might now fit (or not) in it
+        std::vector<int>::iterator width = systemWidths.begin();
+        for (ArrayOfObjects::const_iterator iter = systems->begin(); iter != systems->end(); ++iter, ++width) {
+            System *system = dynamic_cast<System *>(*iter);
+            assert(system);
+            if (system->m_drawingTotalWidth != *width) success = false;
+        }
+        if (!success) break;
+
+        // Also if the systems do not fit in the page anymore
+        page->LayOut();
+        if ((justifiableHeight >= 0) && (page->m_drawingJustifiableHeight < 0)) {
+            success = false;
+            break;
+        }
+    }
+
+    if (drawingPage) {
+        this->SetDrawingPage(drawingPage->GetIdx());
+    }
+    else {
+        this->ResetDrawingPage();
+    }
+
+    if (success) this->ResetModifiedMeasures();
+
+    return success;
+}
+
+void Doc::CastOffPendingPages(int pageCount)
+{
+    if (!m_pendingCastOffParams) return;
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+    Page *pendingPage = dynamic_cast<Page *>(pages->GetLast());
+    assert(pendingPage);
+
+    Page *drawingPage = (m_drawingPage != pendingPage) ? m_drawingPage : NULL;
+
+    // All the pages before the pending one are final
+    while ((pageCount == VRV_UNSET) || (pages->GetChildCount() - 1 < pageCount)) {
+        int finalPageCount = pages->GetChildCount() - 1;
+
+        // Lay out the next chunk of systems vertically in a page of its own
+        Page *chunkPage = new Page();
+        for (int i = 0; (i < m_pendingCastOffSystemCount) && (pendingPage->GetChildCount() > 0); ++i) {
+            chunkPage->AddChild(pendingPage->DetachChild(0));
+        }
+        bool lastChunk = (pendingPage->GetChildCount() == 0);
+        pages->InsertBefore(pendingPage, chunkPage);
+        this->SetDrawingPage(finalPageCount);
+        chunkPage->LayOutVertically();
+        pages->DetachChild(finalPageCount);
+        this->ResetDrawingPage();
+
+        CastOffPagesParams castOffPagesParams = *m_pendingCastOffParams;
+        castOffPagesParams.m_contentPage = chunkPage;
+        castOffPagesParams.m_currentPage = new Page();
+        castOffPagesParams.m_pendingPage = pendingPage;
+        pages->InsertBefore(pendingPage, castOffPagesParams.m_currentPage);
+        // The chunk starts a new page and only the position of the systems relative to the first one matters
+        if (finalPageCount > 0) {
+            System *firstSystem = dynamic_cast<System *>(chunkPage->GetFirst());
+            assert(firstSystem);
+            castOffPagesParams.m_shift = firstSystem->GetDrawingYRel() - castOffPagesParams.m_pageHeight;
+            // Use VRV_UNSET value as a flag (see System::CastOffPages)
+            castOffPagesParams.m_pgHeadHeight = VRV_UNSET;
+        }
+        Functor castOffPages(&Object::CastOffPages);
+        chunkPage->Process(&castOffPages, &castOffPagesParams);
+        delete chunkPage;
+
+        if (lastChunk) {
+            pages->DeleteChild(pendingPage);
+            delete m_pendingCastOffParams;
+            m_pendingCastOffParams = NULL;
+            break;
+        }
+
+        // The last page is not final since the systems of the next chunk might still fit in it
+        // Its systems are laid out vertically again with the next chunk, which expects them to be reset
+        Page *lastPage = castOffPagesParams.m_currentPage;
+        this->SetDrawingPage(lastPage->GetIdx());
+        lastPage->LayOutHorizontally();
+        this->ResetDrawingPage();
+        pendingPage->MoveChildrenFrom(lastPage, 0);
+        pages->DeleteChild(lastPage);
+        m_pendingCastOffSystemCount *= 2;
+    }
+
+    if (drawingPage) {
+        this->SetDrawingPage(drawingPage->GetIdx());
+    }
+}
+
 void Doc::UnCastOffDoc()
 {
     Pages *pages = this->GetPages();
     assert(pages);
 
+    // The systems of the pending page are uncast off as the others
+    if (m_pendingCastOffParams) {
+        delete m_pendingCastOffParams;
+        m_pendingCastOffParams = NULL;
+    }
+
     Page *contentPage = new Page();
     System *contentSystem = new System();
     contentPage->AddChild(contentSystem);
@@ -942,6 +1829,8 @@ void Doc::CastOffEncodingDoc()
     if (this->m_options->m_condenseEncoded.GetValue()) {
         this->OptimizeScoreDefDoc();
     }
+
+    this->ResetModifiedMeasures();
 }
 
 void Doc::ConvertToPageBasedDoc()
@@ -1257,6 +2146,49 @@ void Doc::ExpandExpansions()
     // }
 }
 
+void Doc::FindModifiedMeasures(ArrayOfObjects *measures)
+{
+    assert(measures);
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // Objects propagate their modification to their parents, so we only need to look in modified pages and systems
+    const ArrayOfObjects *children = pages->GetChildren();
+    for (ArrayOfObjects::const_iterator it = children->begin(); it != children->end(); ++it) {
+        if (!(*it)->IsModified()) continue;
+        const ArrayOfObjects *systems = (*it)->GetChildren();
+        for (ArrayOfObjects::const_iterator iter = systems->begin(); iter != systems->end(); ++iter) {
+            if (!(*iter)->IsModified()) continue;
+            const ArrayOfObjects *systemChildren = (*iter)->GetChildren();
+            for (ArrayOfObjects::const_iterator child = systemChildren->begin(); child != systemChildren->end();
+                 ++child) {
+                if ((*child)->Is(MEASURE) && (*child)->IsModified()) measures->push_back(*child);
+            }
+        }
+    }
+}
+
+void Doc::ResetModifiedMeasures()
+{
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    const ArrayOfObjects *children = pages->GetChildren();
+    for (ArrayOfObjects::const_iterator it = children->begin(); it != children->end(); ++it) {
+        const ArrayOfObjects *systems = (*it)->GetChildren();
+        for (ArrayOfObjects::const_iterator iter = systems->begin(); iter != systems->end(); ++iter) {
+            const ArrayOfObjects *systemChildren = (*iter)->GetChildren();
+            for (ArrayOfObjects::const_iterator child = systemChildren->begin(); child != systemChildren->end();
+                 ++child) {
+                if ((*child)->Is(MEASURE)) (*child)->Modify(false);
+            }
+            (*iter)->Modify(false);
+        }
+        (*it)->Modify(false);
+    }
+}
+
 bool Doc::HasPage(int pageIdx)
 {
     Pages *pages = this->GetPages();
@@ -1275,6 +2207,12 @@ Pages *Doc::GetPages()
 }
 
 int Doc::GetPageCount()
+{
+    this->CastOffPendingPages();
+    return this->GetCastOffPageCount();
+}
+
+int Doc::GetCastOffPageCount()
 {
     Pages *pages = this->GetPages();
     return ((pages) ? pages->GetChildCount() : 0);
@@ -1283,7 +2221,7 @@ int Doc::GetPageCount()
 int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = m_resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     h = h * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -1295,7 +2233,7 @@ int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
 int Doc::GetGlyphWidth(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = m_resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -1306,7 +2244,7 @@ int Doc::GetGlyphWidth(wchar_t code, int staffSize, bool graceSize) const
 
 int Doc::GetGlyphAdvX(wchar_t code, int staffSize, bool graceSize) const
 {
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = m_resources.GetGlyph(code);
     assert(glyph);
     int advX = glyph->GetHorizAdvX();
     advX = advX * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -1336,7 +2274,7 @@ Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staf
 int Doc::GetGlyphDescender(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = m_resources.GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -1350,7 +2288,7 @@ int Doc::GetTextGlyphHeight(wchar_t code, FontInfo *font, bool graceSize) const
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     h = h * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1363,7 +2301,7 @@ int Doc::GetTextGlyphWidth(wchar_t code, FontInfo *font, bool graceSize) const
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     w = w * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1375,7 +2313,7 @@ int Doc::GetTextGlyphAdvX(wchar_t code, FontInfo *font, bool graceSize) const
 {
     assert(font);
 
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     int advX = glyph->GetHorizAdvX();
     advX = advX * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1388,7 +2326,7 @@ int Doc::GetTextGlyphDescender(wchar_t code, FontInfo *font, bool graceSize) con
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     y = y * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1491,17 +2429,19 @@ int Doc::GetCueSize(int value) const
 
 FontInfo *Doc::GetDrawingSmuflFont(int staffSize, bool graceSize)
 {
-    m_drawingSmuflFont.SetFaceName(m_options->m_font.GetValue().c_str());
+    FontInfo *font = (s_layoutWorker.m_doc == this) ? &s_layoutWorker.m_drawingSmuflFont : &m_drawingSmuflFont;
+    font->SetFaceName(m_options->m_font.GetValue().c_str());
     int value = m_drawingSmuflFontSize * staffSize / 100;
     if (graceSize) value = value * this->m_options->m_graceFactor.GetValue();
-    m_drawingSmuflFont.SetPointSize(value);
-    return &m_drawingSmuflFont;
+    font->SetPointSize(value);
+    return font;
 }
 
 FontInfo *Doc::GetDrawingLyricFont(int staffSize)
 {
-    m_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
-    return &m_drawingLyricFont;
+    FontInfo *font = (s_layoutWorker.m_doc == this) ? &s_layoutWorker.m_drawingLyricFont : &m_drawingLyricFont;
+    font->SetPointSize(m_drawingLyricFontSize * staffSize / 100);
+    return font;
 }
 
 double Doc::GetLeftMargin(const ClassId classId) const
@@ -1564,6 +2504,11 @@ Page *Doc::SetDrawingPage(int pageIdx)
     if (!HasPage(pageIdx)) {
         return NULL;
     }
+    // a layout worker only changes its own drawing page
+    if (s_layoutWorker.m_doc == this) {
+        s_layoutWorker.m_drawingPage = dynamic_cast<Page *>(this->GetPages()->GetChild(pageIdx));
+        return s_layoutWorker.m_drawingPage;
+    }
     // nothing to do
     if (m_drawingPage && m_drawingPage->GetIdx() == pageIdx) {
         return m_drawingPage;
@@ -1653,6 +2598,12 @@ int Doc::GetAdjustedDrawingPageHeight() const
     return (contentHeight + m_drawingPageMarginTop + m_drawingPageMarginBot) / DEFINITION_FACTOR;
 }
 
+Page *Doc::GetDrawingPage() const
+{
+    if (s_layoutWorker.m_doc == this) return s_layoutWorker.m_drawingPage;
+    return m_drawingPage;
+}
+
 int Doc::GetAdjustedDrawingPageWidth() const
 {
     assert(m_drawingPage);
@@ -40,7 +40,7 @@ EditorialElement::EditorialElement() : Object("ee-"), BoundaryStartInterface(),
     Reset();
 }
 
-EditorialElement::EditorialElement(std::string classid)
+EditorialElement::EditorialElement(const char *classid)
     : Object(classid), BoundaryStartInterface(), AttLabelled(), AttTyped()
 {
     RegisterAttClass(ATT_LABELLED);
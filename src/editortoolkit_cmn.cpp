@@ -62,7 +62,14 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
 
     // Action without parameter
     if (action == "commit") {
-        m_doc->PrepareDrawing();
+        // Prepare only the modified measures when the links between elements are unchanged
+        if (m_linksModified) {
+            m_doc->PrepareDrawing();
+        }
+        else {
+            m_doc->PrepareModifiedMeasures();
+        }
+        m_linksModified = false;
         return true;
     }
 
@@ -85,6 +92,7 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
     else if (action == "delete") {
         std::string elementId;
         if (this->ParseDeleteAction(json.get<jsonxx::Object>("param"), elementId)) {
+            m_linksModified = true;
             return this->Delete(elementId);
         }
         LogWarning("Could not parse the delete action");
@@ -109,6 +117,7 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
     else if (action == "insert") {
         std::string elementType, startid, endid;
         if (this->ParseInsertAction(json.get<jsonxx::Object>("param"), elementType, startid, endid)) {
+            m_linksModified = true;
             if (endid == "") {
                 return this->Insert(elementType, startid);
             }
@@ -216,6 +225,9 @@ bool EditorToolkitCMN::Delete(std::string &elementId)
     if (!element) return false;
 
     if (element->Is(NOTE)) {
+        // Mark the measure as modified since the note is replaced or deleted
+        Object *measure = element->GetFirstAncestor(MEASURE);
+        if (measure) measure->Modify();
         return this->DeleteNote(dynamic_cast<Note *>(element));
     }
     return false;
@@ -235,6 +247,7 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
         element->GetPitchInterface()->SetPname(pname);
         element->GetPitchInterface()->SetOct(oct);
+        this->PitchModified(element);
 
         return true;
     }
@@ -257,6 +270,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
             default: step = 0;
         }
         interface->AdjustPitchByOffset(step);
+        this->PitchModified(element);
         return true;
     }
     return false;
@@ -321,6 +335,9 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         return false;
     }
     if (elementType == "note") {
+        // Mark the measure as modified since the element might be replaced
+        Object *measure = start->GetFirstAncestor(MEASURE);
+        if (measure) measure->Modify();
         return this->InsertNote(start);
     }
     // Check if it is a LayerElement
@@ -393,11 +410,30 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     else if (Att::SetVisual(element, attribute, value))
         success = true;
     if (success) {
+        // Changing these attributes changes the links between elements
+        static const std::set<std::string> linkingAttributes
+            = { "endid", "layer", "next", "plist", "sameas", "staff", "startid", "tie", "tstamp", "tstamp2" };
+        if (linkingAttributes.count(attribute)) m_linksModified = true;
+        if ((attribute == "pname") || (attribute == "oct")) {
+            this->PitchModified(element);
+        }
+        else {
+            element->Modify();
+        }
         return true;
     }
     return false;
 }
 
+void EditorToolkitCMN::PitchModified(Object *element)
+{
+    assert(element);
+
+    // A tie is matched with the pitch of the notes
+    if (element->Is(NOTE) && dynamic_cast<Note *>(element)->HasTie()) m_linksModified = true;
+    element->Modify();
+}
+
 Object *EditorToolkitCMN::GetElement(std::string &elementId)
 {
     if (elementId == CHAINED_ID) {
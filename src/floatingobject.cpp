@@ -52,7 +52,7 @@ FloatingObject::FloatingObject() : Object("fe")
     Reset();
 }
 
-FloatingObject::FloatingObject(std::string classid) : Object(classid)
+FloatingObject::FloatingObject(const char *classid) : Object(classid)
 {
     Reset();
 
@@ -142,6 +142,11 @@ int FloatingObject::SetDrawingGrpObject(void *drawingGrpObject)
 
 FloatingPositioner::FloatingPositioner(FloatingObject *object, StaffAlignment *alignment, char spanningType)
     : BoundingBox()
+{
+    InitPositioner(object, alignment, spanningType);
+}
+
+void FloatingPositioner::InitPositioner(FloatingObject *object, StaffAlignment *alignment, char spanningType)
 {
     assert(object);
     assert(alignment);
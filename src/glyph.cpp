@@ -74,6 +74,19 @@ Glyph::Glyph(std::string path, std::string codeStr)
     m_unitsPerEm = atoi(viewBox.substr(viewBox.find_last_of(' ')).c_str()) * 10;
 }
 
+Glyph::Glyph(std::string path, std::string codeStr, int unitsPerEm, std::string xml)
+{
+    m_x = 0;
+    m_y = 0;
+    m_width = 0;
+    m_height = 0;
+    m_horizAdvX = 0;
+    m_unitsPerEm = unitsPerEm * 10;
+    m_path = path;
+    m_codeStr = codeStr;
+    m_xml = xml;
+}
+
 Glyph::Glyph(int unitsPerEm)
 {
     m_x = 0;
@@ -96,7 +109,7 @@ void Glyph::SetBoundingBox(double x, double y, double w, double h)
     m_height = (int)(10.0 * h);
 }
 
-void Glyph::GetBoundingBox(int &x, int &y, int &w, int &h)
+void Glyph::GetBoundingBox(int &x, int &y, int &w, int &h) const
 {
     x = m_x;
     y = m_y;
@@ -126,14 +139,16 @@ void Glyph::SetAnchor(std::string anchorStr, double x, double y)
     m_anchors[anchorId] = Point(x * this->GetUnitsPerEm() / 4, y * this->GetUnitsPerEm() / 4);
 }
 
-bool Glyph::HasAnchor(SMuFLGlyphAnchor anchor)
+bool Glyph::HasAnchor(SMuFLGlyphAnchor anchor) const
 {
     return (m_anchors.count(anchor) == 1);
 }
 
-const Point *Glyph::GetAnchor(SMuFLGlyphAnchor anchor)
+const Point *Glyph::GetAnchor(SMuFLGlyphAnchor anchor) const
 {
-    return &m_anchors[anchor];
+    std::map<SMuFLGlyphAnchor, Point>::const_iterator iter = m_anchors.find(anchor);
+    if (iter == m_anchors.end()) return NULL;
+    return &iter->second;
 }
 
 } // namespace vrv
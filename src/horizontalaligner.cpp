@@ -35,47 +35,115 @@ namespace vrv {
 // HorizontalAligner
 //----------------------------------------------------------------------------
 
-HorizontalAligner::HorizontalAligner() : Object()
+HorizontalAligner::HorizontalAligner() : Object("m-", false)
 {
+    this->SetAsOutsideUuidIndex();
+
     Reset();
 }
 
-HorizontalAligner::~HorizontalAligner() {}
+HorizontalAligner::~HorizontalAligner()
+{
+    TrimPools();
+}
 
 void HorizontalAligner::Reset()
 {
-    Object::Reset();
+    // What was not reused by the previous layout is not needed anymore
+    TrimPools();
+
+    // Keep the alignments and their content aside for the next layout instead of deleting them
+    for (int i = 0; i < this->GetAlignmentCount(); ++i) {
+        Alignment *alignment = this->GetAlignment(i);
+        alignment->ClearForReuse(&m_referencePool, &m_graceAlignerPool);
+        m_alignmentPool.push_back(alignment);
+    }
+    m_children.clear();
+    ResetBoundingBox();
+}
+
+Alignment *HorizontalAligner::GetAlignment(int idx) const
+{
+    assert(m_children.at(idx)->Is(ALIGNMENT));
+
+    return static_cast<Alignment *>(m_children.at(idx));
 }
 
 Alignment *HorizontalAligner::SearchAlignmentAtTime(double time, AlignmentType type, int &idx)
 {
-    int i;
     idx = -1; // the index if we reach the end.
-    Alignment *alignment = NULL;
-    // First try to see if we already have something at the time position
-    for (i = 0; i < GetAlignmentCount(); ++i) {
-        alignment = dynamic_cast<Alignment *>(m_children.at(i));
-        assert(alignment);
+    // Look for the first alignment that is not before the time and the type
+    ArrayOfObjects::iterator iter = std::lower_bound(
+        m_children.begin(), m_children.end(), time, [type](Object *object, double time) {
+            // The children are all Alignment objects (see HorizontalAligner::GetAlignment)
+            Alignment *alignment = static_cast<Alignment *>(object);
+            if (AreEqual(alignment->GetTime(), time)) return (alignment->GetType() < type);
+            return (alignment->GetTime() < time);
+        });
+    // nothing found to the end
+    if (iter == m_children.end()) return NULL;
 
-        double alignment_time = alignment->GetTime();
-        if (AreEqual(alignment_time, time)) {
-            if (alignment->GetType() == type) {
-                return alignment;
-            }
-            else if (alignment->GetType() > type) {
-                idx = i;
-                break;
-            }
-        }
-        // nothing found, do not go any further but keep the index
-        if (alignment->GetTime() > time) {
-            idx = i;
-            break;
-        }
-    }
+    Alignment *alignment = this->GetAlignment((int)(iter - m_children.begin()));
+    // we already have something at the time position
+    if (AreEqual(alignment->GetTime(), time) && (alignment->GetType() == type)) return alignment;
+    // nothing found, but keep the index
+    idx = (int)(iter - m_children.begin());
     return NULL;
 }
 
+void HorizontalAligner::TrimPools()
+{
+    for (Object *alignment : m_alignmentPool) {
+        delete alignment;
+    }
+    m_alignmentPool.clear();
+    for (Object *reference : m_referencePool) {
+        delete reference;
+    }
+    m_referencePool.clear();
+    for (GraceAligner *graceAligner : m_graceAlignerPool) {
+        delete graceAligner;
+    }
+    m_graceAlignerPool.clear();
+}
+
+Alignment *HorizontalAligner::NewAlignment(double time, AlignmentType type)
+{
+    if (m_alignmentPool.empty()) return new Alignment(time, type);
+
+    assert(m_alignmentPool.back()->Is(ALIGNMENT));
+    Alignment *alignment = static_cast<Alignment *>(m_alignmentPool.back());
+    m_alignmentPool.pop_back();
+    // It must not be in use anymore (see Alignment::ClearForReuse)
+    assert(!alignment->GetParent() && (alignment->GetChildCount() == 0));
+    alignment->SetTime(time);
+    alignment->SetType(type);
+    return alignment;
+}
+
+AlignmentReference *HorizontalAligner::NewAlignmentReference(int staffN)
+{
+    if (m_referencePool.empty()) return new AlignmentReference(staffN);
+
+    assert(m_referencePool.back()->Is(ALIGNMENT_REFERENCE));
+    AlignmentReference *reference = static_cast<AlignmentReference *>(m_referencePool.back());
+    m_referencePool.pop_back();
+    assert(!reference->GetParent());
+    reference->Reset();
+    reference->SetN(staffN);
+    return reference;
+}
+
+GraceAligner *HorizontalAligner::NewGraceAligner()
+{
+    if (m_graceAlignerPool.empty()) return new GraceAligner();
+
+    GraceAligner *graceAligner = m_graceAlignerPool.back();
+    m_graceAlignerPool.pop_back();
+    graceAligner->Reset();
+    return graceAligner;
+}
+
 void HorizontalAligner::AddAlignment(Alignment *alignment, int idx)
 {
     alignment->SetParent(this);
@@ -107,13 +175,13 @@ void MeasureAligner::Reset()
 {
     HorizontalAligner::Reset();
     m_nonJustifiableLeftMargin = 0;
-    m_leftAlignment = new Alignment(-1.0 * DUR_MAX, ALIGNMENT_MEASURE_START);
+    m_leftAlignment = NewAlignment(-1.0 * DUR_MAX, ALIGNMENT_MEASURE_START);
     AddAlignment(m_leftAlignment);
-    m_leftBarLineAlignment = new Alignment(-1.0 * DUR_MAX, ALIGNMENT_MEASURE_LEFT_BARLINE);
+    m_leftBarLineAlignment = NewAlignment(-1.0 * DUR_MAX, ALIGNMENT_MEASURE_LEFT_BARLINE);
     AddAlignment(m_leftBarLineAlignment);
-    m_rightBarLineAlignment = new Alignment(0.0 * DUR_MAX, ALIGNMENT_MEASURE_RIGHT_BARLINE);
+    m_rightBarLineAlignment = NewAlignment(0.0 * DUR_MAX, ALIGNMENT_MEASURE_RIGHT_BARLINE);
     AddAlignment(m_rightBarLineAlignment);
-    m_rightAlignment = new Alignment(0.0 * DUR_MAX, ALIGNMENT_MEASURE_END);
+    m_rightAlignment = NewAlignment(0.0 * DUR_MAX, ALIGNMENT_MEASURE_END);
     AddAlignment(m_rightAlignment);
 }
 
@@ -128,16 +196,17 @@ Alignment *MeasureAligner::GetAlignmentAtTime(double time, AlignmentType type)
     if (idx == -1) {
         if (type != ALIGNMENT_MEASURE_END) {
             // This typically occurs when a tstamp event occurs after the last note of a measure
+            // Insert it just before the right barline for keeping the alignments sorted
             int rightBarlineIdx = m_rightBarLineAlignment->GetIdx();
             assert(rightBarlineIdx != -1);
-            idx = rightBarlineIdx - 1;
+            idx = rightBarlineIdx;
             this->SetMaxTime(time);
         }
         else {
             idx = GetAlignmentCount();
         }
     }
-    Alignment *newAlignment = new Alignment(time, type);
+    Alignment *newAlignment = NewAlignment(time, type);
     AddAlignment(newAlignment, idx);
     return newAlignment;
 }
@@ -147,6 +216,9 @@ void MeasureAligner::SetMaxTime(double time)
     // we have to have a m_rightBarLineAlignment
     assert(m_rightBarLineAlignment);
 
+    // Since the alignments are sorted, none of the ones from the right barline can be before
+    if (time <= m_rightBarLineAlignment->GetTime()) return;
+
     // it must be found in the aligner
     int idx = m_rightBarLineAlignment->GetIdx();
     assert(idx != -1);
@@ -155,8 +227,7 @@ void MeasureAligner::SetMaxTime(double time)
     Alignment *alignment = NULL;
     // Increase the time position for all alignment from the right barline
     for (i = idx; i < GetAlignmentCount(); ++i) {
-        alignment = dynamic_cast<Alignment *>(m_children.at(i));
-        assert(alignment);
+        alignment = this->GetAlignment(i);
         // Change it only if higher than before
         if (time > alignment->GetTime()) alignment->SetTime(time);
     }
@@ -299,6 +370,7 @@ GraceAligner::~GraceAligner() {}
 void GraceAligner::Reset()
 {
     HorizontalAligner::Reset();
+    m_graceStack.clear();
     m_totalWidth = 0;
 }
 
@@ -313,7 +385,7 @@ Alignment *GraceAligner::GetAlignmentAtTime(double time, AlignmentType type)
     if (idx == -1) {
         idx = GetAlignmentCount();
     }
-    Alignment *newAlignment = new Alignment(time, type);
+    Alignment *newAlignment = NewAlignment(time, type);
     AddAlignment(newAlignment, idx);
     return newAlignment;
 }
@@ -424,12 +496,12 @@ void GraceAligner::SetGraceAligmentXPos(Doc *doc)
 // Alignment
 //----------------------------------------------------------------------------
 
-Alignment::Alignment() : Object()
+Alignment::Alignment() : Object("m-", false)
 {
     Reset();
 }
 
-Alignment::Alignment(double time, AlignmentType type) : Object()
+Alignment::Alignment(double time, AlignmentType type) : Object("m-", false)
 {
     Reset();
     m_time = time;
@@ -452,6 +524,34 @@ Alignment::~Alignment()
     ClearGraceAligners();
 }
 
+void Alignment::ClearForReuse(ArrayOfObjects *referencePool, std::vector<GraceAligner *> *graceAlignerPool)
+{
+    assert(referencePool);
+    assert(graceAlignerPool);
+
+    ResetCachedDrawingX();
+
+    // The children are all AlignmentReference objects (see Alignment::AddChild)
+    for (Object *reference : m_children) {
+        // The parent is set again when the reference is added to an alignment
+        reference->ResetParent();
+        referencePool->push_back(reference);
+    }
+    m_children.clear();
+    for (auto &graceAligner : m_graceAligners) {
+        graceAlignerPool->push_back(graceAligner.second);
+    }
+    m_graceAligners.clear();
+
+    ResetBoundingBox();
+    // Also set again when the alignment is added (see HorizontalAligner::AddAlignment)
+    ResetParent();
+
+    m_xRel = 0;
+    m_time = 0.0;
+    m_type = ALIGNMENT_DEFAULT;
+}
+
 void Alignment::ClearGraceAligners()
 {
     MapOfIntGraceAligners::const_iterator iter;
@@ -482,7 +582,8 @@ AlignmentReference *Alignment::GetAlignmentReference(int staffN)
     AlignmentReference *alignmentRef
         = dynamic_cast<AlignmentReference *>(this->FindDescendantByComparison(&matchStaff, 1));
     if (!alignmentRef) {
-        alignmentRef = new AlignmentReference(staffN);
+        HorizontalAligner *aligner = dynamic_cast<HorizontalAligner *>(this->GetParent());
+        alignmentRef = (aligner) ? aligner->NewAlignmentReference(staffN) : new AlignmentReference(staffN);
         this->AddChild(alignmentRef);
     }
     return alignmentRef;
@@ -563,7 +664,8 @@ void Alignment::GetLeftRight(int staffN, int &minLeft, int &maxRight)
 GraceAligner *Alignment::GetGraceAligner(int id)
 {
     if (m_graceAligners.count(id) == 0) {
-        m_graceAligners[id] = new GraceAligner();
+        HorizontalAligner *aligner = dynamic_cast<HorizontalAligner *>(this->GetParent());
+        m_graceAligners[id] = (aligner) ? aligner->NewGraceAligner() : new GraceAligner();
     }
     return m_graceAligners[id];
 }
@@ -606,7 +708,7 @@ void Alignment::AddToAccidSpace(Accid *accid)
 // AlignmentReference
 //----------------------------------------------------------------------------
 
-AlignmentReference::AlignmentReference() : Object(), AttNInteger()
+AlignmentReference::AlignmentReference() : Object("m-", false), AttNInteger()
 {
     RegisterAttClass(ATT_NINTEGER);
 
@@ -615,7 +717,7 @@ AlignmentReference::AlignmentReference() : Object(), AttNInteger()
     this->SetAsReferenceObject();
 }
 
-AlignmentReference::AlignmentReference(int staffN) : Object(), AttNInteger()
+AlignmentReference::AlignmentReference(int staffN) : Object("m-", false), AttNInteger()
 {
     RegisterAttClass(ATT_NINTEGER);
 
@@ -685,8 +787,10 @@ void AlignmentReference::AdjustAccidWithAccidSpace(Accid *accid, Doc *doc, int s
 // TimestampAligner
 //----------------------------------------------------------------------------
 
-TimestampAligner::TimestampAligner() : Object()
+TimestampAligner::TimestampAligner() : Object("m-", false)
 {
+    this->SetAsOutsideUuidIndex();
+
     Reset();
 }
 
@@ -699,25 +803,27 @@ void TimestampAligner::Reset()
 
 TimestampAttr *TimestampAligner::GetTimestampAtTime(double time)
 {
-    int i;
     int idx = -1; // the index if we reach the end.
     // We need to adjust the position since timestamp 0 to 1.0 are before 0 musical time
     time = time - 1.0;
     TimestampAttr *timestampAttr = NULL;
-    // First try to see if we already have something at the time position
-    for (i = 0; i < GetChildCount(); ++i) {
-        timestampAttr = dynamic_cast<TimestampAttr *>(m_children.at(i));
-        assert(timestampAttr);
-
-        double alignmentTime = timestampAttr->GetActualDurPos();
-        if (AreEqual(alignmentTime, time)) {
+    // Look for the first timestamp that is not before the time position
+    ArrayOfObjects::iterator iter
+        = std::lower_bound(m_children.begin(), m_children.end(), time, [](Object *object, double time) {
+              assert(object->Is(TIMESTAMP_ATTR));
+              // The children are all TimestampAttr objects created below
+              TimestampAttr *timestampAttr = static_cast<TimestampAttr *>(object);
+              double alignmentTime = timestampAttr->GetActualDurPos();
+              return (!AreEqual(alignmentTime, time) && (alignmentTime < time));
+          });
+    if (iter != m_children.end()) {
+        timestampAttr = static_cast<TimestampAttr *>(*iter);
+        // we already have something at the time position
+        if (AreEqual(timestampAttr->GetActualDurPos(), time)) {
             return timestampAttr;
         }
-        // nothing found, do not go any further but keep the index
-        if (alignmentTime > time) {
-            idx = i;
-            break;
-        }
+        // nothing found, but keep the index
+        idx = (int)(iter - m_children.begin());
     }
     // nothing found
     timestampAttr = new TimestampAttr();
@@ -11838,6 +11838,8 @@ void HumdrumInput::convertMRest(MRest *rest, hum::HTp token, int subtoken, int s
                 // has a fermata (so you would not want to overwrite them).
                 rest->SetFermata(STAFFREL_basic_above);
             }
+            // @fermata is converted to <fermata> with the analytical markup
+            m_doc->SetAnalyticalMarkup(true);
         }
     }
 
@@ -11947,6 +11949,8 @@ void HumdrumInput::convertRest(Rest *rest, hum::HTp token, int subtoken)
                 // has a fermata (so you would not want to overwrite them).
                 rest->SetFermata(STAFFREL_basic_above);
             }
+            // @fermata is converted to <fermata> with the analytical markup
+            m_doc->SetAnalyticalMarkup(true);
         }
     }
 
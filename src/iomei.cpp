@@ -9,8 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <iostream>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
@@ -136,6 +138,10 @@ MeiOutput::MeiOutput(Doc *doc, std::string filename) : FileOutputStream(doc)
     m_writeToStreamString = false;
     m_page = -1;
     m_scoreBasedMEI = false;
+    m_output = NULL;
+    m_outputFlags = pugi::format_default;
+    m_streamRootDepth = 0;
+    m_streamHeadWritten = false;
 }
 
 MeiOutput::~MeiOutput() {}
@@ -143,35 +149,55 @@ MeiOutput::~MeiOutput() {}
 bool MeiOutput::ExportFile()
 {
     try {
-        pugi::xml_document meiDoc;
+        m_meiDoc.reset();
+
+        m_outputFlags = pugi::format_default;
+        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
+            m_outputFlags |= pugi::format_no_escapes;
+        }
+
+        if (m_writeToStreamString) {
+            m_output = &m_streamStringOutput;
+        }
+        else {
+            this->open(m_filename.c_str(), std::ios::out | std::ios::binary);
+            if (!this->is_open() || this->fail()) {
+                LogError("Unable to open the file '%s' for writing", m_filename.c_str());
+                return false;
+            }
+            m_output = this;
+        }
 
         if (m_page < 0) {
-            pugi::xml_node decl = meiDoc.prepend_child(pugi::node_declaration);
+            pugi::xml_node decl = m_meiDoc.prepend_child(pugi::node_declaration);
             decl.append_attribute("version") = "1.0";
             decl.append_attribute("encoding") = "UTF-8";
 
             // schema processing instruction
-            decl = meiDoc.append_child(pugi::node_declaration);
+            decl = m_meiDoc.append_child(pugi::node_declaration);
             decl.set_name("xml-model");
             decl.append_attribute("href") = "https://music-encoding.org/schema/4.0.0/mei-all.rng";
             decl.append_attribute("type") = "application/xml";
             decl.append_attribute("schematypens") = "http://relaxng.org/ns/structure/1.0";
 
             // schematron processing instruction
-            decl = meiDoc.append_child(pugi::node_declaration);
+            decl = m_meiDoc.append_child(pugi::node_declaration);
             decl.set_name("xml-model");
             decl.append_attribute("href") = "https://music-encoding.org/schema/4.0.0/mei-all.rng";
             decl.append_attribute("type") = "application/xml";
             decl.append_attribute("schematypens") = "http://purl.oclc.org/dsdl/schematron";
 
-            m_mei = meiDoc.append_child("mei");
+            m_mei = m_meiDoc.append_child("mei");
             m_mei.append_attribute("xmlns") = "http://www.music-encoding.org/ns/mei";
             m_mei.append_attribute("meiversion") = "4.0.0";
 
+            // The pending pages of a progressive cast off are output as the other ones
+            m_doc->CastOffPendingPages();
+
             // If the document is mensural, we have to undo the mensural (segments) cast off
             m_doc->ConvertToUnCastOffMensuralDoc();
 
-            // this starts the call of all the functors
+            // this starts the call of all the functors - the streaming starts with the <body> in WriteDoc
             m_doc->Save(this);
 
             // Redo the mensural segment cast of if necessary
@@ -182,7 +208,9 @@ bool MeiOutput::ExportFile()
                 LogError("MEI output by page is not possible for mensural music");
                 return false;
             }
-            if (m_page >= m_doc->GetPageCount()) {
+            // With a progressive cast off, only the pages up to the one output need to be cast off
+            m_doc->CastOffPendingPages(m_page + 1);
+            if (m_page >= m_doc->GetCastOffPageCount()) {
                 LogError("Page %d does not exist", m_page);
                 return false;
             }
@@ -191,29 +219,26 @@ bool MeiOutput::ExportFile()
             Page *page = dynamic_cast<Page *>(pages->GetChild(m_page));
             assert(page);
             if (m_scoreBasedMEI) {
-                m_currentNode = meiDoc.append_child("score");
+                m_currentNode = m_meiDoc.append_child("score");
                 m_currentNode = m_currentNode.append_child("section");
                 m_nodeStack.push_back(m_currentNode);
+                this->StartStreaming(m_currentNode);
                 // First save the main scoreDef
                 m_doc->m_scoreDef.Save(this);
             }
             else {
-                m_currentNode = meiDoc.append_child("pages");
+                m_currentNode = m_meiDoc.append_child("pages");
+                this->StartStreaming(m_currentNode);
             }
 
             page->Save(this);
         }
 
-        unsigned int output_flags = pugi::format_default;
-        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
-            output_flags |= pugi::format_no_escapes;
-        }
+        this->EndStreaming();
+        m_meiDoc.reset();
 
-        if (m_writeToStreamString) {
-            meiDoc.save(m_streamStringOutput, "    ", output_flags);
-        }
-        else {
-            meiDoc.save_file(m_filename.c_str(), "    ", output_flags);
+        if (!m_writeToStreamString) {
+            this->close();
         }
     }
     catch (char *str) {
@@ -707,6 +732,10 @@ bool MeiOutput::WriteObject(Object *object)
 
     // Object representing an attribute have no node to push
     if (!object->IsAttribute()) m_nodeStack.push_back(m_currentNode);
+    if (!object->IsAttribute() && this->IsStreamedContainer(object)) m_containerNodes.push_back(m_currentNode);
+
+    // Before the scoreDef below, since the start tag can be written with it
+    WriteUnsupportedAttr(m_currentNode, object);
 
     if (object->Is(PAGES) && (dynamic_cast<Pages *>(object) == m_doc->GetPages())) {
         // First save the main scoreDef
@@ -717,8 +746,6 @@ bool MeiOutput::WriteObject(Object *object)
         m_doc->m_scoreDef.Save(this);
     }
 
-    WriteUnsupportedAttr(m_currentNode, object);
-
     return true;
 }
 
@@ -737,12 +764,184 @@ bool MeiOutput::WriteObjectEnd(Object *object)
     else if (m_scoreBasedMEI && (object->Is(PAGE))) {
         return true;
     }
+    pugi::xml_node node = m_nodeStack.back();
     m_nodeStack.pop_back();
+    // The node is complete unless it is also the one below (e.g., pushed again for a text it contains)
+    if (m_nodeStack.empty() || (m_nodeStack.back() != node)) {
+        this->StreamNodeEnd(node);
+        if (!m_containerNodes.empty() && (m_containerNodes.back() == node)) m_containerNodes.pop_back();
+    }
     m_currentNode = m_nodeStack.back();
 
     return true;
 }
 
+void MeiOutput::StartStreaming(pugi::xml_node root)
+{
+    // The root and its ancestors, from the top element
+    std::vector<pugi::xml_node> ancestors;
+    for (pugi::xml_node node = root; node.type() == pugi::node_element; node = node.parent()) {
+        ancestors.insert(ancestors.begin(), node);
+    }
+    m_streamRootDepth = (int)ancestors.size() - 1;
+
+    // The document down to the start tag of the root, and from the end tag of the root
+    std::ostringstream head;
+    bool hasDeclaration = false;
+    for (pugi::xml_node node = m_meiDoc.first_child(); node; node = node.next_sibling()) {
+        if (node.type() == pugi::node_declaration) hasDeclaration = true;
+    }
+    // Saving an empty document writes the declaration pugi adds to a document without one
+    if (!hasDeclaration) pugi::xml_document().save(head, "    ", m_outputFlags);
+    for (int depth = 0; depth <= m_streamRootDepth; ++depth) {
+        pugi::xml_node node = ancestors.at(depth);
+        for (pugi::xml_node sibling = node.parent().first_child(); sibling != node; sibling = sibling.next_sibling()) {
+            sibling.print(head, "    ", m_outputFlags, pugi::encoding_auto, depth);
+        }
+        this->StreamStartTag(head, node, depth);
+    }
+    std::ostringstream tail;
+    for (int depth = m_streamRootDepth; depth >= 0; --depth) {
+        pugi::xml_node node = ancestors.at(depth);
+        this->StreamEndTag(tail, node, depth);
+        for (pugi::xml_node sibling = node.next_sibling(); sibling; sibling = sibling.next_sibling()) {
+            sibling.print(tail, "    ", m_outputFlags, pugi::encoding_auto, depth);
+        }
+    }
+    m_streamHead = head.str();
+    m_streamTail = tail.str();
+    m_streamHeadWritten = false;
+
+    m_streamedNodes.clear();
+    m_streamedNodes.push_back(root);
+}
+
+void MeiOutput::StreamNodeEnd(pugi::xml_node node)
+{
+    // The root is closed in EndStreaming
+    if (m_streamedNodes.empty() || (node == m_streamedNodes.front())) return;
+
+    if (node == m_streamedNodes.back()) {
+        const int depth = m_streamRootDepth + (int)m_streamedNodes.size() - 1;
+        this->StreamChildren(node, depth + 1);
+        this->StreamEndTag(*m_output, node, depth);
+        m_streamedNodes.pop_back();
+        node.parent().remove_child(node);
+    }
+    else if (this->OpenStreamedNode(node.parent())) {
+        this->StreamChildren(node.parent(), m_streamRootDepth + (int)m_streamedNodes.size());
+    }
+}
+
+void MeiOutput::EndStreaming()
+{
+    if (m_streamedNodes.empty() || !m_streamHeadWritten) {
+        // Nothing was streamed - write the tree as a whole
+        m_meiDoc.save(*m_output, "    ", m_outputFlags);
+    }
+    else {
+        // Close the containers left open (if any) and the root
+        while (m_streamedNodes.size() > 1) {
+            this->StreamNodeEnd(m_streamedNodes.back());
+        }
+        this->StreamChildren(m_streamedNodes.front(), m_streamRootDepth + 1);
+        *m_output << m_streamTail;
+    }
+    m_streamedNodes.clear();
+    m_containerNodes.clear();
+}
+
+bool MeiOutput::OpenStreamedNode(pugi::xml_node node)
+{
+    if (m_streamedNodes.empty()) return false;
+
+    if (node == m_streamedNodes.back()) {
+        if (!m_streamHeadWritten) {
+            *m_output << m_streamHead;
+            m_streamHeadWritten = true;
+        }
+        return true;
+    }
+
+    // The parent has to be opened first, up to the root
+    if (std::find(m_containerNodes.begin(), m_containerNodes.end(), node) == m_containerNodes.end()) return false;
+    if (!this->OpenStreamedNode(node.parent())) return false;
+    assert(node.parent() == m_streamedNodes.back());
+
+    // Write what precedes the node in its parent and then its start tag
+    const int depth = m_streamRootDepth + (int)m_streamedNodes.size();
+    this->StreamChildren(node.parent(), depth, node);
+    this->StreamStartTag(*m_output, node, depth);
+
+    m_streamedNodes.push_back(node);
+    return true;
+}
+
+void MeiOutput::StreamChildren(pugi::xml_node node, int depth, pugi::xml_node until)
+{
+    pugi::xml_node child = node.first_child();
+    while (child && (child != until)) {
+        child.print(*m_output, "    ", m_outputFlags, pugi::encoding_auto, depth);
+        pugi::xml_node next = child.next_sibling();
+        node.remove_child(child);
+        child = next;
+    }
+}
+
+void MeiOutput::StreamStartTag(std::ostream &output, pugi::xml_node node, int depth)
+{
+    for (int i = 0; i < depth; ++i) output << "    ";
+    output << "<" << node.name();
+    for (pugi::xml_attribute attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        output << " " << attr.name() << "=\"";
+        if (m_outputFlags & pugi::format_no_escapes) {
+            output << attr.value();
+        }
+        else {
+            // Escaped as pugi does for attribute values, writing the runs of other characters at once
+            const char *run = attr.value();
+            for (const char *c = run; *c; ++c) {
+                if ((*c != '&') && (*c != '<') && (*c != '"') && ((unsigned char)*c >= 32)) continue;
+                output.write(run, c - run);
+                run = c + 1;
+                switch (*c) {
+                    case '&': output << "&amp;"; break;
+                    case '<': output << "&lt;"; break;
+                    case '"': output << "&quot;"; break;
+                    default: output << "&#" << (char)('0' + *c / 10) << (char)('0' + *c % 10) << ";";
+                }
+            }
+            output << run;
+        }
+        output << "\"";
+    }
+    output << ">\n";
+}
+
+void MeiOutput::StreamEndTag(std::ostream &output, pugi::xml_node node, int depth)
+{
+    for (int i = 0; i < depth; ++i) output << "    ";
+    output << "</" << node.name() << ">\n";
+}
+
+bool MeiOutput::IsStreamedContainer(Object *object) const
+{
+    // Containers with element content only, and with all their attributes written when they are created
+    switch (object->GetClassId()) {
+        case ENDING:
+        case LAYER:
+        case MDIV:
+        case MEASURE:
+        case PAGE:
+        case PAGES:
+        case SCORE:
+        case SECTION:
+        case STAFF:
+        case SYSTEM: return true;
+        default: return false;
+    }
+}
+
 std::string MeiOutput::UuidToMeiStr(Object *element)
 {
     std::string out = element->GetUuid();
@@ -808,6 +1007,9 @@ bool MeiOutput::WriteDoc(Doc *doc)
         music.append_copy(m_doc->m_back.first_child());
     }
 
+    // The document is complete apart from the content of the <body>, which is streamed from here
+    this->StartStreaming(m_currentNode);
+
     /*
     if (m_scoreBasedMEI) {
         m_currentNode = mdiv.append_child("score");
@@ -2776,8 +2978,9 @@ bool MeiInput::ReadMdiv(Object *parent, pugi::xml_node mdiv, bool isVisible)
     Mdiv *vrvMdiv = new Mdiv();
     SetMeiUuid(mdiv, vrvMdiv);
 
-    vrvMdiv->ReadLabelled(mdiv);
-    vrvMdiv->ReadNNumberLike(mdiv);
+    AttReader reader(mdiv);
+    vrvMdiv->ReadLabelled(reader);
+    vrvMdiv->ReadNNumberLike(reader);
 
     parent->AddChild(vrvMdiv);
 
@@ -2830,8 +3033,9 @@ bool MeiInput::ReadPages(Object *parent, pugi::xml_node pages)
     Pages *vrvPages = new Pages();
     SetMeiUuid(pages, vrvPages);
 
-    vrvPages->ReadLabelled(pages);
-    vrvPages->ReadNNumberLike(pages);
+    AttReader reader(pages);
+    vrvPages->ReadLabelled(reader);
+    vrvPages->ReadNNumberLike(reader);
 
     parent->AddChild(vrvPages);
 
@@ -2885,8 +3089,9 @@ bool MeiInput::ReadScore(Object *parent, pugi::xml_node score)
     Score *vrvScore = new Score();
     SetMeiUuid(score, vrvScore);
 
-    vrvScore->ReadLabelled(score);
-    vrvScore->ReadNNumberLike(score);
+    AttReader reader(score);
+    vrvScore->ReadLabelled(reader);
+    vrvScore->ReadNNumberLike(reader);
 
     parent->AddChild(vrvScore);
 
@@ -2934,7 +3139,8 @@ bool MeiInput::ReadSection(Object *parent, pugi::xml_node section)
     Section *vrvSection = new Section();
     SetMeiUuid(section, vrvSection);
 
-    vrvSection->ReadNNumberLike(section);
+    AttReader reader(section);
+    vrvSection->ReadNNumberLike(reader);
 
     parent->AddChild(vrvSection);
     ReadUnsupportedAttr(section, vrvSection);
@@ -3010,10 +3216,10 @@ bool MeiInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
     return success;
 }
 
-bool MeiInput::ReadSystemElement(pugi::xml_node element, SystemElement *object)
+bool MeiInput::ReadSystemElement(pugi::xml_node element, SystemElement *object, AttReader &reader)
 {
     SetMeiUuid(element, object);
-    object->ReadTyped(element);
+    object->ReadTyped(reader);
 
     return true;
 }
@@ -3021,10 +3227,11 @@ bool MeiInput::ReadSystemElement(pugi::xml_node element, SystemElement *object)
 bool MeiInput::ReadEnding(Object *parent, pugi::xml_node ending)
 {
     Ending *vrvEnding = new Ending();
-    ReadSystemElement(ending, vrvEnding);
+    AttReader reader(ending);
+    ReadSystemElement(ending, vrvEnding, reader);
 
-    vrvEnding->ReadLineRend(ending);
-    vrvEnding->ReadNNumberLike(ending);
+    vrvEnding->ReadLineRend(reader);
+    vrvEnding->ReadNNumberLike(reader);
 
     parent->AddChild(vrvEnding);
     ReadUnsupportedAttr(ending, vrvEnding);
@@ -3037,8 +3244,9 @@ bool MeiInput::ReadEnding(Object *parent, pugi::xml_node ending)
 bool MeiInput::ReadExpansion(Object *parent, pugi::xml_node expansion)
 {
     Expansion *vrvExpansion = new Expansion();
-    ReadSystemElement(expansion, vrvExpansion);
-    ReadPlistInterface(expansion, vrvExpansion);
+    AttReader reader(expansion);
+    ReadSystemElement(expansion, vrvExpansion, reader);
+    ReadPlistInterface(expansion, vrvExpansion, reader);
 
     parent->AddChild(vrvExpansion);
     ReadUnsupportedAttr(expansion, vrvExpansion);
@@ -3053,9 +3261,10 @@ bool MeiInput::ReadPb(Object *parent, pugi::xml_node pb)
     this->m_hasLayoutInformation = true;
 
     Pb *vrvPb = new Pb();
-    ReadSystemElement(pb, vrvPb);
+    AttReader reader(pb);
+    ReadSystemElement(pb, vrvPb, reader);
 
-    vrvPb->ReadNNumberLike(pb);
+    vrvPb->ReadNNumberLike(reader);
 
     parent->AddChild(vrvPb);
     ReadUnsupportedAttr(pb, vrvPb);
@@ -3065,9 +3274,10 @@ bool MeiInput::ReadPb(Object *parent, pugi::xml_node pb)
 bool MeiInput::ReadSb(Object *parent, pugi::xml_node sb)
 {
     Sb *vrvSb = new Sb();
-    ReadSystemElement(sb, vrvSb);
+    AttReader reader(sb);
+    ReadSystemElement(sb, vrvSb, reader);
 
-    vrvSb->ReadNNumberLike(sb);
+    vrvSb->ReadNNumberLike(reader);
 
     parent->AddChild(vrvSb);
     ReadUnsupportedAttr(sb, vrvSb);
@@ -3166,7 +3376,8 @@ bool MeiInput::ReadSystem(Object *parent, pugi::xml_node system)
 
     System *vrvSystem = new System();
     SetMeiUuid(system, vrvSystem);
-    vrvSystem->ReadTyped(system);
+    AttReader reader(system);
+    vrvSystem->ReadTyped(reader);
 
     if (system.attribute("system.leftmar")) {
         vrvSystem->m_systemLeftMar = atoi(system.attribute("system.leftmar").value());
@@ -3257,22 +3468,23 @@ bool MeiInput::ReadBoundaryEnd(Object *parent, pugi::xml_node boundaryEnd)
     }
 
     BoundaryEnd *vrvBoundaryEnd = new BoundaryEnd(start);
-    ReadSystemElement(boundaryEnd, vrvBoundaryEnd);
+    AttReader reader(boundaryEnd);
+    ReadSystemElement(boundaryEnd, vrvBoundaryEnd, reader);
 
     parent->AddChild(vrvBoundaryEnd);
     return true;
 }
 
-bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object)
+bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object, AttReader &reader)
 {
     SetMeiUuid(element, object);
-    object->ReadMeasureNumbers(element);
-    object->ReadTyped(element);
+    object->ReadMeasureNumbers(reader);
+    object->ReadTyped(reader);
 
     AttCleffingLog cleffingLog;
-    cleffingLog.ReadCleffingLog(element);
+    cleffingLog.ReadCleffingLog(reader);
     AttCleffingVis cleffingVis;
-    cleffingVis.ReadCleffingVis(element);
+    cleffingVis.ReadCleffingVis(reader);
     if (cleffingLog.HasClefLine() && cleffingLog.HasClefShape()) {
         Clef *vrvClef = new Clef();
         vrvClef->IsAttribute(true);
@@ -3285,11 +3497,11 @@ bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *obje
     }
 
     AttKeySigDefaultAnl keySigDefaultAnl;
-    keySigDefaultAnl.ReadKeySigDefaultAnl(element);
+    keySigDefaultAnl.ReadKeySigDefaultAnl(reader);
     AttKeySigDefaultLog keySigDefaultLog;
-    keySigDefaultLog.ReadKeySigDefaultLog(element);
+    keySigDefaultLog.ReadKeySigDefaultLog(reader);
     AttKeySigDefaultVis keySigDefaultVis;
-    keySigDefaultVis.ReadKeySigDefaultVis(element);
+    keySigDefaultVis.ReadKeySigDefaultVis(reader);
     if (keySigDefaultAnl.HasKeyAccid() || keySigDefaultAnl.HasKeyMode() || keySigDefaultAnl.HasKeyPname()
         || keySigDefaultLog.HasKeySig() || keySigDefaultVis.HasKeysigShow() || keySigDefaultVis.HasKeysigShowchange()) {
         KeySig *vrvKeySig = new KeySig();
@@ -3305,11 +3517,11 @@ bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *obje
     }
 
     AttMensuralLog mensuralLog;
-    mensuralLog.ReadMensuralLog(element);
+    mensuralLog.ReadMensuralLog(reader);
     AttMensuralShared mensuralShared;
-    mensuralShared.ReadMensuralShared(element);
+    mensuralShared.ReadMensuralShared(reader);
     AttMensuralVis mensuralVis;
-    mensuralVis.ReadMensuralVis(element);
+    mensuralVis.ReadMensuralVis(reader);
     if (mensuralShared.HasProlatio() || mensuralShared.HasTempus() || mensuralLog.HasProportNum()
         || mensuralLog.HasProportNumbase() || mensuralLog.HasMensurSign()) {
         Mensur *vrvMensur = new Mensur();
@@ -3332,9 +3544,9 @@ bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *obje
     }
 
     AttMeterSigDefaultLog meterSigDefaultLog;
-    meterSigDefaultLog.ReadMeterSigDefaultLog(element);
+    meterSigDefaultLog.ReadMeterSigDefaultLog(reader);
     AttMeterSigDefaultVis meterSigDefaultVis;
-    meterSigDefaultVis.ReadMeterSigDefaultVis(element);
+    meterSigDefaultVis.ReadMeterSigDefaultVis(reader);
     if (meterSigDefaultLog.HasMeterCount() || meterSigDefaultLog.HasMeterSym() || meterSigDefaultLog.HasMeterUnit()) {
         MeterSig *vrvMeterSig = new MeterSig();
         vrvMeterSig->IsAttribute(true);
@@ -3363,15 +3575,18 @@ bool MeiInput::ReadScoreDef(Object *parent, pugi::xml_node scoreDef)
     else {
         vrvScoreDef = new ScoreDef();
     }
-    ReadScoreDefElement(scoreDef, vrvScoreDef);
+    AttReader reader(scoreDef);
+    ReadScoreDefElement(scoreDef, vrvScoreDef, reader);
 
     if (m_version < MEI_4_0_0) {
         UpgradeScoreDefElementTo_4_0_0(scoreDef, vrvScoreDef);
+        // The upgrade removes attributes from the element, so the reader is built again
+        reader = AttReader(scoreDef);
     }
 
-    ReadScoreDefInterface(scoreDef, vrvScoreDef);
-    vrvScoreDef->ReadEndings(scoreDef);
-    vrvScoreDef->ReadOptimization(scoreDef);
+    ReadScoreDefInterface(scoreDef, vrvScoreDef, reader);
+    vrvScoreDef->ReadEndings(reader);
+    vrvScoreDef->ReadOptimization(reader);
 
     if (!m_hasScoreDef && m_useScoreDefForDoc) {
         m_hasScoreDef = true;
@@ -3443,11 +3658,12 @@ bool MeiInput::ReadStaffGrp(Object *parent, pugi::xml_node staffGrp)
         UpgradeStaffGrpTo_4_0_0(staffGrp, vrvStaffGrp);
     }
 
-    vrvStaffGrp->ReadBasic(staffGrp);
-    vrvStaffGrp->ReadLabelled(staffGrp);
-    vrvStaffGrp->ReadStaffGroupingSym(staffGrp);
-    vrvStaffGrp->ReadStaffGrpVis(staffGrp);
-    vrvStaffGrp->ReadTyped(staffGrp);
+    AttReader reader(staffGrp);
+    vrvStaffGrp->ReadBasic(reader);
+    vrvStaffGrp->ReadLabelled(reader);
+    vrvStaffGrp->ReadStaffGroupingSym(reader);
+    vrvStaffGrp->ReadStaffGrpVis(reader);
+    vrvStaffGrp->ReadTyped(reader);
 
     parent->AddChild(vrvStaffGrp);
     ReadUnsupportedAttr(staffGrp, vrvStaffGrp);
@@ -3489,11 +3705,11 @@ bool MeiInput::ReadStaffGrpChildren(Object *parent, pugi::xml_node parentNode)
     return success;
 }
 
-bool MeiInput::ReadRunningElement(pugi::xml_node element, RunningElement *object)
+bool MeiInput::ReadRunningElement(pugi::xml_node element, RunningElement *object, AttReader &reader)
 {
     SetMeiUuid(element, object);
-    object->ReadHorizontalAlign(element);
-    object->ReadTyped(element);
+    object->ReadHorizontalAlign(reader);
+    object->ReadTyped(reader);
 
     return true;
 }
@@ -3501,7 +3717,8 @@ bool MeiInput::ReadRunningElement(pugi::xml_node element, RunningElement *object
 bool MeiInput::ReadPgFoot(Object *parent, pugi::xml_node pgFoot)
 {
     PgFoot *vrvPgFoot = new PgFoot();
-    ReadRunningElement(pgFoot, vrvPgFoot);
+    AttReader reader(pgFoot);
+    ReadRunningElement(pgFoot, vrvPgFoot, reader);
 
     parent->AddChild(vrvPgFoot);
     ReadUnsupportedAttr(pgFoot, vrvPgFoot);
@@ -3511,7 +3728,8 @@ bool MeiInput::ReadPgFoot(Object *parent, pugi::xml_node pgFoot)
 bool MeiInput::ReadPgFoot2(Object *parent, pugi::xml_node pgFoot2)
 {
     PgFoot2 *vrvPgFoot2 = new PgFoot2();
-    ReadRunningElement(pgFoot2, vrvPgFoot2);
+    AttReader reader(pgFoot2);
+    ReadRunningElement(pgFoot2, vrvPgFoot2, reader);
 
     parent->AddChild(vrvPgFoot2);
     ReadUnsupportedAttr(pgFoot2, vrvPgFoot2);
@@ -3521,7 +3739,8 @@ bool MeiInput::ReadPgFoot2(Object *parent, pugi::xml_node pgFoot2)
 bool MeiInput::ReadPgHead(Object *parent, pugi::xml_node pgHead)
 {
     PgHead *vrvPgHead = new PgHead();
-    ReadRunningElement(pgHead, vrvPgHead);
+    AttReader reader(pgHead);
+    ReadRunningElement(pgHead, vrvPgHead, reader);
 
     parent->AddChild(vrvPgHead);
     ReadUnsupportedAttr(pgHead, vrvPgHead);
@@ -3531,7 +3750,8 @@ bool MeiInput::ReadPgHead(Object *parent, pugi::xml_node pgHead)
 bool MeiInput::ReadPgHead2(Object *parent, pugi::xml_node pgHead2)
 {
     PgHead2 *vrvPgHead2 = new PgHead2();
-    ReadRunningElement(pgHead2, vrvPgHead2);
+    AttReader reader(pgHead2);
+    ReadRunningElement(pgHead2, vrvPgHead2, reader);
 
     parent->AddChild(vrvPgHead2);
     ReadUnsupportedAttr(pgHead2, vrvPgHead2);
@@ -3581,28 +3801,31 @@ bool MeiInput::ReadStaffDef(Object *parent, pugi::xml_node staffDef)
     assert(dynamic_cast<StaffGrp *>(parent) || dynamic_cast<EditorialElement *>(parent));
 
     StaffDef *vrvStaffDef = new StaffDef();
-    ReadScoreDefElement(staffDef, vrvStaffDef);
+    AttReader reader(staffDef);
+    ReadScoreDefElement(staffDef, vrvStaffDef, reader);
 
     if (m_version < MEI_4_0_0) {
         UpgradeScoreDefElementTo_4_0_0(staffDef, vrvStaffDef);
         UpgradeStaffDefTo_4_0_0(staffDef, vrvStaffDef);
+        // The upgrade removes attributes from the element, so the reader is built again
+        reader = AttReader(staffDef);
     }
 
-    vrvStaffDef->ReadDistances(staffDef);
-    vrvStaffDef->ReadLabelled(staffDef);
-    vrvStaffDef->ReadNInteger(staffDef);
-    vrvStaffDef->ReadNotationType(staffDef);
-    vrvStaffDef->ReadScalable(staffDef);
-    vrvStaffDef->ReadStaffDefLog(staffDef);
-    vrvStaffDef->ReadStaffDefVis(staffDef);
-    vrvStaffDef->ReadTimeBase(staffDef);
-    vrvStaffDef->ReadTransposition(staffDef);
+    vrvStaffDef->ReadDistances(reader);
+    vrvStaffDef->ReadLabelled(reader);
+    vrvStaffDef->ReadNInteger(reader);
+    vrvStaffDef->ReadNotationType(reader);
+    vrvStaffDef->ReadScalable(reader);
+    vrvStaffDef->ReadStaffDefLog(reader);
+    vrvStaffDef->ReadStaffDefVis(reader);
+    vrvStaffDef->ReadTimeBase(reader);
+    vrvStaffDef->ReadTransposition(reader);
 
     if (!vrvStaffDef->HasN()) {
         LogWarning("No @n on <staffDef> might yield unpredictable results");
     }
 
-    ReadScoreDefInterface(staffDef, vrvStaffDef);
+    ReadScoreDefInterface(staffDef, vrvStaffDef, reader);
 
     m_doc->m_notationType = vrvStaffDef->GetNotationtype();
 
@@ -3655,10 +3878,11 @@ bool MeiInput::ReadInstrDef(Object *parent, pugi::xml_node instrDef)
     SetMeiUuid(instrDef, vrvInstrDef);
 
     parent->AddChild(vrvInstrDef);
-    vrvInstrDef->ReadChannelized(instrDef);
-    vrvInstrDef->ReadLabelled(instrDef);
-    vrvInstrDef->ReadMidiInstrument(instrDef);
-    vrvInstrDef->ReadNNumberLike(instrDef);
+    AttReader reader(instrDef);
+    vrvInstrDef->ReadChannelized(reader);
+    vrvInstrDef->ReadLabelled(reader);
+    vrvInstrDef->ReadMidiInstrument(reader);
+    vrvInstrDef->ReadNNumberLike(reader);
 
     return true;
 }
@@ -3692,12 +3916,13 @@ bool MeiInput::ReadMeasure(Object *parent, pugi::xml_node measure)
     }
     SetMeiUuid(measure, vrvMeasure);
 
-    vrvMeasure->ReadBarring(measure);
-    vrvMeasure->ReadMeasureLog(measure);
-    vrvMeasure->ReadMeterConformanceBar(measure);
-    vrvMeasure->ReadNNumberLike(measure);
-    vrvMeasure->ReadPointing(measure);
-    vrvMeasure->ReadTyped(measure);
+    AttReader reader(measure);
+    vrvMeasure->ReadBarring(reader);
+    vrvMeasure->ReadMeasureLog(reader);
+    vrvMeasure->ReadMeterConformanceBar(reader);
+    vrvMeasure->ReadNNumberLike(reader);
+    vrvMeasure->ReadPointing(reader);
+    vrvMeasure->ReadTyped(reader);
 
     if (measure.attribute("ulx") && measure.attribute("lrx") && (this->m_doc->GetType() == Transcription)) {
         vrvMeasure->m_xAbs = atoi(measure.attribute("ulx").value()) * DEFINITION_FACTOR;
@@ -3793,12 +4018,12 @@ bool MeiInput::ReadMeasureChildren(Object *parent, pugi::xml_node parentNode)
     return success;
 }
 
-bool MeiInput::ReadControlElement(pugi::xml_node element, ControlElement *object)
+bool MeiInput::ReadControlElement(pugi::xml_node element, ControlElement *object, AttReader &reader)
 {
     SetMeiUuid(element, object);
-    ReadLinkingInterface(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    ReadLinkingInterface(element, object, reader);
+    object->ReadLabelled(reader);
+    object->ReadTyped(reader);
 
     return true;
 }
@@ -3806,9 +4031,10 @@ bool MeiInput::ReadControlElement(pugi::xml_node element, ControlElement *object
 bool MeiInput::ReadAnchoredText(Object *parent, pugi::xml_node anchoredText)
 {
     AnchoredText *vrvAnchoredText = new AnchoredText();
-    ReadControlElement(anchoredText, vrvAnchoredText);
+    AttReader reader(anchoredText);
+    ReadControlElement(anchoredText, vrvAnchoredText, reader);
 
-    ReadTextDirInterface(anchoredText, vrvAnchoredText);
+    ReadTextDirInterface(anchoredText, vrvAnchoredText, reader);
 
     ReadUnsupportedAttr(anchoredText, vrvAnchoredText);
     parent->AddChild(vrvAnchoredText);
@@ -3818,13 +4044,14 @@ bool MeiInput::ReadAnchoredText(Object *parent, pugi::xml_node anchoredText)
 bool MeiInput::ReadArpeg(Object *parent, pugi::xml_node arpeg)
 {
     Arpeg *vrvArpeg = new Arpeg();
-    ReadControlElement(arpeg, vrvArpeg);
+    AttReader reader(arpeg);
+    ReadControlElement(arpeg, vrvArpeg, reader);
 
-    ReadPlistInterface(arpeg, vrvArpeg);
-    ReadTimePointInterface(arpeg, vrvArpeg);
-    vrvArpeg->ReadArpegLog(arpeg);
-    vrvArpeg->ReadArpegVis(arpeg);
-    vrvArpeg->ReadColor(arpeg);
+    ReadPlistInterface(arpeg, vrvArpeg, reader);
+    ReadTimePointInterface(arpeg, vrvArpeg, reader);
+    vrvArpeg->ReadArpegLog(reader);
+    vrvArpeg->ReadArpegVis(reader);
+    vrvArpeg->ReadColor(reader);
 
     parent->AddChild(vrvArpeg);
     ReadUnsupportedAttr(arpeg, vrvArpeg);
@@ -3834,13 +4061,14 @@ bool MeiInput::ReadArpeg(Object *parent, pugi::xml_node arpeg)
 bool MeiInput::ReadBracketSpan(Object *parent, pugi::xml_node bracketSpan)
 {
     BracketSpan *vrvBracketSpan = new BracketSpan();
-    ReadControlElement(bracketSpan, vrvBracketSpan);
+    AttReader reader(bracketSpan);
+    ReadControlElement(bracketSpan, vrvBracketSpan, reader);
 
-    ReadTimeSpanningInterface(bracketSpan, vrvBracketSpan);
-    vrvBracketSpan->ReadBracketSpanLog(bracketSpan);
-    vrvBracketSpan->ReadColor(bracketSpan);
-    vrvBracketSpan->ReadLineRend(bracketSpan);
-    vrvBracketSpan->ReadLineRendBase(bracketSpan);
+    ReadTimeSpanningInterface(bracketSpan, vrvBracketSpan, reader);
+    vrvBracketSpan->ReadBracketSpanLog(reader);
+    vrvBracketSpan->ReadColor(reader);
+    vrvBracketSpan->ReadLineRend(reader);
+    vrvBracketSpan->ReadLineRendBase(reader);
 
     parent->AddChild(vrvBracketSpan);
     ReadUnsupportedAttr(bracketSpan, vrvBracketSpan);
@@ -3850,11 +4078,12 @@ bool MeiInput::ReadBracketSpan(Object *parent, pugi::xml_node bracketSpan)
 bool MeiInput::ReadBreath(Object *parent, pugi::xml_node breath)
 {
     Breath *vrvBreath = new Breath();
-    ReadControlElement(breath, vrvBreath);
+    AttReader reader(breath);
+    ReadControlElement(breath, vrvBreath, reader);
 
-    ReadTimePointInterface(breath, vrvBreath);
-    vrvBreath->ReadColor(breath);
-    vrvBreath->ReadPlacement(breath);
+    ReadTimePointInterface(breath, vrvBreath, reader);
+    vrvBreath->ReadColor(reader);
+    vrvBreath->ReadPlacement(reader);
 
     parent->AddChild(vrvBreath);
     ReadUnsupportedAttr(breath, vrvBreath);
@@ -3864,13 +4093,14 @@ bool MeiInput::ReadBreath(Object *parent, pugi::xml_node breath)
 bool MeiInput::ReadDir(Object *parent, pugi::xml_node dir)
 {
     Dir *vrvDir = new Dir();
-    ReadControlElement(dir, vrvDir);
+    AttReader reader(dir);
+    ReadControlElement(dir, vrvDir, reader);
 
-    ReadTextDirInterface(dir, vrvDir);
-    ReadTimeSpanningInterface(dir, vrvDir);
-    vrvDir->ReadLang(dir);
-    vrvDir->ReadExtender(dir);
-    vrvDir->ReadVerticalGroup(dir);
+    ReadTextDirInterface(dir, vrvDir, reader);
+    ReadTimeSpanningInterface(dir, vrvDir, reader);
+    vrvDir->ReadLang(reader);
+    vrvDir->ReadExtender(reader);
+    vrvDir->ReadVerticalGroup(reader);
 
     parent->AddChild(vrvDir);
     ReadUnsupportedAttr(dir, vrvDir);
@@ -3880,12 +4110,13 @@ bool MeiInput::ReadDir(Object *parent, pugi::xml_node dir)
 bool MeiInput::ReadDynam(Object *parent, pugi::xml_node dynam)
 {
     Dynam *vrvDynam = new Dynam();
-    ReadControlElement(dynam, vrvDynam);
+    AttReader reader(dynam);
+    ReadControlElement(dynam, vrvDynam, reader);
 
-    ReadTextDirInterface(dynam, vrvDynam);
-    ReadTimeSpanningInterface(dynam, vrvDynam);
-    vrvDynam->ReadExtender(dynam);
-    vrvDynam->ReadVerticalGroup(dynam);
+    ReadTextDirInterface(dynam, vrvDynam, reader);
+    ReadTimeSpanningInterface(dynam, vrvDynam, reader);
+    vrvDynam->ReadExtender(reader);
+    vrvDynam->ReadVerticalGroup(reader);
 
     parent->AddChild(vrvDynam);
     ReadUnsupportedAttr(dynam, vrvDynam);
@@ -3895,12 +4126,13 @@ bool MeiInput::ReadDynam(Object *parent, pugi::xml_node dynam)
 bool MeiInput::ReadFermata(Object *parent, pugi::xml_node fermata)
 {
     Fermata *vrvFermata = new Fermata();
-    ReadControlElement(fermata, vrvFermata);
+    AttReader reader(fermata);
+    ReadControlElement(fermata, vrvFermata, reader);
 
-    ReadTimePointInterface(fermata, vrvFermata);
-    vrvFermata->ReadColor(fermata);
-    vrvFermata->ReadFermataVis(fermata);
-    vrvFermata->ReadPlacement(fermata);
+    ReadTimePointInterface(fermata, vrvFermata, reader);
+    vrvFermata->ReadColor(reader);
+    vrvFermata->ReadFermataVis(reader);
+    vrvFermata->ReadPlacement(reader);
 
     parent->AddChild(vrvFermata);
     ReadUnsupportedAttr(fermata, vrvFermata);
@@ -3910,13 +4142,14 @@ bool MeiInput::ReadFermata(Object *parent, pugi::xml_node fermata)
 bool MeiInput::ReadHairpin(Object *parent, pugi::xml_node hairpin)
 {
     Hairpin *vrvHairpin = new Hairpin();
-    ReadControlElement(hairpin, vrvHairpin);
+    AttReader reader(hairpin);
+    ReadControlElement(hairpin, vrvHairpin, reader);
 
-    ReadTimeSpanningInterface(hairpin, vrvHairpin);
-    vrvHairpin->ReadColor(hairpin);
-    vrvHairpin->ReadHairpinLog(hairpin);
-    vrvHairpin->ReadPlacement(hairpin);
-    vrvHairpin->ReadVerticalGroup(hairpin);
+    ReadTimeSpanningInterface(hairpin, vrvHairpin, reader);
+    vrvHairpin->ReadColor(reader);
+    vrvHairpin->ReadHairpinLog(reader);
+    vrvHairpin->ReadPlacement(reader);
+    vrvHairpin->ReadVerticalGroup(reader);
 
     parent->AddChild(vrvHairpin);
     ReadUnsupportedAttr(hairpin, vrvHairpin);
@@ -3926,12 +4159,13 @@ bool MeiInput::ReadHairpin(Object *parent, pugi::xml_node hairpin)
 bool MeiInput::ReadHarm(Object *parent, pugi::xml_node harm)
 {
     Harm *vrvHarm = new Harm();
-    ReadControlElement(harm, vrvHarm);
+    AttReader reader(harm);
+    ReadControlElement(harm, vrvHarm, reader);
 
-    ReadTextDirInterface(harm, vrvHarm);
-    ReadTimeSpanningInterface(harm, vrvHarm);
-    vrvHarm->ReadLang(harm);
-    vrvHarm->ReadNNumberLike(harm);
+    ReadTextDirInterface(harm, vrvHarm, reader);
+    ReadTimeSpanningInterface(harm, vrvHarm, reader);
+    vrvHarm->ReadLang(reader);
+    vrvHarm->ReadNNumberLike(reader);
 
     parent->AddChild(vrvHarm);
     ReadUnsupportedAttr(harm, vrvHarm);
@@ -3941,13 +4175,14 @@ bool MeiInput::ReadHarm(Object *parent, pugi::xml_node harm)
 bool MeiInput::ReadMNum(Object *parent, pugi::xml_node mNum)
 {
     MNum *vrvMNum = new MNum();
-    ReadControlElement(mNum, vrvMNum);
+    AttReader reader(mNum);
+    ReadControlElement(mNum, vrvMNum, reader);
 
-    ReadTextDirInterface(mNum, vrvMNum);
-    ReadTimePointInterface(mNum, vrvMNum);
-    vrvMNum->ReadColor(mNum);
-    vrvMNum->ReadLang(mNum);
-    vrvMNum->ReadTypography(mNum);
+    ReadTextDirInterface(mNum, vrvMNum, reader);
+    ReadTimePointInterface(mNum, vrvMNum, reader);
+    vrvMNum->ReadColor(reader);
+    vrvMNum->ReadLang(reader);
+    vrvMNum->ReadTypography(reader);
 
     parent->AddChild(vrvMNum);
     return ReadTextChildren(vrvMNum, mNum, vrvMNum);
@@ -3956,17 +4191,20 @@ bool MeiInput::ReadMNum(Object *parent, pugi::xml_node mNum)
 bool MeiInput::ReadMordent(Object *parent, pugi::xml_node mordent)
 {
     Mordent *vrvMordent = new Mordent();
-    ReadControlElement(mordent, vrvMordent);
+    AttReader reader(mordent);
+    ReadControlElement(mordent, vrvMordent, reader);
 
     if (m_version < MEI_4_0_0) {
         UpgradeMordentTo_4_0_0(mordent, vrvMordent);
+        // The upgrade removes attributes from the element, so the reader is built again
+        reader = AttReader(mordent);
     }
 
-    ReadTimePointInterface(mordent, vrvMordent);
-    vrvMordent->ReadColor(mordent);
-    vrvMordent->ReadOrnamentAccid(mordent);
-    vrvMordent->ReadPlacement(mordent);
-    vrvMordent->ReadMordentLog(mordent);
+    ReadTimePointInterface(mordent, vrvMordent, reader);
+    vrvMordent->ReadColor(reader);
+    vrvMordent->ReadOrnamentAccid(reader);
+    vrvMordent->ReadPlacement(reader);
+    vrvMordent->ReadMordentLog(reader);
 
     parent->AddChild(vrvMordent);
     ReadUnsupportedAttr(mordent, vrvMordent);
@@ -3976,14 +4214,15 @@ bool MeiInput::ReadMordent(Object *parent, pugi::xml_node mordent)
 bool MeiInput::ReadOctave(Object *parent, pugi::xml_node octave)
 {
     Octave *vrvOctave = new Octave();
-    ReadControlElement(octave, vrvOctave);
+    AttReader reader(octave);
+    ReadControlElement(octave, vrvOctave, reader);
 
-    ReadTimeSpanningInterface(octave, vrvOctave);
-    vrvOctave->ReadColor(octave);
-    vrvOctave->ReadExtender(octave);
-    vrvOctave->ReadLineRend(octave);
-    vrvOctave->ReadLineRendBase(octave);
-    vrvOctave->ReadOctaveDisplacement(octave);
+    ReadTimeSpanningInterface(octave, vrvOctave, reader);
+    vrvOctave->ReadColor(reader);
+    vrvOctave->ReadExtender(reader);
+    vrvOctave->ReadLineRend(reader);
+    vrvOctave->ReadLineRendBase(reader);
+    vrvOctave->ReadOctaveDisplacement(reader);
 
     parent->AddChild(vrvOctave);
     ReadUnsupportedAttr(octave, vrvOctave);
@@ -3993,13 +4232,14 @@ bool MeiInput::ReadOctave(Object *parent, pugi::xml_node octave)
 bool MeiInput::ReadPedal(Object *parent, pugi::xml_node pedal)
 {
     Pedal *vrvPedal = new Pedal();
-    ReadControlElement(pedal, vrvPedal);
+    AttReader reader(pedal);
+    ReadControlElement(pedal, vrvPedal, reader);
 
-    ReadTimePointInterface(pedal, vrvPedal);
-    vrvPedal->ReadColor(pedal);
-    vrvPedal->ReadPedalLog(pedal);
-    vrvPedal->ReadPlacement(pedal);
-    vrvPedal->ReadVerticalGroup(pedal);
+    ReadTimePointInterface(pedal, vrvPedal, reader);
+    vrvPedal->ReadColor(reader);
+    vrvPedal->ReadPedalLog(reader);
+    vrvPedal->ReadPlacement(reader);
+    vrvPedal->ReadVerticalGroup(reader);
 
     parent->AddChild(vrvPedal);
     ReadUnsupportedAttr(pedal, vrvPedal);
@@ -4009,12 +4249,13 @@ bool MeiInput::ReadPedal(Object *parent, pugi::xml_node pedal)
 bool MeiInput::ReadSlur(Object *parent, pugi::xml_node slur)
 {
     Slur *vrvSlur = new Slur();
-    ReadControlElement(slur, vrvSlur);
+    AttReader reader(slur);
+    ReadControlElement(slur, vrvSlur, reader);
 
-    ReadTimeSpanningInterface(slur, vrvSlur);
-    vrvSlur->ReadColor(slur);
-    vrvSlur->ReadCurvature(slur);
-    vrvSlur->ReadCurveRend(slur);
+    ReadTimeSpanningInterface(slur, vrvSlur, reader);
+    vrvSlur->ReadColor(reader);
+    vrvSlur->ReadCurvature(reader);
+    vrvSlur->ReadCurveRend(reader);
 
     parent->AddChild(vrvSlur);
     ReadUnsupportedAttr(slur, vrvSlur);
@@ -4024,13 +4265,14 @@ bool MeiInput::ReadSlur(Object *parent, pugi::xml_node slur)
 bool MeiInput::ReadTempo(Object *parent, pugi::xml_node tempo)
 {
     Tempo *vrvTempo = new Tempo();
-    ReadControlElement(tempo, vrvTempo);
+    AttReader reader(tempo);
+    ReadControlElement(tempo, vrvTempo, reader);
 
-    ReadTextDirInterface(tempo, vrvTempo);
-    ReadTimePointInterface(tempo, vrvTempo);
-    vrvTempo->ReadLang(tempo);
-    vrvTempo->ReadMidiTempo(tempo);
-    vrvTempo->ReadMmTempo(tempo);
+    ReadTextDirInterface(tempo, vrvTempo, reader);
+    ReadTimePointInterface(tempo, vrvTempo, reader);
+    vrvTempo->ReadLang(reader);
+    vrvTempo->ReadMidiTempo(reader);
+    vrvTempo->ReadMmTempo(reader);
 
     parent->AddChild(vrvTempo);
     ReadUnsupportedAttr(tempo, vrvTempo);
@@ -4040,12 +4282,13 @@ bool MeiInput::ReadTempo(Object *parent, pugi::xml_node tempo)
 bool MeiInput::ReadTie(Object *parent, pugi::xml_node tie)
 {
     Tie *vrvTie = new Tie();
-    ReadControlElement(tie, vrvTie);
+    AttReader reader(tie);
+    ReadControlElement(tie, vrvTie, reader);
 
-    ReadTimeSpanningInterface(tie, vrvTie);
-    vrvTie->ReadColor(tie);
-    vrvTie->ReadCurvature(tie);
-    vrvTie->ReadCurveRend(tie);
+    ReadTimeSpanningInterface(tie, vrvTie, reader);
+    vrvTie->ReadColor(reader);
+    vrvTie->ReadCurvature(reader);
+    vrvTie->ReadCurveRend(reader);
 
     parent->AddChild(vrvTie);
     ReadUnsupportedAttr(tie, vrvTie);
@@ -4055,12 +4298,13 @@ bool MeiInput::ReadTie(Object *parent, pugi::xml_node tie)
 bool MeiInput::ReadTrill(Object *parent, pugi::xml_node trill)
 {
     Trill *vrvTrill = new Trill();
-    ReadControlElement(trill, vrvTrill);
+    AttReader reader(trill);
+    ReadControlElement(trill, vrvTrill, reader);
 
-    ReadTimeSpanningInterface(trill, vrvTrill);
-    vrvTrill->ReadColor(trill);
-    vrvTrill->ReadOrnamentAccid(trill);
-    vrvTrill->ReadPlacement(trill);
+    ReadTimeSpanningInterface(trill, vrvTrill, reader);
+    vrvTrill->ReadColor(reader);
+    vrvTrill->ReadOrnamentAccid(reader);
+    vrvTrill->ReadPlacement(reader);
 
     parent->AddChild(vrvTrill);
     ReadUnsupportedAttr(trill, vrvTrill);
@@ -4070,17 +4314,20 @@ bool MeiInput::ReadTrill(Object *parent, pugi::xml_node trill)
 bool MeiInput::ReadTurn(Object *parent, pugi::xml_node turn)
 {
     Turn *vrvTurn = new Turn();
-    ReadControlElement(turn, vrvTurn);
+    AttReader reader(turn);
+    ReadControlElement(turn, vrvTurn, reader);
 
     if (m_version < MEI_4_0_0) {
         UpgradeTurnTo_4_0_0(turn, vrvTurn);
+        // The upgrade removes attributes from the element, so the reader is built again
+        reader = AttReader(turn);
     }
 
-    ReadTimePointInterface(turn, vrvTurn);
-    vrvTurn->ReadColor(turn);
-    vrvTurn->ReadOrnamentAccid(turn);
-    vrvTurn->ReadPlacement(turn);
-    vrvTurn->ReadTurnLog(turn);
+    ReadTimePointInterface(turn, vrvTurn, reader);
+    vrvTurn->ReadColor(reader);
+    vrvTurn->ReadOrnamentAccid(reader);
+    vrvTurn->ReadPlacement(reader);
+    vrvTurn->ReadTurnLog(reader);
 
     parent->AddChild(vrvTurn);
     ReadUnsupportedAttr(turn, vrvTurn);
@@ -4125,10 +4372,11 @@ bool MeiInput::ReadStaff(Object *parent, pugi::xml_node staff)
     Staff *vrvStaff = new Staff();
     SetMeiUuid(staff, vrvStaff);
 
-    vrvStaff->ReadFacsimile(staff);
-    vrvStaff->ReadNInteger(staff);
-    vrvStaff->ReadTyped(staff);
-    vrvStaff->ReadVisibility(staff);
+    AttReader reader(staff);
+    vrvStaff->ReadFacsimile(reader);
+    vrvStaff->ReadNInteger(reader);
+    vrvStaff->ReadTyped(reader);
+    vrvStaff->ReadVisibility(reader);
 
     if (staff.attribute("uly") && (this->m_doc->GetType() == Transcription)) {
         vrvStaff->m_yAbs = atoi(staff.attribute("uly").value()) * DEFINITION_FACTOR;
@@ -4172,9 +4420,10 @@ bool MeiInput::ReadLayer(Object *parent, pugi::xml_node layer)
     Layer *vrvLayer = new Layer();
     SetMeiUuid(layer, vrvLayer);
 
-    vrvLayer->ReadNInteger(layer);
-    vrvLayer->ReadTyped(layer);
-    vrvLayer->ReadVisibility(layer);
+    AttReader reader(layer);
+    vrvLayer->ReadNInteger(reader);
+    vrvLayer->ReadTyped(reader);
+    vrvLayer->ReadVisibility(reader);
 
     if (!vrvLayer->HasN()) {
         LogWarning("No @n on <layer>, 1 is set");
@@ -4328,7 +4577,7 @@ bool MeiInput::ReadLayerChildren(Object *parent, pugi::xml_node parentNode, Obje
     return success;
 }
 
-bool MeiInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
+bool MeiInput::ReadLayerElement(pugi::xml_node element, LayerElement *object, AttReader &reader)
 {
     if (element.attribute("ulx") && (this->m_doc->GetType() == Transcription)) {
         object->m_xAbs = atoi(element.attribute("ulx").value()) * DEFINITION_FACTOR;
@@ -4354,9 +4603,9 @@ bool MeiInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
     }*/
 
     SetMeiUuid(element, object);
-    ReadLinkingInterface(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    ReadLinkingInterface(element, object, reader);
+    object->ReadLabelled(reader);
+    object->ReadTyped(reader);
 
     return true;
 }
@@ -4364,14 +4613,15 @@ bool MeiInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
 bool MeiInput::ReadAccid(Object *parent, pugi::xml_node accid)
 {
     Accid *vrvAccid = new Accid();
-    ReadLayerElement(accid, vrvAccid);
+    AttReader reader(accid);
+    ReadLayerElement(accid, vrvAccid, reader);
 
-    ReadPositionInterface(accid, vrvAccid);
-    vrvAccid->ReadAccidental(accid);
-    vrvAccid->ReadAccidentalGestural(accid);
-    vrvAccid->ReadAccidLog(accid);
-    vrvAccid->ReadColor(accid);
-    vrvAccid->ReadEnclosingChars(accid);
+    ReadPositionInterface(accid, vrvAccid, reader);
+    vrvAccid->ReadAccidental(reader);
+    vrvAccid->ReadAccidentalGestural(reader);
+    vrvAccid->ReadAccidLog(reader);
+    vrvAccid->ReadColor(reader);
+    vrvAccid->ReadEnclosingChars(reader);
 
     parent->AddChild(vrvAccid);
     ReadUnsupportedAttr(accid, vrvAccid);
@@ -4381,11 +4631,12 @@ bool MeiInput::ReadAccid(Object *parent, pugi::xml_node accid)
 bool MeiInput::ReadArtic(Object *parent, pugi::xml_node artic)
 {
     Artic *vrvArtic = new Artic();
-    ReadLayerElement(artic, vrvArtic);
+    AttReader reader(artic);
+    ReadLayerElement(artic, vrvArtic, reader);
 
-    vrvArtic->ReadArticulation(artic);
-    vrvArtic->ReadColor(artic);
-    vrvArtic->ReadPlacement(artic);
+    vrvArtic->ReadArticulation(reader);
+    vrvArtic->ReadColor(reader);
+    vrvArtic->ReadPlacement(reader);
 
     parent->AddChild(vrvArtic);
     ReadUnsupportedAttr(artic, vrvArtic);
@@ -4395,11 +4646,12 @@ bool MeiInput::ReadArtic(Object *parent, pugi::xml_node artic)
 bool MeiInput::ReadBarLine(Object *parent, pugi::xml_node barLine)
 {
     BarLine *vrvBarLine = new BarLine();
-    ReadLayerElement(barLine, vrvBarLine);
+    AttReader reader(barLine);
+    ReadLayerElement(barLine, vrvBarLine, reader);
 
-    vrvBarLine->ReadBarLineLog(barLine);
-    vrvBarLine->ReadColor(barLine);
-    vrvBarLine->ReadVisibility(barLine);
+    vrvBarLine->ReadBarLineLog(reader);
+    vrvBarLine->ReadColor(reader);
+    vrvBarLine->ReadVisibility(reader);
 
     parent->AddChild(vrvBarLine);
     ReadUnsupportedAttr(barLine, vrvBarLine);
@@ -4409,11 +4661,12 @@ bool MeiInput::ReadBarLine(Object *parent, pugi::xml_node barLine)
 bool MeiInput::ReadBeam(Object *parent, pugi::xml_node beam)
 {
     Beam *vrvBeam = new Beam();
-    ReadLayerElement(beam, vrvBeam);
+    AttReader reader(beam);
+    ReadLayerElement(beam, vrvBeam, reader);
 
-    vrvBeam->ReadColor(beam);
-    vrvBeam->ReadBeamedWith(beam);
-    vrvBeam->ReadBeamRend(beam);
+    vrvBeam->ReadColor(reader);
+    vrvBeam->ReadBeamedWith(reader);
+    vrvBeam->ReadBeamRend(reader);
 
     parent->AddChild(vrvBeam);
     ReadUnsupportedAttr(beam, vrvBeam);
@@ -4423,10 +4676,11 @@ bool MeiInput::ReadBeam(Object *parent, pugi::xml_node beam)
 bool MeiInput::ReadBeatRpt(Object *parent, pugi::xml_node beatRpt)
 {
     BeatRpt *vrvBeatRpt = new BeatRpt();
-    ReadLayerElement(beatRpt, vrvBeatRpt);
+    AttReader reader(beatRpt);
+    ReadLayerElement(beatRpt, vrvBeatRpt, reader);
 
-    vrvBeatRpt->ReadColor(beatRpt);
-    vrvBeatRpt->ReadBeatRptVis(beatRpt);
+    vrvBeatRpt->ReadColor(reader);
+    vrvBeatRpt->ReadBeatRptVis(reader);
 
     parent->AddChild(vrvBeatRpt);
     ReadUnsupportedAttr(beatRpt, vrvBeatRpt);
@@ -4436,9 +4690,10 @@ bool MeiInput::ReadBeatRpt(Object *parent, pugi::xml_node beatRpt)
 bool MeiInput::ReadBTrem(Object *parent, pugi::xml_node bTrem)
 {
     BTrem *vrvBTrem = new BTrem();
-    ReadLayerElement(bTrem, vrvBTrem);
+    AttReader reader(bTrem);
+    ReadLayerElement(bTrem, vrvBTrem, reader);
 
-    vrvBTrem->ReadTremMeasured(bTrem);
+    vrvBTrem->ReadTremMeasured(reader);
 
     parent->AddChild(vrvBTrem);
     ReadUnsupportedAttr(bTrem, vrvBTrem);
@@ -4448,19 +4703,20 @@ bool MeiInput::ReadBTrem(Object *parent, pugi::xml_node bTrem)
 bool MeiInput::ReadChord(Object *parent, pugi::xml_node chord)
 {
     Chord *vrvChord = new Chord();
-    ReadLayerElement(chord, vrvChord);
-
-    ReadDurationInterface(chord, vrvChord);
-    vrvChord->ReadColor(chord);
-    vrvChord->ReadCue(chord);
-    vrvChord->ReadGraced(chord);
-    vrvChord->ReadStems(chord);
-    vrvChord->ReadStemsCmn(chord);
-    vrvChord->ReadTiePresent(chord);
-    vrvChord->ReadVisibility(chord);
+    AttReader reader(chord);
+    ReadLayerElement(chord, vrvChord, reader);
+
+    ReadDurationInterface(chord, vrvChord, reader);
+    vrvChord->ReadColor(reader);
+    vrvChord->ReadCue(reader);
+    vrvChord->ReadGraced(reader);
+    vrvChord->ReadStems(reader);
+    vrvChord->ReadStemsCmn(reader);
+    vrvChord->ReadTiePresent(reader);
+    vrvChord->ReadVisibility(reader);
 
     AttArticulation artic;
-    artic.ReadArticulation(chord);
+    artic.ReadArticulation(reader);
     if (artic.HasArtic()) {
         Artic *vrvArtic = new Artic();
         vrvArtic->IsAttribute(true);
@@ -4480,13 +4736,14 @@ bool MeiInput::ReadChord(Object *parent, pugi::xml_node chord)
 bool MeiInput::ReadClef(Object *parent, pugi::xml_node clef)
 {
     Clef *vrvClef = new Clef();
-    ReadLayerElement(clef, vrvClef);
-    ReadFacsimileInterface(clef, vrvClef);
+    AttReader reader(clef);
+    ReadLayerElement(clef, vrvClef, reader);
+    ReadFacsimileInterface(clef, vrvClef, reader);
 
-    vrvClef->ReadClefShape(clef);
-    vrvClef->ReadColor(clef);
-    vrvClef->ReadLineLoc(clef);
-    vrvClef->ReadOctaveDisplacement(clef);
+    vrvClef->ReadClefShape(reader);
+    vrvClef->ReadColor(reader);
+    vrvClef->ReadLineLoc(reader);
+    vrvClef->ReadOctaveDisplacement(reader);
 
     parent->AddChild(vrvClef);
     ReadUnsupportedAttr(clef, vrvClef);
@@ -4496,12 +4753,13 @@ bool MeiInput::ReadClef(Object *parent, pugi::xml_node clef)
 bool MeiInput::ReadCustos(Object *parent, pugi::xml_node custos)
 {
     Custos *vrvCustos = new Custos();
-    ReadLayerElement(custos, vrvCustos);
+    AttReader reader(custos);
+    ReadLayerElement(custos, vrvCustos, reader);
 
-    ReadFacsimileInterface(custos, vrvCustos);
-    ReadPitchInterface(custos, vrvCustos);
-    ReadPositionInterface(custos, vrvCustos);
-    vrvCustos->ReadColor(custos);
+    ReadFacsimileInterface(custos, vrvCustos, reader);
+    ReadPitchInterface(custos, vrvCustos, reader);
+    ReadPositionInterface(custos, vrvCustos, reader);
+    vrvCustos->ReadColor(reader);
 
     parent->AddChild(vrvCustos);
     ReadUnsupportedAttr(custos, vrvCustos);
@@ -4511,11 +4769,12 @@ bool MeiInput::ReadCustos(Object *parent, pugi::xml_node custos)
 bool MeiInput::ReadDot(Object *parent, pugi::xml_node dot)
 {
     Dot *vrvDot = new Dot();
-    ReadLayerElement(dot, vrvDot);
+    AttReader reader(dot);
+    ReadLayerElement(dot, vrvDot, reader);
 
-    ReadPositionInterface(dot, vrvDot);
-    vrvDot->ReadColor(dot);
-    vrvDot->ReadDotLog(dot);
+    ReadPositionInterface(dot, vrvDot, reader);
+    vrvDot->ReadColor(reader);
+    vrvDot->ReadDotLog(reader);
 
     parent->AddChild(vrvDot);
     ReadUnsupportedAttr(dot, vrvDot);
@@ -4525,14 +4784,17 @@ bool MeiInput::ReadDot(Object *parent, pugi::xml_node dot)
 bool MeiInput::ReadFTrem(Object *parent, pugi::xml_node fTrem)
 {
     FTrem *vrvFTrem = new FTrem();
-    ReadLayerElement(fTrem, vrvFTrem);
+    AttReader reader(fTrem);
+    ReadLayerElement(fTrem, vrvFTrem, reader);
 
     if (m_version < MEI_4_0_0) {
         UpgradeFTremTo_4_0_0(fTrem, vrvFTrem);
+        // The upgrade removes attributes from the element, so the reader is built again
+        reader = AttReader(fTrem);
     }
 
-    vrvFTrem->ReadFTremVis(fTrem);
-    vrvFTrem->ReadTremMeasured(fTrem);
+    vrvFTrem->ReadFTremVis(reader);
+    vrvFTrem->ReadTremMeasured(reader);
 
     parent->AddChild(vrvFTrem);
     ReadUnsupportedAttr(fTrem, vrvFTrem);
@@ -4542,11 +4804,12 @@ bool MeiInput::ReadFTrem(Object *parent, pugi::xml_node fTrem)
 bool MeiInput::ReadGraceGrp(Object *parent, pugi::xml_node graceGrp)
 {
     GraceGrp *vrvGraceGrp = new GraceGrp();
-    ReadLayerElement(graceGrp, vrvGraceGrp);
+    AttReader reader(graceGrp);
+    ReadLayerElement(graceGrp, vrvGraceGrp, reader);
 
-    vrvGraceGrp->ReadColor(graceGrp);
-    vrvGraceGrp->ReadGraced(graceGrp);
-    vrvGraceGrp->ReadGraceGrpLog(graceGrp);
+    vrvGraceGrp->ReadColor(reader);
+    vrvGraceGrp->ReadGraced(reader);
+    vrvGraceGrp->ReadGraceGrpLog(reader);
 
     parent->AddChild(vrvGraceGrp);
     ReadUnsupportedAttr(graceGrp, vrvGraceGrp);
@@ -4556,7 +4819,8 @@ bool MeiInput::ReadGraceGrp(Object *parent, pugi::xml_node graceGrp)
 bool MeiInput::ReadHalfmRpt(Object *parent, pugi::xml_node halfmRpt)
 {
     HalfmRpt *vrvHalfmRpt = new HalfmRpt();
-    ReadLayerElement(halfmRpt, vrvHalfmRpt);
+    AttReader reader(halfmRpt);
+    ReadLayerElement(halfmRpt, vrvHalfmRpt, reader);
 
     parent->AddChild(vrvHalfmRpt);
     ReadUnsupportedAttr(halfmRpt, vrvHalfmRpt);
@@ -4566,12 +4830,13 @@ bool MeiInput::ReadHalfmRpt(Object *parent, pugi::xml_node halfmRpt)
 bool MeiInput::ReadKeyAccid(Object *parent, pugi::xml_node keyAccid)
 {
     KeyAccid *vrvKeyAccid = new KeyAccid();
-    ReadLayerElement(keyAccid, vrvKeyAccid);
+    AttReader reader(keyAccid);
+    ReadLayerElement(keyAccid, vrvKeyAccid, reader);
 
-    ReadPitchInterface(keyAccid, vrvKeyAccid);
-    vrvKeyAccid->ReadAccidental(keyAccid);
-    vrvKeyAccid->ReadColor(keyAccid);
-    vrvKeyAccid->ReadEnclosingChars(keyAccid);
+    ReadPitchInterface(keyAccid, vrvKeyAccid, reader);
+    vrvKeyAccid->ReadAccidental(reader);
+    vrvKeyAccid->ReadColor(reader);
+    vrvKeyAccid->ReadEnclosingChars(reader);
 
     parent->AddChild(vrvKeyAccid);
     ReadUnsupportedAttr(keyAccid, vrvKeyAccid);
@@ -4581,14 +4846,15 @@ bool MeiInput::ReadKeyAccid(Object *parent, pugi::xml_node keyAccid)
 bool MeiInput::ReadKeySig(Object *parent, pugi::xml_node keySig)
 {
     KeySig *vrvKeySig = new KeySig();
-    ReadLayerElement(keySig, vrvKeySig);
+    AttReader reader(keySig);
+    ReadLayerElement(keySig, vrvKeySig, reader);
 
-    vrvKeySig->ReadAccidental(keySig);
-    vrvKeySig->ReadPitch(keySig);
-    vrvKeySig->ReadKeySigAnl(keySig);
-    vrvKeySig->ReadKeySigLog(keySig);
-    vrvKeySig->ReadKeySigVis(keySig);
-    vrvKeySig->ReadVisibility(keySig);
+    vrvKeySig->ReadAccidental(reader);
+    vrvKeySig->ReadPitch(reader);
+    vrvKeySig->ReadKeySigAnl(reader);
+    vrvKeySig->ReadKeySigLog(reader);
+    vrvKeySig->ReadKeySigVis(reader);
+    vrvKeySig->ReadVisibility(reader);
 
     parent->AddChild(vrvKeySig);
     ReadUnsupportedAttr(keySig, vrvKeySig);
@@ -4600,7 +4866,8 @@ bool MeiInput::ReadLigature(Object *parent, pugi::xml_node ligature)
     Ligature *vrvLigature = new Ligature();
     SetMeiUuid(ligature, vrvLigature);
 
-    vrvLigature->ReadLigatureLog(ligature);
+    AttReader reader(ligature);
+    vrvLigature->ReadLigatureLog(reader);
 
     parent->AddChild(vrvLigature);
     ReadUnsupportedAttr(ligature, vrvLigature);
@@ -4610,16 +4877,17 @@ bool MeiInput::ReadLigature(Object *parent, pugi::xml_node ligature)
 bool MeiInput::ReadMensur(Object *parent, pugi::xml_node mensur)
 {
     Mensur *vrvMensur = new Mensur();
-    ReadLayerElement(mensur, vrvMensur);
-
-    vrvMensur->ReadColor(mensur);
-    vrvMensur->ReadCue(mensur);
-    vrvMensur->ReadDurationRatio(mensur);
-    vrvMensur->ReadMensuralShared(mensur);
-    vrvMensur->ReadMensurLog(mensur);
-    vrvMensur->ReadMensurVis(mensur);
-    vrvMensur->ReadSlashCount(mensur);
-    vrvMensur->ReadStaffLoc(mensur);
+    AttReader reader(mensur);
+    ReadLayerElement(mensur, vrvMensur, reader);
+
+    vrvMensur->ReadColor(reader);
+    vrvMensur->ReadCue(reader);
+    vrvMensur->ReadDurationRatio(reader);
+    vrvMensur->ReadMensuralShared(reader);
+    vrvMensur->ReadMensurLog(reader);
+    vrvMensur->ReadMensurVis(reader);
+    vrvMensur->ReadSlashCount(reader);
+    vrvMensur->ReadStaffLoc(reader);
 
     parent->AddChild(vrvMensur);
     ReadUnsupportedAttr(mensur, vrvMensur);
@@ -4629,10 +4897,11 @@ bool MeiInput::ReadMensur(Object *parent, pugi::xml_node mensur)
 bool MeiInput::ReadMeterSig(Object *parent, pugi::xml_node meterSig)
 {
     MeterSig *vrvMeterSig = new MeterSig();
-    ReadLayerElement(meterSig, vrvMeterSig);
+    AttReader reader(meterSig);
+    ReadLayerElement(meterSig, vrvMeterSig, reader);
 
-    vrvMeterSig->ReadMeterSigLog(meterSig);
-    vrvMeterSig->ReadMeterSigVis(meterSig);
+    vrvMeterSig->ReadMeterSigLog(reader);
+    vrvMeterSig->ReadMeterSigVis(reader);
 
     parent->AddChild(vrvMeterSig);
     ReadUnsupportedAttr(meterSig, vrvMeterSig);
@@ -4642,12 +4911,13 @@ bool MeiInput::ReadMeterSig(Object *parent, pugi::xml_node meterSig)
 bool MeiInput::ReadMRest(Object *parent, pugi::xml_node mRest)
 {
     MRest *vrvMRest = new MRest();
-    ReadLayerElement(mRest, vrvMRest);
-    ReadPositionInterface(mRest, vrvMRest);
+    AttReader reader(mRest);
+    ReadLayerElement(mRest, vrvMRest, reader);
+    ReadPositionInterface(mRest, vrvMRest, reader);
 
-    vrvMRest->ReadCue(mRest);
-    vrvMRest->ReadFermataPresent(mRest);
-    vrvMRest->ReadVisibility(mRest);
+    vrvMRest->ReadCue(reader);
+    vrvMRest->ReadFermataPresent(reader);
+    vrvMRest->ReadVisibility(reader);
 
     if (vrvMRest->HasFermata()) {
         m_doc->SetAnalyticalMarkup(true);
@@ -4661,7 +4931,8 @@ bool MeiInput::ReadMRest(Object *parent, pugi::xml_node mRest)
 bool MeiInput::ReadMRpt(Object *parent, pugi::xml_node mRpt)
 {
     MRpt *vrvMRpt = new MRpt();
-    ReadLayerElement(mRpt, vrvMRpt);
+    AttReader reader(mRpt);
+    ReadLayerElement(mRpt, vrvMRpt, reader);
 
     parent->AddChild(vrvMRpt);
     ReadUnsupportedAttr(mRpt, vrvMRpt);
@@ -4671,7 +4942,8 @@ bool MeiInput::ReadMRpt(Object *parent, pugi::xml_node mRpt)
 bool MeiInput::ReadMRpt2(Object *parent, pugi::xml_node mRpt2)
 {
     MRpt2 *vrvMRpt2 = new MRpt2();
-    ReadLayerElement(mRpt2, vrvMRpt2);
+    AttReader reader(mRpt2);
+    ReadLayerElement(mRpt2, vrvMRpt2, reader);
 
     parent->AddChild(vrvMRpt2);
     ReadUnsupportedAttr(mRpt2, vrvMRpt2);
@@ -4681,10 +4953,11 @@ bool MeiInput::ReadMRpt2(Object *parent, pugi::xml_node mRpt2)
 bool MeiInput::ReadMultiRest(Object *parent, pugi::xml_node multiRest)
 {
     MultiRest *vrvMultiRest = new MultiRest();
-    ReadLayerElement(multiRest, vrvMultiRest);
+    AttReader reader(multiRest);
+    ReadLayerElement(multiRest, vrvMultiRest, reader);
 
-    vrvMultiRest->ReadMultiRestVis(multiRest);
-    vrvMultiRest->ReadNumbered(multiRest);
+    vrvMultiRest->ReadMultiRestVis(reader);
+    vrvMultiRest->ReadNumbered(reader);
 
     parent->AddChild(vrvMultiRest);
     ReadUnsupportedAttr(multiRest, vrvMultiRest);
@@ -4694,9 +4967,10 @@ bool MeiInput::ReadMultiRest(Object *parent, pugi::xml_node multiRest)
 bool MeiInput::ReadMultiRpt(Object *parent, pugi::xml_node multiRpt)
 {
     MultiRpt *vrvMultiRpt = new MultiRpt();
-    ReadLayerElement(multiRpt, vrvMultiRpt);
+    AttReader reader(multiRpt);
+    ReadLayerElement(multiRpt, vrvMultiRpt, reader);
 
-    vrvMultiRpt->ReadNumbered(multiRpt);
+    vrvMultiRpt->ReadNumbered(reader);
 
     parent->AddChild(vrvMultiRpt);
     ReadUnsupportedAttr(multiRpt, vrvMultiRpt);
@@ -4706,15 +4980,16 @@ bool MeiInput::ReadMultiRpt(Object *parent, pugi::xml_node multiRpt)
 bool MeiInput::ReadNc(Object *parent, pugi::xml_node nc)
 {
     Nc *vrvNc = new Nc();
-    ReadLayerElement(nc, vrvNc);
+    AttReader reader(nc);
+    ReadLayerElement(nc, vrvNc, reader);
 
-    ReadDurationInterface(nc, vrvNc);
-    ReadFacsimileInterface(nc, vrvNc);
-    ReadPitchInterface(nc, vrvNc);
-    ReadPositionInterface(nc, vrvNc);
-    vrvNc->ReadColor(nc);
-    vrvNc->ReadIntervalMelodic(nc);
-    vrvNc->ReadNcForm(nc);
+    ReadDurationInterface(nc, vrvNc, reader);
+    ReadFacsimileInterface(nc, vrvNc, reader);
+    ReadPitchInterface(nc, vrvNc, reader);
+    ReadPositionInterface(nc, vrvNc, reader);
+    vrvNc->ReadColor(reader);
+    vrvNc->ReadIntervalMelodic(reader);
+    vrvNc->ReadNcForm(reader);
 
     parent->AddChild(vrvNc);
     return ReadLayerChildren(vrvNc, nc, vrvNc);
@@ -4723,10 +4998,11 @@ bool MeiInput::ReadNc(Object *parent, pugi::xml_node nc)
 bool MeiInput::ReadNeume(Object *parent, pugi::xml_node neume)
 {
     Neume *vrvNeume = new Neume();
-    ReadLayerElement(neume, vrvNeume);
-    ReadFacsimileInterface(neume, vrvNeume);
+    AttReader reader(neume);
+    ReadLayerElement(neume, vrvNeume, reader);
+    ReadFacsimileInterface(neume, vrvNeume, reader);
 
-    vrvNeume->ReadColor(neume);
+    vrvNeume->ReadColor(reader);
 
     parent->AddChild(vrvNeume);
     return ReadLayerChildren(vrvNeume, neume, vrvNeume);
@@ -4735,24 +5011,25 @@ bool MeiInput::ReadNeume(Object *parent, pugi::xml_node neume)
 bool MeiInput::ReadNote(Object *parent, pugi::xml_node note)
 {
     Note *vrvNote = new Note();
-    ReadLayerElement(note, vrvNote);
-
-    ReadDurationInterface(note, vrvNote);
-    ReadPitchInterface(note, vrvNote);
-    ReadPositionInterface(note, vrvNote);
-    vrvNote->ReadColor(note);
-    vrvNote->ReadColoration(note);
-    vrvNote->ReadCue(note);
-    vrvNote->ReadGraced(note);
-    vrvNote->ReadMidiVelocity(note);
-    vrvNote->ReadNoteAnlMensural(note);
-    vrvNote->ReadStems(note);
-    vrvNote->ReadStemsCmn(note);
-    vrvNote->ReadTiePresent(note);
-    vrvNote->ReadVisibility(note);
+    AttReader reader(note);
+    ReadLayerElement(note, vrvNote, reader);
+
+    ReadDurationInterface(note, vrvNote, reader);
+    ReadPitchInterface(note, vrvNote, reader);
+    ReadPositionInterface(note, vrvNote, reader);
+    vrvNote->ReadColor(reader);
+    vrvNote->ReadColoration(reader);
+    vrvNote->ReadCue(reader);
+    vrvNote->ReadGraced(reader);
+    vrvNote->ReadMidiVelocity(reader);
+    vrvNote->ReadNoteAnlMensural(reader);
+    vrvNote->ReadStems(reader);
+    vrvNote->ReadStemsCmn(reader);
+    vrvNote->ReadTiePresent(reader);
+    vrvNote->ReadVisibility(reader);
 
     AttArticulation artic;
-    artic.ReadArticulation(note);
+    artic.ReadArticulation(reader);
     if (artic.HasArtic()) {
         Artic *vrvArtic = new Artic();
         vrvArtic->IsAttribute(true);
@@ -4761,9 +5038,9 @@ bool MeiInput::ReadNote(Object *parent, pugi::xml_node note)
     }
 
     AttAccidental accidental;
-    accidental.ReadAccidental(note);
+    accidental.ReadAccidental(reader);
     AttAccidentalGestural accidentalGestural;
-    accidentalGestural.ReadAccidentalGestural(note);
+    accidentalGestural.ReadAccidentalGestural(reader);
     if (accidental.HasAccid() || accidentalGestural.HasAccidGes()) {
         Accid *vrvAccid = new Accid();
         vrvAccid->IsAttribute(true);
@@ -4784,13 +5061,14 @@ bool MeiInput::ReadNote(Object *parent, pugi::xml_node note)
 bool MeiInput::ReadRest(Object *parent, pugi::xml_node rest)
 {
     Rest *vrvRest = new Rest();
-    ReadLayerElement(rest, vrvRest);
+    AttReader reader(rest);
+    ReadLayerElement(rest, vrvRest, reader);
 
-    ReadDurationInterface(rest, vrvRest);
-    ReadPositionInterface(rest, vrvRest);
-    vrvRest->ReadColor(rest);
-    vrvRest->ReadCue(rest);
-    vrvRest->ReadRestVisMensural(rest);
+    ReadDurationInterface(rest, vrvRest, reader);
+    ReadPositionInterface(rest, vrvRest, reader);
+    vrvRest->ReadColor(reader);
+    vrvRest->ReadCue(reader);
+    vrvRest->ReadRestVisMensural(reader);
 
     parent->AddChild(vrvRest);
     ReadUnsupportedAttr(rest, vrvRest);
@@ -4800,9 +5078,10 @@ bool MeiInput::ReadRest(Object *parent, pugi::xml_node rest)
 bool MeiInput::ReadProport(Object *parent, pugi::xml_node proport)
 {
     Proport *vrvProport = new Proport();
-    ReadLayerElement(proport, vrvProport);
+    AttReader reader(proport);
+    ReadLayerElement(proport, vrvProport, reader);
 
-    vrvProport->ReadDurationRatio(proport);
+    vrvProport->ReadDurationRatio(reader);
 
     parent->AddChild(vrvProport);
     ReadUnsupportedAttr(proport, vrvProport);
@@ -4812,9 +5091,10 @@ bool MeiInput::ReadProport(Object *parent, pugi::xml_node proport)
 bool MeiInput::ReadSpace(Object *parent, pugi::xml_node space)
 {
     Space *vrvSpace = new Space();
-    ReadLayerElement(space, vrvSpace);
+    AttReader reader(space);
+    ReadLayerElement(space, vrvSpace, reader);
 
-    ReadDurationInterface(space, vrvSpace);
+    ReadDurationInterface(space, vrvSpace, reader);
 
     parent->AddChild(vrvSpace);
     ReadUnsupportedAttr(space, vrvSpace);
@@ -4824,11 +5104,12 @@ bool MeiInput::ReadSpace(Object *parent, pugi::xml_node space)
 bool MeiInput::ReadSyl(Object *parent, pugi::xml_node syl)
 {
     Syl *vrvSyl = new Syl();
-    ReadLayerElement(syl, vrvSyl);
+    AttReader reader(syl);
+    ReadLayerElement(syl, vrvSyl, reader);
 
-    vrvSyl->ReadLang(syl);
-    vrvSyl->ReadTypography(syl);
-    vrvSyl->ReadSylLog(syl);
+    vrvSyl->ReadLang(reader);
+    vrvSyl->ReadTypography(reader);
+    vrvSyl->ReadSylLog(reader);
 
     parent->AddChild(vrvSyl);
     ReadUnsupportedAttr(syl, vrvSyl);
@@ -4839,10 +5120,11 @@ bool MeiInput::ReadSyllable(Object *parent, pugi::xml_node syllable)
 {
     bool success;
     Syllable *vrvSyllable = new Syllable();
-    ReadLayerElement(syllable, vrvSyllable);
+    AttReader reader(syllable);
+    ReadLayerElement(syllable, vrvSyllable, reader);
 
-    vrvSyllable->ReadColor(syllable);
-    vrvSyllable->ReadSlashCount(syllable);
+    vrvSyllable->ReadColor(reader);
+    vrvSyllable->ReadSlashCount(reader);
 
     parent->AddChild(vrvSyllable);
 
@@ -4864,12 +5146,13 @@ bool MeiInput::ReadSyllable(Object *parent, pugi::xml_node syllable)
 bool MeiInput::ReadTuplet(Object *parent, pugi::xml_node tuplet)
 {
     Tuplet *vrvTuplet = new Tuplet();
-    ReadLayerElement(tuplet, vrvTuplet);
+    AttReader reader(tuplet);
+    ReadLayerElement(tuplet, vrvTuplet, reader);
 
-    vrvTuplet->ReadColor(tuplet);
-    vrvTuplet->ReadDurationRatio(tuplet);
-    vrvTuplet->ReadNumberPlacement(tuplet);
-    vrvTuplet->ReadTupletVis(tuplet);
+    vrvTuplet->ReadColor(reader);
+    vrvTuplet->ReadDurationRatio(reader);
+    vrvTuplet->ReadNumberPlacement(reader);
+    vrvTuplet->ReadTupletVis(reader);
 
     parent->AddChild(vrvTuplet);
     ReadUnsupportedAttr(tuplet, vrvTuplet);
@@ -4879,12 +5162,13 @@ bool MeiInput::ReadTuplet(Object *parent, pugi::xml_node tuplet)
 bool MeiInput::ReadVerse(Object *parent, pugi::xml_node verse)
 {
     Verse *vrvVerse = new Verse();
-    ReadLayerElement(verse, vrvVerse);
+    AttReader reader(verse);
+    ReadLayerElement(verse, vrvVerse, reader);
 
-    vrvVerse->ReadColor(verse);
-    vrvVerse->ReadLang(verse);
-    vrvVerse->ReadNInteger(verse);
-    vrvVerse->ReadTypography(verse);
+    vrvVerse->ReadColor(reader);
+    vrvVerse->ReadLang(reader);
+    vrvVerse->ReadNInteger(reader);
+    vrvVerse->ReadTypography(reader);
 
     parent->AddChild(vrvVerse);
     ReadUnsupportedAttr(verse, vrvVerse);
@@ -4947,11 +5231,11 @@ bool MeiInput::ReadTextChildren(Object *parent, pugi::xml_node parentNode, Objec
     return success;
 }
 
-bool MeiInput::ReadTextElement(pugi::xml_node element, TextElement *object)
+bool MeiInput::ReadTextElement(pugi::xml_node element, TextElement *object, AttReader &reader)
 {
     SetMeiUuid(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    object->ReadLabelled(reader);
+    object->ReadTyped(reader);
 
     return true;
 }
@@ -4959,9 +5243,10 @@ bool MeiInput::ReadTextElement(pugi::xml_node element, TextElement *object)
 bool MeiInput::ReadF(Object *parent, pugi::xml_node f)
 {
     F *vrvF = new F();
-    ReadTextElement(f, vrvF);
+    AttReader reader(f);
+    ReadTextElement(f, vrvF, reader);
 
-    ReadTimeSpanningInterface(f, vrvF);
+    ReadTimeSpanningInterface(f, vrvF, reader);
 
     parent->AddChild(vrvF);
     ReadUnsupportedAttr(f, vrvF);
@@ -4971,9 +5256,10 @@ bool MeiInput::ReadF(Object *parent, pugi::xml_node f)
 bool MeiInput::ReadFig(Object *parent, pugi::xml_node fig)
 {
     Fig *vrvFig = new Fig();
-    ReadTextElement(fig, vrvFig);
+    AttReader reader(fig);
+    ReadTextElement(fig, vrvFig, reader);
 
-    ReadAreaPosInterface(fig, vrvFig);
+    ReadAreaPosInterface(fig, vrvFig, reader);
 
     parent->AddChild(vrvFig);
     ReadUnsupportedAttr(fig, vrvFig);
@@ -4983,7 +5269,8 @@ bool MeiInput::ReadFig(Object *parent, pugi::xml_node fig)
 bool MeiInput::ReadLb(Object *parent, pugi::xml_node lb)
 {
     Lb *vrvLb = new Lb();
-    ReadTextElement(lb, vrvLb);
+    AttReader reader(lb);
+    ReadTextElement(lb, vrvLb, reader);
 
     parent->AddChild(vrvLb);
     ReadUnsupportedAttr(lb, vrvLb);
@@ -4993,7 +5280,8 @@ bool MeiInput::ReadLb(Object *parent, pugi::xml_node lb)
 bool MeiInput::ReadNum(Object *parent, pugi::xml_node num)
 {
     Num *vrvNum = new Num();
-    ReadTextElement(num, vrvNum);
+    AttReader reader(num);
+    ReadTextElement(num, vrvNum, reader);
 
     parent->AddChild(vrvNum);
     ReadUnsupportedAttr(num, vrvNum);
@@ -5003,15 +5291,16 @@ bool MeiInput::ReadNum(Object *parent, pugi::xml_node num)
 bool MeiInput::ReadRend(Object *parent, pugi::xml_node rend)
 {
     Rend *vrvRend = new Rend();
-    ReadTextElement(rend, vrvRend);
+    AttReader reader(rend);
+    ReadTextElement(rend, vrvRend, reader);
 
-    ReadAreaPosInterface(rend, vrvRend);
+    ReadAreaPosInterface(rend, vrvRend, reader);
 
-    vrvRend->ReadColor(rend);
-    vrvRend->ReadLang(rend);
-    vrvRend->ReadTextRendition(rend);
-    vrvRend->ReadTypography(rend);
-    vrvRend->ReadWhitespace(rend);
+    vrvRend->ReadColor(reader);
+    vrvRend->ReadLang(reader);
+    vrvRend->ReadTextRendition(reader);
+    vrvRend->ReadTypography(reader);
+    vrvRend->ReadWhitespace(reader);
 
     if (vrvRend->GetFirstAncestor(REND) && (vrvRend->HasHalign() || vrvRend->HasValign())) {
         LogWarning("@halign or @valign in nested <rend> element <rend> %s will be ignored", vrvRend->GetUuid().c_str());
@@ -5057,22 +5346,22 @@ bool MeiInput::ReadText(Object *parent, pugi::xml_node text, bool trimLeft, bool
     return true;
 }
 
-bool MeiInput::ReadAreaPosInterface(pugi::xml_node element, AreaPosInterface *interface)
+bool MeiInput::ReadAreaPosInterface(pugi::xml_node element, AreaPosInterface *interface, AttReader &reader)
 {
-    interface->ReadHorizontalAlign(element);
-    interface->ReadVerticalAlign(element);
+    interface->ReadHorizontalAlign(reader);
+    interface->ReadVerticalAlign(reader);
     return true;
 }
 
-bool MeiInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *interface)
+bool MeiInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *interface, AttReader &reader)
 {
-    interface->ReadAugmentDots(element);
-    interface->ReadBeamSecondary(element);
-    interface->ReadDurationGestural(element);
-    interface->ReadDurationLogical(element);
-    interface->ReadDurationRatio(element);
-    interface->ReadFermataPresent(element);
-    interface->ReadStaffIdent(element);
+    interface->ReadAugmentDots(reader);
+    interface->ReadBeamSecondary(reader);
+    interface->ReadDurationGestural(reader);
+    interface->ReadDurationLogical(reader);
+    interface->ReadDurationRatio(reader);
+    interface->ReadFermataPresent(reader);
+    interface->ReadStaffIdent(reader);
 
     if (interface->HasFermata()) {
         m_doc->SetAnalyticalMarkup(true);
@@ -5081,66 +5370,66 @@ bool MeiInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *
     return true;
 }
 
-bool MeiInput::ReadLinkingInterface(pugi::xml_node element, LinkingInterface *interface)
+bool MeiInput::ReadLinkingInterface(pugi::xml_node element, LinkingInterface *interface, AttReader &reader)
 {
-    interface->ReadLinking(element);
+    interface->ReadLinking(reader);
     return true;
 }
 
-bool MeiInput::ReadFacsimileInterface(pugi::xml_node element, FacsimileInterface *interface)
+bool MeiInput::ReadFacsimileInterface(pugi::xml_node element, FacsimileInterface *interface, AttReader &reader)
 {
-    interface->ReadFacsimile(element);
+    interface->ReadFacsimile(reader);
     return true;
 }
 
-bool MeiInput::ReadPitchInterface(pugi::xml_node element, PitchInterface *interface)
+bool MeiInput::ReadPitchInterface(pugi::xml_node element, PitchInterface *interface, AttReader &reader)
 {
-    interface->ReadNoteGes(element);
-    interface->ReadOctave(element);
-    interface->ReadPitch(element);
+    interface->ReadNoteGes(reader);
+    interface->ReadOctave(reader);
+    interface->ReadPitch(reader);
     return true;
 }
 
-bool MeiInput::ReadPlistInterface(pugi::xml_node element, PlistInterface *interface)
+bool MeiInput::ReadPlistInterface(pugi::xml_node element, PlistInterface *interface, AttReader &reader)
 {
-    interface->ReadPlist(element);
+    interface->ReadPlist(reader);
     return true;
 }
 
-bool MeiInput::ReadPositionInterface(pugi::xml_node element, PositionInterface *interface)
+bool MeiInput::ReadPositionInterface(pugi::xml_node element, PositionInterface *interface, AttReader &reader)
 {
-    interface->ReadStaffLoc(element);
-    interface->ReadStaffLocPitched(element);
+    interface->ReadStaffLoc(reader);
+    interface->ReadStaffLocPitched(reader);
     return true;
 }
 
-bool MeiInput::ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface)
+bool MeiInput::ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface, AttReader &reader)
 {
-    interface->ReadLyricStyle(element);
-    interface->ReadMidiTempo(element);
-    interface->ReadMultinumMeasures(element);
+    interface->ReadLyricStyle(reader);
+    interface->ReadMidiTempo(reader);
+    interface->ReadMultinumMeasures(reader);
     return true;
 }
 
-bool MeiInput::ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface)
+bool MeiInput::ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface, AttReader &reader)
 {
-    interface->ReadPlacement(element);
+    interface->ReadPlacement(reader);
     return true;
 }
 
-bool MeiInput::ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface)
+bool MeiInput::ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface, AttReader &reader)
 {
-    interface->ReadStaffIdent(element);
-    interface->ReadStartId(element);
-    interface->ReadTimestampLogical(element);
+    interface->ReadStaffIdent(reader);
+    interface->ReadStartId(reader);
+    interface->ReadTimestampLogical(reader);
     return true;
 }
 
-bool MeiInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface)
+bool MeiInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface, AttReader &reader)
 {
-    ReadTimePointInterface(element, interface);
-    interface->ReadStartEndId(element);
-    interface->ReadTimestamp2Logical(element);
+    ReadTimePointInterface(element, interface, reader);
+    interface->ReadStartEndId(reader);
+    interface->ReadTimestamp2Logical(reader);
     return true;
 }
 
@@ -5210,12 +5499,12 @@ bool MeiInput::ReadEditorialElement(Object *parent, pugi::xml_node current, Edit
     }
 }
 
-bool MeiInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *object)
+bool MeiInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *object, AttReader &reader)
 {
     SetMeiUuid(element, object);
 
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    object->ReadLabelled(reader);
+    object->ReadTyped(reader);
 
     return true;
 }
@@ -5223,9 +5512,10 @@ bool MeiInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *ob
 bool MeiInput::ReadAbbr(Object *parent, pugi::xml_node abbr, EditorialLevel level, Object *filter)
 {
     Abbr *vrvAbbr = new Abbr();
-    ReadEditorialElement(abbr, vrvAbbr);
+    AttReader reader(abbr);
+    ReadEditorialElement(abbr, vrvAbbr, reader);
 
-    vrvAbbr->ReadSource(abbr);
+    vrvAbbr->ReadSource(reader);
 
     parent->AddChild(vrvAbbr);
     ReadUnsupportedAttr(abbr, vrvAbbr);
@@ -5235,9 +5525,10 @@ bool MeiInput::ReadAbbr(Object *parent, pugi::xml_node abbr, EditorialLevel leve
 bool MeiInput::ReadAdd(Object *parent, pugi::xml_node add, EditorialLevel level, Object *filter)
 {
     Add *vrvAdd = new Add();
-    ReadEditorialElement(add, vrvAdd);
+    AttReader reader(add);
+    ReadEditorialElement(add, vrvAdd, reader);
 
-    vrvAdd->ReadSource(add);
+    vrvAdd->ReadSource(reader);
 
     parent->AddChild(vrvAdd);
     ReadUnsupportedAttr(add, vrvAdd);
@@ -5247,10 +5538,11 @@ bool MeiInput::ReadAdd(Object *parent, pugi::xml_node add, EditorialLevel level,
 bool MeiInput::ReadAnnot(Object *parent, pugi::xml_node annot)
 {
     Annot *vrvAnnot = new Annot();
-    ReadEditorialElement(annot, vrvAnnot);
+    AttReader reader(annot);
+    ReadEditorialElement(annot, vrvAnnot, reader);
 
-    vrvAnnot->ReadPlist(annot);
-    vrvAnnot->ReadSource(annot);
+    vrvAnnot->ReadPlist(reader);
+    vrvAnnot->ReadSource(reader);
 
     vrvAnnot->m_content.reset();
     // copy all the nodes inside into the document
@@ -5271,7 +5563,8 @@ bool MeiInput::ReadApp(Object *parent, pugi::xml_node app, EditorialLevel level,
         return false;
     }
     App *vrvApp = new App(level);
-    ReadEditorialElement(app, vrvApp);
+    AttReader reader(app);
+    ReadEditorialElement(app, vrvApp, reader);
 
     parent->AddChild(vrvApp);
     ReadUnsupportedAttr(app, vrvApp);
@@ -5336,7 +5629,8 @@ bool MeiInput::ReadChoice(Object *parent, pugi::xml_node choice, EditorialLevel
         return false;
     }
     Choice *vrvChoice = new Choice(level);
-    ReadEditorialElement(choice, vrvChoice);
+    AttReader reader(choice);
+    ReadEditorialElement(choice, vrvChoice, reader);
 
     parent->AddChild(vrvChoice);
     ReadUnsupportedAttr(choice, vrvChoice);
@@ -5423,9 +5717,10 @@ bool MeiInput::ReadChoiceChildren(Object *parent, pugi::xml_node parentNode, Edi
 bool MeiInput::ReadCorr(Object *parent, pugi::xml_node corr, EditorialLevel level, Object *filter)
 {
     Corr *vrvCorr = new Corr();
-    ReadEditorialElement(corr, vrvCorr);
+    AttReader reader(corr);
+    ReadEditorialElement(corr, vrvCorr, reader);
 
-    vrvCorr->ReadSource(corr);
+    vrvCorr->ReadSource(reader);
 
     parent->AddChild(vrvCorr);
     ReadUnsupportedAttr(corr, vrvCorr);
@@ -5435,9 +5730,10 @@ bool MeiInput::ReadCorr(Object *parent, pugi::xml_node corr, EditorialLevel leve
 bool MeiInput::ReadDamage(Object *parent, pugi::xml_node damage, EditorialLevel level, Object *filter)
 {
     Damage *vrvDamage = new Damage();
-    ReadEditorialElement(damage, vrvDamage);
+    AttReader reader(damage);
+    ReadEditorialElement(damage, vrvDamage, reader);
 
-    vrvDamage->ReadSource(damage);
+    vrvDamage->ReadSource(reader);
 
     parent->AddChild(vrvDamage);
     ReadUnsupportedAttr(damage, vrvDamage);
@@ -5447,9 +5743,10 @@ bool MeiInput::ReadDamage(Object *parent, pugi::xml_node damage, EditorialLevel
 bool MeiInput::ReadDel(Object *parent, pugi::xml_node del, EditorialLevel level, Object *filter)
 {
     Del *vrvDel = new Del();
-    ReadEditorialElement(del, vrvDel);
+    AttReader reader(del);
+    ReadEditorialElement(del, vrvDel, reader);
 
-    vrvDel->ReadSource(del);
+    vrvDel->ReadSource(reader);
 
     parent->AddChild(vrvDel);
     ReadUnsupportedAttr(del, vrvDel);
@@ -5459,9 +5756,10 @@ bool MeiInput::ReadDel(Object *parent, pugi::xml_node del, EditorialLevel level,
 bool MeiInput::ReadExpan(Object *parent, pugi::xml_node expan, EditorialLevel level, Object *filter)
 {
     Expan *vrvExpan = new Expan();
-    ReadEditorialElement(expan, vrvExpan);
+    AttReader reader(expan);
+    ReadEditorialElement(expan, vrvExpan, reader);
 
-    vrvExpan->ReadSource(expan);
+    vrvExpan->ReadSource(reader);
 
     parent->AddChild(vrvExpan);
     ReadUnsupportedAttr(expan, vrvExpan);
@@ -5475,9 +5773,10 @@ bool MeiInput::ReadLem(Object *parent, pugi::xml_node lem, EditorialLevel level,
     Lem *vrvLem = new Lem();
     // By default make them all hidden. MeiInput::ReadAppChildren will make one visible.
     vrvLem->m_visibility = Hidden;
-    ReadEditorialElement(lem, vrvLem);
+    AttReader reader(lem);
+    ReadEditorialElement(lem, vrvLem, reader);
 
-    vrvLem->ReadSource(lem);
+    vrvLem->ReadSource(reader);
 
     parent->AddChild(vrvLem);
     ReadUnsupportedAttr(lem, vrvLem);
@@ -5487,9 +5786,10 @@ bool MeiInput::ReadLem(Object *parent, pugi::xml_node lem, EditorialLevel level,
 bool MeiInput::ReadOrig(Object *parent, pugi::xml_node orig, EditorialLevel level, Object *filter)
 {
     Orig *vrvOrig = new Orig();
-    ReadEditorialElement(orig, vrvOrig);
+    AttReader reader(orig);
+    ReadEditorialElement(orig, vrvOrig, reader);
 
-    vrvOrig->ReadSource(orig);
+    vrvOrig->ReadSource(reader);
 
     parent->AddChild(vrvOrig);
     ReadUnsupportedAttr(orig, vrvOrig);
@@ -5503,9 +5803,10 @@ bool MeiInput::ReadRdg(Object *parent, pugi::xml_node rdg, EditorialLevel level,
     Rdg *vrvRdg = new Rdg();
     // By default make them all hidden. MeiInput::ReadAppChildren will make one visible.
     vrvRdg->m_visibility = Hidden;
-    ReadEditorialElement(rdg, vrvRdg);
+    AttReader reader(rdg);
+    ReadEditorialElement(rdg, vrvRdg, reader);
 
-    vrvRdg->ReadSource(rdg);
+    vrvRdg->ReadSource(reader);
 
     parent->AddChild(vrvRdg);
     ReadUnsupportedAttr(rdg, vrvRdg);
@@ -5515,7 +5816,8 @@ bool MeiInput::ReadRdg(Object *parent, pugi::xml_node rdg, EditorialLevel level,
 bool MeiInput::ReadRef(Object *parent, pugi::xml_node ref, EditorialLevel level, Object *filter)
 {
     Ref *vrvRef = new Ref();
-    ReadEditorialElement(ref, vrvRef);
+    AttReader reader(ref);
+    ReadEditorialElement(ref, vrvRef, reader);
 
     parent->AddChild(vrvRef);
     ReadUnsupportedAttr(ref, vrvRef);
@@ -5525,9 +5827,10 @@ bool MeiInput::ReadRef(Object *parent, pugi::xml_node ref, EditorialLevel level,
 bool MeiInput::ReadReg(Object *parent, pugi::xml_node reg, EditorialLevel level, Object *filter)
 {
     Reg *vrvReg = new Reg();
-    ReadEditorialElement(reg, vrvReg);
+    AttReader reader(reg);
+    ReadEditorialElement(reg, vrvReg, reader);
 
-    vrvReg->ReadSource(reg);
+    vrvReg->ReadSource(reader);
 
     parent->AddChild(vrvReg);
     ReadUnsupportedAttr(reg, vrvReg);
@@ -5537,9 +5840,10 @@ bool MeiInput::ReadReg(Object *parent, pugi::xml_node reg, EditorialLevel level,
 bool MeiInput::ReadRestore(Object *parent, pugi::xml_node restore, EditorialLevel level, Object *filter)
 {
     Restore *vrvRestore = new Restore();
-    ReadEditorialElement(restore, vrvRestore);
+    AttReader reader(restore);
+    ReadEditorialElement(restore, vrvRestore, reader);
 
-    vrvRestore->ReadSource(restore);
+    vrvRestore->ReadSource(reader);
 
     parent->AddChild(vrvRestore);
     ReadUnsupportedAttr(restore, vrvRestore);
@@ -5549,9 +5853,10 @@ bool MeiInput::ReadRestore(Object *parent, pugi::xml_node restore, EditorialLeve
 bool MeiInput::ReadSic(Object *parent, pugi::xml_node sic, EditorialLevel level, Object *filter)
 {
     Sic *vrvSic = new Sic();
-    ReadEditorialElement(sic, vrvSic);
+    AttReader reader(sic);
+    ReadEditorialElement(sic, vrvSic, reader);
 
-    vrvSic->ReadSource(sic);
+    vrvSic->ReadSource(reader);
 
     parent->AddChild(vrvSic);
     ReadUnsupportedAttr(sic, vrvSic);
@@ -5565,7 +5870,8 @@ bool MeiInput::ReadSubst(Object *parent, pugi::xml_node subst, EditorialLevel le
         return false;
     }
     Subst *vrvSubst = new Subst(level);
-    ReadEditorialElement(subst, vrvSubst);
+    AttReader reader(subst);
+    ReadEditorialElement(subst, vrvSubst, reader);
 
     parent->AddChild(vrvSubst);
     ReadUnsupportedAttr(subst, vrvSubst);
@@ -5634,9 +5940,10 @@ bool MeiInput::ReadSubstChildren(Object *parent, pugi::xml_node parentNode, Edit
 bool MeiInput::ReadSupplied(Object *parent, pugi::xml_node supplied, EditorialLevel level, Object *filter)
 {
     Supplied *vrvSupplied = new Supplied();
-    ReadEditorialElement(supplied, vrvSupplied);
+    AttReader reader(supplied);
+    ReadEditorialElement(supplied, vrvSupplied, reader);
 
-    vrvSupplied->ReadSource(supplied);
+    vrvSupplied->ReadSource(reader);
 
     parent->AddChild(vrvSupplied);
     ReadUnsupportedAttr(supplied, vrvSupplied);
@@ -5646,9 +5953,10 @@ bool MeiInput::ReadSupplied(Object *parent, pugi::xml_node supplied, EditorialLe
 bool MeiInput::ReadUnclear(Object *parent, pugi::xml_node unclear, EditorialLevel level, Object *filter)
 {
     Unclear *vrvUnclear = new Unclear();
-    ReadEditorialElement(unclear, vrvUnclear);
+    AttReader reader(unclear);
+    ReadEditorialElement(unclear, vrvUnclear, reader);
 
-    vrvUnclear->ReadSource(unclear);
+    vrvUnclear->ReadSource(reader);
 
     parent->AddChild(vrvUnclear);
     ReadUnsupportedAttr(unclear, vrvUnclear);
@@ -5975,8 +6283,9 @@ bool MeiInput::ReadSurface(Facsimile *parent, pugi::xml_node surface)
     assert(parent);
     Surface *vrvSurface = new Surface();
     SetMeiUuid(surface, vrvSurface);
-    vrvSurface->ReadCoordinated(surface);
-    vrvSurface->ReadTyped(surface);
+    AttReader reader(surface);
+    vrvSurface->ReadCoordinated(reader);
+    vrvSurface->ReadTyped(reader);
 
     for (pugi::xml_node child = surface.first_child(); child; child = child.next_sibling()) {
         if (strcmp(child.name(), "zone") == 0) {
@@ -5995,8 +6304,9 @@ bool MeiInput::ReadZone(Surface *parent, pugi::xml_node zone)
     assert(parent);
     Zone *vrvZone = new Zone();
     SetMeiUuid(zone, vrvZone);
-    vrvZone->ReadCoordinated(zone);
-    vrvZone->ReadTyped(zone);
+    AttReader reader(zone);
+    vrvZone->ReadCoordinated(reader);
+    vrvZone->ReadTyped(reader);
     parent->AddChild(vrvZone);
     return true;
 }
@@ -322,7 +322,7 @@ void MusicXmlInput::FillSpace(Layer *layer, int dur)
 
 void MusicXmlInput::GenerateUuid(pugi::xml_node node)
 {
-    int nr = std::rand();
+    int nr = (int)(*Object::GetUuidGenerator())();
     char str[17];
     // I do not want to use a stream for doing this!
     snprintf(str, 17, "%016d", nr);
@@ -100,41 +100,58 @@ void Layer::ResetStaffDefObjects()
 {
     m_drawKeySigCancellation = false;
     if (m_staffDefClef) {
+        this->UnregisterOwnedObject(m_staffDefClef);
         delete m_staffDefClef;
         m_staffDefClef = NULL;
     }
     if (m_staffDefKeySig) {
+        this->UnregisterOwnedObject(m_staffDefKeySig);
         delete m_staffDefKeySig;
         m_staffDefKeySig = NULL;
     }
     if (m_staffDefMensur) {
+        this->UnregisterOwnedObject(m_staffDefMensur);
         delete m_staffDefMensur;
         m_staffDefMensur = NULL;
     }
     if (m_staffDefMeterSig) {
+        this->UnregisterOwnedObject(m_staffDefMeterSig);
         delete m_staffDefMeterSig;
         m_staffDefMeterSig = NULL;
     }
     // cautionary values
     m_drawCautionKeySigCancel = false;
     if (m_cautionStaffDefClef) {
+        this->UnregisterOwnedObject(m_cautionStaffDefClef);
         delete m_cautionStaffDefClef;
         m_cautionStaffDefClef = NULL;
     }
     if (m_cautionStaffDefKeySig) {
+        this->UnregisterOwnedObject(m_cautionStaffDefKeySig);
         delete m_cautionStaffDefKeySig;
         m_cautionStaffDefKeySig = NULL;
     }
     if (m_cautionStaffDefMensur) {
+        this->UnregisterOwnedObject(m_cautionStaffDefMensur);
         delete m_cautionStaffDefMensur;
         m_cautionStaffDefMensur = NULL;
     }
     if (m_cautionStaffDefMeterSig) {
+        this->UnregisterOwnedObject(m_cautionStaffDefMeterSig);
         delete m_cautionStaffDefMeterSig;
         m_cautionStaffDefMeterSig = NULL;
     }
 }
 
+void Layer::GetOwnedObjects(ArrayOfObjects *objects)
+{
+    Object *ownedObjects[] = { m_staffDefClef, m_staffDefKeySig, m_staffDefMensur, m_staffDefMeterSig,
+        m_cautionStaffDefClef, m_cautionStaffDefKeySig, m_cautionStaffDefMensur, m_cautionStaffDefMeterSig };
+    for (auto &object : ownedObjects) {
+        if (object) objects->push_back(object);
+    }
+}
+
 void Layer::AddChild(Object *child)
 {
     if (child->IsLayerElement()) {
@@ -234,6 +251,9 @@ data_STEMDIRECTION Layer::GetDrawingStemDir(LayerElement *element)
 {
     assert(element);
 
+    // No need to count the layers when no direction is set for the layer
+    if (m_drawingStemDir == STEMDIRECTION_NONE) return STEMDIRECTION_NONE;
+
     if (this->GetLayerCountForTimeSpanOf(element) < 2) {
         return STEMDIRECTION_NONE;
     }
@@ -246,6 +266,9 @@ data_STEMDIRECTION Layer::GetDrawingStemDir(const ArrayOfBeamElementCoords *coor
 {
     assert(!coords->empty());
 
+    // No need to count the layers when no direction is set for the layer
+    if (m_drawingStemDir == STEMDIRECTION_NONE) return STEMDIRECTION_NONE;
+
     // Adjust the x position of the first and last element for taking into account the stem width
     LayerElement *first = dynamic_cast<LayerElement *>(coords->front()->m_element);
     LayerElement *last = dynamic_cast<LayerElement *>(coords->back()->m_element);
@@ -356,21 +379,24 @@ void Layer::SetDrawingStaffDefValues(StaffDef *currentStaffDef)
     // Remove any previous value in the Layer
     this->ResetStaffDefObjects();
 
+    // The copies can be made for a page cast off progressively
+    ObjectUuidGenerator uuidGenerator(this);
+
     if (currentStaffDef->DrawClef()) {
         this->m_staffDefClef = new Clef(*currentStaffDef->GetCurrentClef());
-        this->m_staffDefClef->SetParent(this);
+        this->RegisterOwnedObject(this->m_staffDefClef);
     }
     if (currentStaffDef->DrawKeySig()) {
         this->m_staffDefKeySig = new KeySig(*currentStaffDef->GetCurrentKeySig());
-        this->m_staffDefKeySig->SetParent(this);
+        this->RegisterOwnedObject(this->m_staffDefKeySig);
     }
     if (currentStaffDef->DrawMensur()) {
         this->m_staffDefMensur = new Mensur(*currentStaffDef->GetCurrentMensur());
-        this->m_staffDefMensur->SetParent(this);
+        this->RegisterOwnedObject(this->m_staffDefMensur);
     }
     if (currentStaffDef->DrawMeterSig()) {
         this->m_staffDefMeterSig = new MeterSig(*currentStaffDef->GetCurrentMeterSig());
-        this->m_staffDefMeterSig->SetParent(this);
+        this->RegisterOwnedObject(this->m_staffDefMeterSig);
     }
 
     // Don't draw on the next one
@@ -387,22 +413,24 @@ void Layer::SetDrawingCautionValues(StaffDef *currentStaffDef)
         return;
     }
 
+    // Not the uuids of the copies above
+    ObjectUuidGenerator uuidGenerator(this, 1);
     if (currentStaffDef->DrawClef()) {
         this->m_cautionStaffDefClef = new Clef(*currentStaffDef->GetCurrentClef());
-        this->m_cautionStaffDefClef->SetParent(this);
+        this->RegisterOwnedObject(this->m_cautionStaffDefClef);
     }
     // special case - see above
     if (currentStaffDef->DrawKeySig()) {
         this->m_cautionStaffDefKeySig = new KeySig(*currentStaffDef->GetCurrentKeySig());
-        this->m_cautionStaffDefKeySig->SetParent(this);
+        this->RegisterOwnedObject(this->m_cautionStaffDefKeySig);
     }
     if (currentStaffDef->DrawMensur()) {
         this->m_cautionStaffDefMensur = new Mensur(*currentStaffDef->GetCurrentMensur());
-        this->m_cautionStaffDefMensur->SetParent(this);
+        this->RegisterOwnedObject(this->m_cautionStaffDefMensur);
     }
     if (currentStaffDef->DrawMeterSig()) {
         this->m_cautionStaffDefMeterSig = new MeterSig(*currentStaffDef->GetCurrentMeterSig());
-        this->m_cautionStaffDefMeterSig->SetParent(this);
+        this->RegisterOwnedObject(this->m_cautionStaffDefMeterSig);
     }
 
     // Don't draw on the next one
@@ -605,20 +633,25 @@ int Layer::CalcOnsetOffset(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
-/*
 int Layer::GenerateMIDI(FunctorParams *functorParams)
 {
     GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
-    if (this->HasSameasLink()) {
-        assert(this->GetSameasLink());
-        this->GetSameasLink()->Process(params->m_functor, functorParams);
-    }
+    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    assert(staff);
+
+    // Write to the buffer of the staff/layer pair - layers without one are not exported
+    MapOfMIDILayerBuffers::iterator iter = params->m_layerBuffers.find(std::make_pair(staff->GetN(), this->GetN()));
+    if (iter == params->m_layerBuffers.end()) return FUNCTOR_SIBLINGS;
+    params->m_currentLayerBuffer = &iter->second;
+
+    // @sameas to be added once Layer implements LinkingInterface
 
     return FUNCTOR_CONTINUE;
 }
 
+/*
 int Layer::GenerateTimemap(FunctorParams *functorParams)
 {
     GenerateTimemapParams *params = dynamic_cast<GenerateTimemapParams *>(functorParams);
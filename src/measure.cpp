@@ -65,8 +65,8 @@ Measure::Measure(bool measureMusic, int logMeasureNb)
     // Idem for timestamps
     m_timestampAligner.SetParent(this);
     // Idem for barlines
-    m_leftBarLine.SetParent(this);
-    m_rightBarLine.SetParent(this);
+    this->RegisterOwnedObject(&m_leftBarLine);
+    this->RegisterOwnedObject(&m_rightBarLine);
 
     // owned pointers need to be set to NULL;
     m_drawingScoreDef = NULL;
@@ -94,8 +94,8 @@ void Measure::CloneReset()
     // Idem for timestamps
     m_timestampAligner.SetParent(this);
     // Idem for barlines
-    m_leftBarLine.SetParent(this);
-    m_rightBarLine.SetParent(this);
+    this->RegisterOwnedObject(&m_leftBarLine);
+    this->RegisterOwnedObject(&m_rightBarLine);
 
     // owned pointers need to be set to NULL;
     m_drawingScoreDef = NULL;
@@ -332,10 +332,18 @@ void Measure::SetDrawingScoreDef(ScoreDef *drawingScoreDef)
 {
     assert(!m_drawingScoreDef); // We should always call UnsetCurrentScoreDef before
 
+    // The copy can be made in a layout thread
+    ObjectUuidGenerator uuidGenerator(this);
     m_drawingScoreDef = new ScoreDef();
     *m_drawingScoreDef = *drawingScoreDef;
 }
 
+void Measure::GetOwnedObjects(ArrayOfObjects *objects)
+{
+    objects->push_back(&m_leftBarLine);
+    objects->push_back(&m_rightBarLine);
+}
+
 std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
 {
     assert(scoreDef);
@@ -390,8 +398,7 @@ Staff *Measure::GetTopVisibleStaff()
 int Measure::EnclosesTime(int time) const
 {
     int repeat = 1;
-    int timeDuration = int(
-        m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5);
+    int timeDuration = this->GetRealTimeDurationMilliseconds();
     std::vector<double>::const_iterator iter;
     for (iter = m_realTimeOffsetMilliseconds.begin(); iter != m_realTimeOffsetMilliseconds.end(); ++iter) {
         if ((time >= *iter) && (time <= *iter + timeDuration)) return repeat;
@@ -406,6 +413,12 @@ double Measure::GetRealTimeOffsetMilliseconds(int repeat) const
     return m_realTimeOffsetMilliseconds.at(repeat - 1);
 }
 
+int Measure::GetRealTimeDurationMilliseconds() const
+{
+    return int(
+        m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5);
+}
+
 void Measure::SetDrawingBarLines(Measure *previous, bool systemBreak, bool scoreDefInsert)
 {
     // First set the right barline. If none then set a single one.
@@ -250,7 +250,7 @@ Point Note::GetStemUpSE(Doc *doc, int staffSize, bool isCueSize)
         return p;
     }
 
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = doc->GetResources().GetGlyph(code);
     assert(glyph);
 
     if (glyph->HasAnchor(SMUFL_stemUpSE)) {
@@ -289,7 +289,7 @@ Point Note::GetStemDownNW(Doc *doc, int staffSize, bool isCueSize)
         return p;
     }
 
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = doc->GetResources().GetGlyph(code);
     assert(glyph);
 
     if (glyph->HasAnchor(SMUFL_stemDownNW)) {
@@ -951,8 +951,11 @@ int Note::GenerateMIDI(FunctorParams *functorParams)
     // Check for accidentals
     midiBase += note->GetChromaticAlteration();
 
+    MIDILayerBuffer *layerBuffer = params->m_currentLayerBuffer;
+    assert(layerBuffer);
+
     // Adjustment for transposition intruments
-    midiBase += params->m_transSemi;
+    midiBase += layerBuffer->m_transSemi;
 
     int oct = note->GetOct();
     if (note->HasOctGes()) oct = note->GetOctGes();
@@ -960,7 +963,7 @@ int Note::GenerateMIDI(FunctorParams *functorParams)
     int pitch = midiBase + (oct + 1) * 12;
     // We do store the MIDIPitch in the note even with a sameas
     this->SetMIDIPitch(pitch);
-    int channel = params->m_midiChannel;
+    int channel = layerBuffer->m_midiChannel;
     int velocity = MIDI_VELOCITY;
     if (note->HasVel()) velocity = note->GetVel();
 
@@ -969,8 +972,8 @@ int Note::GenerateMIDI(FunctorParams *functorParams)
 
     int tpq = params->m_midiFile->getTPQ();
 
-    params->m_midiFile->addNoteOn(params->m_midiTrack, starttime * tpq, channel, pitch, velocity);
-    params->m_midiFile->addNoteOff(params->m_midiTrack, stoptime * tpq, channel, pitch);
+    layerBuffer->m_midiFile->addNoteOn(layerBuffer->m_midiTrack, starttime * tpq, channel, pitch, velocity);
+    layerBuffer->m_midiFile->addNoteOff(layerBuffer->m_midiTrack, stoptime * tpq, channel, pitch);
 
     return FUNCTOR_SIBLINGS;
 }
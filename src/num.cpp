@@ -32,10 +32,15 @@ Num::~Num() {}
 
 void Num::Reset()
 {
-    m_currentText.SetParent(this);
+    this->RegisterOwnedObject(&m_currentText);
     m_currentText.SetText(L"");
 }
 
+void Num::GetOwnedObjects(ArrayOfObjects *objects)
+{
+    objects->push_back(&m_currentText);
+}
+
 void Num::AddChild(Object *child)
 {
     if (child->Is(TEXT)) {
@@ -9,9 +9,11 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <iostream>
 #include <math.h>
+#include <mutex>
 #include <sstream>
 
 //----------------------------------------------------------------------------
@@ -51,22 +53,36 @@ namespace vrv {
 // Object
 //----------------------------------------------------------------------------
 
-unsigned long Object::s_objectCounter = 0;
+/** The uuid generator set for the current thread */
+static thread_local UuidGenerator *s_uuidGenerator = NULL;
+
+/** The mutex for building the string of the generated uuids (see Object::GetUuid) */
+static std::mutex s_uuidStringMutex;
+
+/**
+ * FNV-1a hash of the characters of a uuid, continued from the given hash
+ */
+static unsigned int HashChars(unsigned int hash, const char *chars, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ (unsigned char)chars[i]) * 16777619u;
+    }
+    return hash;
+}
 
 Object::Object() : BoundingBox()
 {
     Init("m-");
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
-Object::Object(std::string classid) : BoundingBox()
+Object::Object(const char *classid) : BoundingBox()
 {
     Init(classid);
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
+}
+
+Object::Object(const char *classid, bool generateUuid) : BoundingBox()
+{
+    Init(classid, generateUuid);
 }
 
 Object *Object::Clone() const
@@ -88,6 +104,9 @@ Object::Object(const Object &object) : BoundingBox(object)
     m_isAttribute = object.m_isAttribute;
     m_isModified = true;
     m_isReferenceObject = object.m_isReferenceObject;
+    m_isUuidIndexRoot = false;
+    m_isOutsideUuidIndex = object.m_isOutsideUuidIndex;
+    m_isOwnedObject = false;
 
     // Also copy attribute classes
     m_attClasses = object.m_attClasses;
@@ -128,7 +147,7 @@ Object &Object::operator=(const Object &object)
         ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
         m_classid = object.m_classid;
-        m_parent = NULL;
+        if (m_parent) this->ResetParent();
         // Flags
         m_isAttribute = object.m_isAttribute;
         m_isModified = true;
@@ -158,10 +177,14 @@ Object &Object::operator=(const Object &object)
 
 Object::~Object()
 {
+    if (m_parent) {
+        Doc *doc = this->GetUuidIndexDoc();
+        if (doc) doc->RemoveFromUuidIndex(this);
+    }
     ClearChildren();
 }
 
-void Object::Init(std::string classid)
+void Object::Init(const char *classid, bool generateUuid)
 {
     m_classid = classid;
     m_parent = NULL;
@@ -169,8 +192,19 @@ void Object::Init(std::string classid)
     m_isAttribute = false;
     m_isModified = true;
     m_isReferenceObject = false;
+    m_isUuidIndexRoot = false;
+    m_isOutsideUuidIndex = false;
+    m_isOwnedObject = false;
 
-    this->GenerateUuid();
+    if (generateUuid) {
+        this->GenerateUuid();
+    }
+    else {
+        m_uuidNr = 0;
+        m_hasGeneratedUuid = false;
+        m_hasUuidString = false;
+        m_uuid.clear();
+    }
 
     Reset();
 }
@@ -197,8 +231,11 @@ void Object::Reset()
 
 void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
 {
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
+    std::vector<AttClassId>::iterator iter;
+    for (iter = attClasses->begin(); iter != attClasses->end(); ++iter) {
+        m_attClasses.set(*iter);
+    }
+    m_interfaces.set(interfaceId);
 }
 
 bool Object::IsBoundaryElement()
@@ -234,6 +271,30 @@ void Object::MoveChildrenFrom(Object *sourceParent, int idx, bool allowTypeChang
     }
 }
 
+void Object::MoveChildRangeFrom(Object *sourceParent, int startIdx, int endIdx)
+{
+    assert(sourceParent && (sourceParent != this));
+    assert((startIdx >= 0) && (startIdx <= endIdx) && (endIdx <= (int)sourceParent->m_children.size()));
+
+    Doc *doc = this->GetUuidIndexDoc();
+    bool sameDoc = (doc == sourceParent->GetUuidIndexDoc());
+    ArrayOfObjects::iterator start = sourceParent->m_children.begin() + startIdx;
+    ArrayOfObjects::iterator end = sourceParent->m_children.begin() + endIdx;
+    for (ArrayOfObjects::iterator iter = start; iter != end; ++iter) {
+        if (sameDoc) {
+            (*iter)->m_parent = this;
+        }
+        else {
+            (*iter)->ResetParent();
+            (*iter)->SetParent(this);
+        }
+    }
+    m_children.insert(m_children.end(), start, end);
+    sourceParent->m_children.erase(start, end);
+    // The objects stay in the uuid index but their processing order has changed
+    if (sameDoc && doc) doc->IncrementTreeVersion();
+}
+
 void Object::ReplaceChild(Object *currentChild, Object *replacingChild)
 {
     assert(this->GetChildIndex(currentChild) != -1);
@@ -273,6 +334,9 @@ void Object::InsertAfter(Object *child, Object *newChild)
 void Object::SortChildren(Object::binaryComp comp)
 {
     std::stable_sort(m_children.begin(), m_children.end(), comp);
+    // The processing order of the children has changed
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->IncrementTreeVersion();
     this->Modify();
 }
 
@@ -287,9 +351,67 @@ void Object::MoveItselfTo(Object *targetParent)
     targetParent->AddChild(relinquishedObject);
 }
 
+const std::string &Object::GetUuid() const
+{
+    if (!m_hasGeneratedUuid || m_hasUuidString.load(std::memory_order_acquire)) return m_uuid;
+
+    std::lock_guard<std::mutex> lock(s_uuidStringMutex);
+    if (!m_hasUuidString.load(std::memory_order_relaxed)) {
+        char str[16];
+        this->WriteUuidNr(str);
+        m_uuid.reserve(strlen(m_classid) + 16);
+        m_uuid.append(m_classid);
+        m_uuid.append(str, 16);
+        m_hasUuidString.store(true, std::memory_order_release);
+    }
+    return m_uuid;
+}
+
+bool Object::HasUuid(const std::string &uuid) const
+{
+    if (!m_hasGeneratedUuid || m_hasUuidString.load(std::memory_order_acquire)) return (m_uuid == uuid);
+
+    const size_t prefixLength = strlen(m_classid);
+    if ((uuid.size() != prefixLength + 16) || (uuid.compare(0, prefixLength, m_classid) != 0)) return false;
+    char str[16];
+    this->WriteUuidNr(str);
+    return (uuid.compare(prefixLength, 16, str, 16) == 0);
+}
+
+unsigned int Object::GetUuidHash() const
+{
+    if (!m_hasGeneratedUuid || m_hasUuidString.load(std::memory_order_acquire)) return HashUuid(m_uuid);
+
+    char str[16];
+    this->WriteUuidNr(str);
+    unsigned int hash = HashChars(2166136261u, m_classid, strlen(m_classid));
+    return HashChars(hash, str, 16);
+}
+
+unsigned int Object::HashUuid(const std::string &uuid)
+{
+    return HashChars(2166136261u, uuid.c_str(), uuid.size());
+}
+
+void Object::WriteUuidNr(char *str) const
+{
+    // Same as "%016d" without parsing a format for each call
+    unsigned int value = (m_uuidNr < 0) ? 0u - (unsigned int)m_uuidNr : (unsigned int)m_uuidNr;
+    for (int i = 15; i >= 0; --i) {
+        str[i] = '0' + value % 10;
+        value /= 10;
+    }
+    if (m_uuidNr < 0) str[0] = '-';
+}
+
 void Object::SetUuid(std::string uuid)
 {
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(this);
     m_uuid = uuid;
+    m_hasGeneratedUuid = false;
+    m_hasUuidString = false;
+    if (doc) doc->AddToUuidIndex(this);
 }
 
 void Object::SwapUuid(Object *other)
@@ -485,6 +607,23 @@ void Object::ClearRelinquishedChildren()
 
 Object *Object::FindDescendantByUuid(std::string uuid, int deepness, bool direction)
 {
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc && (deepness == UNLIMITED_DEPTH)) {
+        if (this->HasUuid(uuid)) return this;
+        ArrayOfObjects objects;
+        doc->FindAllInUuidIndex(uuid, &objects);
+        Object *element = NULL;
+        int count = 0;
+        for (auto &object : objects) {
+            if (object->IsProcessedFrom(this)) {
+                element = object;
+                count++;
+            }
+        }
+        // With duplicated uuids we need to process the tree for getting the first one in the requested direction
+        if (count < 2) return element;
+    }
+
     Functor findByUuid(&Object::FindByUuid);
     FindByUuidParams findbyUuidParams;
     findbyUuidParams.m_uuid = uuid;
@@ -574,34 +713,220 @@ bool Object::DeleteChild(Object *child)
 
 void Object::GenerateUuid()
 {
-    int nr = std::rand();
-    char str[17];
-    // I do not want to use a stream for doing this!
-    snprintf(str, 17, "%016d", nr);
-
-    m_uuid = m_classid + std::string(str);
+    // The uuid string is built from the number when needed
+    m_uuidNr = (int)(*GetUuidGenerator())();
+    m_hasGeneratedUuid = true;
+    m_hasUuidString = false;
+    std::string().swap(m_uuid);
 }
 
 void Object::ResetUuid()
 {
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(this);
     GenerateUuid();
+    if (doc) doc->AddToUuidIndex(this);
 }
 
 void Object::SeedUuid(unsigned int seed)
 {
     // Init random number generator for uuids
     if (seed == 0) {
-        std::srand((unsigned int)std::time(0));
+        GetUuidGenerator()->seed(std::random_device()());
     }
     else {
-        std::srand(seed);
+        GetUuidGenerator()->seed(seed);
     }
 }
 
+void Object::SetUuidGenerator(UuidGenerator *generator)
+{
+    s_uuidGenerator = generator;
+}
+
+UuidGenerator *Object::GetUuidGenerator()
+{
+    if (s_uuidGenerator) return s_uuidGenerator;
+    // The generator of the thread is seeded on first use
+    static thread_local UuidGenerator threadGenerator(std::random_device{}());
+    return &threadGenerator;
+}
+
 void Object::SetParent(Object *parent)
 {
     assert(!m_parent);
     m_parent = parent;
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) this->AddSubtreeToUuidIndex(doc);
+}
+
+void Object::ResetParent()
+{
+    if (!m_parent) return;
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) this->RemoveSubtreeFromUuidIndex(doc);
+    m_parent = NULL;
+    m_isOwnedObject = false;
+}
+
+void Object::RegisterOwnedObject(Object *object)
+{
+    assert(object && !object->m_parent);
+
+    object->m_isOwnedObject = true;
+    object->SetParent(this);
+}
+
+void Object::UnregisterOwnedObject(Object *object)
+{
+    assert(object && (object->m_parent == this) && object->m_isOwnedObject);
+
+    object->ResetParent();
+}
+
+Doc *Object::GetUuidIndexDoc() const
+{
+    const Object *root = this;
+    while (root->m_parent) {
+        if (root->m_isOutsideUuidIndex) return NULL;
+        root = root->m_parent;
+    }
+    if (!root->m_isUuidIndexRoot) return NULL;
+    return static_cast<Doc *>(const_cast<Object *>(root));
+}
+
+void Object::AddSubtreeToUuidIndex(Doc *doc)
+{
+    assert(doc);
+
+    doc->AddToUuidIndex(this);
+
+    ArrayOfObjects ownedObjects;
+    this->GetOwnedObjects(&ownedObjects);
+    for (auto &object : ownedObjects) {
+        // Not registered yet (e.g., in a clone)
+        if (object->m_parent == this) object->AddSubtreeToUuidIndex(doc);
+    }
+
+    if (m_isReferenceObject) return;
+    for (auto &child : m_children) {
+        if (child->m_parent == this) child->AddSubtreeToUuidIndex(doc);
+    }
+}
+
+void Object::RemoveSubtreeFromUuidIndex(Doc *doc)
+{
+    assert(doc);
+
+    doc->RemoveFromUuidIndex(this);
+
+    ArrayOfObjects ownedObjects;
+    this->GetOwnedObjects(&ownedObjects);
+    for (auto &object : ownedObjects) {
+        // Not registered yet (e.g., in a clone)
+        if (object->m_parent == this) object->RemoveSubtreeFromUuidIndex(doc);
+    }
+
+    if (m_isReferenceObject) return;
+    for (auto &child : m_children) {
+        if (child->m_parent == this) child->RemoveSubtreeFromUuidIndex(doc);
+    }
+}
+
+void Object::AddSubtreeToClassIdIndex(ClassIdIndex *index)
+{
+    assert(index);
+
+    int position = (int)index->m_objects.size();
+    index->m_objects.push_back(this);
+    index->m_subtreeEnds.push_back(position + 1);
+    index->m_positions.at(this->GetClassId()).push_back(position);
+
+    // Same as Process, the children of hidden objects are not processed
+    if (this->IsHidden()) return;
+    for (auto &child : m_children) {
+        child->AddSubtreeToClassIdIndex(index);
+    }
+    index->m_subtreeEnds.at(position) = (int)index->m_objects.size();
+}
+
+bool Object::ProcessClassIds(Functor *functor, FunctorParams *functorParams)
+{
+    assert(functor);
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (!doc) return false;
+
+    std::shared_ptr<ClassIdIndex> index = doc->GetClassIdIndex(this);
+    if (!index) {
+        index = std::make_shared<ClassIdIndex>();
+        index->m_treeVersion = doc->GetTreeVersion();
+        index->m_positions.resize(UNSPECIFIED + 1);
+        this->AddSubtreeToClassIdIndex(index.get());
+        doc->SetClassIdIndex(this, index);
+    }
+
+    // Merge the positions of the classes handled by the functor for keeping the processing order
+    std::vector<int> positions;
+    for (auto &classId : functor->m_classIds) {
+        const std::vector<int> &classIdPositions = index->m_positions.at(classId);
+        if (classIdPositions.empty()) continue;
+        std::vector<int> merged;
+        merged.reserve(positions.size() + classIdPositions.size());
+        std::merge(positions.begin(), positions.end(), classIdPositions.begin(), classIdPositions.end(),
+            std::back_inserter(merged));
+        positions.swap(merged);
+    }
+
+    int skipUntil = 0;
+    for (auto &position : positions) {
+        // The descendants of an object returning FUNCTOR_SIBLINGS are skipped
+        if (position < skipUntil) continue;
+        functor->Call(index->m_objects.at(position), functorParams);
+        if (functor->m_returnCode == FUNCTOR_STOP) {
+            break;
+        }
+        else if (functor->m_returnCode == FUNCTOR_SIBLINGS) {
+            functor->m_returnCode = FUNCTOR_CONTINUE;
+            skipUntil = index->m_subtreeEnds.at(position);
+        }
+    }
+    return true;
+}
+
+bool Object::IsProcessedFrom(Object *ancestor)
+{
+    Object *current = this;
+    while (current != ancestor) {
+        Object *parent = current->m_parent;
+        // Objects owned but not in the children (e.g., Layer staffDef clefs) are not processed
+        if (!parent || current->m_isOwnedObject) return false;
+        if (parent->IsHidden()) return false;
+        current = parent;
+    }
+    return true;
+}
+
+bool Object::IsHidden()
+{
+    if (this->IsEditorialElement()) {
+        EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(this);
+        assert(editorialElement);
+        return (editorialElement->m_visibility == Hidden);
+    }
+    else if (this->Is(MDIV)) {
+        Mdiv *mdiv = dynamic_cast<Mdiv *>(this);
+        assert(mdiv);
+        return (mdiv->m_visibility == Hidden);
+    }
+    else if (this->IsSystemElement()) {
+        SystemElement *systemElement = dynamic_cast<SystemElement *>(this);
+        assert(systemElement);
+        return (systemElement->m_visibility == Hidden);
+    }
+    return false;
 }
 
 void Object::AddChild(Object *child)
@@ -673,7 +998,8 @@ int Object::GetDescendantIndex(const Object *child, const ClassId classId, int d
 void Object::Modify(bool modified)
 {
     // if we have a parent and a new modification, propagate it
-    if (m_parent && modified) {
+    // Not for the aligners, which are filled by the layout and do not change the content of their parent
+    if (m_parent && modified && !m_isOutsideUuidIndex) {
         m_parent->Modify();
     }
     m_isModified = modified;
@@ -743,29 +1069,39 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
         return;
     }
 
+    // Functors declaring the classes they handle are called only on these objects
+    if (!functor->m_classIds.empty() && functor->m_visibleOnly && !endFunctor && (!filters || filters->empty())
+        && (deepness == UNLIMITED_DEPTH) && (direction == FORWARD)) {
+        if (this->ProcessClassIds(functor, functorParams)) return;
+    }
+
+    if (!filters || filters->empty()) {
+        this->ProcessWithFilters(functor, functorParams, endFunctor, NULL, deepness, direction);
+        return;
+    }
+
+    // Look up the comparison object for each object type (e.g., a Staff) once for the whole processing
+    // When there are several for the same type, the first one is used
+    ArrayOfClassIdComparisons classIdFilters(UNSPECIFIED + 1, NULL);
+    ArrayOfComparisons::reverse_iterator comparisonIter;
+    for (comparisonIter = filters->rbegin(); comparisonIter != filters->rend(); ++comparisonIter) {
+        ClassIdComparison *attComparison = dynamic_cast<ClassIdComparison *>(*comparisonIter);
+        assert(attComparison);
+        classIdFilters.at(attComparison->GetType()) = attComparison;
+    }
+    this->ProcessWithFilters(functor, functorParams, endFunctor, &classIdFilters, deepness, direction);
+}
+
+void Object::ProcessWithFilters(Functor *functor, FunctorParams *functorParams, Functor *endFunctor,
+    ArrayOfClassIdComparisons *classIdFilters, int deepness, bool direction)
+{
+    if (functor->m_returnCode == FUNCTOR_STOP) {
+        return;
+    }
+
     bool processChildren = true;
-    if (functor->m_visibleOnly) {
-        if (this->IsEditorialElement()) {
-            EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(this);
-            assert(editorialElement);
-            if (editorialElement->m_visibility == Hidden) {
-                processChildren = false;
-            }
-        }
-        else if (this->Is(MDIV)) {
-            Mdiv *mdiv = dynamic_cast<Mdiv *>(this);
-            assert(mdiv);
-            if (mdiv->m_visibility == Hidden) {
-                processChildren = false;
-            }
-        }
-        else if (this->IsSystemElement()) {
-            SystemElement *systemElement = dynamic_cast<SystemElement *>(this);
-            assert(systemElement);
-            if (systemElement->m_visibility == Hidden) {
-                processChildren = false;
-            }
-        }
+    if (functor->m_visibleOnly && this->IsHidden()) {
+        processChildren = false;
     }
 
     functor->Call(this, functorParams);
@@ -798,34 +1134,22 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
             children = &reversed;
         }
         for (iter = children->begin(); iter != children->end(); ++iter) {
-            if (filters && !filters->empty()) {
-                bool hasComparison = false;
-                // first we look if there is a comparison object for the object type (e.g., a Staff)
-                ArrayOfComparisons::iterator comparisonIter;
-                for (comparisonIter = filters->begin(); comparisonIter != filters->end(); ++comparisonIter) {
-                    // if yes, we will use it (*comparisonIter) for evaluating if the object matches
-                    // the attribute (see below)
-                    Object *o = *iter;
-                    ClassIdComparison *attComparison = dynamic_cast<ClassIdComparison *>(*comparisonIter);
-                    assert(attComparison);
-                    if (o->GetClassId() == attComparison->GetType()) {
-                        hasComparison = true;
-                        break;
-                    }
-                }
-                if (hasComparison) {
-                    // use the operator of the Comparison object to evaluate the attribute
-                    if ((**comparisonIter)(*iter)) {
+            if (classIdFilters) {
+                // if there is a comparison object for the object type, we use it for evaluating if the object
+                // matches the attribute
+                ClassIdComparison *attComparison = classIdFilters->at((*iter)->GetClassId());
+                if (attComparison) {
+                    if ((*attComparison)(*iter)) {
                         // the attribute value matches, process the object
-                        // LogDebug("%s ", (*iter)->GetClassName().c_str());
-                        (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
+                        (*iter)->ProcessWithFilters(
+                            functor, functorParams, endFunctor, classIdFilters, deepness, direction);
                     }
                     // continue to the next child
                     continue;
                 }
             }
             // we will end here if there is no filter at all or for the current child type
-            (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
+            (*iter)->ProcessWithFilters(functor, functorParams, endFunctor, classIdFilters, deepness, direction);
         }
     }
 
@@ -854,6 +1178,30 @@ void Object::ReorderByXPos()
     this->Process(&reorder, &params);
 }
 
+//----------------------------------------------------------------------------
+// ObjectUuidGenerator
+//----------------------------------------------------------------------------
+
+ObjectUuidGenerator::ObjectUuidGenerator(const Object *object, unsigned int salt)
+{
+    assert(object);
+
+    // FNV-1a over the uuid, which does not depend on the standard library as std::hash does
+    unsigned int seed = 2166136261u ^ salt;
+    for (char c : object->GetUuid()) {
+        seed = (seed ^ (unsigned char)c) * 16777619u;
+    }
+    m_generator.seed(seed);
+
+    m_previousGenerator = s_uuidGenerator;
+    s_uuidGenerator = &m_generator;
+}
+
+ObjectUuidGenerator::~ObjectUuidGenerator()
+{
+    s_uuidGenerator = m_previousGenerator;
+}
+
 //----------------------------------------------------------------------------
 // ObjectListInterface
 //----------------------------------------------------------------------------
@@ -1061,7 +1409,7 @@ int Object::FindByUuid(FunctorParams *functorParams)
         return FUNCTOR_STOP;
     }
 
-    if (params->m_uuid == this->GetUuid()) {
+    if (this->HasUuid(params->m_uuid)) {
         params->m_element = this;
         // LogDebug("Found it!");
         return FUNCTOR_STOP;
@@ -1257,6 +1605,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
             params->m_upcomingScoreDef->SetRedrawFlags(true, true, true, true, false);
             params->m_drawLabels = true;
         }
+        ObjectUuidGenerator uuidGenerator(page);
         page->m_drawingScoreDef = *params->m_upcomingScoreDef;
         return FUNCTOR_CONTINUE;
     }
@@ -1602,6 +1951,8 @@ int Object::ReorderByXPos(FunctorParams *functorParams)
     }
 
     std::stable_sort(this->m_children.begin(), this->m_children.end(), sortByUlx);
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->IncrementTreeVersion();
     this->Modify();
     return FUNCTOR_CONTINUE;
 }
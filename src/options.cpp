@@ -523,6 +523,11 @@ Options::Options()
     m_humType.Init(false);
     this->Register(&m_humType, "humType", &m_general);
 
+    m_humMeiRoundTrip.SetInfo(
+        "Humdrum MEI round trip", "Import Humdrum data through an intermediate MEI string (for debugging)");
+    m_humMeiRoundTrip.Init(false);
+    this->Register(&m_humMeiRoundTrip, "humMeiRoundTrip", &m_general);
+
     m_justifyIncludeLastPage.SetInfo("Justify including the last page", "Justify including the last page");
     m_justifyIncludeLastPage.Init(false);
     this->Register(&m_justifyIncludeLastPage, "justifyIncludeLastPage", &m_general);
@@ -601,10 +606,25 @@ Options::Options()
     m_pageWidth.Init(2100, 100, 60000, true);
     this->Register(&m_pageWidth, "pageWidth", &m_general);
 
+    m_progressiveCastOff.SetInfo("Progressive cast off",
+        "Cast off the pages progressively, only as far as the pages rendered, instead of all of them at once. "
+        "The horizontal layout and the cast off of the systems are still done for the whole score");
+    m_progressiveCastOff.Init(false);
+    this->Register(&m_progressiveCastOff, "progressiveCastOff", &m_general);
+
+    m_castOffThreads.SetInfo("Cast off threads",
+        "The number of threads aligning the measures when casting off the pages (0 for the hardware threads)");
+    m_castOffThreads.Init(1, 0, 256);
+    this->Register(&m_castOffThreads, "castOffThreads", &m_general);
+
     m_expand.SetInfo("Expand expansion", "Expand all referenced elements in the expansion <xml:id>");
     m_expand.Init("");
     this->Register(&m_expand, "expand", &m_general);
 
+    m_svgFormatRaw.SetInfo("Raw formatting for SVG output", "Writes the SVG without indentation and non-content newlines");
+    m_svgFormatRaw.Init(false);
+    this->Register(&m_svgFormatRaw, "svgFormatRaw", &m_general);
+
     m_svgBoundingBoxes.SetInfo("Svg bounding boxes viewbox on svg root", "Include bounding boxes in SVG output");
     m_svgBoundingBoxes.Init(false);
     this->Register(&m_svgBoundingBoxes, "svgBoundingBoxes", &m_general);
@@ -46,6 +46,8 @@ void Page::Reset()
 
     m_drawingScoreDef.Reset();
     m_layoutDone = false;
+    m_horizontalLayoutDone = false;
+    m_withoutRunningElements = false;
     this->ResetUuid();
 
     // by default we have no values and use the document ones
@@ -60,6 +62,8 @@ void Page::Reset()
     m_drawingJustifiableHeight = 0;
     m_drawingJustifiableSystems = 0;
     m_drawingJustifiableStaves = 0;
+    m_drawingHeaderHeight = 0;
+    m_drawingFooterHeight = 0;
 }
 
 void Page::AddChild(Object *child)
@@ -79,6 +83,8 @@ void Page::AddChild(Object *child)
 
 RunningElement *Page::GetHeader() const
 {
+    if (m_withoutRunningElements) return NULL;
+
     Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
     if (!doc || (doc->GetOptions()->m_header.GetValue() == HEADER_none)) {
         return NULL;
@@ -98,6 +104,8 @@ RunningElement *Page::GetHeader() const
 
 RunningElement *Page::GetFooter() const
 {
+    if (m_withoutRunningElements) return NULL;
+
     Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
     if (!doc || (doc->GetOptions()->m_footer.GetValue() == FOOTER_none)) {
         return NULL;
@@ -118,29 +126,101 @@ RunningElement *Page::GetFooter() const
 void Page::LayOut(bool force)
 {
     if (m_layoutDone && !force) {
-        // We only need to reset the header - this will adjust the page number if necessary
-        if (this->GetHeader()) this->GetHeader()->SetDrawingPage(this);
-        if (this->GetFooter()) this->GetFooter()->SetDrawingPage(this);
+        // We only need to lay out the running elements again - this will adjust the page number if necessary
+        this->LayOutRunningElements();
         return;
     }
 
+    if (!m_horizontalLayoutDone || force) {
+        this->LayOutHorizontally();
+        this->JustifyHorizontally();
+    }
+    this->LayOutVertically();
+    this->JustifyVertically();
+
+    // The bounding boxes for the SVG output are filled when rendering (see Toolkit::RenderToSvgDeviceContext)
+
+    m_layoutDone = true;
+}
+
+void Page::LayOutHorizontallyAhead()
+{
     this->LayOutHorizontally();
     this->JustifyHorizontally();
+
+    m_horizontalLayoutDone = true;
+    // The vertical layout depends on the horizontal one
+    m_layoutDone = false;
+}
+
+void Page::LayOutAhead()
+{
+    this->LayOutHorizontallyAhead();
+
+    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    assert(doc);
+
+    // The justification of the last page can require the layout of the previous one
+    Pages *pages = doc->GetPages();
+    assert(pages);
+    if (pages->GetLast() == this) return;
+
+    m_withoutRunningElements = true;
     this->LayOutVertically();
     this->JustifyVertically();
+    m_withoutRunningElements = false;
+
+    m_layoutDone = true;
+}
 
+void Page::LayOutRunningElements()
+{
     Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
-    if (doc->GetOptions()->m_svgBoundingBoxes.GetValue()) {
-        View view;
-        view.SetDoc(doc);
-        BBoxDeviceContext bBoxDC(&view, 0, 0);
-        // Do not do the layout in this view - otherwise we will loop...
-        view.SetPage(this->GetIdx(), false);
-        view.DrawCurrentPage(&bBoxDC, false);
+
+    // Doc::SetDrawingPage should have been called before
+    // Make sure we have the correct page
+    assert(this == doc->GetDrawingPage());
+
+    RunningElement *header = this->GetHeader();
+    RunningElement *footer = this->GetFooter();
+    m_drawingHeaderHeight = 0;
+    m_drawingFooterHeight = 0;
+    if (!header && !footer) return;
+
+    // The steps of LayOutVertically (see Page::ResetVerticalAlignment and Page::AlignVerticallyEnd)
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    Functor alignVertically(&Object::AlignVertically);
+    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd);
+    AlignVerticallyParams alignVerticallyParams(doc, &alignVertically, &alignVerticallyEnd);
+    for (RunningElement *runningElement : { header, footer }) {
+        if (!runningElement) continue;
+        runningElement->Process(&resetVerticalAlignment, NULL);
+        runningElement->SetDrawingPage(this);
+        runningElement->SetDrawingYRel(0);
+        runningElement->Process(&alignVertically, &alignVerticallyParams, &alignVerticallyEnd);
     }
 
-    m_layoutDone = true;
+    // Render them for filling the bounding box
+    // The objects created for it are not numbered by the generator of the document, which depends on the thread
+    ObjectUuidGenerator uuidGenerator(this);
+    View view;
+    BBoxDeviceContext bBoxDC(&view, 0, 0);
+    view.SetDoc(doc);
+    view.SetPage(this->GetIdx(), false);
+    view.DrawCurrentPageRunningElements(&bBoxDC);
+
+    // See Page::AlignSystems
+    if (header) {
+        header->AdjustRunningElementYPos();
+        header->SetDrawingYRel(doc->m_drawingPageHeight);
+        m_drawingHeaderHeight = header->GetTotalHeight();
+    }
+    if (footer) {
+        footer->AdjustRunningElementYPos();
+        m_drawingFooterHeight = footer->GetTotalHeight();
+        footer->SetDrawingYRel(m_drawingFooterHeight + doc->m_drawingPageMarginTop + doc->m_drawingPageMarginBot);
+    }
 }
 
 void Page::LayOutTranscription(bool force)
@@ -187,17 +267,22 @@ void Page::LayOutTranscription(bool force)
 
     CalcStemParams calcStemParams(doc);
     Functor calcStem(&Object::CalcStem);
+    calcStem.m_classIds = { STAFF, BEAM, CHORD, FTREM, NOTE, STEM };
     this->Process(&calcStem, &calcStemParams);
 
     FunctorDocParams calcChordNoteHeadsParams(doc);
     Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+    calcChordNoteHeads.m_classIds = { NOTE };
     this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
 
     CalcDotsParams calcDotsParams(doc);
     Functor calcDots(&Object::CalcDots);
+    calcDots.m_classIds = { CHORD, NOTE, REST };
     this->Process(&calcDots, &calcDotsParams);
 
     // Render it for filling the bounding box
+    // The objects created for it are not numbered by the generator of the document, which depends on the thread
+    ObjectUuidGenerator uuidGenerator(this);
     View view;
     view.SetDoc(doc);
     BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
@@ -210,12 +295,19 @@ void Page::LayOutTranscription(bool force)
 
     FunctorDocParams calcLegerLinesParams(doc);
     Functor calcLedgerLines(&Object::CalcLedgerLines);
+    calcLedgerLines.m_classIds = { NOTE };
     this->Process(&calcLedgerLines, &calcLegerLinesParams);
 
     m_layoutDone = true;
 }
 
 void Page::LayOutHorizontally()
+{
+    this->AlignMeasureContentHorizontally();
+    this->AdjustMeasuresHorizontally();
+}
+
+void Page::AlignMeasureContentHorizontally()
 {
     Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
@@ -279,17 +371,22 @@ void Page::LayOutHorizontally()
 
     CalcStemParams calcStemParams(doc);
     Functor calcStem(&Object::CalcStem);
+    calcStem.m_classIds = { STAFF, BEAM, CHORD, FTREM, NOTE, STEM };
     this->Process(&calcStem, &calcStemParams);
 
     FunctorDocParams calcChordNoteHeadsParams(doc);
     Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+    calcChordNoteHeads.m_classIds = { NOTE };
     this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
 
     CalcDotsParams calcDotsParams(doc);
     Functor calcDots(&Object::CalcDots);
+    calcDots.m_classIds = { CHORD, NOTE, REST };
     this->Process(&calcDots, &calcDotsParams);
 
     // Render it for filling the bounding box
+    // The objects created for it are not numbered by the generator of the document, which depends on the thread
+    ObjectUuidGenerator uuidGenerator(this);
     View view;
     view.SetDoc(doc);
     BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
@@ -304,9 +401,12 @@ void Page::LayOutHorizontally()
     this->Process(&adjustLayers, &adjustLayersParams);
 
     // Adjust the X position of the accidentals, including in chords
+    // Only the measures are processed in the page, they process their aligner with adjustAccidX
     Functor adjustAccidX(&Object::AdjustAccidX);
+    Functor adjustAccidXMeasures(&Object::AdjustAccidX);
+    adjustAccidXMeasures.m_classIds = { MEASURE };
     AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
-    this->Process(&adjustAccidX, &adjustAccidXParams);
+    this->Process(&adjustAccidXMeasures, &adjustAccidXParams);
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
@@ -322,6 +422,12 @@ void Page::LayOutHorizontally()
     AdjustGraceXPosParams adjustGraceXPosParams(
         doc, &adjustGraceXPos, &adjustGraceXPosEnd, doc->m_scoreDef.GetStaffNs());
     this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+}
+
+void Page::AdjustMeasuresHorizontally()
+{
+    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    assert(doc);
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
@@ -345,6 +451,7 @@ void Page::LayOutHorizontally()
     // Adjust the position of the tuplets
     FunctorDocParams adjustTupletsXParams(doc);
     Functor adjustTupletsX(&Object::AdjustTupletsX);
+    adjustTupletsX.m_classIds = { TUPLET };
     this->Process(&adjustTupletsX, &adjustTupletsXParams);
 
     // Prevent a margin overflow
@@ -375,6 +482,7 @@ void Page::LayOutVertically()
 
     FunctorDocParams calcLegerLinesParams(doc);
     Functor calcLedgerLines(&Object::CalcLedgerLines);
+    calcLedgerLines.m_classIds = { NOTE };
     this->Process(&calcLedgerLines, &calcLegerLinesParams);
 
     // Align the content of the page using system aligners
@@ -388,9 +496,12 @@ void Page::LayOutVertically()
     // Adjust the position of outside articulations
     FunctorDocParams calcArticParams(doc);
     Functor calcArtic(&Object::CalcArtic);
+    calcArtic.m_classIds = { ARTIC };
     this->Process(&calcArtic, &calcArticParams);
 
     // Render it for filling the bounding box
+    // The objects created for it are not numbered by the generator of the document, which depends on the thread
+    ObjectUuidGenerator uuidGenerator(this);
     View view;
     BBoxDeviceContext bBoxDC(&view, 0, 0);
     view.SetDoc(doc);
@@ -401,11 +512,13 @@ void Page::LayOutVertically()
     // Adjust the position of outside articulations with slurs end and start positions
     FunctorDocParams adjustArticWithSlursParams(doc);
     Functor adjustArticWithSlurs(&Object::AdjustArticWithSlurs);
+    adjustArticWithSlurs.m_classIds = { ARTIC_PART };
     this->Process(&adjustArticWithSlurs, &adjustArticWithSlursParams);
 
     // Adjust the position of the tuplets
     FunctorDocParams adjustTupletsYParams(doc);
     Functor adjustTupletsY(&Object::AdjustTupletsY);
+    adjustTupletsY.m_classIds = { TUPLET };
     this->Process(&adjustTupletsY, &adjustTupletsYParams);
 
     // Adjust the position of the slurs
@@ -552,6 +665,7 @@ void Page::LayOutPitchPos()
 
     CalcStemParams calcStemParams(doc);
     Functor calcStem(&Object::CalcStem);
+    calcStem.m_classIds = { STAFF, BEAM, CHORD, FTREM, NOTE, STEM };
     this->Process(&calcStem, &calcStemParams);
 }
 
@@ -691,6 +805,15 @@ int Page::ResetVerticalAlignment(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Page::ResetDrawing(FunctorParams *functorParams)
+{
+    // The layout needs to be done again once the drawing is prepared again
+    m_layoutDone = false;
+    m_horizontalLayoutDone = false;
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Page::AlignVerticallyEnd(FunctorParams *functorParams)
 {
     AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
@@ -730,6 +853,10 @@ int Page::AlignSystems(FunctorParams *functorParams)
         header->SetDrawingYRel(params->m_shift);
         params->m_shift -= header->GetTotalHeight();
     }
+    // The running elements are laid out separately (see Page::LayOutAhead)
+    else if (m_withoutRunningElements) {
+        params->m_shift -= m_drawingHeaderHeight;
+    }
     RunningElement *footer = this->GetFooter();
     if (footer) {
         // We add twice the top margin, once for the origin moved at the top and one for the bottom margin
@@ -754,6 +881,9 @@ int Page::AlignSystemsEnd(FunctorParams *functorParams)
     if (footer) {
         this->m_drawingJustifiableHeight -= footer->GetTotalHeight();
     }
+    else if (m_withoutRunningElements) {
+        this->m_drawingJustifiableHeight -= m_drawingFooterHeight;
+    }
 
     return FUNCTOR_CONTINUE;
 }
@@ -68,15 +68,19 @@ int Pedal::GenerateMIDI(FunctorParams *functorParams)
     double starttime = params->m_totalTime + pedalTime;
     int tpq = params->m_midiFile->getTPQ();
 
+    // The pedal is not attached to a layer, so it goes to every staff/layer buffer
     // todo: check pedal @func to switch between sustain/soften/damper pedals?
-    switch (GetDir()) {
-        case pedalLog_DIR_down:
-            params->m_midiFile->addSustainPedalOn(params->m_midiTrack, (starttime * tpq), params->m_midiChannel);
-            break;
-        case pedalLog_DIR_up:
-            params->m_midiFile->addSustainPedalOff(params->m_midiTrack, (starttime * tpq), params->m_midiChannel);
-            break;
-        default: return FUNCTOR_CONTINUE;
+    for (auto &layerBuffer : params->m_layerBuffers) {
+        MIDILayerBuffer &buffer = layerBuffer.second;
+        switch (GetDir()) {
+            case pedalLog_DIR_down:
+                buffer.m_midiFile->addSustainPedalOn(buffer.m_midiTrack, (starttime * tpq), buffer.m_midiChannel);
+                break;
+            case pedalLog_DIR_up:
+                buffer.m_midiFile->addSustainPedalOff(buffer.m_midiTrack, (starttime * tpq), buffer.m_midiChannel);
+                break;
+            default: return FUNCTOR_CONTINUE;
+        }
     }
 
     return FUNCTOR_CONTINUE;
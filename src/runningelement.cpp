@@ -39,7 +39,7 @@ RunningElement::RunningElement() : Object("re"), ObjectListInterface(), AttHoriz
     Reset();
 }
 
-RunningElement::RunningElement(std::string classid) : Object(classid), AttHorizontalAlign(), AttTyped()
+RunningElement::RunningElement(const char *classid) : Object(classid), AttHorizontalAlign(), AttTyped()
 {
     RegisterAttClass(ATT_HORIZONTALALIGN);
     RegisterAttClass(ATT_TYPED);
@@ -345,12 +345,14 @@ void RunningElement::SetCurrentPageNum(Page *currentPage)
     currentText->SetText(UTF8to16(StringFormat("%d", currentNum)));
 }
 
-void RunningElement::LoadFooter()
+void RunningElement::LoadFooter(const Doc *doc)
 {
+    assert(doc);
+
     Fig *fig = new Fig();
     Svg *svg = new Svg();
 
-    std::string footer = Resources::GetPath() + "/footer.svg";
+    std::string footer = doc->GetResources().GetPath() + "/footer.svg";
     pugi::xml_document footerDoc;
     footerDoc.load_file(footer.c_str());
     svg->Set(footerDoc.first_child());
@@ -29,10 +29,30 @@ namespace vrv {
 #define space " "
 #define semicolon ";"
 
+//----------------------------------------------------------------------------
+// SvgStringWriter
+//----------------------------------------------------------------------------
+
+/**
+ * A pugixml writer appending to a string, avoiding the copy of an intermediate std::ostringstream.
+ */
+class SvgStringWriter : public pugi::xml_writer {
+public:
+    SvgStringWriter(std::string &output) : m_output(output) {}
+
+    virtual void write(const void *data, size_t size) { m_output.append(static_cast<const char *>(data), size); }
+
+private:
+    std::string &m_output;
+};
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
 
+std::map<std::string, pugi::xml_document> SvgDeviceContext::s_glyphDefs;
+std::mutex SvgDeviceContext::s_glyphDefsMutex;
+
 SvgDeviceContext::SvgDeviceContext() : DeviceContext()
 {
     m_originX = 0;
@@ -42,13 +62,14 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext()
     SetPen(AxNONE, 1, AxSOLID);
 
     m_smuflGlyphs.clear();
+    m_smuflGlyphSet.clear();
 
-    m_committed = false;
     m_vrvTextFont = false;
 
     m_mmOutput = false;
     m_svgBoundingBoxes = false;
     m_svgViewBox = false;
+    m_formatRaw = false;
     m_facsimile = false;
 
     // create the initial SVG element
@@ -62,8 +83,6 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext()
     // start the stack
     m_svgNodeStack.push_back(m_svgNode);
     m_currentNode = m_svgNode;
-
-    m_outdata.clear();
 }
 
 SvgDeviceContext::~SvgDeviceContext() {}
@@ -76,11 +95,18 @@ bool SvgDeviceContext::CopyFileToStream(const std::string &filename, std::ostrea
     return true;
 }
 
-void SvgDeviceContext::Commit(bool xml_declaration)
+void SvgDeviceContext::Commit(pugi::xml_writer &writer, bool xml_declaration)
 {
+    // The header, the <defs> and the woff font are known only once the page is drawn. Instead of prepending them to
+    // the document and saving it, they are written directly to the writer, followed by the content of the page
+    const char *indent = (m_formatRaw) ? "" : "\t";
+    const char *newline = (m_formatRaw) ? "" : "\n";
+    unsigned int flags = (m_formatRaw) ? pugi::format_raw : pugi::format_indent;
 
-    if (m_committed) {
-        return;
+    std::string header;
+    if (xml_declaration) {
+        header += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>";
+        header += newline;
     }
 
     // take care of width/height once userScale is updated
@@ -94,61 +120,125 @@ void SvgDeviceContext::Commit(bool xml_declaration)
         format = "%gmm";
     }
 
+    header += "<svg";
     if (m_svgViewBox) {
-        m_svgNode.prepend_attribute("viewBox") = StringFormat("0 0 %g %g", width, height).c_str();
+        header += " viewBox=\"" + StringFormat("0 0 %g %g", width, height) + "\"";
     }
     else {
-        m_svgNode.prepend_attribute("height") = StringFormat(format, height).c_str();
-        m_svgNode.prepend_attribute("width") = StringFormat(format, width).c_str();
+        header += " width=\"" + StringFormat(format, width) + "\"";
+        header += " height=\"" + StringFormat(format, height) + "\"";
+    }
+    header += this->GetAttributes(m_svgNode);
+    header += ">";
+    header += newline;
+
+    // add description statement
+    header += indent;
+    header += "<desc>" + StringFormat("Engraved by Verovio %s", GetVersion().c_str()) + "</desc>";
+    header += newline;
+    writer.write(header.c_str(), header.size());
+
+    // header
+    if (m_smuflGlyphs.size() > 0) {
+        std::string defs = std::string(indent) + "<defs>" + newline;
+        writer.write(defs.c_str(), defs.size());
+
+        // for each needed glyph print the cached nodes without copying them into the document
+        std::vector<const Glyph *>::const_iterator it;
+        for (it = m_smuflGlyphs.begin(); it != m_smuflGlyphs.end(); ++it) {
+            const pugi::xml_document &sourceDoc = GetGlyphDef(*it);
+            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+                child.print(writer, "\t", flags, pugi::encoding_auto, 2);
+            }
+        }
+
+        defs = std::string(indent) + "</defs>" + newline;
+        writer.write(defs.c_str(), defs.size());
     }
 
     // add the woff VerovioText font if needed
     if (m_vrvTextFont) {
-        std::string woff = Resources::GetPath() + "/woff.xml";
+        assert(m_resources);
+        std::string woff = m_resources->GetPath() + "/woff.xml";
         pugi::xml_document woffDoc;
         woffDoc.load_file(woff.c_str());
-        m_svgNode.prepend_copy(woffDoc.first_child());
+        woffDoc.first_child().print(writer, "\t", flags, pugi::encoding_auto, 1);
     }
 
-    // header
-    if (m_smuflGlyphs.size() > 0) {
+    // the content of the page, streamed when drawing it
+    writer.write(m_body.c_str(), m_body.size());
 
-        pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
+    // anything drawn outside a page
+    for (pugi::xml_node child = m_svgNode.first_child(); child; child = child.next_sibling()) {
+        child.print(writer, "\t", flags, pugi::encoding_auto, 1);
+    }
 
-        // for each needed glyph
-        std::vector<std::string>::const_iterator it;
-        for (it = m_smuflGlyphs.begin(); it != m_smuflGlyphs.end(); ++it) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source((*it).c_str());
-            sourceDoc.load(source);
+    std::string footer = std::string("</svg>") + newline;
+    writer.write(footer.c_str(), footer.size());
+}
 
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                defs.append_copy(child);
-            }
-        }
+std::string SvgDeviceContext::GetAttributes(pugi::xml_node node)
+{
+    std::string attributes;
+    for (pugi::xml_attribute attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        attributes += " " + std::string(attr.name()) + "=\"" + attr.value() + "\"";
     }
+    return attributes;
+}
 
-    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
-    if (xml_declaration) {
-        // edit the xml declaration
-        output_flags = pugi::format_default;
-        pugi::xml_node decl = m_svgDoc.prepend_child(pugi::node_declaration);
-        decl.append_attribute("version") = "1.0";
-        decl.append_attribute("encoding") = "UTF-8";
-        decl.append_attribute("standalone") = "no";
+void SvgDeviceContext::WriteStartTag(pugi::xml_node node, int depth)
+{
+    if (!m_formatRaw) m_body.append(depth, '\t');
+    m_body += "<" + std::string(node.name()) + this->GetAttributes(node) + ">";
+    if (!m_formatRaw) m_body += "\n";
+}
+
+void SvgDeviceContext::WriteEndTag(pugi::xml_node node, int depth)
+{
+    if (!m_formatRaw) m_body.append(depth, '\t');
+    m_body += "</" + std::string(node.name()) + ">";
+    if (!m_formatRaw) m_body += "\n";
+}
+
+void SvgDeviceContext::WriteNode(pugi::xml_node node, int depth)
+{
+    SvgStringWriter writer(m_body);
+    node.print(writer, "\t", (m_formatRaw) ? pugi::format_raw : pugi::format_indent, pugi::encoding_auto, depth);
+}
+
+void SvgDeviceContext::FlushPageNode()
+{
+    // Keep the page in the DOM for redrawing the bounding boxes of resumed graphics
+    if (m_svgBoundingBoxes) return;
+    if (m_currentNode != m_pageNode) return;
+
+    // The children are complete since no graphic is open in the page
+    while (pugi::xml_node child = m_pageNode.first_child()) {
+        this->WriteNode(child, 3);
+        m_pageNode.remove_child(child);
     }
+}
 
-    // add description statement
-    pugi::xml_node desc = m_svgNode.prepend_child("desc");
-    desc.append_child(pugi::node_pcdata)
-        .set_value(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
+const pugi::xml_document &SvgDeviceContext::GetGlyphDef(const Glyph *glyph)
+{
+    assert(glyph);
+
+    std::lock_guard<std::mutex> lock(s_glyphDefsMutex);
 
-    // save the glyph data to m_outdata
-    m_svgDoc.save(m_outdata, "\t", output_flags);
+    std::map<std::string, pugi::xml_document>::iterator iter = s_glyphDefs.find(glyph->GetPath());
+    if (iter != s_glyphDefs.end()) return iter->second;
 
-    m_committed = true;
+    // load the XML of the glyph (from the font bundle or from its file) as a pugi::xml_document
+    // the document is never modified afterwards so it can be read without the lock
+    pugi::xml_document &sourceDoc = s_glyphDefs[glyph->GetPath()];
+    if (!glyph->GetXML().empty()) {
+        sourceDoc.load_string(glyph->GetXML().c_str());
+    }
+    else {
+        std::ifstream source(glyph->GetPath().c_str());
+        sourceDoc.load(source);
+    }
+    return sourceDoc;
 }
 
 void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::string gId, bool prepend)
@@ -352,18 +442,35 @@ void SvgDeviceContext::EndGraphic(Object *object, View *view)
     DrawSvgBoundingBox(object, view);
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+    this->FlushPageNode();
 }
 
 void SvgDeviceContext::EndCustomGraphic()
 {
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+    this->FlushPageNode();
 }
 
 void SvgDeviceContext::EndResumedGraphic(Object *object, View *view)
 {
+    // The bounding box of the object can have been extended by the resumed graphic, so we need to redraw it
+    if (m_svgBoundingBoxes && view) {
+        std::map<Object *, pugi::xml_node>::iterator iter = m_svgBoundingBoxNodes.find(object);
+        if ((iter != m_svgBoundingBoxNodes.end()) && (iter->second.parent() == m_currentNode)) {
+            pugi::xml_node previousNode = iter->second;
+            DrawSvgBoundingBox(object, view);
+            // Keep it in place of the previous one since the drawing primitives are inserted before it
+            pugi::xml_node node = m_svgBoundingBoxNodes.at(object);
+            if (node != previousNode) {
+                m_currentNode.insert_move_before(node, previousNode);
+                m_currentNode.remove_child(previousNode);
+            }
+        }
+    }
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+    this->FlushPageNode();
 }
 
 void SvgDeviceContext::EndTextGraphic(Object *object, View *view)
@@ -371,6 +478,7 @@ void SvgDeviceContext::EndTextGraphic(Object *object, View *view)
     DrawSvgBoundingBox(object, view);
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+    this->FlushPageNode();
 }
 
 void SvgDeviceContext::RotateGraphic(Point const &orig, double angle)
@@ -397,6 +505,8 @@ void SvgDeviceContext::StartPage()
                        //"g.content-bounding-box{stroke:blue; stroke-width:10} "
                        "g.tempo{font-weight:bold;} g.dir, g.dynam, "
                        "g.mNum{font-style:italic;} g.label{font-weight:normal;}");
+        this->WriteNode(m_currentNode, 1);
+        m_svgNode.remove_child(m_currentNode);
         m_currentNode = m_svgNodeStack.back();
     }
 
@@ -421,10 +531,16 @@ void SvgDeviceContext::StartPage()
         = StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)).c_str();
 
     m_pageNode = m_currentNode;
+
+    // the content of the page is streamed to m_body as soon as its top-level graphics are complete
+    this->WriteStartTag(m_pageNode.parent(), 1);
+    this->WriteStartTag(m_pageNode, 2);
 }
 
 void SvgDeviceContext::EndPage()
 {
+    m_svgBoundingBoxNodes.clear();
+
     // end page-margin
     m_svgNodeStack.pop_back();
     // end definition-scale
@@ -432,6 +548,15 @@ void SvgDeviceContext::EndPage()
     // end page-scale
     // m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+
+    // write what is left in the page, including everything when drawing bounding boxes
+    for (pugi::xml_node child = m_pageNode.first_child(); child; child = child.next_sibling()) {
+        this->WriteNode(child, 3);
+    }
+    this->WriteEndTag(m_pageNode, 2);
+    this->WriteEndTag(m_pageNode.parent(), 1);
+    m_svgNode.remove_child(m_pageNode.parent());
+    m_pageNode = pugi::xml_node();
 }
 
 void SvgDeviceContext::SetBackground(int colour, int style)
@@ -819,23 +944,21 @@ void SvgDeviceContext::DrawRotatedText(const std::string &text, int x, int y, do
 void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bool setSmuflGlyph)
 {
     assert(m_fontStack.top());
+    assert(m_resources);
 
     int w, h, gx, gy;
 
     // print chars one by one
     for (unsigned int i = 0; i < text.length(); ++i) {
         wchar_t c = text.at(i);
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
 
-        std::string path = glyph->GetPath();
-
         // Add the glyph to the array for the <defs>
-        std::vector<std::string>::const_iterator it = std::find(m_smuflGlyphs.begin(), m_smuflGlyphs.end(), path);
-        if (it == m_smuflGlyphs.end()) {
-            m_smuflGlyphs.push_back(path);
+        if (m_smuflGlyphSet.insert(glyph).second) {
+            m_smuflGlyphs.push_back(glyph);
         }
 
         // Write the char in the SVG
@@ -904,9 +1027,17 @@ std::string SvgDeviceContext::GetColour(int colour)
 
 std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
-    if (!m_committed) Commit(xml_declaration);
+    std::string output;
+    SvgStringWriter writer(output);
+    Commit(writer, xml_declaration);
 
-    return m_outdata.str();
+    return output;
+}
+
+void SvgDeviceContext::WriteSVG(std::ostream &output, bool xml_declaration)
+{
+    pugi::xml_writer_stream writer(output);
+    Commit(writer, xml_declaration);
 }
 
 void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int height)
@@ -956,6 +1087,7 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
         }
 
         StartGraphic(object, "bounding-box", "bbox-" + object->GetUuid(), true);
+        m_svgBoundingBoxNodes[object] = m_currentNode;
 
         if (box->HasSelfBB()) {
             this->DrawSvgBoundingBoxRectangle(view->ToDeviceContextX(object->GetDrawingX() + box->GetSelfX1()),
@@ -972,7 +1104,7 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
 
             for (iter = anchors.begin(); iter != anchors.end(); ++iter) {
                 if (object->GetBoundingBoxGlyph() != 0) {
-                    Glyph *glyph = Resources::GetGlyph(object->GetBoundingBoxGlyph());
+                    const Glyph *glyph = m_resources->GetGlyph(object->GetBoundingBoxGlyph());
                     assert(glyph);
 
                     if (glyph->HasAnchor(*iter)) {
@@ -64,6 +64,7 @@ void System::Reset()
     ResetTyped();
 
     if (m_drawingScoreDef) {
+        this->UnregisterOwnedObject(m_drawingScoreDef);
         delete m_drawingScoreDef;
         m_drawingScoreDef = NULL;
     }
@@ -176,9 +177,16 @@ void System::SetDrawingScoreDef(ScoreDef *drawingScoreDef)
 {
     assert(!m_drawingScoreDef); // We should always call UnsetCurrentScoreDef before
 
+    // The copy can be made in a layout thread
+    ObjectUuidGenerator uuidGenerator(this);
     m_drawingScoreDef = new ScoreDef();
     *m_drawingScoreDef = *drawingScoreDef;
-    m_drawingScoreDef->SetParent(this);
+    this->RegisterOwnedObject(m_drawingScoreDef);
+}
+
+void System::GetOwnedObjects(ArrayOfObjects *objects)
+{
+    if (m_drawingScoreDef) objects->push_back(m_drawingScoreDef);
 }
 
 bool System::HasMixedDrawingStemDir(LayerElement *start, LayerElement *end)
@@ -263,6 +271,7 @@ void System::AddToDrawingListIfNeccessary(Object *object)
 int System::UnsetCurrentScoreDef(FunctorParams *functorParams)
 {
     if (m_drawingScoreDef) {
+        this->UnregisterOwnedObject(m_drawingScoreDef);
         delete m_drawingScoreDef;
         m_drawingScoreDef = NULL;
     }
@@ -774,7 +783,13 @@ int System::CastOffPages(FunctorParams *functorParams)
         // Use VRV_UNSET value as a flag
         params->m_pgHeadHeight = VRV_UNSET;
         assert(params->m_doc->GetPages());
-        params->m_doc->GetPages()->AddChild(params->m_currentPage);
+        // With a progressive cast-off, the page goes before the pending one (see Doc::CastOffPendingPages)
+        if (params->m_pendingPage) {
+            params->m_doc->GetPages()->InsertBefore(params->m_pendingPage, params->m_currentPage);
+        }
+        else {
+            params->m_doc->GetPages()->AddChild(params->m_currentPage);
+        }
         params->m_shift = this->m_drawingYRel - params->m_pageHeight;
     }
 
@@ -798,6 +813,8 @@ int System::UnCastOff(FunctorParams *functorParams)
     // Use the MoveChildrenFrom method that moves and relinquishes them
     // See Object::Relinquish
     params->m_currentSystem->MoveChildrenFrom(this);
+    // Also keep the staff alignments for the systems cast off from it (see Doc::CastOffDoc)
+    params->m_currentSystem->m_systemAligner.ReuseAlignmentsFrom(&m_systemAligner);
 
     return FUNCTOR_CONTINUE;
 }
@@ -0,0 +1,323 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        teedevicecontext.cpp
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "teedevicecontext.h"
+
+//----------------------------------------------------------------------------
+
+#include <assert.h>
+
+//----------------------------------------------------------------------------
+
+#include "vrv.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// TeeDeviceContext
+//----------------------------------------------------------------------------
+
+TeeDeviceContext::TeeDeviceContext() : DeviceContext() {}
+
+TeeDeviceContext::~TeeDeviceContext() {}
+
+void TeeDeviceContext::AddDeviceContext(DeviceContext *deviceContext)
+{
+    assert(deviceContext);
+    assert(deviceContext != this);
+
+    m_deviceContexts.push_back(deviceContext);
+}
+
+void TeeDeviceContext::SetWidth(int width)
+{
+    DeviceContext::SetWidth(width);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetWidth(width);
+}
+
+void TeeDeviceContext::SetHeight(int height)
+{
+    DeviceContext::SetHeight(height);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetHeight(height);
+}
+
+void TeeDeviceContext::SetUserScale(double scaleX, double scaleY)
+{
+    DeviceContext::SetUserScale(scaleX, scaleY);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetUserScale(scaleX, scaleY);
+}
+
+void TeeDeviceContext::SetResources(const Resources *resources)
+{
+    // Also set for the tee itself since the text extends are calculated with the DeviceContext methods
+    DeviceContext::SetResources(resources);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetResources(resources);
+}
+
+void TeeDeviceContext::SetBrush(int colour, int opacity)
+{
+    DeviceContext::SetBrush(colour, opacity);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetBrush(colour, opacity);
+}
+
+void TeeDeviceContext::SetPen(int colour, int width, int opacity, int dashLength, int lineCap)
+{
+    DeviceContext::SetPen(colour, width, opacity, dashLength, lineCap);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetPen(colour, width, opacity, dashLength, lineCap);
+}
+
+void TeeDeviceContext::SetFont(FontInfo *font)
+{
+    DeviceContext::SetFont(font);
+    for (DeviceContext *dc : m_deviceContexts) dc->SetFont(font);
+}
+
+void TeeDeviceContext::ResetBrush()
+{
+    DeviceContext::ResetBrush();
+    for (DeviceContext *dc : m_deviceContexts) dc->ResetBrush();
+}
+
+void TeeDeviceContext::ResetPen()
+{
+    DeviceContext::ResetPen();
+    for (DeviceContext *dc : m_deviceContexts) dc->ResetPen();
+}
+
+void TeeDeviceContext::ResetFont()
+{
+    DeviceContext::ResetFont();
+    for (DeviceContext *dc : m_deviceContexts) dc->ResetFont();
+}
+
+void TeeDeviceContext::SetBackground(int colour, int style)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->SetBackground(colour, style);
+}
+
+void TeeDeviceContext::SetBackgroundImage(void *image, double opacity)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->SetBackgroundImage(image, opacity);
+}
+
+void TeeDeviceContext::SetBackgroundMode(int mode)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->SetBackgroundMode(mode);
+}
+
+void TeeDeviceContext::SetTextForeground(int colour)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->SetTextForeground(colour);
+}
+
+void TeeDeviceContext::SetTextBackground(int colour)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->SetTextBackground(colour);
+}
+
+void TeeDeviceContext::SetLogicalOrigin(int x, int y)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->SetLogicalOrigin(x, y);
+}
+
+Point TeeDeviceContext::GetLogicalOrigin()
+{
+    if (m_deviceContexts.empty()) return Point(0, 0);
+
+    return m_deviceContexts.front()->GetLogicalOrigin();
+}
+
+void TeeDeviceContext::DrawSimpleBezierPath(Point bezier[4])
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawSimpleBezierPath(bezier);
+}
+
+void TeeDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawComplexBezierPath(bezier1, bezier2);
+}
+
+void TeeDeviceContext::DrawCircle(int x, int y, int radius)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawCircle(x, y, radius);
+}
+
+void TeeDeviceContext::DrawEllipse(int x, int y, int width, int height)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawEllipse(x, y, width, height);
+}
+
+void TeeDeviceContext::DrawEllipticArc(int x, int y, int width, int height, double start, double end)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawEllipticArc(x, y, width, height, start, end);
+}
+
+void TeeDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawLine(x1, y1, x2, y2);
+}
+
+void TeeDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffset, int fillStyle)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawPolygon(n, points, xOffset, yOffset, fillStyle);
+}
+
+void TeeDeviceContext::DrawRectangle(int x, int y, int width, int height)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawRectangle(x, y, width, height);
+}
+
+void TeeDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawRotatedText(text, x, y, angle);
+}
+
+void TeeDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height, double radius)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawRoundedRectangle(x, y, width, height, radius);
+}
+
+void TeeDeviceContext::DrawText(const std::string &text, const std::wstring wtext, int x, int y)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawText(text, wtext, x, y);
+}
+
+void TeeDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bool setSmuflGlyph)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawMusicText(text, x, y, setSmuflGlyph);
+}
+
+void TeeDeviceContext::DrawSpline(int n, Point points[])
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawSpline(n, points);
+}
+
+void TeeDeviceContext::DrawSvgShape(int x, int y, int width, int height, pugi::xml_node svg)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawSvgShape(x, y, width, height, svg);
+}
+
+void TeeDeviceContext::DrawBackgroundImage(int x, int y)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawBackgroundImage(x, y);
+}
+
+void TeeDeviceContext::DrawPlaceholder(int x, int y)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->DrawPlaceholder(x, y);
+}
+
+void TeeDeviceContext::StartText(int x, int y, data_HORIZONTALALIGNMENT alignment)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->StartText(x, y, alignment);
+}
+
+void TeeDeviceContext::EndText()
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->EndText();
+}
+
+void TeeDeviceContext::MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignment)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->MoveTextTo(x, y, alignment);
+}
+
+void TeeDeviceContext::MoveTextVerticallyTo(int y)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->MoveTextVerticallyTo(y);
+}
+
+void TeeDeviceContext::DeactivateGraphic()
+{
+    DeviceContext::DeactivateGraphic();
+    for (DeviceContext *dc : m_deviceContexts) dc->DeactivateGraphic();
+}
+
+void TeeDeviceContext::DeactivateGraphicX()
+{
+    DeviceContext::DeactivateGraphicX();
+    for (DeviceContext *dc : m_deviceContexts) dc->DeactivateGraphicX();
+}
+
+void TeeDeviceContext::DeactivateGraphicY()
+{
+    DeviceContext::DeactivateGraphicY();
+    for (DeviceContext *dc : m_deviceContexts) dc->DeactivateGraphicY();
+}
+
+void TeeDeviceContext::ReactivateGraphic()
+{
+    DeviceContext::ReactivateGraphic();
+    for (DeviceContext *dc : m_deviceContexts) dc->ReactivateGraphic();
+}
+
+void TeeDeviceContext::StartGraphic(Object *object, std::string gClass, std::string gId, bool prepend)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->StartGraphic(object, gClass, gId, prepend);
+}
+
+void TeeDeviceContext::EndGraphic(Object *object, View *view)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->EndGraphic(object, view);
+}
+
+void TeeDeviceContext::StartCustomGraphic(std::string name, std::string gClass, std::string gId)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->StartCustomGraphic(name, gClass, gId);
+}
+
+void TeeDeviceContext::EndCustomGraphic()
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->EndCustomGraphic();
+}
+
+void TeeDeviceContext::ResumeGraphic(Object *object, std::string gId)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->ResumeGraphic(object, gId);
+}
+
+void TeeDeviceContext::EndResumedGraphic(Object *object, View *view)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->EndResumedGraphic(object, view);
+}
+
+void TeeDeviceContext::StartTextGraphic(Object *object, std::string gClass, std::string gId)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->StartTextGraphic(object, gClass, gId);
+}
+
+void TeeDeviceContext::EndTextGraphic(Object *object, View *view)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->EndTextGraphic(object, view);
+}
+
+void TeeDeviceContext::RotateGraphic(Point const &orig, double angle)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->RotateGraphic(orig, angle);
+}
+
+void TeeDeviceContext::StartPage()
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->StartPage();
+}
+
+void TeeDeviceContext::EndPage()
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->EndPage();
+}
+
+void TeeDeviceContext::AddDescription(const std::string &text)
+{
+    for (DeviceContext *dc : m_deviceContexts) dc->AddDescription(text);
+}
+
+bool TeeDeviceContext::UseGlobalStyling()
+{
+    if (m_deviceContexts.empty()) return false;
+
+    return m_deviceContexts.front()->UseGlobalStyling();
+}
+
+} // namespace vrv
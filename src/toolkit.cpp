@@ -10,9 +10,13 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
+#include "bboxdevicecontext.h"
 #include "comparison.h"
 #include "custos.h"
 #include "editortoolkit_cmn.h"
@@ -35,6 +39,7 @@
 #include "slur.h"
 #include "staff.h"
 #include "svgdevicecontext.h"
+#include "teedevicecontext.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -53,8 +58,6 @@ const char *UTF_16_LE_BOM = "\xFF\xFE";
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_scale = DEFAULT_SCALE;
@@ -66,8 +69,10 @@ Toolkit::Toolkit(bool initFont)
     m_humdrumBuffer = NULL;
     m_cString = NULL;
 
+    this->BindToCurrentThread();
+
     if (initFont) {
-        Resources::InitFonts();
+        m_doc.GetResourcesForModification().InitFonts();
     }
 
     m_options = m_doc.GetOptions();
@@ -89,12 +94,31 @@ Toolkit::~Toolkit()
         delete m_editorToolkit;
         m_editorToolkit = NULL;
     }
+    // Do not leave the thread with dangling pointers
+    if (GetLogBuffer() == &m_logBuffer) SetLogBuffer(NULL);
+    if (Object::GetUuidGenerator() == m_doc.GetUuidGenerator()) Object::SetUuidGenerator(NULL);
+    if (Arena::GetCurrent() == m_doc.GetArena()) Arena::SetCurrent(NULL);
+}
+
+void Toolkit::BindToCurrentThread()
+{
+    SetLogBuffer(&m_logBuffer);
+    Object::SetUuidGenerator(m_doc.GetUuidGenerator());
+    Arena::SetCurrent(m_doc.GetArena());
 }
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
-    Resources::SetPath(path);
-    return Resources::InitFonts();
+    this->BindToCurrentThread();
+
+    Resources &resources = m_doc.GetResourcesForModification();
+    resources.SetPath(path);
+    return resources.InitFonts();
+}
+
+bool Toolkit::SetFont(const std::string &fontName)
+{
+    return m_doc.GetResourcesForModification().SetFont(fontName);
 }
 
 bool Toolkit::SetScale(int scale)
@@ -351,8 +375,36 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
     return LoadData(utf8line);
 }
 
+#ifndef NO_HUMDRUM_SUPPORT
+FileInputStream *Toolkit::GetConvertedHumdrumInput(
+    const std::string &humdrum, bool humMeiRoundTrip, std::string &newData)
+{
+    SetHumdrumBuffer(humdrum.c_str());
+
+    if (!humMeiRoundTrip) {
+        newData = humdrum;
+        return new HumdrumInput(&m_doc, "");
+    }
+
+    // Now convert Humdrum into MEI:
+    Doc tempdoc;
+    tempdoc.SetOptions(m_doc.GetOptions());
+    HumdrumInput tempinput(&tempdoc, "");
+    if (!tempinput.ImportString(humdrum)) {
+        LogError("Error importing Humdrum data");
+        return NULL;
+    }
+    MeiOutput meioutput(&tempdoc, "");
+    meioutput.SetScoreBasedMEI(true);
+    newData = meioutput.GetOutput();
+    return new MeiInput(&m_doc, "");
+}
+#endif
+
 bool Toolkit::LoadData(const std::string &data)
 {
+    this->BindToCurrentThread();
+
     std::string newData;
     FileInputStream *input = NULL;
 
@@ -360,6 +412,11 @@ bool Toolkit::LoadData(const std::string &data)
     if (inputFormat == AUTO) {
         inputFormat = IdentifyInputFrom(data);
     }
+#ifndef NO_HUMDRUM_SUPPORT
+    // Humdrum data is imported directly into the document unless the MEI round trip is requested. Expansions
+    // can only be resolved on score-based MEI and also require it.
+    bool humMeiRoundTrip = m_options->m_humMeiRoundTrip.GetValue() || !m_options->m_expand.GetValue().empty();
+#endif
     if (inputFormat == ABC) {
 #ifndef NO_ABC_SUPPORT
         input = new AbcInput(&m_doc, "");
@@ -385,6 +442,10 @@ bool Toolkit::LoadData(const std::string &data)
 #endif
     }
 #ifndef NO_HUMDRUM_SUPPORT
+    else if ((inputFormat == HUMDRUM) && (GetOutputTo() != HUMDRUM) && !humMeiRoundTrip) {
+        // The Humdrum buffer and the embedded options are set once the data is imported
+        input = new HumdrumInput(&m_doc, "");
+    }
     else if (inputFormat == HUMDRUM) {
         // LogMessage("Importing Humdrum data");
 
@@ -437,23 +498,8 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting MusicXML data");
             return false;
         }
-        std::string buffer = conversion.str();
-        SetHumdrumBuffer(buffer.c_str());
-
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        FileInputStream *tempinput = new HumdrumInput(&tempdoc, "");
-        if (!tempinput->ImportString(conversion.str())) {
-            LogError("Error importing Humdrum data (2)");
-            delete tempinput;
-            return false;
-        }
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MeiInput(&m_doc, "");
+        input = this->GetConvertedHumdrumInput(conversion.str(), humMeiRoundTrip, newData);
+        if (!input) return false;
     }
 
     else if (inputFormat == MEIHUM) {
@@ -467,23 +513,8 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting MEI data");
             return false;
         }
-        std::string buffer = conversion.str();
-        SetHumdrumBuffer(buffer.c_str());
-
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        FileInputStream *tempinput = new HumdrumInput(&tempdoc, "");
-        if (!tempinput->ImportString(conversion.str())) {
-            LogError("Error importing Humdrum data (3)");
-            delete tempinput;
-            return false;
-        }
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MeiInput(&m_doc, "");
+        input = this->GetConvertedHumdrumInput(conversion.str(), humMeiRoundTrip, newData);
+        if (!input) return false;
     }
 
     else if (inputFormat == MUSEDATAHUM) {
@@ -495,23 +526,8 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting MuseData data");
             return false;
         }
-        std::string buffer = conversion.str();
-        SetHumdrumBuffer(buffer.c_str());
-
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        FileInputStream *tempinput = new HumdrumInput(&tempdoc, "");
-        if (!tempinput->ImportString(conversion.str())) {
-            LogError("Error importing Humdrum data (4)");
-            delete tempinput;
-            return false;
-        }
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MeiInput(&m_doc, "");
+        input = this->GetConvertedHumdrumInput(conversion.str(), humMeiRoundTrip, newData);
+        if (!input) return false;
     }
 
     else if (inputFormat == ESAC) {
@@ -523,23 +539,8 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting EsAC data");
             return false;
         }
-        std::string buffer = conversion.str();
-        SetHumdrumBuffer(buffer.c_str());
-
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        FileInputStream *tempinput = new HumdrumInput(&tempdoc, "");
-        if (!tempinput->ImportString(conversion.str())) {
-            LogError("Error importing Humdrum data (5)");
-            delete tempinput;
-            return false;
-        }
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MeiInput(&m_doc, "");
+        input = this->GetConvertedHumdrumInput(conversion.str(), humMeiRoundTrip, newData);
+        if (!input) return false;
     }
 #endif
     else {
@@ -560,6 +561,19 @@ bool Toolkit::LoadData(const std::string &data)
         return false;
     }
 
+#ifndef NO_HUMDRUM_SUPPORT
+    HumdrumInput *humdrumInput = dynamic_cast<HumdrumInput *>(input);
+    if (humdrumInput) {
+        if (inputFormat == HUMDRUM) {
+            SetHumdrumBuffer(humdrumInput->GetHumdrumString().c_str());
+            // Read embedded options from input Humdrum file:
+            humdrumInput->parseEmbeddedOptions(m_doc);
+        }
+        // Done by MeiInput when reading the MEI of the round trip
+        m_doc.ConvertAnalyticalMarkupDoc();
+    }
+#endif
+
     // generate the page header and footer if necessary
     if (m_options->m_footer.GetValue() == FOOTER_auto) {
         m_doc.GenerateFooter();
@@ -628,7 +642,9 @@ bool Toolkit::LoadData(const std::string &data)
 
 std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
 {
-    if (GetPageCount() == 0) {
+    this->BindToCurrentThread();
+
+    if (GetCastOffPageCount() == 0) {
         LogWarning("No data loaded");
         return "";
     }
@@ -646,6 +662,8 @@ std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
 
 bool Toolkit::SaveFile(const std::string &filename)
 {
+    m_doc.CastOffPendingPages();
+
     MeiOutput meioutput(&m_doc, filename.c_str());
     meioutput.SetScoreBasedMEI(m_scoreBasedMei);
     if (!meioutput.ExportFile()) {
@@ -799,6 +817,8 @@ std::string Toolkit::GetAvailableOptions() const
 
 bool Toolkit::SetOptions(const std::string &json_options)
 {
+    this->BindToCurrentThread();
+
     jsonxx::Object json;
 
     // Read JSON options
@@ -980,7 +1000,7 @@ bool Toolkit::SetOptions(const std::string &json_options)
 
     // Forcing font to be reset. Warning: SetOption("font") as a single option will not work.
     // This needs to be fixed
-    if (!Resources::SetFont(m_options->m_font.GetValue())) {
+    if (!this->SetFont(m_options->m_font.GetValue())) {
         LogWarning("Font '%s' could not be loaded", m_options->m_font.GetValue().c_str());
     }
 
@@ -1066,6 +1086,11 @@ std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 
 bool Toolkit::Edit(const std::string &json_editorAction)
 {
+    this->BindToCurrentThread();
+
+    // The editor expects the pages to be all cast off
+    m_doc.CastOffPendingPages();
+
     return m_editorToolkit->ParseEditorAction(json_editorAction);
 }
 
@@ -1079,7 +1104,7 @@ std::string Toolkit::GetLog()
 #ifdef USE_EMSCRIPTEN
     std::string str;
     std::vector<std::string>::iterator iter;
-    for (iter = logBuffer.begin(); iter != logBuffer.end(); ++iter) {
+    for (iter = m_logBuffer.begin(); iter != m_logBuffer.end(); ++iter) {
         str += (*iter);
     }
     return str;
@@ -1097,21 +1122,52 @@ std::string Toolkit::GetVersion()
 void Toolkit::ResetLogBuffer()
 {
 #ifdef USE_EMSCRIPTEN
-    vrv::logBuffer.clear();
+    m_logBuffer.clear();
 #endif
 }
 
 void Toolkit::RedoLayout()
 {
-    if ((GetPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
+    this->BindToCurrentThread();
+
+    if ((GetCastOffPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
+        LogWarning("No data to re-layout");
+        return;
+    }
+
+    m_doc.UnCastOffDoc();
+    m_doc.CastOffDoc();
+}
+
+void Toolkit::RedoModifiedLayout()
+{
+    this->BindToCurrentThread();
+
+    if ((GetCastOffPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
         LogWarning("No data to re-layout");
         return;
     }
 
+    if (m_doc.LayOutModifiedPages()) return;
+
     m_doc.UnCastOffDoc();
     m_doc.CastOffDoc();
 }
 
+void Toolkit::LayOutAllPages(int threadCount)
+{
+    this->BindToCurrentThread();
+
+    if ((GetCastOffPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
+        LogWarning("No data to lay out");
+        return;
+    }
+
+    if (threadCount < 1) threadCount = std::thread::hardware_concurrency();
+
+    m_doc.LayOutPagesAhead(threadCount);
+}
+
 void Toolkit::RedoPagePitchPosLayout()
 {
     Page *page = m_doc.GetDrawingPage();
@@ -1126,7 +1182,11 @@ void Toolkit::RedoPagePitchPosLayout()
 
 bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 {
-    if (pageNo > GetPageCount()) {
+    this->BindToCurrentThread();
+
+    // Only the pages up to the one rendered need to be cast off
+    m_doc.CastOffPendingPages(pageNo);
+    if (pageNo > m_doc.GetCastOffPageCount()) {
         LogWarning("Page %d does not exist", pageNo);
         return false;
     }
@@ -1174,25 +1234,7 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xml_declaration)
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg;
 
-    if (m_options->m_mmOutput.GetValue()) {
-        svg.SetMMOutput(true);
-    }
-
-    if (m_doc.GetType() == Facs) {
-        svg.SetFacsimile(true);
-    }
-
-    // set the option to use viewbox on svg root
-    if (m_options->m_svgBoundingBoxes.GetValue()) {
-        svg.SetSvgBoundingBoxes(true);
-    }
-
-    if (m_options->m_svgViewBox.GetValue()) {
-        svg.SetSvgViewBox(true);
-    }
-
-    // render the page
-    RenderToDeviceContext(pageNo, &svg);
+    RenderToSvgDeviceContext(pageNo, &svg);
 
     std::string out_str = svg.GetStringSVG(xml_declaration);
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
@@ -1201,21 +1243,143 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xml_declaration)
 
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
 {
-    std::string output = RenderToSVG(pageNo, true);
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+    SvgDeviceContext svg;
+
+    RenderToSvgDeviceContext(pageNo, &svg);
 
     std::ofstream outfile;
     outfile.open(filename.c_str());
 
     if (!outfile.is_open()) {
         // add message?
+        if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
         return false;
     }
 
-    outfile << output;
+    // stream the svg directly to the file
+    svg.WriteSVG(outfile, true);
     outfile.close();
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
     return true;
 }
 
+bool Toolkit::RenderAllToSVG(const std::function<bool(int pageNo, const std::string &svg)> &callback, int fromPage,
+    int toPage, int threadCount, bool xml_declaration)
+{
+    this->BindToCurrentThread();
+
+    // With a progressive cast off, the pages are cast off as they are rendered (see RenderToDeviceContext)
+    // Only the final pages are checked, the pending page left by the cast off of the range being after them
+    m_doc.CastOffPendingPages(std::max(fromPage, toPage));
+    const int pageCount = m_doc.GetCastOffPageCount() - (m_doc.HasPendingPages() ? 1 : 0);
+    if ((fromPage < 1) || (fromPage > pageCount) || ((toPage != 0) && ((toPage < fromPage) || (toPage > pageCount)))) {
+        LogWarning("Page range %d to %d is not valid", fromPage, toPage);
+        return false;
+    }
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    if (threadCount < 1) threadCount = std::thread::hardware_concurrency();
+    // Only the pages of the range are laid out ahead
+    if ((threadCount > 1) && (fromPage != toPage)) {
+        m_doc.LayOutPagesAhead(threadCount, fromPage - 1, (toPage == 0) ? VRV_UNSET : toPage - 1);
+    }
+
+    // The SVG is serialized only from the SvgDeviceContext, which makes it possible to do it on the writer thread
+    // The writer logs to the buffer of the toolkit and keeps an exception of the callback for the calling thread
+    std::atomic<bool> stopped(false);
+    std::exception_ptr writerException;
+    std::vector<std::string> *logBuffer = GetLogBuffer();
+    auto writePage = [&callback, &stopped, &writerException, logBuffer, xml_declaration](
+                         int pageNo, SvgDeviceContext *svg) {
+        SetLogBuffer(logBuffer);
+        try {
+            if (!callback(pageNo, svg->GetStringSVG(xml_declaration))) stopped = true;
+        }
+        catch (...) {
+            writerException = std::current_exception();
+            stopped = true;
+        }
+        delete svg;
+    };
+
+    // The writer thread is joined when leaving the method, including with an exception from the rendering
+    struct WriterThread {
+        ~WriterThread() { this->Join(); }
+        void Join()
+        {
+            if (m_thread.joinable()) m_thread.join();
+        }
+        std::thread m_thread;
+    } writer;
+
+    // The page count is read at each iteration since it increases as the pending pages are cast off
+    // The pending page is counted as one page and always holds at least one more page
+    for (int pageNo = fromPage; (pageNo <= m_doc.GetCastOffPageCount()) && ((toPage == 0) || (pageNo <= toPage));
+         ++pageNo) {
+        SvgDeviceContext *svg = new SvgDeviceContext();
+        RenderToSvgDeviceContext(pageNo, svg);
+        // Wait for the previous page to be handed over since the callback is called for one page at a time
+        writer.Join();
+        if (stopped) {
+            delete svg;
+            break;
+        }
+        if (threadCount > 1) {
+            writer.m_thread = std::thread(writePage, pageNo, svg);
+        }
+        else {
+            writePage(pageNo, svg);
+        }
+    }
+    writer.Join();
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    if (writerException) std::rethrow_exception(writerException);
+    return !stopped;
+}
+
+void Toolkit::RenderToSvgDeviceContext(int pageNo, SvgDeviceContext *svg)
+{
+    assert(svg);
+
+    if (m_options->m_mmOutput.GetValue()) {
+        svg->SetMMOutput(true);
+    }
+
+    if (m_doc.GetType() == Facs) {
+        svg->SetFacsimile(true);
+    }
+
+    // set the option to use viewbox on svg root
+    if (m_options->m_svgBoundingBoxes.GetValue()) {
+        svg->SetSvgBoundingBoxes(true);
+    }
+
+    if (m_options->m_svgViewBox.GetValue()) {
+        svg->SetSvgViewBox(true);
+    }
+
+    if (m_options->m_svgFormatRaw.GetValue()) {
+        svg->SetFormatRaw(true);
+    }
+
+    // render the page
+    if (m_options->m_svgBoundingBoxes.GetValue()) {
+        // The bounding boxes are filled in the same traversal as the SVG output, which has to come first in order
+        // to get the logical origin from it
+        BBoxDeviceContext bBoxDC(&m_view, 0, 0);
+        TeeDeviceContext teeDC;
+        teeDC.AddDeviceContext(svg);
+        teeDC.AddDeviceContext(&bBoxDC);
+        RenderToDeviceContext(pageNo, &teeDC);
+    }
+    else {
+        RenderToDeviceContext(pageNo, svg);
+    }
+}
+
 std::string Toolkit::GetHumdrum()
 {
     return GetHumdrumBuffer();
@@ -1243,6 +1407,8 @@ void Toolkit::GetHumdrum(std::ostream &output)
 
 std::string Toolkit::RenderToMIDI()
 {
+    this->BindToCurrentThread();
+
     smf::MidiFile outputfile;
     outputfile.absoluteTicks();
     m_doc.ExportMIDI(&outputfile);
@@ -1258,6 +1424,8 @@ std::string Toolkit::RenderToMIDI()
 
 std::string Toolkit::RenderToTimemap()
 {
+    this->BindToCurrentThread();
+
     std::string output;
     m_doc.ExportTimemap(output);
     return output;
@@ -1274,26 +1442,21 @@ std::string Toolkit::GetElementsAtTime(int millisec)
         m_doc.CalculateMidiTimemap();
     }
 
-    MeasureOnsetOffsetComparison matchMeasureTime(millisec);
-    Measure *measure = dynamic_cast<Measure *>(m_doc.FindDescendantByComparison(&matchMeasureTime));
+    // The page numbers are known only once the pages are all cast off
+    m_doc.CastOffPendingPages();
+
+    ArrayOfObjects notes;
+    Measure *measure = m_doc.FindMeasureAndNotesAtTime(millisec, &notes);
 
     if (!measure) {
         return o.json();
     }
 
-    int repeat = measure->EnclosesTime(millisec);
-    int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(repeat);
-
     // Get the pageNo from the first note (if any)
     int pageNo = -1;
     Page *page = dynamic_cast<Page *>(measure->GetFirstAncestor(PAGE));
     if (page) pageNo = page->GetIdx() + 1;
 
-    NoteOnsetOffsetComparison matchNoteTime(millisec - measureTimeOffset);
-    ArrayOfObjects notes;
-
-    measure->FindAllDescendantByComparison(&notes, &matchNoteTime);
-
     // Fill the JSON object
     ArrayOfObjects::iterator iter;
     for (iter = notes.begin(); iter != notes.end(); ++iter) {
@@ -1335,8 +1498,20 @@ int Toolkit::GetPageCount()
     return m_doc.GetPageCount();
 }
 
+int Toolkit::GetCastOffPageCount()
+{
+    return m_doc.GetCastOffPageCount();
+}
+
+bool Toolkit::HasPendingPages()
+{
+    return m_doc.HasPendingPages();
+}
+
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
+    m_doc.CastOffPendingPages();
+
     Object *element = m_doc.FindDescendantByUuid(xmlId);
     if (!element) {
         return 0;
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <math.h>
 #include <utility>
@@ -29,20 +30,53 @@ namespace vrv {
 // SystemAligner
 //----------------------------------------------------------------------------
 
-SystemAligner::SystemAligner() : Object()
+SystemAligner::SystemAligner() : Object("m-", false)
 {
+    m_reusedCount = 0;
+    this->SetAsOutsideUuidIndex();
+
     Reset();
 }
 
-SystemAligner::~SystemAligner() {}
+SystemAligner::~SystemAligner()
+{
+    for (Object *alignment : m_staffAlignmentPool) {
+        delete alignment;
+    }
+}
 
 void SystemAligner::Reset()
 {
-    Object::Reset();
+    // Delete the alignments not reused by the previous layout, but not the ones just passed by ReuseAlignmentsFrom
+    int trimCount = std::max(0, (int)m_staffAlignmentPool.size() - m_reusedCount);
+    for (int i = 0; i < trimCount; ++i) {
+        delete m_staffAlignmentPool.at(i);
+    }
+    m_staffAlignmentPool.erase(m_staffAlignmentPool.begin(), m_staffAlignmentPool.begin() + trimCount);
+    m_reusedCount = 0;
+
+    // Keep the alignments aside for the next layout instead of deleting them (see SystemAligner::GetStaffAlignment)
+    m_staffAlignmentPool.insert(m_staffAlignmentPool.end(), m_children.begin(), m_children.end());
+    m_children.clear();
+    ResetBoundingBox();
+
     m_bottomAlignment = NULL;
     m_bottomAlignment = GetStaffAlignment(0, NULL, NULL);
 }
 
+void SystemAligner::ReuseAlignmentsFrom(SystemAligner *aligner, int shareCount)
+{
+    assert(aligner);
+    assert(shareCount > 0);
+
+    aligner->Reset();
+    ArrayOfObjects &pool = aligner->m_staffAlignmentPool;
+    int count = (int)pool.size() / shareCount;
+    m_staffAlignmentPool.insert(m_staffAlignmentPool.end(), pool.end() - count, pool.end());
+    pool.resize(pool.size() - count);
+    m_reusedCount += count;
+}
+
 StaffAlignment *SystemAligner::GetStaffAlignment(int idx, Staff *staff, Doc *doc)
 {
     // The last one is always the bottomAlignment (unless if not created)
@@ -61,7 +95,17 @@ StaffAlignment *SystemAligner::GetStaffAlignment(int idx, Staff *staff, Doc *doc
 
     // This is the first time we are looking for it (e.g., first staff)
     // We create the StaffAlignment
-    StaffAlignment *alignment = new StaffAlignment();
+    StaffAlignment *alignment = NULL;
+    if (m_staffAlignmentPool.empty()) {
+        alignment = new StaffAlignment();
+    }
+    else {
+        assert(m_staffAlignmentPool.back()->Is(STAFF_ALIGNMENT));
+        alignment = static_cast<StaffAlignment *>(m_staffAlignmentPool.back());
+        m_staffAlignmentPool.pop_back();
+        alignment->ResetParent();
+        alignment->Reset();
+    }
     alignment->SetStaff(staff, doc);
     alignment->SetParent(this);
     m_children.push_back(alignment);
@@ -87,6 +131,21 @@ StaffAlignment *SystemAligner::GetStaffAlignmentForStaffN(int staffN) const
     return NULL;
 }
 
+void SystemAligner::MovePositionersFrom(SystemAligner *aligner)
+{
+    assert(aligner);
+
+    for (auto &child : aligner->m_children) {
+        StaffAlignment *alignment = dynamic_cast<StaffAlignment *>(child);
+        assert(alignment);
+        StaffAlignment *target = m_bottomAlignment;
+        if (alignment->GetStaff()) {
+            target = this->GetStaffAlignmentForStaffN(alignment->GetStaff()->GetN());
+        }
+        if (target) target->MovePositionersFrom(alignment);
+    }
+}
+
 void SystemAligner::FindAllPositionerPointingTo(ArrayOfFloatingPositioners *positioners, FloatingObject *object)
 {
     assert(positioners);
@@ -119,8 +178,49 @@ void SystemAligner::FindAllIntersectionPoints(
 // StaffAlignment
 //----------------------------------------------------------------------------
 
-StaffAlignment::StaffAlignment() : Object()
+StaffAlignment::StaffAlignment() : Object("m-", false)
+{
+    Reset();
+}
+
+StaffAlignment::~StaffAlignment()
+{
+    ClearPositioners();
+
+    for (FloatingPositioner *positioner : m_positionerPool) {
+        delete positioner;
+    }
+    for (FloatingPositioner *positioner : m_curvePositionerPool) {
+        delete positioner;
+    }
+}
+
+void StaffAlignment::Reset()
 {
+    Object::Reset();
+
+    // The positioners not reused by the previous layout are not needed anymore
+    for (FloatingPositioner *positioner : m_positionerPool) {
+        delete positioner;
+    }
+    m_positionerPool.clear();
+    for (FloatingPositioner *positioner : m_curvePositionerPool) {
+        delete positioner;
+    }
+    m_curvePositionerPool.clear();
+
+    // Keep the positioners aside for reuse instead of deleting them (see StaffAlignment::SetCurrentFloatingPositioner)
+    for (FloatingPositioner *positioner : m_floatingPositioners) {
+        // The object might not exist anymore, so use the class of the positioner
+        if (positioner->Is(FLOATING_CURVE_POSITIONER)) {
+            m_curvePositionerPool.push_back(positioner);
+        }
+        else {
+            m_positionerPool.push_back(positioner);
+        }
+    }
+    m_floatingPositioners.clear();
+
     m_yRel = 0;
     m_verseCount = 0;
     m_staff = NULL;
@@ -129,11 +229,9 @@ StaffAlignment::StaffAlignment() : Object()
     m_overflowBelow = 0;
     m_staffHeight = 0;
     m_overlap = 0;
-}
 
-StaffAlignment::~StaffAlignment()
-{
-    ClearPositioners();
+    m_overflowAboveBBoxes.clear();
+    m_overflowBelowBBoxes.clear();
 }
 
 void StaffAlignment::ClearPositioners()
@@ -220,20 +318,38 @@ void StaffAlignment::SetCurrentFloatingPositioner(
 {
     FloatingPositioner *positioner = this->GetCorrespFloatingPositioner(object);
     if (positioner == NULL) {
-        if (object->Is({ SLUR, TIE })) {
+        // Reuse a positioner of the previous layout if any
+        ArrayOfFloatingPositioners &pool = (object->Is({ SLUR, TIE })) ? m_curvePositionerPool : m_positionerPool;
+        if (!pool.empty()) {
+            positioner = pool.back();
+            pool.pop_back();
+            positioner->InitPositioner(object, this, spanningType);
+        }
+        else if (object->Is({ SLUR, TIE })) {
             positioner = new FloatingCurvePositioner(object, this, spanningType);
-            m_floatingPositioners.push_back(positioner);
         }
         else {
             positioner = new FloatingPositioner(object, this, spanningType);
-            m_floatingPositioners.push_back(positioner);
         }
+        m_floatingPositioners.push_back(positioner);
     }
     positioner->SetObjectXY(objectX, objectY);
     // LogDebug("BB %d", item->second.m_contentBB_x1);
     object->SetCurrentFloatingPositioner(positioner);
 }
 
+void StaffAlignment::MovePositionersFrom(StaffAlignment *alignment)
+{
+    assert(alignment);
+
+    for (FloatingPositioner *positioner : alignment->m_floatingPositioners) {
+        positioner->SetAlignment(this);
+    }
+    m_floatingPositioners.insert(
+        m_floatingPositioners.end(), alignment->m_floatingPositioners.begin(), alignment->m_floatingPositioners.end());
+    alignment->m_floatingPositioners.clear();
+}
+
 FloatingPositioner *StaffAlignment::FindFirstFloatingPositioner(ClassId classId)
 {
     auto item = std::find_if(m_floatingPositioners.begin(), m_floatingPositioners.end(),
@@ -348,6 +464,12 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
+    // The overflowing boxes indexed horizontally, filled only once a positioner needs to be adjusted
+    BoundingBoxIndex overflowAboveIndex;
+    BoundingBoxIndex overflowBelowIndex;
+    bool overflowIndexed = false;
+    std::vector<int> overlaps;
+
     ArrayOfFloatingPositioners::iterator iter;
     for (iter = m_floatingPositioners.begin(); iter != m_floatingPositioners.end(); ++iter) {
         assert((*iter)->GetObject());
@@ -393,25 +515,30 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
         // This sets the default position (without considering any overflowing box)
         (*iter)->CalcDrawingYRel(params->m_doc, this, NULL);
 
+        if (!overflowIndexed) {
+            overflowAboveIndex.AddBoxes(m_overflowAboveBBoxes);
+            overflowBelowIndex.AddBoxes(m_overflowBelowBBoxes);
+            overflowIndexed = true;
+        }
+
         ArrayOfBoundingBoxes *overflowBoxes = &m_overflowBelowBBoxes;
+        BoundingBoxIndex *overflowIndex = &overflowBelowIndex;
         // above?
         data_STAFFREL place = (*iter)->GetDrawingPlace();
         if (place == STAFFREL_above) {
             overflowBoxes = &m_overflowAboveBBoxes;
+            overflowIndex = &overflowAboveIndex;
         }
-        auto i = overflowBoxes->begin();
-        auto end = overflowBoxes->end();
-        while (i != end) {
-            // find all the overflowing elements from the staff that overlap horizonatally
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // update the yRel accordingly
-                (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
-                i++;
-            }
+        // find all the overflowing elements from the staff that overlap horizontally
+        // they are looked at in the order they were added since the adjustment depends on it
+        overflowIndex->FindHorizontalContentOverlaps(*iter, overlaps);
+        for (int position : overlaps) {
+            // update the yRel accordingly
+            (*iter)->CalcDrawingYRel(params->m_doc, this, overflowBoxes->at(position));
         }
         //  Now update the staffAlignment max overflow (above or below) and add the positioner to the list of
         //  overflowing elements
+        overflowIndex->AddBox(*iter, (int)overflowBoxes->size());
         if (place == STAFFREL_above) {
             int overflowAbove = this->CalcOverflowAbove((*iter));
             overflowBoxes->push_back((*iter));
@@ -546,25 +673,28 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
+    // index the elements of the bottom staff that have an overflow at the top
+    BoundingBoxIndex overflowAboveIndex;
+    if (!params->m_previous->m_overflowBelowBBoxes.empty()) {
+        overflowAboveIndex.AddBoxes(m_overflowAboveBBoxes);
+    }
+    std::vector<int> overlaps;
+    int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
+
     ArrayOfBoundingBoxes::iterator iter;
     // go through all the elements of the top staff that have an overflow below
     for (iter = params->m_previous->m_overflowBelowBBoxes.begin();
          iter != params->m_previous->m_overflowBelowBBoxes.end(); ++iter) {
-        auto i = m_overflowAboveBBoxes.begin();
-        auto end = m_overflowAboveBBoxes.end();
-        while (i != end) {
-            // find all the elements from the bottom staff that have an overflow at the top with an horizontal overlap
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // calculate the vertical overlap and see if this is more than the expected space
-                int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
-                int overflowAbove = this->CalcOverflowAbove(*i);
-                int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
-                if (spacing < (overflowBelow + overflowAbove)) {
-                    // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
-                    this->SetOverlap((overflowBelow + overflowAbove) - spacing);
-                }
-                i++;
+        // find all the elements from the bottom staff that have an overflow at the top with an horizontal overlap
+        overflowAboveIndex.FindHorizontalContentOverlaps(*iter, overlaps);
+        if (overlaps.empty()) continue;
+        int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
+        for (int position : overlaps) {
+            // calculate the vertical overlap and see if this is more than the expected space
+            int overflowAbove = this->CalcOverflowAbove(m_overflowAboveBBoxes.at(position));
+            if (spacing < (overflowBelow + overflowAbove)) {
+                // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
+                this->SetOverlap((overflowBelow + overflowAbove) - spacing);
             }
         }
     }
@@ -90,7 +90,7 @@ void View::DrawBeam(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     /******************************************************************/
     // Start the Beam graphic and draw the children
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     /******************************************************************/
     // Draw the children
@@ -331,7 +331,7 @@ void View::DrawFTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     /******************************************************************/
     // Start the grahic
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     /******************************************************************/
     // Draw the children
@@ -70,7 +70,7 @@ void View::DrawControlElement(DeviceContext *dc, ControlElement *element, Measur
     // For dir, dynam, fermata, and harm, we do not consider the @tstamp2 for rendering
     if (element->Is({ BRACKETSPAN, FIGURE, HAIRPIN, OCTAVE, SLUR, TIE })) {
         // create placeholder
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         dc->EndGraphic(element, this);
         system->AddToDrawingList(element);
     }
@@ -360,7 +360,7 @@ void View::DrawBracketSpan(
     }
 
     if (graphic) {
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     }
     else {
         dc->StartGraphic(bracketSpan, "spanning-bracketspan", "");
@@ -549,7 +549,7 @@ void View::DrawHairpin(
     y2 -= m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2;
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     else
         dc->StartGraphic(hairpin, "spanning-hairpin", "");
     // dc->DeactivateGraphic();
@@ -599,7 +599,7 @@ void View::DrawOctave(
     /************** draw it **************/
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     else
         dc->StartGraphic(octave, "spanning-octave", "");
 
@@ -894,7 +894,7 @@ void View::DrawTie(DeviceContext *dc, Tie *tie, int x1, int x2, Staff *staff, ch
     }
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     else
         dc->StartGraphic(tie, "spanning-tie", "");
     DrawThickBezierCurve(dc, bezier, thickness, staff->m_drawingStaffSize, 0, penStyle);
@@ -934,7 +934,7 @@ void View::DrawTrillExtension(
     /************** draw it **************/
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     else
         dc->StartGraphic(trill, "spanning-trill", "");
 
@@ -1004,7 +1004,7 @@ void View::DrawControlElementConnector(
     /************** draw it **************/
 
     if (graphic) {
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     }
     else {
         dc->StartGraphic(element, "spanning-element", "");
@@ -1072,7 +1072,7 @@ void View::DrawFConnector(DeviceContext *dc, F *f, int x1, int x2, Staff *staff,
     // in order not to reset the Syl bounding box.
     F fConnector;
     if (graphic) {
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     }
     else
         dc->StartGraphic(&fConnector, "spanning-connector", "");
@@ -1149,7 +1149,7 @@ void View::DrawSylConnector(
     // in order not to reset the Syl bounding box.
     Syl sylConnector;
     if (graphic) {
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     }
     else
         dc->StartGraphic(&sylConnector, "spanning-connector", "");
@@ -1272,7 +1272,7 @@ void View::DrawArpeg(DeviceContext *dc, Arpeg *arpeg, Measure *measure, System *
 
     Point orig(x, y);
 
-    dc->StartGraphic(arpeg, "", arpeg->GetUuid());
+    dc->StartGraphic(arpeg, "");
 
     // Smufl glyphs are horizontal - Rotate them counter clockwise
     dc->RotateGraphic(Point(ToDeviceContextX(x), ToDeviceContextY(y)), angle);
@@ -1292,7 +1292,7 @@ void View::DrawBreath(DeviceContext *dc, Breath *breath, Measure *measure, Syste
     // Cannot draw a breath that has no start position
     if (!breath->GetStart()) return;
 
-    dc->StartGraphic(breath, "", breath->GetUuid());
+    dc->StartGraphic(breath, "");
 
     int x = breath->GetStart()->GetDrawingX() + breath->GetStart()->GetDrawingRadius(m_doc);
 
@@ -1334,7 +1334,7 @@ void View::DrawDir(DeviceContext *dc, Dir *dir, Measure *measure, System *system
     // Cannot draw a dir that has no start position
     if (!dir->GetStart()) return;
 
-    dc->StartGraphic(dir, "", dir->GetUuid());
+    dc->StartGraphic(dir, "");
 
     FontInfo dirTxt;
     if (!dc->UseGlobalStyling()) {
@@ -1387,7 +1387,7 @@ void View::DrawDynam(DeviceContext *dc, Dynam *dynam, Measure *measure, System *
     // Cannot draw dynamics that have no start position
     if (!dynam->GetStart()) return;
 
-    dc->StartGraphic(dynam, "", dynam->GetUuid());
+    dc->StartGraphic(dynam, "");
 
     bool isSymbolOnly = dynam->IsSymbolOnly();
     std::wstring dynamSymbol;
@@ -1454,7 +1454,7 @@ void View::DrawFb(DeviceContext *dc, Staff *staff, Fb *fb, TextDrawingParams &pa
     assert(dc);
     assert(fb);
 
-    dc->StartGraphic(fb, "", fb->GetUuid());
+    dc->StartGraphic(fb, "");
 
     FontInfo *fontDim = m_doc->GetDrawingLyricFont(staff->m_drawingStaffSize);
     int lineHeight = m_doc->GetTextLineHeight(fontDim, false);
@@ -1500,7 +1500,7 @@ void View::DrawFermata(DeviceContext *dc, Fermata *fermata, Measure *measure, Sy
     // Cannot draw a fermata that has no start position
     if (!fermata->GetStart()) return;
 
-    dc->StartGraphic(fermata, "", fermata->GetUuid());
+    dc->StartGraphic(fermata, "");
 
     int x = fermata->GetStart()->GetDrawingX() + fermata->GetStart()->GetDrawingRadius(m_doc);
 
@@ -1554,7 +1554,7 @@ void View::DrawHarm(DeviceContext *dc, Harm *harm, Measure *measure, System *sys
     // Cannot draw a harmony indication that has no start position
     if (!harm->GetStart()) return;
 
-    dc->StartGraphic(harm, "", harm->GetUuid());
+    dc->StartGraphic(harm, "");
 
     FontInfo harmTxt;
     if (!dc->UseGlobalStyling()) {
@@ -1615,7 +1615,7 @@ void View::DrawMordent(DeviceContext *dc, Mordent *mordent, Measure *measure, Sy
     // Cannot draw a mordent that has no start position
     if (!mordent->GetStart()) return;
 
-    dc->StartGraphic(mordent, "", mordent->GetUuid());
+    dc->StartGraphic(mordent, "");
 
     int x = mordent->GetStart()->GetDrawingX() + mordent->GetStart()->GetDrawingRadius(m_doc);
 
@@ -1722,7 +1722,7 @@ void View::DrawPedal(DeviceContext *dc, Pedal *pedal, Measure *measure, System *
     // just as without a dir attribute
     if (!pedal->HasDir()) return;
 
-    dc->StartGraphic(pedal, "", pedal->GetUuid());
+    dc->StartGraphic(pedal, "");
 
     int x = pedal->GetStart()->GetDrawingX() + pedal->GetStart()->GetDrawingRadius(m_doc);
 
@@ -1782,7 +1782,7 @@ void View::DrawTempo(DeviceContext *dc, Tempo *tempo, Measure *measure, System *
     // Cannot draw a tempo that has no start position
     if (!tempo->GetStart()) return;
 
-    dc->StartGraphic(tempo, "", tempo->GetUuid());
+    dc->StartGraphic(tempo, "");
 
     FontInfo tempoTxt;
     if (!dc->UseGlobalStyling()) {
@@ -1848,7 +1848,7 @@ void View::DrawTrill(DeviceContext *dc, Trill *trill, Measure *measure, System *
     // Cannot draw a trill that has no start position
     if (!trill->GetStart()) return;
 
-    dc->StartGraphic(trill, "", trill->GetUuid());
+    dc->StartGraphic(trill, "");
 
     int x = trill->GetStart()->GetDrawingX() + trill->GetStart()->GetDrawingRadius(m_doc);
 
@@ -1911,7 +1911,7 @@ void View::DrawTurn(DeviceContext *dc, Turn *turn, Measure *measure, System *sys
     // Cannot draw a turn that has no start position
     if (!turn->GetStart()) return;
 
-    dc->StartGraphic(turn, "", turn->GetUuid());
+    dc->StartGraphic(turn, "");
 
     int x = turn->GetStart()->GetDrawingX() + turn->GetStart()->GetDrawingRadius(m_doc);
     if (turn->GetDelayed() == BOOLEAN_true && !turn->HasTstamp()) LogWarning("delayed turns not supported");
@@ -1987,19 +1987,19 @@ void View::DrawSystemElement(DeviceContext *dc, SystemElement *element, System *
         // Create placeholder - A graphic for the end boundary will be created
         // but only if it is on a different system - See View::DrawEnding
         // The Ending is added to the System drawing list by View::DrawMeasure
-        dc->StartGraphic(element, "boundaryStart", element->GetUuid());
+        dc->StartGraphic(element, "boundaryStart");
         dc->EndGraphic(element, this);
     }
     else if (element->Is(PB)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         dc->EndGraphic(element, this);
     }
     else if (element->Is(SB)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         dc->EndGraphic(element, this);
     }
     else if (element->Is(SECTION)) {
-        dc->StartGraphic(element, "boundaryStart", element->GetUuid());
+        dc->StartGraphic(element, "boundaryStart");
         dc->EndGraphic(element, this);
     }
 }
@@ -2087,7 +2087,7 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
     }
 
     if ((spanningType == SPANNING_START_END) || (spanningType == SPANNING_START))
-        dc->ResumeGraphic(ending, ending->GetUuid());
+        dc->ResumeGraphic(ending);
     else
         dc->StartGraphic(ending, "spanning-ending", "");
 
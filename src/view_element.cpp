@@ -69,7 +69,7 @@ void View::DrawLayerElement(DeviceContext *dc, LayerElement *element, Layer *lay
     assert(measure);
 
     if (element->HasSameas()) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         element->SetEmptyBB();
         dc->EndGraphic(element, this);
         return;
@@ -190,12 +190,12 @@ void View::DrawLayerElement(DeviceContext *dc, LayerElement *element, Layer *lay
         DrawTuplet(dc, element, layer, staff, measure);
     }
     else if (element->Is(TUPLET_BRACKET)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         dc->EndGraphic(element, this);
         layer->AddToDrawingList(element);
     }
     else if (element->Is(TUPLET_NUM)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         dc->EndGraphic(element, this);
         layer->AddToDrawingList(element);
     }
@@ -228,13 +228,13 @@ void View::DrawAccid(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     // This can happen with accid within note with only accid.ges
     // We still create an graphic in the output
     if (!accid->HasAccid()) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         accid->SetEmptyBB();
         dc->EndGraphic(element, this);
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     /************** editorial accidental **************/
 
@@ -281,7 +281,7 @@ void View::DrawArtic(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
 
     /************** draw the artic **************/
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawLayerChildren(dc, artic, layer, staff, measure);
 
@@ -313,7 +313,7 @@ void View::DrawArticPart(DeviceContext *dc, LayerElement *element, Layer *layer,
 
     bool drawingCueSize = true;
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     dc->SetFont(m_doc->GetDrawingSmuflFont(staff->m_drawingStaffSize, drawingCueSize));
 
@@ -385,7 +385,7 @@ void View::DrawBarLine(DeviceContext *dc, LayerElement *element, Layer *layer, S
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int y = staff->GetDrawingY();
     DrawBarLine(dc, y, y - m_doc->GetDrawingStaffSize(staff->m_drawingStaffSize), barLine);
@@ -404,7 +404,7 @@ void View::DrawBeatRpt(DeviceContext *dc, LayerElement *element, Layer *layer, S
     BeatRpt *beatRpt = dynamic_cast<BeatRpt *>(element);
     assert(beatRpt);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int x = element->GetDrawingX();
     int xSymbol = x;
@@ -468,7 +468,7 @@ void View::DrawBTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawLayerChildren(dc, bTrem, layer, staff, measure);
 
@@ -675,7 +675,7 @@ void View::DrawClef(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
         }
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawSmuflCode(dc, x, y, sym, staff->m_drawingStaffSize, cueSize);
 
@@ -693,7 +693,7 @@ void View::DrawCustos(DeviceContext *dc, LayerElement *element, Layer *layer, St
     Custos *custos = dynamic_cast<Custos *>(element);
     assert(custos);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int sym = 0;
     // Select glyph to use for this custos
@@ -758,7 +758,7 @@ void View::DrawDot(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     Dot *dot = dynamic_cast<Dot *>(element);
     assert(dot);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int x = element->GetDrawingX();
     int y = element->GetDrawingY();
@@ -792,7 +792,7 @@ void View::DrawDots(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     Dots *dots = dynamic_cast<Dots *>(element);
     assert(dots);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     MapOfDotLocs::const_iterator iter;
     const MapOfDotLocs *map = dots->GetMapOfDotLocs();
@@ -821,17 +821,17 @@ void View::DrawDurationElement(DeviceContext *dc, LayerElement *element, Layer *
     assert(measure);
 
     if (dynamic_cast<Chord *>(element)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         DrawChord(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
     else if (dynamic_cast<Note *>(element)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         DrawNote(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
     else if (dynamic_cast<Rest *>(element)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
         DrawRest(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
@@ -854,7 +854,7 @@ void View::DrawFlag(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     int x = flag->GetDrawingX() - m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2;
     int y = flag->GetDrawingY();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     wchar_t code = flag->GetSmuflCode(stem->GetDrawingStemDir());
     DrawSmuflCode(dc, x, y, code, staff->m_drawingStaffSize, flag->GetDrawingCueSize());
@@ -870,7 +870,7 @@ void View::DrawGraceGrp(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     // basically nothing to do here
     DrawLayerChildren(dc, element, layer, staff, measure);
@@ -892,7 +892,7 @@ void View::DrawHalfmRpt(DeviceContext *dc, LayerElement *element, Layer *layer,
     int x = halfmRpt->GetDrawingX();
     x += m_doc->GetGlyphWidth(SMUFL_E500_repeat1Bar, staff->m_drawingStaffSize, false) / 2;
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawMRptPart(dc, x, SMUFL_E500_repeat1Bar, 0, false, staff);
 
@@ -949,7 +949,7 @@ void View::DrawKeySig(DeviceContext *dc, LayerElement *element, Layer *layer, St
     // Show cancellation if C major (0)
     // This is not meant to make sense with mixed key signature
     if ((keySig->GetScoreDefRole() != SCOREDEF_SYSTEM) && (keySig->GetAccidCount() == 0)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
 
         for (i = 0; i < keySig->m_drawingCancelAccidCount; ++i) {
             data_PITCHNAME pitch = KeySig::GetAccidPnameAt(keySig->m_drawingCancelAccidType, i);
@@ -965,7 +965,7 @@ void View::DrawKeySig(DeviceContext *dc, LayerElement *element, Layer *layer, St
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     // Show cancellation if show cancellation (showchange) is true (false by default)
     // This is not meant to make sense with mixed key signature
@@ -1035,7 +1035,7 @@ void View::DrawMeterSig(DeviceContext *dc, LayerElement *element, Layer *layer,
     MeterSig *meterSig = dynamic_cast<MeterSig *>(element);
     assert(meterSig);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int y = staff->GetDrawingY() - m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * (staff->m_drawingLines - 1);
     int x = element->GetDrawingX();
@@ -1072,7 +1072,7 @@ void View::DrawMRest(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     MRest *mRest = dynamic_cast<MRest *>(element);
     assert(mRest);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     mRest->CenterDrawingX();
 
@@ -1103,7 +1103,7 @@ void View::DrawMRpt(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
 
     mRpt->CenterDrawingX();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawMRptPart(dc, element->GetDrawingX(), SMUFL_E500_repeat1Bar, mRpt->m_drawingMeasureCount, false, staff);
 
@@ -1123,7 +1123,7 @@ void View::DrawMRpt2(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
 
     mRpt2->CenterDrawingX();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawMRptPart(dc, element->GetDrawingX(), SMUFL_E501_repeat2Bars, 2, true, staff);
 
@@ -1145,7 +1145,7 @@ void View::DrawMultiRest(DeviceContext *dc, LayerElement *element, Layer *layer,
 
     int x1, x2, y1, y2;
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int width = measure->GetInnerWidth();
     int xCentered = multiRest->GetDrawingX();
@@ -1223,7 +1223,7 @@ void View::DrawMultiRpt(DeviceContext *dc, LayerElement *element, Layer *layer,
 
     multiRpt->CenterDrawingX();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawMRptPart(dc, element->GetDrawingX(), SMUFL_E501_repeat2Bars, multiRpt->GetNum(), true, staff);
 
@@ -1335,7 +1335,7 @@ void View::DrawSpace(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
     dc->DrawPlaceholder(ToDeviceContextX(element->GetDrawingX()), ToDeviceContextY(element->GetDrawingY()));
     dc->EndGraphic(element, this);
 }
@@ -1354,7 +1354,7 @@ void View::DrawStem(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     // Do not draw virtual (e.g., whole note) stems
     if (stem->IsVirtual()) return;
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     DrawFilledRectangle(dc, stem->GetDrawingX() - m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2,
         stem->GetDrawingY(), stem->GetDrawingX() + m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2,
@@ -1385,7 +1385,7 @@ void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
 
     syl->SetDrawingYRel(GetSylYRel(syl, staff));
 
-    dc->StartGraphic(syl, "", syl->GetUuid());
+    dc->StartGraphic(syl, "");
     dc->DeactivateGraphicY();
 
     dc->SetBrush(m_currentColour, AxSOLID);
@@ -1451,7 +1451,7 @@ void View::DrawVerse(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     Verse *verse = dynamic_cast<Verse *>(element);
     assert(verse);
 
-    dc->StartGraphic(verse, "", verse->GetUuid());
+    dc->StartGraphic(verse, "");
 
     DrawLayerChildren(dc, verse, layer, staff, measure);
 
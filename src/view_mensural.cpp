@@ -141,7 +141,7 @@ void View::DrawMensur(DeviceContext *dc, LayerElement *element, Layer *layer, St
     Mensur *mensur = dynamic_cast<Mensur *>(element);
     assert(mensur);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int y = staff->GetDrawingY() - m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * (staff->m_drawingLines - 1);
     int x = element->GetDrawingX();
@@ -420,7 +420,7 @@ void View::DrawLigature(DeviceContext *dc, LayerElement *element, Layer *layer,
     Ligature *ligature = dynamic_cast<Ligature *>(element);
     assert(ligature);
 
-    dc->StartGraphic(ligature, "", ligature->GetUuid());
+    dc->StartGraphic(ligature, "");
 
     // Draw children (notes)
     DrawLayerChildren(dc, ligature, layer, staff, measure);
@@ -533,7 +533,7 @@ void View::DrawProport(DeviceContext *dc, LayerElement *element, Layer *layer, S
 
     Proport *proport = dynamic_cast<Proport *>(element);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     int y = staff->GetDrawingY() - (m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * 4);
     int x = element->GetDrawingX();
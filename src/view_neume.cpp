@@ -43,7 +43,7 @@ void View::DrawSyllable(DeviceContext *dc, LayerElement *element, Layer *layer,
     /******************************************************************/
     // Start the Beam graphic and draw the children
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     /******************************************************************/
     // Draw the children
@@ -70,7 +70,7 @@ void View::DrawNc(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     };
     std::vector<drawingParams> params;
     params.push_back(drawingParams());
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     /******************************************************************/
 
@@ -196,7 +196,7 @@ void View::DrawNeume(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     /******************************************************************/
     // Start the Neume graphic and draw the children
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
     DrawLayerChildren(dc, neume, layer, staff, measure);
     dc->EndGraphic(element, this);
 }
@@ -60,6 +60,8 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     assert(dc);
     assert(m_doc);
 
+    dc->SetResources(&m_doc->GetResources());
+
     m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
 
     int i;
@@ -69,6 +71,8 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
 
     // Set the current score def to the page one
     // The page one has previously been set by Object::SetCurrentScoreDef
+    // The uuids of the objects created when drawing do not depend on the pages drawn before
+    ObjectUuidGenerator uuidGenerator(m_currentPage);
     m_drawingScoreDef = m_currentPage->m_drawingScoreDef;
 
     if (background) dc->DrawRectangle(0, 0, m_doc->m_drawingPageWidth, m_doc->m_drawingPageHeight);
@@ -145,7 +149,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
     assert(dc);
     assert(system);
 
-    dc->StartGraphic(system, "", system->GetUuid());
+    dc->StartGraphic(system, "");
 
     Measure *firstMeasure = dynamic_cast<Measure *>(system->FindDescendantByType(MEASURE, 1));
 
@@ -277,7 +281,7 @@ void View::DrawScoreDef(
         // scoreDef->SetDrawLabels(false);
     }
     else {
-        dc->StartGraphic(barLine, "", barLine->GetUuid());
+        dc->StartGraphic(barLine, "");
         DrawBarLines(dc, measure, staffGrp, barLine, isLastMeasure);
         dc->EndGraphic(barLine, this);
     }
@@ -479,7 +483,7 @@ void View::DrawLabels(DeviceContext *dc, Measure *measure, System *system, Objec
     dc->SetBrush(m_currentColour, AxSOLID);
     dc->SetFont(&labelTxt);
 
-    dc->StartGraphic(graphic, "", graphic->GetUuid());
+    dc->StartGraphic(graphic, "");
 
     dc->StartText(ToDeviceContextX(params.m_x), ToDeviceContextY(params.m_y), HORIZONTALALIGNMENT_right);
     DrawTextChildren(dc, graphic, params);
@@ -873,7 +877,7 @@ void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
 
     // This is a special case where we do not draw (SVG, Bounding boxes, etc.) the measure for unmeasured music
     if (measure->IsMeasuredMusic()) {
-        dc->StartGraphic(measure, "", measure->GetUuid());
+        dc->StartGraphic(measure, "");
     }
 
     if (m_drawingScoreDef.GetMnumVisible() != BOOLEAN_false) {
@@ -923,7 +927,7 @@ void View::DrawMNum(DeviceContext *dc, MNum *mnum, Measure *measure)
     Staff *staff = measure->GetTopVisibleStaff();
     if (staff) {
 
-        dc->StartGraphic(mnum, "", mnum->GetUuid());
+        dc->StartGraphic(mnum, "");
 
         FontInfo mnumTxt;
         if (!dc->UseGlobalStyling()) {
@@ -975,7 +979,7 @@ void View::DrawStaff(DeviceContext *dc, Staff *staff, Measure *measure, System *
         return;
     }
 
-    dc->StartGraphic(staff, "", staff->GetUuid());
+    dc->StartGraphic(staff, "");
 
     if (m_doc->GetType() == Facs) {
         staff->SetFromFacsimile(m_doc);
@@ -1107,7 +1111,7 @@ void View::DrawStaffDef(DeviceContext *dc, Staff *staff, Measure *measure)
     if (!layer || !layer->HasStaffDef()) return;
 
     // StaffDef staffDef;
-    // dc->StartGraphic(&staffDef, "", staffDef.GetUuid());
+    // dc->StartGraphic(&staffDef, "");
 
     // draw the scoreDef if required
     if (layer->GetStaffDefClef()) {
@@ -1137,7 +1141,7 @@ void View::DrawStaffDefCautionary(DeviceContext *dc, Staff *staff, Measure *meas
     if (!layer || !layer->HasCautionStaffDef()) return;
 
     // StaffDef staffDef;
-    // dc->StartGraphic(&staffDef, "cautionary", staffDef.GetUuid());
+    // dc->StartGraphic(&staffDef, "cautionary");
 
     // draw the scoreDef if required
     if (layer->GetCautionStaffDefClef()) {
@@ -1220,7 +1224,7 @@ void View::DrawLayer(DeviceContext *dc, Layer *layer, Staff *staff, Measure *mea
 
     // Now start to draw the layer content
 
-    dc->StartGraphic(layer, "", layer->GetUuid());
+    dc->StartGraphic(layer, "");
 
     DrawLayerChildren(dc, layer, layer, staff, measure);
 
@@ -1442,7 +1446,7 @@ void View::DrawSystemEditorialElement(DeviceContext *dc, EditorialElement *eleme
     std::string boundaryStart;
     if (element->IsBoundaryElement()) boundaryStart = "boundaryStart";
 
-    dc->StartGraphic(element, boundaryStart, element->GetUuid());
+    dc->StartGraphic(element, boundaryStart);
     // EditorialElements at the system level that are visible have no children
     // if (element->m_visibility == Visible) {
     //    DrawSystemChildren(dc, element, system);
@@ -1464,7 +1468,7 @@ void View::DrawMeasureEditorialElement(DeviceContext *dc, EditorialElement *elem
         assert(dynamic_cast<Choice *>(element) && (dynamic_cast<Choice *>(element)->GetLevel() == EDITORIAL_MEASURE));
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
     if (element->m_visibility == Visible) {
         DrawMeasureChildren(dc, element, measure, system);
     }
@@ -1485,7 +1489,7 @@ void View::DrawStaffEditorialElement(DeviceContext *dc, EditorialElement *elemen
         assert(dynamic_cast<Choice *>(element) && (dynamic_cast<Choice *>(element)->GetLevel() == EDITORIAL_STAFF));
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
     if (element->m_visibility == Visible) {
         DrawStaffChildren(dc, element, staff, measure);
     }
@@ -1507,7 +1511,7 @@ void View::DrawLayerEditorialElement(
         assert(dynamic_cast<Choice *>(element) && (dynamic_cast<Choice *>(element)->GetLevel() == EDITORIAL_LAYER));
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
     if (element->m_visibility == Visible) {
         DrawLayerChildren(dc, element, layer, staff, measure);
     }
@@ -1528,7 +1532,7 @@ void View::DrawTextEditorialElement(DeviceContext *dc, EditorialElement *element
         assert(dynamic_cast<Choice *>(element) && (dynamic_cast<Choice *>(element)->GetLevel() == EDITORIAL_TEXT));
     }
 
-    dc->StartTextGraphic(element, "", element->GetUuid());
+    dc->StartTextGraphic(element, "");
     if (element->m_visibility == Visible) {
         DrawTextChildren(dc, element, params);
     }
@@ -1549,7 +1553,7 @@ void View::DrawFbEditorialElement(DeviceContext *dc, EditorialElement *element,
         assert(dynamic_cast<Choice *>(element) && (dynamic_cast<Choice *>(element)->GetLevel() == EDITORIAL_FB));
     }
 
-    dc->StartTextGraphic(element, "", element->GetUuid());
+    dc->StartTextGraphic(element, "");
     if (element->m_visibility == Visible) {
         DrawFbChildren(dc, element, params);
     }
@@ -1570,7 +1574,7 @@ void View::DrawRunningEditorialElement(DeviceContext *dc, EditorialElement *elem
         assert(dynamic_cast<Choice *>(element) && (dynamic_cast<Choice *>(element)->GetLevel() == EDITORIAL_RUNNING));
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
     if (element->m_visibility == Visible) {
         DrawRunningChildren(dc, element, params);
     }
@@ -1582,10 +1586,10 @@ void View::DrawAnnot(DeviceContext *dc, EditorialElement *element, bool isTextEl
     assert(element);
 
     if (isTextElement) {
-        dc->StartTextGraphic(element, "", element->GetUuid());
+        dc->StartTextGraphic(element, "");
     }
     else {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "");
     }
 
     Annot *annot = dynamic_cast<Annot *>(element);
@@ -26,6 +26,18 @@
 
 namespace vrv {
 
+void View::DrawCurrentPageRunningElements(DeviceContext *dc)
+{
+    assert(dc);
+    assert(m_doc);
+
+    dc->SetResources(&m_doc->GetResources());
+
+    m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+
+    DrawRunningElements(dc, m_currentPage);
+}
+
 void View::DrawRunningElements(DeviceContext *dc, Page *page)
 {
     assert(dc);
@@ -52,7 +64,7 @@ void View::DrawPgHeader(DeviceContext *dc, RunningElement *pgHeader)
     assert(dc);
     assert(pgHeader);
 
-    dc->StartGraphic(pgHeader, "", pgHeader->GetUuid());
+    dc->StartGraphic(pgHeader, "");
 
     FontInfo pgHeadTxt;
 
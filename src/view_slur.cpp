@@ -56,7 +56,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
     curve->GetPoints(points);
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic);
     else
         dc->StartGraphic(slur, "spanning-slur", "");
 
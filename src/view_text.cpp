@@ -43,7 +43,7 @@ void View::DrawF(DeviceContext *dc, F *f, TextDrawingParams &params)
     assert(dc);
     assert(f);
 
-    dc->StartTextGraphic(f, "", f->GetUuid());
+    dc->StartTextGraphic(f, "");
 
     DrawTextChildren(dc, f, params);
 
@@ -222,7 +222,7 @@ void View::DrawLb(DeviceContext *dc, Lb *lb, TextDrawingParams &params)
     assert(dc);
     assert(lb);
 
-    dc->StartTextGraphic(lb, "", lb->GetUuid());
+    dc->StartTextGraphic(lb, "");
 
     FontInfo *currentFont = dc->GetFont();
 
@@ -237,7 +237,7 @@ void View::DrawNum(DeviceContext *dc, Num *num, TextDrawingParams &params)
     assert(dc);
     assert(num);
 
-    dc->StartTextGraphic(num, "", num->GetUuid());
+    dc->StartTextGraphic(num, "");
 
     Text *currentText = num->GetCurrentText();
     if (currentText && (currentText->GetText().length() > 0)) {
@@ -255,7 +255,7 @@ void View::DrawFig(DeviceContext *dc, Fig *fig, TextDrawingParams &params)
     assert(dc);
     assert(fig);
 
-    dc->StartGraphic(fig, "", fig->GetUuid());
+    dc->StartGraphic(fig, "");
 
     Svg *svg = dynamic_cast<Svg *>(fig->FindDescendantByType(SVG));
     if (svg) {
@@ -272,7 +272,7 @@ void View::DrawRend(DeviceContext *dc, Rend *rend, TextDrawingParams &params)
     assert(dc);
     assert(rend);
 
-    dc->StartTextGraphic(rend, "", rend->GetUuid());
+    dc->StartTextGraphic(rend, "");
 
     if (params.m_laidOut) {
         if (params.m_alignment == HORIZONTALALIGNMENT_NONE) {
@@ -354,7 +354,7 @@ void View::DrawText(DeviceContext *dc, Text *text, TextDrawingParams &params)
     assert(dc);
     assert(text);
 
-    dc->StartTextGraphic(text, "", text->GetUuid());
+    dc->StartTextGraphic(text, "");
 
     if (params.m_newLine) {
         dc->MoveTextTo(ToDeviceContextX(params.m_x), ToDeviceContextY(params.m_y), HORIZONTALALIGNMENT_NONE);
@@ -389,7 +389,7 @@ void View::DrawSvg(DeviceContext *dc, Svg *svg, TextDrawingParams &params)
     assert(dc);
     assert(svg);
 
-    dc->StartGraphic(svg, "", svg->GetUuid());
+    dc->StartGraphic(svg, "");
 
     dc->DrawSvgShape(
         ToDeviceContextX(params.m_x), ToDeviceContextY(params.m_y), svg->GetWidth(), svg->GetHeight(), svg->Get());
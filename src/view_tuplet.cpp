@@ -65,7 +65,7 @@ void View::DrawTuplet(DeviceContext *dc, LayerElement *element, Layer *layer, St
         tuplet->CalcDrawingBracketAndNumPos();
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "");
 
     // Draw the inner elements
     DrawLayerChildren(dc, tuplet, layer, staff, measure);
@@ -100,7 +100,7 @@ void View::DrawTupletBracket(DeviceContext *dc, LayerElement *element, Layer *la
     data_STAFFREL_basic position = tuplet->GetDrawingBracketPos();
     int lineWidth = m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize);
 
-    dc->ResumeGraphic(tupletBracket, tupletBracket->GetUuid());
+    dc->ResumeGraphic(tupletBracket);
 
     int xLeft = tuplet->GetDrawingLeft()->GetDrawingX() + tupletBracket->GetDrawingXRelLeft();
     int xRight = tuplet->GetDrawingRight()->GetDrawingX() + tupletBracket->GetDrawingXRelRight();
@@ -181,7 +181,7 @@ void View::DrawTupletNum(DeviceContext *dc, LayerElement *element, Layer *layer,
     // adjust the baseline (to be improved with slanted brackets
     y -= m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * 6 / 5;
 
-    dc->ResumeGraphic(tupletNum, tupletNum->GetUuid());
+    dc->ResumeGraphic(tupletNum);
 
     DrawSmuflString(dc, x, y, notes, false, staff->m_drawingStaffSize);
 
@@ -12,6 +12,10 @@
 
 #include <assert.h>
 #include <cmath>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
@@ -20,6 +24,10 @@
 
 #ifndef _WIN32
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #else
 #include "win_dirent.h"
 #include "win_time.h"
@@ -60,28 +68,48 @@ namespace vrv {
 // Static members with some default values
 //----------------------------------------------------------------------------
 
-std::string Resources::m_path = "/usr/local/share/verovio";
-std::map<wchar_t, Glyph> Resources::m_font;
-std::map<wchar_t, Glyph> Resources::m_textFont;
+std::string Resources::s_defaultPath = "/usr/local/share/verovio";
+std::map<std::string, std::weak_ptr<const Resources::GlyphTable> > Resources::s_fontTables;
+std::mutex Resources::s_fontTablesMutex;
 
 //----------------------------------------------------------------------------
 // Font related methods
 //----------------------------------------------------------------------------
 
+Resources::Resources()
+{
+    m_path = GetDefaultPath();
+}
+
+std::string Resources::GetDefaultPath()
+{
+    std::lock_guard<std::mutex> lock(s_fontTablesMutex);
+    return s_defaultPath;
+}
+
+void Resources::SetDefaultPath(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(s_fontTablesMutex);
+    s_defaultPath = path;
+}
+
 bool Resources::InitFonts()
 {
     // We will need to rethink this for adding the option to add custom fonts
-    // Font Bravura first since it is expected to have always all symbols
-    if (!LoadFont("Bravura")) LogError("Bravura font could not be loaded.");
-    // The Leipzig as the default font
-    if (!LoadFont("Leipzig")) LogError("Leipzig font could not be loaded.");
+    // The Leipzig as the default font (loaded over Bravura, see GetFontTable)
+    if (!SetFont("Leipzig")) {
+        LogError("Leipzig font could not be loaded.");
+        SetFont("Bravura");
+    }
 
-    if (m_font.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, m_font.size());
+    int glyphCount = (m_font) ? (int)m_font->size() : 0;
+    if (glyphCount < SMUFL_COUNT) {
+        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, glyphCount);
         return false;
     }
 
-    if (!InitTextFont("Times") || !InitTextFont("VerovioText-1.0")) {
+    m_textFont = GetTextFontTable(m_path);
+    if (!m_textFont) {
         LogError("Text font could not be initialized.");
         return false;
     }
@@ -89,28 +117,84 @@ bool Resources::InitFonts()
     return true;
 }
 
-bool Resources::SetFont(std::string fontName)
+bool Resources::SetFont(const std::string &fontName)
+{
+    std::shared_ptr<const GlyphTable> font = GetFontTable(m_path, fontName);
+    if (!font) return false;
+    m_font = font;
+    return true;
+}
+
+const Glyph *Resources::GetGlyph(wchar_t smuflCode) const
 {
-    return LoadFont(fontName);
+    if (!m_font) return NULL;
+    GlyphTable::const_iterator iter = m_font->find(smuflCode);
+    if (iter == m_font->end()) return NULL;
+    return &iter->second;
 }
 
-Glyph *Resources::GetGlyph(wchar_t smuflCode)
+const Glyph *Resources::GetTextGlyph(wchar_t code) const
 {
-    if (!m_font.count(smuflCode)) return NULL;
-    return &m_font[smuflCode];
+    if (!m_textFont) return NULL;
+    GlyphTable::const_iterator iter = m_textFont->find(code);
+    if (iter == m_textFont->end()) return NULL;
+    return &iter->second;
 }
 
-Glyph *Resources::GetTextGlyph(wchar_t code)
+std::shared_ptr<const Resources::GlyphTable> Resources::GetFontTable(
+    const std::string &path, const std::string &fontName)
 {
-    if (!m_textFont.count(code)) return NULL;
-    return &m_textFont[code];
+    // Loading is done under the lock so a font is never loaded twice
+    std::lock_guard<std::mutex> lock(s_fontTablesMutex);
+
+    std::string key = path + "/" + fontName;
+    std::shared_ptr<const GlyphTable> table = s_fontTables[key].lock();
+    if (table) return table;
+
+    GlyphTable *font = new GlyphTable();
+    // Font Bravura first since it is expected to have always all symbols
+    bool success = LoadFont(path, "Bravura", *font);
+    if (fontName != "Bravura") {
+        if (!success) LogError("Bravura font could not be loaded.");
+        success = LoadFont(path, fontName, *font);
+    }
+    if (!success) {
+        delete font;
+        return NULL;
+    }
+
+    table.reset(font);
+    s_fontTables[key] = table;
+    return table;
 }
 
-bool Resources::LoadFont(std::string fontName)
+std::shared_ptr<const Resources::GlyphTable> Resources::GetTextFontTable(const std::string &path)
 {
+    std::lock_guard<std::mutex> lock(s_fontTablesMutex);
+
+    std::string key = path + "/text/";
+    std::shared_ptr<const GlyphTable> table = s_fontTables[key].lock();
+    if (table) return table;
+
+    GlyphTable *textFont = new GlyphTable();
+    if (!LoadTextFont(path, "Times", *textFont) || !LoadTextFont(path, "VerovioText-1.0", *textFont)) {
+        delete textFont;
+        return NULL;
+    }
+
+    table.reset(textFont);
+    s_fontTables[key] = table;
+    return table;
+}
+
+bool Resources::LoadFont(const std::string &path, const std::string &fontName, GlyphTable &font)
+{
+    // Use the font bundle when available, otherwise load the glyph files one by one
+    if (LoadFontBundle(path, fontName, font)) return true;
+
     ::DIR *dir;
     dirent *pdir;
-    std::string dirname = Resources::GetPath() + "/" + fontName;
+    std::string dirname = path + "/" + fontName;
     dir = opendir(dirname.c_str());
 
     if (!dir) {
@@ -120,7 +204,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // First loop through the fontName directory and load each glyph
     // Since the filename starts with the Unicode code, it is used
-    // to assign the glyph to the corresponding position in m_fonts
+    // to assign the glyph to the corresponding position in the table
     while ((pdir = readdir(dir))) {
         if (strstr(pdir->d_name, ".xml")) {
             // E.g, : E053-gClef8va.xml => strtol extracts E053 as hex
@@ -131,8 +215,8 @@ bool Resources::LoadFont(std::string fontName)
             }
             std::string codeStr = pdir->d_name;
             codeStr = codeStr.substr(0, 4);
-            Glyph glyph(Resources::GetPath() + "/" + fontName + "/" + pdir->d_name, codeStr);
-            m_font[smuflCode] = glyph;
+            Glyph glyph(path + "/" + fontName + "/" + pdir->d_name, codeStr);
+            font[smuflCode] = glyph;
         }
     }
 
@@ -140,7 +224,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // Then load the bounding boxes (if bounding box file is provided)
     pugi::xml_document doc;
-    std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    std::string filename = path + "/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -158,11 +242,11 @@ bool Resources::LoadFont(std::string fontName)
         Glyph *glyph = NULL;
         if (current.attribute("c")) {
             wchar_t smuflCode = (wchar_t)strtol(current.attribute("c").value(), NULL, 16);
-            if (!m_font.count(smuflCode)) {
+            if (!font.count(smuflCode)) {
                 LogWarning("Glyph with code '%d' not found.", smuflCode);
                 continue;
             }
-            glyph = &m_font[smuflCode];
+            glyph = &font[smuflCode];
             if (glyph->GetUnitsPerEm() != unitsPerEm * 10) {
                 LogWarning("Glyph and bounding box units-per-em for code '%d' miss-match (bounding box: %d)", smuflCode,
                     unitsPerEm);
@@ -194,13 +278,100 @@ bool Resources::LoadFont(std::string fontName)
     return true;
 }
 
-bool Resources::InitTextFont(std::string fontName)
+bool Resources::LoadFontBundle(const std::string &path, const std::string &fontName, GlyphTable &font)
+{
+    std::string filename = path + "/" + fontName + ".vrvfont";
+    bool success = false;
+
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat status;
+    if ((fstat(fd, &status) != 0) || (status.st_size == 0)) {
+        close(fd);
+        return false;
+    }
+    size_t size = (size_t)status.st_size;
+    void *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    success = ReadFontBundle((const char *)data, size, path, fontName, font);
+    munmap(data, size);
+#else
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) return false;
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    success = ReadFontBundle(data.data(), data.size(), path, fontName, font);
+#endif
+
+    if (!success) LogError("Font bundle '%s' is not valid", filename.c_str());
+    return success;
+}
+
+bool Resources::ReadFontBundle(
+    const char *data, size_t size, const std::string &path, const std::string &fontName, GlyphTable &font)
+{
+    // See fonts/generate_bundle.py for the layout - values are little-endian, as on all supported platforms
+    const size_t headerSize = 4 + 7 * sizeof(uint32_t);
+    const size_t glyphSize = 10 * sizeof(uint32_t) + 5 * sizeof(double);
+    const size_t anchorSize = 2 * sizeof(uint32_t) + 2 * sizeof(double);
+
+    if ((size < headerSize) || (strncmp(data, "VRVF", 4) != 0)) return false;
+    uint32_t header[7];
+    memcpy(header, data + 4, sizeof(header));
+    // header[0] is the version
+    if (header[0] != 1) return false;
+    const uint32_t glyphCount = header[1];
+    const uint32_t anchorCount = header[2];
+    const char *glyphs = data + header[3];
+    const char *anchors = data + header[4];
+    const char *strings = data + header[5];
+    const uint32_t stringSize = header[6];
+    // Offsets and sizes are compared to what remains so that corrupted values cannot overflow the checks
+    auto fits = [](size_t offset, size_t count, size_t itemSize, size_t total) {
+        return (offset <= total) && (count <= (total - offset) / itemSize);
+    };
+    if (!fits(header[3], glyphCount, glyphSize, size) || !fits(header[4], anchorCount, anchorSize, size)
+        || !fits(header[5], stringSize, 1, size)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < glyphCount; ++i) {
+        uint32_t values[10];
+        double bounds[5];
+        memcpy(values, glyphs + i * glyphSize, sizeof(values));
+        memcpy(bounds, glyphs + i * glyphSize + sizeof(values), sizeof(bounds));
+        // code, units per em, flags, first anchor, anchor count, filename, symbol
+        if (!fits(values[3], values[4], 1, anchorCount) || !fits(values[5], values[6], 1, stringSize)
+            || !fits(values[7], values[8], 1, stringSize)) {
+            return false;
+        }
+        std::string filename(strings + values[5], values[6]);
+        Glyph glyph(path + "/" + fontName + "/" + filename, filename.substr(0, 4), values[1],
+            std::string(strings + values[7], values[8]));
+        if (values[2] & 1) glyph.SetBoundingBox(bounds[0], bounds[1], bounds[2], bounds[3]);
+        if (values[2] & 2) glyph.SetHorizAdvX(bounds[4]);
+        for (uint32_t j = values[3]; j < values[3] + values[4]; ++j) {
+            uint32_t name[2];
+            double point[2];
+            memcpy(name, anchors + j * anchorSize, sizeof(name));
+            memcpy(point, anchors + j * anchorSize + sizeof(name), sizeof(point));
+            if (!fits(name[0], name[1], 1, stringSize)) return false;
+            glyph.SetAnchor(std::string(strings + name[0], name[1]), point[0], point[1]);
+        }
+        font[(wchar_t)values[0]] = glyph;
+    }
+
+    return true;
+}
+
+bool Resources::LoadTextFont(const std::string &path, const std::string &fontName, GlyphTable &textFont)
 {
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = Resources::GetPath() + "/text/" + fontName + ".xml";
+    std::string filename = path + "/text/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -228,10 +399,10 @@ bool Resources::InitTextFont(std::string fontName)
             if (current.attribute("h")) height = atof(current.attribute("h").value());
             glyph.SetBoundingBox(x, y, width, height);
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(atof(current.attribute("h-a-x").value()));
-            if (m_textFont.count(code) > 0) {
+            if (textFont.count(code) > 0) {
                 LogDebug("Redefining %d with %s", code, fontName.c_str());
             }
-            m_textFont[code] = glyph;
+            textFont[code] = glyph;
         }
     }
     return true;
@@ -246,9 +417,8 @@ struct timeval start;
 /** For disabling log */
 bool noLog = false;
 
-#ifdef __EMSCRIPTEN__
-std::vector<std::string> logBuffer;
-#endif
+/** The log buffer of the toolkit used in the current thread */
+static thread_local std::vector<std::string> *logBuffer = NULL;
 
 void LogElapsedTimeStart()
 {
@@ -352,11 +522,25 @@ void DisableLog()
     noLog = true;
 }
 
+void SetLogBuffer(std::vector<std::string> *buffer)
+{
+    logBuffer = buffer;
+}
+
+std::vector<std::string> *GetLogBuffer()
+{
+    return logBuffer;
+}
+
 #ifdef __EMSCRIPTEN__
+/** For appending to a buffer shared between threads */
+static std::mutex logBufferMutex;
+
 bool LogBufferContains(const std::string &s)
 {
-    std::vector<std::string>::iterator iter = logBuffer.begin();
-    while (iter != logBuffer.end()) {
+    if (!logBuffer) return false;
+    std::vector<std::string>::iterator iter = logBuffer->begin();
+    while (iter != logBuffer->end()) {
         if ((*iter) == s) return true;
         ++iter;
     }
@@ -365,8 +549,12 @@ bool LogBufferContains(const std::string &s)
 
 void AppendLogBuffer(bool checkDuplicate, std::string message, consoleLogLevel level)
 {
-    if (checkDuplicate && LogBufferContains(message)) return;
-    logBuffer.push_back(message);
+    {
+        // The buffer of a toolkit can be shared with its worker threads (see Toolkit::RenderAllToSVG)
+        std::lock_guard<std::mutex> lock(logBufferMutex);
+        if (checkDuplicate && LogBufferContains(message)) return;
+        if (logBuffer) logBuffer->push_back(message);
+    }
 
     switch (level) {
         case CONSOLE_ERROR: EM_ASM_ARGS({ console.error(UTF8ToString($0)); }, message.c_str()); break;
@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench_attconverter.cpp
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "attconverter.h"
+
+using namespace vrv;
+
+/**
+ * Convert back and forth the values of a few enums of AttConverter, from a small one (data.BOOLEAN) to the largest
+ * one (data.COLORNAMES). Each value is looked up in the four enums, and one value in four is a token of none of them.
+ * Usage: bench_attconverter [iterations]
+ */
+int main(int argc, char **argv)
+{
+    int iterations = (argc > 1) ? atoi(argv[1]) : 1000;
+
+    AttConverter converter;
+    std::vector<std::string> values;
+    for (int i = BOOLEAN_NONE + 1; i < BOOLEAN_MAX; ++i) {
+        values.push_back(converter.BooleanToStr((data_BOOLEAN)i));
+    }
+    for (int i = ACCIDENTAL_WRITTEN_NONE + 1; i < ACCIDENTAL_WRITTEN_MAX; ++i) {
+        values.push_back(converter.AccidentalWrittenToStr((data_ACCIDENTAL_WRITTEN)i));
+    }
+    for (int i = ARTICULATION_NONE + 1; i < ARTICULATION_MAX; ++i) {
+        values.push_back(converter.ArticulationToStr((data_ARTICULATION)i));
+    }
+    for (int i = COLORNAMES_NONE + 1; i < COLORNAMES_MAX; ++i) {
+        values.push_back(converter.ColornamesToStr((data_COLORNAMES)i));
+    }
+    const int tokenCount = (int)values.size();
+    for (int i = 0; i < tokenCount / 3; ++i) {
+        values.push_back(values.at(i) + "-unknown");
+    }
+
+    int count = 0;
+    std::chrono::duration<double, std::milli> strToDuration(0);
+    std::chrono::duration<double, std::milli> toStrDuration(0);
+    for (int i = 0; i < iterations; ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<int> converted;
+        converted.reserve(values.size() * 4);
+        for (const std::string &value : values) {
+            converted.push_back(converter.StrToBoolean(value, false));
+            converted.push_back(converter.StrToAccidentalWritten(value, false));
+            converted.push_back(converter.StrToArticulation(value, false));
+            converted.push_back(converter.StrToColornames(value, false));
+        }
+        std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+        for (int j = 0; j < (int)converted.size(); j += 4) {
+            if (converted.at(j) != BOOLEAN_NONE) count += converter.BooleanToStr((data_BOOLEAN)converted.at(j)).size();
+            if (converted.at(j + 1) != ACCIDENTAL_WRITTEN_NONE) {
+                count += converter.AccidentalWrittenToStr((data_ACCIDENTAL_WRITTEN)converted.at(j + 1)).size();
+            }
+            if (converted.at(j + 2) != ARTICULATION_NONE) {
+                count += converter.ArticulationToStr((data_ARTICULATION)converted.at(j + 2)).size();
+            }
+            if (converted.at(j + 3) != COLORNAMES_NONE) {
+                count += converter.ColornamesToStr((data_COLORNAMES)converted.at(j + 3)).size();
+            }
+        }
+        strToDuration += middle - start;
+        toStrDuration += std::chrono::steady_clock::now() - middle;
+    }
+
+    std::cout << values.size() << " values (" << tokenCount << " tokens), " << count / iterations
+              << " characters converted back: StrTo* " << strToDuration.count() / iterations << " ms, *ToStr "
+              << toStrDuration.count() / iterations << " ms per pass" << std::endl;
+    return 0;
+}
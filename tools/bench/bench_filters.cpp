@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench_filters.cpp
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <iostream>
+#include <set>
+
+//----------------------------------------------------------------------------
+
+#include "comparison.h"
+#include "doc.h"
+#include "functorparams.h"
+#include "iomei.h"
+#include "layer.h"
+#include "staff.h"
+
+using namespace vrv;
+
+/**
+ * Time Object::Process with staff and layer filters, as done for extracting one staff or layer.
+ * The notes of each staff / layer pair of an MEI file are gathered with FindAllByComparison.
+ * Usage: bench_filters <file.mei> [iterations]
+ */
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: bench_filters <file.mei> [iterations]" << std::endl;
+        return 1;
+    }
+    int iterations = (argc > 2) ? atoi(argv[2]) : 20;
+
+    Doc doc;
+    MeiInput input(&doc, argv[1]);
+    if (!input.ImportFile()) {
+        std::cerr << "Cannot load " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // The staff and layer numbers used in the file
+    std::set<int> staffNs;
+    std::set<int> layerNs;
+    ArrayOfObjects objects;
+    ClassIdComparison isStaff(STAFF);
+    doc.FindAllDescendantByComparison(&objects, &isStaff);
+    for (Object *object : objects) staffNs.insert(dynamic_cast<Staff *>(object)->GetN());
+    objects.clear();
+    ClassIdComparison isLayer(LAYER);
+    doc.FindAllDescendantByComparison(&objects, &isLayer);
+    for (Object *object : objects) layerNs.insert(dynamic_cast<Layer *>(object)->GetN());
+
+    size_t noteCount = 0;
+    std::chrono::duration<double, std::milli> duration(0);
+    for (int i = 0; i < iterations; ++i) {
+        for (int staffN : staffNs) {
+            for (int layerN : layerNs) {
+                AttNIntegerComparison matchStaff(STAFF, staffN);
+                AttNIntegerComparison matchLayer(LAYER, layerN);
+                ArrayOfComparisons filters = { &matchStaff, &matchLayer };
+                ClassIdComparison isNote(NOTE);
+                ArrayOfObjects notes;
+                Functor findAllByComparison(&Object::FindAllByComparison);
+                FindAllByComparisonParams findAllByComparisonParams(&isNote, &notes);
+
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                doc.Process(&findAllByComparison, &findAllByComparisonParams, NULL, &filters);
+                duration += std::chrono::steady_clock::now() - start;
+                noteCount += notes.size();
+            }
+        }
+    }
+
+    std::cout << staffNs.size() << " staves, " << layerNs.size() << " layers, " << noteCount / iterations
+              << " notes: " << duration.count() / iterations << " ms per pass" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench_objects.cpp
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "comparison.h"
+#include "doc.h"
+#include "iomei.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Allocation counting
+//----------------------------------------------------------------------------
+
+// The size is kept in front of each block so that the live bytes can be counted when it is deleted
+static size_t s_liveBytes = 0;
+static size_t s_allocations = 0;
+static const size_t s_blockHeader = 16;
+
+void *operator new(size_t size)
+{
+    char *block = static_cast<char *>(malloc(size + s_blockHeader));
+    if (!block) throw std::bad_alloc();
+    *reinterpret_cast<size_t *>(block) = size;
+    s_liveBytes += size;
+    ++s_allocations;
+    return block + s_blockHeader;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (!ptr) return;
+    char *block = static_cast<char *>(ptr) - s_blockHeader;
+    s_liveBytes -= *reinterpret_cast<size_t *>(block);
+    free(block);
+}
+
+void operator delete(void *ptr, size_t size) noexcept
+{
+    operator delete(ptr);
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t size) noexcept
+{
+    operator delete(ptr);
+}
+
+//----------------------------------------------------------------------------
+// AnyComparison
+//----------------------------------------------------------------------------
+
+class AnyComparison : public Comparison {
+
+public:
+    virtual bool operator()(Object *object) { return true; }
+    virtual bool MatchesType(Object *object) { return true; }
+};
+
+//----------------------------------------------------------------------------
+
+/**
+ * Report the heap memory and the allocations per note of a loaded MEI file, and the time for getting the uuid of
+ * all its objects and for finding them by uuid.
+ * Usage: bench_objects <file.mei> [iterations]
+ */
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: bench_objects <file.mei> [iterations]" << std::endl;
+        return 1;
+    }
+    int iterations = (argc > 2) ? atoi(argv[2]) : 20;
+
+    Doc *doc = new Doc();
+    size_t liveBytes = s_liveBytes;
+    size_t allocations = s_allocations;
+    MeiInput *input = new MeiInput(doc, argv[1]);
+    bool success = input->ImportFile();
+    delete input;
+    if (!success) {
+        std::cerr << "Cannot load " << argv[1] << std::endl;
+        return 1;
+    }
+    liveBytes = s_liveBytes - liveBytes;
+    allocations = s_allocations - allocations;
+
+    ArrayOfObjects objects;
+    ClassIdComparison isNote(NOTE);
+    doc->FindAllDescendantByComparison(&objects, &isNote);
+    size_t noteCount = objects.size();
+    objects.clear();
+    AnyComparison isAny;
+    doc->FindAllDescendantByComparison(&objects, &isAny);
+
+    std::cout << noteCount << " notes, " << liveBytes / 1024 << " kB, " << allocations << " allocations" << std::endl;
+    std::cout << "per note: " << liveBytes / noteCount << " bytes, " << (double)allocations / noteCount
+              << " allocations" << std::endl;
+
+    size_t length = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (Object *object : objects) length += object->GetUuid().size();
+    }
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    std::cout << "GetUuid on " << objects.size() << " objects: " << duration.count() / iterations << " ms ("
+              << length / iterations << " characters)" << std::endl;
+
+    std::vector<std::string> uuids;
+    for (Object *object : objects) uuids.push_back(object->GetUuid());
+    size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const std::string &uuid : uuids) found += (doc->FindDescendantByUuid(uuid) != NULL);
+    }
+    duration = std::chrono::steady_clock::now() - start;
+    std::cout << "FindDescendantByUuid on " << uuids.size() << " uuids: " << duration.count() / iterations << " ms ("
+              << found / iterations << " found)" << std::endl;
+
+    delete doc;
+    return 0;
+}
@@ -22,7 +22,7 @@ extern "C" {
 void *vrvToolkit_constructor()
 {
     // set the default resource path
-    Resources::SetPath("/data");
+    Resources::SetDefaultPath("/data");
 
     return new Toolkit();
 }
@@ -30,7 +30,7 @@ void *vrvToolkit_constructor()
 void *vrvToolkit_constructorResourcePath(const char* resourcePath)
 {
     // set the resource path
-    Resources::SetPath(resourcePath);
+    Resources::SetDefaultPath(resourcePath);
 
     return new Toolkit();
 }
@@ -62,6 +62,11 @@ const char *vrvToolkit_getAvailableOptions(Toolkit *tk)
     return tk->GetCString();
 }
 
+int vrvToolkit_getCastOffPageCount(Toolkit *tk)
+{
+    return tk->GetCastOffPageCount();
+}
+
 const char *vrvToolkit_getElementAttr(Toolkit *tk, const char *xmlId)
 {
     tk->SetCString(tk->GetElementAttr(xmlId));
@@ -137,6 +142,11 @@ const char *vrvToolkit_getVersion(Toolkit *tk)
     return tk->GetCString();
 }
 
+bool vrvToolkit_hasPendingPages(Toolkit *tk)
+{
+    return tk->HasPendingPages();
+}
+
 bool vrvToolkit_loadData(Toolkit *tk, const char *data)
 {
     tk->ResetLogBuffer();
@@ -169,6 +179,11 @@ void vrvToolkit_redoLayout(Toolkit *tk)
     tk->RedoLayout();
 }
 
+void vrvToolkit_redoModifiedLayout(Toolkit *tk)
+{
+    tk->RedoModifiedLayout();
+}
+
 void vrvToolkit_redoPagePitchPosLayout(Toolkit *tk)
 {
     tk->RedoPagePitchPosLayout();
@@ -14,6 +14,7 @@ void *vrvToolkit_constructorResourcePath(const char * resourcePath);
 void vrvToolkit_destructor(Toolkit *tk);
 bool vrvToolkit_edit(Toolkit *tk, const char *editorAction);
 const char *vrvToolkit_getAvailableOptions(Toolkit *tk);
+int vrvToolkit_getCastOffPageCount(Toolkit *tk);
 const char *vrvToolkit_getElementAttr(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getElementsAtTime(Toolkit *tk, int millisec);
 const char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
@@ -27,11 +28,13 @@ int vrvToolkit_getPageCount(Toolkit *tk);
 int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId);
 double vrvToolkit_getTimeForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getVersion(Toolkit *tk);
+bool vrvToolkit_hasPendingPages(Toolkit *tk);
 bool vrvToolkit_loadData(Toolkit *tk, const char *data);
 const char *vrvToolkit_renderToMIDI(Toolkit *tk, const char *c_options);
 const char *vrvToolkit_renderToSVG(Toolkit *tk, int page_no, const char *c_options);
 const char *vrvToolkit_renderToTimemap(Toolkit *tk);
 void vrvToolkit_redoLayout(Toolkit *tk);
+void vrvToolkit_redoModifiedLayout(Toolkit *tk);
 void vrvToolkit_redoPagePitchPosLayout(Toolkit *tk);
 const char *vrvToolkit_renderData(Toolkit *tk, const char *data, const char *options);
 void vrvToolkit_setOptions(Toolkit *tk, const char *options);
@@ -6,6 +6,7 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <assert.h>
+#include <fstream>
 #include <iostream>
 #include <regex>
 #include <sstream>
@@ -111,7 +112,7 @@ void display_usage()
     std::cout << " -f, --format <s>      Select input format: abc, darms, mei, pae, xml (default is mei)" << std::endl;
     std::cout << " -o, --outfile <s>     Output file name (use \"-\" for standard output)" << std::endl;
     std::cout << " -p, --page <i>        Select the page to engrave (default is 1)" << std::endl;
-    std::cout << " -r, --resources <s>   Path to SVG resources (default is " << vrv::Resources::GetPath() << ")" << std::endl;
+    std::cout << " -r, --resources <s>   Path to SVG resources (default is " << vrv::Resources::GetDefaultPath() << ")" << std::endl;
     std::cout << " -s, --scale <i>       Scale percent (default is " << DEFAULT_SCALE << ")" << std::endl;
     std::cout << " -t, --type <s>        Select output format: mei, svg, or midi (default is svg)" << std::endl;
     std::cout << " -v, --version         Display the version number" << std::endl;
@@ -201,7 +202,7 @@ int main(int argc, char **argv)
 
     // Create the toolkit instance without loading the font because
     // the resource path might be specified in the parameters
-    // The fonts will be loaded later with Resources::InitFonts()
+    // The fonts will be loaded later with Toolkit::SetResourcePath()
     vrv::Toolkit toolkit(false);
 
     if (argc < 2) {
@@ -354,7 +355,7 @@ int main(int argc, char **argv)
 
             case 'p': page = atoi(optarg); break;
 
-            case 'r': vrv::Resources::SetPath(optarg); break;
+            case 'r': vrv::Resources::SetDefaultPath(optarg); break;
 
             case 't':
                 outformat = std::string(optarg);
@@ -406,21 +407,21 @@ int main(int argc, char **argv)
 
     // Make sure the user uses a valid Resource path
     // Save many headaches for empty SVGs
-    if (!dir_exists(vrv::Resources::GetPath())) {
-        std::cerr << "The resources path " << vrv::Resources::GetPath() << " could not be found; please use -r option."
-                  << std::endl;
+    if (!dir_exists(vrv::Resources::GetDefaultPath())) {
+        std::cerr << "The resources path " << vrv::Resources::GetDefaultPath()
+                  << " could not be found; please use -r option." << std::endl;
         exit(1);
     }
 
     // Load the music font from the resource directory
-    if (!vrv::Resources::InitFonts()) {
+    if (!toolkit.SetResourcePath(vrv::Resources::GetDefaultPath())) {
         std::cerr << "The music font could not be loaded; please check the contents of the resource directory."
                   << std::endl;
         exit(1);
     }
 
     // Load a specified font
-    if (!vrv::Resources::SetFont(options->m_font.GetValue())) {
+    if (!toolkit.SetFont(options->m_font.GetValue())) {
         std::cerr << "Font '" << options->m_font.GetValue() << "' could not be loaded." << std::endl;
         exit(1);
     }
@@ -469,9 +470,10 @@ int main(int argc, char **argv)
 
     if (toolkit.GetOutputTo() != vrv::HUMDRUM) {
         // Check the page range
-        if (page > toolkit.GetPageCount()) {
+        // With a progressive cast off, the page count is a lower bound and the page is checked when it is rendered
+        if ((page > toolkit.GetCastOffPageCount()) && !toolkit.HasPendingPages()) {
             std::cerr << "The page requested (" << page << ") is not in the page range (max is "
-                      << toolkit.GetPageCount() << ")." << std::endl;
+                      << toolkit.GetCastOffPageCount() << ")." << std::endl;
             exit(1);
         }
         if (page < 1) {
@@ -481,29 +483,31 @@ int main(int argc, char **argv)
     }
 
     int from = page;
-    int to = page + 1;
-    if (all_pages) {
-        to = toolkit.GetPageCount() + 1;
-    }
+    // All the pages are rendered up to the last one, which is not known before the cast off is completed
+    int to = (all_pages) ? 0 : page;
 
     if (outformat == "svg") {
-        int p;
-        for (p = from; p < to; ++p) {
+        // Render the pages in a single pass, with the layout and the output of the pages done concurrently
+        auto writePage = [&](int p, const std::string &svg) {
+            if (std_output) {
+                std::cout << svg;
+                return true;
+            }
             std::string cur_outfile = outfile;
             if (all_pages) {
                 cur_outfile += vrv::StringFormat("_%03d", p);
             }
             cur_outfile += ".svg";
-            if (std_output) {
-                std::cout << toolkit.RenderToSVG(p);
-            }
-            else if (!toolkit.RenderToSVGFile(cur_outfile, p)) {
+            std::ofstream svgfile(cur_outfile.c_str());
+            if (!svgfile.is_open() || !(svgfile << svg)) {
                 std::cerr << "Unable to write SVG to " << cur_outfile << "." << std::endl;
-                exit(1);
-            }
-            else {
-                std::cerr << "Output written to " << cur_outfile << "." << std::endl;
+                return false;
             }
+            std::cerr << "Output written to " << cur_outfile << "." << std::endl;
+            return true;
+        };
+        if (!toolkit.RenderAllToSVG(writePage, from, to, (all_pages) ? 0 : 1, !std_output)) {
+            exit(1);
         }
     }
 